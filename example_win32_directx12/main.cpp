@@ -26,13 +26,24 @@
 #include "settings.h"
 #include "custom_widgets.h"
 #include "hvk_gui.h"
+#include "hvk_font_cache.h"
+#include "hvk_sdf.h"
+#include "hvk_glow_cache.h"
 #include "util/texhelper.h"
 #include "util/disk.h"
 #include "util/web_helper.h"
+#include "util/asset_vfs.h"
+#include "util/embedded_assets.h"
+#include "util/download_manager.h"
+#include "util/task_graph.h"
+#include "util/asset_bootstrap.h"
+#include "util/file_watch.h"
+#include "util/write_behind.h"
 #include "util/theme_helper.h"
 #include "glow_pipeline.h"
 
 #include <mmsystem.h>
+#include <dbt.h>
 #pragma comment(lib, "winmm.lib")
 
 #include <cstdarg>
@@ -73,12 +84,13 @@ static void DebugLog(const char* fmt, ...)
 		}
 }
 #else
-#define DebugLog(...) (void)0
+// arguments stay referenced (unevaluated) so release builds don't warn about them
+#define DebugLog(...) ((void)sizeof(printf(__VA_ARGS__)))
 #endif
 
 struct PendingFrame
 {
-        std::vector<unsigned char> bytes;
+        AssetData bytes;
 };
 
 static std::mutex g_texMutex;
@@ -149,9 +161,24 @@ void RefreshDisks()
 
 	g_App.Volumes = Disk::ListVolumes();
 
+	g_App.LayoutGeneration++;
 	g_App.NeedsRefresh = false;
 }
 
+// Only re-reads the disk a batch touched, instead of probing all 32 drives
+void RescanDisk(int physicalIndex)
+{
+	g_App.RescanDisk = -1;
+
+	DiskInfo info{};
+	if (Disk::IsValidIndex(physicalIndex, (int)g_App.PhysicalDisks.size()) &&
+		Disk::GetDiskInfo(physicalIndex, info))
+		g_App.PhysicalDisks[physicalIndex] = info;
+
+	g_App.Volumes = Disk::ListVolumes();
+	Disk::RefreshPartitionsForSelectedDisk();
+}
+
 
 bool Disk::IsValidIndex(int idx, int size)
 {
@@ -160,6 +187,8 @@ bool Disk::IsValidIndex(int idx, int size)
 
 void Disk::RefreshPartitionsForSelectedDisk()
 {
+	g_App.LayoutGeneration++;
+
 	if (!IsValidIndex(
 		g_App.Selection.PhysicalIndex,
 		(int)g_App.PhysicalDisks.size()))
@@ -401,25 +430,13 @@ bool LoadTextureFromMemory(const void* data, size_t data_size, ID3D12Device* d3d
 bool LoadTextureFromFile(const char* file_name, ID3D12Device* d3d_device, D3D12_CPU_DESCRIPTOR_HANDLE srv_cpu_handle, ID3D12Resource** out_tex_resource, int* out_width, int* out_height)
 {
         DebugLog("LoadTextureFromFile: start (%s)", file_name);
-        FILE* f = fopen(file_name, "rb");
-        if (f == NULL)
+        AssetData file_data;
+        if (!AssetVfs::Read(file_name, file_data))
         {
                 DebugLog("LoadTextureFromFile: failed to open file");
                 return false;
         }
-        fseek(f, 0, SEEK_END);
-        size_t file_size = (size_t)ftell(f);
-        if (file_size == -1)
-        {
-                DebugLog("LoadTextureFromFile: failed to get file size");
-                return false;
-        }
-        fseek(f, 0, SEEK_SET);
-        void* file_data = IM_ALLOC(file_size);
-        fread(file_data, 1, file_size, f);
-        fclose(f);
-        bool ret = LoadTextureFromMemory(file_data, file_size, d3d_device, srv_cpu_handle, out_tex_resource, out_width, out_height);
-        IM_FREE(file_data);
+        bool ret = LoadTextureFromMemory(file_data.Data, file_data.Size, d3d_device, srv_cpu_handle, out_tex_resource, out_width, out_height);
 
         DebugLog("LoadTextureFromFile: completed with result=%s", ret ? "true" : "false");
         return ret;
@@ -732,24 +749,16 @@ static void BgReloadWorker()
         DebugLog("BgReloadWorker: reading path=%s", WStringToUtf8(path).c_str());
 
 	// Read bytes (binary)
-	std::string utf8 = WStringToUtf8(path);
-        FILE* f = fopen(utf8.c_str(), "rb");
-        if (!f)
+        AssetData data;
+        if (!AssetVfs::Read(path, data))
         {
-                DebugLog("BgReloadWorker: fopen failed for %s", utf8.c_str());
+                DebugLog("BgReloadWorker: read failed for %s", WStringToUtf8(path).c_str());
                 return;
         }
 
-	fseek(f, 0, SEEK_END);
-	size_t sz = (size_t)ftell(f);
-	fseek(f, 0, SEEK_SET);
-
-	std::vector<unsigned char> bytes;
-	bytes.resize(sz);
-        fread(bytes.data(), 1, sz, f);
-        fclose(f);
+	std::vector<unsigned char> bytes(data.Data, data.Data + data.Size);
 
-        DebugLog("BgReloadWorker: read %zu bytes", sz);
+        DebugLog("BgReloadWorker: read %zu bytes", data.Size);
 
         {
                 std::lock_guard<std::mutex> lock(g_bgJob.mtx);
@@ -1179,7 +1188,7 @@ static std::wstring MakeFramePath(const std::wstring& base, int i)
 	// Try 0001.png style first
 	swprintf_s(buf, L"%04d.png", i);
 	std::wstring p = base + buf;
-	if (std::filesystem::exists(p))
+	if (AssetVfs::Exists(p))
 		return p;
 
 	// Fallback to 1.png style
@@ -1243,7 +1252,7 @@ void SwapLoadingIconTheme(LoadingTheme theme)
 						break;
 
 					std::wstring fullPath = MakeFramePath(base, i);
-					if (!std::filesystem::exists(fullPath))
+					if (!AssetVfs::Exists(fullPath))
 						continue;
 
 					HVKTexture tex{};
@@ -1273,21 +1282,10 @@ void SwapLoadingIconTheme(LoadingTheme theme)
 					break;
 
 				std::wstring fullPath = MakeFramePath(base, i);
-				if (!std::filesystem::exists(fullPath))
-					continue;
-
-				FILE* f = _wfopen(fullPath.c_str(), L"rb");
-				if (!f)
-					continue;
-
-				fseek(f, 0, SEEK_END);
-				size_t sz = (size_t)ftell(f);
-				fseek(f, 0, SEEK_SET);
 
 				PendingFrame p;
-				p.bytes.resize(sz);
-				fread(p.bytes.data(), 1, sz, f);
-				fclose(f);
+				if (!AssetVfs::Read(fullPath, p.bytes))
+					continue;
 
 				local.push_back(std::move(p));
 			}
@@ -1368,8 +1366,8 @@ void PumpTexturesToGPU()
 		int w = 0, h = 0;
 
 		if (!LoadTextureFromMemory(
-			item.bytes.data(),
-			item.bytes.size(),
+			item.bytes.Data,
+			item.bytes.Size,
 			g_pd3dDevice,
 			cpu,
 			&texRes,
@@ -1492,322 +1490,540 @@ void ApplyRenderSettings()
 	}
 }
 
-static std::filesystem::file_time_type lastWrite;
+static FileWatcher g_SettingsWatcher;
 
-void PollSettingsHotReload()
+static bool StartsWith(const std::string& s, const char* prefix)
 {
-	auto now = std::filesystem::last_write_time(HVKIO::GetLocalAppDataW() + L"\\PSHVK\\");
-	if (now != lastWrite)
-	{
-		lastWrite = now;
-		ApplyUserStyle();
-		ApplyRenderSettings();
-	}
+	return s.rfind(prefix, 0) == 0;
 }
 
-
-// Main code
-int main(int, char**)
+// Only touches what changed: colours re-apply the ImGui style, the bg / loading
+// theme go through ApplyRenderSettings, everything else is just the new value.
+void PollSettingsHotReload()
 {
-	timeBeginPeriod(1);
-
-	settings->is_first_run = IsFirstRun();
+	const std::wstring base = HVKIO::GetLocalAppDataW() + L"\\PSHVK\\";
+	std::vector<std::filesystem::path> files;
 
-	if (settings->is_first_run)
+	// the watcher thread stops if the OS stops delivering events; re-arm it every
+	// couple of seconds and re-read both files, changes may have been missed
+	if (!g_SettingsWatcher.Running())
 	{
-		HVKIO::DownloadPSHVKAssets();
-		HVKIO::CreateInstanceFile();
+		static ULONGLONG lastRearm = 0;
+		const ULONGLONG now = GetTickCount64();
+		if (now - lastRearm < 2000)
+			return;
+		lastRearm = now;
+
+		if (!g_SettingsWatcher.Start(base))
+			return;
+		files.push_back(std::filesystem::path());
 	}
 
-	if (!HVKIO::ValidateInstanceFile() && !settings->metadata.dev_build)
+	if (!g_SettingsWatcher.Poll(files) && files.empty())
+		return;
+
+	bool userFile = false;
+	bool globalFile = false;
+	for (const auto& f : files)
 	{
-		MessageBoxA(nullptr, "Instance file invalid.", "PSHVK", MB_ICONERROR);
-		ExitProcess(0);
+		const std::wstring name = f.filename().wstring();
+		userFile |= name.empty() || name == L"usersettings.hvk";
+		globalFile |= name.empty() || name == L"settings.hvk";
+
+		if (name.empty() || name == L"instance.hvk")
+			HVKIO::InstanceFileChanged();
 	}
 
+	std::vector<std::string> changed;
+
+	if (globalFile)
+		c_settings::ReloadFromHvk(base + L"settings.hvk", changed);
+
+	if (userFile)
+		c_usersettings::ReloadFromHvk(base + L"usersettings.hvk", changed);
 
-	if (HVKSYS::SupportsDX12())
+	bool style = false;
+	bool render = false;
+	for (const auto& c : changed)
 	{
-		g_App.g_RenderBackend = RenderBackend::DX12;
+		DebugLog("Hot reload: %s", c.c_str());
+
+		if (c == "render.bg_image_path" || c == "style.loading_theme" || c == "style.bg_theme")
+			render = true;
+		else if (StartsWith(c, "style."))
+			style = true;
 	}
-	else
+
+	if (style)
 	{
-		g_App.g_RenderBackend = RenderBackend::DX11;
+		++user->style.generation;
+		ApplyUserStyle();
 	}
+	if (render)
+		ApplyRenderSettings();
+}
 
+// Time-to-first-frame, from static init to the first Present, with where
+// the assets it used came from (embedded ones mean the full set wasn't there yet)
+static const std::chrono::steady_clock::time_point g_StartupTime = std::chrono::steady_clock::now();
 
-	// Make process DPI aware and obtain main monitor scale
-	ImGui_ImplWin32_EnableDpiAwareness();
-	float main_scale = ImGui_ImplWin32_GetDpiScaleForMonitor(::MonitorFromPoint(POINT{ 0, 0 }, MONITOR_DEFAULTTOPRIMARY));
+// Init steps of main(), see there
+static TaskGraph g_Startup;
 
-	user->style.dpi_scale = main_scale;    // set once at startup
+static void ReportFirstFrame()
+{
+	static bool reported = false;
+	if (reported)
+		return;
+	reported = true;
 
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - g_StartupTime).count();
+	const AssetVfsStats s = AssetVfs::Stats();
 
-	// Create application window
-	WNDCLASSEXW wc = { sizeof(wc), CS_CLASSDC, WndProc, 0L, 0L, GetModuleHandle(nullptr), nullptr, nullptr, nullptr, nullptr, L"WC_HVK", nullptr };
-	::RegisterClassExW(&wc);
-	// HWND hwnd = ::CreateWindowW(wc.lpszClassName, L"PSHVK Window", WS_OVERLAPPEDWINDOW, 100, 100, (int)(1280 * main_scale), (int)(800 * main_scale), nullptr, nullptr, wc.hInstance, nullptr); // Use this to display title bar.
-	HWND hwnd = ::CreateWindowW(wc.lpszClassName, L"PSHVK Window", WS_POPUPWINDOW, 100, 100, (int)(1280 * main_scale), (int)(800 * main_scale), nullptr, nullptr, wc.hInstance, nullptr);
+	DebugLog("[STARTUP] first frame after %.1f ms  (assets: pack=%llu disk=%llu embedded=%llu missing=%llu)",
+		ms, (unsigned long long)s.Pack, (unsigned long long)s.Disk,
+		(unsigned long long)s.Fallback, (unsigned long long)s.Missing);
 
-	// Initialize Direct3D
-	bool rendererOk = false;
+	const FontCacheStats fc = HvkFontCache::Stats();
+	DebugLog("[FONT] cache: stored=%llu hits=%llu misses=%llu  (read in %.2f ms)",
+		(unsigned long long)fc.Stored, (unsigned long long)fc.Hits,
+		(unsigned long long)fc.Misses, fc.LoadMs);
 
-	// Try DX12 first if preferred
-	if (g_App.g_RenderBackend == RenderBackend::DX12)
-	{
-		rendererOk = HVKSYS::InitDX12(hwnd);
-		if (!rendererOk)
-			g_App.g_RenderBackend = RenderBackend::DX11; // fallback
-	}
+	// Open in chrome://tracing or ui.perfetto.dev to compare against an earlier run
+	g_Startup.Mark("first frame");
+	g_Startup.WriteChromeTrace(HVKIO::GetLocalAppDataW() + L"\\PSHVK\\startup_trace.json");
+}
 
-	// If DX12 failed or we prefer DX11
-	if (!rendererOk && g_App.g_RenderBackend == RenderBackend::DX11)
-	{
-		rendererOk = HVKSYS::InitDX11(hwnd);
-	}
+// ------------------------------------------------------------
+// Asset bootstrap
+// ------------------------------------------------------------
+// Sync, pack and verify run on the bootstrap's workers while the UI is already
+// up (on whatever is mounted or embedded); the main loop picks the new assets
+// up between frames once it hands them over.
+static AssetBootstrap g_Bootstrap;
+static bool g_BootstrapLoading = false;   // loading screen is up only because assets were missing
+
+static void StartBootstrap()
+{
+	AssetBootstrapSteps steps;
+	steps.Sync = [](const std::atomic<bool>* cancel) { return HVKIO::DownloadPSHVKAssets(cancel); };
+	steps.Mount = []() { return HVKIO::MountPSHVKAssets(); };
+	g_Bootstrap.Start(std::move(steps));
+}
 
-	if (!rendererOk)
+static void StopBootstrap()
+{
+	g_Bootstrap.Stop();
+}
+
+// Called between frames: fonts, loading animation and background come back
+// through the VFS, now from the fresh assets.
+static void PollBootstrap()
+{
+	static bool reported = false;
+	if (!reported && g_Bootstrap.Graph().Finished())
 	{
-		MessageBoxA(
-			nullptr,
-			"Failed to initialize a D3D11/D3D12 renderer on this system.",
-			"Fatal Error",
-			MB_ICONERROR
-		);
+		reported = true;
+		const std::string summary = g_Bootstrap.Graph().Summary();
+		DebugLog("[BOOT] asset bootstrap:\n%s", summary.c_str());
 
-		HVKSYS::CleanupDeviceD3D11();
-		CleanupDeviceD3D();
-		::UnregisterClassW(wc.lpszClassName, wc.hInstance);
-		return 1;
+		const std::string verifyError = g_Bootstrap.VerifyError();
+		if (!verifyError.empty())
+			DebugLog("[BOOT] pack failed verification (%s), using loose assets", verifyError.c_str());
+
+		// nothing new arrived, so nothing will take the loading screen down
+		if (g_BootstrapLoading && !g_Bootstrap.SwapPending())
+		{
+			g_BootstrapLoading = false;
+			settings->isLoading = false;
+		}
 	}
 
+	if (!g_Bootstrap.TakeSwap())
+		return;
 
-	// Show the window
-	::ShowWindow(hwnd, SW_SHOWMAXIMIZED);
-	::UpdateWindow(hwnd);
+	DebugLog("[BOOT] hot swapping assets");
 
-	// Setup Dear ImGui context
-	IMGUI_CHECKVERSION();
-	ImGui::CreateContext();
-	ImGuiIO& io = ImGui::GetIO(); (void)io;
-	io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
-	io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+	// only fonts whose file changed are replaced; the atlas texture updates itself
+	ImGui::LoadFonts(user->style);
 
-	// Setup Dear ImGui style
-	ImGui::StyleColorsDark();
-	//ImGui::StyleColorsLight();
+	SwapLoadingIconTheme(user->style.loading_theme);
 
-	// Setup scaling
-	ImGuiStyle& style = ImGui::GetStyle();
-	style.ScaleAllSizes(main_scale);        // Bake a fixed style scale. (until we have a solution for dynamic style scaling, changing this requires resetting Style + calling this again)
-	style.FontScaleDpi = main_scale;        // Set initial font scale. (using io.ConfigDpiScaleFonts=true makes this unnecessary. We leave both here for documentation purpose)
-
-	// Use 13px as base to match ImGui's default font size for consistent spacing
-	float baseFontSize = 13.0f;
-	// Handle ui_scale being 0.0 (default) by using 1.0 as fallback
-	float fontSize = baseFontSize * (user->style.ui_scale > 0.0f ? user->style.ui_scale : 1.0f);
-
-	const std::string base = HVKIO::GetLocalAppData() + "\\PSHVK\\assets\\fonts\\";
-	std::string satoshiRegularPath = base + "satoshi\\Satoshi-Regular.otf";
-	std::string satoshiMediumPath = base + "satoshi\\Satoshi-Medium.otf";
-	std::string satoshiBoldPath = base + "satoshi\\Satoshi-Bold.otf";
-	std::string proggyPath = base + "proggy_clean\\ProggyClean.ttf";
-
-	io.Fonts->Clear();
-	
-	// Load Satoshi Regular font with error handling
-	ImFontConfig satoshiRegularConfig;
-	satoshiRegularConfig.Flags |= ImFontFlags_NoLoadError;
-	user->style.satoshi_regular = io.Fonts->AddFontFromFileTTF(satoshiRegularPath.c_str(), fontSize, &satoshiRegularConfig);
-	if (!user->style.satoshi_regular)
-	{
-		printf("[FONT] Failed to load Satoshi Regular font from: %s\n", satoshiRegularPath.c_str());
-		// Fallback to default font if Satoshi Regular fails to load
-		ImFontConfig defaultConfig;
-		defaultConfig.SizePixels = fontSize;
-		user->style.satoshi_regular = io.Fonts->AddFontDefault(&defaultConfig);
-		printf("[FONT] Using default font as fallback for Satoshi Regular\n");
-	}
-	else
-	{
-		printf("[FONT] Successfully loaded Satoshi Regular font from: %s\n", satoshiRegularPath.c_str());
-	}
-	
-	// Load Satoshi Medium font with error handling
-	ImFontConfig satoshiMediumConfig;
-	satoshiMediumConfig.Flags |= ImFontFlags_NoLoadError;
-	user->style.satoshi_medium = io.Fonts->AddFontFromFileTTF(satoshiMediumPath.c_str(), fontSize, &satoshiMediumConfig);
-	if (!user->style.satoshi_medium)
-	{
-		printf("[FONT] Failed to load Satoshi Medium font from: %s\n", satoshiMediumPath.c_str());
-		// Fallback to Satoshi Regular if Medium fails to load
-		user->style.satoshi_medium = user->style.satoshi_regular;
-		printf("[FONT] Using Satoshi Regular as fallback for Satoshi Medium\n");
-	}
-	else
-	{
-		printf("[FONT] Successfully loaded Satoshi Medium font from: %s\n", satoshiMediumPath.c_str());
-	}
-	
-	// Load Satoshi Bold font with error handling
-	ImFontConfig satoshiBoldConfig;
-	satoshiBoldConfig.Flags |= ImFontFlags_NoLoadError;
-	user->style.satoshi_bold = io.Fonts->AddFontFromFileTTF(satoshiBoldPath.c_str(), fontSize, &satoshiBoldConfig);
-	if (!user->style.satoshi_bold)
-	{
-		printf("[FONT] Failed to load Satoshi Bold font from: %s\n", satoshiBoldPath.c_str());
-		// Fallback to Satoshi Regular if Bold fails to load
-		user->style.satoshi_bold = user->style.satoshi_regular;
-		printf("[FONT] Using Satoshi Regular as fallback for Satoshi Bold\n");
-	}
-	else
-	{
-		printf("[FONT] Successfully loaded Satoshi Bold font from: %s\n", satoshiBoldPath.c_str());
-	}
-	
-	// Load Proggy font with error handling
-	ImFontConfig proggyConfig;
-	proggyConfig.Flags |= ImFontFlags_NoLoadError;
-	user->style.proggy_clean = io.Fonts->AddFontFromFileTTF(proggyPath.c_str(), fontSize, &proggyConfig);
-	if (!user->style.proggy_clean)
-	{
-		printf("[FONT] Failed to load Proggy font from: %s\n", proggyPath.c_str());
-		// Fallback to default font if Proggy fails to load
-		ImFontConfig defaultConfig;
-		defaultConfig.SizePixels = fontSize;
-		user->style.proggy_clean = io.Fonts->AddFontDefault(&defaultConfig);
-		printf("[FONT] Using default font as fallback for Proggy\n");
-	}
+	// clears isLoading once the new background is on the GPU
+	g_BootstrapLoading = false;
+	RequestBackgroundReload(user->render.bg_image_path, settings, user);
+	std::thread(BgReloadWorker).detach();
+}
+
+static void DrawBootstrapProgress(ImDrawList* draw, const ImVec2& display, bool isLight)
+{
+	if (g_Bootstrap.Graph().Finished())
+		return;
+
+	char text[128];
+	DownloadProgress p;
+	if (HVKIO::AssetProgress(p) && p.FilesTotal)
+		snprintf(text, sizeof(text), "Downloading assets  %llu / %llu  (%.1f MB)",
+			(unsigned long long)p.FilesDone, (unsigned long long)p.FilesTotal,
+			p.BytesDone / (1024.0 * 1024.0));
 	else
-	{
-		printf("[FONT] Successfully loaded Proggy font from: %s\n", proggyPath.c_str());
-	}
-	
-	io.Fonts->Build();
+		snprintf(text, sizeof(text), "Preparing assets  %zu / %zu", g_Bootstrap.Graph().Completed(), g_Bootstrap.Graph().Count());
+
+	const ImVec2 size = ImGui::CalcTextSize(text);
+	draw->AddText(
+		ImVec2((display.x - size.x) * 0.5f, display.y - size.y - 32.0f),
+		isLight ? IM_COL32(0, 0, 0, 200) : IM_COL32(255, 255, 255, 200),
+		text);
+}
 
-	// Set satoshi regular as the default font for the menu
-	io.FontDefault = user->style.satoshi_regular;
 
-	// Setup Platform/Renderer backends
-	ImGui_ImplWin32_Init(hwnd);
+// Main code
+int main(int, char**)
+{
+	timeBeginPeriod(1);
 
-	if (g_App.g_RenderBackend == RenderBackend::DX12)
-	{
-		ImGui_ImplDX12_InitInfo init_info = {};
-		init_info.Device = g_pd3dDevice;
-		init_info.CommandQueue = g_pd3dCommandQueue;
-		init_info.NumFramesInFlight = APP_NUM_FRAMES_IN_FLIGHT;
-		init_info.RTVFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
-		init_info.DSVFormat = DXGI_FORMAT_UNKNOWN;
-		init_info.SrvDescriptorHeap = g_pd3dSrvDescHeap;
-		init_info.SrvDescriptorAllocFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu, D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu)
+	// Startup runs as a graph: each step waits only for what it needs, so the
+	// file checks, settings import, USB probe and mode list run on workers while
+	// this thread creates the window, device and ImGui (Main tasks, which the
+	// window's thread has to own). Timeline: startup_trace.json, see ReportFirstFrame.
+	WNDCLASSEXW wc = { sizeof(wc), CS_CLASSDC, WndProc, 0L, 0L, GetModuleHandle(nullptr), nullptr, nullptr, nullptr, nullptr, L"WC_HVK", nullptr };
+	HWND hwnd = nullptr;
+	float main_scale = 1.0f;
+	bool haveAssets = false;
+
+	// The embedded minimal set sits under everything else, so fonts, a background and
+	// the loading animation are there even before (or without) the first download.
+	// Whatever pack the last sync left is mounted up front (cheap when it exists);
+	// syncing and rebuilding happen in the bootstrap
+	const int vfs = g_Startup.Add("asset vfs", [&]()
+		{
+			AssetVfs::SetRoot(HVKIO::GetLocalAppData() + "\\PSHVK\\assets");
+			AssetVfs::MountFallback(AssetPack::OpenMemory(g_EmbeddedAssets_data, g_EmbeddedAssets_size));
+
+			HVKIO::MountPSHVKAssets();
+			haveAssets = AssetVfs::Pack() || std::filesystem::exists(AssetVfs::Root());
+			return true;
+		});
+
+	// Kept in a local until the import below is done with settings: "settings"
+	// is the only task that writes them before the window is up
+	bool isFirstRun = false;
+	const int firstRun = g_Startup.Add("first run", [&]()
+		{
+			isFirstRun = IsFirstRun();
+			return true;
+		});
+
+	// Saved settings: the binary snapshot when it's current, the JSON otherwise
+	const int settingsImport = g_Startup.Add("settings", [&]()
+		{
+			const std::wstring base = HVKIO::GetLocalAppDataW() + L"\\PSHVK\\";
+
+			if (std::filesystem::exists(base + L"settings.hvk"))
+				settings->ImportFromHvk(base + L"settings.hvk");
+			if (std::filesystem::exists(base + L"usersettings.hvk"))
+				user->ImportFromHvk(base + L"usersettings.hvk");
+
+			settings->is_first_run = isFirstRun;
+
+			g_SettingsWatcher.Start(base);
+			return true;
+		}, { firstRun });
+
+	// Reads settings (and CreateInstanceFile writes the uuid), so after the import
+	const int instance = g_Startup.Add("instance", []()
+		{
+			if (settings->is_first_run)
+				HVKIO::CreateInstanceFile();
+
+			return HVKIO::ValidateInstanceFile() || settings->metadata.dev_build;
+		}, { settingsImport });
+
+	const int backendSelect = g_Startup.Add("backend select", []()
+		{
+			g_App.g_RenderBackend = HVKSYS::SupportsDX12() ? RenderBackend::DX12 : RenderBackend::DX11;
+			return true;
+		});
+
+	// Make process DPI aware and obtain main monitor scale, then create application window
+	const int window = g_Startup.Add("window", [&]()
+		{
+			ImGui_ImplWin32_EnableDpiAwareness();
+			main_scale = ImGui_ImplWin32_GetDpiScaleForMonitor(::MonitorFromPoint(POINT{ 0, 0 }, MONITOR_DEFAULTTOPRIMARY));
+
+			::RegisterClassExW(&wc);
+			// hwnd = ::CreateWindowW(wc.lpszClassName, L"PSHVK Window", WS_OVERLAPPEDWINDOW, 100, 100, (int)(1280 * main_scale), (int)(800 * main_scale), nullptr, nullptr, wc.hInstance, nullptr); // Use this to display title bar.
+			hwnd = ::CreateWindowW(wc.lpszClassName, L"PSHVK Window", WS_POPUPWINDOW, 100, 100, (int)(1280 * main_scale), (int)(800 * main_scale), nullptr, nullptr, wc.hInstance, nullptr);
+			return hwnd != nullptr;
+		}, {}, TaskAffinity::Main);
+
+	// Initialize Direct3D: DX12 when supported, DX11 as the fallback
+	const int device = g_Startup.Add("device", [&]()
+		{
+			if (g_App.g_RenderBackend == RenderBackend::DX12)
 			{
-				return g_pd3dSrvDescHeapAlloc.Alloc(out_cpu, out_gpu);
-			};
-		init_info.SrvDescriptorFreeFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE cpu, D3D12_GPU_DESCRIPTOR_HANDLE gpu)
+				if (HVKSYS::InitDX12(hwnd))
+					return true;
+				g_App.g_RenderBackend = RenderBackend::DX11;
+			}
+
+			return HVKSYS::InitDX11(hwnd);
+		}, { window, backendSelect }, TaskAffinity::Main);
+
+	// Show the window (never for an instance that failed validation)
+	g_Startup.Add("show window", [&]()
+		{
+			::ShowWindow(hwnd, SW_SHOWMAXIMIZED);
+			::UpdateWindow(hwnd);
+			return true;
+		}, { device, instance }, TaskAffinity::Main);
+
+	// Setup Dear ImGui context
+	const int imgui = g_Startup.Add("imgui", [&]()
+		{
+			user->style.dpi_scale = main_scale;    // set once at startup (after the import, which would overwrite it)
+			++user->style.generation;
+
+			IMGUI_CHECKVERSION();
+			ImGui::CreateContext();
+			ImGuiIO& io = ImGui::GetIO(); (void)io;
+			io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
+			io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+
+			// Setup Dear ImGui style
+			ImGui::StyleColorsDark();
+			//ImGui::StyleColorsLight();
+
+			// Setup scaling
+			ImGuiStyle& style = ImGui::GetStyle();
+			style.ScaleAllSizes(main_scale);        // Bake a fixed style scale. (until we have a solution for dynamic style scaling, changing this requires resetting Style + calling this again)
+			style.FontScaleDpi = main_scale;        // Set initial font scale. (using io.ConfigDpiScaleFonts=true makes this unnecessary. We leave both here for documentation purpose)
+			return true;
+		}, { window, settingsImport }, TaskAffinity::Main);
+
+	// Glyphs rasterized on earlier runs; a missing or stale file just means they get rasterized again
+	const int fontCache = g_Startup.Add("font cache", []()
+		{
+			HvkFontCache::Load(HVKIO::GetLocalAppDataW() + L"\\PSHVK\\fontcache.bin");
+			return true;
+		});
+
+	const int fonts = g_Startup.Add("fonts", []()
+		{
+			// loaded once at the base size, UpdateStyle scales them through style.FontScaleMain
+			HvkFontCache::Install(ImGui::GetIO().Fonts);
+			ImGui::LoadFonts(user->style);
+			return true;
+		}, { imgui, vfs, fontCache }, TaskAffinity::Main);
+
+	// First run: the embedded set is all there is, keep the loading screen up until the download lands.
+	// After the instance check, so an instance that fails it exits without downloading anything
+	g_Startup.Add("bootstrap", [&]()
+		{
+			if (!haveAssets)
 			{
-				return g_pd3dSrvDescHeapAlloc.Free(cpu, gpu);
-			};
-		ImGui_ImplDX12_Init(&init_info);
-	}
-	else
-	{
-		ImGui_ImplDX11_Init(g_pd3dDevice11, g_pd3dDeviceContext11);
-	}
+				g_BootstrapLoading = true;
+				settings->isLoading = true;
+			}
+			StartBootstrap();
+			return true;
+		}, { vfs, instance });
 
+	// Setup Platform/Renderer backends
+	g_Startup.Add("imgui backend", [&]()
+		{
+			ImGui_ImplWin32_Init(hwnd);
+
+			if (g_App.g_RenderBackend == RenderBackend::DX12)
+			{
+				ImGui_ImplDX12_InitInfo init_info = {};
+				init_info.Device = g_pd3dDevice;
+				init_info.CommandQueue = g_pd3dCommandQueue;
+				init_info.NumFramesInFlight = APP_NUM_FRAMES_IN_FLIGHT;
+				init_info.RTVFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
+				init_info.DSVFormat = DXGI_FORMAT_UNKNOWN;
+				init_info.SrvDescriptorHeap = g_pd3dSrvDescHeap;
+				init_info.SrvDescriptorAllocFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE* out_cpu, D3D12_GPU_DESCRIPTOR_HANDLE* out_gpu)
+					{
+						return g_pd3dSrvDescHeapAlloc.Alloc(out_cpu, out_gpu);
+					};
+				init_info.SrvDescriptorFreeFn = [](ImGui_ImplDX12_InitInfo*, D3D12_CPU_DESCRIPTOR_HANDLE cpu, D3D12_GPU_DESCRIPTOR_HANDLE gpu)
+					{
+						return g_pd3dSrvDescHeapAlloc.Free(cpu, gpu);
+					};
+				ImGui_ImplDX12_Init(&init_info);
+			}
+			else
+			{
+				ImGui_ImplDX11_Init(g_pd3dDevice11, g_pd3dDeviceContext11);
+			}
+			HvkSdfText::SetRendererSupport(true);
+			return true;
+		}, { device, fonts }, TaskAffinity::Main);
 
 // ----------------------------------------
 // Load textures once (NOT every frame)
 // ----------------------------------------
-	texThread = std::thread([]()
+	g_Startup.Add("texture thread", []()
 		{
-			// COM init is PER THREAD (WIC needs this)
-			HRESULT comHr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+			texThread = std::thread([]()
+				{
+					// COM init is PER THREAD (WIC needs this)
+					HRESULT comHr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
 
-			static const std::wstring base =
-				HVKIO::GetLocalAppDataW() + L"\\PSHVK\\assets\\LoadingIcon\\";
+					static const std::wstring base =
+						HVKIO::GetLocalAppDataW() + L"\\PSHVK\\assets\\LoadingIcon\\";
 
-			if (g_App.g_RenderBackend == RenderBackend::DX11)
-			{
-				std::vector<HVKTexture> local;
-				local.reserve(31);
+					if (g_App.g_RenderBackend == RenderBackend::DX11)
+					{
+						std::vector<HVKTexture> local;
+						local.reserve(31);
 
-				for (int i = 1; i <= 31; ++i)
-				{
-					if (g_texStop.load())
-						break;
+						for (int i = 1; i <= 31; ++i)
+						{
+							if (g_texStop.load())
+								break;
 
-					wchar_t buf[64];
-					swprintf_s(buf, L"%04d.png", i);
-					std::wstring fullPath = base + buf;
+							wchar_t buf[64];
+							swprintf_s(buf, L"%04d.png", i);
+							std::wstring fullPath = base + buf;
 
-					HVKTexture tex{};
-					if (LoadTextureUnified(fullPath.c_str(), tex))
-						local.push_back(std::move(tex));
-				}
+							HVKTexture tex{};
+							if (LoadTextureUnified(fullPath.c_str(), tex))
+								local.push_back(std::move(tex));
+						}
 
-				HVKTexture bgLocal{};
-				LoadTextureUnified(user->render.bg_image_path.c_str(), bgLocal);
+						HVKTexture bgLocal{};
+						LoadTextureUnified(user->render.bg_image_path.c_str(), bgLocal);
 
-				{
-					std::lock_guard<std::mutex> lock(g_texMutex);
-					g_LoadingFrames = std::move(local);
-					BgTexture = bgLocal.id;
-				}
+						{
+							std::lock_guard<std::mutex> lock(g_texMutex);
+							g_LoadingFrames = std::move(local);
+							BgTexture = bgLocal.id;
+						}
 
-				// Only mark ready if we actually have something useful
-				g_texturesReady.store(BgTexture != (ImTextureID)nullptr || !g_LoadingFrames.empty());
+						// Only mark ready if we actually have something useful
+						g_texturesReady.store(BgTexture != (ImTextureID)nullptr || !g_LoadingFrames.empty());
 
-				if (SUCCEEDED(comHr))
-					CoUninitialize();
+						if (SUCCEEDED(comHr))
+							CoUninitialize();
 
-				return;
-			}
+						return;
+					}
 
-			// DX12: DO NOT create/upload textures here. Load bytes only.
-			std::vector<PendingFrame> local;
-			local.reserve(31);
+					// DX12: DO NOT create/upload textures here. Load bytes only.
+					std::vector<PendingFrame> local;
+					local.reserve(31);
 
-			for (int i = 1; i <= 31; ++i)
-			{
-				if (g_texStop.load())
-					return;
+					for (int i = 1; i <= 31; ++i)
+					{
+						if (g_texStop.load())
+							return;
 
-				wchar_t buf[64];
-				swprintf_s(buf, L"%04d.png", i);
+						wchar_t buf[64];
+						swprintf_s(buf, L"%04d.png", i);
 
-				std::string path = WStringToUtf8(base + buf);
+						PendingFrame p;
+						if (!AssetVfs::Read(base + buf, p.bytes))
+							continue;
 
-				FILE* f = fopen(path.c_str(), "rb");
-				if (!f)
-					continue;
+						local.push_back(std::move(p));
+					}
 
-				fseek(f, 0, SEEK_END);
-				size_t sz = (size_t)ftell(f);
-				fseek(f, 0, SEEK_SET);
+					//LoadTextureUnified(user->render.bg_image_path.c_str(), bg);
 
-				PendingFrame p;
-				p.bytes.resize(sz);
-				fread(p.bytes.data(), 1, sz, f);
-				fclose(f);
+					{
+						std::lock_guard<std::mutex> lock(g_texMutex);
+						g_pendingFrames = std::move(local);
+					}
+
+					/*{
+						std::lock_guard<std::mutex> lock(g_texMutex);
+						BgTexture = bg.id;
+					}*/
+				});
+			return true;
+		}, { device, vfs, settingsImport });
+
+	g_Startup.Add("display modes", []()
+		{
+			if (g_ResUI.All.empty())
+			{
+				g_ResUI.All = Display::EnumerateResolutions();
+				g_ResUI.Filtered =
+					Display::UniqueResolutions(
+						Display::FilterByAspect(
+							g_ResUI.All,
+							g_ResUI.AspectIndex));
 
-				local.push_back(std::move(p));
 			}
+			return true;
+		});
 
-			//LoadTextureUnified(user->render.bg_image_path.c_str(), bg);
+	// Runs on a worker; USBHelper locks the registry against WM_DEVICECHANGE and the UI
+	g_Startup.Add("usb probe", []()
+		{
+			// One enumeration fills the USB registry; WM_DEVICECHANGE keeps it current
+			USBHelper::RefreshRegistry();
+
+			UsbSignature trustedUsb{};
+			bool trustedFound = USBHelper::GetInfoByDriveLetter('E', trustedUsb);
 
+			// Trust list lives next to the instance file; first run trusts the stick on E:
+			const std::filesystem::path trustPath = HVKIO::GetLocalAppDataW() + L"\\PSHVK\\usb_trust.txt";
+			std::lock_guard<std::recursive_mutex> lock(USBHelper::Mutex());
+			UsbTrustList& trust = USBHelper::TrustList();
+			if (!trust.Load(trustPath) && trustedFound)
 			{
-				std::lock_guard<std::mutex> lock(g_texMutex);
-				g_pendingFrames = std::move(local);
+				trust.AddDevice(trustedUsb, UsbTrust::Allowed);
+				trust.Save(trustPath);
 			}
 
-			/*{
-				std::lock_guard<std::mutex> lock(g_texMutex);
-				BgTexture = bg.id;
-			}*/
+			// debug log only: device identity doesn't belong on every startup's stdout
+			try
+			{
+				if (trustedFound)
+					DebugLog("[USB] E: VID=%s PID=%s FP=%s (%s)",
+						trustedUsb.vid.c_str(), trustedUsb.pid.c_str(),
+						UsbTrustList::Fingerprint(trustedUsb).Hex().c_str(),
+						trust.Check(trustedUsb) == UsbTrust::Allowed ? "trusted" : "not trusted");
+				else
+					DebugLog("[USB] no device on E:");
+			}
+			catch (const std::exception& e)
+			{
+				DebugLog("[USB] probe failed: %s", e.what());
+			}
+			return true;
 		});
 
+	g_Startup.Run(4);
+	DebugLog("[STARTUP] init graph:\n%s", g_Startup.Summary().c_str());
 
+	if (g_Startup.State(instance) != TaskState::Done)
+	{
+		MessageBoxA(nullptr, "Instance file invalid.", "PSHVK", MB_ICONERROR);
+		ExitProcess(0);
+	}
+
+	if (g_Startup.State(device) != TaskState::Done)
+	{
+		MessageBoxA(
+			nullptr,
+			"Failed to initialize a D3D11/D3D12 renderer on this system.",
+			"Fatal Error",
+			MB_ICONERROR
+		);
+
+		StopBootstrap();
+		HVKSYS::CleanupDeviceD3D11();
+		CleanupDeviceD3D();
+		::UnregisterClassW(wc.lpszClassName, wc.hInstance);
+		return 1;
+	}
+
+	ImGuiIO& io = ImGui::GetIO();
+	ImGuiStyle& style = ImGui::GetStyle();
 
 	// Our state
 	bool show_demo_window = true;
@@ -1820,52 +2036,11 @@ int main(int, char**)
 	ImVec2 default_btn_size = ImVec2(7, 4);
 	static auto last_wm_update = std::chrono::high_resolution_clock::now();
 
-	if (g_ResUI.All.empty())
-	{
-		g_ResUI.All = Display::EnumerateResolutions();
-		g_ResUI.Filtered =
-			Display::UniqueResolutions(
-				Display::FilterByAspect(
-					g_ResUI.All,
-					g_ResUI.AspectIndex));
-
-	}
-
-
 	int base_x = GetSystemMetrics(SM_CXSCREEN);
 	int base_y = GetSystemMetrics(SM_CYSCREEN);
 
 	printf("Base Resolution: %d x %d\n\n\n", base_x, base_y);
 
-	UsbSignature trustedUsb{};
-	USBHelper:: GetInfoByDriveLetter('E', trustedUsb);
-
-	std::string trustedKey = USBHelper::BuildCompositeKey(trustedUsb);
-
-	try
-	{
-		UsbSignature sig{};
-
-		bool ok = USBHelper::GetInfoByDriveLetter('E', sig);
-
-		printf("GetInfoByDriveLetter returned: %s\n", ok ? "true" : "false");
-
-		std::cout
-			<< "VID=" << sig.vid << "\n"
-			<< "PID=" << sig.pid << "\n"
-			<< "SER=" << sig.serial << "\n"
-			<< "MFG=" << sig.manufacturer << "\n"
-			<< "PROD=" << sig.product << "\n"
-			<< "RIDH=" << sig.reportedIdHash << "\n\n";
-
-	}
-	catch(std::exception e)
-	{
-		//printf("An error occured whilst trying to fetch USB signature: %s", e.what());
-		printf("An error occured. ");
-		std::cout << e.what() << std::endl;
-	}
-
         // Main loop
         bool done = false;
         uint64_t frameCounter = 0;
@@ -1900,6 +2075,8 @@ int main(int, char**)
 
 		if (g_App.NeedsRefresh)
 			RefreshDisks();
+		else if (g_App.RescanDisk >= 0)
+			RescanDisk(g_App.RescanDisk);
 
 		static int lastPhysicalIndex = -1;
 
@@ -1922,26 +2099,10 @@ int main(int, char**)
                 FinalizeBgUploadIfReady();
 
                 DebugLog("Frame %llu: before ImGui::UpdateStyle", (unsigned long long)frameIndex);
-                bool fonts_rebuilt = ImGui::UpdateStyle(*user, style);
+                ImGui::UpdateStyle(user->style, style);
                 DebugLog("Frame %llu: after ImGui::UpdateStyle", (unsigned long long)frameIndex);
-                if (fonts_rebuilt)
-                {
-                        DebugLog("Frame %llu: fonts rebuilt, recreating backend font texture", (unsigned long long)frameIndex);
-                        if (g_App.g_RenderBackend == RenderBackend::DX12)
-                        {
-                                // Ensure the GPU is idle before destroying/creating font resources
-                                // to avoid referencing released descriptors/texture in flight.
-                                WaitForPendingOperations();
-                                ImGui_ImplDX12_InvalidateDeviceObjects();
-                                ImGui_ImplDX12_CreateDeviceObjects();
-                        }
-                        else
-                        {
-                                ImGui_ImplDX11_InvalidateDeviceObjects();
-                                ImGui_ImplDX11_CreateDeviceObjects();
-                        }
-                }
-                // PollSettingsHotReload();
+                PollBootstrap();
+                PollSettingsHotReload();
 
                 DebugLog("Frame %llu: after PollSettingsHotReload", (unsigned long long)frameIndex);
 
@@ -2288,10 +2449,12 @@ int main(int, char**)
                                         }
                                         case 3:
                                         {
+						bool edited = false;
+
 						ImGui::Text("Themes");
 						ImGui::Spacing();
-						ImGui::ModernStyle::ModernCombo("Loading Theme", &settings->themecombos.LoadingThemeIdx, "Dark\0Light\0");
-						ImGui::ModernStyle::ModernCombo("Background Theme", &settings->themecombos.BgThemeIdx, "Black\0Purple\0Yellow\0Blue\0Green\0Red\0");
+						edited |= ImGui::ModernStyle::ModernCombo("Loading Theme", &settings->themecombos.LoadingThemeIdx, "Dark\0Light\0");
+						edited |= ImGui::ModernStyle::ModernCombo("Background Theme", &settings->themecombos.BgThemeIdx, "Black\0Purple\0Yellow\0Blue\0Green\0Red\0");
 
 						ImGui::Spacing(12.0f);
 						ImGui::Separator();
@@ -2299,9 +2462,9 @@ int main(int, char**)
 
 						ImGui::Text("Main Window");
 						ImGui::Spacing();
-						ImGui::ModernStyle::ModernColorEdit3("Background Color##MainWin", (float*)&user->style.main_bg_color);
-						ImGui::ModernStyle::ModernColorEdit3("Text Color##MainWin", (float*)&user->style.main_text_color);
-						ImGui::ModernStyle::ModernSliderFloat("Opacity##MainWin", &user->style.main_opacity, 0.0f, 1.0f, "%.2f");
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Background Color##MainWin", (float*)&user->style.main_bg_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Text Color##MainWin", (float*)&user->style.main_text_color);
+						edited |= ImGui::ModernStyle::ModernSliderFloat("Opacity##MainWin", &user->style.main_opacity, 0.0f, 1.0f, "%.2f");
 
 						ImGui::Spacing(12.0f);
 						ImGui::Separator();
@@ -2309,9 +2472,9 @@ int main(int, char**)
 
 						ImGui::Text("Watermark");
 						ImGui::Spacing();
-						ImGui::ModernStyle::ModernColorEdit3("Background Color##Watermark", (float*)&user->style.wm_bg_color);
-						ImGui::ModernStyle::ModernColorEdit3("Text Color##Watermark", (float*)&user->style.wm_text_color);
-                                                ImGui::ModernStyle::ModernSliderFloat("Opacity##Watermark", &user->style.wm_opacity, 0.0f, 1.0f, "%.2f");
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Background Color##Watermark", (float*)&user->style.wm_bg_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Text Color##Watermark", (float*)&user->style.wm_text_color);
+                                                edited |= ImGui::ModernStyle::ModernSliderFloat("Opacity##Watermark", &user->style.wm_opacity, 0.0f, 1.0f, "%.2f");
 
                                                 ImGui::Spacing(12.0f);
 						ImGui::Separator();
@@ -2319,9 +2482,9 @@ int main(int, char**)
 
 						ImGui::Text("TabBar");
 						ImGui::Spacing();
-						ImGui::ModernStyle::ModernColorEdit3("Tab Text Color##TabBar", (float*)&user->style.tabbar_text_color);
-						ImGui::ModernStyle::ModernColorEdit3("Selected Tab Text Color##TabBar", (float*)&user->style.tabbar_selected_color);
-						ImGui::ModernStyle::ModernSliderFloat("Inactive Tab Text Opacity##TabBar", &user->style.tabbar_inactive_opacity, 0.0f, 1.0f, "%.2f");
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Tab Text Color##TabBar", (float*)&user->style.tabbar_text_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Selected Tab Text Color##TabBar", (float*)&user->style.tabbar_selected_color);
+						edited |= ImGui::ModernStyle::ModernSliderFloat("Inactive Tab Text Opacity##TabBar", &user->style.tabbar_inactive_opacity, 0.0f, 1.0f, "%.2f");
 
 						ImGui::Spacing(12.0f);
 						ImGui::Separator();
@@ -2329,16 +2492,26 @@ int main(int, char**)
 
 						ImGui::Text("Button Colors");
 						ImGui::Spacing();
-						ImGui::ModernStyle::ModernColorEdit3("Button Color##Button", (float*)&user->style.button_color);
-						ImGui::ModernStyle::ModernColorEdit3("Button Text Color##Button", (float*)&user->style.button_text_color);
-						ImGui::ModernStyle::ModernColorEdit3("Button Hover Color##Button", (float*)&user->style.button_hover_color);
-						ImGui::ModernStyle::ModernColorEdit3("Button Hover Text Color##Button", (float*)&user->style.button_hover_text_color);
-						ImGui::ModernStyle::ModernColorEdit3("Button Active Color##Button", (float*)&user->style.button_active_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Button Color##Button", (float*)&user->style.button_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Button Text Color##Button", (float*)&user->style.button_text_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Button Hover Color##Button", (float*)&user->style.button_hover_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Button Hover Text Color##Button", (float*)&user->style.button_hover_text_color);
+						edited |= ImGui::ModernStyle::ModernColorEdit3("Button Active Color##Button", (float*)&user->style.button_active_color);
 
 						ImGui::Spacing(12.0f);
 						ImGui::Separator();
 						ImGui::Spacing(12.0f);
 
+						// autosave; drags request every frame and the writer coalesces them
+						if (edited)
+						{
+							++user->style.generation;
+
+							std::wstring base = HVKIO::GetLocalAppDataW() + L"\\PSHVK\\";
+							settings->ExportToHvk(base + L"settings.hvk");
+							user->ExportToHvk(base + L"usersettings.hvk");
+						}
+
 						// ImGui::ModernStyle::ModernSliderFloat("Main Scale", &user->style.ui_scale, 1, 100, "%.0f"); // BROKEN: Changing value crashes application currently.
 
 					break;
@@ -2401,6 +2574,12 @@ int main(int, char**)
 					ImGui::EndGroup();
 
 					ImGui::Text(settings->is_first_run ? "First Run: Yes" : "First Run: No");
+					{
+						WriteBehindStats ws = WriteBehind::Stats();
+						ImGui::Text("Settings saves: %llu (%llu coalesced, %llu failed)  last %.1f ms  avg %.1f ms  max %.1f ms",
+							(unsigned long long)ws.Writes, (unsigned long long)ws.Coalesced, (unsigned long long)ws.Failures,
+							ws.LastLatencyMs, ws.AvgLatencyMs, ws.MaxLatencyMs);
+					}
 					ImGui::Text(HVKSYS::SupportsDX12() ? "Device Supports DX12: Yes" : "Device Supports DX12: No");
 					ImGui::Text(g_App.g_RenderBackend == RenderBackend::DX12 ? "Rendering Engine Used: DX12" : "Rendering Engine Used: DX11");
 					if (g_App.g_RenderBackend == RenderBackend::DX11)
@@ -2474,6 +2653,7 @@ int main(int, char**)
                                 ImVec2(io.DisplaySize.x, io.DisplaySize.y),
                                 isLight ? IM_COL32(255, 255, 255, 255) : IM_COL32(0, 0, 0, 255)
                         );
+                        DrawBootstrapProgress(bg, io.DisplaySize, isLight);
                         DebugLog("Frame %llu: drew loading screen background", (unsigned long long)frameIndex);
 
 
@@ -2569,10 +2749,15 @@ int main(int, char**)
                         DebugLog("Frame %llu: DX11 Present completed", (unsigned long long)frameIndex);
                 }
 
+		ReportFirstFrame();
+
 		if (!settings->vsync)
 			g_fpsLimiter.Limit();
 	}
 
+	// an in-flight listing request can hold this up to its timeout
+	StopBootstrap();
+
 	if (g_App.g_RenderBackend == RenderBackend::DX12)
 		WaitForPendingOperations();
 
@@ -2580,6 +2765,17 @@ int main(int, char**)
 	if (texThread.joinable())
 		texThread.join();
 
+	// don't leave diskpart running detached from the UI
+	ProcessRunner::CancelAll();
+	if (g_App.SyncJob)
+	{
+		// stops between blocks; the signature cache is written on the way out
+		g_App.SyncJob->Cancel();
+		g_App.SyncJob->WaitFor(2000);
+	}
+	g_SettingsWatcher.Stop();
+	WriteBehind::Shutdown(); // writes anything still queued
+
 	Display::RestoreResolution();
 
 	// Realease Textures 
@@ -2600,12 +2796,15 @@ int main(int, char**)
         }
 
 
+	HvkFontCache::Save();
+
 	// Cleanup
 	if (g_App.g_RenderBackend == RenderBackend::DX12)
 		ImGui_ImplDX12_Shutdown();
 	else
 		ImGui_ImplDX11_Shutdown();
 
+	HvkGlowCache::Shutdown();
 	ImGui_ImplWin32_Shutdown();
 	ImGui::DestroyContext();
 
@@ -3032,6 +3231,20 @@ LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 		if ((wParam & 0xfff0) == SC_KEYMENU) // Disable ALT application menu
 			return 0;
 		break;
+	case WM_DEVICECHANGE:
+		if (wParam == DBT_DEVICEARRIVAL || wParam == DBT_DEVICEREMOVECOMPLETE)
+		{
+			auto* hdr = (DEV_BROADCAST_HDR*)lParam;
+			if (hdr && hdr->dbch_devicetype == DBT_DEVTYP_VOLUME)
+			{
+				auto* vol = (DEV_BROADCAST_VOLUME*)hdr;
+				if (wParam == DBT_DEVICEARRIVAL)
+					USBHelper::OnVolumeArrival(vol->dbcv_unitmask);
+				else
+					USBHelper::OnVolumeRemoval(vol->dbcv_unitmask);
+			}
+		}
+		break;
 	case WM_DESTROY:
 		::PostQuitMessage(0);
 		return 0;
@@ -1,328 +1,116 @@
 #include "settings.h"
-#include <sstream>
+#include "util/hash.h"
+#include "util/hvk_schema.h"
+#include "util/hvk_snapshot.h"
+#include "util/write_behind.h"
+#include "util/instance_sig.h"
 
-struct HvkJsonWriter
-{
-	std::ostringstream ss;
-	int indent = 0;
+// ------------------------------------------------------------
+// Schemas
+// ------------------------------------------------------------
 
-	void Indent()
-	{
-		for (int i = 0; i < indent; ++i)
-			ss << '\t';
-	}
-
-	void BeginObject()
-	{
-		ss << "{\n";
-		indent++;
-	}
-
-	void EndObject(bool comma = false)
-	{
-		ss << "\n";
-		indent--;
-		Indent();
-		ss << "}";
-		if (comma) ss << ",";
-		ss << "\n";
-	}
-
-	void Key(const char* key)
-	{
-		Indent();
-		ss << "\"" << key << "\": ";
-	}
-
-	void String(const std::string& v, bool comma = true)
-	{
-		ss << "\"";
-		for (char c : v)
-		{
-			switch (c)
-			{
-			case '\\': ss << "\\\\"; break;
-			case '"':  ss << "\\\""; break;
-			case '\n': ss << "\\n";  break;
-			case '\r': ss << "\\r";  break;
-			case '\t': ss << "\\t";  break;
-			default:
-				ss << c;
-				break;
-			}
-		}
-		ss << "\"";
-		if (comma) ss << ",";
-		ss << "\n";
-	}
+using UserRender = decltype(c_usersettings::render);
+using UserBinds = decltype(c_usersettings::binds);
 
-
-	void WString(const std::wstring& v, bool comma = true)
-	{
-		String(std::string(v.begin(), v.end()), comma);
-	}
-
-	void Bool(bool v, bool comma = true)
-	{
-		ss << (v ? "true" : "false");
-		if (comma) ss << ",";
-		ss << "\n";
-	}
-
-	template<typename T>
-	void Number(T v, bool comma = true)
-	{
-		ss << v;
-		if (comma) ss << ",";
-		ss << "\n";
-	}
+static constexpr HvkField kUserRender[] =
+{
+	HVK_FIELD(UserRender, wm_render_interval),
+	HVK_FIELD(UserRender, target_fps),
+	HVK_FIELD(UserRender, bg_image_path),
 };
 
-static void WriteImVec4(HvkJsonWriter& w, const ImVec4& v, bool comma = true)
+static constexpr HvkField kUserBinds[] =
 {
-	w.ss << "[ "
-		<< v.x << ", "
-		<< v.y << ", "
-		<< v.z << ", "
-		<< v.w << " ]";
-	if (comma) w.ss << ",";
-	w.ss << "\n";
-}
+	HVK_FIELD(UserBinds, toggle_main),
+	HVK_FIELD(UserBinds, toggle_dev),
+	HVK_FIELD(UserBinds, shutdown),
+};
 
-void c_usersettings::ExportToHvk(const std::wstring path)
+static constexpr HvkField kUserStyle[] =
 {
-	std::wstring dir = HVKIO::GetLocalAppDataW() + L"\\PSHVK";
-	HVKIO::EnsureDirectory(dir);
-
-	HvkJsonWriter w;
-	w.BeginObject();
-
-	// render
-	w.Key("render");
-	w.BeginObject();
-
-	w.Key("wm_render_interval");
-	w.Number(user->render.wm_render_interval);
-
-	w.Key("target_fps");
-	w.Number(user->render.target_fps);
-
-	w.Key("bg_image_path");
-	w.WString(user->render.bg_image_path, false);
-
-	w.EndObject(true);
-
-	// binds
-	w.Key("binds");
-	w.BeginObject();
-
-	w.Key("toggle_main");
-	w.Number(user->binds.toggle_main);
-
-	w.Key("toggle_dev");
-	w.Number(user->binds.toggle_dev);
-
-	w.Key("shutdown");
-	w.Number(user->binds.shutdown, false);
-
-	w.EndObject(true);
-
-	// style
-	w.Key("style");
-	w.BeginObject();
-
-	w.Key("wm_bg_color");
-	WriteImVec4(w, user->style.wm_bg_color);
-
-	w.Key("wm_text_color");
-	WriteImVec4(w, user->style.wm_text_color);
-
-	w.Key("wm_opacity");
-	w.Number(user->style.wm_opacity);
-
-	w.Key("main_bg_color");
-	WriteImVec4(w, user->style.main_bg_color);
-
-	w.Key("main_text_color");
-	WriteImVec4(w, user->style.main_text_color);
-
-	w.Key("main_border_color");
-	WriteImVec4(w, user->style.main_border_color);
-
-	w.Key("main_opacity");
-	w.Number(user->style.main_opacity);
-
-	w.Key("tabbar_text_color");
-	WriteImVec4(w, user->style.tabbar_text_color);
-
-	w.Key("tabbar_selected_color");
-	WriteImVec4(w, user->style.tabbar_selected_color);
-
-	w.Key("tabbar_inactive_opacity");
-	w.Number(user->style.tabbar_inactive_opacity);
-
-	w.Key("button_color");
-	WriteImVec4(w, user->style.button_color);
-
-	w.Key("button_text_color");
-	WriteImVec4(w, user->style.button_text_color);
-
-	w.Key("button_hover_color");
-	WriteImVec4(w, user->style.button_hover_color);
-
-	w.Key("button_hover_text_color");
-	WriteImVec4(w, user->style.button_hover_text_color);
-
-	w.Key("button_active_color");
-	WriteImVec4(w, user->style.button_active_color);
-
-	w.Key("loading_theme");
-	w.Number((int)user->style.loading_theme);
-
-	w.Key("bg_theme");
-	w.Number((int)user->style.bg_theme);
-
-	w.Key("main_secondary_color");
-	WriteImVec4(w, user->style.main_secondary_color, false); // <-- last item
-
-	w.EndObject(false);
-	w.EndObject();
-
-	std::string out = w.ss.str();
-
-	HANDLE hFile = CreateFileW(
-		path.c_str(),
-		GENERIC_WRITE,
-		FILE_SHARE_READ,
-		nullptr,
-		CREATE_ALWAYS,
-		FILE_ATTRIBUTE_NORMAL,
-		nullptr
-	);
-
-	if (hFile == INVALID_HANDLE_VALUE)
-		return;
-
-	DWORD written;
-	WriteFile(hFile, out.data(), (DWORD)out.size(), &written, nullptr);
-	CloseHandle(hFile);
-}
-
+	HVK_FIELD(UserStyle, wm_bg_color),
+	HVK_FIELD(UserStyle, wm_text_color),
+	HVK_FIELD(UserStyle, wm_opacity),
+	HVK_FIELD(UserStyle, main_bg_color),
+	HVK_FIELD(UserStyle, main_text_color),
+	HVK_FIELD(UserStyle, main_border_color),
+	HVK_FIELD(UserStyle, main_opacity),
+	HVK_FIELD(UserStyle, tabbar_text_color),
+	HVK_FIELD(UserStyle, tabbar_selected_color),
+	HVK_FIELD(UserStyle, tabbar_inactive_opacity),
+	HVK_FIELD(UserStyle, button_color),
+	HVK_FIELD(UserStyle, button_text_color),
+	HVK_FIELD(UserStyle, button_hover_color),
+	HVK_FIELD(UserStyle, button_hover_text_color),
+	HVK_FIELD(UserStyle, button_active_color),
+	HVK_FIELD(UserStyle, loading_theme),
+	HVK_FIELD(UserStyle, bg_theme),
+	HVK_FIELD(UserStyle, main_secondary_color),
+};
 
-void c_settings::ExportToHvk(const std::wstring path)
+static constexpr HvkField kUserSettings[] =
 {
-	std::wstring dir = HVKIO::GetLocalAppDataW() + L"\\PSHVK";
-	HVKIO::EnsureDirectory(dir);
-
-	HvkJsonWriter w;
-	w.BeginObject();
-
-	w.Key("is_first_run");
-	w.Bool(settings->is_first_run);
-
-	w.Key("g_MainTab");
-	w.Number(settings->g_MainTab);
-
-	w.Key("vsync");
-	w.Bool(settings->vsync);
-
-	w.Key("isLoading");
-	w.Bool(settings->isLoading);
-
-	// visibility
-	w.Key("visibility");
-	w.BeginObject();
-
-	w.Key("win_main");
-	w.Bool(settings->visibility.win_main);
-
-	w.Key("win_dev");
-	w.Bool(settings->visibility.win_dev);
-
-	w.Key("win_selector");
-	w.Bool(settings->visibility.win_selector);
-
-	w.Key("disk_info");
-	w.Bool(settings->visibility.disk_info);
-
-	w.Key("part_info");
-	w.Bool(settings->visibility.part_info);
-
-	w.Key("disk_and_part_info");
-	w.Bool(settings->visibility.disk_and_part_info, false);
-
-	w.EndObject(true);
-
-	// format ui
-	w.Key("format_ui");
-	w.BeginObject();
-
-	auto& ui = settings->fmtui.g_FormatUI;
-
-	w.Key("SelectedDisk");
-	w.Number(ui.SelectedDisk);
-
-	w.Key("SelectedPartition");
-	w.Number(ui.SelectedPartition);
-
-	w.Key("VolumeLabel");
-	w.String(ui.VolumeLabel);
-
-	w.Key("FileSystem");
-	w.Number(ui.FileSystem);
-
-	w.Key("QuickFormat");
-	w.Bool(ui.QuickFormat);
-
-	w.Key("ConfirmPopup");
-	w.Bool(ui.ConfirmPopup);
-
-	w.Key("ConfirmRecreate");
-	w.Bool(ui.ConfirmRecreate);
-
-	w.Key("ConfirmCreatePartition");
-	w.Bool(ui.ConfirmCreatePartition);
-
-	w.Key("ConfirmDeletePartition");
-	w.Bool(ui.ConfirmDeletePartition);
-
-	w.Key("RenameLabel");
-	w.String(ui.RenameLabel, false);
-
-	w.EndObject(true);
+	HVK_OBJECT(c_usersettings, render, "render", kUserRender),
+	HVK_OBJECT(c_usersettings, binds, "binds", kUserBinds),
+	HVK_OBJECT(c_usersettings, style, "style", kUserStyle),
+};
 
-	// theme combos
-	w.Key("themecombos");
-	w.BeginObject();
+using SettingsVisibility = decltype(c_settings::visibility);
+using SettingsThemeCombos = decltype(c_settings::themecombos);
 
-	w.Key("LoadingThemeIdx");
-	w.Number(settings->themecombos.LoadingThemeIdx);
+static constexpr HvkField kVisibility[] =
+{
+	HVK_FIELD(SettingsVisibility, win_main),
+	HVK_FIELD(SettingsVisibility, win_dev),
+	HVK_FIELD(SettingsVisibility, win_selector),
+	HVK_FIELD(SettingsVisibility, disk_info),
+	HVK_FIELD(SettingsVisibility, part_info),
+	HVK_FIELD(SettingsVisibility, disk_and_part_info),
+};
 
-	w.Key("BgThemeIdx");
-	w.Number(settings->themecombos.BgThemeIdx, false);
+static constexpr HvkField kFormatUI[] =
+{
+	HVK_FIELD(FormatUIState, SelectedDisk),
+	HVK_FIELD(FormatUIState, SelectedPartition),
+	HVK_FIELD(FormatUIState, VolumeLabel),
+	HVK_FIELD(FormatUIState, FileSystem),
+	HVK_FIELD(FormatUIState, QuickFormat),
+	HVK_FIELD(FormatUIState, RenameLabel),
+};
 
-	w.EndObject(false);
-	w.EndObject();
+static constexpr HvkField kThemeCombos[] =
+{
+	HVK_FIELD(SettingsThemeCombos, LoadingThemeIdx),
+	HVK_FIELD(SettingsThemeCombos, BgThemeIdx),
+};
 
-	std::string out = w.ss.str();
+static constexpr HvkField kSettings[] =
+{
+	HVK_FIELD(c_settings, is_first_run),
+	HVK_FIELD(c_settings, g_MainTab),
+	HVK_FIELD(c_settings, vsync),
+	HVK_OBJECT(c_settings, visibility, "visibility", kVisibility),
+	HVK_OBJECT_AT(c_settings, fmtui.g_FormatUI, "format_ui", kFormatUI),
+	HVK_OBJECT(c_settings, themecombos, "themecombos", kThemeCombos),
+};
 
-	HANDLE hFile = CreateFileW(
-		path.c_str(),
-		GENERIC_WRITE,
-		FILE_SHARE_READ,
-		nullptr,
-		CREATE_ALWAYS,
-		FILE_ATTRIBUTE_NORMAL,
-		nullptr
-	);
+struct HvkInstanceInfo
+{
+	std::string app;
+	std::string uuid;
+	uint64_t created_unix = 0;
+};
 
-	if (hFile == INVALID_HANDLE_VALUE)
-		return;
+static constexpr HvkField kInstanceInfo[] =
+{
+	HVK_FIELD(HvkInstanceInfo, app),
+	HVK_FIELD(HvkInstanceInfo, uuid),
+	HVK_FIELD(HvkInstanceInfo, created_unix),
+};
 
-	DWORD written;
-	WriteFile(hFile, out.data(), (DWORD)out.size(), &written, nullptr);
-	CloseHandle(hFile);
-}
+// ------------------------------------------------------------
+// File IO
+// ------------------------------------------------------------
 
 static bool ReadFileToString(const std::wstring& path, std::string& out)
 {
@@ -354,24 +142,38 @@ static bool ReadFileToString(const std::wstring& path, std::string& out)
 	return read == size;
 }
 
-static ImVec4 ReadImVec4(const json& j, const ImVec4& fallback)
+// ------------------------------------------------------------
+// Export / Import
+// ------------------------------------------------------------
+
+void c_usersettings::ExportToHvk(const std::wstring path)
 {
-	if (!j.is_array() || j.size() != 4)
-		return fallback;
+	std::wstring dir = HVKIO::GetLocalAppDataW() + L"\\PSHVK";
+	HVKIO::EnsureDirectory(dir);
 
-	// must all be numbers
-	for (int i = 0; i < 4; ++i)
-		if (!j[i].is_number())
-			return fallback;
+	// Queued, not written: the writer thread serializes this copy once the
+	// edits settle (slider drags ask every frame). One job, JSON first, so
+	// the snapshot always ends up at least as new.
+	auto copy = std::make_shared<c_usersettings>(*user);
 
-	ImVec4 out = fallback;
+	WriteBehind::Request({
+		{ path, [copy](std::string& out) { HvkSchema::Write(out, copy.get(), kUserSettings); } },
+		{ HvkSnapshot::PathFor(path), [copy](std::string& out) { HvkSnapshot::Encode(out, copy.get(), kUserSettings, HvkCount(kUserSettings)); } },
+	});
+}
 
-	out.x = (float)j[0].get<double>();
-	out.y = (float)j[1].get<double>();
-	out.z = (float)j[2].get<double>();
-	out.w = (float)j[3].get<double>();
 
-	return out;
+void c_settings::ExportToHvk(const std::wstring path)
+{
+	std::wstring dir = HVKIO::GetLocalAppDataW() + L"\\PSHVK";
+	HVKIO::EnsureDirectory(dir);
+
+	auto copy = std::make_shared<c_settings>(*settings);
+
+	WriteBehind::Request({
+		{ path, [copy](std::string& out) { HvkSchema::Write(out, copy.get(), kSettings); } },
+		{ HvkSnapshot::PathFor(path), [copy](std::string& out) { HvkSnapshot::Encode(out, copy.get(), kSettings, HvkCount(kSettings)); } },
+	});
 }
 
 
@@ -379,82 +181,42 @@ bool c_usersettings::ImportFromHvk(const std::wstring& path)
 {
 	printf("User Settings Import Requested. \n\n");
 
-	std::string text;
-	if (!ReadFileToString(path, text))
-	{
-		printf("Failed to read path.\n\n");
-		return false;
-	}
-
-	json j;
-	try {
-		printf("First bytes: %02X %02X %02X\n\n",
-			(unsigned char)text[0],
-			(unsigned char)text[1],
-			(unsigned char)text[2]);
-
-		j = json::parse(text);
-	}
-	catch (const std::exception& e) {
-		printf("JSON parse error: %s\n", e.what());
-		return false;
-	}
+	WriteBehind::Flush();
 
+	// read into a copy; only a complete read reaches the live settings
+	c_usersettings incoming = *user;
 
-	if (j.contains("render"))
+	std::string error;
+	if (!HvkSnapshot::IsCurrent(path) ||
+		!HvkSnapshot::Load(HvkSnapshot::PathFor(path), &incoming, kUserSettings, &error))
 	{
-		auto& r = j["render"];
-		if (r.contains("wm_render_interval")) user->render.wm_render_interval = r["wm_render_interval"];
-		if (r.contains("target_fps"))         user->render.target_fps = r["target_fps"];
-		if (r.contains("bg_image_path"))
+		if (!error.empty())
+			printf("Snapshot skipped: %s\n", error.c_str());
+
+		std::string text;
+		if (!ReadFileToString(path, text))
 		{
-			std::string s = r["bg_image_path"];
-			user->render.bg_image_path = std::wstring(s.begin(), s.end());
+			printf("Failed to read path.\n\n");
+			return false;
 		}
-	}
-
-	if (j.contains("binds"))
-	{
-		auto& b = j["binds"];
-		if (b.contains("toggle_main")) user->binds.toggle_main = b["toggle_main"];
-		if (b.contains("toggle_dev"))  user->binds.toggle_dev = b["toggle_dev"];
-		if (b.contains("shutdown"))    user->binds.shutdown = b["shutdown"];
-	}
-
-	if (j.contains("style"))
-	{
-		auto& s = j["style"];
-
-		if (s.contains("wm_bg_color"))
-			user->style.wm_bg_color = ReadImVec4(s["wm_bg_color"], user->style.wm_bg_color);
-
-		if (s.contains("wm_text_color"))
-			user->style.wm_text_color = ReadImVec4(s["wm_text_color"], user->style.wm_text_color);
-
 
-		if (s.contains("wm_opacity"))user->style.wm_opacity = s["wm_opacity"].get<float>();
-
-		if (s.contains("main_bg_color"))
-			user->style.main_bg_color = ReadImVec4(s["main_bg_color"], user->style.main_bg_color);
-
-		if (s.contains("main_text_color"))
-			user->style.main_text_color = ReadImVec4(s["main_text_color"], user->style.main_text_color);
-
-		if (s.contains("main_border_color"))
-			user->style.main_border_color = ReadImVec4(s["main_border_color"], user->style.main_border_color);
-
-		if (s.contains("main_opacity")) user->style.main_opacity = s["main_opacity"].get<float>();
-
-		if (s.contains("loading_theme"))
-			user->style.loading_theme = (LoadingTheme)s["loading_theme"].get<int>();
+		if (!HvkSchema::Read(text, &incoming, kUserSettings, &error))
+		{
+			printf("JSON parse error: %s\n", error.c_str());
 
-		if (s.contains("bg_theme"))
-			user->style.bg_theme = (BgTheme)s["bg_theme"].get<int>();
+			// previous generation kept by the writer; start over from the live
+			// values, the failed parse may have got halfway
+			incoming = *user;
+			if (!ReadFileToString(WriteBehind::BackupPath(path), text) ||
+				!HvkSchema::Read(text, &incoming, kUserSettings))
+				return false;
 
-		if (s.contains("main_secondary_color"))
-			user->style.main_secondary_color = ReadImVec4(s["main_secondary_color"], user->style.main_secondary_color);
+			printf("Restored from backup.\n");
+		}
 	}
 
+	HvkSchema::Merge(user, &incoming, kUserSettings, nullptr);
+
 	OutputDebugStringA("[HVK] ImportFromHvk(user) AFTER import:\n");
 	{
 		char buf[512];
@@ -465,105 +227,67 @@ bool c_usersettings::ImportFromHvk(const std::wstring& path)
 		OutputDebugStringA(buf);
 	}
 
+	++user->style.generation;
 	return true;
 }
 
 bool c_settings::ImportFromHvk(const std::wstring& path)
 {
-	std::string text;
-	if (!ReadFileToString(path, text))
-		return false;
-
-	json j;
-	try {
-		j = json::parse(text);
-	}
-	catch (...) {
-		return false;
-	}
-
-	if (j.contains("is_first_run")) settings->is_first_run = j["is_first_run"];
-	if (j.contains("g_MainTab"))    settings->g_MainTab = j["g_MainTab"];
-	if (j.contains("vsync"))        settings->vsync = j["vsync"];
-	if (j.contains("isLoading"))    settings->isLoading = j["isLoading"];
+	WriteBehind::Flush();
 
-	if (j.contains("visibility"))
-	{
-		auto& v = j["visibility"];
-		if (v.contains("win_main")) settings->visibility.win_main = v["win_main"];
-		if (v.contains("win_dev")) settings->visibility.win_dev = v["win_dev"];
-		if (v.contains("win_selector")) settings->visibility.win_selector = v["win_selector"];
-		if (v.contains("disk_info")) settings->visibility.disk_info = v["disk_info"];
-		if (v.contains("part_info")) settings->visibility.part_info = v["part_info"];
-		if (v.contains("disk_and_part_info"))
-			settings->visibility.disk_and_part_info = v["disk_and_part_info"];
-	}
+	c_settings incoming = *settings;
+	bool ok = HvkSnapshot::IsCurrent(path) &&
+		HvkSnapshot::Load(HvkSnapshot::PathFor(path), &incoming, kSettings);
 
-	if (j.contains("format_ui"))
-	{
-		auto& f = j["format_ui"];
-		auto& ui = settings->fmtui.g_FormatUI;
-
-		if (f.contains("SelectedDisk")) ui.SelectedDisk = f["SelectedDisk"];
-		if (f.contains("SelectedPartition")) ui.SelectedPartition = f["SelectedPartition"];
-		if (f.contains("VolumeLabel"))
-			strncpy_s(ui.VolumeLabel, f["VolumeLabel"].get<std::string>().c_str(), sizeof(ui.VolumeLabel));
-		if (f.contains("FileSystem")) ui.FileSystem = f["FileSystem"];
-		if (f.contains("QuickFormat")) ui.QuickFormat = f["QuickFormat"];
-		if (f.contains("ConfirmPopup")) ui.ConfirmPopup = f["ConfirmPopup"];
-		if (f.contains("ConfirmRecreate")) ui.ConfirmRecreate = f["ConfirmRecreate"];
-		if (f.contains("ConfirmCreatePartition")) ui.ConfirmCreatePartition = f["ConfirmCreatePartition"];
-		if (f.contains("ConfirmDeletePartition")) ui.ConfirmDeletePartition = f["ConfirmDeletePartition"];
-		if (f.contains("RenameLabel"))
-			strncpy_s(ui.RenameLabel, f["RenameLabel"].get<std::string>().c_str(), sizeof(ui.RenameLabel));
-	}
+	std::string text;
+	if (!ok)
+		ok = ReadFileToString(path, text) && HvkSchema::Read(text, &incoming, kSettings);
 
-	if (j.contains("themecombos"))
+	if (!ok)
 	{
-		auto& t = j["themecombos"];
-		if (t.contains("LoadingThemeIdx")) settings->themecombos.LoadingThemeIdx = t["LoadingThemeIdx"];
-		if (t.contains("BgThemeIdx")) settings->themecombos.BgThemeIdx = t["BgThemeIdx"];
+		incoming = *settings; // the failed parse may have got halfway
+		ok = ReadFileToString(WriteBehind::BackupPath(path), text) && HvkSchema::Read(text, &incoming, kSettings);
 	}
 
-	return true;
+	if (ok)
+		HvkSchema::Merge(settings, &incoming, kSettings, nullptr);
+	return ok;
 }
 
-
-#pragma pack(push, 1)
-struct HVKSignature
+bool c_usersettings::ReloadFromHvk(const std::wstring& path, std::vector<std::string>& changed)
 {
-	char     magic[6];   // "HVKSIG"
-	uint16_t version;    // for future changes
-	uint8_t  hash[32];   // SHA-256
-	// uint8_t uuidhash[32]; // SHA-256 (HVKUUID)
-};
-#pragma pack(pop)
+	// live values are newer than the file while a save is queued
+	if (WriteBehind::IsPending(path))
+		return false;
+
+	std::string text;
+	if (!ReadFileToString(path, text) || WriteBehind::IsOwnWrite(path, text))
+		return false;
 
+	// parse into a copy so a half-written file never touches the live settings
+	c_usersettings incoming = *user;
+	if (!HvkSchema::Read(text, &incoming, kUserSettings))
+		return false;
 
-#include <bcrypt.h>
-#pragma comment(lib, "bcrypt.lib")
+	HvkSchema::Merge(user, &incoming, kUserSettings, &changed);
+	return true;
+}
 
-static bool Sha256(const void* data, size_t size, uint8_t out[32])
+bool c_settings::ReloadFromHvk(const std::wstring& path, std::vector<std::string>& changed)
 {
-	BCRYPT_ALG_HANDLE hAlg = nullptr;
-	BCRYPT_HASH_HANDLE hHash = nullptr;
-	DWORD hashLen = 32;
-	DWORD cb = 0;
-
-	if (BCryptOpenAlgorithmProvider(&hAlg, BCRYPT_SHA256_ALGORITHM, nullptr, 0))
+	// live values are newer than the file while a save is queued
+	if (WriteBehind::IsPending(path))
 		return false;
 
-	if (BCryptCreateHash(hAlg, &hHash, nullptr, 0, nullptr, 0, 0))
-	{
-		BCryptCloseAlgorithmProvider(hAlg, 0);
+	std::string text;
+	if (!ReadFileToString(path, text) || WriteBehind::IsOwnWrite(path, text))
 		return false;
-	}
 
-	BCryptHashData(hHash, (PUCHAR)data, (ULONG)size, 0);
-	BCryptFinishHash(hHash, out, hashLen, 0);
+	c_settings incoming = *settings;
+	if (!HvkSchema::Read(text, &incoming, kSettings))
+		return false;
 
-	BCryptDestroyHash(hHash);
-	BCryptCloseAlgorithmProvider(hAlg, 0);
+	HvkSchema::Merge(settings, &incoming, kSettings, &changed);
 	return true;
 }
 
@@ -579,34 +303,17 @@ bool HVKIO::CreateInstanceFile()
 	settings->metadata.uuid = GenerateHvkUUID();
 
 	// --- build JSON ---
-	HvkJsonWriter w;
-	w.BeginObject();
-
-	w.Key("app");
-	w.String("PSHVK");
-
-	w.Key("uuid");
-	w.String(settings->metadata.uuid);
-
-	w.Key("created_unix");
-	w.Number((uint64_t)time(nullptr), false);
+	HvkInstanceInfo info;
+	info.app = "PSHVK";
+	info.uuid = settings->metadata.uuid;
+	info.created_unix = (uint64_t)time(nullptr);
 
-	w.EndObject();
-
-	std::string jsonText = w.ss.str();
-
-	// --- build signature ---
-	HVKSignature sig{};
-	memcpy(sig.magic, "HVKSIG", 6);
-	sig.version = 1;
-
-	if (!Sha256(jsonText.data(), jsonText.size(), sig.hash))
-		return false;
+	std::string jsonText;
+	HvkSchema::Write(jsonText, &info, kInstanceInfo);
 
-	/*if (!Sha256(settings->metadata.uuid, sizeof(settings->metadata.uuid), sig.uuidhash))
-		return false;*/
+	// --- JSON + separator + signature ---
+	const std::string bytes = InstanceSignature::Build(jsonText);
 
-	// --- write file ---
 	HANDLE hFile = CreateFileW(
 		file.c_str(),
 		GENERIC_WRITE,
@@ -621,97 +328,26 @@ bool HVKIO::CreateInstanceFile()
 		return false;
 
 	DWORD written = 0;
+	BOOL ok = WriteFile(hFile, bytes.data(), (DWORD)bytes.size(), &written, nullptr);
+	CloseHandle(hFile);
 
-	// write JSON
-	WriteFile(hFile, jsonText.data(), (DWORD)jsonText.size(), &written, nullptr);
-
-	// separator
-	char zero = 0;
-	WriteFile(hFile, &zero, 1, &written, nullptr);
-
-	// write signature block
-	WriteFile(hFile, &sig, sizeof(sig), &written, nullptr);
+	InstanceFileChanged();
+	return ok && written == bytes.size();
+}
 
-	CloseHandle(hFile);
-	return true;
+static InstanceValidationCache& InstanceCache()
+{
+	static InstanceValidationCache cache(HVKIO::GetLocalAppDataW() + L"\\PSHVK\\instance.hvk");
+	return cache;
 }
 
+// Cached: only re-hashes after InstanceFileChanged() and a stamp change
 bool HVKIO::ValidateInstanceFile()
 {
-	std::wstring base = GetLocalAppDataW();
-	std::wstring file = base + L"\\PSHVK\\instance.hvk";
-
-	HANDLE hFile = CreateFileW(
-		file.c_str(),
-		GENERIC_READ,
-		FILE_SHARE_READ,
-		nullptr,
-		OPEN_EXISTING,
-		FILE_ATTRIBUTE_NORMAL,
-		nullptr
-	);
-
-	if (hFile == INVALID_HANDLE_VALUE)
-		return false;
-
-	LARGE_INTEGER fileSize{};
-	if (!GetFileSizeEx(hFile, &fileSize))
-	{
-		CloseHandle(hFile);
-		return false;
-	}
-
-	if (fileSize.QuadPart <= (LONGLONG)sizeof(HVKSignature) + 1)
-	{
-		CloseHandle(hFile);
-		return false;
-	}
-
-	std::vector<uint8_t> data((size_t)fileSize.QuadPart);
-	DWORD read = 0;
-
-	if (!ReadFile(hFile, data.data(), (DWORD)data.size(), &read, nullptr) ||
-		read != data.size())
-	{
-		CloseHandle(hFile);
-		return false;
-	}
-
-	CloseHandle(hFile);
-
-	// signature is at the end
-	const size_t sigOffset = data.size() - sizeof(HVKSignature);
-	const HVKSignature* sig =
-		reinterpret_cast<const HVKSignature*>(data.data() + sigOffset);
-
-	// validate magic
-	if (memcmp(sig->magic, "HVKSIG", 6) != 0)
-		return false;
-
-	// validate version
-	if (sig->version != 1)
-		return false;
-
-	// JSON must end before the zero separator
-	size_t jsonEnd = sigOffset;
-	if (jsonEnd == 0 || data[jsonEnd - 1] != 0)
-		return false;
-
-	jsonEnd--; // exclude separator
-
-	// recompute hash
-	uint8_t hash[32]{};
-	if (!Sha256(data.data(), jsonEnd, hash))
-		return false;
-
-	/*uint8_t uuidhash[32]{};
-	if (!Sha256(settings->metadata.uuid, sizeof(settings->metadata.uuid), uuidhash))
-		return false;*/
-
-	// compare hashes
-	if (memcmp(hash, sig->hash, 32) != 0)
-		return false;
-
-	return true;
+	return InstanceCache().Get();
 }
 
+void HVKIO::InstanceFileChanged()
+{
+	InstanceCache().Invalidate();
+}
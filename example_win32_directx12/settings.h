@@ -1,6 +1,8 @@
 #pragma once
 #include "util/web_helper.h"
 #include "util/disk.h"
+#include "util/delta_sync.h"
+#include "user_style.h"
 #include "thread"
 
 #ifdef _DEV
@@ -31,8 +33,14 @@ struct FormatUIState
 	bool ConfirmRecreate = false;
 	bool ConfirmCreatePartition = false;
 	bool ConfirmDeletePartition = false;
+	bool ConfirmApplyPlan = false;
 
 	char RenameLabel[32] = "";
+
+	bool QueueOps = false; // queue actions into AppState::PendingOps instead of running them
+
+	char SyncSource[260] = "";   // folder mirrored onto the selected volume
+	bool SyncDeleteExtra = false;
 };
 
 struct LoadingCache {
@@ -56,23 +64,19 @@ struct AppState
 	LoadingCache Lcache;
 	RenderBackend g_RenderBackend = RenderBackend::DX11;
 
-	bool NeedsRefresh = true;
-};
+	DiskPlan      PendingOps;
+	PlannedLayout PendingBase; // layout PendingOps is simulated against
+	int LayoutGeneration = 0;       // bumped whenever PhysicalDisks / Partitions are re-read
+	int PendingBaseGeneration = -1; // LayoutGeneration PendingBase was built from
 
-enum class LoadingTheme 
-{
-	DARKMODE,
-	LIGHTMODE
-};
+	std::shared_ptr<ProcessJob> DiskJob; // running diskpart, drained by the Format tab
+	int DiskJobTarget = -1;              // disk to rescan once it finishes (-1 = full refresh)
+	std::vector<ProcessLine> DiskLog;
 
-enum class BgTheme 
-{
-	BLACK,
-	PURPLE,
-	YELLOW, 
-	BLUE,
-	GREEN,
-	RED
+	std::shared_ptr<DeltaSyncJob> SyncJob; // folder sync onto a volume, kept after it finishes for its report
+
+	bool NeedsRefresh = true;
+	int RescanDisk = -1; // targeted rescan of one disk after a batch commit
 };
 
 class c_usersettings {
@@ -81,6 +85,9 @@ public:
 	static void ExportToHvk(const std::wstring path);
 	static bool ImportFromHvk(const std::wstring& path);
 
+	// Hot reload: re-reads the JSON and applies only the fields that changed
+	static bool ReloadFromHvk(const std::wstring& path, std::vector<std::string>& changed);
+
 	
 	struct {
 		int wm_render_interval = 1000; // milliseconds
@@ -96,50 +103,7 @@ public:
 
 	} binds;
 		
-	struct {
-
-		// Watermark //
-		ImVec4 wm_bg_color = ImVec4(0.05f, 0.05f, 0.05f, 1.0f);
-		ImVec4 wm_text_color = ImVec4(0.9f, 0.9f, 0.9f, 1.0f);
-		float wm_opacity = 0.85f;
-
-		// Main Window //
-		ImVec4 main_bg_color = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
-		ImVec4 main_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		ImVec4 main_border_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		float main_opacity = 1.0f;
-
-		// Main Secondary Color (tied to bg_theme) //
-		ImVec4 main_secondary_color = ImVec4(0.5f, 0.2f, 0.8f, 1.0f); // Purple (default for PURPLE theme)
-
-		// Tab Bar //
-		ImVec4 tabbar_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		ImVec4 tabbar_selected_color = main_secondary_color;
-		float tabbar_inactive_opacity = 1.0f;
-
-		// Widget Colors //
-		ImVec4 button_color = ImVec4(0.2f, 0.2f, 0.2f, 0.8f);
-		ImVec4 button_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		ImVec4 button_hover_color = ImVec4(0.3f, 0.3f, 0.3f, 0.9f);
-		ImVec4 button_hover_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-		ImVec4 button_active_color = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
-
-		// BG & Loading Textures //
-		LoadingTheme loading_theme = LoadingTheme::DARKMODE;
-		BgTheme bg_theme = BgTheme::PURPLE;
-
-		// Scale // 
-		float dpi_scale = 0.0f;
-		float ui_scale = 0.0f;
-
-		// Fonts //
-		ImFont* proggy_clean = (ImFont*)nullptr;
-		ImFont* satoshi_regular = (ImFont*)nullptr;
-		ImFont* satoshi_medium = (ImFont*)nullptr;
-		ImFont* satoshi_bold = (ImFont*)nullptr;
-
-
-	} style;
+	UserStyle style;
 };
 
 class c_settings {
@@ -147,6 +111,7 @@ public:
 
 	static void ExportToHvk(const std::wstring path);
 	static bool ImportFromHvk(const std::wstring& path);
+	static bool ReloadFromHvk(const std::wstring& path, std::vector<std::string>& changed);
 
 
 	bool is_first_run = false;
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+#include "imgui.h"
+
+// The user's look (colors, themes, scale, fonts): c_usersettings::style.
+// Its own header, free of the Windows ones, so imgui/hvk_style.cpp builds
+// on the Linux side too.
+
+enum class LoadingTheme 
+{
+	DARKMODE,
+	LIGHTMODE
+};
+
+enum class BgTheme 
+{
+	BLACK,
+	PURPLE,
+	YELLOW, 
+	BLUE,
+	GREEN,
+	RED
+};
+
+struct UserStyle
+{
+	// Watermark //
+	ImVec4 wm_bg_color = ImVec4(0.05f, 0.05f, 0.05f, 1.0f);
+	ImVec4 wm_text_color = ImVec4(0.9f, 0.9f, 0.9f, 1.0f);
+	float wm_opacity = 0.85f;
+
+	// Main Window //
+	ImVec4 main_bg_color = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
+	ImVec4 main_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+	ImVec4 main_border_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+	float main_opacity = 1.0f;
+
+	// Main Secondary Color (tied to bg_theme) //
+	ImVec4 main_secondary_color = ImVec4(0.5f, 0.2f, 0.8f, 1.0f); // Purple (default for PURPLE theme)
+
+	// Tab Bar //
+	ImVec4 tabbar_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+	ImVec4 tabbar_selected_color = main_secondary_color;
+	float tabbar_inactive_opacity = 1.0f;
+
+	// Widget Colors //
+	ImVec4 button_color = ImVec4(0.2f, 0.2f, 0.2f, 0.8f);
+	ImVec4 button_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+	ImVec4 button_hover_color = ImVec4(0.3f, 0.3f, 0.3f, 0.9f);
+	ImVec4 button_hover_text_color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+	ImVec4 button_active_color = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
+
+	// BG & Loading Textures //
+	LoadingTheme loading_theme = LoadingTheme::DARKMODE;
+	BgTheme bg_theme = BgTheme::PURPLE;
+
+	// Scale // 
+	float dpi_scale = 0.0f;
+	float ui_scale = 0.0f;
+
+	// Fonts //
+	ImFont* proggy_clean = (ImFont*)nullptr;
+	ImFont* satoshi_regular = (ImFont*)nullptr;
+	ImFont* satoshi_medium = (ImFont*)nullptr;
+	ImFont* satoshi_bold = (ImFont*)nullptr;
+
+	// Bumped by anything that edits the fields above (Colors tab, import,
+	// hot reload); UpdateStyle only reapplies when it moves. Not saved.
+	uint32_t generation = 1;
+};
@@ -0,0 +1,73 @@
+#include "asset_bootstrap.h"
+#include "asset_vfs.h"
+
+AssetBootstrap::~AssetBootstrap()
+{
+	Stop();
+}
+
+void AssetBootstrap::Start(AssetBootstrapSteps s, int threads)
+{
+	steps = std::move(s);
+
+	const int sync = graph.Add("asset sync", [this]()
+		{
+			// Incremental: after the first run this is one conditional listing request
+			if (steps.Sync && steps.Sync(&cancel))
+				changed.store(true);
+			return !cancel.load();
+		});
+
+	const int pack = graph.Add("asset pack", [this]()
+		{
+			// a pack for the current tree may already be mounted from before the sync
+			if (steps.Mount && steps.Mount())
+				changed.store(true);
+			return true;
+		}, { sync });
+
+	const int verify = graph.Add("asset verify", [this]()
+		{
+			// checksums now rather than on first read from the main thread
+			auto mounted = AssetVfs::Pack();
+			if (!changed.load() || !mounted)
+				return true;
+
+			std::string error;
+			if (mounted->VerifyAll(&error))
+				return true;
+
+			// the loose files it was built from are still there
+			AssetVfs::Unmount();
+			std::lock_guard<std::mutex> lock(mtx);
+			verifyError = error.empty() ? "verification failed" : error;
+			return true;
+		}, { pack });
+
+	graph.Add("hot swap", [this]()
+		{
+			if (changed.load())
+				swapped.store(true);
+			return true;
+		}, { verify });
+
+	graph.Start(threads);
+}
+
+void AssetBootstrap::Stop()
+{
+	cancel.store(true);
+	graph.Cancel();
+	graph.Wait();
+}
+
+bool AssetBootstrap::TakeSwap()
+{
+	return swapped.exchange(false);
+}
+
+std::string AssetBootstrap::VerifyError() const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	return verifyError;
+}
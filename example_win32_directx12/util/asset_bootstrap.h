@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+
+#include "task_graph.h"
+
+// The asset bootstrap main() runs behind the loading screen: sync, then
+// build or mount the pack for the synced tree, then verify it, then hand the
+// new assets to the main loop, which swaps them in between frames. The steps
+// that go to the network and the asset folder are passed in (HVKIO's on
+// Windows, a stand-in server in the Linux test); the graph, cancelling and
+// the hand-over live here.
+
+struct AssetBootstrapSteps
+{
+	std::function<bool(const std::atomic<bool>* cancel)> Sync;   // true when the asset folder changed
+	std::function<bool()> Mount;                                   // true when a new pack was mounted
+};
+
+class AssetBootstrap
+{
+public:
+	AssetBootstrap() = default;
+	~AssetBootstrap();
+
+	AssetBootstrap(const AssetBootstrap&) = delete;
+	AssetBootstrap& operator=(const AssetBootstrap&) = delete;
+
+	void Start(AssetBootstrapSteps steps, int threads = 2);
+
+	// Cancels the download and whatever hasn't started, waits for the rest
+	void Stop();
+
+	// New assets are mounted and verified: true once, for the main loop to swap them in
+	bool TakeSwap();
+	bool SwapPending() const { return swapped.load(); }
+
+	// Why the new pack was unmounted again, empty if it wasn't
+	std::string VerifyError() const;
+
+	const TaskGraph& Graph() const { return graph; }
+
+private:
+	TaskGraph graph;
+	AssetBootstrapSteps steps;
+
+	std::atomic<bool> cancel{ false };
+	std::atomic<bool> changed{ false };
+	std::atomic<bool> swapped{ false };
+
+	mutable std::mutex mtx;
+	std::string verifyError;
+};
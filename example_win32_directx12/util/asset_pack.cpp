@@ -0,0 +1,715 @@
+#include "asset_pack.h"
+#include "hash.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static constexpr char kMagic[8] = { 'H', 'V', 'K', 'P', 'A', 'C', 'K', 0 };
+
+struct PackHeader
+{
+	char Magic[8];
+	uint16_t Format;
+	uint16_t HeaderSize;
+	uint32_t EntryCount;
+	uint64_t IndexOffset;
+	uint64_t IndexSize;
+	uint64_t IndexHash;
+	uint64_t SourceTag;
+	uint64_t Reserved[2];
+};
+
+static_assert(sizeof(PackHeader) == 64, "PackHeader is read in place");
+
+// Compression has to save at least this much of an entry to be kept
+static constexpr uint64_t kMinSavingShift = 3;   // 1/8
+
+static bool Fail(std::string* error, const std::string& what)
+{
+	if (error)
+		*error = what;
+	return false;
+}
+
+// ------------------------------------------------------------
+// Mapping
+// ------------------------------------------------------------
+
+static const uint8_t* MapFile(const fs::path& path, size_t& size, std::string* error)
+{
+#ifdef _WIN32
+	HANDLE hFile = CreateFileW(
+		path.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ | FILE_SHARE_DELETE,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_FLAG_RANDOM_ACCESS,
+		nullptr
+	);
+
+	if (hFile == INVALID_HANDLE_VALUE)
+		return Fail(error, "no pack"), nullptr;
+
+	LARGE_INTEGER li{};
+	if (!GetFileSizeEx(hFile, &li) || li.QuadPart < (LONGLONG)sizeof(PackHeader))
+	{
+		CloseHandle(hFile);
+		return Fail(error, "pack too small"), nullptr;
+	}
+
+	HANDLE hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(hFile);
+	if (!hMap)
+		return Fail(error, "map failed"), nullptr;
+
+	const void* view = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(hMap);
+	if (!view)
+		return Fail(error, "map failed"), nullptr;
+
+	size = (size_t)li.QuadPart;
+	return (const uint8_t*)view;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return Fail(error, "no pack"), nullptr;
+
+	struct stat st {};
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(PackHeader))
+	{
+		close(fd);
+		return Fail(error, "pack too small"), nullptr;
+	}
+
+	void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return Fail(error, "map failed"), nullptr;
+
+	size = (size_t)st.st_size;
+	return (const uint8_t*)view;
+#endif
+}
+
+static void UnmapFile(const uint8_t* base, size_t size)
+{
+#ifdef _WIN32
+	(void)size;
+	UnmapViewOfFile(base);
+#else
+	munmap((void*)base, size);
+#endif
+}
+
+AssetPack::~AssetPack()
+{
+	if (mapped)
+		UnmapFile(base, size);
+}
+
+// ------------------------------------------------------------
+// Paths
+// ------------------------------------------------------------
+
+std::string AssetPack::Normalize(std::string_view path)
+{
+	std::string out;
+	out.reserve(path.size());
+
+	for (char c : path)
+	{
+		if (c == '\\')
+			c = '/';
+		else if (c >= 'A' && c <= 'Z')
+			c = (char)(c - 'A' + 'a');
+
+		if (c == '/' && (out.empty() || out.back() == '/'))
+			continue;
+
+		out.push_back(c);
+	}
+
+	while (out.size() >= 2 && out[0] == '.' && out[1] == '/')
+		out.erase(0, 2);
+
+	return out;
+}
+
+uint64_t AssetPack::PathHash(std::string_view normalized)
+{
+	return HashService::Fast64(normalized.data(), normalized.size());
+}
+
+const PackEntry* AssetPack::Find(std::string_view path) const
+{
+	const std::string key = Normalize(path);
+	const uint64_t hash = PathHash(key);
+
+	const PackEntry* it = std::lower_bound(begin(), end(), hash,
+		[](const PackEntry& e, uint64_t h) { return e.PathHash < h; });
+
+	for (; it != end() && it->PathHash == hash; ++it)
+	{
+		if (NameOf(*it) == key)
+			return it;
+	}
+
+	return nullptr;
+}
+
+std::string_view AssetPack::NameOf(const PackEntry& e) const
+{
+	return std::string_view(names + e.NameOffset, e.NameLength);
+}
+
+// ------------------------------------------------------------
+// Open / read
+// ------------------------------------------------------------
+
+std::shared_ptr<AssetPack> AssetPack::Open(const fs::path& path, std::string* error)
+{
+	std::shared_ptr<AssetPack> pack(new AssetPack());
+	pack->path = path;
+	pack->base = MapFile(path, pack->size, error);
+	if (!pack->base)
+		return nullptr;
+
+	pack->mapped = true;
+	return Attach(std::move(pack), error);
+}
+
+std::shared_ptr<AssetPack> AssetPack::OpenMemory(const void* data, size_t size, std::string* error)
+{
+	if (!data || size < sizeof(PackHeader) || (uintptr_t)data % alignof(PackEntry) != 0)
+		return Fail(error, "bad pack buffer"), nullptr;
+
+	std::shared_ptr<AssetPack> pack(new AssetPack());
+	pack->base = (const uint8_t*)data;
+	pack->size = size;
+	return Attach(std::move(pack), error);
+}
+
+std::shared_ptr<AssetPack> AssetPack::Attach(std::shared_ptr<AssetPack> pack, std::string* error)
+{
+	PackHeader h;
+	memcpy(&h, pack->base, sizeof(h));
+
+	if (memcmp(h.Magic, kMagic, sizeof(kMagic)) != 0)
+		return Fail(error, "not a pack"), nullptr;
+	if (h.Format != kFormat || h.HeaderSize != sizeof(PackHeader))
+		return Fail(error, "unsupported pack format"), nullptr;
+
+	const uint64_t entryBytes = (uint64_t)h.EntryCount * sizeof(PackEntry);
+	if (h.IndexOffset % alignof(PackEntry) != 0 ||
+		h.IndexOffset > pack->size || h.IndexSize > pack->size - h.IndexOffset ||
+		entryBytes > h.IndexSize)
+		return Fail(error, "bad index bounds"), nullptr;
+
+	if (HashService::Fast64(pack->base + h.IndexOffset, (size_t)h.IndexSize) != h.IndexHash)
+		return Fail(error, "index checksum mismatch"), nullptr;
+
+	pack->entries = (const PackEntry*)(pack->base + h.IndexOffset);
+	pack->names = (const char*)(pack->base + h.IndexOffset + entryBytes);
+	pack->count = h.EntryCount;
+	pack->sourceTag = h.SourceTag;
+
+	// The index hash covers corruption; this covers a writer bug
+	const uint64_t namesSize = h.IndexSize - entryBytes;
+	for (const PackEntry& e : *pack)
+	{
+		if (e.Offset > h.IndexOffset || e.Stored > h.IndexOffset - e.Offset ||
+			(uint64_t)e.NameOffset + e.NameLength > namesSize ||
+			e.Codec > Lz4 || (e.Codec == Store && e.Stored != e.Size))
+			return Fail(error, "bad entry"), nullptr;
+	}
+
+	pack->state.reset(new std::atomic<uint8_t>[pack->count]);
+	for (size_t i = 0; i < pack->count; ++i)
+		pack->state[i].store(Unchecked, std::memory_order_relaxed);
+
+	pack->decoded.resize(pack->count);
+	return pack;
+}
+
+bool AssetPack::Check(size_t index, const uint8_t* data, size_t bytes, std::string* error)
+{
+	uint8_t s = state[index].load(std::memory_order_acquire);
+	if (s == Unchecked)
+	{
+		s = HashService::Fast64(data, bytes) == entries[index].Checksum ? Good : Bad;
+		state[index].store(s, std::memory_order_release);
+	}
+
+	if (s == Bad)
+		return Fail(error, "checksum mismatch: " + std::string(NameOf(entries[index])));
+
+	return true;
+}
+
+bool AssetPack::Read(const PackEntry& e, AssetData& out, std::string* error)
+{
+	out = {};
+	const size_t index = (size_t)(&e - entries);
+	const uint8_t* stored = base + e.Offset;
+
+	if (e.Codec == Store)
+	{
+		if (!Check(index, stored, (size_t)e.Size, error))
+			return false;
+
+		out.Data = stored;
+		out.Size = (size_t)e.Size;
+		out.Hold = shared_from_this();
+		return true;
+	}
+
+	std::shared_ptr<const std::vector<uint8_t>> buffer;
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		buffer = decoded[index];
+	}
+
+	if (!buffer)
+	{
+		if (state[index].load(std::memory_order_acquire) == Bad)
+			return Fail(error, "checksum mismatch: " + std::string(NameOf(e)));
+
+		auto bytes = std::make_shared<std::vector<uint8_t>>((size_t)e.Size);
+		if (!Lz4Decompress(stored, (size_t)e.Stored, bytes->data(), bytes->size()))
+		{
+			state[index].store(Bad, std::memory_order_release);
+			return Fail(error, "corrupt entry: " + std::string(NameOf(e)));
+		}
+
+		if (!Check(index, bytes->data(), bytes->size(), error))
+			return false;
+
+		// Two threads may decode the same entry at once; the first one in wins
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		if (!decoded[index])
+			decoded[index] = std::move(bytes);
+		buffer = decoded[index];
+	}
+
+	out.Data = buffer->data();
+	out.Size = buffer->size();
+	out.Hold = std::move(buffer);
+	return true;
+}
+
+bool AssetPack::Read(std::string_view path, AssetData& out, std::string* error)
+{
+	const PackEntry* e = Find(path);
+	if (!e)
+	{
+		out = {};
+		return Fail(error, "not in pack");
+	}
+
+	return Read(*e, out, error);
+}
+
+bool AssetPack::VerifyAll(std::string* error)
+{
+	bool ok = true;
+	for (const PackEntry& e : *this)
+	{
+		AssetData data;
+		if (!Read(e, data, error))
+			ok = false;
+	}
+	return ok;
+}
+
+// ------------------------------------------------------------
+// LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+// Greedy single-probe encoder; the decoder bounds-checks everything since
+// the input comes off disk.
+// ------------------------------------------------------------
+
+static constexpr size_t kMinMatch = 4;
+static constexpr size_t kLastLiterals = 5;     // a block always ends in literals
+static constexpr size_t kMatchStartLimit = 12; // no match may start in the last 12 bytes
+static constexpr size_t kMaxOffset = 65535;
+static constexpr int kHashBits = 16;
+
+static uint32_t Load32(const uint8_t* p)
+{
+	uint32_t v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+static void PutLength(std::vector<uint8_t>& out, size_t len)
+{
+	while (len >= 255)
+	{
+		out.push_back(255);
+		len -= 255;
+	}
+	out.push_back((uint8_t)len);
+}
+
+static void PutSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength)
+{
+	const size_t ml = matchLength - kMinMatch;
+
+	uint8_t token = (uint8_t)((literalCount >= 15 ? 15 : literalCount) << 4);
+	if (offset)
+		token |= (uint8_t)(ml >= 15 ? 15 : ml);
+	out.push_back(token);
+
+	if (literalCount >= 15)
+		PutLength(out, literalCount - 15);
+	out.insert(out.end(), literals, literals + literalCount);
+
+	if (!offset)
+		return;
+
+	out.push_back((uint8_t)(offset & 0xFF));
+	out.push_back((uint8_t)(offset >> 8));
+	if (ml >= 15)
+		PutLength(out, ml - 15);
+}
+
+void AssetPack::Lz4Compress(const uint8_t* src, size_t n, std::vector<uint8_t>& out)
+{
+	out.clear();
+	out.reserve(n + n / 255 + 16);
+
+	size_t anchor = 0;
+
+	if (n > kMatchStartLimit)
+	{
+		std::vector<uint32_t> table((size_t)1 << kHashBits, 0);
+		const size_t startLimit = n - kMatchStartLimit;
+		const size_t matchEnd = n - kLastLiterals;
+
+		size_t i = 1;
+		size_t misses = 0;
+		while (i < startLimit)
+		{
+			const uint32_t seq = Load32(src + i);
+			const uint32_t h = (seq * 2654435761u) >> (32 - kHashBits);
+			size_t cand = table[h];
+			table[h] = (uint32_t)i;
+
+			if (i - cand > kMaxOffset || Load32(src + cand) != seq)
+			{
+				// skip ahead faster through data that doesn't compress (PNG, JPEG)
+				i += 1 + (misses++ >> 6);
+				continue;
+			}
+
+			size_t len = kMinMatch;
+			while (i + len < matchEnd && src[cand + len] == src[i + len])
+				++len;
+
+			while (i > anchor && cand > 0 && src[i - 1] == src[cand - 1])
+			{
+				--i;
+				--cand;
+				++len;
+			}
+
+			PutSequence(out, src + anchor, i - anchor, i - cand, len);
+			i += len;
+			anchor = i;
+			misses = 0;
+		}
+	}
+
+	PutSequence(out, src + anchor, n - anchor, 0, kMinMatch);
+}
+
+bool AssetPack::Lz4Decompress(const uint8_t* src, size_t n, uint8_t* dst, size_t dstSize)
+{
+	const uint8_t* ip = src;
+	const uint8_t* const iend = src + n;
+	uint8_t* op = dst;
+	uint8_t* const oend = dst + dstSize;
+
+	auto readLength = [&](size_t& len) -> bool
+	{
+		uint8_t b;
+		do
+		{
+			if (ip >= iend)
+				return false;
+			b = *ip++;
+			len += b;
+		} while (b == 255);
+		return true;
+	};
+
+	while (ip < iend)
+	{
+		const uint8_t token = *ip++;
+
+		size_t literals = token >> 4;
+		if (literals == 15 && !readLength(literals))
+			return false;
+		if ((size_t)(iend - ip) < literals || (size_t)(oend - op) < literals)
+			return false;
+
+		memcpy(op, ip, literals);
+		op += literals;
+		ip += literals;
+
+		if (ip == iend)
+			break;
+
+		if (iend - ip < 2)
+			return false;
+		const size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > (size_t)(op - dst))
+			return false;
+
+		size_t len = token & 15;
+		if (len == 15 && !readLength(len))
+			return false;
+		len += kMinMatch;
+		if ((size_t)(oend - op) < len)
+			return false;
+
+		const uint8_t* match = op - offset;
+		if (offset >= len)
+			memcpy(op, match, len);
+		else
+			for (size_t k = 0; k < len; ++k)
+				op[k] = match[k];
+		op += len;
+	}
+
+	return op == oend;
+}
+
+// ------------------------------------------------------------
+// Build
+// ------------------------------------------------------------
+
+static bool ReadWhole(const fs::path& path, std::vector<uint8_t>& out)
+{
+	std::ifstream in(path, std::ios::binary | std::ios::ate);
+	if (!in)
+		return false;
+
+	const std::streamoff size = in.tellg();
+	if (size < 0)
+		return false;
+
+	out.resize((size_t)size);
+	in.seekg(0);
+	return out.empty() || (bool)in.read((char*)out.data(), (std::streamsize)out.size());
+}
+
+static std::string Utf8(const fs::path& p)
+{
+	const auto s = p.generic_u8string();
+	return std::string(s.begin(), s.end());
+}
+
+static bool Hidden(const fs::path& relative)
+{
+	for (const auto& part : relative)
+	{
+		const auto s = part.native();
+		if (!s.empty() && s[0] == '.')
+			return true;
+	}
+	return false;
+}
+
+bool AssetPack::Build(const fs::path& srcDir, const fs::path& outPath, uint64_t sourceTag, AssetPackBuildReport* report, bool compress)
+{
+	const auto t0 = std::chrono::steady_clock::now();
+
+	AssetPackBuildReport local;
+	AssetPackBuildReport& r = report ? *report : local;
+	r = {};
+
+	struct Source
+	{
+		fs::path File;
+		std::string Name;
+		uint64_t Hash;
+	};
+
+	std::vector<Source> sources;
+	std::error_code ec;
+	for (fs::recursive_directory_iterator it(srcDir, ec), endIt; !ec && it != endIt; it.increment(ec))
+	{
+		const fs::path rel = it->path().lexically_relative(srcDir);
+		if (Hidden(rel))
+		{
+			if (it->is_directory(ec))
+				it.disable_recursion_pending();
+			continue;
+		}
+
+		if (!it->is_regular_file(ec))
+			continue;
+
+		std::string name = Normalize(Utf8(rel));
+		if (name.size() > 0xFFFF)
+		{
+			r.Errors.push_back("path too long: " + name);
+			continue;
+		}
+
+		const uint64_t hash = PathHash(name);
+		sources.push_back({ it->path(), std::move(name), hash });
+	}
+
+	if (ec)
+	{
+		r.Errors.push_back("cannot list " + Utf8(srcDir));
+		return false;
+	}
+
+	std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b)
+		{
+			return a.Hash != b.Hash ? a.Hash < b.Hash : a.Name < b.Name;
+		});
+
+	for (size_t i = 1; i < sources.size(); ++i)
+	{
+		if (sources[i].Name == sources[i - 1].Name)
+			r.Errors.push_back("duplicate path (case): " + sources[i].Name);
+	}
+	sources.erase(std::unique(sources.begin(), sources.end(),
+		[](const Source& a, const Source& b) { return a.Name == b.Name; }), sources.end());
+
+	fs::path tmp = outPath;
+	tmp += ".tmp";
+
+	std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+	if (!out)
+	{
+		r.Errors.push_back("cannot create " + Utf8(tmp));
+		return false;
+	}
+
+	uint64_t pos = 0;
+	auto write = [&](const void* data, size_t bytes)
+	{
+		out.write((const char*)data, (std::streamsize)bytes);
+		pos += bytes;
+	};
+	auto pad = [&](uint64_t align)
+	{
+		static const char zeros[kAlign] = {};
+		const uint64_t rem = pos % align;
+		if (rem)
+			write(zeros, (size_t)(align - rem));
+	};
+
+	PackHeader h{};
+	write(&h, sizeof(h));   // placeholder, rewritten once the index is known
+
+	std::vector<PackEntry> index;
+	std::string names;
+	index.reserve(sources.size());
+
+	std::vector<uint8_t> raw;
+	std::vector<uint8_t> packed;
+
+	for (const Source& s : sources)
+	{
+		if (!ReadWhole(s.File, raw))
+		{
+			r.Errors.push_back("cannot read " + s.Name);
+			continue;
+		}
+
+		PackEntry e{};
+		e.PathHash = s.Hash;
+		e.Size = raw.size();
+		e.Checksum = HashService::Fast64(raw.data(), raw.size());
+		e.NameOffset = (uint32_t)names.size();
+		e.NameLength = (uint16_t)s.Name.size();
+		e.Codec = Store;
+
+		const uint8_t* body = raw.data();
+		size_t bodySize = raw.size();
+
+		if (compress && raw.size() >= 256 && raw.size() <= 0xFFFFFFFFu)
+		{
+			Lz4Compress(raw.data(), raw.size(), packed);
+			if (packed.size() <= raw.size() - (raw.size() >> kMinSavingShift))
+			{
+				e.Codec = Lz4;
+				body = packed.data();
+				bodySize = packed.size();
+				++r.Compressed;
+			}
+		}
+
+		pad(kAlign);
+		e.Offset = pos;
+		e.Stored = bodySize;
+		write(body, bodySize);
+
+		names += s.Name;
+		index.push_back(e);
+
+		++r.Files;
+		r.BytesIn += raw.size();
+	}
+
+	pad(kAlign);
+
+	const uint64_t indexOffset = pos;
+	std::string indexBytes((const char*)index.data(), index.size() * sizeof(PackEntry));
+	indexBytes += names;
+	write(indexBytes.data(), indexBytes.size());
+
+	memcpy(h.Magic, kMagic, sizeof(kMagic));
+	h.Format = kFormat;
+	h.HeaderSize = (uint16_t)sizeof(PackHeader);
+	h.EntryCount = (uint32_t)index.size();
+	h.IndexOffset = indexOffset;
+	h.IndexSize = indexBytes.size();
+	h.IndexHash = HashService::Fast64(indexBytes.data(), indexBytes.size());
+	h.SourceTag = sourceTag;
+
+	out.seekp(0);
+	out.write((const char*)&h, sizeof(h));
+	out.close();
+
+	r.BytesOut = pos;
+	r.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	if (!out)
+	{
+		fs::remove(tmp, ec);
+		r.Errors.push_back("write failed");
+		return false;
+	}
+
+	fs::rename(tmp, outPath, ec);
+	if (ec)
+	{
+		fs::remove(tmp, ec);
+		r.Errors.push_back("cannot replace " + Utf8(outPath));
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Single-file asset pack (assets.hvkpack), memory mapped and read in place.
+//
+// Layout, all little-endian:
+//   header  "HVKPACK\0", u16 format, u16 header size, u32 entry count,
+//           u64 index offset, u64 index size, u64 XXH64 of the index,
+//           u64 source tag, 16 reserved bytes (64 total)
+//   data    one blob per file, each starting on a kAlign boundary
+//   index   PackEntry[count] sorted by path hash, then the path strings
+//
+// Paths are stored normalized (lower case, '/' separated, relative to the
+// packed folder) and looked up by their XXH64 with a binary search. Each
+// entry is either stored as is, which reads as a span straight into the
+// mapping, or LZ4 block compressed when that saves enough to be worth it,
+// which is decompressed once and kept. Every entry carries the XXH64 of its
+// original bytes, checked the first time it is read.
+
+// Bytes of one asset. Hold keeps whatever backs Data alive (the pack mapping,
+// a decompressed buffer, or a loose file read), so the span stays valid for as
+// long as the AssetData or a copy of it exists, even across an unmount.
+struct AssetData
+{
+	const uint8_t* Data = nullptr;
+	size_t Size = 0;
+	std::shared_ptr<const void> Hold;
+
+	explicit operator bool() const { return Hold != nullptr; }
+};
+
+struct PackEntry
+{
+	uint64_t PathHash;
+	uint64_t Offset;        // from the start of the file
+	uint64_t Stored;        // bytes in the pack
+	uint64_t Size;          // bytes once decoded
+	uint64_t Checksum;      // XXH64 of the decoded bytes
+	uint32_t NameOffset;    // into the path strings after the entries
+	uint16_t NameLength;
+	uint8_t Codec;
+	uint8_t Reserved;
+};
+
+static_assert(sizeof(PackEntry) == 48, "PackEntry is read in place");
+
+struct AssetPackBuildReport
+{
+	uint64_t Files = 0;
+	uint64_t Compressed = 0;
+	uint64_t BytesIn = 0;
+	uint64_t BytesOut = 0;
+	double Seconds = 0.0;
+	std::vector<std::string> Errors;
+};
+
+class AssetPack : public std::enable_shared_from_this<AssetPack>
+{
+public:
+	static constexpr uint16_t kFormat = 1;
+	static constexpr uint64_t kAlign = 64;
+	static constexpr const char* kExtension = ".hvkpack";
+
+	enum Codec : uint8_t
+	{
+		Store = 0,
+		Lz4 = 1
+	};
+
+	~AssetPack();
+
+	// Maps the file and validates the header and index; entries are checked as they are read
+	static std::shared_ptr<AssetPack> Open(const std::filesystem::path& path, std::string* error = nullptr);
+
+	// Same over a pack already in memory (embedded in the binary); data must stay valid and 8-byte aligned
+	static std::shared_ptr<AssetPack> OpenMemory(const void* data, size_t size, std::string* error = nullptr);
+
+	// Packs every file under srcDir (dot files and folders skipped) into outPath via a temp file + rename.
+	// sourceTag is stored as is, for telling whether the pack is current.
+	static bool Build(
+		const std::filesystem::path& srcDir,
+		const std::filesystem::path& outPath,
+		uint64_t sourceTag,
+		AssetPackBuildReport* report = nullptr,
+		bool compress = true);
+
+	// "Fonts\\Satoshi\\A.otf" -> "fonts/satoshi/a.otf"
+	static std::string Normalize(std::string_view path);
+	static uint64_t PathHash(std::string_view normalized);
+
+	const PackEntry* Find(std::string_view path) const;   // any spelling Normalize accepts
+	std::string_view NameOf(const PackEntry& e) const;
+
+	// Stored entries are a span into the mapping, compressed ones are decoded on first use.
+	// Fails on a checksum mismatch (and keeps failing for that entry).
+	bool Read(const PackEntry& e, AssetData& out, std::string* error = nullptr);
+	bool Read(std::string_view path, AssetData& out, std::string* error = nullptr);
+
+	// Checks every entry's checksum now instead of on first read
+	bool VerifyAll(std::string* error = nullptr);
+
+	const PackEntry* begin() const { return entries; }
+	const PackEntry* end() const { return entries + count; }
+	size_t Count() const { return count; }
+	uint64_t SourceTag() const { return sourceTag; }
+	const std::filesystem::path& Path() const { return path; }
+
+	// Exposed for the packer tool
+	static void Lz4Compress(const uint8_t* src, size_t size, std::vector<uint8_t>& out);
+	static bool Lz4Decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize);
+
+private:
+	AssetPack() = default;
+	AssetPack(const AssetPack&) = delete;
+	AssetPack& operator=(const AssetPack&) = delete;
+
+	enum : uint8_t { Unchecked = 0, Good = 1, Bad = 2 };
+
+	static std::shared_ptr<AssetPack> Attach(std::shared_ptr<AssetPack> pack, std::string* error);
+	bool Check(size_t index, const uint8_t* data, size_t size, std::string* error);
+
+	std::filesystem::path path;
+	const uint8_t* base = nullptr;
+	size_t size = 0;
+	bool mapped = false;
+
+	const PackEntry* entries = nullptr;
+	const char* names = nullptr;
+	size_t count = 0;
+	uint64_t sourceTag = 0;
+
+	std::unique_ptr<std::atomic<uint8_t>[]> state;
+
+	std::mutex cacheMutex;
+	std::vector<std::shared_ptr<const std::vector<uint8_t>>> decoded;
+};
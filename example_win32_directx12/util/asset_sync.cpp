@@ -0,0 +1,710 @@
+#include "asset_sync.h"
+#include "hash.h"
+#include "hvk_schema.h"
+#include "write_behind.h"
+
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cctype>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+// ------------------------------------------------------------
+// Manifest
+// ------------------------------------------------------------
+
+const AssetEntry* AssetManifest::Find(std::string_view path) const
+{
+	auto it = std::lower_bound(Files.begin(), Files.end(), path,
+		[](const AssetEntry& e, std::string_view p) { return e.Path < p; });
+	return (it != Files.end() && it->Path == path) ? &*it : nullptr;
+}
+
+static bool IsHexSha(std::string_view s)
+{
+	if (s.size() != 40)
+		return false;
+	for (char c : s)
+	{
+		if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f')))
+			return false;
+	}
+	return true;
+}
+
+// Listing paths end up joined onto the local root; refuse anything that could leave it
+static bool IsSafeRelative(std::string_view p)
+{
+	if (p.empty() || p.front() == '/' || p.find('\\') != std::string_view::npos || p.find(':') != std::string_view::npos)
+		return false;
+
+	size_t start = 0;
+	while (start <= p.size())
+	{
+		size_t end = p.find('/', start);
+		if (end == std::string_view::npos)
+			end = p.size();
+
+		std::string_view seg = p.substr(start, end - start);
+		if (seg.empty() || seg == "." || seg == "..")
+			return false;
+
+		start = end + 1;
+	}
+	return true;
+}
+
+bool AssetManifest::Parse(std::string_view text, std::string* error)
+{
+	ETag.clear();
+	Tree.clear();
+	Files.clear();
+
+	size_t lineNo = 0;
+	size_t pos = 0;
+	while (pos < text.size())
+	{
+		size_t end = text.find('\n', pos);
+		if (end == std::string_view::npos)
+			end = text.size();
+
+		std::string_view line = text.substr(pos, end - pos);
+		pos = end + 1;
+		++lineNo;
+
+		if (!line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+		if (line.empty())
+			continue;
+
+		auto fail = [&](const char* what) {
+			if (error)
+				*error = "line " + std::to_string(lineNo) + ": " + what;
+			Files.clear();
+			return false;
+		};
+
+		if (line.rfind("etag ", 0) == 0)
+		{
+			ETag = std::string(line.substr(5));
+			continue;
+		}
+		if (line.rfind("tree ", 0) == 0)
+		{
+			Tree = std::string(line.substr(5));
+			continue;
+		}
+
+		// <sha> <size> <path>; the path runs to the end of the line and may hold spaces
+		const size_t s1 = line.find(' ');
+		const size_t s2 = s1 == std::string_view::npos ? s1 : line.find(' ', s1 + 1);
+		if (s2 == std::string_view::npos)
+			return fail("expected <sha> <size> <path>");
+
+		AssetEntry e;
+		e.Sha = std::string(line.substr(0, s1));
+		e.Path = std::string(line.substr(s2 + 1));
+
+		std::string_view size = line.substr(s1 + 1, s2 - s1 - 1);
+		if (std::from_chars(size.data(), size.data() + size.size(), e.Size).ec != std::errc())
+			return fail("bad size");
+		if (!IsHexSha(e.Sha))
+			return fail("bad sha");
+		if (!IsSafeRelative(e.Path))
+			return fail("bad path");
+
+		Files.push_back(std::move(e));
+	}
+
+	std::sort(Files.begin(), Files.end(), [](const AssetEntry& a, const AssetEntry& b) { return a.Path < b.Path; });
+	return true;
+}
+
+std::string AssetManifest::Serialize() const
+{
+	std::string out;
+	out.reserve(64 + Files.size() * 96);
+
+	if (!ETag.empty())
+		out += "etag " + ETag + "\n";
+	if (!Tree.empty())
+		out += "tree " + Tree + "\n";
+
+	for (const auto& e : Files)
+	{
+		out += e.Sha;
+		out += ' ';
+		out += std::to_string(e.Size);
+		out += ' ';
+		out += e.Path;
+		out += '\n';
+	}
+	return out;
+}
+
+// A trees listing: { "sha", "tree": [ nodes ], "truncated" }, or
+// { "message" } for rate limits and bad refs. Everything else is skipped,
+// and a value of the wrong type leaves the field empty instead of throwing.
+struct GithubTree
+{
+	std::string sha;
+	std::string message;
+	bool truncated = false;
+};
+
+struct GithubTreeNode
+{
+	std::string path;
+	std::string mode;
+	std::string type;
+	std::string sha;
+	uint64_t size = 0;
+};
+
+static constexpr HvkField kGithubTree[] =
+{
+	HVK_FIELD(GithubTree, sha),
+	HVK_FIELD(GithubTree, message),
+	HVK_FIELD(GithubTree, truncated),
+};
+
+static constexpr HvkField kGithubTreeNode[] =
+{
+	HVK_FIELD(GithubTreeNode, path),
+	HVK_FIELD(GithubTreeNode, mode),
+	HVK_FIELD(GithubTreeNode, type),
+	HVK_FIELD(GithubTreeNode, sha),
+	HVK_FIELD(GithubTreeNode, size),
+};
+
+bool AssetSync::ParseGithubTree(std::string_view text, std::string_view prefix, AssetManifest& out, std::string* error)
+{
+	// nodes are filtered as they are parsed, so a listing of the whole repo
+	// never sits in memory
+	struct Ctx
+	{
+		GithubTreeNode Node;
+		std::string_view Prefix;
+		std::vector<AssetEntry> Files;
+	} ctx{ {}, prefix, {} };
+
+	auto onNode = [](void* p)
+	{
+		Ctx& c = *(Ctx*)p;
+		GithubTreeNode node = std::move(c.Node);
+		c.Node = GithubTreeNode();
+
+		// symlinks are blobs too, but their content is the link target
+		if (node.type != "blob" || node.mode == "120000")
+			return;
+
+		if (node.path.size() <= c.Prefix.size() || node.path.compare(0, c.Prefix.size(), c.Prefix) != 0)
+			return;
+
+		AssetEntry e;
+		e.Path = node.path.substr(c.Prefix.size());
+		e.Sha = std::move(node.sha);
+		e.Size = node.size;
+
+		if (!IsHexSha(e.Sha) || !IsSafeRelative(e.Path))
+			return;
+
+		c.Files.push_back(std::move(e));
+	};
+
+	GithubTree doc;
+	std::string parseError;
+	if (!HvkSchema::ReadEachAt(text, &doc, kGithubTree, HvkCount(kGithubTree), "tree",
+		&ctx.Node, kGithubTreeNode, HvkCount(kGithubTreeNode), onNode, &ctx, &parseError))
+	{
+		// rate limits and bad refs come back as {"message": ...}
+		if (error)
+			*error = doc.message.empty() ? "listing has no tree: " + parseError : doc.message;
+		return false;
+	}
+
+	if (doc.sha.empty())
+	{
+		if (error)
+			*error = "listing has no tree sha";
+		return false;
+	}
+
+	// the API caps recursive listings; a partial one would look like deletions
+	if (doc.truncated)
+	{
+		if (error)
+			*error = "listing truncated";
+		return false;
+	}
+
+	out.Tree = std::move(doc.sha);
+	out.Files = std::move(ctx.Files);
+	std::sort(out.Files.begin(), out.Files.end(), [](const AssetEntry& a, const AssetEntry& b) { return a.Path < b.Path; });
+	return true;
+}
+
+// ------------------------------------------------------------
+// Hashing / diff
+// ------------------------------------------------------------
+
+static std::string BlobHeader(uint64_t size)
+{
+	return "blob " + std::to_string(size) + std::string(1, '\0');
+}
+
+std::string AssetSync::GitBlobSha(const void* data, size_t size)
+{
+	Sha1 h;
+	const std::string header = BlobHeader(size);
+	h.Update(header.data(), header.size());
+	h.Update(data, size);
+	return h.Final().Hex();
+}
+
+std::string AssetSync::GitBlobSha(const fs::path& file)
+{
+	FileDigest d;
+	return HashService::HashFile(file, HashKind::GitBlob, d) ? d.Blob.Hex() : std::string();
+}
+
+// one verify pass: every file hashed concurrently, "" where unreadable
+static std::vector<std::string> GitBlobShas(const std::vector<fs::path>& files)
+{
+	std::vector<std::string> out;
+	out.reserve(files.size());
+	for (const FileDigest& d : HashService::HashFiles(files, HashKind::GitBlob))
+		out.push_back(d.Ok ? d.Blob.Hex() : std::string());
+	return out;
+}
+
+static fs::path LocalPath(const fs::path& root, const std::string& rel)
+{
+	return root / fs::path(std::u8string(rel.begin(), rel.end()));
+}
+
+AssetSyncPlan AssetSync::Diff(const AssetManifest& local, const AssetManifest& remote, const fs::path& root)
+{
+	AssetSyncPlan plan;
+
+	// files without a manifest entry are hashed together after the walk
+	std::vector<const AssetEntry*> unknown;
+	std::vector<fs::path> unknownFiles;
+
+	for (const auto& r : remote.Files)
+	{
+		std::error_code ec;
+		const fs::path file = LocalPath(root, r.Path);
+		const uint64_t size = fs::file_size(file, ec);
+		const bool present = !ec && size == r.Size;
+
+		const AssetEntry* l = local.Find(r.Path);
+
+		if (present && !l)
+		{
+			// left by an older, manifest-less download
+			unknown.push_back(&r);
+			unknownFiles.push_back(file);
+			continue;
+		}
+
+		const bool keep = present && l->Sha == r.Sha;
+		(keep ? plan.Keep : plan.Fetch).push_back(r);
+	}
+
+	const std::vector<std::string> shas = GitBlobShas(unknownFiles);
+	for (size_t i = 0; i < unknown.size(); ++i)
+		(shas[i] == unknown[i]->Sha ? plan.Keep : plan.Fetch).push_back(*unknown[i]);
+
+	// keep remote order, the rest of the sync walks these lists in order
+	auto byPath = [](const AssetEntry& x, const AssetEntry& y) { return x.Path < y.Path; };
+	if (!unknown.empty())
+	{
+		std::sort(plan.Keep.begin(), plan.Keep.end(), byPath);
+		std::sort(plan.Fetch.begin(), plan.Fetch.end(), byPath);
+	}
+
+	for (const auto& l : local.Files)
+	{
+		if (!remote.Find(l.Path))
+			plan.Remove.push_back(l.Path);
+	}
+
+	return plan;
+}
+
+// ------------------------------------------------------------
+// Sync
+// ------------------------------------------------------------
+
+namespace
+{
+	struct ListResponse
+	{
+		long Http = 0;
+		std::string Body;
+		std::string ETag;
+		std::string Error;
+	};
+
+	size_t AppendBody(char* ptr, size_t size, size_t nmemb, void* userdata)
+	{
+		static_cast<ListResponse*>(userdata)->Body.append(ptr, size * nmemb);
+		return size * nmemb;
+	}
+
+	bool StartsWithNoCase(std::string_view s, std::string_view prefix)
+	{
+		if (s.size() < prefix.size())
+			return false;
+		for (size_t i = 0; i < prefix.size(); ++i)
+		{
+			if (std::tolower((unsigned char)s[i]) != prefix[i])
+				return false;
+		}
+		return true;
+	}
+
+	size_t ReadHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
+	{
+		const size_t n = size * nmemb;
+		std::string_view line(ptr, n);
+
+		// header names are case-insensitive, h2 sends them lower case
+		if (StartsWithNoCase(line, "etag:"))
+		{
+			line.remove_prefix(5);
+			while (!line.empty() && (line.front() == ' ' || line.front() == '\t'))
+				line.remove_prefix(1);
+			while (!line.empty() && (line.back() == '\r' || line.back() == '\n' || line.back() == ' '))
+				line.remove_suffix(1);
+			static_cast<ListResponse*>(userdata)->ETag = std::string(line);
+		}
+		return n;
+	}
+}
+
+static bool FetchListing(const AssetSyncConfig& cfg, const std::string& etag, ListResponse& out)
+{
+	CURL* curl = DownloadManager::NewEasy(cfg.TreeUrl);
+	if (!curl)
+	{
+		out.Error = "curl_easy_init failed";
+		return false;
+	}
+
+	curl_slist* headers = curl_slist_append(nullptr, "Accept: application/vnd.github+json");
+	if (!etag.empty())
+		headers = curl_slist_append(headers, ("If-None-Match: " + etag).c_str());
+
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, AppendBody);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &out);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ReadHeader);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &out);
+	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, cfg.ListTimeoutSec);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, cfg.ListTimeoutSec * 3);
+
+	const CURLcode res = curl_easy_perform(curl);
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &out.Http);
+
+	curl_easy_cleanup(curl);
+	curl_slist_free_all(headers);
+
+	if (res != CURLE_OK)
+	{
+		out.Error = curl_easy_strerror(res);
+		return false;
+	}
+	return true;
+}
+
+static std::string UrlPath(std::string_view path)
+{
+	static const char* digits = "0123456789ABCDEF";
+
+	std::string out;
+	out.reserve(path.size());
+	for (unsigned char c : path)
+	{
+		const bool plain = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+			c == '-' || c == '_' || c == '.' || c == '~' || c == '/';
+		if (plain)
+		{
+			out += (char)c;
+		}
+		else
+		{
+			out += '%';
+			out += digits[c >> 4];
+			out += digits[c & 15];
+		}
+	}
+	return out;
+}
+
+static fs::path Sibling(const fs::path& root, const char* suffix)
+{
+	fs::path p = root;
+	p += suffix;
+	return p;
+}
+
+// Unchanged files move into the staging tree as hard links, so an update
+// costs no copies on NTFS/ext4; FAT and cross-volume roots fall back to copying
+static bool Carry(const fs::path& from, const fs::path& to)
+{
+	std::error_code ec;
+	fs::create_directories(to.parent_path(), ec);
+	fs::remove(to, ec);
+
+	fs::create_hard_link(from, to, ec);
+	if (!ec)
+		return true;
+
+	ec.clear();
+	fs::copy_file(from, to, fs::copy_options::overwrite_existing, ec);
+	return !ec;
+}
+
+// Staging survives a failed sync so its downloads can resume; drop whatever
+// the current plan doesn't want (older versions' files, finished .part leftovers)
+static void PruneStaging(const fs::path& staging, const AssetManifest& remote, const AssetSyncPlan& plan)
+{
+	std::vector<std::string> partial;
+	for (const auto& e : plan.Fetch)
+	{
+		partial.push_back(e.Path + ".part");
+		partial.push_back(e.Path + ".part.state");
+	}
+	std::sort(partial.begin(), partial.end());
+
+	std::error_code ec;
+	std::vector<fs::path> stray;
+	for (fs::recursive_directory_iterator it(staging, ec), end; !ec && it != end; it.increment(ec))
+	{
+		if (!it->is_regular_file(ec))
+			continue;
+
+		const std::u8string u8 = it->path().lexically_relative(staging).generic_u8string();
+		const std::string rel(u8.begin(), u8.end());
+
+		if (!remote.Find(rel) && !std::binary_search(partial.begin(), partial.end(), rel))
+			stray.push_back(it->path());
+	}
+
+	for (const auto& p : stray)
+		fs::remove(p, ec);
+}
+
+static bool SwapIn(const fs::path& staging, const fs::path& root, std::string& error)
+{
+	std::error_code ec;
+	const fs::path old = Sibling(root, ".old");
+	fs::remove_all(old, ec);
+
+	const bool hadRoot = fs::exists(root, ec);
+	if (hadRoot)
+	{
+		fs::rename(root, old, ec);
+		if (ec)
+		{
+			error = "cannot move current assets aside: " + ec.message();
+			return false;
+		}
+	}
+
+	fs::rename(staging, root, ec);
+	if (ec)
+	{
+		error = "cannot move new assets in: " + ec.message();
+
+		std::error_code back;
+		if (hadRoot)
+			fs::rename(old, root, back);
+		return false;
+	}
+
+	fs::remove_all(old, ec);
+	return true;
+}
+
+bool AssetSync::Sync(const AssetSyncConfig& cfg, AssetSyncReport& report)
+{
+	const auto t0 = std::chrono::steady_clock::now();
+	auto done = [&](bool ok) {
+		report.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+		return ok;
+	};
+
+	// Local manifest; without one (or without the folder) the listing is fetched unconditionally
+	const fs::path manifestPath = cfg.Root / kManifestFile;
+
+	AssetManifest local;
+	{
+		std::ifstream in(manifestPath, std::ios::binary);
+		if (in)
+		{
+			std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+			std::string error;
+			if (!local.Parse(text, &error))
+			{
+				report.Errors.push_back("manifest " + error);
+				local = AssetManifest{};
+			}
+		}
+	}
+
+	// A 304 only proves upstream didn't change; a cheap stat pass makes sure the
+	// local copy still matches its manifest before the etag is offered
+	bool intact = !local.Files.empty();
+	for (const auto& e : local.Files)
+	{
+		std::error_code ec;
+		if (!intact || fs::file_size(LocalPath(cfg.Root, e.Path), ec) != e.Size || ec)
+		{
+			intact = false;
+			break;
+		}
+	}
+
+	ListResponse list;
+	if (!FetchListing(cfg, intact ? local.ETag : std::string(), list))
+	{
+		report.Errors.push_back("listing: " + list.Error);
+		return done(false);
+	}
+
+	if (list.Http == 304)
+	{
+		report.NotModified = true;
+		report.Files = report.Kept = local.Files.size();
+		return done(true);
+	}
+
+	if (list.Http >= 400)
+	{
+		report.Errors.push_back("listing: http " + std::to_string(list.Http));
+		return done(false);
+	}
+
+	AssetManifest remote;
+	{
+		std::string error;
+		if (!ParseGithubTree(list.Body, cfg.Prefix, remote, &error))
+		{
+			report.Errors.push_back("listing: " + error);
+			return done(false);
+		}
+	}
+	remote.ETag = list.ETag;
+
+	AssetSyncPlan plan = Diff(local, remote, cfg.Root);
+	report.Files = remote.Files.size();
+	report.Kept = plan.Keep.size();
+	report.Removed = plan.Remove.size();
+
+	// Nothing to download: only the etag/tree moved (another part of the repo changed).
+	// Files adopted without a manifest still go through staging so strays are dropped.
+	const bool adopted = local.Files.size() != plan.Keep.size();
+	if (plan.Fetch.empty() && plan.Remove.empty() && !adopted)
+	{
+		std::string error;
+		if (!WriteBehind::WriteAtomic(manifestPath, remote.Serialize(), &error))
+			report.Errors.push_back("manifest: " + error);
+		return done(true);
+	}
+
+	// Assemble the new tree next to the live one
+	const fs::path staging = Sibling(cfg.Root, ".staging");
+	std::error_code ec;
+	fs::create_directories(staging, ec);
+	if (ec)
+	{
+		report.Errors.push_back("cannot create " + staging.string() + ": " + ec.message());
+		return done(false);
+	}
+
+	PruneStaging(staging, remote, plan);
+
+	// the live folder is never touched on failure; staging stays for the next try
+	auto abandon = [&](std::string why) {
+		report.Errors.push_back(std::move(why));
+		return done(false);
+	};
+
+	for (const auto& e : plan.Keep)
+	{
+		if (!Carry(LocalPath(cfg.Root, e.Path), LocalPath(staging, e.Path)))
+			return abandon("cannot carry " + e.Path);
+	}
+
+	// finished by an earlier, interrupted sync
+	std::vector<const AssetEntry*> fetch;
+	{
+		std::vector<fs::path> staged;
+		for (const auto& e : plan.Fetch)
+			staged.push_back(LocalPath(staging, e.Path));
+
+		const std::vector<std::string> shas = GitBlobShas(staged);
+		for (size_t i = 0; i < plan.Fetch.size(); ++i)
+		{
+			if (shas[i] != plan.Fetch[i].Sha)
+				fetch.push_back(&plan.Fetch[i]);
+		}
+	}
+	report.Fetched = plan.Fetch.size();
+
+	if (!fetch.empty())
+	{
+		DownloadManager dl(cfg.Download);
+		if (cfg.Progress)
+			dl.SetProgressCallback(cfg.Progress, 250);
+		for (const AssetEntry* e : fetch)
+			dl.Add({ cfg.RawBase + UrlPath(cfg.Prefix) + UrlPath(e->Path), LocalPath(staging, e->Path), e->Size });
+
+		std::vector<DownloadResult> results;
+		dl.Run(&results);
+
+		std::vector<fs::path> downloaded;
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			if (!results[i].Ok)
+				return abandon("download " + fetch[i]->Path + ": " + results[i].Error);
+			downloaded.push_back(results[i].Path);
+		}
+
+		const std::vector<std::string> shas = GitBlobShas(downloaded);
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const auto& r = results[i];
+			const AssetEntry& e = *fetch[i];
+
+			// a ref that moved between listing and download fails here too
+			if (shas[i] != e.Sha)
+			{
+				fs::remove(r.Path, ec);
+				return abandon("hash mismatch " + e.Path);
+			}
+
+			report.BytesFetched += r.Bytes - r.BytesResumed;
+			report.BytesResumed += r.BytesResumed;
+		}
+	}
+
+	{
+		std::string error;
+		if (!WriteBehind::WriteAtomic(staging / kManifestFile, remote.Serialize(), &error))
+			return abandon("manifest: " + error);
+		fs::remove(WriteBehind::BackupPath(staging / kManifestFile), ec);
+	}
+
+	std::string error;
+	if (!SwapIn(staging, cfg.Root, error))
+		return abandon(error);
+
+	report.Swapped = true;
+	return done(true);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "download_manager.h"
+
+// Incremental asset sync against a git tree listing.
+// One recursive tree request (conditional on the ETag of the last one) gives
+// every file's size and git blob SHA; that is compared with the manifest kept
+// in the asset folder and only missing or changed files are downloaded. The
+// new tree is assembled in a staging folder next to the live one (unchanged
+// files are hard linked across), every fetched file is checked against its
+// blob SHA, and the staging folder is swapped in with two renames, so a
+// failed or interrupted sync leaves the current assets untouched, and keeps
+// the staging folder so the next sync resumes its downloads.
+
+struct AssetEntry
+{
+	std::string Path;     // relative to the synced folder, '/' separated
+	std::string Sha;      // git blob SHA-1, lower case hex
+	uint64_t Size = 0;
+};
+
+struct AssetManifest
+{
+	std::string ETag;     // of the listing this came from
+	std::string Tree;     // root tree SHA of that listing
+	std::vector<AssetEntry> Files;   // sorted by Path
+
+	const AssetEntry* Find(std::string_view path) const;
+
+	// "etag <value>" / "tree <sha>" header lines, then "<sha> <size> <path>" per file
+	bool Parse(std::string_view text, std::string* error = nullptr);
+	std::string Serialize() const;
+};
+
+struct AssetSyncConfig
+{
+	std::string TreeUrl;            // .../git/trees/<ref>?recursive=1
+	std::string RawBase;            // file url = RawBase + Prefix + Path
+	std::string Prefix;             // subtree of the listing to sync, e.g. "assets/"
+	std::filesystem::path Root;     // live asset folder
+	long ListTimeoutSec = 10;
+	DownloadOptions Download;
+	std::function<void(const DownloadProgress&)> Progress;   // while files download, from the sync's thread
+};
+
+struct AssetSyncPlan
+{
+	std::vector<AssetEntry> Keep;
+	std::vector<AssetEntry> Fetch;
+	std::vector<std::string> Remove;   // in the local manifest, gone upstream
+};
+
+struct AssetSyncReport
+{
+	bool NotModified = false;       // listing answered 304, nothing else was done
+	bool Swapped = false;           // a new tree replaced the live folder
+
+	uint64_t Files = 0;
+	uint64_t Kept = 0;
+	uint64_t Fetched = 0;
+	uint64_t Removed = 0;
+	uint64_t BytesFetched = 0;
+	uint64_t BytesResumed = 0;      // picked up from an interrupted sync
+
+	double Seconds = 0.0;
+	std::vector<std::string> Errors;
+};
+
+class AssetSync
+{
+public:
+	static constexpr const char* kManifestFile = ".pshvk-manifest";
+
+	static bool Sync(const AssetSyncConfig& config, AssetSyncReport& report);
+
+	// Blobs under prefix from a GitHub git/trees response, prefix stripped
+	static bool ParseGithubTree(std::string_view json, std::string_view prefix, AssetManifest& out, std::string* error = nullptr);
+
+	// Files already in root count as kept when the manifest says they match
+	// and the size agrees, or (no manifest entry yet) when their blob SHA does
+	static AssetSyncPlan Diff(const AssetManifest& local, const AssetManifest& remote, const std::filesystem::path& root);
+
+	// SHA-1 of "blob <size>\0" + content, i.e. what git stores as the file's id
+	static std::string GitBlobSha(const void* data, size_t size);
+	static std::string GitBlobSha(const std::filesystem::path& file);   // empty if unreadable
+};
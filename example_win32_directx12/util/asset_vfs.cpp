@@ -0,0 +1,186 @@
+#include "asset_vfs.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static std::mutex g_vfsMutex;
+static std::shared_ptr<AssetPack> g_vfsPack;
+static std::shared_ptr<AssetPack> g_vfsFallback;
+static fs::path g_vfsRoot;
+static std::string g_vfsRootKey;   // normalized, with a trailing '/'
+
+static std::atomic<uint64_t> g_vfsPackReads{ 0 };
+static std::atomic<uint64_t> g_vfsDiskReads{ 0 };
+static std::atomic<uint64_t> g_vfsFallbackReads{ 0 };
+static std::atomic<uint64_t> g_vfsMissing{ 0 };
+
+static std::string Utf8(const fs::path& p)
+{
+	const auto s = p.generic_u8string();
+	return std::string(s.begin(), s.end());
+}
+
+static void SetRootLocked(const fs::path& root)
+{
+	g_vfsRoot = root.lexically_normal();
+	g_vfsRootKey = AssetPack::Normalize(Utf8(g_vfsRoot));
+	if (!g_vfsRootKey.empty() && g_vfsRootKey.back() != '/')
+		g_vfsRootKey.push_back('/');
+}
+
+void AssetVfs::SetRoot(const fs::path& root)
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	SetRootLocked(root);
+}
+
+fs::path AssetVfs::Root()
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	return g_vfsRoot;
+}
+
+bool AssetVfs::Mount(const fs::path& packPath, const fs::path& root, std::string* error)
+{
+	auto pack = AssetPack::Open(packPath, error);
+	if (!pack)
+		return false;
+
+	Mount(std::move(pack), root);
+	return true;
+}
+
+void AssetVfs::Mount(std::shared_ptr<AssetPack> pack, const fs::path& root)
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	g_vfsPack = std::move(pack);
+	SetRootLocked(root);
+}
+
+void AssetVfs::Unmount()
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	g_vfsPack.reset();
+}
+
+void AssetVfs::MountFallback(std::shared_ptr<AssetPack> pack)
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	g_vfsFallback = std::move(pack);
+}
+
+std::shared_ptr<AssetPack> AssetVfs::Pack()
+{
+	std::lock_guard<std::mutex> lock(g_vfsMutex);
+	return g_vfsPack;
+}
+
+AssetVfsStats AssetVfs::Stats()
+{
+	AssetVfsStats s;
+	s.Pack = g_vfsPackReads.load();
+	s.Disk = g_vfsDiskReads.load();
+	s.Fallback = g_vfsFallbackReads.load();
+	s.Missing = g_vfsMissing.load();
+	return s;
+}
+
+// A path as the layers see it: its key inside the packs (empty when it is
+// outside the root) and where it lives on disk
+struct Resolved
+{
+	std::shared_ptr<AssetPack> Pack;
+	std::shared_ptr<AssetPack> Fallback;
+	std::string Key;
+	fs::path Disk;
+};
+
+static Resolved Resolve(const fs::path& path)
+{
+	Resolved r;
+	std::string rootKey;
+	{
+		std::lock_guard<std::mutex> lock(g_vfsMutex);
+		r.Pack = g_vfsPack;
+		r.Fallback = g_vfsFallback;
+		rootKey = g_vfsRootKey;
+		r.Disk = path.is_relative() && !g_vfsRoot.empty() ? g_vfsRoot / path : path;
+	}
+
+	if (path.is_relative())
+	{
+		r.Key = AssetPack::Normalize(Utf8(path));
+		return r;
+	}
+
+	const std::string key = AssetPack::Normalize(Utf8(path.lexically_normal()));
+	if (!rootKey.empty() && key.compare(0, rootKey.size(), rootKey) == 0)
+		r.Key = key.substr(rootKey.size());
+
+	return r;
+}
+
+static bool ReadPack(AssetPack* pack, const std::string& key, AssetData& out)
+{
+	if (!pack || key.empty())
+		return false;
+
+	const PackEntry* e = pack->Find(key);
+	return e && pack->Read(*e, out);
+}
+
+bool AssetVfs::Exists(const fs::path& path)
+{
+	const Resolved r = Resolve(path);
+
+	if (r.Pack && !r.Key.empty() && r.Pack->Find(r.Key))
+		return true;
+
+	std::error_code ec;
+	if (fs::is_regular_file(r.Disk, ec))
+		return true;
+
+	return r.Fallback && !r.Key.empty() && r.Fallback->Find(r.Key);
+}
+
+bool AssetVfs::Read(const fs::path& path, AssetData& out)
+{
+	out = {};
+	const Resolved r = Resolve(path);
+
+	// a bad pack entry falls through to the loose file, which may still be fine
+	if (ReadPack(r.Pack.get(), r.Key, out))
+	{
+		++g_vfsPackReads;
+		return true;
+	}
+
+	std::ifstream in(r.Disk, std::ios::binary | std::ios::ate);
+	const std::streamoff size = in ? (std::streamoff)in.tellg() : -1;
+	if (size >= 0)
+	{
+		auto bytes = std::make_shared<std::vector<uint8_t>>((size_t)size);
+		in.seekg(0);
+		if (bytes->empty() || in.read((char*)bytes->data(), (std::streamsize)bytes->size()))
+		{
+			out.Data = bytes->data();
+			out.Size = bytes->size();
+			out.Hold = std::move(bytes);
+			++g_vfsDiskReads;
+			return true;
+		}
+	}
+
+	if (ReadPack(r.Fallback.get(), r.Key, out))
+	{
+		++g_vfsFallbackReads;
+		return true;
+	}
+
+	++g_vfsMissing;
+	return false;
+}
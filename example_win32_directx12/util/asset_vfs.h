@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "asset_pack.h"
+
+// Read-only view of the asset folder. Paths under the root (absolute, or
+// relative to it) are looked up in three layers:
+//   1. the mounted pack (assets.hvkpack, built after each sync)
+//   2. the loose file on disk
+//   3. the fallback pack (the minimal set embedded in the binary)
+// so full assets take over from the embedded ones as soon as they land.
+// Paths outside the root only ever come from disk. Callers keep using the
+// paths they always did.
+
+struct AssetVfsStats
+{
+	uint64_t Pack = 0;
+	uint64_t Disk = 0;
+	uint64_t Fallback = 0;
+	uint64_t Missing = 0;
+};
+
+class AssetVfs
+{
+public:
+	// The folder the packs mirror, e.g. %LOCALAPPDATA%\PSHVK\assets
+	static void SetRoot(const std::filesystem::path& root);
+	static std::filesystem::path Root();
+
+	static bool Mount(const std::filesystem::path& packPath, const std::filesystem::path& root, std::string* error = nullptr);
+	static void Mount(std::shared_ptr<AssetPack> pack, const std::filesystem::path& root);
+
+	// Outstanding AssetData keep the old mapping alive until they go
+	static void Unmount();
+
+	static void MountFallback(std::shared_ptr<AssetPack> pack);
+
+	static std::shared_ptr<AssetPack> Pack();
+
+	static bool Exists(const std::filesystem::path& path);
+
+	// Pack span when a pack has it, otherwise the whole file read into memory
+	static bool Read(const std::filesystem::path& path, AssetData& out);
+
+	// Where reads were served from since startup
+	static AssetVfsStats Stats();
+};
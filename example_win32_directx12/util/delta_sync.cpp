@@ -0,0 +1,569 @@
+#include "delta_sync.h"
+#include "hash.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+// ------------------------------------------------------------
+// Signatures
+// ------------------------------------------------------------
+
+struct FileSig
+{
+	uint64_t Size = 0;
+	int64_t Time = 0;              // fs::file_time_type ticks of the dst file
+	int64_t SrcTime = 0;           // and of the source it was synced from
+	std::vector<uint64_t> Blocks;  // XXH64 per block
+};
+
+using SigMap = std::unordered_map<std::string, FileSig>;
+
+// 2: weak checksums dropped from the block records, source mtime added
+static const char kSigMagic[8] = { 'H', 'V', 'K', 'S', 'Y', 'N', 'C', '2' };
+
+static std::string ToUtf8(const fs::path& p)
+{
+	auto u8 = p.generic_u8string();
+	return std::string(u8.begin(), u8.end());
+}
+
+static int64_t Ticks(fs::file_time_type t)
+{
+	return (int64_t)t.time_since_epoch().count();
+}
+
+// FAT keeps mtimes at 2 second resolution
+static bool SameTime(fs::file_time_type a, fs::file_time_type b)
+{
+	auto d = a > b ? a - b : b - a;
+	return d <= std::chrono::seconds(2);
+}
+
+template <typename T>
+static bool ReadPod(std::ifstream& f, T& v)
+{
+	return (bool)f.read((char*)&v, sizeof(T));
+}
+
+template <typename T>
+static void WritePod(std::ofstream& f, const T& v)
+{
+	f.write((const char*)&v, sizeof(T));
+}
+
+static SigMap LoadSignatures(const fs::path& file, uint32_t blockSize)
+{
+	SigMap map;
+	std::ifstream f(file, std::ios::binary);
+	if (!f)
+		return map;
+
+	char magic[8]{};
+	uint32_t bs = 0, count = 0;
+	if (!f.read(magic, 8) || memcmp(magic, kSigMagic, 8) != 0 ||
+		!ReadPod(f, bs) || bs != blockSize || !ReadPod(f, count))
+		return map;
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		uint16_t len = 0;
+		if (!ReadPod(f, len))
+			return {};
+
+		std::string rel(len, '\0');
+		FileSig sig;
+		uint32_t blocks = 0;
+
+		if (!f.read(rel.data(), len) || !ReadPod(f, sig.Size) || !ReadPod(f, sig.Time) ||
+			!ReadPod(f, sig.SrcTime) || !ReadPod(f, blocks))
+			return {};
+
+		// cheap sanity check against a corrupt count
+		if (blocks != (sig.Size + blockSize - 1) / blockSize)
+			return {};
+
+		sig.Blocks.resize(blocks);
+		if (blocks && !f.read((char*)sig.Blocks.data(), (std::streamsize)blocks * sizeof(uint64_t)))
+			return {};
+
+		map.emplace(std::move(rel), std::move(sig));
+	}
+
+	return map;
+}
+
+static void SaveSignatures(const fs::path& file, uint32_t blockSize, const SigMap& map)
+{
+	fs::path tmp = file;
+	tmp += ".tmp";
+
+	{
+		std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+		if (!f)
+			return;
+
+		f.write(kSigMagic, 8);
+		WritePod(f, blockSize);
+		WritePod(f, (uint32_t)map.size());
+
+		for (const auto& [rel, sig] : map)
+		{
+			WritePod(f, (uint16_t)rel.size());
+			f.write(rel.data(), (std::streamsize)rel.size());
+			WritePod(f, sig.Size);
+			WritePod(f, sig.Time);
+			WritePod(f, sig.SrcTime);
+			WritePod(f, (uint32_t)sig.Blocks.size());
+			f.write((const char*)sig.Blocks.data(), (std::streamsize)(sig.Blocks.size() * sizeof(uint64_t)));
+		}
+
+		if (!f)
+			return;
+	}
+
+	std::error_code ec;
+	fs::rename(tmp, file, ec);
+	if (ec)
+		fs::remove(tmp, ec);
+}
+
+static uint64_t SignBlock(const uint8_t* data, size_t size)
+{
+	return HashService::Fast64(data, size);
+}
+
+static bool ComputeSignature(const fs::path& path, uint64_t size, uint32_t blockSize, std::vector<uint64_t>& out)
+{
+	std::ifstream f(path, std::ios::binary);
+	if (!f)
+		return false;
+
+	std::unique_ptr<uint8_t[]> buf(new uint8_t[blockSize]);
+	out.clear();
+
+	for (uint64_t off = 0; off < size; off += blockSize)
+	{
+		const size_t n = (size_t)std::min<uint64_t>(blockSize, size - off);
+		if (!f.read((char*)buf.get(), (std::streamsize)n))
+			return false;
+		out.push_back(SignBlock(buf.get(), n));
+	}
+
+	return true;
+}
+
+// ------------------------------------------------------------
+// Per-file work
+// ------------------------------------------------------------
+
+namespace
+{
+	struct SyncContext
+	{
+		fs::path Src, Dst;
+		const SyncOptions* Options = nullptr;
+		const SigMap* OldSigs = nullptr;
+
+		std::mutex Lock;   // guards NewSigs + report merging
+		SigMap NewSigs;
+
+		bool Cancelled() const
+		{
+			return Options->Cancel && Options->Cancel->load(std::memory_order_relaxed);
+		}
+
+		void Wrote(uint64_t bytes) const
+		{
+			if (Options->Progress)
+				Options->Progress->BytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+		}
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	double Since(Clock::time_point t)
+	{
+		return std::chrono::duration<double>(Clock::now() - t).count();
+	}
+}
+
+static bool CopyWhole(SyncContext& ctx, const fs::path& src, const fs::path& dst, uint64_t size,
+	FileSig& sig, SyncReport& r)
+{
+	const uint32_t bs = ctx.Options->BlockSize;
+
+	std::error_code ec;
+	fs::create_directories(dst.parent_path(), ec);
+
+	std::ifstream in(src, std::ios::binary);
+	std::ofstream out(dst, std::ios::binary | std::ios::trunc);
+	if (!in || !out)
+		return false;
+
+	std::unique_ptr<uint8_t[]> buf(new uint8_t[bs]);
+	sig.Blocks.clear();
+
+	for (uint64_t off = 0; off < size; off += bs)
+	{
+		const size_t n = (size_t)std::min<uint64_t>(bs, size - off);
+		if (ctx.Cancelled() || !in.read((char*)buf.get(), (std::streamsize)n))
+			return false;
+
+		sig.Blocks.push_back(SignBlock(buf.get(), n));
+
+		auto t = Clock::now();
+		out.write((const char*)buf.get(), (std::streamsize)n);
+		r.WriteSeconds += Since(t);
+		r.BytesWritten += n;
+		ctx.Wrote(n);
+	}
+
+	auto t = Clock::now();
+	out.close();
+	r.WriteSeconds += Since(t);
+	return !out.fail();
+}
+
+static bool PatchBlocks(SyncContext& ctx, const fs::path& src, const fs::path& dst, uint64_t size,
+	const std::vector<uint64_t>& dstSigs, FileSig& sig, SyncReport& r, bool& wrote)
+{
+	const uint32_t bs = ctx.Options->BlockSize;
+
+	std::ifstream in(src, std::ios::binary);
+	std::fstream out(dst, std::ios::binary | std::ios::in | std::ios::out);
+	if (!in || !out)
+		return false;
+
+	std::unique_ptr<uint8_t[]> buf(new uint8_t[bs]);
+	sig.Blocks.clear();
+	wrote = false;
+
+	for (uint64_t off = 0, i = 0; off < size; off += bs, ++i)
+	{
+		const size_t n = (size_t)std::min<uint64_t>(bs, size - off);
+		if (ctx.Cancelled() || !in.read((char*)buf.get(), (std::streamsize)n))
+			return false;
+
+		const uint64_t s = SignBlock(buf.get(), n);
+		sig.Blocks.push_back(s);
+
+		if (i < dstSigs.size() && dstSigs[i] == s)
+		{
+			++r.BlocksReused;
+			continue;
+		}
+
+		auto t = Clock::now();
+		out.seekp((std::streamoff)off);
+		out.write((const char*)buf.get(), (std::streamsize)n);
+		r.WriteSeconds += Since(t);
+
+		if (!out)
+			return false;
+
+		r.BytesWritten += n;
+		ctx.Wrote(n);
+		wrote = true;
+	}
+
+	auto t = Clock::now();
+	out.close();
+	r.WriteSeconds += Since(t);
+	if (out.fail())
+		return false;
+
+	std::error_code ec;
+	if (fs::file_size(dst, ec) != size && !ec)
+	{
+		fs::resize_file(dst, size, ec);
+		wrote = true;
+	}
+
+	return !ec;
+}
+
+static void SyncOne(SyncContext& ctx, const fs::path& rel, SyncReport& r)
+{
+	const SyncOptions& opt = *ctx.Options;
+	const fs::path src = ctx.Src / rel;
+	const fs::path dst = ctx.Dst / rel;
+	const std::string key = ToUtf8(rel);
+
+	std::error_code ec;
+	const uint64_t size = fs::file_size(src, ec);
+	const auto srcTime = ec ? fs::file_time_type{} : fs::last_write_time(src, ec);
+	if (ec)
+	{
+		++r.FilesFailed;
+		r.Errors.push_back(key + ": " + ec.message());
+		return;
+	}
+
+	++r.FilesScanned;
+	r.BytesSource += size;
+
+	FileSig sig;
+	sig.Size = size;
+
+	std::error_code dec;
+	const bool exists = fs::is_regular_file(dst, dec);
+	const uint64_t dstSize = exists ? fs::file_size(dst, dec) : 0;
+	const auto dstTime = exists && !dec ? fs::last_write_time(dst, dec) : fs::file_time_type{};
+
+	const FileSig* cached = nullptr;
+	if (exists && !dec)
+	{
+		auto it = ctx.OldSigs->find(key);
+		if (it != ctx.OldSigs->end() && it->second.Size == dstSize && it->second.Time == Ticks(dstTime))
+			cached = &it->second;
+	}
+
+	// the cache knows the exact source mtime; without it FAT's 2 s rounding means
+	// a same-size edit within 2 s of the last sync goes unnoticed
+	const bool sameTime = cached ? cached->SrcTime == Ticks(srcTime) : SameTime(dstTime, srcTime);
+
+	if (exists && !dec && !opt.Checksum && dstSize == size && sameTime)
+	{
+		++r.FilesUnchanged;
+		r.BlocksReused += (size + opt.BlockSize - 1) / opt.BlockSize;
+
+		// carry the signature over so a later patch of this file stays cheap
+		if (cached)
+		{
+			std::lock_guard<std::mutex> lock(ctx.Lock);
+			ctx.NewSigs[key] = *cached;
+		}
+		return;
+	}
+
+	bool ok = false;
+
+	if (!exists || dec)
+	{
+		ok = CopyWhole(ctx, src, dst, size, sig, r);
+		if (ok)
+			++r.FilesCopied;
+	}
+	else
+	{
+		std::vector<uint64_t> dstSigs;
+		if (cached)
+			dstSigs = cached->Blocks;
+		else if (!ComputeSignature(dst, dstSize, opt.BlockSize, dstSigs))
+			dstSigs.clear(); // unreadable: treat every block as changed
+
+		bool wrote = false;
+		ok = PatchBlocks(ctx, src, dst, size, dstSigs, sig, r, wrote);
+		if (ok)
+			++(wrote ? r.FilesPatched : r.FilesUnchanged);
+	}
+
+	if (!ok)
+	{
+		// a file cut short by Cancel keeps its old mtime, so the next run compares it again
+		if (ctx.Cancelled())
+			return;
+
+		++r.FilesFailed;
+		r.Errors.push_back(key + ": write failed");
+		return;
+	}
+
+	fs::last_write_time(dst, srcTime, ec);
+	sig.Time = Ticks(fs::last_write_time(dst, ec));
+	sig.SrcTime = Ticks(srcTime);
+
+	std::lock_guard<std::mutex> lock(ctx.Lock);
+	ctx.NewSigs[key] = std::move(sig);
+}
+
+static void Merge(SyncReport& into, SyncReport& from)
+{
+	into.FilesScanned += from.FilesScanned;
+	into.FilesUnchanged += from.FilesUnchanged;
+	into.FilesCopied += from.FilesCopied;
+	into.FilesPatched += from.FilesPatched;
+	into.FilesFailed += from.FilesFailed;
+	into.BytesSource += from.BytesSource;
+	into.BytesWritten += from.BytesWritten;
+	into.BlocksReused += from.BlocksReused;
+	into.WriteSeconds += from.WriteSeconds;
+
+	for (auto& e : from.Errors)
+		into.Errors.push_back(std::move(e));
+}
+
+// ------------------------------------------------------------
+// Entry
+// ------------------------------------------------------------
+
+bool DeltaSync::SyncFolders(const fs::path& src, const fs::path& dst, const SyncOptions& options, SyncReport& report)
+{
+	const auto start = Clock::now();
+	report = SyncReport{};
+
+	std::error_code ec;
+	if (!fs::is_directory(src, ec) || options.BlockSize == 0)
+	{
+		report.Errors.push_back("source is not a directory");
+		return false;
+	}
+
+	fs::create_directories(dst, ec);
+
+	// collect work up front so threads just pull indices
+	std::vector<fs::path> files;
+	std::unordered_set<std::string> srcSet;
+
+	for (auto it = fs::recursive_directory_iterator(src, fs::directory_options::skip_permission_denied, ec);
+		it != fs::recursive_directory_iterator(); it.increment(ec))
+	{
+		if (ec)
+			break;
+
+		fs::path rel = fs::relative(it->path(), src, ec);
+		if (ec)
+			continue;
+
+		if (it->is_directory(ec))
+		{
+			fs::create_directories(dst / rel, ec);
+			continue;
+		}
+
+		if (!it->is_regular_file(ec) || rel == kSignatureFile)
+			continue;
+
+		srcSet.insert(ToUtf8(rel));
+		files.push_back(std::move(rel));
+	}
+
+	if (options.Progress)
+		options.Progress->FilesTotal.store(files.size(), std::memory_order_relaxed);
+
+	const fs::path sigFile = dst / kSignatureFile;
+	const SigMap oldSigs = LoadSignatures(sigFile, options.BlockSize);
+
+	SyncContext ctx;
+	ctx.Src = src;
+	ctx.Dst = dst;
+	ctx.Options = &options;
+	ctx.OldSigs = &oldSigs;
+
+	int threads = options.Threads > 0 ? options.Threads : HashService::DefaultThreads();
+	if ((size_t)threads > files.size())
+		threads = (int)std::max<size_t>(1, files.size());
+
+	std::atomic<size_t> next{ 0 };
+	std::mutex mergeLock;
+
+	auto work = [&]()
+		{
+			SyncReport local;
+			for (size_t i = next++; i < files.size(); i = next++)
+			{
+				if (ctx.Cancelled())
+					break;
+				SyncOne(ctx, files[i], local);
+
+				if (options.Progress)
+					options.Progress->FilesDone.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			std::lock_guard<std::mutex> lock(mergeLock);
+			Merge(report, local);
+		};
+
+	std::vector<std::thread> pool;
+	for (int t = 1; t < threads; ++t)
+		pool.emplace_back(work);
+	work();
+	for (auto& t : pool)
+		t.join();
+
+	// files this run didn't sign (failed, or never reached before a cancel) keep
+	// their cached signatures; SyncOne checks size + mtime before trusting one
+	for (const auto& [key, sig] : oldSigs)
+	{
+		if (srcSet.count(key))
+			ctx.NewSigs.emplace(key, sig);
+	}
+
+	if (options.DeleteExtraneous && !ctx.Cancelled())
+	{
+		std::vector<fs::path> extra;
+		for (auto it = fs::recursive_directory_iterator(dst, fs::directory_options::skip_permission_denied, ec);
+			it != fs::recursive_directory_iterator(); it.increment(ec))
+		{
+			if (ec)
+				break;
+
+			fs::path rel = fs::relative(it->path(), dst, ec);
+			if (!ec && it->is_regular_file(ec) && rel != kSignatureFile && !srcSet.count(ToUtf8(rel)))
+				extra.push_back(it->path());
+		}
+
+		for (const auto& p : extra)
+		{
+			if (fs::remove(p, ec))
+				++report.FilesDeleted;
+		}
+	}
+
+	SaveSignatures(sigFile, options.BlockSize, ctx.NewSigs);
+
+	report.Seconds = Since(start);
+
+	// what the skipped bytes would have cost at the write rate we actually saw
+	if (report.BytesWritten > 0 && report.WriteSeconds > 0.0)
+	{
+		const double rate = (double)report.BytesWritten / report.WriteSeconds;
+		report.SecondsSaved = (double)(report.BytesSource - report.BytesWritten) / rate;
+	}
+
+	if (ctx.Cancelled())
+		report.Errors.push_back("cancelled");
+
+	return report.FilesFailed == 0 && !ctx.Cancelled();
+}
+
+// ------------------------------------------------------------
+// DeltaSyncJob
+// ------------------------------------------------------------
+
+std::shared_ptr<DeltaSyncJob> DeltaSyncJob::Start(const fs::path& src, const fs::path& dst, const SyncOptions& options)
+{
+	auto job = std::make_shared<DeltaSyncJob>();
+
+	SyncOptions opt = options;
+	opt.Cancel = &job->cancel;
+	opt.Progress = &job->progress;
+
+	std::thread([job, src, dst, opt]()
+		{
+			job->ok = DeltaSync::SyncFolders(src, dst, opt, job->report);
+
+			{
+				std::lock_guard<std::mutex> lock(job->doneMutex);
+				job->done.store(true, std::memory_order_release);
+			}
+			job->doneCv.notify_all();
+		}).detach();
+
+	return job;
+}
+
+bool DeltaSyncJob::WaitFor(uint32_t ms)
+{
+	std::unique_lock<std::mutex> lock(doneMutex);
+	return doneCv.wait_for(lock, std::chrono::milliseconds(ms), [this]() { return Done(); });
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Folder-to-folder sync that only writes what changed.
+// Files are compared by size + mtime first; changed files are compared block by
+// block (XXH64 per aligned block) and only differing blocks are rewritten in
+// place. Destination block signatures are cached in the target root so the
+// next run doesn't have to read the stick back.
+//
+// There is no rsync-style rolling search: both trees are local, and a block
+// found at a shifted offset still has to be written at its new one, so it
+// would save reads of the source at best, never device writes.
+
+struct SyncProgress
+{
+	std::atomic<uint64_t> FilesTotal{ 0 };   // set once the source is listed
+	std::atomic<uint64_t> FilesDone{ 0 };
+	std::atomic<uint64_t> BytesWritten{ 0 };
+};
+
+struct SyncOptions
+{
+	uint32_t BlockSize = 64u << 10;   // roughly a flash erase block
+	int Threads = 0;                  // 0 = hardware threads
+	bool DeleteExtraneous = false;    // remove dst files that aren't in src
+	bool Checksum = false;            // ignore size/mtime and always compare blocks
+	const std::atomic<bool>* Cancel = nullptr;      // checked between blocks
+	SyncProgress* Progress = nullptr;
+};
+
+struct SyncReport
+{
+	uint64_t FilesScanned = 0;
+	uint64_t FilesUnchanged = 0;
+	uint64_t FilesCopied = 0;     // new in dst
+	uint64_t FilesPatched = 0;    // existing, block-patched
+	uint64_t FilesDeleted = 0;
+	uint64_t FilesFailed = 0;
+
+	uint64_t BytesSource = 0;     // total size of scanned files
+	uint64_t BytesWritten = 0;
+	uint64_t BlocksReused = 0;
+
+	double Seconds = 0.0;
+	double WriteSeconds = 0.0;    // time spent inside writes
+	double SecondsSaved = 0.0;    // estimate: skipped bytes at the measured write rate
+
+	std::vector<std::string> Errors;
+};
+
+class DeltaSync
+{
+public:
+	static constexpr const char* kSignatureFile = ".pshvk-sync";
+
+	static bool SyncFolders(
+		const std::filesystem::path& src,
+		const std::filesystem::path& dst,
+		const SyncOptions& options,
+		SyncReport& report);
+};
+
+// SyncFolders on its own thread, polled by the UI every frame
+class DeltaSyncJob
+{
+public:
+	static std::shared_ptr<DeltaSyncJob> Start(
+		const std::filesystem::path& src,
+		const std::filesystem::path& dst,
+		const SyncOptions& options);
+
+	bool Done() const { return done.load(std::memory_order_acquire); }
+	bool Succeeded() const { return Done() && ok; }
+	bool Cancelled() const { return cancel.load(std::memory_order_acquire); }
+
+	void Cancel() { cancel.store(true, std::memory_order_release); }
+
+	// Returns true once the job finished, false on timeout
+	bool WaitFor(uint32_t ms);
+
+	const SyncProgress& Progress() const { return progress; }
+
+	// Only valid once Done()
+	const SyncReport& Report() const { return report; }
+
+private:
+	std::atomic<bool> cancel{ false };
+	std::atomic<bool> done{ false };
+	bool ok = false;
+
+	SyncProgress progress;
+	SyncReport report;
+
+	std::mutex doneMutex;
+	std::condition_variable doneCv;
+};
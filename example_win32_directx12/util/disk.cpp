@@ -179,111 +179,83 @@ bool Disk::RecreateDiskAndFormat(
 // DISKPART SCRIPT RUNNER
 // ------------------------------------------------------------
 
-bool Disk::RunDiskPartScriptA(const std::string& script, std::wstring* outLog)
+// writes the script to %TEMP%; the runner deletes it once diskpart exits
+static bool WriteTempScript(const void* data, size_t size, std::wstring& outPath)
 {
-	char tempPath[MAX_PATH]{};
-	if (!GetTempPathA(MAX_PATH, tempPath))
+	wchar_t tempPath[MAX_PATH]{};
+	if (!GetTempPathW(ARRAYSIZE(tempPath), tempPath))
 		return false;
 
-	char scriptFile[MAX_PATH]{};
-	if (!GetTempFileNameA(tempPath, "dp", 0, scriptFile))
+	wchar_t scriptFile[MAX_PATH]{};
+	if (!GetTempFileNameW(tempPath, L"dp", 0, scriptFile))
 		return false;
 
-	// Write script as ANSI/UTF-8 text
-	{
-		HANDLE h = CreateFileA(scriptFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, 0, nullptr);
-		if (h == INVALID_HANDLE_VALUE)
-			return false;
-
-		DWORD written = 0;
-		WriteFile(h, script.data(), (DWORD)script.size(), &written, nullptr);
-		CloseHandle(h);
-	}
-
-	SECURITY_ATTRIBUTES sa{ sizeof(sa), nullptr, TRUE };
-	HANDLE rPipe = nullptr, wPipe = nullptr;
-	if (!CreatePipe(&rPipe, &wPipe, &sa, 0))
+	HANDLE h = CreateFileW(scriptFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, 0, nullptr);
+	if (h == INVALID_HANDLE_VALUE)
 		return false;
 
-	SetHandleInformation(rPipe, HANDLE_FLAG_INHERIT, 0);
-
-	std::string cmd = "diskpart.exe /s \"";
-	cmd += scriptFile;
-	cmd += "\"";
-
-	STARTUPINFOA si{};
-	si.cb = sizeof(si);
-	si.dwFlags = STARTF_USESTDHANDLES;
-	si.hStdOutput = wPipe;
-	si.hStdError = wPipe;
-	si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
-
-	PROCESS_INFORMATION pi{};
-
-	// CreateProcessA needs mutable buffer
-	std::vector<char> cmdLine(cmd.begin(), cmd.end());
-	cmdLine.push_back('\0');
+	DWORD written = 0;
+	BOOL ok = WriteFile(h, data, (DWORD)size, &written, nullptr);
+	CloseHandle(h);
 
-	if (!CreateProcessA(
-		nullptr,
-		cmdLine.data(),
-		nullptr, nullptr,
-		TRUE,
-		CREATE_NO_WINDOW,
-		nullptr, nullptr,
-		&si,
-		&pi))
+	if (!ok || written != (DWORD)size)
 	{
-		CloseHandle(rPipe);
-		CloseHandle(wPipe);
-		DeleteFileA(scriptFile);
+		DeleteFileW(scriptFile);
 		return false;
 	}
 
-	CloseHandle(wPipe);
-
-	std::string logA;
-	char buf[4096];
-	DWORD read = 0;
-
-	while (ReadFile(rPipe, buf, sizeof(buf) - 1, &read, nullptr) && read > 0)
-	{
-		buf[read] = 0;
-		logA += buf;
-	}
-
-	WaitForSingleObject(pi.hProcess, INFINITE);
+	outPath = scriptFile;
+	return true;
+}
 
-	DWORD exitCode = 1;
-	GetExitCodeProcess(pi.hProcess, &exitCode);
+static std::shared_ptr<ProcessJob> StartDiskPartFile(const std::string& scriptFileUtf8, uint32_t timeoutMs)
+{
+	ProcessRequest req;
+	req.Program = "diskpart.exe";
+	req.Args = { "/s", scriptFileUtf8 };
+	req.TimeoutMs = timeoutMs;
+	req.TempFile = scriptFileUtf8;
 
-	CloseHandle(pi.hThread);
-	CloseHandle(pi.hProcess);
-	CloseHandle(rPipe);
+	return ProcessRunner::Start(req);
+}
 
-	DeleteFileA(scriptFile);
+// blocks until the job is done, converting its (UTF-8) output for outLog
+static bool CollectDiskPart(const std::shared_ptr<ProcessJob>& job, std::wstring* outLog)
+{
+	std::string logA;
+	bool ok = ProcessRunner::Collect(job, outLog ? &logA : nullptr);
 
 	if (outLog)
 	{
-		int wlen = MultiByteToWideChar(CP_UTF8, 0, logA.c_str(), -1, nullptr, 0);
-		if (wlen <= 1)
-			wlen = MultiByteToWideChar(CP_ACP, 0, logA.c_str(), -1, nullptr, 0);
+		outLog->clear();
 
-		if (wlen > 1)
+		int wlen = MultiByteToWideChar(CP_UTF8, 0, logA.c_str(), (int)logA.size(), nullptr, 0);
+		if (wlen > 0)
 		{
-			std::wstring w(wlen - 1, L'\0');
-			MultiByteToWideChar(CP_UTF8, 0, logA.c_str(), -1, w.data(), wlen);
-			if (w.empty())
-				MultiByteToWideChar(CP_ACP, 0, logA.c_str(), -1, w.data(), wlen);
-			*outLog = w;
-		}
-		else
-		{
-			*outLog = L"";
+			outLog->resize(wlen);
+			MultiByteToWideChar(CP_UTF8, 0, logA.c_str(), (int)logA.size(), outLog->data(), wlen);
 		}
 	}
 
-	return exitCode == 0;
+	return ok;
+}
+
+std::shared_ptr<ProcessJob> Disk::StartDiskPartScript(const std::string& script, uint32_t timeoutMs)
+{
+	std::wstring scriptFile;
+	if (!WriteTempScript(script.data(), script.size(), scriptFile))
+		return nullptr;
+
+	return StartDiskPartFile(WToUtf8(scriptFile), timeoutMs);
+}
+
+bool Disk::RunDiskPartScriptA(const std::string& script, std::wstring* outLog)
+{
+	auto job = StartDiskPartScript(script);
+	if (!job)
+		return false;
+
+	return CollectDiskPart(job, outLog);
 }
 
 std::string Disk::WToUtf8(const std::wstring& w)
@@ -390,6 +362,17 @@ bool Disk::GetDiskInfo(int physicalIndex, DiskInfo& out)
 
 	out.SizeBytes = geo.DiskSize.QuadPart;
 
+	// ---- Partition style ----
+	// partition 0 of the physical drive is the whole disk, so this is the
+	// disk's style even when it has no partitions yet
+	PARTITION_INFORMATION_EX style{};
+	out.Gpt = DeviceIoControl(
+		h,
+		IOCTL_DISK_GET_PARTITION_INFO_EX,
+		nullptr, 0,
+		&style, sizeof(style),
+		&bytes, nullptr) && style.PartitionStyle == PARTITION_STYLE_GPT;
+
 	// ---- Model / serial ----
 	STORAGE_PROPERTY_QUERY q{};
 	q.PropertyId = StorageDeviceProperty;
@@ -593,98 +576,12 @@ bool Disk::IsIsoLikeFs(const std::wstring& fs)
 
 bool Disk::RunDiskPartScript(const std::wstring& scriptText, std::wstring* outLog)
 {
-	wchar_t tempPath[MAX_PATH]{};
-	if (!GetTempPathW(ARRAYSIZE(tempPath), tempPath))
-		return false;
-
-	wchar_t scriptFile[MAX_PATH]{};
-	if (!GetTempFileNameW(tempPath, L"dp", 0, scriptFile))
+	std::wstring scriptFile;
+	if (!WriteTempScript(scriptText.c_str(), scriptText.size() * sizeof(wchar_t), scriptFile))
 		return false;
 
-	// write script
-	{
-		HANDLE h = CreateFileW(scriptFile, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, 0, nullptr);
-		if (h == INVALID_HANDLE_VALUE)
-			return false;
-
-		DWORD written = 0;
-		std::wstring s = scriptText;
-		WriteFile(h, s.c_str(), (DWORD)(s.size() * sizeof(wchar_t)), &written, nullptr);
-		CloseHandle(h);
-	}
-
-	// pipes for stdout
-	SECURITY_ATTRIBUTES sa{ sizeof(sa), nullptr, TRUE };
-	HANDLE rPipe = nullptr, wPipe = nullptr;
-	if (!CreatePipe(&rPipe, &wPipe, &sa, 0))
-		return false;
-
-	SetHandleInformation(rPipe, HANDLE_FLAG_INHERIT, 0);
-
-	std::wstring cmd = L"diskpart.exe /s \"";
-	cmd += scriptFile;
-	cmd += L"\"";
-
-	STARTUPINFOW si{};
-	si.cb = sizeof(si);
-	si.dwFlags = STARTF_USESTDHANDLES;
-	si.hStdOutput = wPipe;
-	si.hStdError = wPipe;
-	si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
-
-	PROCESS_INFORMATION pi{};
-
-	std::wstring cmdLine = cmd; // CreateProcess needs mutable buffer
-	if (!CreateProcessW(
-		nullptr,
-		cmdLine.data(),
-		nullptr, nullptr,
-		TRUE,
-		CREATE_NO_WINDOW,
-		nullptr, nullptr,
-		&si,
-		&pi))
-	{
-		CloseHandle(rPipe);
-		CloseHandle(wPipe);
-		DeleteFileW(scriptFile);
-		return false;
-	}
-
-	CloseHandle(wPipe);
-
-	// read all output
-	std::wstring log;
-	char buf[4096];
-	DWORD read = 0;
-	while (ReadFile(rPipe, buf, sizeof(buf) - 1, &read, nullptr) && read > 0)
-	{
-		buf[read] = 0;
-
-		// best-effort UTF-8/ANSI -> wide
-		int wlen = MultiByteToWideChar(CP_ACP, 0, buf, -1, nullptr, 0);
-		if (wlen > 1)
-		{
-			std::wstring tmp(wlen - 1, L'\0');
-			MultiByteToWideChar(CP_ACP, 0, buf, -1, tmp.data(), wlen);
-			log += tmp;
-		}
-	}
-
-	WaitForSingleObject(pi.hProcess, INFINITE);
-
-	DWORD exitCode = 1;
-	GetExitCodeProcess(pi.hProcess, &exitCode);
-
-	CloseHandle(pi.hThread);
-	CloseHandle(pi.hProcess);
-	CloseHandle(rPipe);
-
-	DeleteFileW(scriptFile);
-
-	if (outLog) *outLog = log;
-
-	return exitCode == 0;
+	auto job = StartDiskPartFile(WToUtf8(scriptFile), 0);
+	return CollectDiskPart(job, outLog);
 }
 
 std::wstring Disk::BuildDiskPartRecreateScript(
@@ -881,4 +778,85 @@ wchar_t Disk::FindAnyDriveLetterForDisk(int physicalDiskIndex)
 	}
 
 	return 0; // no mounted volume found for this disk
-}
\ No newline at end of file
+}
+
+// ------------------------------------------------------------
+// BATCHED OPERATIONS
+// ------------------------------------------------------------
+
+PlannedLayout Disk::BuildPlannedLayout(
+	int physicalDiskIndex,
+	const DiskInfo& disk,
+	const std::vector<PartitionInfo>& parts)
+{
+	PlannedLayout layout{};
+	layout.DiskSize = disk.SizeBytes;
+	layout.Gpt = disk.Gpt;
+
+	for (const auto& p : parts)
+	{
+		// MBR layouts report all 4 slots, empty ones have no length
+		if (p.Size == 0)
+			continue;
+
+		PlannedPartition pp{};
+		pp.Offset = p.Offset;
+		pp.Size = p.Size;
+
+		std::wstring root = VolumeGuidToDriveRoot(GetPartitionRootPath(physicalDiskIndex, p));
+		pp.Letter = (char)ExtractDriveLetter(root);
+
+		if (!root.empty())
+		{
+			wchar_t label[MAX_PATH]{};
+			wchar_t fs[MAX_PATH]{};
+
+			if (GetVolumeInformationW(root.c_str(), label, MAX_PATH, nullptr, nullptr, nullptr, fs, MAX_PATH))
+			{
+				pp.Label = WToUtf8(label);
+				pp.FileSystem = WToUtf8(fs);
+			}
+		}
+
+		layout.Partitions.push_back(pp);
+	}
+
+	return layout;
+}
+
+bool Disk::CommitPlan(
+	const DiskPlan& plan,
+	const PlannedLayout& current,
+	std::wstring* outLog)
+{
+	if (plan.Empty())
+		return true;
+
+	std::string error;
+	auto job = StartPlan(plan, current, &error);
+
+	if (!job)
+	{
+		if (outLog)
+			*outLog = AnsiToWide(error.c_str());
+		return false;
+	}
+
+	return CollectDiskPart(job, outLog);
+}
+
+std::shared_ptr<ProcessJob> Disk::StartPlan(
+	const DiskPlan& plan,
+	const PlannedLayout& current,
+	std::string* error)
+{
+	std::string script;
+	if (!plan.BuildScript(current, script, error))
+		return nullptr;
+
+	auto job = StartDiskPartScript(script);
+	if (!job && error)
+		*error = "could not write diskpart script";
+
+	return job;
+}
@@ -4,6 +4,8 @@
 #include <vector>
 #include "imgui.h"
 #include <Windows.h>
+#include "disk_plan.h"
+#include "process.h"
 
 struct VolumeInfo
 {
@@ -19,6 +21,7 @@ struct DiskInfo
 	uint64_t SizeBytes;
 	std::wstring Model;
 	std::wstring Serial;
+	bool Gpt;   // partition table style of the disk itself (diskpart initializes a RAW disk as MBR)
 };
 
 struct PartitionInfo
@@ -187,6 +190,30 @@ public:
 	static wchar_t FindAnyDriveLetterForDisk(int physicalDiskIndex);
 	static int GetPhysicalDiskIndexFromVolume(const std::wstring& rootPath);
 
+	// Snapshot of a disk for DiskPlan simulation (letters/labels resolved per partition)
+	static PlannedLayout BuildPlannedLayout(
+		int physicalDiskIndex,
+		const DiskInfo& disk,
+		const std::vector<PartitionInfo>& parts);
+
+	// Runs every queued op in a single diskpart process
+	static bool CommitPlan(
+		const DiskPlan& plan,
+		const PlannedLayout& current,
+		std::wstring* outLog = nullptr);
+
+	// Non-blocking CommitPlan. Null if the plan doesn't build (reason in `error`).
+	static std::shared_ptr<ProcessJob> StartPlan(
+		const DiskPlan& plan,
+		const PlannedLayout& current,
+		std::string* error = nullptr);
+
+	// Runs diskpart on a ProcessRunner worker, output streams through the job.
+	// Null only if the script file couldn't be written.
+	static std::shared_ptr<ProcessJob> StartDiskPartScript(
+		const std::string& script,
+		uint32_t timeoutMs = 0);
+
 private:
 
 	static std::string WToUtf8(const std::wstring& w);
@@ -0,0 +1,450 @@
+#include "disk_plan.h"
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+
+// ------------------------------------------------------------
+// Helpers
+// ------------------------------------------------------------
+
+static uint64_t AlignUp(uint64_t v, uint64_t a)
+{
+	return (v + a - 1) / a * a;
+}
+
+static bool EqualsNoCase(const std::string& a, const char* b)
+{
+	size_t n = a.size();
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (!b[i] || std::tolower((unsigned char)a[i]) != std::tolower((unsigned char)b[i]))
+			return false;
+	}
+	return b[n] == 0;
+}
+
+// max label length per file system (0 = unknown fs)
+static size_t MaxLabelLength(const std::string& fs)
+{
+	if (EqualsNoCase(fs, "NTFS"))  return 32;
+	if (EqualsNoCase(fs, "exFAT")) return 15;
+	if (EqualsNoCase(fs, "FAT32") || EqualsNoCase(fs, "FAT")) return 11;
+	return 0;
+}
+
+// labels go into the diskpart script verbatim; a quote or line break would
+// end the argument or start a new command
+static bool SafeLabel(const std::string& label)
+{
+	return label.find_first_of("\"\r\n") == std::string::npos;
+}
+
+static char UpperLetter(char c)
+{
+	return (char)std::toupper((unsigned char)c);
+}
+
+static void SetError(std::string* error, const std::string& msg)
+{
+	if (error)
+		*error = msg;
+}
+
+static uint64_t UsableEnd(const PlannedLayout& layout)
+{
+	// GPT keeps a backup header + entry array (33 sectors) at the end of the disk
+	const uint64_t reserve = layout.Gpt ? 33ull * 512 : 0;
+	return layout.DiskSize > reserve ? layout.DiskSize - reserve : 0;
+}
+
+// ------------------------------------------------------------
+// PlannedLayout
+// ------------------------------------------------------------
+
+uint64_t PlannedLayout::UsedBytes() const
+{
+	uint64_t used = 0;
+	for (const auto& p : Partitions)
+		used += p.Size;
+	return used;
+}
+
+uint64_t PlannedLayout::UnallocatedBytes() const
+{
+	const uint64_t end = UsableEnd(*this);
+	const uint64_t used = UsedBytes() + DiskPlan::kAlignment; // leading 1 MiB is never allocatable
+	return used < end ? end - used : 0;
+}
+
+// ------------------------------------------------------------
+// Queue
+// ------------------------------------------------------------
+
+void DiskPlan::Reset(int physicalDiskIndex)
+{
+	diskIndex = physicalDiskIndex;
+	ops.clear();
+}
+
+void DiskPlan::CreatePartition(uint64_t sizeMB, const std::string& fs, const std::string& label, bool quick, char forceLetter)
+{
+	DiskOp op{};
+	op.Kind = DiskOpKind::CreatePartition;
+	op.SizeMB = sizeMB;
+	op.FileSystem = fs;
+	op.Label = label;
+	op.Quick = quick;
+	op.Letter = forceLetter ? UpperLetter(forceLetter) : 0;
+	ops.push_back(op);
+}
+
+void DiskPlan::DeletePartition(uint64_t partitionOffset)
+{
+	DiskOp op{};
+	op.Kind = DiskOpKind::DeletePartition;
+	op.TargetOffset = partitionOffset;
+	ops.push_back(op);
+}
+
+void DiskPlan::RenameVolume(char driveLetter, const std::string& newLabel)
+{
+	DiskOp op{};
+	op.Kind = DiskOpKind::RenameVolume;
+	op.Letter = UpperLetter(driveLetter);
+	op.Label = newLabel;
+	ops.push_back(op);
+}
+
+void DiskPlan::ConvertScheme(bool toGpt)
+{
+	DiskOp op{};
+	op.Kind = DiskOpKind::ConvertScheme;
+	op.ToGpt = toGpt;
+	ops.push_back(op);
+}
+
+void DiskPlan::RemoveAt(size_t index)
+{
+	if (index < ops.size())
+		ops.erase(ops.begin() + (ptrdiff_t)index);
+}
+
+void DiskPlan::Clear()
+{
+	ops.clear();
+}
+
+// ------------------------------------------------------------
+// Simulation
+// ------------------------------------------------------------
+
+bool DiskPlan::ApplyOp(const DiskOp& op, PlannedLayout& layout, int* partitionNumber, std::string* error)
+{
+	auto& parts = layout.Partitions;
+
+	switch (op.Kind)
+	{
+	case DiskOpKind::CreatePartition:
+	{
+		const size_t maxLabel = MaxLabelLength(op.FileSystem);
+		if (!maxLabel)
+		{
+			SetError(error, "unsupported file system '" + op.FileSystem + "'");
+			return false;
+		}
+
+		if (!SafeLabel(op.Label))
+		{
+			SetError(error, "label must not contain quotes or line breaks");
+			return false;
+		}
+
+		if (op.Label.size() > maxLabel)
+		{
+			SetError(error, "label too long for " + op.FileSystem + " (max " + std::to_string(maxLabel) + ")");
+			return false;
+		}
+
+		if (!layout.Gpt && parts.size() >= 4)
+		{
+			SetError(error, "MBR disks hold at most 4 primary partitions");
+			return false;
+		}
+
+		if (layout.Gpt && parts.size() >= 128)
+		{
+			SetError(error, "GPT partition table is full");
+			return false;
+		}
+
+		if (op.Letter)
+		{
+			if (op.Letter < 'A' || op.Letter > 'Z')
+			{
+				SetError(error, "invalid drive letter");
+				return false;
+			}
+
+			for (const auto& p : parts)
+			{
+				if (p.Letter == op.Letter)
+				{
+					SetError(error, std::string("drive letter ") + op.Letter + ": already in use");
+					return false;
+				}
+			}
+		}
+
+		// first fit, same as diskpart without offset=
+		const uint64_t wanted = op.SizeMB << 20;
+		const uint64_t end = UsableEnd(layout);
+		uint64_t cursor = kAlignment;
+		size_t insertAt = parts.size();
+		uint64_t start = 0;
+		uint64_t size = 0;
+
+		for (size_t i = 0; i <= parts.size(); ++i)
+		{
+			const uint64_t gapEnd = (i < parts.size()) ? parts[i].Offset : end;
+			const uint64_t gapStart = AlignUp(cursor, kAlignment);
+
+			if (gapEnd > gapStart)
+			{
+				const uint64_t avail = gapEnd - gapStart;
+				if ((wanted == 0 && avail >= kAlignment) || (wanted != 0 && avail >= wanted))
+				{
+					start = gapStart;
+					size = wanted ? wanted : avail;
+					insertAt = i;
+					break;
+				}
+			}
+
+			if (i < parts.size())
+				cursor = std::max(cursor, parts[i].Offset + parts[i].Size);
+		}
+
+		if (!size)
+		{
+			SetError(error, wanted
+				? "not enough contiguous unallocated space for " + std::to_string(op.SizeMB) + " MB"
+				: "no unallocated space left");
+			return false;
+		}
+
+		if (EqualsNoCase(op.FileSystem, "FAT32") && size > kFat32MaxBytes)
+		{
+			SetError(error, "FAT32 volumes are limited to 32 GB");
+			return false;
+		}
+
+		PlannedPartition p{};
+		p.Offset = start;
+		p.Size = size;
+		p.FileSystem = op.FileSystem;
+		p.Label = op.Label;
+		p.Letter = op.Letter;
+		p.Created = true;
+
+		parts.insert(parts.begin() + (ptrdiff_t)insertAt, p);
+		if (partitionNumber)
+			*partitionNumber = (int)insertAt + 1;
+		return true;
+	}
+
+	case DiskOpKind::DeletePartition:
+	{
+		for (size_t i = 0; i < parts.size(); ++i)
+		{
+			if (parts[i].Offset == op.TargetOffset)
+			{
+				if (partitionNumber)
+					*partitionNumber = (int)i + 1;
+				parts.erase(parts.begin() + (ptrdiff_t)i);
+				return true;
+			}
+		}
+
+		SetError(error, "no partition at offset " + std::to_string(op.TargetOffset));
+		return false;
+	}
+
+	case DiskOpKind::RenameVolume:
+	{
+		if (!op.Letter || op.Label.empty())
+		{
+			SetError(error, "rename needs a drive letter and a label");
+			return false;
+		}
+
+		if (!SafeLabel(op.Label))
+		{
+			SetError(error, "label must not contain quotes or line breaks");
+			return false;
+		}
+
+		// the volume may live on another disk; only track it if it is ours
+		for (auto& p : parts)
+		{
+			if (p.Letter != op.Letter)
+				continue;
+
+			const size_t maxLabel = MaxLabelLength(p.FileSystem);
+			if (maxLabel && op.Label.size() > maxLabel)
+			{
+				SetError(error, "label too long for " + p.FileSystem + " (max " + std::to_string(maxLabel) + ")");
+				return false;
+			}
+
+			p.Label = op.Label;
+		}
+		return true;
+	}
+
+	case DiskOpKind::ConvertScheme:
+	{
+		// convert needs a clean disk, so this wipes every partition.
+		// diskpart may add an MSR partition on GPT; the preview doesn't model it.
+		parts.clear();
+		layout.Gpt = op.ToGpt;
+		return true;
+	}
+	}
+
+	SetError(error, "unknown operation");
+	return false;
+}
+
+bool DiskPlan::Simulate(const PlannedLayout& current, PlannedLayout& out, std::string* error) const
+{
+	out = current;
+	std::sort(out.Partitions.begin(), out.Partitions.end(),
+		[](const PlannedPartition& a, const PlannedPartition& b) { return a.Offset < b.Offset; });
+
+	for (size_t i = 0; i < ops.size(); ++i)
+	{
+		std::string why;
+		if (!ApplyOp(ops[i], out, nullptr, &why))
+		{
+			SetError(error, "#" + std::to_string(i + 1) + " " + Describe(ops[i]) + ": " + why);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// ------------------------------------------------------------
+// Script
+// ------------------------------------------------------------
+
+bool DiskPlan::BuildScript(const PlannedLayout& current, std::string& script, std::string* error) const
+{
+	script.clear();
+
+	PlannedLayout layout = current;
+	std::sort(layout.Partitions.begin(), layout.Partitions.end(),
+		[](const PlannedPartition& a, const PlannedPartition& b) { return a.Offset < b.Offset; });
+
+	const std::string selectDisk = "select disk " + std::to_string(diskIndex) + "\r\n";
+
+	for (size_t i = 0; i < ops.size(); ++i)
+	{
+		const DiskOp& op = ops[i];
+		int number = 0;
+		std::string why;
+
+		// rename goes through "select volume", everything else needs the disk
+		if (op.Kind != DiskOpKind::RenameVolume && diskIndex < 0)
+			why = "no disk selected";
+
+		if (!why.empty() || !ApplyOp(op, layout, &number, &why))
+		{
+			SetError(error, "#" + std::to_string(i + 1) + " " + Describe(op) + ": " + why);
+			script.clear();
+			return false;
+		}
+
+		switch (op.Kind)
+		{
+		case DiskOpKind::CreatePartition:
+			script += selectDisk;
+			script += "create partition primary";
+			if (op.SizeMB > 0)
+				script += " size=" + std::to_string(op.SizeMB);
+			script += "\r\n";
+
+			// focus stays on the new partition
+			script += "format fs=" + op.FileSystem;
+			if (op.Quick)
+				script += " quick";
+			if (!op.Label.empty())
+				script += " label=\"" + op.Label + "\"";
+			script += "\r\n";
+
+			if (op.Letter)
+			{
+				script += "assign letter=";
+				script += op.Letter;
+				script += "\r\n";
+			}
+			else
+			{
+				script += "assign\r\n";
+			}
+			break;
+
+		case DiskOpKind::DeletePartition:
+			script += selectDisk;
+			script += "select partition " + std::to_string(number) + "\r\n";
+			script += "delete partition override\r\n";
+			break;
+
+		case DiskOpKind::RenameVolume:
+			script += "select volume ";
+			script += op.Letter;
+			script += "\r\n";
+			script += "label " + op.Label + "\r\n";
+			break;
+
+		case DiskOpKind::ConvertScheme:
+			script += selectDisk;
+			script += "attributes disk clear readonly\r\n";
+			script += "clean\r\n";
+			script += op.ToGpt ? "convert gpt\r\n" : "convert mbr\r\n";
+			break;
+		}
+	}
+
+	script += "exit\r\n";
+	return true;
+}
+
+std::string DiskPlan::Describe(const DiskOp& op)
+{
+	switch (op.Kind)
+	{
+	case DiskOpKind::CreatePartition:
+	{
+		std::string s = "Create ";
+		s += op.SizeMB ? std::to_string(op.SizeMB) + " MB " : "max size ";
+		s += op.FileSystem;
+		if (!op.Label.empty())
+			s += " \"" + op.Label + "\"";
+		if (op.Letter)
+		{
+			s += " as ";
+			s += op.Letter;
+			s += ":";
+		}
+		return s;
+	}
+	case DiskOpKind::DeletePartition:
+		return "Delete partition @ " + std::to_string(op.TargetOffset >> 20) + " MB";
+	case DiskOpKind::RenameVolume:
+		return std::string("Rename ") + op.Letter + ": to \"" + op.Label + "\"";
+	case DiskOpKind::ConvertScheme:
+		return op.ToGpt ? "Clean + convert to GPT" : "Clean + convert to MBR";
+	}
+	return "Unknown";
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Platform-neutral batch planner for Format-tab operations.
+// Ops are queued, simulated against an in-memory layout for preview and
+// turned into a single diskpart script so the whole batch runs in one process.
+
+enum class DiskOpKind
+{
+	CreatePartition,
+	DeletePartition,
+	RenameVolume,
+	ConvertScheme
+};
+
+struct DiskOp
+{
+	DiskOpKind Kind = DiskOpKind::CreatePartition;
+
+	uint64_t SizeMB = 0;         // CreatePartition: 0 = whole first free extent
+	std::string FileSystem;      // CreatePartition: "NTFS" / "exFAT" / "FAT32"
+	std::string Label;           // CreatePartition / RenameVolume
+	bool Quick = true;           // CreatePartition
+	char Letter = 0;             // CreatePartition: forced letter (0 = auto), RenameVolume: target
+	uint64_t TargetOffset = 0;   // DeletePartition: byte offset of the partition
+	bool ToGpt = false;          // ConvertScheme
+};
+
+struct PlannedPartition
+{
+	uint64_t Offset = 0;
+	uint64_t Size = 0;
+	std::string FileSystem;
+	std::string Label;
+	char Letter = 0;
+	bool Created = false;        // produced by the plan, not on disk yet
+};
+
+struct PlannedLayout
+{
+	uint64_t DiskSize = 0;
+	bool Gpt = false;
+	std::vector<PlannedPartition> Partitions; // kept sorted by offset
+
+	uint64_t UsedBytes() const;
+	uint64_t UnallocatedBytes() const;
+};
+
+class DiskPlan
+{
+public:
+	static constexpr uint64_t kAlignment = 1ull << 20;       // diskpart default (1 MiB)
+	static constexpr uint64_t kFat32MaxBytes = 32ull << 30;   // diskpart refuses FAT32 above 32 GiB
+
+	void Reset(int physicalDiskIndex);
+	int DiskIndex() const { return diskIndex; }
+	bool Empty() const { return ops.empty(); }
+	const std::vector<DiskOp>& Ops() const { return ops; }
+
+	void CreatePartition(uint64_t sizeMB, const std::string& fs, const std::string& label, bool quick, char forceLetter = 0);
+	void DeletePartition(uint64_t partitionOffset);
+	void RenameVolume(char driveLetter, const std::string& newLabel);
+	void ConvertScheme(bool toGpt);
+
+	void RemoveAt(size_t index);
+	void Clear();
+
+	// Applies every op to a copy of `current`. Stops at the first invalid op,
+	// reporting it through `error` (prefixed with the 1-based op number).
+	bool Simulate(const PlannedLayout& current, PlannedLayout& out, std::string* error = nullptr) const;
+
+	// Builds one diskpart script for the whole batch. Partition numbers are
+	// resolved against the simulated layout at the point each op runs.
+	bool BuildScript(const PlannedLayout& current, std::string& script, std::string* error = nullptr) const;
+
+	static std::string Describe(const DiskOp& op);
+
+private:
+	static bool ApplyOp(const DiskOp& op, PlannedLayout& layout, int* partitionNumber, std::string* error);
+
+	int diskIndex = -1;
+	std::vector<DiskOp> ops;
+};
@@ -0,0 +1,1114 @@
+#include "download_manager.h"
+#include "write_behind.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t NowTicks()
+{
+	return Clock::now().time_since_epoch().count();
+}
+
+static double TicksToSeconds(int64_t ticks)
+{
+	return std::chrono::duration<double>(Clock::duration(ticks)).count();
+}
+
+// ------------------------------------------------------------
+// Shared cache
+// ------------------------------------------------------------
+
+namespace
+{
+	struct Shared
+	{
+		CURLSH* Share = nullptr;
+		std::mutex Locks[CURL_LOCK_DATA_LAST];
+		bool Http2 = false;
+	};
+
+	void ShareLock(CURL*, curl_lock_data data, curl_lock_access, void* userptr)
+	{
+		static_cast<Shared*>(userptr)->Locks[data].lock();
+	}
+
+	void ShareUnlock(CURL*, curl_lock_data data, void* userptr)
+	{
+		static_cast<Shared*>(userptr)->Locks[data].unlock();
+	}
+
+	// DNS, TLS sessions and live connections are shared by every handle we create.
+	// Lives for the whole process; curl_global_init isn't thread safe so it runs here once.
+	Shared& G()
+	{
+		static Shared s;
+		static std::once_flag once;
+		std::call_once(once, [] {
+			curl_global_init(CURL_GLOBAL_DEFAULT);
+
+			const curl_version_info_data* info = curl_version_info(CURLVERSION_NOW);
+			s.Http2 = info && (info->features & CURL_VERSION_HTTP2);
+
+			s.Share = curl_share_init();
+			if (!s.Share)
+				return;
+
+			curl_share_setopt(s.Share, CURLSHOPT_LOCKFUNC, ShareLock);
+			curl_share_setopt(s.Share, CURLSHOPT_UNLOCKFUNC, ShareUnlock);
+			curl_share_setopt(s.Share, CURLSHOPT_USERDATA, &s);
+			curl_share_setopt(s.Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+			curl_share_setopt(s.Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+			curl_share_setopt(s.Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+		});
+		return s;
+	}
+}
+
+bool DownloadManager::Http2Available()
+{
+	return G().Http2;
+}
+
+CURL* DownloadManager::NewEasy(const std::string& url)
+{
+	Shared& g = G();
+
+	CURL* curl = curl_easy_init();
+	if (!curl)
+		return nullptr;
+
+	curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+	curl_easy_setopt(curl, CURLOPT_USERAGENT, "PSHVK-Updater");
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+	if (g.Share)
+		curl_easy_setopt(curl, CURLOPT_SHARE, g.Share);
+
+	// plain http stays on 1.1, https negotiates h2 through ALPN
+	if (g.Http2)
+		curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+
+	return curl;
+}
+
+// ------------------------------------------------------------
+// Transfers
+// ------------------------------------------------------------
+
+// One byte range of a file, one easy handle. A file starts as a single
+// open-ended segment; Split() cuts it once the size is known.
+struct DownloadManager::Segment
+{
+	Transfer* Owner = nullptr;
+	CURL* Easy = nullptr;
+	FILE* File = nullptr;
+	curl_slist* Headers = nullptr;
+
+	uint64_t Begin = 0;
+	uint64_t End = 0;           // exclusive, 0 = to the end of the file
+	uint64_t Done = 0;          // bytes on disk from Begin
+
+	bool Ranged = false;        // this request carried a Range header
+	bool Complete = false;
+	bool Stop = false;          // reached End on a longer stream and cut it off
+	bool Ignore = false;        // error response, body isn't file content
+	bool WriteFailed = false;
+
+	// headers of the response being received (reset on every status line)
+	uint64_t HdrLength = 0;
+	uint64_t HdrRangeTotal = 0;
+	bool HdrAcceptRanges = false;
+	std::string HdrETag;
+	std::string HdrLastModified;
+};
+
+struct DownloadManager::Transfer
+{
+	DownloadManager* Owner = nullptr;
+	DownloadItem Item;
+	std::filesystem::path Part;
+	std::filesystem::path State;
+
+	std::vector<std::unique_ptr<Segment>> Segments;
+	int Outstanding = 0;        // segments queued or in flight this attempt
+
+	uint64_t Size = 0;          // from the first response or the state file
+	std::string Validator;      // ETag, else Last-Modified; sent as If-Range
+	bool AcceptRanges = false;
+	bool NoRanges = false;      // server broke a range request once, stay on one stream
+	bool Restart = false;       // resource changed under a resume, start over
+
+	CURLcode LastCode = CURLE_OK;
+	long LastHttp = 0;
+	bool Failed = false;
+	bool LocalError = false;    // disk trouble, retrying won't help
+
+	uint64_t Counted = 0;       // added to bytesDone for this file
+	uint64_t TotalAdded = 0;    // added to bytesTotal from the response headers
+
+	Clock::time_point RetryAt;
+	DownloadResult Result;
+};
+
+DownloadManager::DownloadManager(const DownloadOptions& options)
+	: opt(options)
+{
+	opt.MaxConcurrent = std::max(1, opt.MaxConcurrent);
+	opt.MaxSegments = std::max(1, opt.MaxSegments);
+	if (opt.MaxPerHost <= 0)
+		opt.MaxPerHost = opt.MaxConcurrent;
+}
+
+DownloadManager::~DownloadManager()
+{
+	if (multi)
+		curl_multi_cleanup(multi);
+}
+
+void DownloadManager::Add(DownloadItem item)
+{
+	queue.push_back(std::move(item));
+}
+
+void DownloadManager::SetProgressCallback(std::function<void(const DownloadProgress&)> cb, int intervalMs)
+{
+	onProgress = std::move(cb);
+	progressIntervalMs = std::max(0, intervalMs);
+}
+
+DownloadProgress DownloadManager::Progress() const
+{
+	DownloadProgress p;
+	p.FilesTotal = filesTotal.load();
+	p.FilesDone = filesDone.load();
+	p.FilesFailed = filesFailed.load();
+	p.BytesDone = bytesDone.load();
+	p.BytesTotal = bytesTotal.load();
+	p.Retries = retries.load();
+	p.Active = active.load();
+
+	const int64_t start = startTicks.load();
+	const int64_t end = endTicks.load();
+	if (start)
+		p.Seconds = TicksToSeconds((end ? end : NowTicks()) - start);
+
+	return p;
+}
+
+std::filesystem::path DownloadManager::StatePath(const std::filesystem::path& path)
+{
+	auto p = path;
+	p += ".part.state";
+	return p;
+}
+
+static bool SeekTo(FILE* f, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(f, (__int64)offset, SEEK_SET) == 0;
+#else
+	return fseeko(f, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+static FILE* OpenPart(const std::filesystem::path& p, bool truncate)
+{
+#ifdef _WIN32
+	return _wfopen(p.c_str(), truncate ? L"wb" : L"r+b");
+#else
+	return fopen(p.c_str(), truncate ? "wb" : "r+b");
+#endif
+}
+
+// Down to the disk, not just out of the stdio buffer (_commit is
+// FlushFileBuffers on the underlying handle)
+static bool SyncFile(FILE* f)
+{
+	if (fflush(f) != 0)
+		return false;
+#ifdef _WIN32
+	return _commit(_fileno(f)) == 0;
+#else
+	return fsync(fileno(f)) == 0;
+#endif
+}
+
+// ------------------------------------------------------------
+// State sidecar
+// ------------------------------------------------------------
+
+// url <url>
+// size <bytes>
+// validator <etag or last-modified>
+// seg <begin> <end> <done>
+//
+// Written after the data it describes is synced to disk, and synced itself
+// before it replaces the previous state, so even after a power loss there
+// is never less on disk than the state claims.
+void DownloadManager::SaveState(Transfer& t)
+{
+	if (!Resumable(t))
+		return;
+
+	std::string s;
+	s += "url " + t.Item.Url + "\n";
+	s += "size " + std::to_string(t.Size) + "\n";
+	s += "validator " + t.Validator + "\n";
+	for (const auto& seg : t.Segments)
+	{
+		// each segment writes through its own handle; on a failed sync the
+		// previous state stays, and it claims less
+		if (seg->File && !SyncFile(seg->File))
+			return;
+
+		s += "seg " + std::to_string(seg->Begin) + " " + std::to_string(seg->End) + " " +
+			std::to_string(seg->Done) + "\n";
+	}
+
+	auto tmp = t.State;
+	tmp += ".tmp";
+
+	FILE* f = OpenPart(tmp, true);
+	if (!f)
+		return;
+
+	const bool ok = fwrite(s.data(), 1, s.size(), f) == s.size() && SyncFile(f);
+	if (fclose(f) != 0 || !ok)
+		return;
+
+	std::error_code ec;
+	std::filesystem::rename(tmp, t.State, ec);
+}
+
+bool DownloadManager::LoadState(Transfer& t)
+{
+	std::ifstream in(t.State, std::ios::binary);
+	if (!in)
+		return false;
+
+	std::string url, validator;
+	uint64_t size = 0;
+	std::vector<std::unique_ptr<Segment>> segs;
+
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		if (line.rfind("url ", 0) == 0)
+			url = line.substr(4);
+		else if (line.rfind("validator ", 0) == 0)
+			validator = line.substr(10);
+		else if (line.rfind("size ", 0) == 0)
+			size = strtoull(line.c_str() + 5, nullptr, 10);
+		else if (line.rfind("seg ", 0) == 0)
+		{
+			auto s = std::make_unique<Segment>();
+			unsigned long long b = 0, e = 0, d = 0;
+			if (sscanf(line.c_str() + 4, "%llu %llu %llu", &b, &e, &d) != 3)
+				return false;
+
+			s->Owner = &t;
+			s->Begin = b;
+			s->End = e;
+			s->Done = d;
+			segs.push_back(std::move(s));
+		}
+	}
+
+	// without a validator nothing proves the bytes on disk are the same file
+	if (url != t.Item.Url || !size || segs.empty() || validator.empty())
+		return false;
+	if (t.Item.ExpectedSize && t.Item.ExpectedSize != size)
+		return false;
+
+	std::error_code ec;
+	const uint64_t onDisk = std::filesystem::file_size(t.Part, ec);
+	if (ec)
+		return false;
+
+	// ranges must tile [0, size) and everything they claim must be on disk
+	uint64_t next = 0;
+	for (auto& s : segs)
+	{
+		if (s->Begin != next || s->End <= s->Begin || s->End > size || s->Done > s->End - s->Begin)
+			return false;
+		if (s->Done && s->Begin + s->Done > onDisk)
+			return false;
+
+		s->Complete = s->Begin + s->Done == s->End;
+		next = s->End;
+	}
+	if (next != size)
+		return false;
+
+	t.Size = size;
+	t.Validator = validator;
+	t.AcceptRanges = true;
+	t.Segments = std::move(segs);
+	return true;
+}
+
+// Forget partial data and go back to a single stream from byte 0
+void DownloadManager::Reset(Transfer& t)
+{
+	bytesDone -= t.Counted;
+	bytesTotal -= t.TotalAdded;
+	t.Counted = 0;
+	t.TotalAdded = 0;
+
+	t.Size = 0;
+	t.Validator.clear();
+	t.AcceptRanges = false;
+	t.Restart = false;
+	t.Result.BytesResumed = 0;
+
+	t.Segments.clear();
+	auto s = std::make_unique<Segment>();
+	s->Owner = &t;
+	t.Segments.push_back(std::move(s));
+}
+
+void DownloadManager::Discard(Transfer& t)
+{
+	std::error_code ec;
+	std::filesystem::remove(t.Part, ec);
+	std::filesystem::remove(t.State, ec);
+}
+
+// Ranges are only asked for with an If-Range validator: without one a file
+// that changed between requests would be stitched from two versions
+bool DownloadManager::Resumable(const Transfer& t) const
+{
+	return opt.Resume && !t.NoRanges && t.AcceptRanges && t.Size > 0 && !t.Validator.empty();
+}
+
+// ------------------------------------------------------------
+// Callbacks
+// ------------------------------------------------------------
+
+size_t DownloadManager::WriteBody(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+	auto* s = static_cast<Segment*>(userdata);
+	Transfer& t = *s->Owner;
+	const size_t n = size * nmemb;
+
+	if (s->Ignore)
+		return n;
+
+	size_t take = n;
+	if (s->End)
+	{
+		const uint64_t left = s->End - (s->Begin + s->Done);
+		if (left == 0)
+		{
+			s->Stop = true;
+			return 0;
+		}
+		take = (size_t)std::min<uint64_t>(n, left);
+	}
+
+	if (fwrite(ptr, 1, take, s->File) != take)
+	{
+		s->WriteFailed = true;
+		return 0; // curl reports CURLE_WRITE_ERROR
+	}
+
+	s->Done += take;
+	t.Counted += take;
+	t.Owner->bytesDone += take;
+
+	// the rest of this stream belongs to the next segment
+	if (take < n)
+	{
+		s->Stop = true;
+		return 0;
+	}
+	return n;
+}
+
+static bool HeaderIs(std::string_view line, std::string_view name, std::string_view& value)
+{
+	if (line.size() <= name.size() || line[name.size()] != ':')
+		return false;
+	for (size_t i = 0; i < name.size(); ++i)
+	{
+		if (std::tolower((unsigned char)line[i]) != name[i])
+			return false;
+	}
+
+	value = line.substr(name.size() + 1);
+	while (!value.empty() && (value.front() == ' ' || value.front() == '\t'))
+		value.remove_prefix(1);
+	while (!value.empty() && (value.back() == '\r' || value.back() == '\n' || value.back() == ' '))
+		value.remove_suffix(1);
+	return true;
+}
+
+size_t DownloadManager::ReadHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+	auto* s = static_cast<Segment*>(userdata);
+	const size_t n = size * nmemb;
+	std::string_view line(ptr, n);
+
+	// a new response (redirect, 100-continue) starts over
+	if (line.rfind("HTTP/", 0) == 0)
+	{
+		s->HdrLength = 0;
+		s->HdrRangeTotal = 0;
+		s->HdrAcceptRanges = false;
+		s->HdrETag.clear();
+		s->HdrLastModified.clear();
+		return n;
+	}
+
+	std::string_view v;
+	if (line == "\r\n" || line == "\n")
+	{
+		long http = 0;
+		curl_easy_getinfo(s->Easy, CURLINFO_RESPONSE_CODE, &http);
+		if (http < 200 || (http >= 300 && http < 400))
+			return n;
+
+		s->Owner->Owner->OnHeaders(*s, http);
+		return s->Owner->Restart ? 0 : n;
+	}
+	else if (HeaderIs(line, "content-length", v))
+		s->HdrLength = strtoull(std::string(v).c_str(), nullptr, 10);
+	else if (HeaderIs(line, "accept-ranges", v))
+		s->HdrAcceptRanges = v == "bytes";
+	else if (HeaderIs(line, "etag", v))
+		s->HdrETag = std::string(v);
+	else if (HeaderIs(line, "last-modified", v))
+		s->HdrLastModified = std::string(v);
+	else if (HeaderIs(line, "content-range", v))
+	{
+		// bytes <first>-<last>/<total>
+		const size_t slash = v.find('/');
+		if (slash != std::string_view::npos)
+			s->HdrRangeTotal = strtoull(std::string(v.substr(slash + 1)).c_str(), nullptr, 10);
+	}
+
+	return n;
+}
+
+void DownloadManager::OnHeaders(Segment& s, long http)
+{
+	Transfer& t = *s.Owner;
+
+	if (http >= 400)
+	{
+		s.Ignore = true;
+		return;
+	}
+
+	if (s.Ranged)
+	{
+		// 200 to a ranged request: the server ignored Range, or If-Range
+		// failed because the file changed since the state was written
+		if (http != 206 || (t.Size && s.HdrRangeTotal && s.HdrRangeTotal != t.Size))
+			t.Restart = true;
+		return;
+	}
+
+	// a whole-file response tells us what the file is
+	t.Size = s.HdrLength;
+	t.Validator = !s.HdrETag.empty() ? s.HdrETag : s.HdrLastModified;
+	t.AcceptRanges = s.HdrAcceptRanges && !t.NoRanges;
+
+	// weak validators can't guard a byte range
+	if (t.Validator.rfind("W/", 0) == 0)
+		t.Validator.clear();
+
+	if (!t.Item.ExpectedSize && !t.TotalAdded && t.Size)
+	{
+		t.TotalAdded = t.Size;
+		bytesTotal += t.TotalAdded;
+	}
+
+	// bound the stream so the state records a real range
+	if (t.Size && t.Segments.size() == 1)
+		t.Segments[0]->End = t.Size;
+
+	if (Resumable(t) && opt.MaxSegments > 1 && t.Size >= opt.SplitThreshold && t.Segments.size() == 1)
+		Split(t);
+
+	SaveState(t);
+}
+
+int DownloadManager::XferInfo(void* clientp, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+{
+	auto* s = static_cast<Segment*>(clientp);
+	const DownloadManager* m = s->Owner->Owner;
+	return (m->opt.Cancel && m->opt.Cancel->load()) ? 1 : 0;
+}
+
+// ------------------------------------------------------------
+// Attempts
+// ------------------------------------------------------------
+
+// The first stream keeps running and stops at the end of its share;
+// the remaining shares are queued as ranged requests
+void DownloadManager::Split(Transfer& t)
+{
+	const uint64_t parts = std::min<uint64_t>((uint64_t)opt.MaxSegments,
+		std::max<uint64_t>(1, t.Size / std::max<uint64_t>(1, opt.SplitThreshold / 2)));
+	if (parts < 2)
+		return;
+
+	const uint64_t share = (t.Size + parts - 1) / parts;
+
+	Segment& first = *t.Segments[0];
+	first.End = share;
+
+	for (uint64_t b = share; b < t.Size; b += share)
+	{
+		auto s = std::make_unique<Segment>();
+		s->Owner = &t;
+		s->Begin = b;
+		s->End = std::min(t.Size, b + share);
+
+		pendingSegs.push_back(s.get());
+		t.Outstanding++;
+		t.Segments.push_back(std::move(s));
+	}
+
+	t.Result.Segments = (int)t.Segments.size();
+}
+
+// Sets up a file for its next attempt and queues its unfinished segments
+bool DownloadManager::Begin(Transfer& t)
+{
+	t.Result.Attempts++;
+	t.Failed = false;
+	t.LocalError = false;
+	t.LastCode = CURLE_OK;
+	t.LastHttp = 0;
+
+	std::error_code ec;
+	if (t.Item.Path.has_parent_path())
+		std::filesystem::create_directories(t.Item.Path.parent_path(), ec);
+
+	bool resume = false;
+	if (t.Result.Attempts == 1)
+	{
+		t.Segments.clear();
+		resume = opt.Resume && LoadState(t);
+		if (resume)
+		{
+			for (const auto& s : t.Segments)
+				t.Counted += s->Done;
+			bytesDone += t.Counted;
+			t.Result.BytesResumed = t.Counted;
+
+			if (!t.Item.ExpectedSize)
+			{
+				t.TotalAdded = t.Size;
+				bytesTotal += t.TotalAdded;
+			}
+		}
+	}
+	else
+	{
+		// retry: keep what the earlier attempt got if the server can continue it
+		resume = Resumable(t);
+	}
+
+	if (!resume)
+	{
+		Discard(t);
+		Reset(t);
+	}
+
+	// make sure the file exists for the r+b opens of each segment
+	if (!resume || !std::filesystem::exists(t.Part, ec))
+	{
+		FILE* f = OpenPart(t.Part, true);
+		if (!f)
+		{
+			t.Result.Error = "cannot open " + t.Part.string();
+			return false;
+		}
+		fclose(f);
+
+		if (resume)
+		{
+			Reset(t);
+			std::filesystem::remove(t.State, ec);
+		}
+	}
+
+	t.Result.Segments = (int)t.Segments.size();
+
+	for (auto& s : t.Segments)
+	{
+		if (s->Complete)
+			continue;
+
+		pendingSegs.push_back(s.get());
+		t.Outstanding++;
+	}
+
+	// everything was already on disk
+	if (!t.Outstanding)
+		EndAttempt(t);
+	return true;
+}
+
+void DownloadManager::StartSegment(Segment& s)
+{
+	Transfer& t = *s.Owner;
+
+	// a sibling found the file changed; this range would be thrown away
+	if (t.Restart)
+	{
+		if (--t.Outstanding == 0)
+			EndAttempt(t);
+		return;
+	}
+
+	s.Stop = false;
+	s.Ignore = false;
+	s.WriteFailed = false;
+
+	s.File = OpenPart(t.Part, false);
+	if (!s.File || !SeekTo(s.File, s.Begin + s.Done))
+	{
+		if (s.File)
+			fclose(s.File);
+		s.File = nullptr;
+
+		t.Failed = true;
+		t.LocalError = true;
+		t.Result.Error = "cannot open " + t.Part.string();
+		if (--t.Outstanding == 0)
+			EndAttempt(t);
+		return;
+	}
+
+	s.Easy = NewEasy(t.Item.Url);
+	if (!s.Easy)
+	{
+		fclose(s.File);
+		s.File = nullptr;
+
+		t.Failed = true;
+		t.Result.Error = "curl_easy_init failed";
+		if (--t.Outstanding == 0)
+			EndAttempt(t);
+		return;
+	}
+
+	curl_easy_setopt(s.Easy, CURLOPT_PRIVATE, &s);
+	curl_easy_setopt(s.Easy, CURLOPT_WRITEFUNCTION, WriteBody);
+	curl_easy_setopt(s.Easy, CURLOPT_WRITEDATA, &s);
+	curl_easy_setopt(s.Easy, CURLOPT_HEADERFUNCTION, ReadHeader);
+	curl_easy_setopt(s.Easy, CURLOPT_HEADERDATA, &s);
+	curl_easy_setopt(s.Easy, CURLOPT_XFERINFOFUNCTION, XferInfo);
+	curl_easy_setopt(s.Easy, CURLOPT_XFERINFODATA, &s);
+	curl_easy_setopt(s.Easy, CURLOPT_NOPROGRESS, 0L);
+	curl_easy_setopt(s.Easy, CURLOPT_CONNECTTIMEOUT, opt.ConnectTimeoutSec);
+	curl_easy_setopt(s.Easy, CURLOPT_LOW_SPEED_LIMIT, 1L);
+	curl_easy_setopt(s.Easy, CURLOPT_LOW_SPEED_TIME, opt.StallTimeoutSec);
+
+	// resumed or split: ask for the missing bytes only, and only if the file is
+	// still the one the state describes
+	const uint64_t from = s.Begin + s.Done;
+	s.Ranged = from > 0 || s.End > 0;
+	if (s.Ranged)
+	{
+		const std::string range = s.End
+			? std::to_string(from) + "-" + std::to_string(s.End - 1)
+			: std::to_string(from) + "-";
+		curl_easy_setopt(s.Easy, CURLOPT_RANGE, range.c_str());
+
+		s.Headers = curl_slist_append(nullptr, ("If-Range: " + t.Validator).c_str());
+		curl_easy_setopt(s.Easy, CURLOPT_HTTPHEADER, s.Headers);
+	}
+
+	// wait for the h2 connection to come up and multiplex on it
+	// instead of opening one connection per queued file
+	if (opt.Http2 && Http2Available())
+		curl_easy_setopt(s.Easy, CURLOPT_PIPEWAIT, 1L);
+	else
+		curl_easy_setopt(s.Easy, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_1_1);
+
+	curl_multi_add_handle(multi, s.Easy);
+	active++;
+}
+
+bool DownloadManager::ShouldRetry(const Transfer& t) const
+{
+	if (t.Result.Attempts > opt.MaxRetries || t.LocalError)
+		return false;
+	if (opt.Cancel && opt.Cancel->load())
+		return false;
+
+	const long http = t.LastHttp;
+	switch (t.LastCode)
+	{
+	case CURLE_OK:
+		return http == 408 || http == 429 || http >= 500;
+	case CURLE_COULDNT_RESOLVE_HOST:
+	case CURLE_COULDNT_CONNECT:
+	case CURLE_OPERATION_TIMEDOUT:
+	case CURLE_PARTIAL_FILE:
+	case CURLE_GOT_NOTHING:
+	case CURLE_SEND_ERROR:
+	case CURLE_RECV_ERROR:
+	case CURLE_SSL_CONNECT_ERROR:
+	case CURLE_HTTP2:
+	case CURLE_HTTP2_STREAM:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void DownloadManager::FinishSegment(Segment& s, CURLcode code)
+{
+	Transfer& t = *s.Owner;
+
+	long http = 0;
+	curl_easy_getinfo(s.Easy, CURLINFO_RESPONSE_CODE, &http);
+
+	curl_off_t retryAfter = 0;
+	curl_easy_getinfo(s.Easy, CURLINFO_RETRY_AFTER, &retryAfter);
+	if (retryAfter > 0)
+		t.RetryAt = Clock::now() + std::chrono::seconds(retryAfter);
+
+	curl_multi_remove_handle(multi, s.Easy);
+	curl_easy_cleanup(s.Easy);
+	s.Easy = nullptr;
+	curl_slist_free_all(s.Headers);
+	s.Headers = nullptr;
+	active--;
+
+	// a segment that may be complete goes to disk before Finalize renames the
+	// part file into place, so the rename can never expose a short file
+	const bool finished = !s.Ignore && !s.WriteFailed && (code == CURLE_OK || s.Stop);
+	const bool synced = !finished || SyncFile(s.File);
+	const bool closed = fclose(s.File) == 0 && synced;
+	s.File = nullptr;
+
+	// an open-ended stream is complete when curl says so; a bounded one when it
+	// has every byte of its range (cutting it off at End is not an error)
+	const bool whole = s.End ? s.Begin + s.Done == s.End : code == CURLE_OK;
+	s.Complete = !s.Ignore && !s.WriteFailed && closed && http < 400 && whole &&
+		(code == CURLE_OK || s.Stop);
+
+	if (!s.Complete && !t.Restart)
+	{
+		t.Failed = true;
+		t.LastCode = code;
+		t.LastHttp = http;
+		t.LocalError |= s.WriteFailed || !closed;
+
+		if (s.WriteFailed || !closed)
+			t.Result.Error = "write failed " + t.Part.string();
+		else if (code != CURLE_OK && !s.Stop)
+			t.Result.Error = curl_easy_strerror(code);
+		else if (http >= 400)
+			t.Result.Error = "http " + std::to_string(http);
+		else
+			t.Result.Error = "short read";
+	}
+
+	t.Result.Http = http;
+	t.Result.Curl = (int)code;
+
+	if (--t.Outstanding == 0)
+		EndAttempt(t);
+}
+
+bool DownloadManager::Finalize(Transfer& t)
+{
+	std::error_code ec;
+
+	// a size we were told about must match what we assembled
+	const uint64_t expect = t.Size ? t.Size : t.Item.ExpectedSize;
+	if (expect && std::filesystem::file_size(t.Part, ec) != expect)
+	{
+		t.Result.Error = "size mismatch";
+		return false;
+	}
+
+	// every segment synced its data in FinishSegment; this makes the rename durable
+	if (!WriteBehind::ReplaceDurable(t.Part, t.Item.Path))
+	{
+		t.Result.Error = "cannot finalize " + t.Item.Path.string();
+		return false;
+	}
+
+	std::filesystem::remove(t.State, ec);
+
+	// no Content-Length (chunked) on a file nobody gave us a size for
+	if (!t.Item.ExpectedSize && !t.TotalAdded)
+	{
+		t.TotalAdded = t.Counted;
+		bytesTotal += t.TotalAdded;
+	}
+
+	t.Result.Ok = true;
+	t.Result.Bytes = t.Counted;
+	t.Result.Error.clear();
+	return true;
+}
+
+// All segments of this attempt are back
+void DownloadManager::EndAttempt(Transfer& t)
+{
+	if (t.Restart)
+	{
+		// not an error; the server can't continue this file, fetch it whole
+		t.NoRanges = true;
+		t.Result.Attempts--;
+		Discard(t);
+		Reset(t);
+		pendingFiles.push_front(&t);
+		return;
+	}
+
+	bool complete = !t.Failed;
+	for (const auto& s : t.Segments)
+		complete &= s->Complete;
+
+	if (complete)
+	{
+		if (Finalize(t))
+		{
+			filesDone++;
+			return;
+		}
+
+		// assembled but wrong: nothing of it is worth resuming
+		t.LastCode = CURLE_OK;
+		t.LastHttp = 0;
+		t.LocalError = true;
+		Discard(t);
+		Reset(t);
+		filesFailed++;
+		return;
+	}
+
+	if (ShouldRetry(t))
+	{
+		SaveState(t);
+		if (!Resumable(t))
+		{
+			Discard(t);
+			Reset(t);
+		}
+
+		int64_t delay = (int64_t)opt.BackoffMs << std::min(t.Result.Attempts - 1, 16);
+		delay = std::min<int64_t>(delay, opt.MaxBackoffMs);
+
+		const auto at = Clock::now() + std::chrono::milliseconds(delay);
+		t.RetryAt = std::max(at, std::min(t.RetryAt, Clock::now() + std::chrono::milliseconds(opt.MaxBackoffMs)));
+
+		waiting.push_back(&t);
+		retries++;
+		return;
+	}
+
+	// Out of attempts on a transient error (or cancelled): keep the partial file
+	// for the next run. A definite answer (404, disk error) drops it.
+	const bool cancelled = opt.Cancel && opt.Cancel->load();
+	const bool transient = !t.LocalError && (cancelled ||
+		t.LastCode != CURLE_OK || t.LastHttp == 408 || t.LastHttp == 429 || t.LastHttp >= 500);
+	if (transient && Resumable(t))
+		SaveState(t);
+	else
+		Discard(t);
+
+	Reset(t);
+	filesFailed++;
+}
+
+// ------------------------------------------------------------
+// Run loop
+// ------------------------------------------------------------
+
+bool DownloadManager::Run(std::vector<DownloadResult>* results)
+{
+	if (!multi)
+	{
+		multi = curl_multi_init();
+		if (!multi)
+			return false;
+
+		curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)opt.MaxConcurrent);
+		curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)opt.MaxPerHost);
+		curl_multi_setopt(multi, CURLMOPT_PIPELINING, (long)CURLPIPE_MULTIPLEX);
+	}
+
+	std::vector<std::unique_ptr<Transfer>> all;
+	all.reserve(queue.size());
+	for (auto& item : queue)
+	{
+		auto t = std::make_unique<Transfer>();
+		t->Owner = this;
+		t->Result.Path = item.Path;
+		t->Item = std::move(item);
+		t->Part = t->Item.Path;
+		t->Part += ".part";
+		t->State = StatePath(t->Item.Path);
+
+		bytesTotal += t->Item.ExpectedSize;
+		all.push_back(std::move(t));
+	}
+	queue.clear();
+
+	filesTotal += all.size();
+	startTicks = NowTicks();
+	endTicks = 0;
+
+	pendingFiles.clear();
+	pendingSegs.clear();
+	waiting.clear();
+	for (auto& t : all)
+		pendingFiles.push_back(t.get());
+
+	auto lastProgress = Clock::now();
+	auto lastState = Clock::now();
+	const auto interval = std::chrono::milliseconds(progressIntervalMs);
+
+	for (;;)
+	{
+		const auto now = Clock::now();
+		const bool cancelled = opt.Cancel && opt.Cancel->load();
+
+		for (size_t i = 0; i < waiting.size();)
+		{
+			if (cancelled || waiting[i]->RetryAt <= now)
+			{
+				pendingFiles.push_back(waiting[i]);
+				waiting[i] = waiting.back();
+				waiting.pop_back();
+			}
+			else
+				++i;
+		}
+
+		if (cancelled)
+		{
+			// segments already on a file end that attempt; the file keeps its state
+			while (!pendingSegs.empty())
+			{
+				Segment* s = pendingSegs.front();
+				pendingSegs.pop_front();
+				s->Owner->Failed = true;
+				if (--s->Owner->Outstanding == 0)
+					EndAttempt(*s->Owner);
+			}
+
+			for (Transfer* t : pendingFiles)
+			{
+				t->Result.Error = "cancelled";
+				filesFailed++;
+			}
+			pendingFiles.clear();
+		}
+
+		while (active < opt.MaxConcurrent && (!pendingSegs.empty() || !pendingFiles.empty()))
+		{
+			if (!pendingSegs.empty())
+			{
+				Segment* s = pendingSegs.front();
+				pendingSegs.pop_front();
+				StartSegment(*s);
+				continue;
+			}
+
+			Transfer* t = pendingFiles.front();
+			pendingFiles.pop_front();
+			if (!Begin(*t))
+				filesFailed++;
+		}
+
+		if (active == 0 && pendingSegs.empty() && pendingFiles.empty() && waiting.empty())
+			break;
+
+		int running = 0;
+		curl_multi_perform(multi, &running);
+
+		int left = 0;
+		while (CURLMsg* msg = curl_multi_info_read(multi, &left))
+		{
+			if (msg->msg != CURLMSG_DONE)
+				continue;
+
+			Segment* s = nullptr;
+			curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char**)&s);
+			FinishSegment(*s, msg->data.result);
+		}
+
+		// checkpoint long transfers so a crash or kill resumes close to where it was
+		if (opt.Resume && Clock::now() - lastState >= std::chrono::seconds(1))
+		{
+			lastState = Clock::now();
+			for (auto& t : all)
+			{
+				if (t->Outstanding && Resumable(*t))
+					SaveState(*t);
+			}
+		}
+
+		if (onProgress && Clock::now() - lastProgress >= interval)
+		{
+			lastProgress = Clock::now();
+			onProgress(Progress());
+		}
+
+		// sleep until there's socket activity, a retry is due or it's time to check cancel
+		int timeoutMs = 100;
+		for (Transfer* t : waiting)
+		{
+			const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t->RetryAt - Clock::now()).count();
+			timeoutMs = (int)std::clamp<int64_t>(ms, 0, timeoutMs);
+		}
+
+		// a finished transfer freed a slot for queued work, or the batch is done:
+		// go round again now instead of sleeping
+		if ((active < opt.MaxConcurrent && (!pendingSegs.empty() || !pendingFiles.empty())) ||
+			(active == 0 && waiting.empty()))
+			timeoutMs = 0;
+
+		if (active > 0)
+			curl_multi_poll(multi, nullptr, 0, timeoutMs, nullptr);
+		else if (timeoutMs > 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+	}
+
+	endTicks = NowTicks();
+
+	if (onProgress)
+		onProgress(Progress());
+
+	bool ok = true;
+	for (auto& t : all)
+	{
+		ok &= t->Result.Ok;
+		if (results)
+			results->push_back(std::move(t->Result));
+	}
+	return ok;
+}
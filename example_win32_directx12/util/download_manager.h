@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "curl.h"
+
+// Parallel downloads on the curl multi interface.
+// All handles share one DNS / TLS session / connection cache, so a batch of
+// small files from the same host costs one handshake instead of one each, and
+// on HTTP/2 the transfers are multiplexed over that connection. Files are
+// written to <path>.part and renamed into place when complete; transient
+// failures (connect/recv errors, 408/429/5xx) are retried with backoff.
+//
+// A <path>.part.state sidecar records the file's size, validator and how far
+// each byte range got, so a retry or the next run resumes with Range requests
+// instead of starting over. Large files from servers that accept ranges are
+// split into parallel ranges once the first response reveals the size.
+// Every range request carries If-Range, so a file the server sent without an
+// ETag or Last-Modified is never resumed or split, only fetched whole.
+
+struct DownloadOptions
+{
+	int MaxConcurrent = 8;          // transfers in flight
+	int MaxPerHost = 0;             // connections per host, 0 = MaxConcurrent
+	int MaxRetries = 3;             // extra attempts after the first
+	int BackoffMs = 250;            // first retry delay, doubled per attempt
+	int MaxBackoffMs = 8000;
+	long ConnectTimeoutSec = 15;
+	long StallTimeoutSec = 30;      // abort a transfer that sends nothing for this long
+	bool Http2 = true;              // ignored if libcurl was built without it
+	bool Resume = true;             // keep .part + state across attempts and runs
+	uint64_t SplitThreshold = 4ull << 20;   // files at least this big are split
+	int MaxSegments = 4;            // parallel ranges per file
+	const std::atomic<bool>* Cancel = nullptr;
+};
+
+struct DownloadItem
+{
+	std::string Url;
+	std::filesystem::path Path;
+	uint64_t ExpectedSize = 0;      // 0 = unknown until the response headers arrive
+};
+
+struct DownloadResult
+{
+	std::filesystem::path Path;
+	bool Ok = false;
+	long Http = 0;
+	int Curl = 0;                   // CURLcode of the last attempt
+	int Attempts = 0;
+	uint64_t Bytes = 0;
+	uint64_t BytesResumed = 0;      // already on disk from an earlier attempt or run
+	int Segments = 1;
+	std::string Error;
+};
+
+// Snapshot of the whole batch; safe to read from another thread
+struct DownloadProgress
+{
+	uint64_t FilesTotal = 0;
+	uint64_t FilesDone = 0;
+	uint64_t FilesFailed = 0;
+	uint64_t BytesDone = 0;
+	uint64_t BytesTotal = 0;        // only counts files whose size is known so far
+	uint64_t Retries = 0;
+	int Active = 0;                 // transfers (ranges) in flight
+	double Seconds = 0.0;
+};
+
+class DownloadManager
+{
+public:
+	explicit DownloadManager(const DownloadOptions& options = {});
+	~DownloadManager();
+
+	DownloadManager(const DownloadManager&) = delete;
+	DownloadManager& operator=(const DownloadManager&) = delete;
+
+	void Add(DownloadItem item);
+
+	// Runs the queue to completion on the calling thread.
+	// Returns true if every file was downloaded.
+	bool Run(std::vector<DownloadResult>* results = nullptr);
+
+	DownloadProgress Progress() const;
+
+	// Called from Run() at most every intervalMs and once at the end
+	void SetProgressCallback(std::function<void(const DownloadProgress&)> cb, int intervalMs = 250);
+
+	// Easy handle wired to the shared cache with the common options set;
+	// for one-off requests (API listings) that should reuse the same connections
+	static CURL* NewEasy(const std::string& url);
+
+	static bool Http2Available();
+
+	static std::filesystem::path StatePath(const std::filesystem::path& path);
+
+private:
+	struct Transfer;
+	struct Segment;
+
+	bool Begin(Transfer& t);
+	void Reset(Transfer& t);
+	void StartSegment(Segment& s);
+	void FinishSegment(Segment& s, CURLcode code);
+	void EndAttempt(Transfer& t);
+	void Split(Transfer& t);
+	bool Finalize(Transfer& t);
+	bool Resumable(const Transfer& t) const;
+	bool ShouldRetry(const Transfer& t) const;
+
+	bool LoadState(Transfer& t);
+	void SaveState(Transfer& t);
+	void Discard(Transfer& t);
+
+	static int XferInfo(void* clientp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t, curl_off_t);
+	static size_t WriteBody(char* ptr, size_t size, size_t nmemb, void* userdata);
+	static size_t ReadHeader(char* ptr, size_t size, size_t nmemb, void* userdata);
+	void OnHeaders(Segment& s, long http);
+
+	DownloadOptions opt;
+	std::vector<DownloadItem> queue;
+
+	// Run() state; ranges of files already started go ahead of new files
+	std::deque<Transfer*> pendingFiles;
+	std::deque<Segment*> pendingSegs;
+	std::vector<Transfer*> waiting;   // failed, backing off before a retry
+
+	std::function<void(const DownloadProgress&)> onProgress;
+	int progressIntervalMs = 250;
+
+	CURLM* multi = nullptr;
+
+	std::atomic<uint64_t> filesTotal{ 0 };
+	std::atomic<uint64_t> filesDone{ 0 };
+	std::atomic<uint64_t> filesFailed{ 0 };
+	std::atomic<uint64_t> bytesDone{ 0 };
+	std::atomic<uint64_t> bytesTotal{ 0 };
+	std::atomic<uint64_t> retries{ 0 };
+	std::atomic<int> active{ 0 };
+	std::atomic<int64_t> startTicks{ 0 };
+	std::atomic<int64_t> endTicks{ 0 };
+};
@@ -0,0 +1,4264 @@
+// File: 'embedded.hvkpack' (231478 bytes)
+// Exported using binary_to_compressed_c.exe -u8 "embedded.hvkpack" g_EmbeddedAssets
+extern const unsigned int g_EmbeddedAssets_size = 231478;
+alignas(64) extern const unsigned char g_EmbeddedAssets_data[231478] =
+{
+    72,86,75,80,65,67,75,0,1,0,64,0,25,0,0,0,64,129,3,0,0,0,0,0,246,6,0,0,0,0,0,0,67,90,229,114,192,255,253,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,
+    0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,243,243,243,232,232,232,224,224,224,222,222,222,220,220,220,
+    218,218,218,217,217,217,216,216,216,212,212,212,201,201,201,190,190,190,187,187,187,184,184,184,182,182,182,181,181,181,180,180,180,174,174,174,158,158,158,150,150,150,148,148,148,
+    147,147,147,145,145,145,144,144,144,142,142,142,135,135,135,125,125,125,117,117,117,113,113,113,112,112,112,110,110,110,109,109,109,108,108,108,106,106,106,102,102,102,94,94,94,88,
+    88,88,82,82,82,74,74,74,67,67,67,60,60,60,55,55,55,50,50,50,42,42,42,37,37,37,36,36,36,34,34,34,31,31,31,28,28,28,26,26,26,24,24,24,20,20,20,16,16,16,14,14,14,11,11,11,8,8,8,6,6,6,
+    4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,14,219,183,246,0,0,12,219,73,68,65,84,120,218,237,157,233,86,226,74,20,70,177,53,32,2,9,83,80,102,20,2,132,73,134,0,17,147,170,247,127,171,91,1,50,65,
+    104,81,210,92,82,126,251,71,187,86,211,13,107,177,253,106,58,39,73,140,2,174,137,225,43,128,96,0,193,0,130,1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,8,6,16,12,32,
+    24,64,48,128,96,0,193,0,130,1,4,67,48,128,96,0,193,0,130,1,4,3,8,6,16,12,193,0,130,1,4,3,8,6,16,12,32,24,64,48,4,3,8,6,16,12,32,24,64,48,128,96,0,193,0,130,33,24,64,48,128,96,0,193,
+    0,130,1,4,3,8,134,96,0,193,0,130,1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,0,193,16,12,32,24,64,112,196,32,134,97,18,8,230,22,115,103,153,64,240,205,242,169,235,
+    198,5,255,125,173,42,131,53,18,124,187,35,236,114,246,254,62,211,54,63,252,223,155,94,250,62,118,159,110,124,114,149,225,24,79,126,39,147,247,247,201,100,254,249,179,241,89,185,143,
+    253,185,255,19,187,171,81,8,190,73,244,247,29,19,237,39,126,201,60,117,119,255,231,207,253,253,157,240,190,159,141,33,248,182,88,78,246,134,167,250,79,2,92,143,49,191,140,251,88,19,
+    130,111,114,132,158,219,130,39,115,243,251,126,181,148,35,184,10,193,55,137,102,11,126,159,44,127,30,96,38,184,6,193,55,201,202,17,252,237,65,154,205,192,79,119,251,0,223,61,12,33,
+    248,38,49,230,110,132,191,57,72,155,180,230,6,56,111,240,180,140,230,105,31,172,79,157,8,79,86,223,243,187,72,218,1,254,243,208,229,41,192,124,157,100,105,158,65,250,227,59,235,51,
+    243,229,206,9,176,180,198,62,248,86,217,204,220,65,122,65,190,17,224,145,224,6,88,229,42,192,156,157,69,175,223,93,206,31,164,9,125,113,103,224,2,225,171,218,192,151,96,226,217,42,
+    77,55,103,7,120,24,119,2,124,63,224,43,192,188,149,11,63,61,131,180,118,166,41,98,202,110,128,139,6,202,133,183,189,25,246,12,210,235,115,3,44,184,123,96,222,2,204,157,96,178,112,35,
+    60,59,167,172,196,166,220,162,39,192,20,29,29,55,206,135,103,51,124,78,89,201,36,234,131,187,132,30,242,22,96,14,91,118,190,57,72,155,180,194,241,12,204,163,96,211,115,98,57,51,190,
+    246,59,74,112,122,10,205,171,96,223,32,253,85,132,9,49,184,158,129,249,236,170,92,77,206,158,133,9,93,166,220,0,143,78,4,152,68,248,240,131,71,193,238,32,253,101,97,216,164,115,103,
+    137,21,43,5,251,221,181,74,155,16,124,213,221,144,241,183,47,220,41,43,77,244,179,5,223,223,9,129,1,38,236,239,86,218,79,91,53,33,248,103,17,93,205,103,179,197,250,180,227,125,123,
+    214,100,254,213,34,203,29,162,239,99,114,208,12,204,62,99,86,151,210,233,162,106,64,240,181,48,180,137,197,251,98,125,106,102,52,181,119,235,95,204,190,172,25,18,98,178,93,146,69,76,
+    24,31,7,152,197,87,87,68,65,136,199,133,68,211,32,16,124,221,69,212,228,93,251,56,241,165,147,213,98,62,95,158,49,174,178,8,23,98,22,15,237,227,0,51,225,227,242,83,252,41,153,76,62,
+    37,82,209,60,197,140,160,96,239,105,228,116,113,42,164,228,204,203,200,8,93,213,10,162,84,28,30,249,101,241,221,40,153,248,99,242,209,226,73,168,67,240,117,216,76,221,198,13,166,88,
+    211,47,252,125,57,185,254,162,163,98,50,190,211,203,4,63,84,33,248,58,120,74,130,161,40,182,214,201,187,63,124,147,51,93,119,210,194,163,237,23,130,175,200,194,39,120,171,248,227,194,
+    20,147,160,248,198,227,79,143,14,79,66,19,130,175,132,62,61,48,28,130,226,163,197,243,107,90,72,38,61,126,227,233,17,4,95,109,25,125,100,56,84,197,204,163,90,72,36,60,122,147,73,33,
+    221,163,216,38,93,47,195,90,160,226,207,80,226,203,118,78,205,195,248,198,139,131,136,22,34,162,122,22,173,47,2,20,207,67,49,76,251,5,33,241,228,139,111,70,209,163,90,104,138,108,177,
+    129,232,139,247,163,169,120,121,249,219,154,31,181,84,220,27,223,100,60,81,28,163,216,240,255,164,248,64,241,25,5,254,175,119,197,13,127,124,31,89,124,87,212,64,185,240,38,20,79,55,
+    23,251,157,166,61,155,163,36,155,125,43,51,26,229,62,143,136,215,131,137,62,247,40,62,175,143,242,111,24,180,43,120,252,38,4,169,183,161,145,190,119,86,228,11,254,100,237,42,254,206,
+    5,73,167,4,43,142,224,100,50,158,170,78,105,196,219,180,56,232,232,48,108,197,147,169,78,47,79,176,61,66,63,197,5,177,79,105,212,111,125,199,69,203,142,177,154,91,245,223,217,234,226,
+    119,50,233,56,189,93,99,37,159,132,116,109,126,116,68,13,193,255,19,230,122,185,92,133,209,86,67,104,59,110,21,128,227,66,97,72,121,104,162,197,189,42,15,5,111,234,105,65,16,50,53,
+    141,114,113,99,82,8,62,102,209,109,119,53,202,73,15,60,4,7,132,120,251,39,39,61,240,16,28,96,216,52,249,185,109,52,4,115,14,4,67,48,128,96,0,193,0,130,191,191,220,181,129,71,78,4,255,
+    79,58,137,181,113,218,67,32,248,42,59,85,227,115,195,248,208,166,147,241,104,188,252,39,31,225,226,123,193,132,224,127,199,106,62,26,14,84,181,223,239,245,186,221,174,162,40,237,246,
+    107,171,213,234,168,31,97,247,196,249,52,234,218,140,253,30,177,143,30,168,195,85,196,186,239,162,36,216,28,118,218,173,86,179,177,165,105,209,122,221,210,106,244,63,67,206,47,37,195,
+    174,210,121,107,212,107,213,74,73,202,164,211,233,84,42,245,244,248,152,42,168,209,50,28,29,193,132,12,91,150,208,55,47,59,193,236,199,36,212,175,157,208,137,108,213,148,24,15,12,235,
+    2,225,120,34,145,176,250,0,132,244,56,82,163,116,100,4,19,170,181,91,123,161,71,188,53,250,225,126,214,84,122,72,88,87,5,239,73,238,217,54,2,20,34,117,67,233,8,9,30,55,78,249,101,130,
+    123,36,204,177,194,40,63,164,60,173,209,94,146,137,84,164,46,82,138,144,224,81,253,47,130,251,161,126,212,50,19,63,225,247,49,249,152,82,33,248,234,9,110,141,66,28,54,77,58,75,255,
+    77,240,0,130,255,137,224,153,207,175,111,169,85,239,134,185,79,34,116,113,58,193,79,66,102,129,57,248,159,8,222,244,27,175,238,226,217,218,37,53,246,188,246,151,225,126,212,71,81,240,
+    93,125,182,227,201,90,116,197,31,163,117,29,105,132,182,73,84,239,183,119,91,96,182,93,106,43,138,210,237,118,123,189,94,191,175,142,73,184,223,57,161,106,74,176,215,207,143,143,108,
+    131,20,143,239,247,76,66,170,30,173,110,158,104,157,100,205,134,131,225,112,56,26,143,167,218,102,179,249,252,52,236,179,97,18,246,47,83,47,189,243,41,8,137,100,42,149,78,103,50,82,
+    190,80,168,212,67,157,236,33,248,108,31,225,191,227,180,93,169,86,91,170,58,24,88,191,81,147,185,182,92,233,81,188,159,97,20,171,73,215,40,41,5,191,63,57,172,60,64,112,100,97,131,63,
+    49,13,195,176,171,132,81,173,59,67,48,231,64,48,4,3,8,6,16,12,32,248,194,253,19,100,242,43,248,159,28,103,65,240,13,233,213,23,243,85,88,134,185,186,184,144,7,193,132,110,70,221,118,
+    91,81,87,97,142,6,4,130,111,38,190,90,223,170,47,181,26,221,112,90,90,103,3,117,48,231,70,113,44,242,122,141,81,167,185,173,16,183,27,161,220,17,182,87,144,68,169,168,204,41,238,209,
+    113,19,126,103,189,214,190,217,242,173,169,92,92,238,33,164,39,73,185,92,86,18,139,157,53,23,138,163,44,152,13,162,31,106,187,225,116,241,180,218,151,54,211,16,170,21,164,124,54,155,
+    205,229,36,241,185,203,195,64,29,139,116,124,23,189,198,171,219,169,213,234,44,47,20,108,210,129,148,203,110,201,229,196,76,209,106,5,138,184,226,88,132,245,174,6,237,166,167,17,175,
+    221,232,153,23,191,105,39,147,207,238,201,229,69,177,216,251,136,184,226,88,100,253,146,169,210,240,94,234,240,214,106,141,47,93,100,153,84,21,115,89,7,150,98,73,86,180,72,207,197,
+    17,189,124,148,208,181,250,230,187,146,229,173,217,25,94,190,198,178,231,96,71,113,150,173,168,187,81,86,28,139,102,124,233,88,105,190,250,226,219,84,102,97,188,179,209,201,176,224,
+    122,21,179,229,150,220,213,41,158,217,112,77,191,75,245,173,233,143,111,123,16,202,99,51,216,186,188,157,23,125,33,182,20,75,213,254,18,79,93,185,158,223,105,167,113,16,223,222,44,
+    180,136,145,81,173,112,148,98,81,172,76,241,220,164,107,249,157,119,124,241,125,221,206,190,97,45,117,201,86,241,81,138,243,153,146,70,209,116,119,157,5,86,191,222,246,45,158,187,139,
+    80,103,72,211,186,151,64,53,47,102,189,33,206,230,197,30,30,109,119,157,0,175,58,238,242,249,141,197,119,180,9,120,244,239,69,37,63,38,114,51,56,80,156,207,188,66,240,117,4,107,157,
+    150,39,190,253,128,248,18,223,143,175,222,208,106,128,38,129,138,115,30,197,249,76,3,130,175,35,88,87,236,234,194,107,67,25,27,199,30,217,44,173,246,250,131,243,230,204,19,191,12,100,
+    167,56,235,40,206,103,218,16,124,37,195,234,110,14,102,59,37,117,73,131,252,14,171,114,177,40,215,206,57,216,98,91,174,94,189,30,116,249,233,86,177,90,149,196,237,138,154,237,149,84,
+    8,190,214,36,172,88,21,164,86,83,25,7,13,195,132,142,43,165,10,67,174,126,157,97,66,71,69,49,147,17,139,65,55,71,218,41,174,72,162,148,205,74,153,154,142,75,87,174,133,214,107,191,
+    190,117,84,61,112,111,68,54,45,185,242,194,40,203,95,94,170,205,126,25,10,98,158,33,22,166,65,249,220,43,46,72,185,66,99,141,125,240,245,50,252,169,205,102,203,224,171,190,89,38,95,
+    202,47,59,193,173,207,131,13,214,209,210,218,172,237,170,71,121,177,186,14,12,168,165,88,31,15,71,83,19,39,89,215,52,124,114,149,76,200,71,171,100,11,110,248,54,80,199,221,116,132,
+    174,229,125,245,40,119,114,155,107,63,27,11,103,209,215,61,237,56,49,33,178,0,239,244,90,130,219,166,239,149,205,116,60,214,14,166,243,162,45,88,42,158,92,147,69,186,143,150,187,75,
+    87,62,154,178,109,248,217,187,114,178,238,148,87,41,151,107,125,79,81,130,208,143,103,187,254,155,19,107,27,30,175,142,224,76,48,219,34,61,219,1,46,213,124,46,151,53,217,146,46,119,
+    125,231,25,138,211,193,17,213,125,208,175,18,76,136,222,176,3,92,150,253,1,238,110,215,214,229,151,138,231,102,162,76,187,236,70,88,214,56,140,112,140,187,0,219,126,75,245,181,47,192,
+    213,221,43,101,89,33,94,239,163,130,228,156,85,213,41,4,223,184,223,77,221,157,129,71,190,0,207,28,193,117,239,93,241,76,218,114,187,176,242,3,254,6,233,216,175,8,176,95,176,238,19,
+    188,40,58,157,178,98,113,201,93,134,121,18,204,246,192,78,128,203,190,37,180,85,127,112,4,215,214,254,87,250,121,183,230,219,54,76,8,142,72,128,87,126,141,154,45,184,84,243,191,66,
+    204,154,152,231,119,144,142,241,228,215,51,3,151,253,199,22,214,34,171,100,11,94,30,188,52,245,12,210,207,75,206,86,210,92,9,86,61,1,246,215,126,8,93,213,246,130,159,15,139,76,38,237,
+    57,235,172,156,248,70,33,248,86,253,218,14,25,149,161,223,19,161,122,77,182,5,31,92,162,70,204,143,154,179,25,150,10,35,190,6,105,158,4,15,158,221,83,232,163,24,26,45,71,240,252,32,
+    164,38,157,185,155,97,81,94,113,149,225,24,63,126,53,55,192,207,71,151,130,19,170,20,43,187,215,42,179,195,23,217,32,45,57,131,180,164,64,240,141,206,192,37,231,144,178,115,84,55,176,
+    143,42,173,225,251,168,133,157,16,163,106,159,73,231,164,162,198,147,97,142,4,43,182,193,151,151,227,121,148,208,158,243,242,228,232,85,147,142,11,238,74,186,199,211,44,28,227,198,
+    175,94,119,10,253,111,122,64,39,94,207,222,66,149,2,30,93,102,210,174,29,225,188,216,129,224,91,196,236,56,167,88,1,6,9,237,203,182,255,160,151,137,94,221,175,164,243,162,2,193,55,
+    25,225,254,110,12,174,200,157,79,66,79,11,174,200,253,0,129,38,157,20,182,45,208,108,163,52,134,224,155,20,188,172,201,149,114,185,92,170,188,7,54,211,170,142,224,192,102,75,211,84,
+    50,217,124,62,159,203,212,9,86,209,183,201,164,33,51,106,195,32,127,108,151,236,12,209,221,224,127,176,238,20,50,153,76,174,142,125,240,205,102,120,173,118,149,19,87,106,51,193,206,
+    26,76,57,245,14,131,183,122,107,240,73,185,130,175,106,146,247,199,225,28,107,55,107,177,93,242,137,255,254,173,107,214,32,248,255,48,124,250,209,40,38,29,185,130,79,41,52,9,37,38,
+    65,130,35,185,137,162,99,247,160,218,160,191,135,223,35,120,82,9,236,135,135,96,94,230,103,221,46,8,203,202,111,186,55,252,175,121,40,199,182,218,192,182,201,21,171,49,26,130,121,20,
+    188,106,201,165,82,73,126,238,153,191,233,225,14,191,231,177,58,204,112,183,86,171,213,135,27,74,33,152,79,195,84,95,175,127,151,222,223,245,96,172,95,249,240,157,223,245,228,179,95,
+    248,252,44,60,218,14,130,1,4,3,8,6,16,12,32,24,64,48,128,96,8,6,16,12,32,24,64,48,128,96,0,193,0,130,33,24,64,48,128,96,0,193,0,130,1,4,3,8,6,16,12,193,0,130,1,4,3,8,6,16,12,32,24,
+    64,48,4,3,8,6,16,12,32,24,64,48,128,96,0,193,16,12,32,24,64,48,128,96,0,193,0,130,1,4,3,8,134,96,0,193,0,130,1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,8,198,87,0,
+    193,0,130,1,4,3,8,6,16,12,32,24,120,249,15,207,91,187,115,127,29,239,112,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,
+    71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,33,33,33,162,162,162,97,97,97,156,156,156,142,142,142,232,232,232,213,213,213,237,
+    237,237,115,115,115,35,35,35,10,10,10,252,252,252,142,142,142,37,37,37,113,113,113,0,0,0,73,73,73,37,37,37,146,146,146,219,219,219,109,109,109,254,254,254,254,254,254,10,10,10,126,
+    126,126,113,113,113,226,226,226,38,38,38,25,25,25,36,36,36,68,68,68,216,216,216,36,36,36,56,56,56,72,72,72,103,103,103,104,104,104,109,109,109,145,145,145,72,72,72,216,216,216,27,27,
+    27,86,86,86,106,106,106,108,108,108,35,35,35,145,145,145,68,68,68,71,71,71,214,214,214,215,215,215,9,9,9,58,58,58,35,35,35,69,69,69,89,89,89,136,136,136,199,199,199,8,8,8,135,135,135,
+    214,214,214,214,214,214,10,10,10,10,10,10,109,80,77,86,0,0,0,64,116,82,78,83,95,34,30,96,153,102,31,148,86,47,210,205,214,142,170,0,253,253,253,252,253,1,253,253,3,253,254,14,16,206,
+    76,206,175,15,211,79,110,176,209,176,174,43,14,144,208,111,174,109,138,143,78,80,47,142,47,47,17,78,47,79,46,111,144,174,211,184,199,255,0,0,10,110,73,68,65,84,120,218,237,221,105,
+    67,218,74,24,134,225,36,128,91,123,58,46,140,13,178,41,155,130,226,142,75,173,250,255,255,213,9,91,152,36,19,108,145,8,51,189,159,15,61,167,34,86,123,49,239,76,222,153,80,71,16,171,
+    227,240,87,0,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,
+    9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,1,24,96,2,176,1,241,195,95,82,
+    63,195,247,1,54,56,39,158,119,194,8,182,248,167,59,109,52,78,231,253,136,101,231,170,118,15,176,153,145,226,191,221,81,156,57,47,128,225,227,215,39,0,27,57,255,58,99,223,221,198,125,
+    128,173,123,1,60,52,198,159,112,221,3,216,196,249,247,116,2,188,123,173,5,22,34,252,132,154,240,1,54,46,94,99,234,215,40,107,63,225,126,250,248,238,21,192,70,3,239,62,104,0,125,81,
+    219,157,13,113,74,180,121,233,157,42,35,84,106,166,224,235,185,143,3,188,246,139,172,171,16,240,84,87,163,203,179,23,0,115,176,145,192,15,33,224,238,253,252,18,190,77,137,54,123,25,
+    173,89,69,169,83,240,105,25,96,35,27,29,179,73,246,116,110,5,191,182,119,10,182,25,88,29,163,141,147,57,87,193,54,79,193,118,247,162,79,26,115,12,149,7,109,238,70,219,189,217,112,157,
+    122,165,171,46,193,26,101,128,13,173,209,78,106,141,142,78,193,0,175,113,42,221,110,121,145,26,125,253,97,163,210,183,225,52,128,241,192,78,117,111,175,218,79,121,80,105,102,197,87,
+    202,149,211,185,141,76,97,203,194,218,116,224,254,222,40,199,149,143,106,244,105,172,70,223,127,48,5,75,209,107,182,90,143,0,175,248,219,223,155,228,184,172,5,158,49,6,227,52,173,205,
+    161,247,125,108,23,75,165,226,121,25,224,85,102,176,23,10,119,181,147,112,106,51,75,157,130,117,47,141,199,139,82,49,72,201,116,97,195,129,143,67,224,189,234,246,223,212,232,249,59,
+    13,161,111,32,220,52,187,11,98,15,176,78,56,189,70,63,204,78,3,60,136,57,190,197,82,155,17,188,250,53,86,250,24,214,95,40,205,223,105,240,133,215,158,250,2,188,218,116,171,17,97,39,
+    185,86,210,94,238,70,219,28,126,220,183,55,243,13,38,97,179,47,152,76,191,76,138,10,239,57,137,193,88,211,207,181,215,169,83,112,240,59,197,183,88,100,14,94,177,240,241,92,225,89,141,
+    86,155,149,234,8,78,238,52,252,80,124,75,231,21,74,244,122,11,59,225,72,149,186,197,87,242,42,248,92,25,190,165,182,103,120,75,203,130,205,134,15,133,135,99,184,81,139,125,244,42,237,
+    80,124,43,226,219,51,189,101,105,195,110,82,37,42,252,95,162,74,215,106,181,100,187,226,106,232,126,154,40,208,173,82,212,215,244,237,6,43,182,11,99,194,131,248,74,122,178,118,138,
+    165,92,171,61,148,227,159,26,245,125,52,255,168,135,29,251,193,149,193,60,97,253,77,192,154,210,235,139,102,73,185,64,186,176,192,215,154,13,255,255,34,194,253,63,122,78,220,61,238,
+    251,96,195,81,45,107,78,116,68,132,171,139,92,219,200,152,175,29,71,241,236,57,178,227,168,194,219,11,249,22,21,223,162,37,71,45,45,58,147,165,246,165,187,11,60,191,220,182,208,215,
+    170,67,119,206,103,74,180,47,30,213,11,224,22,71,118,214,89,184,47,22,0,110,70,124,109,185,233,223,174,99,179,78,117,206,9,173,63,7,14,124,173,185,213,193,178,115,209,221,65,181,122,
+    220,95,228,153,190,232,133,135,56,90,22,221,171,100,221,193,247,202,162,187,63,82,180,70,171,232,146,241,27,72,118,3,127,38,129,112,112,37,220,178,234,78,22,128,213,120,173,115,11,
+    142,66,3,252,47,197,60,224,114,37,187,41,210,247,173,123,115,82,211,128,157,227,96,153,60,112,186,43,152,39,3,122,233,3,156,241,183,27,246,170,6,253,237,202,87,226,202,112,177,13,112,
+    134,151,185,145,77,193,224,138,215,233,86,190,100,232,6,57,105,182,206,207,155,61,70,112,150,137,238,235,143,145,7,217,34,143,135,238,67,243,252,98,116,13,101,220,33,60,179,128,143,
+    247,180,9,234,117,37,59,93,255,177,245,99,168,59,57,198,227,155,37,108,5,112,202,109,43,203,40,204,222,99,171,93,44,42,7,1,76,59,8,111,22,112,127,47,93,184,187,92,222,241,180,59,41,
+    204,234,70,226,57,35,56,195,69,86,53,93,120,176,228,63,203,27,235,22,99,1,56,219,111,55,93,184,186,212,75,227,102,91,167,107,224,86,162,105,141,142,110,255,56,197,184,186,204,117,86,
+    83,175,107,224,89,75,243,90,149,149,109,71,139,124,188,196,249,215,43,166,240,150,130,53,22,151,73,95,144,242,118,127,16,67,238,47,237,139,75,113,94,210,235,22,219,91,166,181,178,12,
+    222,77,42,119,157,193,108,40,31,47,243,75,183,75,26,221,139,118,203,51,239,40,128,225,219,133,211,122,93,237,139,12,129,135,186,231,205,143,255,157,60,128,179,82,94,110,179,50,114,
+    11,218,168,63,217,106,122,179,222,7,192,166,71,138,251,201,249,187,209,180,219,122,28,190,55,128,52,116,163,24,96,237,50,186,118,81,42,141,11,243,99,197,208,161,11,240,252,49,220,106,
+    183,39,155,131,62,111,194,98,227,24,158,254,15,119,248,219,75,44,125,11,206,191,3,108,121,0,6,152,0,76,0,38,0,19,128,201,191,7,124,231,188,191,191,253,66,210,74,224,95,119,111,59,63,
+    71,89,246,207,33,109,185,11,205,96,224,95,206,251,68,119,152,187,165,126,237,49,174,180,160,151,229,152,171,251,51,146,247,229,126,253,158,251,226,121,147,177,204,91,250,127,249,180,
+    251,182,243,51,158,157,101,214,231,147,220,247,253,253,206,101,254,197,29,35,27,92,175,141,3,254,165,211,93,46,176,20,185,253,105,58,249,156,27,214,107,128,179,231,125,251,153,146,
+    229,149,104,95,52,191,239,171,233,92,230,38,245,154,27,192,179,174,205,59,105,190,75,92,100,73,145,223,79,100,84,175,79,24,193,25,231,61,213,247,109,153,127,204,229,190,62,223,243,
+    30,192,153,14,224,212,250,188,220,139,164,252,126,106,56,248,158,233,55,171,93,93,189,59,203,237,99,249,226,101,127,158,176,15,240,215,141,224,157,183,187,12,186,148,254,101,58,240,
+    229,9,35,56,187,53,116,172,48,59,217,180,160,165,240,210,133,59,188,133,195,215,212,232,172,116,199,241,94,242,249,14,192,95,159,183,12,11,115,100,12,15,11,245,86,78,131,156,55,236,
+    254,51,211,58,89,119,206,219,219,221,23,252,57,147,6,244,147,187,21,67,126,225,254,96,91,50,189,27,169,231,42,245,58,111,218,123,13,3,252,1,178,28,13,216,138,247,146,187,236,116,242,
+    47,198,189,151,180,85,192,114,152,12,202,245,164,94,247,76,252,135,58,108,2,150,145,255,44,27,217,204,251,191,109,2,150,194,45,108,22,10,159,170,0,159,121,24,224,172,125,11,135,195,
+    108,62,45,56,134,13,29,162,255,10,240,212,55,16,94,248,107,184,61,33,0,94,87,223,220,225,52,27,139,13,225,96,153,252,61,159,3,120,237,125,15,11,11,0,135,199,116,114,21,139,254,85,44,
+    107,128,165,120,158,249,6,53,250,175,137,148,45,194,124,217,170,137,216,177,196,247,219,225,231,70,176,59,219,63,178,75,216,177,194,119,67,245,253,246,247,115,176,20,79,74,199,217,
+    42,97,199,6,223,223,170,239,34,3,56,10,108,149,176,99,157,239,235,66,139,164,147,200,22,191,69,194,142,249,190,145,250,124,120,19,127,252,143,14,172,251,202,89,247,201,174,111,15,224,
+    245,240,149,155,49,95,25,121,88,253,79,132,61,238,30,21,254,225,9,238,46,92,131,248,73,95,63,234,235,222,222,186,154,151,133,174,209,17,61,154,227,218,33,236,24,238,235,69,124,207,
+    226,190,191,207,14,130,220,36,206,81,61,221,190,62,187,31,8,123,86,116,60,140,6,150,162,28,241,221,140,142,58,41,55,234,71,67,224,163,179,200,6,132,20,185,122,240,209,122,46,209,236,
+    136,220,147,212,217,18,188,211,221,106,125,101,204,87,70,171,170,20,155,35,223,32,183,138,85,224,123,48,252,248,209,65,190,34,163,194,91,246,9,155,93,162,11,17,223,88,131,35,88,95,
+    215,39,192,71,145,181,117,239,108,234,238,70,159,225,10,239,123,236,54,6,128,87,122,129,20,171,207,50,126,129,60,113,12,106,244,108,66,149,194,13,63,188,153,120,138,215,49,251,86,36,
+    187,128,213,1,252,45,238,59,236,80,207,128,83,220,55,146,194,151,70,223,138,100,45,112,210,55,248,253,205,180,20,31,41,237,45,63,24,193,211,143,31,36,218,214,126,76,56,79,137,94,15,
+    224,156,198,215,11,231,90,117,145,21,172,196,102,31,79,246,173,99,194,198,95,44,25,13,252,59,244,189,213,52,171,148,82,92,87,175,159,130,23,70,56,178,207,164,230,203,170,55,23,118,
+    158,0,94,161,240,230,156,13,164,200,20,92,142,60,144,155,62,112,80,215,244,171,124,225,207,238,0,191,124,162,68,175,50,175,195,141,134,111,218,13,66,41,94,195,129,122,19,237,115,60,
+    213,195,26,253,172,121,170,47,158,242,44,178,214,36,27,133,66,33,101,131,191,172,157,130,99,171,175,27,253,107,195,157,180,45,127,84,184,76,90,113,149,158,253,154,64,170,167,44,150,
+    149,26,61,156,157,53,207,14,70,237,214,229,168,149,69,163,99,213,194,105,183,35,73,113,155,118,185,171,180,184,244,53,122,140,236,185,54,108,39,89,123,119,97,176,86,62,56,208,53,42,
+    71,175,138,179,249,53,122,90,21,216,108,88,231,132,19,237,193,107,162,95,165,212,232,180,235,32,233,251,108,23,174,243,0,222,168,167,246,171,148,75,100,77,51,203,174,216,11,172,180,
+    57,146,221,40,247,76,215,197,4,216,36,224,87,101,167,33,217,198,84,154,89,61,1,176,137,192,233,83,112,172,70,187,86,15,97,199,86,223,167,179,57,87,66,82,169,209,7,175,0,27,62,5,111,
+    232,118,34,54,143,52,123,197,0,155,3,28,105,115,204,125,188,238,218,119,95,255,63,0,60,91,99,189,106,183,154,148,70,230,111,155,107,180,253,35,56,173,25,121,243,113,183,18,224,53,6,
+    246,39,35,52,101,59,97,246,10,56,178,123,25,109,239,101,210,237,228,240,115,238,131,205,166,212,110,52,192,235,46,60,186,125,225,57,117,51,33,87,63,26,230,140,235,96,99,171,244,237,
+    243,115,250,145,170,96,12,223,212,235,245,130,107,245,85,146,205,187,73,233,135,1,194,199,221,13,95,216,221,138,182,250,221,102,63,122,111,210,209,118,160,148,140,96,171,95,2,182,255,
+    136,188,95,52,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,
+    19,128,1,38,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,127,5,0,19,128,9,192,100,37,249,31,34,76,32,135,82,25,255,123,
+    0,0,0,0,73,69,78,68,174,66,96,130,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,
+    243,243,243,232,232,232,224,224,224,222,222,222,220,220,220,218,218,218,217,217,217,216,216,216,212,212,212,201,201,201,190,190,190,187,187,187,184,184,184,182,182,182,181,181,181,
+    180,180,180,174,174,174,158,158,158,150,150,150,148,148,148,147,147,147,145,145,145,144,144,144,142,142,142,135,135,135,125,125,125,117,117,117,113,113,113,112,112,112,110,110,110,
+    109,109,109,108,108,108,106,106,106,102,102,102,94,94,94,88,88,88,82,82,82,74,74,74,67,67,67,60,60,60,55,55,55,50,50,50,42,42,42,37,37,37,36,36,36,34,34,34,31,31,31,28,28,28,25,25,
+    25,22,22,22,19,19,19,15,15,15,12,12,12,10,10,10,7,7,7,5,5,5,4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,194,18,241,140,0,0,12,221,73,68,65,84,120,218,237,157,105,119,162,60,24,134,237,180,104,221,
+    192,13,91,119,171,162,226,190,111,133,228,255,255,171,55,168,108,138,111,109,101,28,73,239,235,195,244,156,113,70,207,233,229,157,228,73,30,32,68,1,215,132,240,43,128,96,0,193,0,130,
+    1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,8,6,16,12,32,24,64,48,128,96,0,193,0,130,1,4,67,48,128,96,0,193,0,130,1,4,3,8,6,16,12,193,0,130,1,4,3,8,6,16,12,32,24,64,
+    48,4,3,8,6,16,12,32,24,64,48,128,96,0,193,0,130,33,24,64,48,128,96,0,193,0,130,1,4,3,8,134,96,0,193,0,130,1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,0,193,16,12,32,
+    24,64,112,192,32,154,166,19,8,230,22,253,96,153,64,240,195,242,185,217,104,55,252,247,181,170,244,86,72,240,227,142,176,203,233,120,60,93,236,126,248,191,119,157,196,115,232,57,81,
+    253,228,42,195,28,9,38,139,209,104,60,30,141,102,159,63,27,159,149,231,208,159,231,63,161,167,50,133,224,135,100,61,62,48,90,252,196,47,153,197,159,158,255,252,121,126,126,18,198,199,
+    217,24,130,31,139,197,232,104,120,178,249,73,128,43,33,230,151,241,28,170,65,240,67,142,208,51,83,240,104,166,127,223,239,60,110,9,46,65,240,99,39,120,60,90,254,60,192,76,112,25,130,
+    31,146,149,37,120,60,89,127,123,6,142,61,29,3,252,244,210,135,224,135,68,155,217,17,254,230,32,173,211,178,29,224,140,198,211,50,154,167,58,120,61,25,255,108,144,214,233,44,106,6,248,
+    207,75,155,167,0,243,181,147,181,112,12,210,223,89,73,19,253,253,201,10,176,180,70,29,252,168,236,166,246,32,61,39,223,8,240,64,176,3,172,114,21,96,206,246,162,87,99,155,235,7,105,
+    66,223,237,25,56,75,248,58,109,224,75,48,113,148,74,147,237,213,1,238,135,173,0,63,247,248,10,48,111,199,133,159,206,65,250,74,83,68,151,237,0,231,52,28,23,6,102,144,94,93,27,96,193,
+    174,129,121,11,48,119,130,201,220,142,240,244,154,99,37,54,229,230,28,1,166,232,232,120,112,182,142,98,248,154,99,37,157,168,47,246,18,186,207,91,128,57,108,217,89,126,111,144,214,
+    105,145,227,25,152,71,193,186,99,199,114,170,125,237,119,16,225,116,23,154,87,193,116,227,24,164,191,138,48,33,26,215,51,48,159,93,149,203,209,213,179,48,161,203,184,29,224,193,133,
+    0,147,0,111,126,240,40,216,30,164,191,20,172,211,153,181,196,10,229,189,253,30,90,165,117,8,190,107,53,164,233,215,12,210,163,245,213,130,159,159,4,207,0,19,246,119,171,249,98,139,
+    4,223,51,162,171,217,116,58,95,235,95,13,210,163,217,87,139,44,123,136,126,14,201,94,51,48,251,140,105,69,74,36,114,170,6,193,247,66,155,143,12,198,179,245,165,153,81,95,140,141,127,
+    49,253,50,119,132,232,172,74,50,8,9,195,243,0,179,248,174,21,81,16,194,97,33,82,211,8,4,223,7,179,55,103,52,158,111,46,252,210,201,106,54,155,45,175,104,129,103,17,206,134,12,94,154,
+    231,1,102,194,135,133,88,56,22,141,70,99,145,120,48,119,49,3,40,152,56,10,221,201,252,226,193,254,149,151,145,49,195,229,172,40,229,250,103,126,89,124,183,74,50,252,26,125,53,136,9,
+    21,8,190,15,187,137,221,184,97,40,94,223,248,125,185,184,254,162,131,92,52,124,208,203,4,191,148,32,248,62,56,142,4,191,74,241,117,134,117,243,15,215,228,76,87,173,132,240,106,250,
+    133,224,59,50,119,9,222,43,190,177,138,57,219,199,216,199,55,28,142,189,90,196,132,26,4,223,137,245,228,196,48,83,236,107,161,202,226,188,249,72,8,209,168,195,111,56,49,128,224,123,
+    177,60,51,236,171,98,230,81,205,70,34,14,189,209,168,144,232,80,148,73,119,99,51,247,84,252,233,75,124,9,93,212,78,227,27,206,245,2,122,16,17,212,189,232,181,151,226,153,47,134,105,
+    55,43,68,98,174,248,38,149,192,54,75,7,246,176,129,172,231,227,179,169,120,121,251,219,234,155,114,60,236,140,111,52,28,201,13,113,216,240,111,82,124,162,248,138,3,254,175,171,226,
+    170,59,190,175,44,190,43,170,225,184,240,223,40,158,185,21,79,118,55,251,157,36,28,197,81,148,205,190,197,41,13,114,159,71,192,207,131,137,75,241,117,125,148,255,135,70,219,130,195,
+    111,68,144,58,91,26,232,123,103,5,254,192,223,169,248,59,23,36,93,18,172,88,130,163,209,112,188,52,161,1,111,211,226,160,163,67,51,21,143,38,107,122,123,130,205,17,58,22,22,196,46,
+    165,65,191,245,29,23,45,59,218,106,102,156,255,78,111,191,137,153,78,135,137,253,26,43,26,19,18,229,217,217,22,53,4,255,35,244,245,114,185,220,249,240,70,132,54,195,198,1,112,88,200,
+    246,41,15,77,180,184,87,229,169,224,109,37,33,8,66,178,60,167,92,220,152,20,130,207,153,183,155,237,5,229,164,7,30,130,61,66,188,255,147,147,30,120,8,246,48,172,235,252,220,54,26,130,
+    57,7,130,33,24,64,48,128,96,0,193,223,95,238,154,192,35,39,130,255,145,78,98,20,78,71,8,4,223,165,82,213,62,119,219,237,214,104,190,27,14,134,139,191,242,17,54,174,23,116,8,254,123,
+    172,102,131,126,79,85,187,221,78,167,221,110,43,138,210,108,126,212,235,245,150,186,241,187,39,206,165,113,61,159,178,239,17,251,232,158,218,95,6,172,251,46,72,130,245,126,171,89,175,
+    215,170,123,106,6,245,143,61,245,106,247,211,231,252,82,210,111,43,173,70,181,82,46,21,243,82,50,145,72,196,227,241,216,235,107,60,171,6,203,112,112,4,19,210,175,27,66,27,78,14,130,
+    217,143,145,175,191,118,66,71,178,113,166,196,120,97,24,23,8,135,35,145,136,209,7,32,36,134,129,26,165,3,35,152,208,121,179,126,20,122,70,163,218,245,247,179,38,210,75,196,184,42,248,
+    72,244,200,190,17,32,187,10,82,134,3,36,120,88,189,228,151,9,238,16,63,199,10,173,240,18,119,180,70,59,137,70,226,129,186,72,41,64,130,7,149,255,17,220,245,245,163,22,201,240,5,191,
+    175,209,215,184,10,193,119,79,112,125,224,227,176,169,211,105,226,255,4,247,32,248,175,8,158,186,252,186,150,90,149,246,214,71,193,108,186,191,156,224,152,144,156,99,14,254,43,130,
+    119,221,234,135,189,120,54,170,164,234,145,143,238,210,223,143,218,230,4,215,213,103,7,98,198,162,43,252,26,172,235,72,3,84,38,209,117,183,121,40,129,89,185,212,84,20,165,221,110,119,
+    58,157,110,87,29,18,127,127,231,132,170,113,193,92,63,191,190,178,2,41,28,62,214,76,66,188,18,172,110,158,96,237,100,77,251,189,126,191,63,24,14,39,243,237,110,247,249,169,153,123,
+    195,196,239,47,83,39,113,240,41,8,145,104,60,158,72,36,147,82,38,155,45,86,124,157,236,33,248,106,31,254,191,227,164,89,44,149,234,170,218,235,25,223,168,209,108,190,92,109,130,120,
+    63,195,32,158,38,221,227,72,201,251,253,201,233,201,3,4,7,22,54,248,19,93,211,52,243,148,48,168,231,206,16,204,57,16,12,193,0,130,1,4,3,8,190,177,126,130,76,126,5,255,149,237,44,8,
+    126,32,189,155,217,108,233,151,97,174,46,46,228,65,48,161,187,65,187,217,84,212,149,159,163,1,129,224,135,137,239,162,107,156,47,213,171,109,127,154,165,166,61,181,55,227,70,113,40,
+    240,122,181,65,171,182,63,33,110,86,125,185,35,108,39,43,137,82,78,153,81,220,163,227,33,252,78,59,245,99,179,101,163,166,220,124,220,67,72,71,146,210,233,148,36,230,90,43,46,20,7,
+    89,48,27,68,183,106,179,106,117,241,212,155,183,54,211,16,186,200,74,153,84,42,149,78,75,226,91,155,135,129,58,20,232,248,206,59,213,15,187,83,171,222,186,245,186,18,157,246,164,116,
+    106,79,58,45,38,115,221,69,224,21,135,2,172,119,213,107,214,28,141,120,205,106,71,191,249,77,91,201,76,234,72,58,35,138,185,206,38,224,138,67,129,245,75,38,74,213,121,169,67,163,94,
+    31,222,186,200,210,169,42,166,83,22,44,197,146,172,44,2,61,23,7,244,242,81,66,215,106,195,117,37,75,163,214,234,239,110,255,218,204,15,115,176,165,56,197,86,212,237,32,43,14,5,51,190,
+    116,168,212,62,92,241,173,41,83,63,222,89,107,37,89,112,157,138,217,114,75,110,111,40,158,217,112,79,191,75,181,81,115,199,183,217,243,229,18,97,182,46,111,102,68,87,136,13,197,82,
+    169,187,196,83,87,238,231,119,210,170,158,196,183,51,245,45,98,100,80,206,158,165,88,20,139,19,60,55,233,94,126,103,45,87,124,63,216,236,187,245,109,169,75,246,138,207,82,156,73,230,
+    23,20,77,119,247,89,96,117,43,77,215,226,185,61,247,117,134,212,141,123,9,148,50,98,202,25,226,84,70,236,224,209,118,247,9,240,170,101,47,159,27,44,190,131,173,199,163,127,111,58,242,
+    99,34,183,189,19,197,153,228,7,4,223,71,240,162,85,119,196,183,235,17,95,226,250,241,213,27,26,13,208,30,79,31,221,245,74,105,135,226,76,178,10,193,247,17,188,86,204,211,133,143,170,
+    50,212,206,61,178,89,90,237,116,123,215,109,76,95,248,50,144,67,138,83,150,226,76,178,9,193,119,50,172,30,230,96,86,41,169,11,234,229,183,95,146,115,57,185,124,205,198,22,43,185,58,
+    149,138,215,229,167,123,197,106,73,18,247,43,106,86,43,169,16,124,175,73,88,49,78,144,234,53,101,232,53,12,19,58,44,230,139,12,185,244,245,186,151,208,65,78,76,38,197,156,215,205,145,
+    14,138,139,146,40,165,82,82,178,188,198,165,43,247,98,222,105,126,52,90,234,218,179,54,34,219,186,92,124,103,20,228,47,47,213,102,95,134,172,152,97,136,217,137,87,62,143,138,179,82,
+    58,91,93,161,14,190,95,134,63,23,211,233,210,251,170,111,150,201,247,194,251,65,112,253,243,164,192,58,91,90,235,229,195,233,81,70,44,121,7,212,80,188,25,246,7,19,29,59,89,247,52,124,
+    113,149,76,88,128,243,166,224,170,171,128,58,239,166,99,11,54,249,120,122,148,190,88,230,154,207,198,194,94,244,125,119,59,46,76,136,44,192,7,189,134,224,166,238,122,101,59,25,186,
+    239,91,202,86,88,57,83,176,148,187,184,38,11,116,31,45,119,151,174,108,107,178,105,248,205,185,114,50,238,148,87,44,20,202,93,199,179,188,9,221,188,153,231,191,105,177,188,229,241,
+    234,8,206,4,179,18,233,205,12,112,190,236,114,185,40,203,134,116,185,237,218,207,80,172,14,142,160,214,65,191,74,48,33,155,170,25,224,130,236,14,112,123,191,182,46,188,23,29,55,19,
+    101,99,180,108,71,88,158,115,24,225,16,119,1,54,253,230,43,43,103,128,151,165,195,43,5,89,33,78,239,131,172,100,237,85,85,40,4,63,184,223,109,197,158,129,7,174,0,79,45,193,21,231,218,
+    90,167,117,187,11,43,211,227,111,144,14,253,138,0,187,5,175,93,130,231,57,171,83,86,204,45,185,203,48,79,130,217,12,108,5,184,224,90,66,27,231,15,150,96,231,218,203,120,165,155,177,
+    207,124,155,154,14,193,1,12,176,81,36,153,130,243,101,87,76,9,209,203,98,134,223,65,58,196,147,95,199,12,92,112,111,91,24,139,172,188,167,96,163,197,203,49,72,191,45,57,91,73,115,37,
+    88,117,4,216,189,181,76,232,170,124,20,252,118,122,200,164,211,142,181,206,74,139,13,10,193,143,234,215,116,200,40,246,221,158,8,221,148,101,83,240,73,39,0,209,55,101,171,24,150,178,
+    3,190,6,105,158,4,247,222,236,93,232,179,24,106,117,75,240,236,36,164,58,157,218,197,176,40,243,181,146,14,241,227,119,97,7,248,237,236,82,112,66,149,92,241,240,90,113,122,250,34,27,
+    164,37,107,144,150,20,8,126,208,25,56,111,109,82,182,206,206,13,204,173,74,99,248,62,107,97,39,68,43,153,123,210,105,41,55,231,201,48,71,130,21,211,224,251,251,249,60,74,104,199,122,
+    121,116,246,170,78,135,89,123,37,221,225,105,22,14,113,227,119,83,177,14,250,27,107,143,78,188,142,89,66,229,61,30,93,166,211,182,25,225,140,216,130,224,71,68,111,89,187,88,30,6,9,
+    237,202,166,127,175,151,201,186,116,92,73,103,68,5,130,31,50,194,221,195,24,92,148,91,159,132,94,22,92,148,187,30,2,117,58,202,238,91,160,89,161,52,132,224,135,20,188,44,203,197,66,
+    161,144,47,142,61,155,105,85,75,176,103,179,165,174,43,201,84,38,147,73,39,43,4,171,232,199,100,84,149,25,229,190,151,63,86,37,91,67,116,219,251,31,172,90,217,100,50,153,174,160,14,
+    126,216,12,175,213,182,210,93,92,232,166,237,89,107,48,229,210,59,244,26,149,122,239,147,114,5,95,167,73,206,31,167,115,172,217,172,197,170,228,11,255,253,91,215,172,65,240,191,48,
+    124,249,209,40,58,29,216,130,47,41,212,9,37,58,65,130,3,89,68,209,161,189,81,173,209,223,195,239,17,60,42,122,246,195,67,48,55,43,48,243,64,88,86,126,211,189,225,127,205,67,57,246,
+    167,13,172,76,46,26,141,209,16,204,163,224,101,93,206,231,243,242,91,71,255,77,15,119,248,61,143,213,33,116,213,46,151,203,149,219,111,120,8,193,15,91,38,111,86,235,45,165,16,204,175,
+    97,250,235,30,190,243,187,158,124,246,11,159,159,133,71,219,65,48,128,96,0,193,0,130,1,4,3,8,6,16,12,193,0,130,1,4,3,8,6,16,12,32,24,64,48,4,3,8,6,16,12,32,24,64,48,128,96,0,193,0,
+    130,33,24,64,48,128,96,0,193,0,130,1,4,3,8,134,96,0,193,0,130,1,4,3,8,6,16,12,32,24,130,1,4,3,8,6,16,12,32,24,64,48,128,96,0,193,16,12,32,24,64,48,128,96,0,193,0,130,1,4,67,48,128,
+    96,0,193,0,130,1,4,3,8,6,16,12,193,248,21,64,48,128,96,0,193,0,130,1,4,3,8,6,78,254,3,29,221,186,244,223,97,142,59,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,243,243,
+    243,238,238,238,227,227,227,224,224,224,221,221,221,218,218,218,217,217,217,216,216,216,210,210,210,192,192,192,187,187,187,186,186,186,183,183,183,182,182,182,181,181,181,180,180,
+    180,177,177,177,166,166,166,155,155,155,150,150,150,149,149,149,147,147,147,145,145,145,144,144,144,142,142,142,135,135,135,127,127,127,119,119,119,113,113,113,112,112,112,110,110,
+    110,109,109,109,108,108,108,104,104,104,96,96,96,91,91,91,84,84,84,78,78,78,70,70,70,61,61,61,54,54,54,49,49,49,41,41,41,37,37,37,36,36,36,34,34,34,31,31,31,28,28,28,24,24,24,21,21,
+    21,18,18,18,15,15,15,12,12,12,9,9,9,8,8,8,5,5,5,4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,124,206,207,40,0,0,13,83,73,68,65,84,120,218,237,221,9,115,162,74,23,6,96,115,51,184,163,113,141,113,67,
+    163,168,184,11,34,110,116,255,255,127,245,53,40,136,219,76,226,167,73,186,243,190,117,107,106,202,220,56,85,121,114,154,211,11,24,162,136,208,9,225,71,0,96,4,192,8,128,17,0,35,0,70,
+    0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,
+    2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,248,75,67,108,39,0,22,53,123,90,2,96,81,125,
+    231,237,74,181,54,162,54,128,133,28,159,233,32,25,98,9,119,4,23,14,253,86,223,81,34,244,204,242,36,105,98,11,255,82,96,155,86,66,127,254,99,249,19,202,109,80,193,2,22,176,149,12,61,
+    59,192,207,79,145,177,208,37,252,91,129,103,209,167,61,176,52,2,176,128,35,116,255,207,127,123,224,196,92,232,169,210,239,4,222,82,117,55,66,51,224,164,9,96,1,43,184,234,1,135,242,
+    4,192,2,94,132,115,126,5,215,48,77,18,176,128,231,137,125,19,253,223,179,198,6,108,0,139,6,60,148,188,38,58,60,66,5,11,8,220,126,122,222,1,135,146,150,216,251,13,191,18,152,4,122,172,
+    2,185,226,75,8,128,185,245,181,253,30,43,116,165,199,114,54,138,137,13,96,78,71,104,61,177,191,4,63,63,117,47,245,88,78,241,46,45,84,48,183,192,3,191,199,146,134,23,42,152,205,140,
+    251,213,92,174,172,217,0,230,19,184,251,188,95,168,12,93,90,168,36,100,163,68,165,112,88,138,55,249,191,16,243,13,76,44,115,110,174,62,15,92,243,47,193,57,251,12,152,216,118,35,18,
+    141,179,68,18,67,238,231,80,92,3,175,245,49,203,212,252,116,143,149,247,129,43,231,130,132,170,137,104,44,202,18,151,234,220,175,130,240,12,76,244,241,196,205,156,124,14,120,145,244,
+    23,42,219,103,130,54,237,39,35,174,47,3,206,115,127,26,128,103,96,107,178,207,120,110,127,14,216,95,168,252,211,63,173,96,155,14,147,145,184,235,27,141,133,83,220,111,53,241,12,60,
+    31,251,194,250,39,46,196,54,213,252,205,224,232,236,4,144,80,61,31,222,251,50,224,252,18,192,63,1,120,50,158,45,63,252,109,91,218,242,47,193,167,11,149,132,90,133,112,204,243,141,70,
+    59,104,178,190,49,230,1,120,50,158,90,31,7,86,15,11,149,167,13,244,170,22,241,124,163,241,200,155,197,253,60,137,103,224,245,52,32,60,249,112,51,205,174,178,222,52,248,73,57,238,177,
+    108,218,142,68,61,224,120,184,32,192,97,15,174,167,73,230,228,40,230,199,134,83,66,215,73,247,204,172,219,99,109,143,87,64,18,1,223,188,33,192,78,34,223,11,29,139,233,145,176,177,253,
+    96,9,171,33,103,187,48,20,170,173,201,209,216,61,72,248,3,116,60,146,28,138,112,20,128,243,165,202,197,209,40,61,214,215,31,42,97,178,110,70,158,66,255,37,234,155,224,16,204,134,110,
+    57,226,55,208,145,68,143,98,55,233,251,179,156,29,9,207,62,58,93,154,180,90,125,235,164,174,205,220,97,130,20,77,8,114,211,18,247,155,13,43,253,72,120,250,161,233,210,126,167,215,38,
+    71,19,164,87,191,126,217,12,184,121,244,85,0,127,95,182,198,177,240,226,67,46,182,189,61,2,36,100,89,13,76,144,194,149,37,78,116,252,148,144,249,81,167,53,54,111,122,19,218,142,198,
+    2,13,180,48,39,181,132,216,15,54,143,155,233,27,142,98,176,6,43,216,64,231,166,194,28,181,20,99,195,255,104,186,52,214,111,24,231,105,91,138,7,39,72,194,28,165,21,228,68,71,176,153,
+    30,207,62,63,186,18,90,245,128,217,4,73,164,123,194,69,57,178,19,104,166,199,250,255,3,204,124,187,34,29,133,23,230,76,214,161,153,30,27,183,12,209,189,221,28,56,22,143,52,133,186,
+    151,69,156,67,119,182,215,76,79,151,244,134,10,54,179,146,115,12,43,42,149,150,54,1,240,143,156,46,153,83,247,136,214,226,182,105,210,32,29,150,36,41,82,19,236,118,97,161,142,205,46,
+    13,93,159,47,111,252,245,160,122,173,144,47,247,68,123,52,154,96,231,162,183,183,183,71,142,235,154,254,197,151,207,165,45,60,140,244,24,240,218,47,8,113,159,106,105,3,152,115,227,
+    191,233,110,23,60,86,49,128,255,137,238,54,213,214,64,201,103,95,53,84,176,120,188,236,15,179,95,207,37,36,41,44,37,222,87,188,213,48,128,255,170,203,120,23,174,110,56,26,143,199,226,
+    145,48,119,171,92,124,1,19,107,174,27,166,181,178,191,68,215,169,213,185,146,75,132,153,238,110,43,49,30,46,172,57,155,70,113,5,188,53,38,206,82,198,100,170,27,115,107,181,126,168,
+    174,243,231,92,171,38,37,95,215,93,168,78,206,56,43,97,158,128,201,97,185,217,89,177,154,234,115,115,185,126,72,61,57,111,170,247,170,201,136,20,102,35,115,212,79,44,146,24,1,248,97,
+    89,29,239,235,79,246,197,204,134,108,114,111,95,163,87,145,163,82,36,22,212,117,135,232,156,133,33,250,97,177,38,231,217,15,217,214,125,125,251,25,166,27,61,209,101,190,113,233,29,
+    77,214,227,178,24,79,174,228,19,119,38,253,59,54,29,36,194,177,51,221,88,60,26,150,10,6,166,73,143,203,114,58,185,42,60,219,220,175,126,87,121,255,248,206,65,55,22,145,98,185,22,127,
+    91,77,92,53,89,250,248,186,176,117,207,2,142,198,206,116,35,201,98,111,205,225,86,19,87,211,164,245,108,124,141,248,182,195,178,151,129,181,120,0,56,22,143,71,194,76,183,51,165,148,
+    199,179,240,124,45,116,172,141,217,212,109,158,31,10,60,242,79,208,58,186,82,56,81,80,39,54,159,188,252,45,85,110,86,139,249,94,249,136,249,126,93,22,161,235,188,127,62,75,146,152,
+    238,200,185,190,243,250,33,120,92,174,69,219,107,203,52,244,160,242,216,184,95,117,217,180,23,141,56,199,179,194,82,130,141,204,238,46,49,191,199,180,248,221,108,32,155,229,98,174,
+    207,118,231,176,140,123,214,23,217,170,201,176,36,197,228,154,123,132,222,230,250,16,30,231,187,73,100,187,92,152,134,185,188,55,193,84,173,213,181,185,243,254,120,8,139,136,217,171,
+    138,112,126,22,192,151,133,157,224,254,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,191,56,196,201,221,223,212,182,157,255,176,146,245,253,186,143,121,91,239,47,54,247,202,33,222,
+    121,137,57,26,12,245,123,191,179,217,87,219,218,80,223,122,229,204,47,115,136,239,226,181,70,154,218,108,52,219,218,61,239,40,33,180,87,72,37,229,84,46,95,85,59,67,115,113,24,181,9,
+    128,191,82,151,152,3,181,213,104,190,183,90,205,134,118,191,207,191,177,233,32,39,103,179,153,76,58,37,39,229,108,190,168,116,181,145,177,218,127,13,192,95,164,187,53,6,189,182,226,
+    232,190,187,153,221,175,132,87,85,57,251,194,146,201,48,230,116,138,21,115,58,87,168,52,123,83,125,137,10,254,26,221,141,49,232,182,21,165,233,233,190,183,148,254,189,128,109,58,205,
+    165,51,47,94,50,14,243,11,43,102,166,156,175,104,27,0,63,150,215,211,109,52,14,186,46,112,239,126,255,132,158,15,0,251,204,238,144,157,86,113,103,195,131,125,231,195,94,187,161,28,
+    233,222,183,130,9,157,229,206,128,247,202,217,116,110,140,187,11,31,153,121,95,125,111,156,234,58,105,142,239,118,13,38,235,122,50,251,114,57,217,100,7,192,15,172,223,81,219,105,154,
+    79,113,153,183,210,223,146,251,253,51,70,94,102,213,202,6,229,11,192,85,27,183,143,62,204,215,82,27,151,116,27,74,235,206,243,224,97,57,35,203,114,234,229,76,57,147,122,229,236,6,97,
+    174,128,7,167,190,59,221,78,127,186,189,235,79,157,208,101,191,83,175,228,179,142,114,218,153,44,121,202,89,185,198,217,163,104,185,2,214,148,214,201,200,236,234,46,31,240,79,177,44,
+    245,97,183,85,45,228,210,142,242,139,203,156,77,103,7,184,6,63,176,130,235,173,0,111,163,254,222,233,187,159,43,251,152,221,36,247,47,219,249,72,235,212,138,249,140,156,148,83,114,
+    50,135,105,210,35,129,117,111,136,110,181,154,138,162,14,220,143,178,35,143,250,145,19,95,153,46,244,65,183,81,45,148,90,67,220,31,252,200,108,58,74,203,73,179,209,104,247,134,11,250,
+    5,207,142,116,148,247,99,242,198,92,81,254,194,215,52,105,234,172,79,42,74,187,235,22,239,215,141,150,94,49,19,108,54,60,56,134,214,81,123,222,208,252,213,191,95,4,55,128,127,65,214,
+    22,165,188,62,156,27,192,31,155,191,92,213,117,79,120,220,76,239,140,191,68,184,223,28,254,246,131,201,13,95,249,224,251,238,174,179,0,254,177,242,139,129,166,245,141,219,136,8,181,
+    122,181,106,189,107,137,244,169,88,66,1,179,105,114,71,81,148,70,123,116,139,48,161,70,85,150,147,201,84,205,16,75,56,36,142,175,209,110,184,147,228,246,45,53,76,182,181,100,150,229,
+    69,46,140,132,18,14,9,227,187,232,238,214,185,90,74,239,243,251,1,54,29,188,236,118,20,178,169,66,95,164,38,61,36,138,239,182,183,223,137,96,37,188,248,116,9,19,218,246,54,249,51,169,
+    92,79,32,97,81,42,120,219,111,122,235,212,205,182,117,3,176,42,123,91,130,153,116,182,75,132,105,166,197,0,38,118,191,225,111,51,53,59,203,79,243,216,84,75,249,199,116,50,233,180,178,
+    20,229,66,44,4,48,161,195,102,224,252,157,102,223,240,14,243,130,124,16,206,200,194,52,211,34,0,219,172,129,246,129,91,141,238,45,135,106,8,237,231,14,194,47,25,249,117,38,134,112,
+    72,132,250,157,171,77,255,4,124,83,61,153,37,17,114,233,152,28,57,125,153,9,231,229,195,249,43,183,153,166,184,125,244,71,248,154,29,229,224,219,62,190,135,101,223,14,147,179,111,186,
+    48,14,204,2,163,52,19,206,107,34,180,90,2,84,240,186,23,56,170,213,26,30,251,82,106,141,135,179,115,209,229,168,63,52,78,133,245,183,64,13,103,210,47,170,0,194,252,3,111,52,127,124,
+    102,23,224,193,137,175,209,169,150,222,170,39,125,181,115,186,171,82,42,87,181,227,233,46,187,150,215,83,47,62,113,230,37,173,240,255,113,224,188,3,59,103,105,15,229,219,212,54,65,
+    51,118,117,174,23,74,111,111,165,162,186,58,250,158,81,181,248,86,126,43,149,122,244,68,120,213,204,166,3,194,114,213,224,93,152,247,71,56,208,81,235,253,112,139,97,119,125,82,169,
+    157,98,165,252,246,86,46,151,2,149,77,24,99,177,242,198,94,46,85,78,54,38,216,144,220,203,165,2,173,150,92,93,80,60,194,225,59,125,245,118,160,129,238,152,39,190,102,173,196,124,25,
+    101,81,13,2,235,149,146,243,234,91,37,248,178,119,205,214,242,193,86,43,217,2,240,15,153,32,189,159,109,35,17,58,222,75,150,95,235,43,255,107,54,29,238,94,101,37,92,59,189,200,18,155,
+    142,130,75,30,169,252,156,111,97,190,43,120,211,11,78,144,38,39,20,54,29,236,10,152,1,43,7,96,54,172,239,221,217,213,121,112,198,199,90,173,106,210,187,87,37,147,206,13,249,94,240,
+    8,113,93,192,211,192,157,44,231,27,253,132,118,95,247,192,197,78,112,136,182,234,135,215,201,133,9,177,89,79,239,155,105,6,60,5,240,247,1,15,15,5,172,156,215,34,181,219,69,175,130,
+    181,35,166,174,247,250,249,24,237,10,19,53,181,107,166,51,169,194,2,67,244,55,78,145,20,127,143,80,91,159,175,86,89,251,30,139,37,56,208,58,99,244,219,97,140,182,47,188,49,213,114,
+    41,231,102,179,140,220,69,147,245,157,115,164,125,139,213,106,116,215,23,150,35,103,213,146,87,168,193,58,60,30,163,233,197,149,106,218,207,39,83,41,57,213,90,225,73,119,223,8,188,
+    234,238,110,86,82,186,139,75,35,237,112,95,166,71,77,244,238,226,124,24,163,47,15,193,172,153,86,203,197,154,182,165,156,135,251,105,146,210,116,110,52,188,180,224,68,168,230,95,130,
+    219,155,19,61,175,141,46,151,174,116,201,236,69,107,65,41,150,42,191,89,216,212,84,181,59,184,210,8,169,30,112,241,228,74,74,54,173,98,229,111,99,52,221,223,104,198,255,150,48,255,
+    155,13,150,101,95,193,95,43,175,94,143,117,210,74,177,209,251,48,70,95,61,31,32,196,201,59,254,55,27,174,73,176,241,187,186,95,168,44,85,207,214,184,22,85,111,13,164,56,160,34,223,
+    201,38,194,3,193,47,191,110,251,147,33,86,165,243,179,53,231,195,240,93,95,83,0,115,24,155,246,253,185,80,123,115,246,197,129,63,69,174,140,68,46,97,113,129,3,115,161,98,239,124,21,
+    211,219,104,58,239,192,0,204,137,239,250,253,202,66,229,238,235,254,24,253,90,183,4,22,22,24,216,240,250,168,210,133,65,152,176,49,218,91,173,20,122,140,22,24,88,175,120,77,244,133,
+    213,42,214,99,255,142,49,90,88,96,214,99,121,128,165,139,99,112,112,140,94,138,43,44,112,5,119,2,155,190,151,22,50,7,254,185,142,234,12,192,60,2,251,77,116,255,226,150,160,223,71,151,
+    42,0,230,17,184,87,244,22,58,46,222,179,79,216,24,237,254,15,149,191,172,86,2,248,7,3,15,222,202,215,79,109,184,93,88,181,84,41,151,43,111,197,30,65,147,197,97,182,173,2,243,43,95,
+    88,230,240,132,251,149,98,233,181,88,234,172,208,69,115,89,194,179,122,241,213,241,187,214,35,59,31,17,80,171,119,134,88,139,230,85,216,236,183,235,234,224,111,31,117,100,47,86,84,
+    236,136,252,249,193,172,110,183,43,250,175,103,227,17,27,192,220,10,219,244,95,103,110,132,127,170,169,232,159,0,254,235,159,74,139,143,120,7,48,2,96,4,192,8,128,17,0,35,0,70,0,12,
+    96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,
+    192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,248,17,0,24,1,48,2,96,4,192,8,128,17,0,35,0,254,69,249,31,54,222,191,248,108,
+    152,182,33,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,
+    0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,250,250,250,244,244,244,242,242,242,232,232,232,225,225,225,222,222,222,219,219,219,218,218,218,217,217,217,216,216,216,215,215,
+    215,203,203,203,190,190,190,187,187,187,184,184,184,182,182,182,181,181,181,180,180,180,173,173,173,161,161,161,152,152,152,149,149,149,148,148,148,147,147,147,145,145,145,144,144,
+    144,140,140,140,132,132,132,125,125,125,116,116,116,113,113,113,111,111,111,110,110,110,109,109,109,108,108,108,105,105,105,101,101,101,97,97,97,91,91,91,82,82,82,76,76,76,71,71,71,
+    62,62,62,54,54,54,48,48,48,40,40,40,37,37,37,36,36,36,34,34,34,31,31,31,28,28,28,25,25,25,22,22,22,20,20,20,18,18,18,16,16,16,13,13,13,10,10,10,7,7,7,4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,
+    122,152,22,56,0,0,12,195,73,68,65,84,120,218,237,221,233,118,162,74,20,5,96,147,214,104,162,56,161,49,78,104,52,138,56,224,28,112,160,234,253,223,234,22,14,128,138,153,36,94,171,178,
+    247,143,238,181,210,157,100,173,124,57,197,169,1,8,81,68,232,132,240,35,0,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,
+    0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,
+    8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,56,224,88,107,114,217,103,95,246,5,0,252,187,89,206,198,227,201,251,234,199,190,7,127,1,
+    248,246,124,199,186,157,201,143,133,117,69,46,118,102,148,0,248,38,179,158,232,67,59,250,244,39,66,132,172,155,15,33,150,120,87,36,97,145,128,23,195,125,204,31,141,207,234,125,232,
+    158,37,20,31,11,52,74,139,4,252,174,239,124,245,137,245,131,2,54,19,161,251,187,187,59,38,92,5,240,77,198,216,3,15,245,247,31,20,112,107,227,203,132,67,169,149,56,131,180,152,67,244,
+    112,180,248,118,1,207,227,14,112,98,1,224,155,156,3,79,221,18,254,238,32,109,81,101,231,203,128,179,22,128,111,179,132,71,78,9,235,198,247,124,201,228,105,15,124,119,167,226,26,124,
+    163,153,185,37,60,94,125,175,128,203,110,1,199,223,5,154,39,137,5,188,26,187,194,179,111,249,246,35,14,240,125,19,243,224,155,141,249,163,62,139,144,181,236,22,176,52,23,105,177,82,
+    48,96,226,237,179,214,95,47,96,237,223,221,174,133,190,187,215,132,90,140,22,109,55,105,57,254,254,100,152,144,69,214,45,96,121,77,176,22,205,197,106,199,112,180,252,106,1,171,247,
+    78,1,255,235,97,55,233,166,179,223,113,248,250,166,3,33,102,210,45,224,162,88,190,2,158,232,48,221,201,240,215,54,29,44,250,182,159,1,223,135,34,3,0,223,122,159,245,205,201,48,33,211,
+    184,91,192,101,193,124,69,60,147,181,28,187,235,89,51,242,133,2,110,184,190,79,99,2,224,219,239,179,134,223,232,179,8,49,36,23,184,42,90,1,11,9,236,157,12,127,186,36,77,104,197,179,
+    72,57,5,48,23,131,180,211,103,233,243,79,125,231,238,21,248,174,65,9,5,240,77,20,233,114,177,252,96,161,202,233,179,62,173,96,139,14,156,69,172,80,194,60,183,198,65,0,124,213,44,38,
+    163,225,104,108,156,237,145,157,77,135,209,234,83,224,254,157,179,200,209,166,190,191,52,155,190,203,34,0,190,158,239,200,246,211,245,177,97,125,252,63,134,159,174,86,50,224,221,42,
+    214,125,40,189,240,43,224,13,47,225,182,138,185,4,222,55,81,250,112,186,56,243,99,55,199,155,95,128,79,81,8,221,205,130,239,239,254,117,252,58,44,246,161,233,155,44,203,77,78,55,137,
+    121,4,94,122,14,110,140,166,103,38,66,43,211,48,191,178,231,111,209,246,230,180,236,93,40,231,179,203,192,62,98,182,83,97,59,233,62,151,194,60,2,123,14,215,217,196,179,197,69,95,141,
+    208,102,228,46,20,10,151,166,167,128,172,124,7,249,199,72,236,145,37,156,229,178,134,57,175,224,45,241,124,121,153,176,222,237,116,250,167,23,89,214,87,153,74,60,18,141,69,89,98,177,
+    24,151,27,197,60,2,19,119,195,104,79,252,190,190,72,120,55,26,159,52,87,90,246,33,178,225,101,121,12,171,116,13,224,171,196,28,30,9,15,63,104,168,191,114,29,94,175,215,214,233,232,
+    60,44,63,133,99,123,223,232,227,63,0,95,45,198,232,68,88,159,152,1,94,33,89,57,47,84,41,252,240,24,117,18,139,104,0,190,222,101,120,118,74,60,156,44,130,250,242,118,115,37,71,35,143,
+    49,215,247,49,156,152,160,201,186,102,43,61,61,37,30,25,65,241,190,87,226,225,168,135,55,22,139,196,59,152,38,93,155,120,120,210,108,45,3,241,93,107,217,200,131,135,55,250,24,121,200,
+    118,177,208,113,245,110,218,156,28,17,255,224,174,66,159,158,122,240,226,109,174,236,242,13,39,222,12,44,85,254,47,196,99,221,75,252,173,219,25,206,249,106,137,200,65,115,21,139,68,
+    159,71,220,62,185,131,247,253,224,181,49,214,131,4,182,168,30,63,108,174,30,194,25,117,73,185,125,246,14,255,27,254,171,247,145,254,195,123,10,125,231,71,229,240,211,193,232,28,127,
+    157,241,252,224,29,17,78,116,44,231,59,226,11,158,175,227,12,208,139,76,248,209,51,58,63,228,122,148,242,252,232,44,49,142,236,216,115,38,150,241,197,77,52,161,102,50,236,44,78,62,
+    68,164,214,146,219,173,126,145,128,25,241,108,58,53,46,95,104,98,21,156,221,85,112,44,26,126,42,77,184,127,44,26,158,85,121,44,92,13,63,177,18,142,217,83,95,109,205,121,249,2,216,7,
+    216,144,255,69,162,209,72,56,222,92,82,1,14,89,2,248,68,88,47,197,99,15,241,98,143,242,95,190,0,246,21,166,35,173,51,62,221,32,6,176,40,194,27,88,81,238,81,2,176,79,44,203,194,115,
+    178,16,0,35,0,70,0,124,210,2,249,4,142,98,0,159,167,4,177,8,192,182,226,106,97,154,166,97,188,111,99,140,7,131,126,191,63,133,163,8,192,132,154,61,77,109,183,91,44,111,118,154,205,
+    102,163,94,175,213,106,111,154,249,235,67,7,175,87,3,158,42,216,80,21,69,169,109,83,223,230,149,165,241,90,87,212,101,208,163,52,177,118,89,175,15,182,131,121,35,14,241,83,191,75,85,
+    105,52,26,175,141,109,94,189,105,212,130,190,245,239,112,29,203,90,46,182,177,31,43,64,0,252,59,192,147,67,212,3,96,69,181,2,254,110,235,94,107,115,17,120,173,215,148,188,44,103,119,
+    145,21,206,238,49,228,8,120,160,52,62,0,94,5,252,205,228,120,120,155,127,44,97,79,100,190,132,121,2,174,54,174,84,193,132,234,210,63,251,134,209,205,141,193,79,79,143,222,132,43,92,
+    61,142,150,35,224,97,237,60,112,173,23,96,89,17,98,21,55,199,58,252,18,123,136,247,121,58,198,195,17,176,209,218,11,55,142,242,170,180,205,32,129,233,187,20,57,227,27,141,69,31,53,
+    0,255,142,176,222,84,182,147,35,54,77,82,170,213,170,178,79,189,51,11,246,59,77,226,31,0,63,1,248,183,50,233,176,190,246,237,237,173,213,106,181,59,187,104,154,214,29,4,251,158,35,
+    66,167,137,243,192,24,162,127,49,214,118,141,210,48,204,229,177,73,176,83,110,217,123,123,195,246,9,29,219,60,62,133,75,75,52,89,191,54,74,123,59,33,231,199,28,248,207,219,162,221,
+    120,216,233,157,99,155,59,13,31,236,68,34,145,112,118,142,105,210,47,18,95,103,73,152,208,78,98,59,7,182,255,140,68,30,88,229,218,137,39,146,149,49,22,58,4,8,235,179,90,229,114,89,
+    233,116,84,59,236,74,223,237,118,123,189,137,97,96,169,82,140,88,231,199,16,10,96,33,106,216,34,196,222,73,178,179,223,88,178,176,93,136,0,24,1,48,2,224,211,233,19,44,197,5,222,221,
+    77,4,77,65,129,153,172,57,123,95,1,83,76,96,198,107,116,91,205,55,85,135,166,128,192,108,116,94,13,218,74,173,94,87,26,253,64,46,196,155,227,148,4,192,183,83,190,157,122,205,62,100,
+    217,168,55,103,1,92,135,119,95,65,24,226,16,231,229,187,232,189,41,175,141,221,193,172,0,206,206,18,58,237,180,218,157,41,165,184,1,252,22,202,119,212,174,57,39,181,26,74,39,0,223,
+    126,78,74,36,164,156,106,216,139,149,0,254,191,155,171,70,205,61,2,207,128,47,255,154,35,89,202,100,50,233,100,50,167,81,33,170,152,87,96,54,58,47,251,173,253,232,28,212,16,109,209,
+    86,34,147,98,73,167,165,116,69,91,9,48,185,14,113,91,190,147,78,237,224,28,109,67,105,93,122,180,146,93,210,95,164,13,48,35,78,37,146,149,193,154,251,103,237,132,56,229,93,116,155,
+    138,247,6,165,198,171,210,210,47,173,55,214,97,201,201,116,106,151,76,74,202,86,38,148,243,42,14,241,233,171,183,149,250,65,249,214,94,59,65,188,176,193,42,39,50,41,39,233,164,36,215,
+    6,124,63,49,43,196,163,239,187,214,60,184,79,169,81,87,218,250,58,128,74,179,104,59,145,73,123,132,109,226,230,152,231,105,113,136,67,223,201,81,115,245,170,52,187,102,32,35,41,161,
+    243,98,34,237,17,222,18,183,231,252,142,211,252,61,132,133,154,173,195,242,173,213,213,113,80,0,236,42,92,206,72,199,196,201,151,46,175,239,228,224,17,184,175,28,53,87,189,0,123,93,
+    66,87,221,82,234,152,88,74,22,250,120,235,202,181,132,59,94,96,165,161,249,156,100,189,224,228,52,251,188,165,86,72,158,16,203,3,188,55,233,74,192,170,3,220,168,215,84,191,230,138,
+    120,254,252,254,215,183,236,167,129,200,82,242,128,56,147,168,160,130,175,52,68,247,118,192,118,115,213,247,121,104,247,102,255,127,110,146,47,10,147,147,205,65,155,120,214,58,36,78,
+    75,185,5,94,109,119,29,224,89,179,190,185,43,88,169,107,83,234,87,190,171,78,165,84,170,180,166,95,2,217,252,159,19,98,123,31,163,153,149,146,25,23,88,54,1,124,173,18,126,85,106,53,
+    69,105,247,253,238,26,37,100,217,206,63,23,10,207,249,234,215,238,18,51,251,189,137,207,48,192,170,88,87,178,137,84,26,21,124,245,88,186,218,106,181,187,11,223,203,44,243,127,46,110,
+    146,83,191,208,105,89,106,46,147,145,155,35,159,145,128,125,164,87,201,72,91,226,76,162,204,231,214,18,159,155,13,214,98,113,230,141,25,132,46,170,207,197,23,150,226,115,229,179,201,
+    43,33,171,102,66,74,166,146,137,220,212,103,107,144,13,220,164,87,74,74,169,76,38,45,101,123,232,162,175,56,74,159,237,146,9,237,22,94,54,41,22,202,179,163,59,138,143,219,41,139,106,
+    76,47,157,74,103,18,202,202,175,64,217,199,150,221,98,50,145,72,202,93,204,131,175,74,76,206,209,27,149,109,1,219,192,7,79,180,34,244,228,215,130,208,234,110,111,33,157,234,250,239,
+    238,179,15,154,93,181,173,141,177,146,117,35,181,221,217,249,190,20,243,138,247,1,150,132,46,7,189,222,209,154,166,85,218,3,75,5,195,255,151,102,255,114,14,172,69,223,134,239,180,92,
+    216,1,191,188,244,14,124,167,205,82,161,80,86,15,171,218,217,29,76,75,205,115,134,124,159,163,21,12,152,168,121,223,2,38,116,94,201,177,143,22,114,205,149,247,247,161,237,0,39,179,
+    3,81,14,82,138,11,76,232,164,228,22,112,255,160,128,213,156,253,15,197,98,193,83,215,150,231,4,71,38,81,21,242,238,38,193,128,219,110,1,183,87,196,167,247,42,230,154,107,239,39,104,
+    158,229,102,77,68,225,144,80,190,163,82,97,95,191,165,145,103,196,117,175,205,108,118,236,89,114,36,132,148,37,103,173,74,54,4,20,22,10,120,221,114,11,184,181,36,244,83,96,246,59,208,
+    207,38,29,225,134,5,224,155,46,224,129,115,253,45,148,116,122,14,248,160,78,137,85,115,128,147,153,190,120,125,86,72,32,95,171,225,20,112,161,67,14,87,52,102,231,128,233,123,206,29,
+    164,75,134,112,79,10,16,9,184,183,47,224,227,69,172,67,224,227,127,234,120,246,4,85,225,74,56,36,142,175,179,72,201,20,213,195,171,41,171,211,242,179,63,48,187,114,87,220,201,176,172,
+    139,214,103,9,4,220,45,56,29,86,245,104,239,150,80,211,1,46,31,109,19,91,116,224,244,89,25,169,2,224,91,245,157,185,5,156,63,158,209,18,186,170,230,138,187,209,251,248,28,128,69,85,
+    201,189,95,165,43,152,176,56,192,29,119,138,84,245,233,149,154,103,129,9,49,158,221,62,43,55,23,75,88,156,38,171,145,115,90,104,191,217,142,11,124,242,160,7,66,251,158,62,171,5,224,
+    219,28,161,247,219,72,197,231,170,233,51,217,249,0,152,213,112,213,185,107,84,146,103,66,9,11,3,236,233,161,125,143,168,191,237,129,75,115,159,131,182,115,119,50,156,236,10,53,85,18,
+    104,136,222,94,131,139,249,150,239,98,69,203,1,246,169,80,139,118,92,96,13,192,183,185,204,81,40,216,103,41,11,37,255,211,53,59,96,38,236,179,239,75,172,149,51,25,206,244,0,124,147,
+    192,235,78,41,207,82,58,51,207,113,128,159,253,0,55,147,225,204,102,91,184,180,196,53,248,70,211,111,86,171,237,115,75,81,31,3,219,91,201,201,100,42,157,226,246,120,236,31,0,38,148,
+    44,22,103,79,199,121,129,125,15,84,175,52,57,149,204,20,123,88,232,184,97,97,122,206,151,21,168,3,124,182,75,158,116,181,222,2,75,149,55,77,76,206,218,127,14,124,209,77,167,0,254,191,
+    139,219,1,206,159,173,96,34,212,99,102,255,26,240,254,60,237,7,67,180,144,249,35,192,22,237,239,87,50,95,250,127,234,225,255,127,166,130,141,74,126,115,83,105,94,89,80,10,96,1,133,
+    7,165,92,254,57,159,43,15,254,214,219,59,254,204,123,147,152,240,91,181,82,105,79,254,216,219,89,254,206,139,177,236,231,35,125,176,16,2,96,17,132,233,223,123,187,210,159,122,181,221,
+    95,124,63,26,222,93,8,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,
+    1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,241,35,0,48,2,96,
+    4,192,8,128,17,0,35,0,70,188,249,15,113,16,183,24,198,59,113,79,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,250,250,250,244,244,244,243,243,243,236,
+    236,236,226,226,226,223,223,223,220,220,220,218,218,218,217,217,217,216,216,216,212,212,212,197,197,197,189,189,189,188,188,188,187,187,187,185,185,185,183,183,183,182,182,182,181,
+    181,181,180,180,180,175,175,175,167,167,167,157,157,157,151,151,151,149,149,149,147,147,147,145,145,145,144,144,144,142,142,142,134,134,134,126,126,126,117,117,117,113,113,113,112,
+    112,112,110,110,110,109,109,109,108,108,108,106,106,106,103,103,103,95,95,95,87,87,87,81,81,81,74,74,74,68,68,68,61,61,61,54,54,54,49,49,49,41,41,41,37,37,37,36,36,36,34,34,34,33,33,
+    33,28,28,28,24,24,24,20,20,20,17,17,17,15,15,15,12,12,12,8,8,8,6,6,6,3,3,3,2,2,2,1,1,1,0,0,0,245,111,137,140,0,0,13,6,73,68,65,84,120,218,237,221,233,118,218,188,26,5,96,146,0,1,194,
+    16,70,99,230,48,131,49,102,50,224,73,186,255,187,58,54,224,1,227,164,231,228,64,19,169,123,255,104,191,85,210,126,107,229,233,43,75,175,36,55,70,17,174,19,195,183,0,192,8,128,17,0,
+    35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,
+    6,48,2,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,200,63,4,76,44,139,88,
+    228,203,175,176,3,96,102,125,207,63,89,255,229,215,1,152,57,95,67,145,102,139,253,87,95,179,87,20,21,21,204,170,239,113,210,172,11,66,71,254,116,20,182,228,113,191,63,154,171,220,214,
+    48,223,21,172,143,133,70,179,217,172,55,148,104,64,66,22,189,254,96,216,239,78,184,21,230,25,216,162,75,177,217,108,52,26,173,122,87,139,2,36,84,25,12,134,131,193,96,212,149,0,204,
+    98,166,117,199,215,137,28,13,56,239,57,190,118,13,79,142,156,10,243,13,60,22,206,192,77,97,22,233,103,76,63,78,192,131,254,120,15,96,6,231,88,51,23,56,114,140,38,84,29,245,7,231,10,
+    30,31,0,204,224,51,88,17,47,35,116,163,185,140,2,94,245,207,5,60,252,152,26,0,102,176,130,181,78,221,29,163,231,81,128,139,222,5,184,135,73,22,155,153,120,99,116,47,170,68,103,46,240,
+    135,12,96,38,75,120,225,142,209,98,107,123,75,168,77,46,115,172,193,104,7,96,70,199,104,209,31,163,173,240,167,187,209,153,119,192,239,42,137,247,33,218,242,23,74,31,198,13,191,236,
+    206,177,122,51,147,215,239,0,239,155,13,254,24,221,190,29,163,231,222,28,107,129,94,244,175,118,180,62,217,242,37,244,232,143,209,161,137,50,161,186,219,230,24,246,151,0,254,205,101,
+    122,26,140,163,133,140,161,183,80,234,155,225,54,199,184,63,248,186,143,69,40,243,91,197,49,14,124,201,86,81,142,209,18,95,140,209,132,110,46,83,172,175,218,28,38,42,248,231,103,202,
+    147,86,179,213,93,24,209,251,69,135,182,59,70,215,165,16,112,176,205,17,249,39,155,202,124,58,91,18,0,255,172,239,72,176,139,84,20,38,81,59,130,246,131,182,239,141,209,99,235,127,153,
+    99,217,190,210,71,239,227,163,39,89,0,254,201,249,213,68,104,217,130,205,102,125,124,140,100,154,187,21,44,182,131,221,12,167,242,47,171,164,193,64,137,106,84,155,82,111,232,164,43,
+    177,124,42,47,198,122,1,239,189,33,88,24,238,111,79,215,17,186,246,190,64,92,4,62,119,182,146,220,54,71,196,86,210,217,247,242,249,134,225,153,22,227,192,22,93,182,188,13,35,161,167,
+    70,156,159,36,99,161,229,142,209,36,40,168,124,213,230,32,214,194,109,99,178,189,74,102,190,130,87,30,176,179,235,187,187,17,182,199,104,193,27,163,3,39,175,8,149,190,216,74,114,186,
+    92,3,111,146,13,224,31,4,214,59,117,191,134,235,157,221,109,199,121,213,114,87,74,77,37,56,70,251,91,73,55,109,14,66,151,195,193,208,3,94,2,248,7,133,23,13,177,233,9,139,157,205,77,
+    13,235,93,247,11,90,62,112,112,142,53,10,31,169,180,232,118,228,77,192,24,63,175,197,254,58,152,204,155,1,225,122,123,21,210,112,14,238,156,106,188,37,182,253,134,149,211,168,236,127,
+    114,224,206,193,119,39,88,142,255,150,98,22,253,163,145,90,190,112,171,222,150,105,168,161,177,179,71,241,102,179,217,168,73,87,203,36,185,119,154,70,143,122,17,77,234,110,192,87,102,
+    250,238,18,7,173,74,123,148,110,137,254,115,88,20,102,70,72,88,105,11,162,40,94,159,172,116,110,61,116,237,85,238,224,99,188,11,125,185,237,59,242,124,251,11,182,187,149,60,84,176,
+    93,140,237,192,76,171,33,76,244,16,217,118,210,233,116,23,225,223,181,155,246,123,189,254,100,19,246,157,245,70,254,12,90,50,40,128,127,94,88,233,8,193,229,82,168,109,105,255,183,182,
+    215,111,127,151,165,72,146,179,77,113,245,139,198,204,127,254,14,63,230,172,159,182,228,99,195,159,208,195,72,104,6,132,71,215,189,41,18,185,239,71,174,126,114,125,231,65,223,153,142,
+    237,194,95,210,209,210,199,87,194,195,195,245,212,40,250,150,55,185,185,253,109,72,31,131,128,175,198,252,65,0,94,142,236,216,165,55,169,7,132,63,185,171,242,167,152,82,63,80,191,83,
+    14,142,226,113,115,38,203,22,158,138,141,166,223,241,248,6,14,33,126,131,210,241,229,225,58,11,63,135,238,8,53,103,190,112,228,57,232,63,254,9,251,177,223,192,234,77,184,184,174,196,
+    209,169,74,123,86,236,55,181,196,214,238,27,192,155,96,131,146,143,251,134,60,29,155,37,148,184,77,173,150,216,57,124,3,88,246,103,208,163,29,181,40,128,127,155,240,169,169,213,108,
+    182,26,226,55,110,147,17,186,244,43,152,151,131,180,124,29,124,39,78,83,75,16,68,161,49,51,201,55,254,126,168,231,103,240,112,208,95,240,242,242,44,222,110,54,216,72,243,81,119,34,
+    127,139,135,88,139,94,127,56,28,246,63,36,110,174,178,112,119,117,197,150,181,180,111,255,110,115,49,234,247,250,227,5,63,215,193,249,187,155,68,44,250,255,92,71,80,101,73,230,233,
+    197,104,76,2,255,233,249,200,243,187,39,255,1,224,19,175,101,145,71,253,233,124,189,156,148,61,96,251,187,111,30,47,131,177,133,90,229,14,216,57,207,220,174,119,102,178,106,253,128,
+    178,161,233,22,128,31,235,187,168,102,179,249,108,174,88,109,119,165,229,225,252,171,54,242,95,80,54,142,234,118,179,217,29,8,128,31,22,139,110,171,249,114,185,84,46,21,11,182,115,
+    185,214,30,47,20,205,159,61,63,80,247,160,110,86,171,245,122,189,90,237,1,252,64,224,73,182,92,60,165,100,59,23,157,82,174,136,157,233,82,51,31,56,121,38,250,97,119,214,61,71,7,240,
+    227,132,59,185,82,209,143,83,202,239,121,167,148,91,99,229,239,232,218,53,172,2,248,113,192,237,43,224,19,178,157,98,62,151,173,76,239,95,195,150,182,15,233,58,192,59,11,192,15,155,
+    99,141,221,33,58,164,92,46,23,222,231,247,21,54,53,245,86,247,84,193,4,192,15,123,6,43,149,66,185,20,69,92,44,231,107,119,221,163,215,34,117,29,224,3,134,232,199,149,48,153,149,178,
+    239,206,179,247,70,185,244,94,86,238,184,73,175,173,35,117,157,17,218,4,240,35,35,181,171,239,185,108,225,61,140,124,95,96,99,251,9,239,106,199,212,93,7,22,55,27,204,205,124,212,174,
+    86,236,37,82,33,88,202,165,66,245,142,175,20,61,174,162,112,215,91,245,200,86,43,139,65,224,211,55,216,82,149,233,71,171,90,202,102,243,167,82,46,217,212,217,238,29,31,193,251,213,
+    173,238,110,127,100,238,166,18,139,21,236,181,159,245,173,60,233,10,149,66,54,95,120,47,22,178,181,213,195,128,79,186,26,139,199,60,152,221,240,247,148,143,202,108,212,170,86,138,213,
+    238,250,158,115,104,125,19,208,221,48,170,75,25,63,209,65,92,101,77,93,74,155,59,247,42,47,37,236,232,30,116,118,79,208,114,112,1,220,45,229,59,111,40,145,189,189,12,118,116,13,166,
+    55,157,57,185,62,250,144,93,97,253,176,63,234,184,93,136,0,24,1,48,2,96,4,192,8,128,1,140,0,248,55,46,132,113,4,158,95,96,114,106,114,128,152,79,224,179,174,161,25,184,115,198,33,240,
+    89,87,91,78,90,130,56,213,160,201,23,240,89,247,32,143,197,74,46,159,207,231,106,75,212,48,63,192,231,139,42,251,197,160,86,206,229,223,157,163,209,229,183,182,121,87,96,227,120,56,
+    104,6,54,27,126,78,87,234,213,202,217,188,115,240,253,114,38,75,186,231,155,143,180,173,179,23,188,221,237,143,186,137,55,190,255,85,94,231,7,117,222,173,21,109,221,192,25,233,114,
+    118,116,207,83,179,155,213,121,191,127,181,222,236,212,189,102,0,248,239,249,238,230,157,106,33,91,40,94,159,128,119,128,239,86,106,100,183,10,158,200,90,173,183,59,245,192,98,41,51,
+    120,1,124,217,169,230,179,133,210,205,253,134,114,126,250,200,99,209,171,243,128,205,90,41,51,120,1,188,18,165,235,156,154,173,169,247,171,224,192,153,187,117,168,148,143,184,0,254,
+    72,95,165,146,143,208,45,149,10,217,170,114,199,101,210,103,23,27,112,1,252,193,49,59,185,114,24,183,92,204,231,242,213,206,125,255,9,73,117,245,153,240,122,131,11,224,143,43,96,77,
+    200,151,174,75,247,61,159,45,213,58,243,157,121,223,54,135,177,253,84,152,169,18,102,26,248,164,91,174,117,228,131,73,239,222,138,214,157,219,163,209,215,71,113,195,255,145,67,244,
+    229,2,184,211,222,40,228,42,98,87,214,78,47,70,123,192,102,146,118,80,119,219,245,173,50,42,248,225,147,172,211,200,156,43,11,93,249,244,56,124,220,75,148,136,161,237,213,237,102,125,
+    141,172,1,248,129,194,178,189,76,42,228,243,21,113,176,216,159,117,31,62,106,232,199,125,160,148,153,122,131,3,123,141,14,139,42,237,90,85,156,42,206,123,20,200,95,123,203,157,93,202,
+    246,128,237,148,242,102,207,212,69,37,246,90,149,22,53,84,85,251,171,186,222,255,90,63,30,14,232,100,61,126,148,254,82,23,199,179,88,7,166,95,189,240,247,180,147,136,151,208,178,13,
+    252,117,117,91,186,137,227,89,188,2,19,122,152,212,42,213,145,6,97,46,129,9,221,86,227,78,106,123,8,115,8,76,136,90,141,167,157,196,69,3,83,45,238,128,237,249,149,16,79,191,218,73,
+    165,82,18,31,255,48,29,128,3,190,38,29,159,125,95,95,211,241,49,128,121,3,54,233,36,158,76,185,192,67,0,115,6,108,209,73,194,245,181,199,232,57,128,249,2,182,232,244,53,121,25,160,
+    237,2,46,29,48,141,230,10,216,162,179,140,239,155,204,204,225,203,21,176,69,37,223,55,149,204,132,95,238,255,15,175,153,184,0,54,169,252,150,240,125,211,147,235,7,176,229,253,16,90,
+    86,153,38,1,48,19,245,171,228,124,223,215,228,248,102,183,65,213,111,219,211,132,70,187,3,248,247,249,174,138,190,111,42,209,15,141,200,100,209,42,84,68,57,36,108,81,99,49,151,84,238,
+    133,99,28,248,238,42,1,223,120,247,218,151,24,131,116,60,145,136,103,102,87,194,132,30,170,47,207,207,25,238,151,83,204,3,91,68,173,122,190,246,2,169,115,237,107,210,121,50,153,78,
+    165,211,137,140,28,176,36,116,159,143,61,61,61,197,158,102,156,11,179,255,142,14,218,142,7,124,171,215,231,223,9,49,106,231,143,211,241,182,79,73,136,94,141,61,63,63,63,61,199,94,100,
+    190,133,89,7,38,100,148,72,121,190,137,172,18,158,64,47,51,231,254,86,42,81,244,155,31,246,180,44,254,244,108,87,176,45,92,51,185,94,68,49,14,236,3,158,124,223,194,229,104,209,89,242,
+    242,116,78,20,252,77,98,147,78,158,92,224,55,190,79,7,48,15,220,243,6,104,219,119,17,30,110,45,111,135,41,149,168,234,129,10,158,191,92,128,159,94,248,222,89,100,28,152,208,142,183,
+    69,152,140,152,18,19,83,240,128,59,254,80,108,81,53,19,59,1,59,99,52,42,248,55,87,240,196,5,76,102,110,39,196,132,170,185,203,35,58,149,12,222,255,39,102,205,3,206,236,120,46,97,230,
+    129,23,231,38,116,218,105,64,91,145,31,159,231,88,201,183,224,252,203,254,139,241,116,1,126,122,153,3,248,23,79,162,205,110,34,153,78,167,147,169,73,4,147,69,167,151,41,216,213,28,
+    203,41,237,93,218,43,225,22,207,99,52,243,203,36,170,119,51,241,120,252,109,26,117,220,157,16,119,145,156,142,215,175,86,200,132,248,99,244,155,202,177,48,7,141,14,42,79,187,227,200,
+    247,115,16,106,84,61,224,235,83,90,246,244,58,230,141,209,60,207,163,57,248,135,177,174,126,10,125,180,125,59,207,177,82,175,233,121,8,120,157,240,74,184,141,10,254,221,51,45,147,88,
+    86,244,20,108,238,181,57,222,194,255,244,172,89,245,199,104,142,207,201,115,253,74,127,103,17,229,206,177,42,161,134,213,213,24,205,113,63,154,107,96,66,69,239,17,220,38,225,253,96,
+    197,31,163,7,0,102,179,128,213,130,219,230,72,220,174,162,172,138,7,92,49,185,29,163,249,6,150,189,54,71,38,162,77,61,242,128,227,10,183,37,204,55,240,220,107,115,228,110,230,81,254,
+    150,161,45,60,166,38,128,25,4,238,121,59,13,53,61,12,108,47,146,11,94,9,87,77,12,209,12,78,177,188,54,71,42,209,189,125,200,218,254,30,112,98,195,235,24,29,227,185,128,215,94,155,227,
+    53,114,39,66,122,9,140,209,0,102,15,56,176,149,180,188,5,36,84,125,243,55,133,121,125,113,11,231,192,175,151,243,88,229,99,196,58,136,208,70,224,33,204,233,66,137,107,224,205,91,210,
+    59,81,73,34,255,6,184,7,119,98,29,12,209,44,206,178,6,47,233,116,42,149,78,102,62,233,69,90,101,231,240,236,243,115,236,101,9,96,22,133,173,78,60,153,76,134,111,53,4,75,56,117,58,254,
+    30,235,162,147,197,102,9,147,81,54,243,86,251,116,191,215,121,119,109,252,249,57,59,179,176,155,196,168,48,85,151,171,47,94,124,103,127,176,156,73,71,236,7,179,76,252,229,29,209,243,
+    71,38,5,48,187,207,97,235,15,159,243,125,13,156,123,224,127,61,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,
+    48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,
+    17,0,35,0,70,0,140,0,24,192,248,22,0,24,1,48,2,96,4,192,200,253,243,31,134,185,203,140,64,84,57,23,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,249,249,249,
+    244,244,244,243,243,243,234,234,234,225,225,225,222,222,222,220,220,220,218,218,218,217,217,217,216,216,216,214,214,214,204,204,204,191,191,191,187,187,187,186,186,186,184,184,184,
+    182,182,182,181,181,181,180,180,180,173,173,173,162,162,162,152,152,152,149,149,149,148,148,148,146,146,146,145,145,145,144,144,144,142,142,142,133,133,133,125,125,125,115,115,115,
+    113,113,113,112,112,112,110,110,110,109,109,109,108,108,108,104,104,104,95,95,95,87,87,87,81,81,81,75,75,75,68,68,68,61,61,61,55,55,55,49,49,49,43,43,43,37,37,37,36,36,36,34,34,34,
+    32,32,32,30,30,30,26,26,26,22,22,22,18,18,18,16,16,16,13,13,13,11,11,11,8,8,8,6,6,6,5,5,5,3,3,3,2,2,2,1,1,1,0,0,0,192,162,52,149,0,0,13,87,73,68,65,84,120,218,237,221,135,114,218,74,
+    24,5,96,140,105,166,119,99,186,64,66,32,209,140,16,93,187,239,255,86,119,69,17,66,192,141,77,192,120,55,231,204,157,100,230,134,216,51,254,178,255,118,201,71,17,161,227,195,143,0,192,
+    8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,
+    17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,135,172,23,
+    179,249,26,192,194,102,49,25,13,135,159,51,2,96,65,125,199,195,209,136,17,155,0,22,50,150,97,251,178,140,151,0,22,49,203,241,206,119,244,143,55,97,97,129,23,14,176,97,1,88,228,22,252,
+    143,215,104,113,251,224,201,16,53,90,232,81,244,212,1,158,108,0,44,114,39,60,26,47,0,44,118,141,158,2,88,196,152,168,209,98,3,31,199,209,163,57,128,5,12,49,254,166,70,19,107,179,217,
+    16,0,255,230,204,28,224,207,111,111,42,237,105,45,0,139,89,163,9,93,233,114,77,153,81,2,96,46,106,180,65,190,233,59,205,191,250,124,190,152,202,189,48,239,192,155,197,124,121,181,142,
+    154,78,11,30,127,171,70,19,178,200,249,94,252,126,191,207,223,225,189,74,115,14,60,159,48,188,201,252,143,53,122,248,157,26,77,44,90,241,249,253,47,47,47,126,95,204,228,188,13,243,
+    13,188,223,212,31,153,228,143,53,250,59,85,129,214,153,237,139,13,252,242,218,231,188,9,115,13,188,113,22,171,166,151,151,50,102,199,26,189,250,134,111,199,191,243,101,191,250,85,186,
+    1,240,211,26,176,227,55,52,46,50,172,63,71,223,222,82,178,168,22,240,237,124,237,22,172,163,5,63,177,7,30,186,132,47,238,250,78,191,93,163,45,58,136,30,124,89,31,28,159,163,15,254,
+    13,45,216,94,204,184,36,60,119,254,120,242,181,134,184,161,131,216,209,247,229,181,135,81,244,19,179,158,12,93,194,227,217,255,124,226,139,27,14,22,53,210,142,47,3,174,97,30,252,212,
+    204,70,39,49,175,215,232,175,149,104,66,231,5,151,175,47,63,183,0,252,212,152,227,161,91,120,106,93,153,10,15,191,116,48,139,144,117,245,197,229,155,51,176,84,249,244,113,214,137,240,
+    133,193,52,251,0,203,248,75,11,29,22,109,251,95,92,3,44,19,155,13,191,96,160,245,121,42,124,54,223,93,154,134,97,126,233,96,37,155,0,191,186,124,163,67,1,124,5,216,108,88,26,39,194,
+    147,155,15,201,110,168,22,116,249,6,116,17,124,69,216,77,90,159,10,143,111,60,190,65,232,52,233,158,32,169,66,248,10,177,93,104,77,255,56,152,254,202,0,203,200,28,125,253,47,18,21,
+    227,32,151,24,251,193,230,169,240,45,109,216,162,53,247,4,169,66,44,2,224,95,58,152,30,78,190,111,67,232,210,181,130,229,203,45,136,32,247,138,69,57,209,113,50,152,190,225,54,146,69,
+    7,206,12,137,77,144,12,42,202,141,53,97,142,236,44,93,203,150,55,0,179,41,146,179,133,228,139,13,132,241,21,232,76,214,218,56,238,59,108,110,0,86,253,254,253,38,127,64,163,226,156,
+    148,23,232,208,157,229,172,59,223,114,12,154,154,113,159,223,206,203,107,71,32,95,161,78,85,90,230,104,104,63,149,99,114,203,163,117,44,218,125,245,249,94,94,124,254,38,21,233,198,
+    184,88,199,102,231,198,120,252,57,93,221,244,119,9,237,229,223,252,175,49,201,34,4,192,191,183,39,94,222,252,100,44,198,106,234,154,104,215,152,240,164,59,87,149,38,123,231,203,254,
+    150,181,225,112,241,3,192,30,68,114,237,15,156,102,14,96,241,154,182,173,187,28,170,157,254,130,59,97,222,128,201,46,63,218,170,237,105,242,80,206,199,130,129,104,86,227,109,136,205,
+    25,48,113,75,255,136,46,177,31,6,209,41,196,67,129,80,36,18,14,196,186,156,181,97,222,90,48,27,231,234,253,177,185,114,154,243,99,123,100,246,235,164,91,97,186,193,8,227,13,71,162,
+    129,212,148,47,97,190,128,201,64,105,52,154,45,89,233,244,244,177,185,62,22,237,71,233,206,122,181,68,56,16,12,219,186,118,34,145,40,103,39,165,121,2,38,116,220,150,218,237,118,171,
+    37,53,27,205,54,83,238,27,11,250,152,209,237,118,88,165,213,114,111,76,247,109,175,187,21,14,1,248,129,192,221,58,211,181,99,51,239,148,213,158,54,152,204,239,255,51,95,232,82,62,26,
+    8,156,232,218,190,209,49,128,31,150,165,210,220,3,239,145,153,114,189,222,148,100,69,29,223,247,159,210,70,181,7,205,161,183,83,222,112,56,26,200,113,246,12,121,31,79,13,120,42,75,
+    45,79,118,202,82,67,214,239,250,157,90,193,96,40,226,213,141,68,222,66,65,133,179,121,18,103,192,173,203,105,183,37,249,243,110,253,176,69,187,145,144,87,55,108,235,6,98,245,37,193,
+    52,233,97,89,171,245,246,53,226,70,239,110,192,132,22,2,81,175,110,56,24,136,230,106,58,229,45,124,13,178,12,185,177,43,202,231,192,205,206,234,110,223,102,150,10,70,78,116,35,193,
+    64,56,81,235,155,246,164,12,192,15,21,238,200,141,70,67,218,42,183,61,192,235,251,125,151,248,17,120,171,27,76,85,187,19,186,95,182,4,240,67,171,244,116,160,169,138,220,108,176,209,
+    115,203,133,220,174,223,173,68,19,186,204,7,222,14,186,161,64,48,94,233,152,116,191,108,9,224,71,183,97,150,205,124,50,208,186,170,210,170,215,15,141,249,206,131,44,53,16,142,70,222,
+    182,186,177,66,103,196,173,46,135,45,216,181,201,176,50,6,189,142,220,106,52,154,146,84,111,247,239,183,152,69,200,188,198,104,3,76,183,168,12,214,28,235,82,78,247,131,143,171,207,
+    155,217,88,239,118,20,165,55,190,51,65,55,31,79,230,235,131,109,131,230,250,12,30,207,27,254,7,230,165,121,239,131,84,196,62,102,61,91,111,117,57,63,129,199,251,137,142,61,50,121,196,
+    102,3,143,131,102,225,128,79,187,229,135,116,3,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,252,219,230,193,247,159,178,218,215,148,8,128,127,131,238,238,183,123,243,58,202,0,126,58,239,
+    194,48,238,252,146,111,251,170,112,95,223,63,21,113,179,217,112,220,152,125,220,235,126,246,20,89,238,244,201,93,125,231,173,100,44,26,207,215,58,125,211,85,178,1,252,211,186,203,137,
+    174,180,26,146,36,53,91,154,117,199,47,109,22,2,193,80,200,222,17,102,202,245,110,175,63,221,157,7,226,16,217,199,175,46,53,180,78,123,123,164,163,213,98,255,13,239,120,162,67,9,188,
+    189,69,34,219,51,29,193,192,43,99,78,20,106,234,192,124,64,103,15,224,43,186,27,67,87,229,70,179,117,56,149,101,31,155,189,91,129,182,14,103,178,182,135,221,163,91,230,64,40,150,126,
+    111,107,38,90,240,163,121,237,95,166,125,85,110,214,37,215,193,202,118,189,123,191,239,48,141,7,35,222,59,13,111,97,91,57,146,234,225,126,240,163,179,24,116,229,102,83,242,28,155,109,
+    168,214,221,128,13,47,176,163,28,9,196,116,92,62,123,104,198,93,69,106,72,103,103,223,219,117,237,126,199,102,87,121,239,205,6,215,237,179,42,193,5,240,199,149,231,101,79,178,135,85,
+    231,119,147,154,202,252,142,131,172,222,91,136,245,188,23,90,113,56,18,140,79,184,106,194,124,1,19,173,126,126,113,197,190,94,216,144,71,119,236,27,9,85,162,108,138,20,10,71,163,103,
+    55,12,131,156,61,138,150,183,187,73,222,214,187,189,8,222,82,244,251,62,57,131,80,189,154,139,189,5,95,95,3,33,187,231,141,184,128,211,124,189,81,152,47,224,190,116,234,107,183,221,
+    150,210,251,92,60,96,172,190,24,247,117,185,148,138,217,203,29,193,240,118,94,188,235,131,241,16,150,7,2,55,218,238,171,223,172,63,86,186,195,5,125,196,177,89,114,24,178,171,245,66,
+    58,22,178,43,182,125,37,60,16,31,96,20,253,56,224,177,211,130,183,186,114,183,63,167,244,65,119,58,137,101,89,155,237,23,182,204,65,183,94,72,197,88,191,28,202,13,49,15,126,32,240,
+    98,247,144,14,91,183,41,171,253,233,195,116,93,204,155,253,206,161,57,232,171,114,207,228,109,173,146,179,105,210,80,174,75,173,86,179,46,171,250,140,208,31,186,143,77,236,198,124,
+    156,67,1,248,177,235,28,178,44,119,116,227,199,116,221,37,123,131,221,164,31,200,220,216,190,128,82,168,199,178,3,216,61,127,249,63,221,191,219,150,183,75,49,1,240,179,137,175,183,
+    221,191,60,159,101,253,213,223,6,240,79,180,110,67,31,252,197,142,237,172,215,27,204,5,35,246,137,228,187,80,171,165,98,69,30,220,68,68,136,86,72,39,51,133,206,6,175,213,249,165,190,
+    107,165,80,42,151,75,133,234,45,194,22,213,210,137,76,38,157,72,73,115,145,132,69,2,86,139,229,242,199,71,185,82,108,173,111,104,191,243,74,60,155,78,167,51,153,68,213,16,72,216,39,
+    142,111,175,242,193,124,153,112,137,9,145,111,55,224,94,50,147,222,38,27,175,152,120,57,229,111,139,69,251,149,210,214,151,165,50,184,1,88,75,236,129,211,217,100,65,163,22,222,31,252,
+    187,124,135,213,131,239,141,45,88,75,29,128,211,217,68,78,23,101,37,69,12,96,66,141,90,241,208,126,203,197,230,250,6,224,73,222,37,156,202,41,107,49,202,180,79,12,223,121,211,241,101,
+    21,90,167,183,188,227,93,177,7,209,251,100,82,73,101,69,113,187,240,183,100,173,28,125,203,239,221,211,234,122,109,233,203,243,41,186,148,82,199,54,156,73,167,196,24,76,11,113,63,216,
+    158,32,57,190,5,229,180,64,95,126,227,228,238,126,232,233,255,222,116,114,169,108,218,73,242,93,132,55,189,11,0,204,198,71,165,143,99,251,149,189,231,103,215,211,153,117,254,111,130,
+    210,153,73,189,255,18,122,185,228,81,56,147,204,107,252,15,181,124,2,180,95,247,4,169,88,95,122,212,250,237,106,77,214,188,78,155,94,53,95,168,157,158,191,97,173,186,159,79,184,133,
+    115,93,238,87,166,249,191,225,207,38,72,239,206,0,186,84,29,158,148,85,66,187,165,98,233,189,88,82,87,196,221,251,206,107,201,120,50,25,207,117,45,239,108,235,195,153,14,219,67,45,
+    239,7,0,252,243,245,121,114,226,171,123,219,111,185,84,41,151,203,31,239,238,155,45,108,196,28,207,100,51,153,108,50,215,63,237,102,45,58,173,165,210,174,193,116,166,177,224,187,74,
+    115,223,130,231,173,227,4,184,84,241,120,81,75,46,84,182,165,187,32,187,125,23,197,221,186,100,54,46,123,74,176,69,23,82,218,61,152,78,40,20,192,207,171,207,100,46,187,38,192,37,149,
+    122,166,62,179,218,174,121,151,223,107,199,119,59,179,66,156,219,25,102,82,121,239,162,23,161,86,39,123,28,76,103,207,63,1,224,159,236,128,187,174,9,146,221,209,122,128,71,149,210,
+    161,120,155,46,224,193,30,152,181,208,179,55,62,179,47,113,50,152,206,234,92,79,150,124,124,251,154,181,99,7,92,104,175,207,90,163,182,31,95,151,221,163,107,66,231,249,253,214,81,38,
+    81,95,147,243,5,16,221,53,152,206,12,0,252,188,17,150,94,58,174,64,215,207,46,160,17,170,22,202,135,229,143,147,183,135,75,241,108,250,74,141,222,126,221,241,71,194,249,192,12,37,250,
+    121,192,253,67,3,102,157,236,133,11,134,86,251,0,92,116,63,122,129,213,232,236,97,168,156,186,244,62,96,123,48,157,96,227,236,116,38,27,175,97,144,245,76,224,143,242,161,143,237,159,
+    65,177,82,236,84,240,147,45,98,246,7,133,253,116,55,27,111,94,2,180,232,178,157,74,164,210,233,68,174,79,241,214,149,231,245,193,243,90,177,114,152,32,145,11,93,244,126,141,139,249,
+    159,180,111,66,93,53,250,226,141,125,66,137,90,206,101,115,149,62,231,75,89,188,143,162,251,149,34,107,196,239,165,75,133,150,208,201,97,16,93,108,156,108,254,177,206,59,155,218,143,
+    161,18,221,139,77,148,125,122,245,169,247,151,88,170,124,178,176,86,43,191,151,107,218,229,58,171,237,150,57,24,112,199,243,215,22,239,135,26,157,168,173,175,125,237,221,23,1,240,115,
+    133,103,3,237,202,97,119,66,59,14,176,103,186,75,136,188,7,206,164,114,159,87,20,137,0,15,155,21,97,179,225,248,171,55,27,103,25,179,50,244,174,57,15,157,181,142,164,42,212,73,119,
+    209,128,175,183,51,123,25,100,63,198,122,175,206,188,139,152,139,195,182,81,38,81,89,82,2,96,30,219,246,240,48,198,42,72,214,89,255,172,30,107,244,72,224,38,44,48,48,27,99,237,103,
+    193,149,194,89,21,118,215,232,132,140,22,204,103,58,133,3,240,133,169,208,170,122,152,10,39,42,43,113,133,197,5,38,116,117,56,75,123,54,136,222,213,104,103,173,35,167,139,91,163,69,
+    6,158,58,103,61,42,231,15,58,180,232,103,254,95,168,209,34,3,15,42,206,70,132,121,105,33,179,238,212,232,210,92,88,97,113,129,45,218,115,42,116,107,125,105,79,176,155,116,198,209,99,
+    97,107,180,200,45,184,227,236,21,118,46,52,80,66,103,249,221,76,41,195,251,169,141,127,21,216,217,237,47,105,151,253,246,53,26,45,152,83,224,125,137,46,127,84,198,87,246,34,118,39,
+    100,179,241,234,90,216,31,131,208,163,232,90,209,62,19,93,41,180,86,23,63,64,22,82,60,101,63,150,35,63,194,40,154,75,97,189,82,40,150,74,133,218,132,94,89,172,94,212,115,169,68,150,
+    251,77,253,127,20,216,158,40,117,106,213,154,50,190,230,71,40,25,117,213,254,66,96,95,225,223,31,188,52,204,255,185,63,70,78,126,3,48,127,109,152,252,201,79,196,199,83,254,83,45,152,
+    252,235,79,165,197,43,222,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,
+    1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,126,4,0,70,0,140,
+    0,24,1,48,2,96,4,192,8,128,1,140,136,146,255,0,75,219,188,140,117,177,61,34,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,243,243,243,236,236,236,225,225,
+    225,223,223,223,220,220,220,218,218,218,217,217,217,216,216,216,213,213,213,196,196,196,188,188,188,186,186,186,184,184,184,183,183,183,182,182,182,181,181,181,180,180,180,176,176,
+    176,161,161,161,151,151,151,149,149,149,147,147,147,145,145,145,144,144,144,142,142,142,135,135,135,128,128,128,119,119,119,114,114,114,112,112,112,110,110,110,109,109,109,108,108,
+    108,106,106,106,102,102,102,98,98,98,91,91,91,84,84,84,78,78,78,70,70,70,63,63,63,54,54,54,47,47,47,40,40,40,37,37,37,36,36,36,34,34,34,31,31,31,28,28,28,24,24,24,20,20,20,17,17,17,
+    15,15,15,12,12,12,10,10,10,7,7,7,5,5,5,3,3,3,2,2,2,1,1,1,0,0,0,167,111,176,229,0,0,12,210,73,68,65,84,120,218,237,221,9,115,162,72,24,6,96,179,25,52,106,48,135,138,38,168,168,241,2,
+    188,193,91,186,255,255,191,218,6,21,17,209,204,164,52,177,59,239,91,181,51,181,73,102,182,54,79,190,190,27,98,20,17,58,49,124,11,0,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,
+    4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,
+    8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,254,231,56,243,233,124,13,96,97,51,27,15,135,195,241,252,236,215,16,
+    0,115,155,233,112,192,128,7,163,197,201,175,88,79,45,203,158,3,152,207,172,198,174,47,19,30,59,39,190,98,57,30,184,153,16,0,115,217,64,111,124,89,78,212,232,218,218,254,4,204,0,204,
+    99,38,59,224,193,228,252,79,192,192,114,0,204,115,5,15,172,232,54,216,222,125,193,104,9,96,14,179,28,13,207,2,238,250,104,0,243,58,9,182,206,119,194,243,221,15,192,96,188,2,48,143,
+    177,207,119,194,83,255,211,54,6,89,188,119,194,17,163,40,178,247,159,2,152,207,137,240,217,78,120,53,30,10,222,5,11,15,76,172,115,53,186,24,250,93,240,26,192,55,172,200,114,234,115,
+    103,123,217,137,240,93,176,16,192,36,240,235,113,145,142,78,23,105,160,188,103,0,190,97,223,105,191,207,250,208,104,225,245,248,244,68,233,179,89,50,128,111,195,183,223,170,213,234,
+    157,9,37,255,58,81,154,13,63,89,231,2,240,45,248,246,180,218,71,189,94,109,245,163,133,247,19,37,155,156,180,23,182,11,230,30,152,208,81,205,245,173,127,212,154,209,194,126,59,60,24,
+    133,22,171,214,214,103,123,77,0,190,129,24,154,235,203,114,66,248,244,106,229,111,232,130,249,7,118,58,59,224,143,90,35,82,248,100,67,252,233,86,19,128,111,97,10,236,87,240,41,225,
+    249,240,196,106,229,167,155,197,0,190,137,49,180,15,236,246,195,131,99,225,192,150,224,226,111,39,80,0,190,157,44,245,3,225,209,145,240,169,229,12,127,9,100,40,234,86,161,32,211,164,
+    69,231,64,120,124,36,60,137,94,142,158,254,130,73,146,24,11,29,243,78,53,40,108,81,231,212,104,121,254,23,238,0,190,61,225,105,59,40,220,178,67,53,188,155,40,133,86,163,39,191,161,
+    11,22,100,179,225,64,184,218,10,183,210,203,113,212,233,119,255,64,229,120,13,224,155,23,62,232,135,27,189,176,176,61,26,141,172,208,237,6,255,72,180,200,45,180,32,27,254,132,206,206,
+    11,211,229,98,121,52,127,90,90,238,157,134,225,132,0,152,3,225,181,185,23,174,71,8,71,101,53,181,45,123,65,41,128,121,16,222,47,74,123,53,60,250,187,59,131,132,82,0,243,33,76,214,65,
+    97,77,23,158,238,151,1,179,90,92,233,129,101,233,214,140,130,88,40,96,230,185,95,181,252,168,53,39,0,22,12,216,91,181,172,238,128,219,11,224,138,6,188,93,181,244,206,119,104,38,10,
+    88,60,224,205,124,184,198,166,73,90,103,14,96,1,129,221,26,54,90,141,143,166,49,7,173,144,192,110,217,46,198,131,41,65,253,10,10,188,131,133,47,191,192,132,156,187,139,116,254,166,
+    18,128,185,114,6,159,136,192,107,203,52,204,254,108,5,100,17,129,9,153,27,117,77,211,106,173,142,233,14,165,208,32,139,6,76,77,237,131,165,94,171,50,100,221,28,47,81,200,34,1,19,58,
+    105,122,55,145,234,30,178,86,253,104,27,221,241,226,219,198,205,196,113,8,128,175,10,220,11,108,235,187,200,85,77,107,180,205,158,189,252,22,93,247,55,206,136,121,3,14,158,219,8,84,
+    114,163,109,140,174,120,116,142,16,103,237,186,46,6,131,53,103,115,108,222,128,251,213,67,224,45,50,235,146,235,230,234,170,149,75,45,163,156,73,36,178,29,7,21,124,69,224,121,91,107,
+    212,35,226,182,214,221,203,215,214,182,211,93,207,186,31,249,244,125,44,118,119,23,139,149,86,60,141,233,184,27,69,91,205,170,215,46,31,19,215,90,23,222,65,218,150,238,172,219,200,
+    63,254,97,184,255,221,187,249,239,206,160,107,0,95,81,184,221,168,106,145,200,127,123,208,238,111,251,93,246,203,170,223,81,101,137,149,237,157,103,235,230,62,150,91,162,130,175,41,
+    188,176,186,122,187,174,105,181,122,216,120,112,65,96,86,188,118,191,150,125,184,15,226,122,192,119,201,49,117,0,124,69,97,119,56,59,236,234,173,186,86,13,34,215,154,246,229,128,29,
+    58,43,165,89,233,122,237,242,127,193,220,223,165,0,124,93,225,205,24,135,76,251,102,167,89,99,149,236,181,214,31,13,205,36,23,244,181,30,217,136,234,62,172,139,38,250,123,145,151,211,
+    190,209,105,212,220,74,174,105,237,233,197,10,152,16,230,27,129,203,120,217,199,116,12,178,190,19,121,101,247,141,118,179,209,50,46,248,160,13,135,150,99,247,17,184,247,247,119,177,
+    251,242,138,167,149,14,206,79,116,236,42,217,30,77,47,184,194,196,254,162,92,8,120,131,27,251,47,158,239,240,245,29,18,225,2,56,9,254,118,25,224,117,54,8,236,54,214,177,88,236,207,
+    99,190,217,227,237,187,35,202,237,194,203,46,46,17,170,236,128,183,165,123,159,206,55,187,11,111,245,3,192,252,199,161,61,41,230,173,91,185,184,119,241,108,197,220,60,168,197,113,80,
+    193,130,8,27,127,216,28,248,206,109,151,149,118,223,221,198,32,107,135,199,115,5,0,142,206,154,26,178,244,39,157,175,118,189,35,244,107,135,215,51,35,0,62,89,195,171,158,105,173,183,
+    165,203,239,255,7,128,79,11,243,93,186,0,254,116,40,237,56,2,28,230,3,176,224,17,229,181,58,144,20,22,152,108,122,73,16,139,8,188,197,157,79,102,184,47,42,28,48,217,44,26,174,172,110,
+    187,82,42,183,108,8,11,4,76,182,165,59,237,233,245,82,81,41,22,139,74,25,194,162,0,239,182,8,199,102,171,172,42,133,226,219,59,139,170,84,240,84,14,33,128,183,39,57,186,157,138,90,
+    80,60,220,55,47,170,98,92,252,208,44,1,240,15,248,146,201,80,215,202,69,69,41,250,184,110,222,11,173,203,54,19,219,65,28,1,240,247,250,142,89,187,92,240,218,229,183,131,92,22,152,184,
+    253,251,230,65,210,14,127,91,132,252,2,19,106,168,108,72,245,30,214,245,154,104,243,114,135,89,9,181,75,153,244,99,174,172,111,158,34,206,113,37,199,248,242,237,171,69,245,24,151,213,
+    175,170,148,47,247,112,74,66,71,57,41,158,72,196,165,228,99,78,51,198,116,83,201,92,34,243,85,193,235,154,162,30,227,178,122,102,211,164,193,5,125,23,121,41,149,116,243,16,151,24,178,
+    162,153,155,151,223,113,56,238,138,113,85,192,118,185,248,30,198,125,47,42,5,181,210,190,232,173,134,110,250,33,249,224,134,25,167,92,228,180,92,108,152,147,21,229,111,73,148,47,224,
+    201,1,176,139,203,198,91,229,166,222,159,209,139,94,75,234,36,54,190,155,36,83,73,214,90,199,211,217,66,171,231,80,28,186,187,34,240,162,178,3,118,219,101,54,15,46,85,218,230,116,63,
+    63,190,20,112,251,0,216,171,228,45,114,190,71,113,1,252,122,194,68,87,84,183,85,118,59,93,69,173,180,140,201,110,144,123,201,255,140,123,49,41,145,122,8,199,237,147,19,210,99,31,143,
+    112,184,102,9,55,189,133,103,86,186,77,189,183,121,240,202,21,198,61,132,150,165,84,42,249,112,156,100,90,202,241,245,174,0,238,30,225,160,87,74,37,173,211,29,111,75,154,92,167,165,
+    152,20,36,41,241,16,129,204,170,184,203,85,35,205,221,74,22,157,91,246,55,60,198,112,161,231,31,19,12,153,245,189,135,200,41,169,1,224,171,118,195,87,232,116,163,127,144,250,134,150,
+    99,200,241,67,228,84,188,9,224,43,19,127,199,138,210,230,52,193,162,215,41,101,211,146,135,188,105,174,83,137,52,154,232,31,196,119,46,87,219,100,187,203,48,235,53,75,47,12,89,114,
+    231,74,169,135,63,21,7,163,232,31,236,161,47,59,37,222,237,9,79,77,173,248,146,142,51,229,120,5,143,50,252,193,76,187,186,193,102,79,87,217,248,159,154,149,124,46,175,243,182,88,41,
+    208,171,237,8,237,186,231,0,212,214,229,207,238,108,31,137,182,92,172,41,111,91,74,2,189,156,146,154,170,183,83,172,180,190,250,232,89,231,220,110,209,166,119,199,253,224,159,235,127,
+    93,95,111,149,186,248,181,113,238,166,54,157,243,175,251,160,0,254,97,95,38,172,116,190,210,70,179,63,50,232,246,38,162,221,145,16,4,216,161,230,155,191,209,164,52,190,228,59,43,63,
+    166,211,175,13,193,94,75,27,19,196,183,91,124,219,237,20,191,43,250,191,27,17,58,205,75,9,247,148,142,58,163,14,128,111,205,119,88,10,156,4,80,7,255,78,68,156,178,119,74,39,149,140,
+    171,66,157,160,143,9,225,219,47,21,124,223,119,165,229,124,225,175,176,31,55,155,252,201,100,188,180,20,72,88,132,7,161,209,94,169,168,238,125,27,95,120,102,37,251,25,73,39,118,199,
+    176,226,124,61,211,93,116,96,207,119,95,191,133,230,87,90,88,135,14,30,119,199,116,146,73,169,76,28,7,192,183,226,219,61,235,203,230,181,127,177,1,65,232,50,39,165,252,77,125,169,66,
+    69,25,105,197,4,243,13,173,83,146,208,239,1,248,195,115,236,238,73,202,135,164,127,140,82,170,44,4,17,142,9,230,187,8,249,18,179,82,174,24,71,173,182,19,102,39,196,169,38,30,2,53,156,
+    183,197,16,142,241,238,171,238,125,213,66,251,112,252,75,200,178,254,34,203,114,70,61,58,22,239,140,250,227,85,88,88,218,159,165,76,137,34,28,19,199,247,93,9,249,178,127,105,202,47,
+    217,108,246,85,46,29,84,54,113,186,229,92,46,95,182,14,133,169,158,142,11,39,28,227,218,215,46,29,248,174,194,190,86,238,233,245,229,229,133,253,19,60,175,238,80,227,89,126,126,126,
+    146,21,251,144,157,26,201,131,26,158,8,32,204,53,48,105,239,239,162,169,74,59,252,164,29,135,234,25,215,151,9,203,141,253,231,8,157,228,229,220,235,235,107,86,46,47,14,70,90,43,170,
+    63,236,239,52,164,36,101,202,191,48,207,239,108,160,243,253,85,165,119,69,139,24,73,53,229,236,6,56,163,5,63,220,222,126,248,37,23,186,136,178,166,237,128,112,82,42,240,191,106,201,
+    53,240,212,7,126,47,104,71,235,87,236,7,160,184,171,224,140,190,151,36,84,243,221,219,135,192,172,149,110,165,130,194,42,247,171,150,92,3,47,42,219,37,232,247,66,237,248,250,183,67,
+    123,185,231,13,240,75,182,23,4,174,110,129,179,114,41,244,130,156,144,112,74,42,243,190,106,201,247,32,203,44,184,15,115,120,143,244,117,155,98,191,128,149,64,125,7,186,230,167,124,
+    248,37,102,174,112,218,23,78,38,19,58,231,221,48,223,211,164,117,71,41,190,189,21,163,247,23,8,169,248,149,90,57,128,31,108,6,215,47,175,207,217,163,219,160,172,96,3,53,156,146,74,
+    168,224,159,44,225,85,167,244,246,94,106,71,141,133,216,36,41,239,87,112,39,224,72,232,82,149,119,163,235,214,209,159,100,160,77,95,152,141,164,215,124,247,194,188,175,100,81,187,219,
+    181,35,207,81,185,93,240,203,182,80,115,253,96,161,186,235,31,126,219,61,143,18,110,36,183,235,210,41,73,67,19,125,27,208,17,31,219,117,193,89,89,93,30,210,155,155,161,151,219,9,71,
+    60,219,195,21,126,240,86,60,88,31,108,0,248,135,109,79,62,221,136,148,228,29,112,35,180,5,97,239,27,239,40,64,111,213,82,74,166,82,9,169,180,68,31,124,171,69,61,57,173,184,42,251,157,
+    112,57,178,250,89,145,187,55,71,211,149,5,230,193,55,26,70,244,188,107,135,115,86,232,16,64,160,245,126,139,94,202,112,168,221,105,116,186,20,43,89,183,11,220,246,215,171,222,22,97,
+    96,127,9,228,57,119,226,26,196,197,111,42,2,248,194,45,180,63,23,202,178,185,80,104,53,131,78,21,191,249,110,157,64,36,142,179,198,118,225,13,3,251,3,169,151,231,163,129,148,187,28,
+    189,3,22,234,144,236,239,1,14,76,133,50,121,235,120,159,201,216,175,86,142,132,186,201,240,123,128,253,173,66,185,228,28,127,118,156,127,218,214,247,147,1,96,30,179,42,249,192,205,
+    227,197,42,186,80,253,78,88,35,104,162,57,44,224,81,110,87,162,175,17,227,100,135,182,124,127,213,17,185,19,22,22,216,120,246,187,224,113,20,112,247,213,159,37,15,68,110,163,133,5,
+    246,151,57,228,242,58,106,144,29,88,231,106,3,152,67,224,254,118,43,41,43,119,162,253,202,254,102,113,11,192,28,78,131,23,12,208,61,57,153,201,79,162,55,19,245,29,112,166,3,96,30,133,
+    199,5,57,243,148,145,115,230,137,205,68,54,10,203,122,190,185,1,6,89,92,10,91,13,37,159,175,244,78,173,68,82,61,243,148,205,102,51,25,29,43,89,156,10,211,153,117,230,161,57,132,118,
+    114,178,44,231,196,94,231,16,249,21,239,222,250,197,153,69,12,66,123,237,70,107,36,248,43,45,99,34,255,207,125,242,224,50,18,248,21,192,66,78,166,28,226,136,254,74,218,95,13,252,27,
+    2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,
+    0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,111,1,128,17,0,35,0,70,0,140,0,24,
+    1,48,2,224,95,148,255,1,10,206,197,239,114,174,199,217,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,
+    71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,218,218,218,24,24,24,212,212,212,159,159,159,155,155,155,241,241,241,104,104,104,
+    145,145,145,103,103,103,140,140,140,250,250,250,46,46,46,108,108,108,0,0,0,73,73,73,37,37,37,146,146,146,219,219,219,109,109,109,254,254,254,10,10,10,254,254,254,126,126,126,113,113,
+    113,225,225,225,24,24,24,88,88,88,56,56,56,39,39,39,218,218,218,109,109,109,72,72,72,71,71,71,145,145,145,35,35,35,103,103,103,107,107,107,215,215,215,216,216,216,35,35,35,36,36,36,
+    107,107,107,34,34,34,58,58,58,70,70,70,105,105,105,70,70,70,72,72,72,35,35,35,68,68,68,105,105,105,9,9,9,27,27,27,103,103,103,137,137,137,10,10,10,35,35,35,69,69,69,184,184,184,9,9,
+    9,10,10,10,138,138,138,137,137,137,139,139,139,12,234,43,139,0,0,0,64,116,82,78,83,96,92,37,27,88,162,49,161,88,208,209,152,138,0,253,253,253,253,253,1,253,253,2,254,254,16,12,15,15,
+    209,210,18,179,206,178,77,142,143,174,140,207,176,84,49,109,108,139,205,111,78,19,49,48,47,48,202,48,51,43,145,174,111,141,179,124,114,213,198,0,0,10,154,73,68,65,84,120,218,237,221,
+    105,87,226,72,27,135,113,98,16,212,153,208,96,105,216,69,16,112,163,93,112,71,91,191,255,183,122,66,128,144,74,170,104,31,7,132,42,175,255,139,153,115,134,30,251,76,255,184,239,212,
+    154,201,120,196,234,100,248,35,0,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,
+    38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,152,252,56,96,
+    63,8,192,246,70,76,148,1,182,54,47,59,59,39,53,42,216,214,180,186,71,251,251,251,71,39,211,74,214,52,113,128,77,77,173,91,46,7,192,229,253,7,173,176,176,183,133,91,15,236,123,15,251,
+    147,148,207,91,250,47,193,195,67,141,10,54,20,248,119,121,42,28,148,176,186,74,107,191,131,30,126,244,187,5,176,145,35,232,110,4,124,162,6,110,5,61,188,188,95,46,119,235,0,155,8,28,
+    85,112,249,183,10,216,247,78,102,95,128,29,11,159,195,63,160,69,71,126,229,115,229,175,168,159,79,191,1,229,46,21,108,98,5,231,142,102,128,71,45,213,23,32,183,95,94,248,5,0,120,211,
+    167,193,81,133,238,231,210,61,56,54,8,3,216,202,81,86,212,161,199,45,90,0,108,222,58,71,172,68,187,139,58,180,118,148,13,240,70,140,165,116,75,81,181,128,48,234,193,85,69,135,142,62,
+    61,98,154,180,193,169,182,26,186,143,234,209,40,234,232,50,253,45,176,187,67,219,2,124,121,117,124,125,124,171,171,192,200,80,49,211,109,29,89,221,161,45,1,126,185,46,140,115,213,80,
+    143,178,254,141,138,52,9,28,159,37,31,177,84,185,169,169,31,23,38,185,82,63,158,119,98,75,29,201,46,220,181,187,67,219,0,92,243,156,66,97,129,176,239,189,204,151,58,146,77,184,110,
+    121,135,182,1,216,247,6,17,112,97,160,42,195,249,84,55,177,161,148,232,208,0,111,232,74,198,85,33,46,172,96,210,47,117,116,23,204,145,1,222,20,224,219,24,112,193,73,9,11,105,169,67,
+    170,240,90,188,67,215,116,63,31,224,77,25,100,133,185,77,10,75,27,74,13,205,240,235,40,167,236,208,98,204,43,124,128,215,60,13,190,142,1,95,39,87,51,132,55,140,111,40,137,216,7,221,
+    191,108,52,140,127,109,171,102,114,21,91,178,208,33,53,233,148,176,87,211,108,40,197,86,57,52,135,1,220,63,31,187,237,247,71,42,120,221,3,233,164,112,162,14,149,163,172,249,121,188,
+    240,200,165,175,248,177,195,124,113,156,118,206,216,26,182,102,45,122,16,23,62,110,36,102,202,243,131,119,177,10,142,15,190,206,27,170,175,205,99,187,56,201,238,208,84,97,91,128,69,
+    66,184,46,75,205,78,117,148,207,165,15,206,23,117,104,225,229,102,190,197,98,22,224,181,39,62,27,46,92,85,147,19,165,201,225,119,233,122,67,245,124,193,137,90,225,101,231,190,197,63,
+    0,175,61,13,89,56,57,21,86,93,95,233,70,167,177,234,233,250,205,22,139,113,96,23,224,205,154,14,15,18,159,214,78,126,39,46,160,205,231,199,169,3,181,193,215,224,79,220,183,104,236,
+    137,90,171,142,236,52,22,44,120,136,216,95,231,95,137,241,145,247,32,221,150,183,216,247,195,216,139,45,118,157,201,146,106,248,90,30,24,11,213,37,240,233,165,149,90,114,248,220,202,
+    75,190,237,7,166,73,155,49,29,150,150,180,156,207,180,213,218,203,101,53,245,99,252,119,185,126,205,157,6,91,86,193,254,236,108,199,167,129,69,186,113,71,203,27,179,228,135,6,111,36,
+    90,119,108,54,182,164,245,242,41,23,63,181,53,225,126,72,190,239,53,143,205,134,13,170,225,91,245,98,199,231,127,64,46,111,145,175,125,21,60,63,223,113,249,149,127,93,204,151,39,103,
+    19,96,179,15,122,216,120,179,225,118,252,28,62,254,162,111,46,229,203,134,255,26,202,116,113,81,53,46,111,83,67,227,79,250,186,237,196,250,134,233,39,45,77,4,254,220,107,175,190,210,
+    88,125,121,125,210,220,45,6,195,43,184,250,124,89,95,88,200,95,125,177,157,240,226,19,224,246,163,5,39,165,13,4,110,12,142,11,133,235,227,193,229,39,154,245,255,13,28,27,65,239,230,
+    108,56,9,111,32,112,180,241,123,60,120,9,85,150,103,28,111,209,249,7,43,110,58,152,6,236,123,47,210,198,254,224,165,177,68,99,225,181,118,103,203,147,67,59,206,193,155,87,193,210,174,
+    239,220,120,57,189,58,154,6,231,45,241,53,16,248,184,144,202,245,85,120,115,84,44,71,248,61,223,254,200,86,109,185,199,98,26,176,240,254,41,168,18,24,183,150,244,27,120,126,173,234,
+    89,115,211,208,188,103,176,83,208,228,122,176,28,97,225,217,244,98,82,243,90,116,227,88,39,92,24,44,173,77,120,0,175,47,47,122,225,103,143,152,15,236,213,111,175,174,117,37,188,234,
+    222,106,220,139,195,13,221,77,210,24,95,121,43,60,28,39,124,95,152,215,192,141,4,14,255,160,85,198,206,202,42,120,86,185,173,135,42,21,252,61,163,233,32,213,203,129,252,60,126,89,1,
+    176,239,187,147,154,173,229,118,222,63,118,219,31,127,106,0,127,159,177,23,55,190,90,81,83,14,134,238,143,217,124,180,83,156,247,1,254,46,99,127,106,28,54,235,171,229,190,138,112,138,
+    219,122,216,249,247,99,55,113,204,67,0,252,189,133,124,121,235,56,151,75,46,223,89,83,46,166,178,75,5,175,163,89,47,219,247,49,223,46,170,179,91,55,103,169,203,154,183,205,138,101,
+    111,253,239,232,120,195,163,0,0,155,222,19,92,189,111,49,111,208,56,26,96,13,240,31,189,111,49,107,208,102,4,192,154,228,245,190,70,221,246,7,88,243,8,214,0,183,243,239,57,163,254,
+    75,0,214,180,232,172,10,55,155,117,77,123,147,3,192,26,96,249,138,210,238,199,123,246,113,56,41,110,54,27,236,232,209,81,9,239,190,239,156,228,38,91,12,126,180,118,9,176,249,194,143,
+    249,118,59,159,207,186,211,179,94,194,55,242,160,7,192,122,97,207,29,214,39,77,217,231,134,191,149,207,225,176,110,13,63,127,103,1,112,227,249,230,244,244,98,21,251,240,130,187,73,
+    107,78,245,222,249,167,243,43,204,217,61,61,199,42,224,198,253,197,77,231,236,215,60,103,13,52,109,1,110,60,95,156,74,184,97,110,208,180,1,184,234,40,108,195,116,208,180,0,248,190,
+    243,75,23,128,45,0,190,63,211,250,254,58,69,211,124,224,83,189,239,175,11,52,141,7,110,124,95,1,11,97,232,218,164,209,192,85,45,240,217,146,235,87,204,148,1,254,86,96,213,16,235,172,
+    115,122,241,188,244,133,172,250,99,118,84,181,192,216,176,103,240,77,10,215,113,86,176,132,37,188,108,191,84,42,245,51,91,45,211,141,13,3,110,116,228,194,93,205,239,34,188,76,169,18,
+    0,87,66,99,223,104,99,211,230,193,213,211,137,237,141,179,186,91,126,190,183,213,28,251,150,38,198,205,94,198,157,60,144,1,254,142,60,95,56,43,222,87,24,23,112,44,149,202,220,216,7,
+    216,130,8,111,187,82,42,165,141,71,243,225,53,192,102,3,103,19,192,83,227,254,196,24,96,227,129,221,146,42,97,29,251,188,194,193,2,225,90,175,82,82,167,210,171,83,193,54,148,112,111,
+    92,175,202,100,204,42,97,128,53,25,245,250,74,227,74,143,10,94,223,36,121,105,167,239,198,69,58,28,101,250,225,68,88,6,238,215,141,42,97,155,128,47,194,173,136,206,114,102,201,225,
+    178,70,213,13,141,227,200,149,109,90,244,154,50,91,167,238,44,233,244,221,100,121,178,17,24,55,227,198,60,131,215,148,211,21,236,252,79,151,160,221,76,111,102,92,233,111,1,188,150,
+    199,239,233,138,182,254,167,219,254,19,227,82,169,63,98,30,188,110,223,47,3,107,183,140,102,117,156,201,102,27,166,173,85,218,1,220,232,252,247,3,210,19,69,127,225,167,30,107,209,107,
+    201,179,124,208,227,75,187,196,1,220,208,221,90,4,40,194,120,0,127,191,239,217,127,191,225,32,130,14,220,108,54,123,91,86,189,238,221,14,224,251,165,248,110,245,43,227,52,109,19,54,
+    31,248,98,25,167,163,133,55,221,94,176,78,56,131,111,56,180,114,103,135,116,42,205,17,255,83,142,13,202,205,82,78,71,11,47,59,95,139,180,171,134,51,86,249,126,117,25,58,120,4,199,183,
+    19,108,18,54,26,184,42,95,85,234,164,231,71,206,235,211,211,171,163,158,242,200,192,205,138,157,194,25,123,234,183,147,222,40,116,14,194,56,202,85,11,89,88,58,72,105,209,108,201,100,
+    224,103,217,55,189,137,116,119,112,160,18,30,191,32,105,75,72,135,171,132,216,146,78,233,244,134,66,0,188,81,5,124,170,216,36,124,157,1,191,37,30,184,219,123,123,123,219,210,190,159,
+    240,220,126,197,220,131,57,118,2,59,241,229,13,213,38,240,211,12,248,41,225,123,24,102,161,112,214,18,97,75,128,149,203,87,206,129,10,216,19,83,223,195,189,45,89,120,212,180,176,134,
+    77,6,158,223,22,86,47,79,70,29,250,224,85,42,224,189,41,176,92,194,137,161,180,45,194,70,143,162,47,22,47,95,69,29,58,62,200,10,198,203,51,223,195,237,212,108,56,62,89,178,99,193,195,
+    236,133,142,240,152,157,238,148,221,188,67,31,220,73,138,115,224,150,76,40,79,150,198,194,62,192,107,238,210,247,250,171,134,243,14,253,38,33,186,17,240,161,155,16,76,10,187,30,175,
+    112,216,220,40,59,244,56,219,17,112,106,168,156,16,238,15,169,224,141,205,157,178,67,135,59,131,135,234,81,86,90,56,152,44,185,0,111,234,36,74,217,161,229,81,86,63,13,44,106,61,233,
+    158,138,0,120,67,243,118,160,91,168,156,63,132,247,124,69,9,199,22,45,77,187,198,240,147,128,117,29,58,16,27,70,19,225,67,197,76,40,248,60,90,210,170,100,0,54,173,67,203,163,44,21,
+    224,124,209,178,82,26,25,63,81,178,22,88,215,161,229,135,176,178,66,195,5,143,202,248,210,89,134,105,146,113,29,58,177,150,85,83,17,250,222,168,215,44,149,154,89,11,254,32,108,5,214,
+    108,52,76,11,52,122,8,239,169,151,50,130,127,246,56,218,242,61,128,13,232,208,175,138,103,236,246,162,81,214,100,182,52,117,6,120,67,59,180,118,25,43,116,91,60,202,154,180,105,33,216,
+    46,52,178,67,47,220,80,178,47,150,2,191,234,59,180,188,161,180,87,183,237,50,210,207,0,126,91,208,161,3,81,177,247,183,135,48,192,134,0,63,169,31,176,159,120,8,3,108,196,51,248,85,
+    57,70,150,30,194,0,27,92,194,79,119,127,7,102,144,101,238,48,235,77,233,59,158,9,239,1,108,252,84,216,113,238,52,31,9,111,184,205,51,216,230,204,123,244,54,163,104,171,133,173,247,
+    253,177,111,155,21,222,40,179,221,207,184,182,251,254,220,215,9,11,233,111,0,91,40,44,60,33,172,247,229,133,224,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,
+    0,19,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,
+    3,76,0,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,172,39,255,3,223,90,50,46,9,170,229,79,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,
+    13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,162,162,162,215,215,215,218,218,218,27,27,27,92,92,92,144,144,144,233,233,233,10,10,
+    10,164,164,164,113,113,113,140,140,140,233,233,233,94,94,94,112,112,112,0,0,0,146,146,146,37,37,37,73,73,73,219,219,219,109,109,109,255,255,255,10,10,10,254,254,254,126,126,126,113,
+    113,113,226,226,226,25,25,25,218,218,218,108,108,108,56,56,56,71,71,71,72,72,72,36,36,36,86,86,86,106,106,106,38,38,38,103,103,103,104,104,104,35,35,35,106,106,106,218,218,218,68,68,
+    68,34,34,34,36,36,36,69,69,69,137,137,137,105,105,105,36,36,36,69,69,69,70,70,70,145,145,145,7,7,7,136,136,136,213,213,213,249,249,249,9,9,9,27,27,27,35,35,35,59,59,59,213,213,213,
+    10,10,10,103,103,103,134,134,134,138,138,138,75,235,210,186,0,0,0,64,116,82,78,83,24,101,41,96,36,160,152,159,89,86,216,200,135,218,0,253,253,253,253,252,1,252,253,3,254,254,16,210,
+    208,19,175,207,208,13,145,14,48,78,141,178,177,108,113,176,79,113,115,52,45,142,205,47,76,143,212,78,45,78,51,82,203,15,53,141,155,46,32,176,0,0,10,55,73,68,65,84,120,218,237,221,123,
+    91,226,70,20,199,241,112,17,113,219,142,92,98,195,69,80,174,130,136,224,173,138,245,242,254,223,85,9,43,201,36,153,160,117,179,144,25,190,191,63,218,231,217,186,109,241,179,231,204,
+    153,100,18,45,65,140,142,197,183,0,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,
+    1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,214,40,182,27,128,141,229,165,
+    130,77,79,182,240,240,144,5,216,212,250,205,22,254,118,147,233,217,0,27,9,252,211,119,41,188,39,205,218,50,147,49,190,128,63,124,255,254,39,187,31,194,230,1,59,182,59,40,199,1,103,
+    214,192,251,82,194,150,137,213,235,196,255,67,31,248,95,128,117,29,146,71,163,66,17,96,51,129,109,81,108,214,151,169,100,58,246,198,25,139,22,173,169,175,213,172,87,86,81,22,168,45,
+    30,0,214,27,56,243,225,91,31,89,138,73,75,174,96,166,104,45,51,250,0,142,41,97,128,117,79,97,13,92,111,170,74,248,11,192,119,143,143,143,0,167,182,69,123,192,149,186,114,145,253,12,
+    184,145,123,57,57,57,121,121,4,56,173,67,86,197,3,110,102,21,37,252,25,112,238,228,103,30,1,78,169,240,195,230,18,254,4,248,238,195,247,228,16,224,148,2,103,155,126,9,91,209,107,90,
+    133,205,215,162,15,215,192,39,119,0,167,117,163,228,55,233,135,144,161,45,3,91,10,224,156,231,107,76,143,54,15,56,219,244,154,116,37,138,248,199,38,224,59,223,151,10,78,107,28,239,
+    90,135,91,194,214,255,2,246,27,52,107,112,154,7,105,169,132,131,11,173,45,122,62,240,107,4,248,241,196,188,14,109,224,221,164,192,42,28,188,96,233,136,206,63,30,112,43,2,252,98,96,
+    1,155,8,108,203,37,28,184,96,233,136,55,15,248,143,200,193,15,169,65,191,220,1,156,230,18,254,55,166,132,29,97,201,192,241,19,86,78,0,156,230,18,206,250,183,28,42,69,169,80,109,9,120,
+    180,15,19,150,153,192,225,18,246,133,101,224,66,168,67,231,12,220,34,105,13,188,225,108,221,114,21,150,74,56,35,3,103,37,224,192,85,174,187,23,35,27,180,190,192,246,218,50,230,106,
+    135,84,194,29,79,216,22,118,33,230,64,135,60,97,9,128,211,240,63,158,41,20,50,217,152,51,208,242,61,7,121,47,236,31,186,43,4,175,115,24,185,5,214,24,120,185,202,186,103,235,42,205,
+    140,165,44,98,185,132,3,23,59,150,194,171,38,93,8,221,106,120,49,115,194,210,21,216,187,90,85,175,140,212,69,236,151,176,123,79,41,240,5,217,76,33,147,9,253,90,206,200,45,176,206,192,
+    94,7,174,87,150,88,81,98,199,187,231,80,15,141,203,118,224,111,70,111,129,181,5,182,197,171,52,37,87,70,25,197,176,229,110,149,150,61,188,94,31,133,239,251,46,191,52,252,0,248,161,
+    177,13,90,87,96,249,98,228,178,136,31,20,125,122,41,60,106,46,23,233,175,60,9,124,104,230,22,88,231,41,90,174,96,119,157,205,228,35,69,108,11,199,178,172,47,61,210,127,104,108,131,
+    214,118,13,206,84,2,81,14,91,78,252,70,57,14,248,69,0,156,142,180,30,42,97,98,119,216,10,30,193,178,157,47,190,108,229,206,204,45,176,214,23,58,172,76,179,30,34,110,102,190,253,138,
+    149,199,207,26,116,227,41,151,3,120,187,201,142,42,245,80,17,63,124,251,211,220,29,190,188,28,198,214,111,99,49,41,149,74,147,28,192,91,92,134,109,209,83,22,241,111,120,224,104,197,
+    235,102,1,240,22,179,92,111,173,135,72,17,39,255,88,247,108,205,91,42,157,55,0,222,238,48,29,233,211,202,195,238,191,196,59,44,73,201,1,188,237,62,221,9,247,233,68,155,116,144,23,224,
+    157,20,113,168,79,23,147,3,238,93,158,151,0,222,125,17,139,76,243,119,0,55,34,188,165,243,39,128,119,50,108,101,51,149,184,155,131,9,242,150,74,151,76,209,59,30,182,146,154,162,27,
+    139,73,73,225,219,3,120,103,125,218,90,245,233,102,50,190,51,21,239,112,166,229,247,198,144,99,179,238,176,85,44,22,147,249,52,11,5,239,228,73,211,239,140,41,231,162,63,110,43,36,210,
+    159,163,171,239,100,161,237,55,198,156,131,239,137,189,169,63,23,229,109,8,128,205,201,97,104,111,116,217,208,249,211,0,28,201,101,144,183,167,247,167,1,56,58,67,27,196,11,176,106,
+    200,242,46,64,15,159,244,255,52,0,43,132,39,58,111,124,1,254,202,32,125,57,188,124,50,227,163,232,5,236,216,254,142,200,118,28,187,211,113,220,216,252,145,52,167,130,95,45,229,30,24,
+    73,35,128,239,15,214,121,159,78,167,71,71,131,65,177,248,246,246,230,236,223,79,172,51,18,184,51,61,86,231,246,221,65,82,123,96,91,220,31,199,230,192,162,134,245,175,224,131,227,13,
+    194,0,107,14,236,136,214,143,13,192,183,9,159,166,4,120,251,192,243,77,192,199,111,0,235,222,162,59,183,155,128,243,244,104,205,129,29,81,220,180,6,59,0,107,63,69,191,110,152,178,238,
+    241,53,224,66,71,107,122,16,179,14,79,241,53,1,88,136,222,60,223,239,231,243,111,111,247,131,193,245,209,209,244,221,205,65,177,159,252,127,169,177,24,14,47,47,47,115,110,22,139,217,
+    236,201,13,15,159,253,246,117,56,182,127,39,156,69,244,228,221,185,155,137,110,7,120,116,187,217,224,172,211,233,88,214,250,148,157,147,248,14,105,86,138,205,176,1,176,254,25,198,3,
+    107,246,0,11,192,170,60,157,111,0,214,235,49,112,128,255,55,112,105,6,176,238,105,108,172,224,39,128,141,94,131,207,89,131,13,40,225,9,67,150,225,194,177,53,60,100,31,108,8,241,108,
+    182,88,93,199,26,254,204,100,153,243,243,201,162,7,240,14,174,126,8,123,27,119,131,121,194,127,55,188,170,151,184,19,83,128,221,210,205,79,15,166,247,88,154,8,236,242,246,167,171,163,
+    30,239,28,172,52,15,120,85,189,183,254,209,89,98,20,240,146,215,153,74,7,181,142,56,119,103,18,176,139,121,31,56,135,247,206,166,207,28,224,21,239,1,135,223,13,5,118,119,70,111,145,
+    35,120,197,68,90,180,227,56,0,239,126,116,126,123,143,158,188,235,39,0,236,72,127,5,120,103,221,89,197,123,156,204,123,102,123,207,185,92,207,32,98,29,43,56,48,58,123,15,39,221,39,
+    98,242,220,46,151,203,103,87,84,240,238,250,179,56,82,240,254,152,38,83,114,243,242,207,180,231,166,20,177,165,159,175,162,122,93,222,68,60,218,229,117,198,13,42,120,39,190,78,244,
+    217,134,131,188,127,199,225,215,22,247,231,178,159,246,149,17,69,172,25,176,19,125,204,223,229,77,230,37,44,142,184,42,203,185,105,25,64,172,59,240,193,155,72,236,94,112,176,130,13,
+    25,182,180,3,206,7,120,239,59,137,22,89,235,44,40,108,192,176,165,221,26,156,255,33,237,140,26,170,111,191,187,28,127,119,73,190,42,135,51,110,81,193,219,21,190,247,70,103,117,245,
+    254,218,114,60,14,215,240,170,79,59,0,111,83,248,118,243,206,168,127,125,113,241,231,183,31,40,157,183,35,69,124,51,163,130,183,154,215,193,209,145,21,211,134,109,49,56,173,45,243,
+    215,224,219,255,250,171,104,17,143,123,0,111,115,208,90,175,180,42,223,126,181,86,93,166,86,253,254,173,135,214,77,180,136,123,0,111,177,75,59,118,220,16,101,119,46,86,190,75,225,238,
+    87,86,99,219,255,19,35,255,1,186,138,244,233,43,93,215,97,179,206,64,56,226,186,250,145,218,197,215,174,53,182,148,83,114,43,60,108,181,27,84,112,42,118,201,167,53,15,248,43,93,117,
+    220,62,59,107,63,171,86,129,231,96,159,62,3,56,21,19,118,183,230,85,112,55,188,59,142,254,88,165,245,98,123,165,236,221,129,97,235,140,53,56,13,5,60,168,250,25,40,86,77,59,248,229,
+    227,181,222,179,114,133,149,135,173,54,192,41,168,223,206,169,92,192,118,104,119,124,61,232,4,127,67,207,43,209,155,152,105,253,217,27,182,230,186,30,232,51,10,248,218,247,61,13,238,
+    146,58,221,106,173,86,61,13,110,142,103,126,129,170,75,216,17,189,143,97,107,204,62,56,13,19,86,213,3,174,94,7,43,174,251,177,57,14,244,237,231,179,192,157,65,117,17,207,199,237,246,
+    120,46,0,222,125,1,183,46,106,210,30,201,86,173,205,203,209,90,250,245,94,251,243,125,174,246,39,173,45,115,10,120,224,251,86,251,178,140,223,187,107,213,188,15,105,123,67,150,59,68,
+    245,54,92,11,177,185,217,144,242,9,203,223,61,229,229,74,109,73,37,156,51,244,193,38,115,128,165,45,240,105,39,164,213,173,249,165,237,72,69,159,147,74,184,37,0,78,179,175,188,5,142,
+    60,102,120,161,4,22,162,97,126,9,91,134,248,230,229,6,157,15,143,70,30,240,105,96,113,14,156,178,59,107,81,193,41,158,176,228,45,112,62,82,139,62,240,107,104,117,150,74,120,108,100,
+    9,155,241,150,157,245,93,224,143,45,112,24,202,57,173,249,248,118,224,55,206,77,47,97,67,214,96,105,194,186,120,141,220,84,120,245,129,91,225,222,126,35,151,176,13,112,58,35,221,37,
+    172,170,94,228,16,11,28,44,225,185,129,77,218,4,96,183,67,75,91,96,5,146,7,28,57,5,224,200,37,124,99,96,9,155,1,60,175,198,78,81,110,122,155,128,165,43,210,101,3,75,216,144,22,237,
+    93,134,30,168,138,176,229,3,43,118,88,99,185,132,169,224,180,94,230,168,197,158,180,147,14,242,40,128,131,207,171,60,27,87,194,166,92,232,88,157,134,174,118,59,234,14,190,9,56,84,194,
+    0,167,52,253,193,245,117,63,102,137,150,43,88,209,193,253,147,29,250,30,158,52,30,216,217,84,222,222,73,0,37,176,124,193,18,224,244,10,59,113,47,184,146,142,122,196,156,134,247,239,
+    57,152,183,81,218,131,151,255,73,219,100,53,176,84,194,12,89,38,2,11,209,25,151,53,63,91,183,223,192,222,189,226,218,117,92,11,190,114,31,113,184,18,0,107,152,142,56,250,28,120,185,
+    29,206,27,249,233,247,11,184,26,11,236,124,50,138,3,156,230,171,32,254,121,188,254,222,189,51,124,31,94,161,237,29,155,173,117,95,133,0,216,192,180,220,39,87,106,213,139,215,253,123,
+    101,248,190,188,4,127,208,237,118,7,45,33,168,96,2,176,150,155,97,91,236,231,207,100,161,130,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,
+    4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,
+    19,128,9,192,4,96,128,249,22,0,76,0,38,0,19,128,9,192,4,96,2,240,30,229,63,159,252,39,171,249,212,107,3,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,
+    249,249,249,244,244,244,242,242,242,231,231,231,225,225,225,222,222,222,220,220,220,218,218,218,217,217,217,216,216,216,215,215,215,206,206,206,192,192,192,188,188,188,186,186,186,
+    184,184,184,182,182,182,181,181,181,180,180,180,178,178,178,164,164,164,150,150,150,149,149,149,148,148,148,147,147,147,145,145,145,144,144,144,142,142,142,134,134,134,127,127,127,
+    119,119,119,114,114,114,112,112,112,111,111,111,109,109,109,108,108,108,105,105,105,100,100,100,94,94,94,86,86,86,77,77,77,68,68,68,61,61,61,55,55,55,49,49,49,42,42,42,37,37,37,36,
+    36,36,35,35,35,32,32,32,30,30,30,26,26,26,23,23,23,19,19,19,16,16,16,14,14,14,12,12,12,9,9,9,7,7,7,6,6,6,3,3,3,2,2,2,1,1,1,0,0,0,17,159,0,2,0,0,13,95,73,68,65,84,120,218,237,221,233,
+    118,162,72,24,6,96,19,151,184,27,23,162,113,195,93,16,119,197,13,169,186,255,187,154,66,1,209,96,167,231,104,210,86,249,190,63,122,206,36,61,158,51,121,242,213,94,16,160,136,208,9,
+    224,71,0,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,
+    1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,252,207,67,
+    246,4,192,226,198,92,47,230,115,221,0,176,168,229,187,28,91,153,237,0,44,102,244,241,196,202,120,190,7,176,144,13,244,252,8,60,25,175,1,44,98,182,211,137,13,188,4,176,216,192,11,0,
+    139,152,221,9,152,0,88,192,24,51,167,15,158,3,88,196,236,221,65,214,204,0,176,136,89,216,192,147,233,22,192,156,206,132,86,139,197,114,251,61,240,6,192,124,54,194,135,165,170,201,210,
+    244,255,182,238,0,63,217,68,88,24,96,178,180,151,170,150,254,131,168,53,128,5,153,7,77,214,223,0,235,0,230,49,46,224,196,127,63,97,51,121,206,165,44,97,128,87,46,176,255,90,213,246,
+    73,87,58,132,1,118,43,148,197,175,17,222,205,28,224,185,9,96,158,87,50,174,204,132,78,43,29,207,181,97,40,206,52,201,109,131,253,13,205,211,68,120,7,96,46,163,159,74,216,167,159,37,
+    79,186,148,37,16,240,137,208,119,178,187,116,191,187,1,48,159,113,119,140,124,203,244,73,151,178,132,218,108,240,140,164,191,142,149,87,207,185,210,33,214,110,146,183,27,190,100,92,
+    63,231,74,135,88,192,166,167,27,190,236,106,159,244,84,150,96,251,193,238,114,198,215,157,125,99,134,38,90,128,172,39,87,231,74,206,118,211,255,158,7,155,44,4,192,15,146,229,213,110,
+    120,119,88,203,26,79,254,231,32,154,28,71,107,4,192,143,145,179,37,203,243,185,146,177,156,78,167,243,255,233,203,120,167,3,117,68,168,9,224,199,136,119,201,242,114,56,181,219,238,
+    254,167,211,158,26,114,252,245,53,88,152,113,42,44,224,161,59,125,50,185,215,33,119,214,60,207,10,129,192,203,203,75,32,49,226,179,149,22,16,248,180,100,121,43,48,171,89,37,17,120,
+    61,36,144,223,113,41,204,39,48,177,242,253,92,105,188,186,177,124,183,213,215,192,235,139,149,215,151,160,198,101,35,205,115,5,95,37,222,76,198,183,239,252,50,205,81,54,240,114,244,
+    101,255,120,85,233,30,192,191,53,219,29,105,135,17,242,53,226,213,244,112,217,123,123,147,239,78,142,176,230,249,197,5,70,5,255,90,225,14,187,77,185,221,83,173,253,132,43,45,181,161,
+    47,22,250,13,27,251,236,99,103,5,167,121,62,0,7,18,75,244,193,191,228,59,109,54,91,237,86,179,217,81,198,198,85,226,59,140,174,94,60,190,47,129,54,159,243,36,14,43,120,223,147,219,
+    173,86,171,221,110,53,218,253,209,246,7,136,77,186,170,5,61,229,203,234,247,181,190,35,152,38,253,82,1,55,44,95,43,140,184,217,31,110,238,76,204,70,207,195,252,139,183,124,95,3,225,
+    14,175,35,81,14,129,7,178,3,124,36,238,105,107,122,71,99,246,57,74,228,162,121,78,15,40,175,219,13,28,2,15,27,39,96,171,165,110,54,122,131,213,221,136,9,213,171,222,230,249,213,106,
+    158,87,20,187,73,191,7,188,236,180,188,194,22,177,220,85,70,155,187,236,248,16,178,201,95,148,111,66,165,148,223,179,242,28,142,162,137,38,55,207,132,15,85,220,234,105,171,59,124,250,
+    158,202,167,201,175,53,186,122,41,44,41,225,248,178,11,143,11,29,134,214,97,196,23,198,108,218,212,187,125,63,192,164,122,248,212,62,179,230,57,212,217,83,174,175,186,240,185,146,165,
+    15,186,141,102,235,178,140,27,157,233,173,194,123,218,243,248,190,4,146,26,191,91,253,28,3,179,31,249,74,235,177,102,249,188,140,219,141,254,173,59,62,38,173,187,192,172,121,46,233,
+    212,228,252,46,34,175,187,73,148,174,135,253,150,220,56,39,238,44,110,4,222,83,197,30,97,177,230,57,222,163,148,251,139,106,188,238,38,89,196,198,76,235,157,19,119,230,55,2,179,49,
+    186,189,1,252,18,200,143,184,30,93,113,14,108,79,123,183,67,70,124,234,140,111,174,96,246,159,43,17,235,8,71,32,88,91,81,17,238,153,114,125,162,195,50,102,196,77,155,184,45,43,183,
+    147,16,58,171,132,95,131,73,133,82,33,46,138,115,126,100,199,34,222,141,250,173,195,120,171,217,153,221,97,200,203,88,103,131,161,46,66,243,44,0,176,221,25,143,148,78,179,209,236,77,
+    239,242,137,166,105,59,3,248,113,102,77,251,185,54,154,222,237,90,40,207,55,25,68,4,118,215,34,158,240,165,42,79,2,252,221,57,75,0,35,0,70,0,44,122,120,236,7,0,252,55,172,230,225,138,
+    240,209,150,179,1,54,128,255,32,123,112,245,76,136,55,171,229,98,195,217,96,29,192,87,39,195,174,179,177,158,140,84,165,83,171,22,242,201,100,190,187,230,74,24,192,215,167,214,203,
+    161,166,246,235,117,137,185,38,226,225,112,40,20,14,91,127,230,23,60,9,11,176,84,249,35,35,31,66,7,82,42,145,136,49,80,150,112,228,45,26,141,198,162,214,31,241,96,105,203,209,80,43,
+    32,136,43,185,183,111,47,193,88,45,215,24,11,131,125,115,194,190,50,224,104,165,58,192,35,172,247,95,215,235,197,120,122,239,39,95,153,116,24,15,199,163,94,215,83,162,225,46,128,127,
+    174,99,60,196,48,216,120,118,54,84,85,165,223,235,118,154,173,174,122,223,145,15,33,213,80,252,237,74,98,225,62,128,127,202,151,232,227,145,166,170,22,107,187,41,91,105,54,155,173,
+    86,83,86,238,249,128,5,66,87,239,225,232,85,223,196,156,162,15,254,25,95,93,233,54,45,215,70,195,98,109,31,115,60,80,169,221,23,56,235,11,108,53,218,241,96,157,167,205,226,0,79,190,
+    139,158,220,244,178,158,157,152,53,238,90,86,31,222,38,250,48,122,182,198,90,111,145,72,56,152,215,9,166,73,63,226,107,244,229,11,215,19,112,179,183,189,107,9,43,177,72,220,101,125,
+    11,219,179,165,120,34,145,169,205,176,208,241,67,192,203,78,235,90,218,114,255,174,63,117,147,118,34,214,194,198,113,18,28,79,36,223,165,82,85,86,6,218,72,199,82,229,143,1,79,155,127,
+    0,86,239,251,115,39,68,41,164,146,201,124,185,90,239,40,234,120,190,242,124,135,2,248,103,128,103,254,182,86,228,238,253,31,145,98,172,167,103,207,233,177,247,148,56,91,56,224,9,120,
+    213,61,93,27,117,134,90,108,150,212,104,200,141,222,253,215,135,237,135,204,218,91,74,184,0,254,27,194,214,197,224,227,8,250,192,202,166,75,205,78,183,215,87,84,77,255,129,142,209,
+    178,197,213,149,95,141,117,49,248,192,218,234,246,44,215,193,104,180,212,55,198,158,226,64,165,24,192,148,234,26,99,213,198,83,125,189,221,121,107,13,190,98,0,147,243,82,37,56,44,43,
+    90,5,91,156,4,174,226,2,35,0,70,0,12,224,39,143,117,84,150,152,0,22,60,4,55,252,31,139,131,220,107,221,137,104,53,169,36,143,168,16,183,192,133,185,62,122,108,91,239,50,19,107,196,
+    173,93,194,100,117,40,2,177,48,23,192,117,77,25,26,247,232,127,169,250,22,137,199,98,209,112,40,81,209,216,23,246,38,128,255,189,175,161,86,75,31,197,250,144,220,225,163,10,199,211,
+    58,209,88,36,20,151,84,235,19,77,60,140,244,31,151,239,178,91,44,149,203,101,169,168,220,106,97,210,81,34,98,159,183,139,198,222,66,225,66,119,196,53,49,255,192,172,5,29,214,138,159,
+    229,207,207,207,74,169,58,191,249,97,149,131,248,155,123,160,50,26,139,6,131,137,202,192,160,120,226,251,191,243,221,40,149,146,197,203,82,46,170,55,14,139,76,186,72,158,157,152,141,
+    197,35,161,132,164,110,121,37,230,255,65,104,243,214,199,167,237,251,89,150,148,155,159,101,72,170,193,248,217,153,232,67,103,92,80,54,20,47,198,250,23,221,175,86,253,112,120,143,21,
+    124,243,195,42,231,185,96,36,22,59,39,126,11,69,242,253,45,143,199,10,248,126,86,37,93,247,75,37,143,111,169,122,251,217,59,235,97,149,137,96,40,26,63,39,142,134,66,5,30,223,48,27,
+    224,186,124,167,178,244,233,241,253,188,189,133,62,124,46,25,214,50,161,96,52,118,126,39,41,30,44,232,252,9,115,252,56,97,106,170,222,230,249,179,82,172,244,239,242,122,178,195,115,
+    138,213,66,56,244,22,139,158,247,197,10,127,221,48,199,15,4,159,119,63,75,103,229,91,211,238,54,52,183,14,142,168,133,120,40,226,37,142,133,218,0,254,189,230,121,84,59,107,158,75,159,
+    221,249,29,111,29,88,91,73,100,80,74,132,194,167,75,224,177,80,21,77,244,111,249,110,250,149,162,167,121,46,151,42,234,13,103,103,137,223,78,148,85,172,195,90,242,68,28,13,247,80,193,
+    191,4,108,246,46,70,87,181,225,87,223,191,246,54,157,102,217,231,235,211,102,58,28,126,179,158,210,17,15,101,150,168,224,95,42,96,165,88,246,54,207,149,254,210,167,147,254,91,98,66,
+    247,179,43,111,198,179,212,23,221,124,52,24,142,68,66,113,14,199,88,92,2,19,106,212,189,171,27,31,213,175,205,179,245,144,240,191,126,195,187,90,41,228,165,254,198,247,247,193,58,190,
+    179,26,212,146,241,132,52,192,66,199,111,1,207,170,37,79,243,220,249,58,186,34,116,169,180,229,222,232,175,62,77,205,164,50,153,116,242,218,34,201,225,232,206,124,56,50,40,143,225,
+    19,120,90,41,185,139,147,149,222,198,167,247,101,99,108,169,40,85,148,111,219,84,147,106,249,76,46,155,205,229,82,242,254,202,40,220,30,130,225,21,239,191,6,172,215,142,67,232,242,
+    231,135,53,186,50,191,252,133,101,85,170,148,203,236,215,224,219,103,179,152,180,155,204,191,91,201,102,254,208,199,114,123,211,144,211,65,150,42,149,203,22,96,169,59,243,25,28,17,
+    218,255,168,28,23,183,234,23,229,253,229,174,47,217,215,146,57,27,184,48,18,230,101,43,188,3,175,59,210,71,177,40,85,85,211,167,66,89,1,215,142,107,92,229,82,245,108,249,248,235,203,
+    59,216,8,186,154,202,30,128,223,115,169,154,65,1,252,24,194,91,85,174,213,186,19,223,185,13,155,69,217,131,236,139,237,37,166,57,234,247,250,103,167,62,88,19,157,58,86,48,171,225,116,
+    103,111,2,248,49,132,233,110,181,246,159,232,178,250,182,187,104,54,4,171,121,158,113,104,245,221,249,84,50,93,240,238,57,153,116,92,200,216,37,156,125,207,104,162,53,210,60,191,125,
+    244,202,66,6,161,3,103,150,92,150,122,222,230,216,172,39,223,115,185,92,58,175,158,149,181,226,0,179,18,150,22,130,61,44,128,231,183,143,94,147,48,100,201,6,46,85,38,39,47,147,14,115,
+    239,22,101,46,93,240,48,18,98,200,110,35,157,75,85,13,177,174,30,139,119,55,137,208,133,51,75,46,75,221,189,247,27,29,7,50,231,109,137,217,152,76,74,187,53,156,81,196,106,164,69,4,
+    86,164,138,115,6,96,116,214,22,203,206,132,40,125,166,120,88,235,112,186,225,76,126,32,148,112,64,60,95,189,106,159,3,40,127,180,141,179,239,52,29,224,84,247,172,167,53,105,239,212,
+    13,103,164,185,72,194,1,17,11,216,61,69,171,157,79,136,20,187,137,206,37,59,23,15,115,217,86,79,221,112,186,190,19,168,27,14,8,231,123,154,35,125,200,187,115,96,213,238,106,179,169,
+    218,254,92,152,206,11,158,110,184,47,80,9,139,7,172,58,39,61,202,165,193,69,67,60,112,103,67,149,139,7,196,51,124,79,55,44,210,146,101,64,52,223,141,179,85,92,46,214,183,23,192,90,
+    222,157,238,94,238,64,153,180,227,150,112,46,85,219,9,51,27,22,14,88,115,54,18,43,210,197,61,37,54,127,178,215,172,24,240,229,75,60,8,217,84,210,167,37,203,150,1,224,199,204,174,41,
+    57,61,112,237,162,74,217,124,215,1,206,228,199,151,141,240,217,146,101,38,63,164,120,8,203,67,22,240,176,236,22,240,229,80,137,53,223,101,167,25,246,1,52,189,75,150,23,243,40,0,63,
+    74,246,29,119,142,84,242,25,41,213,82,206,214,239,215,107,166,132,16,119,201,50,151,170,3,248,1,99,210,81,197,189,72,218,248,186,183,75,234,41,103,158,228,51,19,34,84,151,210,206,68,
+    185,143,38,250,193,23,57,74,95,207,64,154,180,103,47,101,229,82,126,71,216,77,58,204,103,172,191,144,203,228,23,168,224,135,20,238,186,67,172,250,218,7,184,239,86,112,221,191,5,232,
+    167,51,217,108,46,155,236,9,51,17,22,11,216,108,59,192,126,55,193,77,58,200,216,125,108,178,230,255,11,178,87,10,233,84,42,91,223,16,76,147,30,180,137,174,28,23,177,106,186,31,240,
+    208,153,7,165,75,155,43,109,176,174,200,93,77,160,163,89,130,1,207,171,31,149,114,185,252,41,249,61,202,129,77,117,243,206,74,199,181,187,220,166,243,73,0,126,208,121,112,77,250,40,
+    126,20,187,126,47,233,38,116,109,111,41,100,51,133,107,163,40,98,18,98,18,84,240,195,10,175,148,122,77,86,13,255,111,110,220,163,27,121,77,188,35,208,207,0,108,149,229,118,179,187,
+    114,220,146,152,206,33,247,247,44,128,121,21,254,227,181,209,122,242,250,82,22,128,185,33,38,87,203,187,229,174,85,14,0,44,32,61,85,15,231,102,223,115,153,194,28,192,34,2,239,42,201,
+    92,46,155,123,79,118,159,229,101,120,207,245,206,6,66,71,82,58,149,74,101,218,27,2,96,49,133,245,126,181,90,31,60,207,219,44,159,237,173,43,214,19,206,158,234,109,165,79,247,90,157,
+    67,211,108,62,207,255,239,51,190,55,233,169,222,107,137,23,99,1,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,1,
+    48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,
+    17,0,35,0,70,0,12,96,252,8,0,140,0,24,1,48,2,96,4,192,8,128,17,111,254,3,223,223,190,49,237,214,150,113,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,3,0,80,76,84,69,45,70,88,40,58,73,38,49,64,32,48,60,41,40,64,32,40,52,26,40,
+    54,25,36,53,42,33,67,36,32,54,30,31,57,30,32,41,23,33,53,25,29,55,21,32,45,21,30,43,42,25,58,35,25,55,33,24,58,29,26,63,29,25,39,26,27,59,26,23,58,26,26,39,27,23,32,22,27,53,22,26,
+    45,22,23,47,21,25,38,18,25,39,20,22,37,46,18,41,41,18,30,39,18,29,37,18,37,37,18,26,37,18,24,34,18,46,34,18,26,33,19,23,34,18,22,29,19,55,29,17,55,30,20,35,30,16,38,29,20,27,31,18,
+    24,29,17,26,23,20,48,23,18,48,22,19,40,24,16,38,24,19,30,24,16,36,21,16,35,23,16,28,19,20,37,19,17,36,18,18,31,18,16,30,16,18,31,15,16,29,10,16,24,59,11,64,52,11,56,47,10,54,44,12,
+    37,40,11,46,40,12,31,40,13,23,40,10,19,37,11,43,37,12,34,37,9,41,37,11,25,37,9,26,34,13,42,33,14,33,35,9,41,34,14,30,34,11,28,35,9,29,35,9,24,28,14,50,29,12,46,29,13,38,30,9,42,29,
+    9,35,32,14,30,31,13,30,29,14,29,31,11,31,28,10,31,30,14,27,29,13,26,29,12,25,26,13,22,30,11,27,30,10,24,27,10,21,23,13,45,23,14,37,25,13,34,21,14,32,24,10,37,20,10,37,25,10,31,20,10,
+    31,23,14,25,19,13,26,22,13,20,18,13,16,23,10,26,19,10,26,23,10,19,19,10,17,16,14,28,15,13,26,15,13,24,16,10,28,15,10,22,17,13,14,16,12,11,15,12,9,14,12,8,14,10,15,13,12,28,12,11,29,
+    12,12,20,12,10,21,9,11,20,4,12,14,7,9,14,56,6,64,46,6,54,42,7,66,42,6,46,40,7,62,40,6,60,40,6,41,38,7,60,38,7,54,38,5,54,38,7,31,38,4,32,35,7,55,35,7,38,35,4,44,35,7,27,35,6,19,36,
+    4,23,35,4,21,32,6,52,31,7,45,32,7,37,30,7,36,31,5,48,31,4,41,31,4,35,31,2,35,32,7,28,31,6,27,31,7,19,31,5,18,31,3,26,30,2,25,31,4,18,26,6,45,28,5,45,25,5,42,26,7,33,26,5,35,26,8,30,
+    24,8,29,26,6,28,24,6,28,26,4,38,24,4,35,25,3,30,28,1,31,27,1,28,25,2,29,26,7,22,26,7,15,26,5,18,25,4,18,25,2,25,26,1,25,24,2,25,27,2,21,23,2,21,26,0,24,25,0,24,25,0,23,25,0,22,24,0,
+    22,21,7,33,21,5,36,18,6,33,21,8,27,21,6,26,18,7,25,21,3,32,21,3,27,17,4,29,18,3,25,21,8,18,20,7,16,20,6,17,18,7,22,19,7,13,16,8,22,16,7,15,19,4,22,17,4,21,16,4,20,17,4,13,21,2,28,21,
+    2,25,21,1,21,19,2,24,18,1,21,17,1,21,19,1,16,17,1,16,16,1,16,16,0,15,15,1,16,15,0,14,14,8,21,12,4,25,13,7,19,11,7,13,13,4,15,13,2,19,10,3,19,13,1,13,10,2,11,5,7,11,5,4,11,7,2,14,3,
+    2,6,5,1,10,4,1,7,3,1,5,2,1,4,0,1,2,14,0,14,14,0,13,13,0,12,9,0,9,3,0,3,1,0,2,1,0,1,1,0,0,0,0,0,247,62,68,62,0,0,143,255,73,68,65,84,120,218,173,221,5,96,151,229,218,48,240,29,15,136,
+    148,73,72,136,130,162,162,120,164,17,16,143,138,190,32,50,74,70,141,110,9,37,21,59,94,15,162,48,144,144,6,73,165,70,73,59,80,44,54,74,144,67,77,98,180,32,168,148,180,126,87,221,249,
+    60,207,127,195,247,187,216,198,24,19,97,191,93,215,221,247,19,247,23,198,149,191,36,174,94,149,159,79,253,97,226,156,196,41,55,126,53,241,198,175,191,254,239,31,167,254,247,215,255,
+    133,248,53,103,5,120,251,246,99,239,190,251,238,219,111,63,246,246,99,143,189,132,209,175,95,95,140,106,125,251,246,232,220,163,27,70,114,114,215,100,140,174,45,230,39,207,167,72,193,
+    248,38,107,241,19,196,190,125,251,14,28,184,112,241,226,165,75,103,206,156,189,124,229,202,213,171,87,240,175,255,231,95,81,113,85,255,43,213,63,140,254,29,191,209,191,225,189,95,223,
+    195,128,191,246,59,239,188,217,255,101,136,110,221,58,119,238,252,124,71,140,138,21,19,74,151,46,29,175,162,94,189,122,205,48,234,215,135,151,182,109,219,54,108,23,136,169,16,237,49,
+    150,46,167,88,1,177,250,167,125,171,219,238,129,191,249,234,116,136,245,248,111,78,94,139,255,248,181,107,83,183,108,217,178,105,83,31,59,54,253,183,68,247,45,189,123,247,94,10,209,
+    94,69,235,150,240,74,239,245,94,214,123,217,15,63,114,188,246,227,235,118,92,178,34,78,254,205,175,159,114,191,22,30,239,169,104,92,142,255,61,247,143,236,167,254,151,130,152,31,123,
+    9,121,49,192,86,116,251,86,131,232,44,209,181,107,215,132,78,192,27,159,60,31,148,241,223,58,111,37,198,87,43,131,198,107,76,232,143,173,38,225,140,3,135,46,94,60,9,194,103,47,163,
+    240,229,171,127,197,138,171,190,47,253,187,126,147,127,130,248,190,243,206,59,194,219,173,243,243,204,91,30,117,49,74,64,24,227,122,245,138,215,171,175,194,49,182,126,209,190,61,72,
+    47,85,194,240,183,94,13,111,224,27,121,61,251,38,39,207,157,11,111,122,82,128,102,239,77,24,240,19,188,219,115,203,22,250,240,210,158,64,106,254,60,109,221,123,211,15,90,248,181,215,
+    95,15,26,159,60,121,82,3,159,226,127,252,159,127,254,121,245,234,213,63,241,43,192,95,134,32,239,175,33,1,162,167,178,229,254,245,127,85,64,26,188,251,24,243,130,111,117,140,106,213,
+    12,111,167,78,240,210,21,35,153,3,254,141,243,32,24,248,171,175,214,196,12,39,135,17,248,146,0,195,223,60,54,112,88,254,158,138,224,237,44,186,229,33,208,183,100,9,246,213,194,108,
+    92,31,137,159,34,97,136,118,161,129,201,60,117,218,242,85,171,86,173,88,245,13,248,166,204,75,73,153,191,8,98,54,199,92,136,121,61,141,49,68,27,244,93,218,83,69,107,8,251,79,36,224,
+    54,248,221,160,132,53,241,206,157,174,116,156,245,239,54,225,84,230,115,177,104,89,23,227,212,175,65,222,199,30,171,94,221,227,173,132,190,20,4,140,111,230,206,181,129,191,202,12,88,
+    17,83,141,206,56,116,33,2,248,106,84,169,190,250,199,185,112,95,170,206,239,188,41,197,25,125,203,83,88,233,75,81,139,131,147,24,129,27,52,104,80,191,193,200,134,20,147,35,141,151,
+    130,240,170,149,171,190,94,153,178,114,201,18,228,157,51,103,118,147,38,227,155,204,110,210,2,34,177,237,188,214,173,123,130,91,79,248,65,47,61,29,95,104,8,218,250,196,158,240,206,
+    176,136,147,196,189,26,234,27,43,105,109,92,39,44,94,199,23,117,43,85,170,8,209,201,34,254,59,192,66,188,122,21,214,232,40,224,115,240,254,175,47,134,249,6,243,247,61,223,183,219,243,
+    148,191,182,175,1,54,198,181,106,213,171,87,171,86,3,138,145,28,156,202,13,39,55,116,163,221,232,233,83,103,0,240,148,25,95,164,212,170,149,130,217,59,7,162,206,184,241,227,155,64,
+    36,66,32,97,107,106,95,145,183,117,155,246,66,139,186,228,171,66,19,99,69,239,243,163,142,215,162,128,175,122,97,55,80,81,105,203,180,111,199,6,22,92,229,91,73,124,43,86,236,248,127,
+    5,38,225,213,75,131,192,110,218,94,61,23,233,123,42,220,87,243,178,111,135,242,29,58,144,110,157,210,37,234,132,9,215,171,135,217,171,98,164,118,198,0,215,145,13,71,242,75,195,134,
+    163,71,79,157,65,177,114,202,188,69,139,62,95,52,103,206,164,241,18,227,8,88,140,209,174,117,123,114,109,215,90,229,174,165,219,76,125,18,11,67,111,204,16,135,3,59,184,87,32,48,119,
+    207,158,13,227,197,46,148,93,151,223,14,245,117,211,183,106,181,128,175,39,252,119,128,215,72,145,206,56,112,158,59,89,212,203,186,114,53,164,79,117,234,207,96,3,28,145,191,253,237,
+    244,69,95,12,244,45,89,178,100,157,80,96,149,191,28,245,237,95,176,114,131,6,207,242,59,163,166,140,158,62,125,198,244,233,139,23,47,94,244,249,231,147,38,33,239,56,138,225,248,166,
+    22,1,215,23,70,76,218,214,33,188,104,235,3,255,240,99,64,216,146,142,35,82,43,46,95,190,12,95,44,226,253,237,55,155,54,180,28,135,248,62,230,214,231,106,65,223,242,229,85,149,214,41,
+    252,119,129,247,248,192,33,221,172,80,223,115,174,239,187,174,111,71,238,60,147,111,163,70,141,208,183,100,137,8,96,151,56,52,36,163,167,76,199,248,124,250,231,228,59,73,120,1,24,3,
+    254,28,74,226,250,90,184,109,168,175,174,210,2,140,41,28,200,97,27,88,179,170,56,123,86,178,215,248,254,111,86,195,106,125,217,183,154,138,74,182,47,8,187,41,108,124,87,102,230,203,
+    99,166,175,214,124,5,37,122,181,149,193,151,9,248,10,215,161,232,30,180,229,171,198,191,186,60,187,249,219,177,131,242,13,3,46,113,45,192,138,88,132,217,119,210,248,186,227,26,55,30,
+    55,188,174,242,133,110,27,19,91,105,28,21,144,224,170,21,118,129,3,85,58,206,227,69,224,51,63,159,58,115,230,55,246,133,127,61,202,189,151,69,223,44,229,47,2,131,112,194,223,2,158,
+    254,229,154,175,40,104,160,132,227,164,11,39,47,113,10,107,223,72,97,167,64,255,26,233,219,165,99,199,46,146,192,141,254,255,0,171,36,158,62,114,178,0,143,159,56,113,34,0,55,174,75,
+    241,140,234,153,55,32,225,250,46,103,253,208,36,110,109,128,35,155,225,31,127,140,187,106,219,162,238,153,51,167,79,158,62,141,190,239,169,192,214,246,237,107,203,95,123,240,107,242,
+    183,188,10,213,10,43,96,219,55,38,240,55,147,191,248,74,1,99,137,222,199,25,204,53,90,58,90,209,196,118,2,195,247,239,111,202,87,122,207,202,183,11,250,118,200,42,112,86,124,85,67,
+    60,114,228,228,201,147,56,0,88,241,214,125,230,153,103,158,148,63,45,209,46,212,177,194,234,101,57,196,46,240,206,184,215,165,44,159,81,113,250,52,241,254,252,198,123,63,115,219,132,
+    241,222,219,111,191,247,191,239,254,205,252,85,190,229,173,176,129,217,55,107,192,95,125,195,188,95,114,10,239,201,56,196,37,250,204,25,6,54,101,26,136,47,199,0,254,77,207,78,6,125,
+    33,236,10,77,192,37,162,58,89,89,3,110,48,116,232,80,244,253,232,35,227,59,81,225,74,216,196,245,51,35,110,221,206,106,131,253,28,94,102,152,227,126,190,124,230,18,203,202,228,229,
+    73,140,159,49,222,13,70,22,121,31,179,167,55,194,124,85,55,75,186,88,218,215,169,208,80,141,61,93,137,47,191,252,66,1,239,63,120,254,4,3,67,14,159,59,39,61,197,136,52,214,147,115,167,
+    168,1,122,239,221,95,189,242,172,125,187,72,15,218,202,224,255,47,192,67,25,120,220,184,137,19,135,79,28,43,192,53,93,225,6,102,200,20,43,129,189,12,238,243,99,31,214,253,145,42,179,
+    1,190,172,101,181,238,201,99,16,63,31,61,10,255,240,119,222,214,241,238,219,177,144,29,94,119,254,42,204,215,2,158,59,55,139,21,90,243,126,241,5,150,233,148,20,240,221,147,177,31,128,
+    79,94,58,77,192,103,207,253,124,202,38,14,36,240,185,115,210,2,255,166,58,88,138,183,179,235,123,13,192,13,178,8,140,196,226,59,28,211,119,196,216,177,35,70,184,192,138,184,126,22,
+    170,116,235,214,109,120,98,211,90,158,0,224,62,47,128,176,85,166,127,140,187,228,241,158,56,113,2,120,143,30,61,122,248,112,255,254,253,95,210,241,216,99,136,252,216,99,108,236,50,
+    191,251,110,12,223,206,97,190,86,137,198,137,88,147,192,43,191,90,19,177,206,160,147,23,125,191,248,2,23,158,176,68,35,240,239,208,170,48,240,41,200,98,76,227,203,97,196,87,121,146,
+    18,186,207,12,236,151,103,203,55,8,92,231,239,0,163,41,125,206,80,137,143,134,126,68,157,102,240,29,1,194,99,71,212,173,89,179,102,13,12,248,89,11,199,103,14,12,35,168,54,109,218,244,
+    214,194,47,136,112,239,54,59,157,150,88,1,95,196,56,65,113,140,124,145,87,175,242,225,122,16,25,155,224,76,230,132,246,120,221,2,29,238,43,192,188,220,160,151,10,83,190,249,102,101,
+    216,218,160,246,37,94,124,93,140,192,233,0,188,247,224,65,202,224,211,167,165,72,83,132,39,241,85,51,135,37,190,88,165,250,171,242,220,205,240,162,176,3,92,250,239,248,2,104,3,254,
+    164,161,38,8,24,121,33,106,140,173,57,182,166,18,174,241,36,27,103,73,184,181,6,126,193,89,98,236,243,227,78,175,175,21,199,184,23,32,14,29,148,216,177,99,199,86,136,94,61,122,244,
+    80,139,184,244,83,63,215,152,147,249,177,96,100,197,183,162,227,155,146,146,217,90,48,242,46,94,140,217,251,197,98,136,37,75,16,120,247,158,189,12,124,146,129,41,137,13,177,47,204,
+    45,240,89,25,226,99,255,138,190,143,131,233,27,76,97,2,174,115,77,179,28,42,123,109,224,143,62,226,4,30,33,192,35,0,183,102,141,39,68,24,141,159,124,198,106,134,19,51,3,126,33,8,236,
+    119,166,227,16,247,208,161,3,7,14,236,207,192,0,220,29,219,183,111,217,146,214,11,125,59,119,238,172,122,194,192,92,189,122,191,126,46,229,187,81,186,122,0,28,222,254,86,84,192,236,
+    155,106,128,87,187,174,171,109,225,41,139,153,119,9,250,46,73,73,79,223,189,123,239,142,227,7,79,252,126,242,119,44,210,138,248,108,148,48,1,171,57,28,206,223,195,91,77,250,58,190,
+    65,224,18,26,56,107,190,79,49,239,83,240,242,148,155,191,195,235,10,240,132,164,164,129,53,188,144,42,157,5,97,2,126,1,66,21,104,71,88,3,95,56,15,186,25,25,251,56,246,108,195,216,146,
+    6,190,189,186,117,214,33,92,68,247,88,172,112,116,101,130,35,202,183,51,37,176,248,174,150,192,209,45,45,245,98,216,233,251,213,87,216,242,10,47,198,174,93,8,188,247,248,241,95,108,
+    224,88,194,87,117,129,254,237,55,242,61,122,120,107,90,104,250,18,112,121,51,147,133,192,165,235,92,99,254,178,174,155,195,131,134,15,31,164,242,119,196,136,49,73,35,128,120,160,66,
+    166,119,106,178,112,162,39,236,99,3,112,207,158,109,94,208,161,129,127,240,129,65,151,109,249,107,138,190,169,105,107,215,174,165,253,42,184,122,139,57,104,144,99,17,87,175,238,251,
+    114,7,218,193,45,95,178,98,197,142,21,43,117,194,77,29,221,146,147,215,174,77,77,77,77,79,79,199,125,14,42,248,61,243,1,69,252,37,251,10,240,18,2,62,14,113,236,247,223,89,216,37,254,
+    67,132,237,65,18,79,113,252,246,219,239,239,253,252,11,212,231,104,95,157,194,2,140,235,73,165,175,169,249,173,229,4,226,226,15,136,225,35,6,73,2,15,73,2,95,20,30,232,164,176,35,140,
+    35,226,250,137,86,40,97,92,40,134,142,180,79,252,131,55,169,21,151,97,233,194,23,53,61,29,190,224,169,226,219,137,146,141,132,73,153,137,251,134,19,123,184,198,183,162,151,188,148,
+    192,240,167,43,222,84,226,53,190,33,161,218,96,182,93,164,82,88,50,248,23,13,124,82,117,182,206,218,57,172,22,29,174,252,113,5,128,113,22,246,247,223,193,23,128,211,210,212,226,96,
+    66,8,176,18,46,29,1,92,43,235,190,181,106,61,57,72,197,51,4,60,97,194,144,33,8,76,25,60,176,70,12,97,55,76,10,171,237,0,154,120,211,166,62,155,54,109,250,225,135,31,254,107,17,199,
+    41,92,217,46,148,146,146,154,138,91,133,186,118,133,34,170,56,42,117,206,199,204,68,124,123,88,22,7,117,59,71,250,82,65,232,12,95,89,246,133,154,225,121,238,179,107,138,246,149,196,
+    197,205,16,139,200,119,215,198,141,27,49,133,45,225,211,49,132,175,92,161,4,198,89,246,223,127,249,133,234,115,218,203,129,222,115,64,24,50,56,65,17,91,188,13,26,160,239,83,119,101,
+    238,251,36,191,12,50,196,152,190,67,134,8,112,82,82,13,120,121,226,137,26,248,106,21,233,90,89,5,22,230,158,47,200,142,46,75,152,129,41,121,176,249,163,142,78,234,252,128,111,197,138,
+    157,115,150,175,196,209,185,90,213,96,99,236,181,187,28,242,31,84,12,166,47,251,246,92,139,190,219,52,239,158,61,10,86,197,158,61,123,12,48,252,213,136,86,199,174,93,235,29,224,8,97,
+    13,124,21,125,161,11,125,26,124,143,137,47,86,170,111,191,237,18,17,44,220,168,116,66,130,74,97,179,145,67,89,62,149,73,255,249,73,137,65,182,239,192,129,67,38,12,177,132,147,6,60,
+    193,145,181,20,22,101,159,184,103,207,222,91,52,177,5,76,95,64,234,222,16,48,111,245,35,224,78,122,233,167,98,231,74,21,149,112,103,211,223,130,110,117,245,224,166,43,39,76,2,87,84,
+    245,158,211,23,122,113,105,105,105,212,167,3,200,125,17,161,114,56,61,93,251,206,153,179,104,209,194,69,235,214,173,67,223,141,71,208,87,132,127,143,37,12,111,47,227,54,134,51,167,
+    161,75,118,140,125,211,214,118,251,182,219,243,93,186,68,11,39,116,232,80,30,124,19,216,56,62,190,22,188,100,58,123,165,125,159,212,188,240,67,3,15,28,49,112,136,14,1,30,48,192,22,
+    150,28,142,135,225,48,191,216,81,162,4,8,55,211,205,176,138,238,244,182,13,111,204,252,65,136,17,88,245,85,191,90,179,210,6,238,100,1,151,167,159,165,53,214,196,202,216,219,115,21,
+    240,53,223,37,244,39,116,182,124,183,108,217,178,125,251,118,91,23,123,4,25,42,40,135,49,137,119,35,240,174,37,202,119,225,194,133,224,187,107,3,10,111,103,224,40,225,43,106,19,0,190,
+    189,124,10,215,84,78,227,84,236,209,29,228,251,45,70,151,24,194,9,78,240,102,202,172,250,62,105,133,237,59,80,234,179,157,193,158,240,51,207,212,229,42,13,255,187,68,250,159,26,96,
+    126,159,114,184,107,0,152,247,101,110,218,212,123,211,230,31,120,102,58,238,39,61,18,225,201,66,83,161,59,117,234,24,24,224,84,242,140,213,134,43,181,228,235,243,162,111,197,96,250,
+    246,64,95,210,221,190,35,195,128,66,143,254,0,71,198,1,252,181,38,198,109,226,187,144,119,225,194,57,11,217,119,221,186,13,27,54,64,6,59,41,236,10,155,20,166,109,73,87,0,24,23,203,
+    192,247,248,142,173,91,210,82,217,55,22,176,39,140,25,124,205,249,59,200,174,206,228,59,112,96,146,47,236,229,176,76,90,18,172,54,142,119,83,185,69,139,22,48,206,108,213,202,175,211,
+    61,151,46,197,58,189,121,51,18,43,224,175,129,151,129,231,205,75,158,59,183,171,6,14,76,33,35,155,77,28,228,5,71,122,209,17,72,223,30,42,125,113,86,101,191,196,1,163,43,198,24,123,
+    181,239,122,223,87,1,31,225,20,254,37,150,48,110,137,191,74,123,25,46,81,2,239,216,14,190,169,153,38,112,151,46,6,183,73,2,237,125,140,207,124,209,72,249,62,35,188,78,12,100,224,164,
+    144,28,38,223,129,170,70,67,18,67,22,143,147,154,65,216,58,24,184,89,179,230,16,93,91,81,30,227,155,228,158,201,169,201,44,220,27,129,41,137,227,120,178,247,43,149,193,14,112,136,112,
+    121,149,196,134,184,170,213,163,10,11,183,243,220,3,125,211,210,182,110,37,94,203,247,144,138,140,253,52,179,118,0,63,76,192,187,119,107,95,138,117,11,197,151,133,127,249,37,68,88,
+    173,31,18,48,33,227,178,247,153,51,151,200,119,7,12,246,97,180,144,12,190,179,103,119,201,44,200,87,109,110,181,119,216,141,84,251,234,28,226,90,129,2,109,57,227,160,23,124,147,134,
+    68,84,105,25,19,211,210,210,112,127,168,85,203,203,98,220,79,221,162,45,173,169,3,241,220,228,174,201,37,154,245,228,83,18,148,197,88,167,227,120,50,223,248,58,192,157,130,192,229,
+    43,86,116,42,181,213,99,174,24,58,228,45,111,243,114,250,226,76,55,234,170,201,239,131,192,106,128,15,177,239,1,241,221,35,190,235,214,129,237,108,59,127,17,248,72,90,148,240,111,191,
+    81,51,252,135,44,31,226,118,128,51,12,124,124,199,246,109,27,121,52,8,190,153,3,119,49,188,147,33,112,255,141,236,193,129,95,209,174,103,248,128,113,134,20,126,138,50,120,144,116,159,
+    173,62,244,192,65,12,60,36,233,113,71,120,128,34,30,88,195,74,225,225,195,235,66,26,187,206,137,1,97,42,213,20,45,82,179,149,152,223,98,174,20,234,165,36,28,199,139,53,1,96,147,194,
+    21,195,132,43,90,45,109,231,7,43,122,188,126,14,119,212,233,75,213,121,235,214,195,200,123,204,226,229,56,15,47,24,244,139,131,7,247,103,236,221,43,190,187,128,20,140,77,125,22,225,
+    35,20,191,132,22,233,179,148,194,103,105,237,144,182,157,113,2,159,56,8,190,219,210,121,56,72,71,71,98,209,150,132,55,168,219,2,207,31,144,175,142,134,13,167,192,15,246,29,105,37,243,
+    208,161,79,13,125,242,201,90,122,120,100,215,105,74,224,129,104,250,132,147,195,3,6,112,30,203,156,22,175,43,129,238,112,101,60,124,184,149,197,216,42,179,112,51,1,102,228,22,93,215,
+    206,165,95,206,213,194,155,226,244,98,156,2,158,199,192,42,135,67,170,116,105,79,152,126,17,205,171,27,95,226,197,244,221,177,197,201,223,243,94,240,71,247,163,239,94,240,221,189,158,
+    129,41,133,215,57,190,27,143,132,8,155,42,141,192,63,159,187,172,128,113,103,3,248,30,220,187,125,219,110,58,251,149,44,135,131,66,100,155,200,212,86,19,6,166,19,68,243,86,78,158,98,
+    194,62,107,166,153,85,51,60,148,106,244,32,226,13,84,104,24,37,37,145,171,0,127,248,225,135,73,58,6,10,48,18,215,101,98,193,69,101,253,11,47,135,145,213,188,219,98,238,220,185,36,220,
+    59,20,56,121,110,215,228,22,241,182,112,176,78,219,93,106,147,190,21,3,137,30,28,26,81,117,222,178,227,224,241,227,199,68,247,208,249,140,67,156,181,231,15,81,250,178,239,94,140,221,
+    156,191,202,119,157,235,187,193,245,13,54,195,32,124,229,236,57,217,82,136,91,87,208,55,99,207,54,232,181,225,34,244,108,21,208,204,134,103,240,236,46,132,11,1,95,152,196,59,45,223,
+    165,181,249,80,25,4,16,79,153,194,71,24,164,68,227,139,100,111,56,48,10,39,233,166,216,6,70,97,226,85,73,204,129,176,195,135,219,213,58,177,137,11,236,69,219,100,206,97,27,120,158,
+    2,118,82,152,132,43,198,20,86,45,109,152,47,45,43,0,47,38,111,154,42,207,199,21,47,151,231,205,7,220,246,247,144,18,230,252,101,223,133,145,190,209,194,84,163,207,241,134,209,203,228,
+    123,226,224,254,125,123,112,88,61,127,209,252,121,26,120,118,147,96,10,75,80,238,206,166,93,129,147,239,156,49,101,198,116,120,129,175,220,84,47,36,143,117,6,63,57,212,84,232,80,224,
+    36,238,93,33,175,53,90,130,24,49,130,121,107,202,30,15,10,222,154,55,92,5,248,142,171,165,15,188,40,211,38,124,138,45,177,9,103,241,60,234,78,27,96,39,133,233,216,95,39,135,56,192,
+    172,234,116,216,111,242,241,148,142,157,58,169,105,231,94,146,190,212,250,30,151,26,124,16,219,220,140,140,243,23,116,113,62,79,205,48,253,246,94,6,222,184,81,234,243,58,159,215,248,
+    250,194,206,116,135,0,159,197,2,125,241,196,249,253,25,48,238,90,141,19,58,139,230,89,194,166,88,55,177,3,62,212,162,197,60,142,233,211,191,154,78,135,139,86,173,154,42,167,186,49,
+    12,177,84,105,94,24,172,37,172,17,192,134,148,128,135,216,192,72,76,160,22,177,218,124,169,128,225,205,56,37,204,184,86,8,240,60,40,211,144,193,107,60,96,153,202,74,238,234,16,119,
+    236,232,140,124,202,75,223,201,29,238,90,171,69,24,157,59,119,210,181,89,87,103,171,237,13,52,190,88,160,207,91,190,187,55,238,222,184,62,224,187,97,67,16,56,180,163,133,192,72,204,
+    251,189,105,103,146,246,165,19,186,65,97,239,235,132,233,75,217,11,53,25,112,167,147,46,196,167,203,237,176,114,24,187,211,34,60,232,73,221,10,15,10,1,182,132,229,151,195,146,198,64,
+    76,224,165,196,154,53,235,178,176,181,35,207,10,66,30,167,6,77,206,223,186,73,34,19,67,59,60,191,120,235,32,240,124,62,120,222,53,57,217,169,211,152,198,136,220,209,235,29,135,68,71,
+    245,95,56,186,106,98,195,18,62,127,48,34,112,145,23,129,113,178,57,144,190,6,216,21,62,18,72,97,181,58,76,175,188,243,236,80,6,78,111,19,48,205,124,206,139,210,85,157,21,213,228,78,
+    159,62,125,134,226,133,160,243,250,20,138,184,61,17,67,231,122,164,222,97,7,180,180,0,60,116,232,160,152,41,252,4,25,15,27,51,12,120,39,140,29,59,129,246,91,242,134,203,103,34,128,
+    85,181,30,215,36,52,18,25,120,94,234,82,40,209,171,28,96,154,140,166,28,22,97,139,152,157,59,209,157,21,202,214,158,219,192,223,112,113,187,173,237,181,150,116,105,94,210,229,141,142,
+    227,240,89,194,11,138,89,6,182,132,173,217,14,66,62,163,124,15,236,195,4,198,101,149,149,178,240,24,72,98,172,119,204,11,90,154,87,106,243,170,79,57,121,209,117,217,178,101,14,49,117,
+    168,17,184,129,34,134,212,29,250,209,71,67,109,96,187,21,86,192,156,196,152,190,99,106,0,176,68,221,186,42,139,99,16,71,0,227,55,40,2,47,237,217,59,110,205,42,59,133,83,4,216,22,246,
+    137,221,168,40,37,220,254,88,231,174,93,187,117,75,198,5,65,163,43,190,7,15,70,10,31,151,236,221,177,151,59,208,224,155,186,126,93,12,95,69,188,193,17,246,83,216,108,234,7,95,78,96,
+    0,198,98,5,194,243,160,76,207,115,117,91,104,93,227,203,7,123,63,197,88,165,43,243,50,21,34,44,35,38,51,84,178,34,68,152,171,51,190,29,134,65,229,121,2,188,212,172,161,141,185,64,71,
+    212,233,186,56,17,50,110,92,124,132,47,3,67,6,91,187,142,25,56,5,39,241,68,56,75,196,118,200,231,119,75,94,203,65,186,219,52,111,100,6,67,135,11,76,177,227,188,131,125,49,123,55,174,
+    15,166,111,24,240,131,221,2,194,246,218,240,153,211,178,53,248,2,36,240,62,92,250,102,224,149,180,123,96,30,9,207,165,128,175,138,182,53,190,80,157,71,143,30,61,117,244,167,28,114,
+    103,206,50,43,128,183,125,251,246,36,60,185,190,153,147,142,37,108,58,209,0,60,134,99,2,198,88,43,212,201,135,168,166,24,71,79,227,18,154,224,68,106,2,94,6,225,52,48,116,241,199,210,
+    165,54,240,87,188,96,136,194,180,109,103,173,69,156,37,100,117,173,10,217,166,166,178,174,203,187,223,205,217,189,58,246,236,181,66,170,179,248,126,199,177,238,251,117,248,178,238,
+    251,32,241,145,72,225,51,64,124,18,79,167,157,164,2,189,79,182,242,125,245,197,74,33,94,180,104,158,137,185,220,232,154,220,157,50,101,20,234,66,124,106,2,107,179,195,75,194,50,233,
+    49,185,33,246,179,66,136,13,178,154,143,22,97,155,215,19,102,226,186,53,107,134,27,195,111,141,27,151,128,71,140,155,52,145,187,32,116,19,44,192,173,226,236,131,3,2,156,174,133,125,
+    100,215,218,250,85,87,235,206,28,222,136,147,170,113,141,238,142,253,251,117,198,18,228,182,16,224,237,219,55,42,223,239,33,190,179,227,123,138,13,46,177,141,108,53,195,38,139,47,157,
+    68,223,11,23,112,123,225,170,159,100,117,244,11,69,188,216,2,158,55,197,137,81,163,70,141,30,53,218,3,158,54,13,80,27,58,9,188,140,122,89,12,220,182,93,125,123,101,201,23,126,70,23,
+    105,37,60,204,246,29,235,71,93,135,216,99,166,177,146,248,142,11,169,208,0,188,217,1,198,125,49,171,83,210,83,150,6,136,77,183,58,50,232,190,39,220,4,203,219,172,12,238,254,253,74,
+    119,63,219,238,23,222,144,176,116,55,172,251,254,219,239,130,241,189,68,132,177,59,86,58,9,47,151,56,125,47,156,63,64,9,172,87,207,68,120,165,193,101,96,156,150,82,188,163,70,127,108,
+    98,154,142,101,211,238,94,230,132,26,39,33,112,219,182,124,239,78,40,49,144,160,50,1,15,132,97,81,82,18,235,142,153,48,86,9,207,132,8,0,219,194,154,153,231,49,9,216,241,149,62,52,54,
+    193,219,76,6,175,97,223,20,220,88,73,62,169,91,52,114,178,14,62,75,52,87,230,186,204,37,42,168,59,95,116,53,47,160,102,100,236,103,223,253,204,27,173,187,123,239,54,156,213,80,186,
+    27,116,101,190,86,99,43,135,127,255,253,228,201,99,120,224,10,210,247,60,109,15,38,224,53,188,11,23,79,73,16,49,244,159,166,76,1,219,165,237,218,45,93,170,46,61,162,180,253,216,137,
+    105,22,177,138,167,151,77,155,102,241,210,153,124,190,25,77,140,159,124,114,164,39,76,201,199,251,162,117,242,74,2,207,212,225,19,63,99,217,226,203,157,14,176,195,171,11,52,36,240,
+    246,187,12,240,154,149,170,66,51,48,237,128,215,200,220,179,198,55,115,173,192,27,204,48,48,1,152,87,254,91,208,221,155,177,159,120,247,203,154,47,52,191,65,222,109,60,223,140,178,
+    244,102,253,6,221,244,42,206,89,179,102,125,55,203,241,77,64,226,239,66,148,9,88,111,240,56,137,190,124,156,14,119,247,107,223,111,86,125,77,83,179,232,11,47,51,164,143,188,20,112,
+    167,152,41,72,240,252,56,44,108,101,120,157,58,205,204,85,18,175,92,124,135,247,103,17,112,173,167,220,68,166,209,141,18,70,90,178,213,45,240,204,16,99,171,171,165,243,183,38,47,39,
+    134,100,240,236,22,38,129,151,170,18,205,93,172,149,92,161,141,47,164,113,207,109,169,82,174,231,235,152,23,22,242,189,145,206,188,25,100,155,193,121,187,95,135,131,11,173,238,238,
+    109,187,57,54,110,76,223,184,113,215,250,245,235,118,169,142,51,89,46,152,101,133,22,110,28,153,201,58,135,143,253,98,116,79,156,63,120,158,207,110,144,239,60,154,156,253,18,207,177,
+    129,239,12,21,68,139,90,6,240,99,120,255,227,168,80,159,36,190,120,203,93,235,250,45,235,227,11,221,142,86,79,19,83,169,54,21,155,103,40,96,144,35,194,118,204,244,194,78,98,191,25,
+    166,252,245,179,23,104,239,140,159,43,9,140,139,13,52,76,82,7,111,87,218,21,122,219,118,78,97,129,150,0,222,196,48,98,59,247,247,236,217,199,169,139,27,53,34,120,113,33,127,239,110,
+    29,56,99,69,97,235,126,71,172,159,125,54,107,86,40,115,4,50,230,240,150,95,118,64,30,243,97,73,154,249,84,27,52,205,97,197,47,73,216,248,206,192,222,83,88,68,250,218,191,106,216,176,
+    54,5,165,46,222,111,168,194,190,162,163,193,100,38,22,225,186,117,233,0,169,147,190,142,240,88,18,158,104,132,101,126,218,153,232,80,190,137,82,156,19,231,150,104,38,7,114,121,65,56,
+    110,13,159,186,214,192,41,171,211,77,23,137,66,146,153,207,60,164,164,196,207,75,113,211,88,149,118,240,93,141,183,102,208,190,200,253,251,105,89,232,208,193,16,94,222,166,177,59,85,
+    233,166,239,10,209,253,78,116,63,195,152,21,19,153,153,213,240,9,132,211,104,179,244,241,131,199,105,238,4,90,138,125,123,66,124,45,97,238,29,219,241,105,108,95,29,255,195,241,116,
+    237,167,107,223,45,81,175,248,157,74,88,55,198,56,133,41,59,2,134,14,29,167,133,41,63,163,210,151,149,235,218,13,177,117,86,92,39,48,17,39,210,134,19,154,161,129,193,30,187,8,176,214,
+    149,105,14,85,162,161,21,13,18,227,246,228,159,82,76,208,127,196,255,217,106,62,126,66,123,95,247,211,66,17,174,1,146,239,193,48,94,1,198,253,116,233,235,45,222,117,11,177,52,47,96,
+    222,64,196,78,101,37,124,92,7,238,10,217,163,54,208,179,239,215,2,12,175,171,86,105,95,87,87,127,192,211,20,82,197,170,226,105,138,187,239,46,78,192,197,139,23,215,25,44,194,56,107,
+    50,146,144,81,155,111,198,26,7,98,82,130,107,68,3,207,28,59,113,162,233,76,91,3,96,154,228,96,95,90,81,82,93,43,73,95,106,128,113,15,124,156,214,117,129,205,0,22,126,222,162,219,100,
+    57,3,152,226,197,55,114,180,8,119,176,67,246,234,29,116,52,69,229,248,238,209,190,152,187,235,57,148,238,66,192,93,184,32,82,55,51,229,117,235,216,120,227,70,231,219,201,61,171,248,
+    181,228,175,246,93,37,9,140,166,60,139,177,204,128,7,82,53,36,16,247,158,123,8,22,226,110,113,182,133,235,123,194,13,26,56,194,19,106,206,212,57,60,54,72,12,192,114,95,75,93,51,56,
+    242,186,207,26,87,128,151,138,47,3,175,92,105,3,115,79,216,157,160,216,177,93,167,193,79,234,160,167,117,92,155,15,191,240,161,34,218,251,202,251,171,212,222,12,223,119,111,122,42,
+    119,153,37,120,191,21,109,184,146,110,21,57,242,191,58,83,99,155,25,167,186,152,120,55,247,226,204,225,151,176,252,93,69,217,59,218,153,163,146,112,125,255,39,86,16,48,240,222,69,47,
+    197,57,141,239,230,52,174,95,175,126,91,67,140,198,13,180,240,56,45,60,83,213,233,208,28,158,168,47,228,169,107,251,146,240,120,156,191,50,251,116,236,244,229,4,6,224,149,86,136,176,
+    25,199,90,196,219,173,100,64,206,213,58,212,71,168,245,61,32,233,187,223,247,221,99,151,231,221,134,119,253,174,69,9,178,99,131,147,119,166,224,58,83,120,153,50,107,98,156,173,198,
+    65,23,135,123,208,152,120,29,223,25,177,124,167,101,129,87,234,51,224,82,112,22,171,60,174,103,46,12,151,118,88,231,112,45,188,163,210,84,233,24,69,122,38,22,105,16,30,78,192,195,109,
+    95,0,86,77,239,92,215,55,85,124,127,140,51,186,216,25,198,211,216,233,60,87,193,192,25,50,142,205,216,193,135,196,247,68,157,240,148,163,39,196,123,129,119,70,158,151,205,85,219,157,
+    230,119,219,54,59,125,231,119,213,27,174,22,18,47,224,206,212,184,118,72,103,211,242,157,233,49,27,98,108,211,211,211,185,207,64,77,8,93,237,194,188,210,193,250,82,249,154,89,72,123,
+    110,202,2,206,92,87,249,22,215,198,210,223,186,247,222,123,91,182,108,201,57,60,146,147,152,42,245,228,201,137,137,124,77,165,22,158,25,20,254,76,1,207,52,253,44,215,119,220,248,196,
+    22,78,254,42,224,212,84,46,208,63,106,96,238,120,233,201,40,16,222,162,23,248,184,39,156,33,215,0,236,217,19,165,187,143,211,247,194,230,77,23,105,235,141,153,117,62,238,251,154,244,
+    85,251,173,132,23,254,61,162,59,76,98,204,176,16,102,253,197,64,231,153,70,121,1,52,226,124,114,137,136,73,247,139,148,20,188,84,75,205,231,96,246,234,6,216,153,102,14,0,103,230,251,
+    244,211,46,176,157,196,119,223,13,237,242,189,247,18,177,202,98,17,30,105,9,143,27,215,184,177,8,207,164,127,147,159,198,159,233,26,237,217,142,27,47,171,10,86,251,155,108,124,93,96,
+    61,228,153,47,196,219,122,226,83,34,164,72,31,83,131,217,140,12,125,215,131,117,122,119,159,197,139,249,187,147,118,55,171,173,85,0,124,156,23,21,168,253,117,125,119,173,3,95,62,176,
+    128,190,159,205,28,203,165,153,100,7,15,30,60,204,68,68,66,91,223,236,44,12,1,127,26,157,32,78,217,181,100,201,23,139,167,0,241,87,95,173,209,247,111,73,129,86,233,59,58,178,68,199,
+    168,207,79,131,45,189,225,160,22,56,4,248,158,123,239,197,215,123,21,48,111,149,159,204,63,53,8,10,195,191,163,198,63,62,115,19,249,51,170,209,141,39,54,134,138,110,112,165,119,149,
+    232,250,90,245,153,125,17,56,197,226,229,213,130,116,20,198,199,128,108,151,61,54,199,118,28,212,171,4,7,50,162,78,122,10,239,33,188,176,231,252,133,11,231,45,224,237,26,216,247,53,
+    233,187,96,214,76,149,189,138,151,99,152,23,99,236,148,14,204,2,145,241,66,60,98,74,135,197,23,47,198,233,170,47,190,252,82,95,176,70,190,86,250,126,60,154,135,69,22,239,52,171,64,
+    199,200,218,167,237,4,182,132,117,137,190,7,137,225,165,246,189,186,29,30,57,178,129,206,97,75,120,226,216,177,51,99,4,222,106,57,17,111,166,37,96,153,190,178,118,70,91,188,210,191,
+    210,190,8,108,116,241,233,24,243,231,150,72,69,97,107,19,213,49,179,44,207,135,196,246,249,202,25,25,25,198,247,192,5,50,102,96,211,133,230,2,29,244,93,103,124,39,76,72,98,222,193,
+    126,12,11,56,59,57,109,43,79,156,8,127,26,8,127,254,57,2,147,49,0,127,105,1,91,205,47,174,39,232,169,101,30,34,57,13,112,86,116,113,8,92,92,122,208,119,222,165,6,75,80,160,239,81,194,
+    6,88,132,27,4,132,39,142,205,4,184,102,221,198,117,13,112,19,103,191,236,220,196,248,100,237,59,127,190,7,156,162,125,185,140,119,45,189,150,151,116,81,120,203,86,151,248,160,16,211,
+    225,206,140,125,234,52,47,159,7,148,244,221,121,209,1,182,123,88,232,155,14,180,169,14,239,194,57,88,159,169,111,53,108,12,243,126,240,1,190,126,224,41,103,201,24,27,172,73,147,230,
+    124,254,57,10,227,157,90,139,237,12,54,190,51,212,122,145,189,68,244,233,52,167,1,206,146,46,205,113,200,40,88,215,103,214,149,184,251,110,156,198,172,93,191,254,179,124,174,201,205,
+    97,186,24,124,226,196,76,82,184,78,227,198,117,173,242,156,104,10,180,174,210,228,219,178,181,246,221,252,3,30,31,77,153,207,188,102,133,40,149,247,100,72,18,83,22,227,237,119,102,
+    35,198,1,66,198,227,158,92,152,241,96,47,143,141,40,119,47,134,2,235,2,157,238,164,47,23,104,28,28,113,243,59,44,105,48,249,66,188,255,254,251,31,72,12,14,166,244,176,97,73,1,105,94,
+    81,101,225,207,57,24,152,46,183,84,192,171,86,125,97,251,154,149,3,51,60,154,134,171,73,22,112,20,172,17,164,113,145,158,234,112,125,233,247,105,162,218,8,51,113,3,238,45,141,31,15,
+    175,177,136,169,17,134,26,61,206,170,206,246,182,247,176,33,48,29,1,223,185,51,142,166,149,45,223,185,106,91,6,237,168,178,133,201,248,144,156,70,112,78,242,238,51,186,232,27,5,108,
+    55,192,150,175,174,207,99,196,87,116,85,68,25,15,30,204,123,34,108,99,0,30,49,98,4,1,127,98,1,235,12,166,4,142,244,157,230,250,198,208,189,39,60,212,116,116,200,71,139,223,205,235,
+    17,207,54,160,25,105,233,105,77,110,48,94,7,126,21,102,121,243,148,102,174,67,251,142,211,235,190,74,55,49,30,117,231,170,21,164,165,75,123,227,161,164,205,155,55,107,224,100,119,145,
+    87,3,91,194,71,149,48,158,29,58,20,22,198,215,6,214,194,220,2,7,125,177,219,59,171,14,205,229,80,251,59,248,67,151,215,50,142,165,44,251,95,70,208,190,113,4,254,228,147,79,52,176,110,
+    130,105,133,193,212,103,79,120,154,11,28,202,171,38,156,239,14,7,22,205,48,224,226,181,149,112,3,45,76,67,99,245,240,21,153,163,157,133,29,69,238,47,90,67,97,31,56,209,108,222,166,
+    21,134,196,196,121,218,151,143,248,115,19,188,51,14,87,0,101,147,70,152,240,22,213,16,27,97,136,19,225,184,204,203,192,208,147,182,83,88,230,176,4,216,248,206,145,252,5,96,246,13,5,
+    182,140,57,62,252,240,131,16,225,33,67,38,8,240,68,11,88,245,177,100,5,105,198,12,63,129,17,88,47,3,227,59,166,62,123,182,197,173,73,140,123,178,30,119,23,167,242,173,133,159,149,50,
+    61,153,132,39,77,210,192,11,236,5,240,153,99,245,123,240,3,138,52,54,215,252,169,206,246,43,248,35,112,55,232,60,227,75,21,122,211,102,186,104,135,128,57,129,227,147,99,9,31,101,98,
+    37,124,33,44,46,170,160,95,109,206,112,129,205,242,194,46,187,255,204,223,174,99,101,248,75,5,250,253,247,51,23,22,224,15,33,216,88,157,182,29,195,41,108,103,48,150,232,47,213,10,33,
+    174,46,204,8,108,200,209,75,253,248,211,212,105,1,222,226,42,84,10,139,221,253,16,244,6,127,230,78,115,128,247,46,245,157,81,251,105,22,126,150,132,71,170,105,173,73,66,60,103,193,
+    2,27,89,70,246,179,102,213,161,177,223,196,241,78,16,174,53,209,209,98,174,55,72,226,27,28,8,88,58,208,201,145,85,122,235,150,173,91,149,240,49,35,188,63,92,87,213,232,205,251,173,
+    26,173,38,161,145,215,238,64,83,255,106,162,52,192,195,164,131,245,126,68,124,240,129,159,199,18,131,217,151,222,142,240,129,41,131,191,228,21,36,244,125,234,169,25,184,21,118,148,
+    179,14,200,207,23,228,13,26,31,127,252,180,235,171,117,239,42,126,247,93,119,57,233,123,191,23,247,221,23,108,150,239,210,253,107,91,120,36,143,149,24,24,133,231,204,81,194,94,42,235,
+    25,156,5,22,110,147,196,38,238,113,81,234,100,225,174,50,138,229,43,86,108,222,236,1,207,13,237,104,161,240,86,20,62,10,17,153,195,23,79,176,236,9,11,248,130,211,8,11,112,186,89,218,
+    95,104,18,152,59,208,208,195,250,240,195,24,190,49,132,147,134,40,224,17,145,192,107,214,240,10,255,116,218,201,174,231,169,12,243,212,143,101,7,78,67,0,110,88,59,100,22,131,222,139,
+    9,76,153,124,223,253,110,147,204,127,0,254,57,79,219,194,35,149,48,18,207,30,143,15,187,35,69,223,24,222,163,95,207,113,243,183,137,57,97,51,25,127,166,83,233,170,72,131,176,0,167,
+    165,210,33,134,204,132,183,26,97,222,10,115,226,194,197,11,39,116,226,158,56,113,209,207,224,11,231,213,106,146,108,127,54,190,238,252,243,76,233,66,15,27,50,4,43,110,22,129,63,52,
+    193,71,108,37,140,175,2,158,162,210,247,75,218,192,49,125,198,244,81,232,59,202,140,114,221,74,253,113,67,132,175,29,54,73,117,87,113,175,139,117,127,104,220,167,132,239,145,209,19,
+    47,67,24,225,103,125,225,201,227,239,156,61,135,132,225,133,71,22,193,192,135,29,186,196,236,171,206,98,128,175,110,133,151,46,93,177,130,39,58,30,220,198,219,98,99,10,167,57,57,44,
+    194,174,233,197,128,176,190,140,97,47,79,85,186,9,188,208,44,15,42,224,97,116,216,61,22,112,164,112,24,176,221,137,254,242,139,47,149,239,244,209,184,157,125,148,59,139,97,146,24,119,
+    88,193,239,213,14,231,245,135,185,2,26,85,168,173,9,16,245,223,215,22,225,218,142,240,20,96,154,205,207,171,156,35,119,9,133,3,207,129,74,222,68,128,221,115,84,250,52,134,0,183,111,
+    79,41,28,183,86,157,81,9,3,182,133,131,57,28,27,248,144,94,241,63,184,87,1,227,105,110,6,54,190,118,6,127,240,120,36,240,191,125,225,112,224,17,19,194,128,105,58,90,124,103,140,162,
+    240,166,169,220,45,116,13,195,171,179,219,131,190,15,97,239,147,183,104,124,223,61,190,176,2,190,203,94,45,126,90,58,211,174,48,196,188,217,139,102,91,194,252,21,146,159,23,26,98,115,
+    218,117,54,63,153,150,46,135,225,18,109,19,47,111,79,171,73,91,210,100,107,187,227,219,34,170,74,239,80,194,59,99,10,95,16,225,131,230,190,13,233,69,51,176,250,22,173,51,139,135,122,
+    153,3,191,159,53,224,9,129,97,240,23,28,50,127,53,29,179,151,128,189,105,102,187,203,85,219,154,97,54,48,197,189,105,140,251,156,0,231,251,236,76,230,254,52,3,123,53,224,105,170,211,
+    88,165,159,13,8,47,90,104,249,58,49,71,135,2,230,3,205,147,173,211,114,78,18,47,111,191,108,217,50,4,14,19,14,0,155,118,248,88,116,14,159,184,168,170,247,9,91,216,244,178,216,215,2,
+    158,53,235,179,89,179,172,54,248,255,90,162,39,184,9,108,3,211,240,119,186,240,142,26,21,92,3,196,61,117,79,55,12,241,53,35,36,27,248,62,15,248,254,251,36,143,213,152,233,222,187,121,
+    136,116,151,19,208,36,35,240,211,166,33,198,250,44,192,139,230,89,247,189,69,9,171,12,30,47,55,76,52,153,28,0,230,222,22,157,112,141,219,186,101,203,218,208,34,237,13,150,184,72,31,
+    134,28,6,223,255,6,128,21,170,10,176,229,217,16,220,181,186,127,239,246,84,202,96,59,129,23,234,126,162,234,70,83,39,235,131,255,19,176,215,135,70,224,25,216,117,150,253,177,211,167,
+    71,251,34,240,255,220,69,91,156,29,223,226,158,47,175,17,65,220,23,22,220,197,98,97,233,64,251,194,197,233,143,55,93,45,106,129,153,102,158,92,149,108,205,211,199,34,230,152,236,134,
+    74,226,169,40,188,124,89,220,225,173,186,72,103,69,248,40,11,31,59,113,204,8,159,8,155,246,224,27,115,14,30,164,167,125,236,221,179,141,143,116,7,18,216,6,30,150,57,240,251,97,131,
+    36,183,64,123,125,104,0,158,49,99,36,79,95,141,146,4,110,56,42,106,143,6,182,191,181,89,248,110,61,182,177,120,153,54,146,87,213,106,153,246,48,67,36,71,88,124,109,97,14,156,170,112,
+    132,117,132,149,106,210,157,52,123,210,164,80,225,118,83,89,56,238,232,209,173,91,175,81,88,53,195,135,104,172,100,131,170,216,185,83,221,136,196,199,87,50,246,208,76,199,70,218,227,
+    110,124,77,47,139,206,231,208,56,233,131,172,166,112,72,2,171,121,202,79,12,240,12,43,116,121,14,5,126,250,105,250,169,54,1,139,140,95,155,239,205,148,215,8,223,163,133,239,10,10,223,
+    37,85,186,97,67,18,214,188,74,120,157,181,81,220,142,69,11,225,7,86,113,220,210,32,25,12,255,206,16,226,118,237,150,78,197,147,234,113,120,53,246,214,208,142,86,112,74,203,42,210,40,
+    12,192,135,60,92,126,210,135,0,91,151,198,202,76,86,250,46,31,216,239,71,95,235,64,120,240,224,15,7,59,13,240,8,199,55,20,184,97,195,81,13,35,247,89,81,106,233,225,141,83,154,179,196,
+    107,250,91,186,143,21,16,126,26,94,56,137,233,134,60,120,65,146,250,156,193,243,229,62,123,251,176,135,77,204,173,180,212,114,1,230,231,93,122,73,76,194,237,17,152,47,183,39,225,174,
+    97,235,14,90,120,107,26,206,90,170,213,67,110,99,47,56,180,118,48,239,62,190,217,187,53,182,193,233,233,233,187,214,155,22,120,129,93,165,105,178,114,136,228,112,102,190,60,9,109,214,
+    26,236,14,150,1,6,223,233,26,23,231,159,71,233,248,56,38,240,61,22,176,222,30,153,69,93,211,16,135,245,162,77,141,182,132,33,232,94,129,41,51,84,2,239,114,34,68,216,10,237,235,11,227,
+    41,216,229,75,227,126,230,20,78,139,85,164,213,234,112,90,207,94,91,183,110,57,138,194,255,61,118,140,83,21,147,117,103,84,236,147,109,31,234,60,67,58,206,67,47,10,12,227,117,71,26,
+    103,58,162,171,180,73,93,94,103,176,151,146,172,133,164,79,116,15,11,239,62,34,226,187,70,226,242,194,40,77,28,189,89,242,105,206,95,130,185,251,238,16,221,127,253,235,95,89,33,198,
+    31,102,32,28,14,252,180,1,110,200,13,231,12,73,225,93,17,177,4,176,119,57,200,115,100,99,131,155,196,124,183,8,78,103,1,240,207,38,135,149,112,139,168,41,173,45,180,240,0,194,255,253,
+    239,127,143,237,140,21,251,246,241,139,218,77,173,174,5,94,207,21,218,157,88,151,13,59,36,156,196,11,134,31,4,149,149,175,155,188,188,226,159,52,102,4,2,79,116,124,23,203,229,86,208,
+    187,26,173,3,149,27,70,2,227,215,188,62,179,184,186,255,10,70,144,245,110,55,137,141,240,93,145,194,10,184,157,110,134,87,206,159,79,89,27,208,85,31,194,159,168,60,227,243,13,0,120,
+    210,231,184,127,197,0,79,17,224,25,75,151,174,90,181,34,78,158,0,22,217,209,82,103,251,113,198,43,77,22,15,183,110,1,225,157,153,134,247,108,13,4,166,191,218,66,186,184,157,105,23,
+    170,58,205,194,195,134,12,179,133,133,217,254,149,191,12,172,46,32,18,223,73,214,8,105,134,248,142,94,181,106,180,19,13,163,246,195,210,41,208,250,138,86,233,254,43,42,34,112,149,240,
+    253,186,74,223,21,58,82,66,97,176,253,216,77,225,149,41,41,188,164,234,199,162,217,38,147,237,2,109,74,52,10,35,242,148,233,240,131,129,87,197,209,51,222,236,102,56,216,211,66,229,
+    181,241,241,169,107,123,246,20,225,45,91,54,7,132,219,239,51,207,220,162,228,197,216,204,188,248,232,156,116,245,228,20,158,113,157,19,172,210,36,204,139,254,31,126,16,17,180,31,75,
+    237,211,81,55,16,241,237,37,19,121,51,150,108,199,162,6,120,58,45,253,174,186,243,206,79,53,110,204,211,100,8,92,255,222,122,128,234,224,62,252,48,190,62,76,63,101,146,196,166,70,83,
+    95,90,53,195,81,41,12,61,119,95,120,229,202,148,245,225,194,150,175,126,128,20,36,177,237,203,73,204,119,63,77,159,1,192,171,227,126,181,133,147,35,129,49,135,123,246,236,217,139,128,
+    183,224,114,242,127,55,239,252,129,31,81,187,140,80,239,89,246,163,29,0,187,226,135,205,43,54,111,222,183,130,78,47,109,163,115,6,22,240,156,240,102,56,150,48,151,230,97,148,184,230,
+    122,169,177,134,119,226,248,73,115,230,124,110,15,144,84,89,30,29,88,226,15,243,109,136,91,227,234,89,109,238,191,68,214,141,172,10,235,209,112,128,88,233,62,77,255,87,6,110,104,132,
+    49,137,119,205,143,69,172,128,41,129,41,135,77,42,79,159,46,119,47,174,92,185,114,53,102,240,123,239,189,251,142,35,60,219,7,166,11,146,228,161,30,12,188,233,7,124,232,3,63,127,137,
+    101,119,194,59,126,200,125,142,234,200,233,74,220,224,167,129,37,145,245,136,88,70,195,99,192,142,123,201,31,124,24,146,190,131,237,141,148,230,170,146,137,32,60,110,252,248,5,224,
+    11,255,234,69,139,231,205,211,192,214,241,50,181,94,20,74,76,95,230,218,245,91,182,108,201,7,78,80,210,147,109,211,189,13,134,101,28,163,39,77,194,247,220,31,42,172,128,249,255,251,
+    49,231,240,72,5,60,31,124,83,98,165,48,19,171,10,237,246,179,212,126,210,233,139,23,219,192,239,244,239,191,181,87,47,45,76,161,239,211,161,183,90,88,158,160,102,158,175,69,200,225,
+    161,239,236,68,96,62,67,161,86,197,2,194,184,109,116,66,13,123,235,59,13,138,105,184,171,178,55,73,118,203,2,46,61,247,21,104,27,99,76,108,60,145,182,180,204,193,9,128,69,139,36,125,
+    167,218,135,67,167,201,169,95,219,56,8,220,26,124,155,194,107,75,63,107,219,180,233,46,225,18,199,30,45,17,176,47,92,220,180,193,79,115,10,127,108,117,165,241,89,232,78,43,156,174,
+    35,152,195,159,127,238,17,235,119,105,71,248,202,20,46,209,239,189,123,20,129,211,0,184,27,95,149,228,94,221,168,234,180,242,101,226,31,232,249,90,203,98,5,223,250,7,177,106,21,244,
+    217,121,166,134,255,100,75,88,18,120,129,158,178,244,14,55,56,125,102,2,102,92,136,198,58,192,86,238,102,151,107,37,240,127,56,245,83,47,244,173,41,33,105,204,157,89,4,110,25,4,238,
+    238,6,17,103,154,195,247,221,175,166,180,252,28,118,129,85,149,134,161,171,244,164,231,51,48,152,110,220,104,142,194,218,204,75,66,129,237,96,224,20,201,96,76,97,2,86,247,218,217,247,
+    114,106,227,158,150,48,61,65,109,217,178,76,125,49,240,2,94,2,158,130,87,141,153,105,114,175,45,158,41,7,161,69,56,73,11,187,155,160,159,179,116,241,137,55,141,233,22,239,46,124,249,
+    254,60,115,66,135,55,89,169,228,213,192,211,92,96,36,254,152,230,160,233,34,164,214,173,0,183,21,68,247,135,91,117,239,30,164,53,196,215,32,124,63,239,172,52,196,79,223,229,2,255,207,
+    199,50,86,18,97,2,102,78,3,156,30,4,142,193,139,192,120,191,6,3,99,141,62,76,194,201,221,186,150,70,98,27,23,55,88,183,197,125,93,61,235,181,236,217,190,39,61,58,30,99,89,22,125,151,
+    243,2,244,60,185,6,178,201,236,241,147,102,143,31,239,100,50,215,104,186,142,98,236,88,206,97,107,187,179,189,53,118,204,115,22,174,243,120,5,104,83,146,19,91,88,190,250,194,13,23,
+    152,133,13,50,45,5,203,77,102,0,12,209,188,85,247,168,232,209,195,74,226,76,26,98,107,167,135,59,109,137,111,149,238,211,86,63,139,139,52,29,242,52,194,250,42,162,116,101,172,59,210,
+    153,228,239,226,37,78,6,67,145,78,131,86,152,238,122,151,75,226,69,215,122,174,41,61,89,188,125,155,246,89,17,86,188,248,21,197,75,198,196,119,114,147,38,106,95,145,159,198,2,60,86,
+    14,57,132,69,141,146,141,234,52,170,211,152,159,85,213,169,11,252,176,175,205,76,142,111,150,108,182,37,233,59,175,64,118,234,114,60,63,184,220,190,218,74,19,243,69,102,83,219,183,
+    111,141,190,144,179,205,155,71,242,114,40,226,76,187,211,174,176,38,118,74,52,13,135,107,187,192,124,60,192,210,221,38,73,188,158,129,99,167,175,22,254,194,0,83,55,171,23,1,119,85,
+    192,246,35,152,226,133,184,89,235,214,237,49,218,180,111,159,137,240,242,229,83,5,24,124,167,182,83,188,180,195,204,10,101,108,11,143,152,48,1,82,53,68,55,169,100,201,58,16,244,172,
+    57,195,170,67,63,188,15,183,36,45,39,77,120,179,130,206,131,202,223,73,54,183,155,167,105,52,228,159,232,223,212,166,117,235,158,221,43,119,239,94,185,178,38,173,252,176,143,107,136,
+    237,36,142,48,182,183,120,168,58,173,118,117,88,161,103,165,177,70,75,6,207,183,129,233,220,30,10,39,238,70,224,37,89,6,254,198,2,38,225,181,61,21,112,139,196,38,22,111,137,18,137,
+    205,154,17,113,235,118,173,105,172,208,30,137,99,230,239,84,149,191,83,151,242,13,159,79,61,57,101,114,131,201,248,7,142,115,140,231,232,253,130,44,60,98,196,4,124,106,178,139,203,
+    129,190,165,73,183,133,77,91,89,128,241,89,141,109,90,209,183,160,220,218,61,109,217,61,255,227,252,173,156,28,182,129,219,200,99,60,93,199,30,174,239,75,28,76,236,9,135,26,123,194,
+    119,135,249,170,73,75,89,56,228,20,38,96,221,193,218,131,183,78,165,115,75,156,146,146,69,224,37,41,41,63,197,145,46,249,114,10,247,148,10,205,79,50,141,79,228,71,109,213,74,76,172,
+    87,175,94,179,102,84,164,33,48,131,49,2,194,237,157,250,12,165,89,174,234,228,229,146,41,244,100,184,68,58,54,105,19,203,110,80,58,42,75,231,221,107,140,24,227,166,46,233,150,44,137,
+    25,12,190,212,120,116,133,239,69,240,4,215,202,93,43,87,6,226,202,205,43,183,234,14,127,185,108,252,151,147,43,217,119,222,121,215,62,31,216,33,38,221,165,237,219,179,111,143,24,241,
+    146,9,157,196,15,103,66,236,231,240,221,124,142,37,8,76,194,56,11,53,207,234,101,73,250,238,193,55,63,169,86,56,37,11,21,154,132,151,164,164,35,48,9,191,141,190,58,133,85,211,75,79,
+    83,53,143,189,70,226,150,173,90,115,67,44,225,100,113,239,101,119,21,87,245,121,42,190,46,85,55,117,90,5,154,111,153,241,141,149,240,112,76,98,92,23,82,143,180,79,74,82,79,213,173,
+    65,188,165,75,39,52,73,108,209,188,185,121,174,42,86,82,14,254,154,247,150,191,92,104,97,153,186,124,185,47,12,188,75,219,47,197,63,9,190,193,73,178,31,197,75,81,186,177,132,255,21,
+    50,219,17,34,124,87,16,152,136,101,221,127,190,106,131,55,18,176,122,3,192,243,211,119,101,201,215,6,126,207,6,198,71,149,114,2,171,7,155,90,190,32,140,131,8,71,152,140,109,101,172,
+    142,152,64,75,151,46,87,151,183,218,190,234,166,168,6,120,13,73,16,120,28,94,225,200,87,111,214,168,89,195,142,154,216,254,162,111,66,98,179,230,205,177,193,109,69,184,218,23,7,172,
+    149,121,34,34,18,120,217,212,101,126,18,183,95,106,249,246,234,241,210,203,253,196,215,210,124,41,24,86,67,108,77,108,5,147,248,126,79,88,157,38,125,58,180,25,118,128,215,91,163,224,
+    61,106,168,148,165,2,173,42,180,2,126,155,66,1,247,84,192,181,66,128,155,225,56,177,181,254,34,106,227,222,189,219,123,161,158,15,214,174,157,221,195,114,30,197,234,164,177,156,117,
+    199,171,133,172,203,85,107,232,236,197,250,76,207,89,199,7,231,82,29,105,37,186,224,138,175,15,150,128,129,107,171,86,230,239,22,217,185,183,133,219,211,121,75,225,125,169,63,211,250,
+    194,42,224,99,111,134,37,177,59,65,109,35,251,199,90,236,99,196,119,123,25,92,155,186,209,116,183,171,2,222,189,81,93,251,184,199,1,206,66,15,11,251,208,63,73,137,86,192,125,94,120,
+    1,19,163,107,243,230,205,8,216,141,122,118,14,7,137,219,183,15,18,103,2,204,105,60,206,210,165,28,182,30,70,97,243,82,129,142,143,111,218,180,57,0,147,99,27,45,76,33,63,107,226,24,
+    163,55,1,198,220,69,223,222,61,183,160,47,124,139,179,221,155,253,222,124,51,84,248,77,12,79,216,203,98,187,80,7,15,61,128,111,241,128,112,109,93,163,39,43,224,20,233,99,225,169,121,
+    170,207,63,145,111,74,230,190,139,85,64,31,26,129,223,125,227,141,183,225,229,237,183,223,232,211,7,128,95,232,222,29,6,131,8,156,232,149,104,23,152,136,219,71,69,235,150,192,219,174,
+    61,12,143,120,2,193,111,129,213,13,202,138,120,220,36,205,171,239,98,117,174,176,167,225,81,233,18,0,76,188,15,55,111,35,33,192,21,42,60,244,240,195,15,193,15,154,54,142,33,188,220,
+    6,86,231,165,105,137,172,63,199,75,239,188,243,38,71,191,112,94,139,88,143,137,187,183,137,92,102,242,141,173,51,105,116,18,85,18,248,105,27,120,190,76,115,236,118,234,115,22,242,119,
+    177,137,47,40,129,247,196,189,241,6,1,191,241,34,188,188,136,192,36,220,182,25,68,124,124,189,122,65,225,250,36,44,57,108,25,183,209,63,181,105,223,14,126,180,183,158,191,58,121,178,
+    159,193,67,181,48,171,170,123,193,134,235,219,148,235,214,169,163,116,17,183,78,9,226,37,95,156,69,180,128,161,48,87,120,168,194,67,18,182,112,239,112,96,232,0,226,16,89,1,91,190,239,
+    80,40,197,55,35,120,67,146,152,166,53,53,49,184,222,27,14,124,143,236,152,190,71,93,90,122,119,109,167,151,53,217,204,100,17,176,53,215,97,124,23,47,206,138,47,37,48,3,191,136,175,
+    24,148,194,240,181,193,25,217,102,205,200,51,152,193,205,100,182,182,141,9,156,36,96,235,54,52,93,208,186,93,59,241,189,91,128,39,7,83,152,141,199,249,49,220,24,215,209,81,178,100,
+    233,18,37,74,148,126,240,193,166,205,31,126,184,121,75,235,255,13,95,212,135,156,208,57,28,58,140,51,25,188,92,207,120,241,38,6,209,125,215,38,54,144,150,238,91,111,169,247,168,136,
+    107,98,103,173,216,236,206,11,173,210,44,108,85,106,46,210,245,165,151,53,31,133,105,173,193,158,170,52,190,139,99,226,206,227,211,28,228,187,207,5,126,17,51,24,133,91,145,48,17,83,
+    153,46,17,2,220,90,37,113,32,176,128,183,67,101,147,193,147,189,78,116,173,90,227,72,88,187,106,235,225,242,168,220,186,70,184,68,157,18,152,191,15,98,60,244,112,115,149,162,226,235,
+    1,187,41,28,37,60,141,102,200,151,227,97,120,222,133,164,124,121,78,224,205,200,120,139,67,128,251,217,101,218,33,6,224,127,5,186,88,247,219,43,136,142,240,221,116,252,191,62,173,120,
+    48,112,58,174,38,185,43,13,232,75,132,49,50,87,31,214,193,2,253,211,158,159,16,248,149,87,132,87,128,149,112,211,166,245,236,36,86,190,205,120,61,205,39,110,109,249,182,226,233,16,
+    121,144,144,227,59,217,123,170,144,224,90,213,90,21,12,163,139,157,103,225,229,12,21,194,135,67,120,233,51,218,152,230,227,95,104,220,254,254,224,10,8,14,227,150,227,101,7,200,123,
+    216,240,162,176,155,168,72,233,242,138,112,63,87,88,117,246,24,216,218,215,113,159,148,102,167,39,237,27,211,93,90,245,219,162,47,0,167,174,247,86,26,164,127,21,230,27,162,139,249,
+    75,9,156,17,71,201,251,198,237,221,223,120,49,152,195,77,213,197,229,181,232,69,1,55,83,192,30,113,123,149,189,173,249,119,218,234,152,60,185,190,39,108,61,135,100,156,238,109,97,67,
+    44,227,179,120,133,92,130,198,190,226,251,224,237,74,184,141,90,169,125,40,12,216,18,110,227,79,153,219,190,203,197,151,242,247,93,19,32,249,230,91,182,112,223,55,3,230,2,140,17,38,
+    108,213,104,21,119,222,195,231,76,221,59,151,152,250,105,2,174,141,139,150,122,181,1,50,88,218,96,117,113,46,248,122,13,112,40,46,100,47,94,158,140,215,136,30,136,123,229,149,87,128,
+    245,141,87,236,12,38,97,151,184,158,229,219,76,251,182,210,253,233,54,45,37,137,91,171,223,224,89,77,37,28,9,60,156,127,106,192,51,103,181,120,126,197,14,236,91,41,223,135,116,6,123,
+    184,183,223,30,154,194,184,36,226,47,138,216,79,254,37,223,45,91,15,31,126,199,241,125,55,86,141,126,211,73,226,55,35,132,113,63,23,117,180,164,9,254,151,63,22,54,119,120,208,27,60,
+    44,83,187,94,109,240,109,75,192,56,78,82,203,133,233,161,245,121,241,226,197,225,186,148,189,202,247,16,2,115,16,112,113,109,28,33,124,151,147,192,66,44,149,185,189,202,94,138,150,
+    109,219,182,108,217,86,30,20,21,40,210,147,157,7,130,169,170,28,31,22,15,234,176,13,229,85,120,49,224,231,0,112,27,153,133,89,102,230,218,44,223,21,170,64,123,190,24,111,161,100,213,
+    10,111,197,138,48,97,69,12,192,146,196,160,123,247,93,255,178,206,134,223,23,121,129,26,124,165,218,182,197,147,159,169,48,18,158,79,188,106,254,57,37,229,139,37,139,163,67,227,126,
+    181,242,171,111,196,247,167,125,25,135,206,27,224,87,220,118,56,42,137,155,54,85,155,90,90,182,178,179,24,148,239,69,94,3,140,209,22,95,113,76,157,104,1,227,157,231,181,26,12,109,48,
+    116,248,112,91,183,86,124,98,124,76,225,135,110,127,40,44,110,87,161,243,248,97,59,133,189,9,115,55,129,55,111,217,177,117,235,209,16,223,119,223,122,235,205,183,50,13,45,204,75,79,
+    102,198,148,115,88,85,105,239,146,7,250,152,123,127,154,108,180,7,96,236,179,224,141,162,41,235,83,197,87,1,83,6,79,142,9,76,15,116,251,74,249,238,129,4,190,96,1,107,225,23,93,97,155,
+    184,105,83,11,216,38,70,229,150,118,254,50,112,61,234,140,163,112,125,87,56,27,84,105,42,212,108,219,160,22,62,174,60,62,6,112,56,174,209,101,225,8,96,40,212,238,50,23,94,51,180,98,
+    243,166,205,155,119,224,105,201,16,95,20,142,66,53,184,170,77,238,215,151,23,36,12,48,9,255,139,132,239,191,223,91,115,8,17,190,155,143,65,213,171,15,53,15,58,166,75,161,70,167,200,
+    14,29,233,95,165,124,65,25,220,192,86,109,80,235,11,214,93,169,116,233,198,70,241,165,10,125,49,20,216,23,214,253,105,207,215,46,212,148,199,42,119,37,127,1,24,254,3,17,78,116,138,
+    180,234,76,235,218,156,24,159,120,103,9,159,184,105,83,120,141,111,106,229,174,219,216,222,238,2,223,110,82,216,3,166,105,173,246,86,2,175,88,186,98,51,196,142,29,184,39,28,132,223,
+    246,120,223,148,126,86,8,112,48,135,161,19,214,55,60,135,205,225,255,144,107,90,236,171,90,148,48,54,106,8,188,84,1,175,150,167,18,80,134,70,215,102,186,233,141,238,107,252,198,84,
+    232,125,7,46,24,224,23,157,16,225,238,221,219,180,226,1,19,68,144,55,96,172,107,115,171,230,242,187,77,163,132,77,68,212,230,166,42,194,19,150,168,111,15,70,52,176,10,217,234,185,90,
+    124,195,83,24,123,204,21,222,202,74,216,192,178,106,41,73,12,25,204,163,37,55,129,185,100,23,191,91,210,88,61,164,133,132,239,109,89,191,45,183,194,243,249,73,129,171,87,167,255,100,
+    132,195,251,84,116,85,227,244,25,120,85,148,121,18,14,250,102,40,224,23,61,222,23,189,174,86,243,166,86,196,38,198,95,218,191,23,1,60,217,90,109,72,12,169,205,144,186,242,191,107,110,
+    165,107,168,232,53,1,247,38,224,165,232,187,109,155,246,61,250,78,84,133,126,51,235,194,108,108,3,63,108,175,58,216,213,89,135,57,36,174,142,170,214,83,221,172,165,252,160,65,124,28,
+    144,201,224,47,248,129,154,14,173,196,12,42,209,46,48,181,193,175,190,250,202,43,17,186,186,74,183,18,169,0,113,61,151,216,177,109,222,188,153,5,236,9,199,194,181,211,23,167,173,194,
+    90,219,76,133,35,129,123,247,134,1,240,166,205,171,241,185,50,26,216,215,125,231,221,55,179,100,27,44,211,149,3,194,247,227,234,97,128,86,3,171,187,4,238,226,199,241,16,112,91,2,166,
+    135,28,173,78,249,70,61,155,142,175,218,164,59,161,44,88,14,245,57,95,121,37,26,218,96,4,142,76,96,73,97,42,210,45,35,51,88,136,189,143,52,107,142,174,248,95,148,168,103,132,19,19,
+    27,112,19,92,191,65,131,250,245,73,24,126,11,77,235,213,99,88,195,139,203,10,215,202,43,194,145,37,26,134,76,232,187,141,125,163,128,223,204,186,174,157,195,86,145,174,236,174,46,221,
+    31,190,233,210,222,47,77,57,76,79,210,106,219,14,47,66,90,197,79,13,252,102,205,87,223,40,222,136,248,202,226,93,179,230,107,59,133,207,111,2,224,44,8,219,25,28,14,220,178,57,11,75,
+    219,11,63,145,111,51,110,188,117,14,83,22,171,236,173,207,51,39,137,205,56,154,198,219,45,1,226,254,29,94,1,126,56,8,220,187,125,123,125,42,67,61,23,234,120,120,19,252,206,91,111,253,
+    45,97,171,171,229,30,83,187,47,86,254,90,71,90,16,184,62,2,207,91,42,79,42,195,71,62,17,240,87,43,191,212,55,230,6,105,191,210,79,29,209,196,84,163,247,35,112,72,145,182,132,187,183,
+    233,14,173,176,93,162,217,217,147,134,116,115,126,137,31,104,214,172,173,124,182,37,140,178,42,117,117,120,127,56,226,198,2,46,8,113,141,192,109,218,244,54,190,91,212,163,221,142,171,
+    78,150,99,252,206,59,111,189,245,55,114,88,101,49,205,120,240,218,67,204,61,181,222,217,210,226,252,84,75,28,11,227,14,9,22,182,252,190,208,207,17,253,226,43,47,214,124,179,198,9,123,
+    38,139,51,216,23,126,225,65,37,140,127,219,86,128,213,52,50,44,224,230,245,138,183,106,218,18,63,25,127,221,188,101,219,59,155,54,183,133,141,49,190,43,182,62,47,46,8,98,60,28,58,216,
+    69,219,220,5,57,174,1,184,119,239,54,189,141,239,22,245,240,205,163,6,88,45,37,241,122,225,53,2,191,165,38,167,251,246,235,225,174,31,70,250,222,123,95,224,240,176,2,174,143,187,103,
+    151,206,88,181,114,213,154,53,56,2,138,25,232,57,99,138,39,252,245,42,126,148,100,70,134,100,176,15,220,189,132,5,220,170,85,48,129,189,104,134,77,110,115,86,109,138,175,77,57,131,
+    235,233,239,12,146,108,38,206,205,76,246,242,232,75,55,186,205,153,215,154,104,14,230,110,110,142,124,72,92,48,54,176,105,121,149,111,111,94,222,223,190,125,155,60,246,11,7,194,135,
+    149,48,255,148,149,30,180,251,187,125,223,122,211,155,213,114,133,195,128,3,199,255,85,6,55,224,253,209,51,102,204,88,9,229,24,31,68,160,158,210,190,38,164,32,83,124,177,102,77,32,
+    135,185,31,29,247,90,120,35,252,198,11,221,117,2,163,112,243,204,132,41,72,8,165,90,146,22,125,196,249,164,166,205,188,16,85,21,129,21,34,31,87,233,114,152,52,206,231,10,59,25,220,
+    219,137,45,2,172,30,190,137,190,32,172,140,13,241,181,244,180,20,240,155,47,139,176,217,200,19,145,194,248,80,52,255,22,173,226,197,159,66,97,188,12,30,143,112,131,48,228,239,23,95,
+    50,240,181,133,110,132,227,94,253,17,126,56,192,47,216,209,61,243,18,237,24,43,97,172,215,240,10,35,37,71,24,126,19,144,155,202,55,66,179,150,252,30,21,120,229,27,62,175,81,80,233,
+    230,204,157,59,96,92,176,96,62,79,216,90,110,232,29,230,139,151,65,41,98,22,118,129,223,121,235,90,137,173,50,157,37,97,6,246,206,133,63,245,84,173,90,248,88,248,145,147,71,78,161,
+    11,70,190,152,49,18,187,84,51,102,216,116,89,4,198,26,125,168,62,100,48,158,223,126,37,12,87,120,179,232,171,178,184,25,125,118,243,230,220,42,55,115,139,187,147,174,205,155,222,219,
+    156,186,221,74,215,159,103,54,196,193,228,181,141,115,23,204,7,17,1,220,38,204,23,31,203,184,157,222,32,241,225,35,135,251,251,198,127,67,184,47,230,177,218,198,147,153,48,1,23,15,
+    0,63,245,20,1,143,20,224,25,171,102,112,159,217,200,213,154,252,77,86,51,24,83,56,142,206,231,191,250,99,8,176,62,128,165,128,221,53,135,152,133,26,187,94,186,95,77,13,115,24,112,243,
+    166,205,205,89,235,24,43,9,49,112,149,113,190,124,182,177,35,252,194,11,210,187,234,173,110,144,225,26,45,143,176,7,228,195,71,122,85,56,2,192,71,142,176,241,91,194,251,22,173,38,100,
+    210,252,6,23,151,220,29,181,1,224,187,21,240,221,161,192,79,225,32,242,89,20,70,96,253,184,9,211,220,186,237,237,55,89,2,254,177,79,159,96,254,106,96,41,187,245,226,235,133,69,56,177,
+    55,94,230,239,16,54,197,100,149,87,144,15,219,153,113,187,87,157,61,205,236,28,1,101,13,140,91,44,31,214,188,24,224,219,167,143,220,1,5,193,192,34,188,125,251,17,8,226,181,106,181,
+    114,204,114,14,155,253,30,78,14,135,8,75,23,203,107,129,159,124,242,201,167,4,120,40,94,96,73,151,124,173,90,181,106,205,215,95,127,29,221,10,127,51,227,139,240,143,175,225,185,44,
+    3,220,135,119,69,135,0,183,210,192,86,212,139,143,15,87,54,189,173,192,56,25,139,112,243,135,154,243,122,189,123,69,66,212,10,96,238,64,246,102,183,35,32,156,79,11,87,168,220,221,248,
+    190,208,167,207,38,0,222,170,2,156,183,239,72,75,219,97,1,115,48,241,225,35,239,188,117,4,11,238,91,178,117,231,45,157,209,49,186,211,102,147,79,191,80,224,127,5,39,161,45,96,240,229,
+    4,70,97,0,30,53,146,106,52,8,127,141,17,89,139,191,248,34,86,27,12,192,59,119,106,225,144,228,85,9,76,9,24,177,92,27,239,25,107,98,158,214,162,73,106,26,214,54,101,200,7,173,253,173,
+    8,93,1,119,173,135,15,138,242,229,118,120,179,7,35,60,135,43,64,84,166,175,174,250,23,109,234,195,201,219,159,129,225,85,112,55,110,132,151,180,180,35,71,210,108,225,195,253,169,75,
+    252,50,55,195,246,126,157,55,185,169,125,211,73,110,123,141,88,170,180,51,86,242,128,205,243,178,28,96,149,194,67,135,66,2,143,26,53,138,51,152,129,65,120,149,143,56,37,122,148,100,
+    149,232,157,44,236,165,176,15,28,131,87,140,227,133,184,158,238,79,211,162,33,239,6,192,12,166,131,7,192,251,224,67,36,240,208,67,21,42,224,126,245,10,145,67,94,191,241,205,30,30,161,
+    57,140,192,116,214,144,243,247,133,23,182,154,244,149,176,129,129,216,74,98,84,222,250,242,203,128,246,50,196,155,246,202,126,216,214,172,192,124,22,111,167,85,205,48,21,43,39,127,
+    237,7,118,132,2,63,59,114,40,0,79,119,128,191,14,2,235,248,233,201,64,199,235,155,111,240,118,50,2,182,106,116,239,222,97,73,44,25,28,159,89,88,89,172,132,101,235,101,43,233,73,89,
+    136,156,179,21,240,196,73,148,110,190,124,185,115,103,202,235,35,91,194,21,248,156,254,11,47,244,232,255,194,11,253,251,83,238,130,28,188,161,247,118,104,97,142,52,99,124,228,8,124,
+    194,203,33,65,105,253,230,155,122,211,165,95,181,157,253,150,118,79,218,74,96,107,27,150,239,251,164,36,240,80,244,29,53,106,244,232,79,87,25,225,47,167,196,46,202,177,59,89,44,108,
+    3,27,226,172,2,199,91,133,218,217,92,75,111,41,129,43,84,80,122,21,136,192,132,95,154,241,53,115,222,127,94,23,36,46,152,175,160,149,195,188,149,134,142,165,32,47,230,166,40,31,222,
+    238,9,3,49,86,106,142,35,105,47,103,30,111,81,154,7,202,184,228,176,46,210,173,164,70,243,70,142,123,239,13,73,224,39,77,6,147,175,0,219,194,107,234,125,19,89,144,163,129,51,20,240,
+    15,63,64,63,100,83,239,176,28,110,149,85,96,39,139,165,147,37,235,196,8,236,58,58,194,126,242,230,206,125,123,238,216,190,255,252,231,63,35,146,88,102,183,224,15,69,97,57,187,77,192,
+    135,173,128,52,222,130,57,188,215,248,42,100,137,95,12,100,183,206,221,236,120,185,155,101,28,198,251,166,57,63,46,51,129,173,24,152,30,7,126,175,245,68,82,55,129,21,240,179,26,152,
+    139,52,11,7,7,68,43,87,197,156,232,88,77,192,59,181,48,222,94,103,146,184,123,247,191,3,108,9,55,195,94,86,43,181,23,0,15,119,250,146,225,192,249,2,147,26,190,172,21,65,97,250,175,
+    139,22,229,26,93,185,178,28,205,247,120,33,118,28,222,129,227,164,189,219,183,135,3,175,205,217,43,141,179,184,91,104,4,107,119,96,67,60,10,227,9,117,218,43,206,187,44,157,93,178,94,
+    133,126,202,20,104,13,60,154,58,210,244,216,182,144,145,18,166,242,170,152,51,89,118,6,35,48,37,113,196,68,71,124,150,133,235,89,194,120,146,23,116,195,128,253,12,134,210,90,80,69,
+    148,239,63,253,200,158,253,250,236,252,106,1,23,45,90,180,216,237,197,42,84,168,90,181,90,181,30,61,250,177,176,231,203,129,192,138,152,15,212,111,224,216,216,53,174,235,134,180,13,
+    209,192,161,206,47,99,207,27,2,116,225,109,175,94,61,123,224,29,4,173,232,122,181,123,233,14,91,43,252,10,173,129,159,117,129,103,172,242,231,58,178,62,85,169,129,233,90,66,22,238,
+    19,90,163,179,12,108,37,177,5,252,112,229,202,126,170,86,240,51,184,96,40,111,238,88,188,24,215,75,228,200,145,35,247,141,185,115,223,196,192,69,201,23,133,251,246,227,10,221,223,3,
+    62,202,194,219,183,65,26,43,97,142,212,212,13,27,214,166,254,2,204,107,215,126,143,138,27,190,207,58,177,9,188,148,10,239,75,160,13,167,116,197,169,199,235,204,98,153,30,22,22,232,
+    103,29,96,78,225,107,94,107,192,62,150,3,44,85,154,133,187,255,109,96,45,76,211,29,216,2,63,140,91,28,108,96,0,184,61,119,49,140,10,85,43,20,43,134,31,192,143,101,146,191,34,122,93,
+    40,48,248,230,184,49,247,141,55,222,116,19,3,23,133,63,156,132,251,246,11,19,222,161,99,219,182,237,123,241,161,123,228,187,97,131,24,3,238,134,84,36,254,254,251,110,223,39,116,114,
+    77,159,15,135,118,173,241,99,4,220,19,134,17,109,219,182,172,87,207,208,250,207,234,120,242,41,206,224,161,210,195,34,95,190,4,57,102,141,134,152,17,3,216,43,209,74,120,147,238,78,
+    171,203,192,154,55,189,38,96,37,172,102,156,53,47,250,162,106,81,174,161,66,80,76,125,40,12,56,123,102,9,172,132,9,248,70,4,190,233,38,23,56,76,24,87,249,143,27,97,2,70,98,42,207,8,
+    205,206,107,191,197,248,190,83,55,76,225,111,145,12,126,217,45,179,154,221,77,23,118,185,97,157,14,240,128,112,61,245,164,202,226,119,57,190,79,169,24,58,244,41,124,222,157,73,224,
+    172,212,232,149,43,175,1,88,136,85,83,172,128,237,153,142,18,89,33,118,150,22,44,224,98,70,179,152,14,120,191,168,132,47,156,5,95,43,133,21,176,18,126,68,9,191,228,11,211,62,142,227,
+    199,85,149,222,38,194,186,78,147,243,174,93,187,214,147,240,6,97,253,150,126,134,151,231,117,68,49,27,222,228,185,115,91,180,104,155,88,191,126,125,200,225,144,103,236,56,190,67,241,
+    89,89,242,228,144,209,163,179,148,194,107,86,134,102,240,234,159,194,51,24,127,112,26,191,208,91,9,87,110,126,141,53,90,9,43,224,10,10,184,130,230,197,184,3,163,168,19,49,124,51,7,
+    190,241,70,59,133,241,127,69,194,125,251,246,117,129,143,18,240,14,3,188,157,142,89,211,157,69,27,55,166,235,182,152,174,108,134,183,235,190,149,48,194,221,158,255,246,249,231,29,102,
+    149,216,223,67,77,239,246,61,125,122,242,183,201,201,252,52,42,188,180,168,65,61,73,225,72,96,241,85,192,89,78,97,59,100,187,135,6,222,103,183,193,155,217,214,73,98,107,185,48,254,
+    218,162,169,218,225,129,249,75,192,85,177,189,213,178,18,69,93,227,204,10,244,117,49,128,243,88,25,140,127,52,0,131,240,163,85,171,250,53,250,168,212,104,13,188,157,111,130,220,168,
+    174,209,55,190,230,121,69,223,126,107,59,227,171,1,214,133,27,117,225,13,127,94,50,8,199,207,159,155,72,192,13,26,64,6,131,98,140,12,102,94,105,127,3,192,153,117,179,236,125,90,41,
+    10,56,35,195,5,166,10,173,235,180,78,225,191,145,193,24,196,219,169,83,167,202,38,123,139,57,184,22,179,242,69,158,220,255,215,10,125,147,252,169,32,252,232,163,143,22,171,80,93,165,
+    176,93,160,77,43,76,35,37,34,94,63,119,227,46,139,56,240,88,170,111,179,20,236,75,159,158,60,123,209,108,188,107,27,129,27,52,32,198,40,223,103,159,181,125,77,204,200,180,70,59,184,
+    43,229,128,3,2,239,217,147,177,223,2,198,103,48,16,238,230,205,156,197,124,169,18,110,155,253,27,192,165,75,199,243,77,191,157,58,87,168,4,81,181,216,35,8,124,199,29,145,194,144,119,
+    204,115,211,223,170,208,121,242,88,192,69,21,48,10,87,175,238,13,149,142,6,133,183,109,219,38,117,122,253,46,39,139,215,239,138,200,227,232,216,64,186,242,148,178,217,64,60,101,46,
+    109,6,31,42,148,108,26,131,55,32,28,27,216,206,221,111,246,32,50,30,122,89,141,192,251,55,57,25,188,153,95,219,244,150,1,83,27,218,22,125,237,192,9,165,19,74,151,46,205,188,21,43,34,
+    111,165,71,30,33,223,40,224,162,55,221,113,147,142,76,125,161,78,95,167,107,245,245,255,12,84,104,5,140,194,85,29,97,47,133,143,170,177,146,17,230,182,24,97,215,175,183,27,227,13,89,
+    33,134,6,152,250,225,235,214,65,203,189,107,157,122,190,32,29,214,169,5,77,236,83,17,241,244,179,209,192,159,126,186,10,231,43,163,91,97,157,187,184,81,126,202,157,41,180,95,30,129,
+    183,237,217,190,99,135,11,188,153,202,116,239,222,155,89,24,91,97,72,224,54,221,179,208,8,243,25,237,248,210,42,232,202,95,224,37,224,71,30,97,224,8,94,40,169,134,23,148,66,231,159,
+    197,214,14,39,139,45,97,253,7,23,227,28,174,86,157,198,74,86,55,58,32,12,198,32,140,196,22,179,213,221,90,159,44,153,252,109,80,184,19,201,98,124,43,188,242,136,50,253,240,42,20,190,
+    115,104,148,240,211,65,95,27,120,21,79,71,175,10,79,225,149,119,105,93,148,157,87,34,101,37,31,91,147,211,87,113,86,31,26,15,204,74,153,230,118,152,214,30,240,174,177,76,83,88,223,
+    178,160,116,19,18,42,86,44,95,145,124,171,84,121,68,128,141,168,9,239,151,55,113,87,56,166,239,63,56,92,103,37,236,0,83,145,198,174,116,117,30,43,189,100,47,43,209,116,180,43,188,109,
+    183,19,150,241,198,174,106,240,180,97,221,6,244,164,182,246,123,43,54,64,242,118,34,97,85,227,119,153,167,71,82,14,71,8,27,94,227,107,151,104,123,205,240,235,96,246,174,52,188,40,252,
+    211,74,62,181,150,190,45,20,216,12,135,117,10,103,14,108,211,10,112,233,210,229,117,60,82,14,126,32,176,73,216,155,34,67,124,179,103,207,17,0,22,206,127,4,130,137,163,132,169,43,141,
+    163,97,76,226,126,106,185,191,23,175,10,111,221,186,195,10,44,212,114,109,175,186,189,104,189,50,182,6,200,153,132,201,122,235,241,160,147,63,250,104,228,208,80,225,167,159,85,25,60,
+    42,212,215,1,134,222,211,215,129,234,188,210,142,121,22,240,246,237,59,182,196,89,131,96,11,216,26,41,117,199,211,103,225,192,230,122,148,7,241,30,28,3,172,113,203,73,20,179,124,239,
+    80,142,240,19,190,103,203,98,228,184,49,119,142,176,252,213,188,113,28,65,98,18,118,128,205,104,184,26,18,247,237,219,75,71,255,173,180,106,196,59,104,57,246,82,119,107,143,101,76,
+    183,24,173,79,181,170,117,12,217,84,249,78,208,159,189,203,21,150,27,103,176,75,21,90,160,195,125,117,141,86,194,102,99,116,8,239,60,186,202,52,37,21,98,219,150,45,91,118,244,140,5,
+    220,71,165,112,155,0,240,131,33,225,241,150,211,241,8,0,7,121,111,212,243,18,150,45,6,164,98,216,242,175,242,141,179,194,0,95,167,129,111,100,224,155,212,48,219,18,238,209,163,111,
+    143,94,86,244,236,214,171,23,41,111,223,134,245,25,210,119,239,94,33,118,19,89,181,201,27,163,140,83,205,253,206,118,227,189,75,223,27,58,105,210,71,90,120,232,147,119,178,240,179,
+    166,247,252,236,168,208,6,56,44,133,53,177,227,59,111,229,60,21,243,231,207,71,224,84,218,69,26,103,77,83,58,37,218,164,176,7,28,194,106,11,139,174,229,139,113,71,148,175,161,197,142,
+    82,118,120,161,181,191,96,239,217,207,95,71,153,90,226,235,109,224,220,55,153,1,24,148,143,42,85,170,86,234,12,81,173,27,9,211,164,4,252,178,43,77,40,166,174,77,5,228,109,76,12,178,
+    80,219,224,167,189,28,123,2,200,16,169,235,131,97,175,42,167,175,167,31,114,181,21,63,105,14,155,97,149,195,79,62,107,100,253,222,115,192,23,251,209,166,17,86,39,248,191,246,124,77,
+    36,207,103,97,122,24,240,214,56,107,26,218,6,254,193,6,166,169,142,166,81,153,107,112,203,149,43,239,103,111,185,34,69,10,187,61,230,155,66,112,81,55,116,21,255,159,153,251,198,57,
+    25,172,106,180,170,211,69,113,132,141,194,143,84,233,92,173,51,133,232,118,234,212,177,34,118,244,187,117,195,7,111,166,49,177,244,161,183,237,214,192,190,51,3,110,140,12,236,168,81,
+    103,77,221,29,74,194,240,58,125,250,228,145,35,185,29,126,246,89,153,148,204,164,56,59,192,110,10,67,18,27,94,11,55,25,159,80,39,192,105,4,108,72,127,216,28,76,97,0,198,43,123,121,
+    54,218,17,205,231,4,232,230,203,87,206,139,50,69,40,10,115,68,228,111,30,74,93,49,52,194,255,116,42,179,233,95,133,250,10,112,174,235,243,168,94,22,182,238,228,91,152,38,201,176,47,
+    93,165,82,231,74,157,117,116,234,84,190,124,66,66,249,78,157,233,233,60,201,107,215,166,97,22,111,228,75,169,232,10,110,98,229,176,160,183,123,59,64,52,171,21,88,5,246,236,150,231,
+    233,170,75,83,32,135,167,79,31,137,49,244,217,136,236,213,57,204,207,75,197,249,202,200,26,253,205,55,43,87,250,190,201,230,81,177,107,215,174,197,74,149,102,3,11,239,78,75,184,143,
+    8,99,47,250,225,72,92,9,159,183,156,173,139,192,55,221,228,1,231,201,163,115,151,179,83,13,122,178,255,243,159,110,207,217,244,158,99,37,112,46,221,139,214,3,48,252,31,23,45,92,148,
+    250,210,85,96,64,94,17,95,42,66,230,118,44,79,189,253,242,152,196,80,168,147,233,9,246,105,27,215,35,46,25,237,221,145,177,127,135,38,54,200,219,173,216,155,154,234,252,122,251,142,
+    189,219,247,170,111,140,159,128,216,220,31,74,143,35,135,24,5,194,174,174,15,236,115,143,86,91,179,124,224,41,83,82,108,95,122,46,112,139,174,46,112,255,254,1,224,226,155,124,96,218,
+    220,219,252,161,88,184,249,10,150,11,247,181,128,11,23,118,58,203,130,43,185,107,141,108,17,248,186,127,102,183,167,53,254,17,195,87,3,231,186,62,87,246,28,150,47,9,23,165,255,113,
+    209,98,229,138,225,95,9,26,15,28,153,99,35,82,186,100,73,238,49,116,236,212,153,129,83,73,152,147,17,61,119,28,60,184,127,63,97,237,245,195,54,221,166,78,56,237,0,221,237,199,45,96,
+    8,16,54,87,31,205,96,225,81,163,70,58,185,251,236,168,81,207,102,14,140,196,107,28,96,204,97,143,119,174,122,0,28,252,123,184,27,249,210,75,113,102,138,131,203,115,155,77,110,141,166,
+    233,232,202,21,42,68,243,22,44,88,184,96,193,34,100,42,165,25,95,138,88,192,55,210,155,27,161,110,122,157,42,110,120,237,225,206,117,170,68,251,211,26,81,190,10,56,87,46,234,99,185,
+    51,40,42,135,139,22,149,239,58,238,34,148,46,77,143,128,192,12,46,143,147,229,208,44,99,119,26,58,37,72,188,109,219,222,189,251,33,16,56,35,99,175,100,239,14,0,7,67,126,119,135,57,
+    215,180,93,143,162,225,179,241,191,131,79,200,216,183,237,39,38,78,215,23,32,209,243,110,69,216,137,167,71,101,158,193,106,62,218,17,78,49,190,184,38,105,63,39,172,27,254,131,122,245,
+    232,209,171,95,191,56,229,187,73,128,255,107,55,194,178,98,136,203,65,14,175,218,99,158,79,37,103,17,21,38,119,5,184,80,33,120,185,241,198,194,126,199,74,233,94,231,12,103,173,233,
+    199,32,111,168,111,28,141,130,175,187,46,87,46,234,98,221,228,11,23,214,194,69,228,251,175,28,243,162,112,121,11,184,23,61,190,126,59,223,206,114,252,224,65,244,21,96,42,209,4,142,
+    124,59,142,211,239,98,168,119,246,83,28,220,47,239,236,207,128,79,100,225,111,4,248,75,131,60,234,154,98,180,108,159,229,53,67,11,152,175,71,75,153,207,233,235,62,227,15,59,146,252,
+    248,39,202,96,162,221,68,190,189,189,110,52,45,40,225,130,238,237,183,43,95,107,185,86,112,11,99,162,26,97,219,183,16,69,158,66,55,230,129,183,188,222,99,186,86,94,250,58,190,129,89,
+    171,184,136,160,255,48,27,77,100,185,190,106,32,44,194,244,93,88,6,163,100,201,91,110,49,192,21,43,138,47,244,72,176,215,201,217,40,112,25,16,251,246,177,112,134,114,20,205,144,200,
+    200,56,207,239,28,0,227,125,12,252,205,55,250,138,43,6,190,70,97,11,216,17,198,43,180,208,119,190,235,11,61,70,238,69,226,166,108,220,234,16,167,86,9,127,176,199,72,170,13,238,211,
+    135,10,116,101,220,77,229,235,230,205,123,99,94,192,43,92,56,39,17,135,69,97,210,133,200,145,135,195,110,129,69,216,159,142,210,188,153,231,174,213,135,206,6,195,103,53,141,101,1,223,
+    84,216,9,20,70,94,10,6,174,136,192,248,229,160,46,39,77,93,30,167,208,185,9,194,20,25,7,14,30,66,57,174,221,242,150,62,231,208,33,120,193,56,79,33,192,240,223,253,228,11,127,161,30,
+    59,63,154,151,244,179,36,236,46,10,11,240,234,213,248,76,117,28,241,218,190,178,62,139,81,153,103,238,250,197,109,246,97,157,20,86,45,48,3,107,220,156,57,243,2,87,222,188,148,159,78,
+    137,46,226,229,111,30,252,196,60,217,175,247,133,193,152,133,189,230,87,120,255,145,117,94,242,205,150,93,22,132,93,225,155,238,112,125,139,220,162,3,124,203,148,67,224,74,228,219,
+    173,71,175,254,124,168,101,199,22,34,62,166,210,18,170,114,6,197,129,3,136,200,111,249,61,9,77,43,192,244,123,8,204,194,171,173,217,197,47,191,132,238,176,24,35,179,12,132,178,210,
+    143,86,27,119,190,54,190,4,156,60,215,243,101,224,206,50,55,27,23,233,251,131,85,160,29,223,156,185,176,189,163,164,204,155,55,15,18,23,137,242,205,75,188,121,104,6,50,135,7,44,205,
+    112,48,127,179,154,188,86,254,170,4,182,129,113,77,163,176,84,104,37,156,247,22,248,187,231,186,85,249,98,167,75,1,227,83,207,14,247,232,117,248,240,209,45,71,143,81,28,87,190,220,
+    231,130,108,61,239,132,118,62,132,41,172,62,122,225,2,125,240,208,161,12,149,195,148,197,17,194,58,178,214,143,166,20,102,94,229,59,95,251,118,242,124,65,184,66,229,88,25,204,27,164,
+    165,64,227,69,39,156,187,57,115,228,98,176,92,156,148,17,194,133,144,55,47,38,48,208,230,144,61,23,34,156,71,11,115,145,190,206,6,182,125,227,98,135,106,184,25,216,23,38,101,219,55,
+    111,94,208,189,225,134,27,224,237,45,212,26,211,184,137,103,63,122,208,99,207,182,202,82,49,11,31,59,232,54,187,1,98,200,86,105,116,207,31,36,91,14,252,141,140,205,135,14,24,225,159,
+    204,20,242,215,188,116,176,10,31,72,126,205,194,0,12,37,154,124,211,211,211,83,57,129,61,223,78,252,47,34,96,204,96,25,21,109,142,242,149,2,45,123,225,114,230,204,14,192,185,84,66,
+    230,201,149,55,87,184,48,241,230,207,159,31,190,11,114,92,159,43,135,172,200,187,57,156,67,205,79,186,192,138,54,83,95,61,11,141,227,170,28,57,156,77,59,20,133,85,27,92,136,129,65,
+    54,27,0,67,9,202,91,164,72,62,234,84,151,175,84,137,82,152,183,124,232,253,0,59,118,28,229,20,182,125,15,236,63,232,233,10,47,100,171,100,175,6,222,47,192,90,152,140,87,67,31,201,2,
+    118,141,179,148,194,95,127,189,230,235,213,63,25,224,100,126,160,183,241,173,200,255,160,106,28,213,171,35,240,230,144,44,86,39,28,84,2,231,203,167,124,37,127,115,100,199,175,104,46,
+    206,96,20,46,228,167,111,254,92,12,156,39,135,204,105,224,198,184,144,86,216,5,142,152,144,140,145,191,12,44,19,209,60,212,22,94,203,183,16,39,112,182,108,32,156,43,103,174,91,16,152,
+    132,43,85,122,176,98,53,218,59,221,143,133,121,223,199,81,236,108,29,59,134,163,91,26,45,101,224,27,72,225,67,232,7,136,23,79,216,101,122,255,254,11,240,193,243,23,206,159,128,223,
+    185,200,202,170,29,118,178,24,100,148,241,167,159,122,198,177,82,120,148,12,133,113,201,255,27,149,192,6,184,132,241,173,200,194,6,216,222,172,179,217,241,237,109,231,111,65,217,69,
+    147,51,123,174,236,57,80,234,250,108,146,196,34,108,103,49,167,111,54,0,206,155,159,27,97,217,24,119,125,158,28,118,43,172,151,24,172,1,82,22,124,255,225,116,176,100,106,228,122,157,
+    194,178,10,169,43,51,117,3,233,91,142,128,179,97,51,140,41,92,88,128,165,150,245,123,73,30,94,200,39,197,205,126,158,253,251,119,112,47,139,128,79,160,222,126,0,62,164,42,50,0,235,
+    119,48,46,92,148,247,15,92,56,32,93,240,159,76,160,206,170,85,43,64,120,249,167,158,113,214,166,43,191,17,224,84,4,102,95,83,160,43,42,224,206,226,91,53,142,88,9,216,89,74,82,83,28,
+    149,43,88,87,41,208,4,177,36,112,142,60,62,48,11,23,66,222,252,24,185,110,67,97,203,215,108,156,242,38,59,44,96,76,224,184,44,39,176,2,206,30,0,190,241,70,229,123,99,30,238,236,195,
+    247,28,249,10,112,110,1,126,164,138,8,83,141,230,199,216,245,151,109,31,246,134,30,2,230,97,209,249,11,26,215,11,213,183,62,116,104,51,190,95,34,67,9,91,196,171,9,121,197,138,85,43,
+    86,44,95,158,37,97,103,73,105,213,106,168,208,63,165,91,192,201,218,183,99,69,1,174,212,89,37,112,181,56,53,11,109,9,111,178,125,43,120,190,217,65,37,215,245,166,77,117,128,249,231,
+    2,12,156,95,249,170,105,103,95,88,207,69,255,83,239,146,188,182,2,253,143,235,172,18,237,11,43,94,232,234,231,45,36,9,108,101,48,254,102,65,220,106,82,169,10,239,246,120,233,37,62,
+    104,218,175,111,63,232,112,165,241,101,60,246,134,158,29,102,130,195,84,103,69,123,241,34,151,102,42,204,25,251,14,28,130,239,130,67,155,17,91,17,91,1,204,43,36,92,226,152,194,12,76,
+    61,172,159,182,161,111,114,242,124,244,77,40,29,244,213,192,213,227,212,102,89,155,87,246,234,116,239,110,215,103,157,192,185,114,56,190,2,44,131,98,201,21,168,208,216,6,195,7,89,56,
+    143,37,124,99,14,103,62,218,217,15,27,2,28,177,66,232,76,125,101,247,133,241,103,156,2,199,247,120,60,71,25,140,194,185,52,112,193,162,197,120,29,241,246,106,124,6,17,108,49,149,123,
+    244,232,215,235,165,94,91,123,84,246,132,161,86,59,179,88,106,64,204,188,36,172,135,192,25,7,176,68,83,62,103,132,16,99,120,196,145,194,246,170,48,251,10,112,215,100,74,224,210,210,
+    2,179,175,155,192,0,108,119,175,54,155,99,43,129,246,87,249,90,199,113,101,40,172,195,2,230,62,180,12,131,57,137,195,82,216,90,113,48,35,164,128,101,20,176,231,43,223,116,214,64,140,
+    18,152,154,18,250,27,229,210,145,55,47,242,210,86,177,71,30,169,90,48,103,95,158,20,80,129,211,124,189,212,236,37,221,107,105,69,134,8,243,91,13,124,129,187,87,192,186,111,31,169,74,
+    173,62,32,198,25,145,196,203,99,149,105,179,232,255,169,170,208,180,35,22,11,244,218,100,105,130,65,55,161,98,71,222,197,90,41,0,28,216,197,177,169,55,79,96,121,249,139,192,57,178,
+    95,127,253,245,54,113,222,60,60,26,130,132,85,194,138,27,125,13,112,30,11,56,143,211,143,166,208,139,251,255,8,223,117,21,6,108,58,88,6,216,155,75,33,223,92,185,114,242,223,200,248,
+    242,26,34,175,18,87,169,90,245,77,248,66,244,173,94,77,69,95,107,247,22,17,239,112,247,94,74,22,235,68,214,61,103,248,201,158,225,178,137,15,100,28,224,142,154,194,221,108,136,85,83,
+    236,119,167,221,93,29,44,204,25,188,58,157,27,96,18,166,244,45,93,218,2,38,223,234,85,43,16,112,128,87,109,211,225,230,215,76,96,153,47,163,10,24,15,243,23,12,123,83,232,169,129,243,
+    231,229,15,228,117,114,216,204,105,169,169,14,149,195,215,155,213,253,136,109,117,246,71,255,225,245,175,232,47,150,93,141,195,242,184,192,57,114,80,198,42,96,120,11,127,79,4,46,198,
+    233,43,39,76,161,191,169,130,167,8,84,18,247,146,187,45,121,137,16,223,182,241,87,28,206,27,96,20,6,204,253,97,196,86,100,184,73,188,108,121,96,80,28,216,181,195,192,43,86,203,44,22,
+    0,139,175,52,192,21,203,251,9,92,181,154,3,188,201,248,246,198,93,88,228,251,160,246,205,14,67,96,41,208,185,200,214,196,109,24,4,42,192,249,37,200,23,137,213,164,151,102,166,189,53,
+    212,17,207,225,101,112,52,176,86,182,39,175,173,237,91,206,49,112,221,211,186,49,79,46,13,156,23,6,192,244,51,231,47,100,47,122,210,209,150,234,143,194,123,180,61,191,82,165,170,85,
+    43,117,182,137,211,212,13,196,114,129,41,182,198,188,252,203,196,231,207,159,56,113,226,2,245,183,4,152,102,47,29,226,64,98,239,59,96,19,199,22,254,248,211,105,244,187,203,161,227,
+    13,41,156,226,250,118,149,225,81,249,176,46,150,1,222,100,128,219,40,223,7,181,111,78,226,205,133,175,185,92,219,27,110,147,32,96,232,70,23,32,91,254,181,106,155,175,187,174,80,30,
+    59,0,1,132,115,88,157,107,7,56,166,176,219,193,178,129,115,120,41,76,59,179,92,96,122,175,176,242,165,124,69,93,225,45,86,172,96,65,234,86,87,161,44,230,37,183,94,14,50,221,36,110,
+    119,187,168,71,125,226,4,118,170,117,43,28,88,141,48,11,20,206,199,67,132,67,137,27,106,96,172,209,43,213,34,131,213,2,67,7,171,124,104,11,172,128,55,57,249,219,186,123,171,202,15,
+    87,224,245,95,214,69,95,36,118,124,113,82,72,130,129,101,144,84,0,125,141,48,101,182,244,181,61,230,191,1,236,110,254,200,30,150,193,121,110,52,51,150,184,48,169,59,86,138,90,128,157,
+    244,165,163,53,69,139,66,207,171,24,24,87,169,90,9,183,96,86,67,226,94,100,156,102,136,113,167,60,221,51,205,9,124,130,129,121,126,235,226,161,160,240,33,63,46,88,191,173,136,151,45,
+    251,244,211,169,211,194,136,25,126,218,180,105,34,76,192,243,230,43,94,241,13,38,112,117,1,254,209,221,6,221,187,125,251,158,173,154,183,106,206,27,56,114,43,95,70,118,120,111,176,
+    194,202,96,0,46,144,95,114,154,186,94,82,170,213,112,202,5,206,113,125,72,27,252,143,96,127,42,204,247,186,160,47,1,91,231,132,111,162,102,216,6,150,30,116,65,202,223,71,31,37,224,
+    71,31,173,74,71,31,139,226,254,188,114,64,140,89,92,169,42,207,7,129,112,133,202,132,108,136,183,74,165,222,204,109,240,9,4,62,136,194,23,119,182,63,113,193,149,52,190,56,74,190,224,
+    204,121,33,241,78,5,188,108,217,180,105,94,22,235,153,174,105,20,2,188,116,37,45,242,71,249,186,192,143,197,153,43,148,232,214,236,246,237,219,180,110,213,188,249,131,170,60,231,180,
+    34,150,239,109,183,222,90,160,64,25,1,86,194,166,55,109,198,81,121,110,12,75,97,231,236,130,17,246,78,153,89,11,77,190,111,246,236,78,2,203,206,89,5,76,93,43,45,172,18,152,121,49,129,
+    171,60,82,172,168,44,44,162,49,148,111,168,211,149,32,139,17,88,130,74,181,186,78,156,211,248,224,193,99,199,142,157,192,56,127,48,3,115,89,15,134,245,0,217,252,98,243,161,67,206,244,
+    166,202,225,157,156,195,40,252,105,120,76,147,248,116,218,212,165,75,249,4,131,187,134,84,81,10,180,149,192,146,191,143,41,96,188,15,157,120,219,183,182,125,115,186,161,121,111,112,
+    3,121,193,183,64,153,50,146,193,58,133,11,241,24,42,191,45,28,2,28,220,165,227,173,39,4,136,3,190,217,117,254,230,176,246,70,115,71,58,111,94,61,209,33,131,164,162,10,152,43,116,21,
+    104,126,173,117,197,114,180,201,22,136,73,24,186,91,189,52,241,86,93,171,177,13,230,85,197,19,39,32,141,49,155,207,159,112,128,1,50,67,134,78,135,220,121,47,144,55,41,188,211,36,113,
+    44,222,169,16,75,1,24,98,174,183,70,104,251,86,114,125,5,120,243,93,173,17,120,169,248,198,19,112,73,223,87,128,111,240,125,111,64,95,76,96,10,204,224,2,26,152,133,243,230,183,166,
+    66,242,200,244,146,41,209,206,201,95,227,107,117,166,124,228,64,23,203,204,145,155,51,134,55,169,161,112,30,220,249,87,184,144,26,8,23,18,224,170,26,24,42,180,179,183,135,114,24,175,
+    37,144,133,136,190,86,18,83,34,11,240,113,179,112,204,19,152,70,248,194,161,253,224,185,249,132,158,195,228,144,57,175,157,155,46,2,253,137,11,182,112,40,176,230,253,24,124,241,209,
+    209,232,59,87,118,95,89,43,12,94,129,214,190,143,209,217,36,186,120,5,243,183,117,235,182,173,154,55,21,223,91,114,6,34,91,182,108,217,110,8,6,103,112,169,50,101,74,21,40,83,170,84,
+    41,46,210,0,91,0,243,38,191,169,211,50,211,165,129,175,183,128,133,54,196,247,159,214,41,22,247,244,183,123,81,165,17,190,209,57,178,136,211,109,8,156,55,26,24,132,157,173,31,60,135,
+    89,169,82,21,2,198,199,93,245,181,125,89,24,103,184,142,234,189,31,210,161,150,73,45,34,189,164,166,48,241,67,10,90,62,118,130,223,210,168,202,74,225,101,225,190,31,67,128,239,148,
+    118,240,34,219,159,59,117,234,228,249,86,12,241,173,90,61,78,221,67,138,229,185,125,189,86,109,201,183,68,190,146,97,190,57,115,133,250,82,10,3,108,25,212,45,165,132,11,20,224,78,181,
+    148,232,252,26,24,39,16,111,148,37,136,0,240,63,28,96,191,43,245,79,219,215,191,107,54,135,156,78,180,128,85,141,6,225,188,58,129,185,17,150,78,52,125,37,130,192,116,216,133,214,33,
+    170,154,233,75,247,240,41,198,81,42,210,199,213,136,9,137,47,40,188,139,25,45,47,122,65,137,124,193,254,136,8,239,107,31,94,164,181,238,199,13,33,166,76,105,55,101,74,219,182,115,91,
+    180,104,209,169,107,184,111,37,171,131,213,239,49,202,224,157,84,163,169,249,197,4,110,214,52,62,190,116,137,18,225,190,55,68,196,205,12,108,130,202,116,1,30,51,225,192,56,111,1,61,
+    209,69,192,50,137,168,6,73,129,125,148,150,175,219,214,26,97,249,240,63,172,171,102,111,244,43,52,189,161,217,74,250,238,202,235,0,87,81,131,36,174,209,22,112,110,149,194,85,248,224,
+    184,29,253,250,245,226,84,78,211,139,198,106,217,88,170,244,133,11,2,124,104,147,151,181,186,122,187,194,7,156,28,246,124,73,247,227,209,232,91,123,242,228,201,109,219,182,64,222,78,
+    157,162,124,45,224,199,44,96,206,223,118,173,155,53,107,22,31,95,2,125,61,224,108,17,197,153,125,177,9,46,85,42,64,12,163,166,2,118,20,42,160,106,52,247,181,114,104,223,176,35,12,246,
+    88,215,44,86,234,42,45,25,124,93,16,88,15,131,101,123,7,238,44,162,53,97,61,91,105,1,63,170,50,184,176,155,193,122,38,164,154,231,11,197,186,47,18,227,243,31,14,203,53,31,252,28,53,
+    35,44,53,249,146,41,215,98,204,125,43,63,135,157,193,146,227,203,186,196,75,209,182,109,219,196,68,4,46,81,209,111,126,131,115,28,22,48,141,127,219,181,107,219,246,239,249,222,124,
+    179,1,46,107,17,23,130,94,117,1,55,112,213,88,143,135,115,216,249,235,79,73,90,190,206,157,59,74,248,159,217,252,187,162,249,32,234,141,150,175,94,112,176,22,189,120,46,75,151,104,
+    18,246,129,173,139,16,171,86,175,6,13,112,191,126,70,152,223,202,149,61,71,225,199,86,245,164,188,253,186,175,37,59,180,46,202,144,200,174,210,248,43,71,216,30,13,175,176,129,137,119,
+    180,246,173,93,127,36,61,181,149,18,56,129,14,191,186,217,235,236,212,81,190,8,140,9,12,253,103,244,173,71,190,30,112,182,108,177,124,111,190,85,39,112,153,231,74,61,103,128,75,97,
+    151,218,5,86,237,50,3,231,184,62,18,216,28,10,181,238,114,207,41,154,217,88,56,91,152,176,117,111,192,77,124,29,196,77,210,205,114,39,43,131,192,69,157,46,86,177,98,122,46,179,154,
+    110,134,77,30,191,244,82,63,125,101,207,214,45,120,17,4,205,124,24,224,11,102,7,222,33,248,97,149,233,11,102,249,88,137,31,178,38,180,150,59,190,200,171,242,23,159,74,90,143,30,167,
+    109,23,102,219,215,157,132,118,129,177,62,163,111,61,149,192,183,248,190,17,192,183,74,96,242,62,199,241,128,228,114,217,178,106,208,4,113,43,13,158,172,150,88,1,135,30,100,248,135,
+    57,176,96,61,141,33,167,16,103,203,22,46,28,244,189,81,87,105,200,220,92,6,216,76,116,132,245,162,139,57,192,234,118,15,23,88,95,187,181,117,43,93,244,177,197,2,118,246,105,209,214,
+    15,51,254,181,173,37,129,33,204,194,146,222,224,65,181,153,27,223,134,207,54,124,182,65,253,6,244,60,109,188,133,44,161,98,66,66,249,242,246,216,151,117,157,4,150,62,22,0,255,176,121,
+    211,242,165,75,33,129,225,27,196,36,240,45,89,243,189,217,248,106,96,142,178,101,141,240,109,12,172,38,52,121,209,41,79,158,28,166,127,21,234,155,205,245,197,21,45,54,198,191,15,252,
+    110,116,10,91,5,26,183,87,82,10,231,202,165,218,224,66,214,60,135,30,7,23,245,19,88,3,227,98,49,187,42,96,220,216,163,247,232,129,240,22,20,198,67,107,102,19,128,44,19,234,233,232,
+    11,82,181,205,238,90,147,192,135,116,2,175,88,174,102,43,63,150,149,225,218,4,12,190,120,89,109,61,185,67,80,110,202,8,205,94,103,16,44,192,43,122,147,47,22,232,0,112,236,250,108,1,
+    43,216,70,248,166,3,188,116,64,224,178,165,100,210,3,149,101,85,81,109,251,200,147,35,71,176,7,173,207,3,147,47,252,5,236,203,193,101,74,156,133,163,128,111,242,111,118,193,119,189,
+    38,88,141,130,185,15,77,157,232,48,96,90,78,172,166,124,157,174,86,143,126,253,205,38,76,42,210,105,120,179,56,9,171,73,200,67,7,50,212,254,29,166,62,228,109,214,147,4,54,21,122,133,
+    172,27,125,170,124,153,87,249,198,0,14,248,106,224,255,2,240,210,165,208,0,235,22,248,111,0,151,210,192,141,24,24,3,126,134,143,223,122,155,29,48,104,42,160,55,246,64,54,249,71,205,
+    174,203,102,135,231,75,207,150,37,98,253,25,30,112,110,107,95,180,210,197,225,82,225,66,121,212,116,37,173,22,82,2,203,23,66,42,116,81,123,16,204,192,85,100,61,145,80,171,187,194,178,
+    203,118,43,222,220,207,79,241,192,123,169,246,238,197,157,151,102,163,142,108,225,144,253,59,180,176,100,85,235,243,106,123,237,1,157,192,222,222,157,134,234,164,120,125,126,186,28,
+    251,86,100,224,240,254,149,242,213,37,250,191,155,55,47,69,224,196,248,196,120,13,124,203,45,55,103,161,255,204,221,103,41,208,148,188,141,76,116,104,196,173,113,129,152,192,185,92,
+    224,235,50,1,86,89,108,125,74,246,108,230,145,43,70,246,38,115,23,215,77,188,69,186,16,15,133,105,55,7,95,97,169,129,57,131,93,97,108,165,171,84,177,198,202,18,184,179,135,141,95,198,
+    174,52,61,152,197,60,138,7,141,119,232,35,194,25,25,123,248,116,177,18,206,200,144,181,165,243,74,248,144,3,204,123,119,70,155,236,21,222,218,245,44,223,7,19,74,60,88,190,180,147,192,
+    157,131,249,107,3,67,31,122,105,219,182,245,106,193,127,93,139,243,215,75,224,8,223,91,45,222,82,207,217,184,141,62,235,208,168,81,201,146,207,61,240,128,15,124,155,213,149,206,155,
+    255,182,92,183,81,115,170,132,131,190,65,224,220,234,47,198,127,183,156,146,197,34,236,194,170,19,44,178,255,93,1,227,32,152,27,95,212,123,148,23,147,188,113,112,57,106,131,171,232,
+    161,50,6,111,52,22,96,124,118,78,127,192,133,31,253,148,111,106,106,58,222,192,98,157,42,254,137,110,114,216,131,91,170,233,128,196,254,3,178,130,200,219,110,201,59,195,77,96,237,59,
+    210,75,95,6,214,183,85,89,131,95,195,107,124,77,137,222,188,137,18,56,49,209,180,192,46,240,13,81,179,147,198,247,129,7,20,240,103,159,205,196,55,159,81,169,14,5,150,225,48,1,223,118,
+    155,229,233,241,146,111,78,18,13,1,182,2,125,115,26,96,179,155,195,241,37,98,58,96,131,75,9,85,72,86,2,128,31,41,103,31,102,47,92,152,47,231,195,12,198,84,175,106,246,107,85,215,125,
+    234,55,143,240,163,115,94,230,45,31,107,215,174,77,77,77,93,143,194,123,213,189,0,122,179,59,36,49,31,34,207,144,189,92,135,112,240,196,13,245,126,222,136,231,250,142,30,37,119,181,
+    212,126,182,190,246,173,103,124,17,184,82,190,7,3,190,21,236,106,99,128,231,225,4,73,45,12,13,108,122,209,177,135,71,142,47,192,126,54,118,44,3,63,39,192,158,176,53,229,145,159,87,
+    21,179,69,134,149,193,57,163,125,85,224,111,170,233,231,176,3,104,114,68,184,112,17,164,171,250,40,231,239,163,85,217,247,145,114,229,10,227,53,5,244,82,88,93,191,136,192,180,125,173,
+    170,179,35,143,183,94,62,152,243,229,190,125,65,152,129,217,55,117,61,222,179,181,87,241,226,61,74,233,233,4,172,2,27,100,58,3,131,221,233,3,102,219,180,26,34,9,111,67,117,23,79,3,
+    227,91,2,242,47,254,193,210,15,170,219,230,188,29,88,213,240,155,175,122,117,95,56,110,199,230,212,165,243,90,180,128,4,78,44,113,103,173,18,65,225,64,234,222,64,203,251,198,247,1,
+    244,125,142,125,103,142,29,59,118,230,103,6,56,32,108,77,105,229,21,225,27,98,1,231,164,4,38,191,124,177,129,115,230,204,145,35,183,153,131,246,211,151,31,23,64,122,180,153,210,74,
+    75,1,86,9,172,111,96,164,20,86,192,197,224,243,170,84,81,255,73,165,74,71,178,197,29,169,214,185,179,122,70,210,90,149,193,187,233,146,173,61,114,17,90,10,9,195,135,160,86,239,177,
+    152,51,104,60,5,188,251,121,95,214,106,73,96,85,159,197,119,36,15,126,235,21,71,95,4,198,59,65,117,31,218,239,61,135,249,62,22,183,125,75,106,207,121,45,168,66,115,6,11,240,205,161,
+    192,172,116,171,229,203,188,156,192,51,193,119,194,216,153,51,85,10,63,64,194,183,222,234,2,243,60,117,153,66,178,47,64,253,209,225,190,57,115,219,25,26,27,56,103,142,60,222,241,96,
+    43,123,139,98,138,106,57,72,197,170,142,48,124,184,32,101,47,159,88,226,79,229,110,86,53,162,197,120,132,204,49,42,193,43,125,105,245,115,86,214,174,253,118,45,222,112,200,247,168,
+    41,223,37,75,150,0,113,74,58,133,164,50,189,197,222,246,254,253,251,213,62,233,21,43,86,169,2,93,27,123,207,12,220,224,206,167,248,73,30,200,75,33,151,10,134,164,175,135,107,50,120,
+    203,150,212,100,122,42,72,147,248,90,216,201,170,83,178,164,59,147,229,249,222,138,63,188,244,197,6,183,209,88,138,9,99,38,76,152,57,118,2,32,71,1,243,74,68,41,156,197,228,141,31,214,
+    159,159,13,153,111,136,41,108,255,42,176,154,153,55,207,141,133,173,226,172,128,239,184,163,28,95,148,165,128,49,51,117,209,69,96,235,114,160,220,124,31,69,97,60,93,202,73,204,184,
+    85,212,189,215,248,193,98,229,136,153,175,70,148,71,87,126,251,173,92,14,159,46,129,188,36,156,66,194,41,140,140,111,240,102,38,234,102,103,232,17,48,157,39,197,236,125,22,121,201,
+    183,118,253,187,0,184,86,241,226,37,116,240,181,145,166,255,28,214,187,194,110,66,238,219,245,142,14,5,220,100,220,184,113,117,106,197,215,169,163,132,145,56,23,188,248,11,251,30,47,
+    251,54,106,52,129,124,199,96,192,187,51,103,78,120,110,204,3,20,248,169,2,137,192,122,166,186,80,208,215,77,230,64,130,202,22,237,146,145,249,156,43,111,110,58,116,198,184,210,252,
+    242,101,74,119,20,197,34,92,206,74,225,170,170,224,86,225,4,38,83,232,102,219,199,216,229,187,225,17,63,248,206,173,42,50,65,248,252,243,221,228,238,247,117,235,118,105,224,93,187,
+    118,45,177,132,119,41,231,116,17,206,144,251,93,126,90,205,192,226,59,74,223,133,87,187,126,189,250,152,190,37,60,223,7,245,0,56,180,251,140,191,120,84,45,117,35,112,106,114,114,139,
+    22,77,154,36,54,105,210,164,86,157,132,58,34,76,23,149,120,194,183,89,201,235,248,2,47,36,238,132,9,144,191,99,134,13,195,28,158,73,239,177,240,3,246,100,135,189,160,120,91,20,240,
+    13,225,192,217,114,210,221,92,114,201,21,109,234,245,129,243,98,14,171,139,245,240,69,223,164,84,148,119,229,0,51,36,243,35,204,102,10,47,167,175,204,85,171,211,85,133,136,24,63,19,
+    23,135,11,194,127,133,55,35,63,98,74,65,249,242,29,241,2,76,126,174,14,62,70,7,47,243,95,191,139,112,49,150,164,44,1,100,120,7,108,119,225,207,187,82,164,89,222,77,131,41,104,140,233,
+    160,130,230,29,61,202,116,175,234,243,99,150,74,148,240,129,43,122,135,128,161,241,85,35,250,106,213,117,159,80,70,119,8,188,118,238,92,0,198,72,72,72,40,109,165,240,45,183,228,162,
+    141,88,118,121,118,250,206,210,185,34,94,76,92,82,5,97,250,37,190,171,133,21,241,173,5,2,194,54,236,63,156,114,29,4,206,121,11,248,10,49,91,187,91,198,16,38,143,221,107,166,244,45,
+    87,84,245,140,245,93,109,229,164,212,114,225,149,223,41,148,215,218,36,143,33,159,93,165,10,188,150,11,139,242,29,59,86,170,244,188,2,254,22,128,23,237,82,184,152,191,41,244,222,18,
+    132,101,105,252,248,162,37,216,76,131,48,221,164,181,26,15,164,32,240,84,60,199,175,170,51,15,142,60,94,147,192,14,111,117,143,87,218,20,30,193,63,22,183,45,117,109,215,22,12,60,14,
+    133,85,10,51,113,174,156,228,41,229,57,48,246,69,223,177,141,198,98,250,210,235,176,97,131,7,15,75,122,34,32,108,154,225,91,45,95,174,221,55,68,135,7,12,21,229,150,146,86,254,146,244,
+    45,86,43,205,194,124,177,147,69,140,20,133,173,43,218,88,152,11,47,2,107,95,5,172,246,217,170,79,198,175,151,71,91,86,1,119,212,143,198,194,10,61,127,17,62,143,39,157,10,50,167,46,
+    215,105,105,142,41,118,165,51,48,223,133,7,192,51,86,45,95,69,190,186,115,197,115,27,225,190,15,58,229,185,186,229,203,188,170,40,61,194,194,113,169,169,201,93,149,48,2,147,177,17,
+    198,43,105,110,181,67,120,30,144,153,231,70,141,177,227,140,245,121,12,145,2,48,53,195,2,60,248,129,193,118,149,190,213,2,198,180,206,4,88,9,107,233,91,212,29,117,37,213,165,138,240,
+    174,105,138,21,48,221,192,38,3,223,59,204,213,168,74,184,156,234,33,83,209,125,68,253,190,222,148,119,171,202,99,248,96,25,74,97,185,131,179,76,25,117,81,114,153,34,101,202,160,177,
+    227,75,79,75,98,95,206,85,8,160,222,197,173,48,235,46,194,68,230,86,152,120,241,62,135,233,51,150,79,157,58,149,70,191,204,91,59,152,190,230,170,223,10,4,236,167,175,237,171,187,130,
+    40,28,135,199,152,186,138,175,2,46,109,128,111,117,117,111,185,133,166,37,75,169,145,81,163,198,159,81,223,25,187,207,54,240,152,49,2,12,161,186,90,60,188,178,129,117,239,43,114,45,
+    35,39,245,245,88,250,22,27,88,49,195,107,73,181,193,247,22,189,251,186,8,3,27,78,18,164,55,101,212,71,188,180,68,224,188,194,155,31,223,226,158,208,50,198,148,84,249,46,68,137,178,
+    101,59,116,40,47,194,142,239,46,59,112,176,180,75,134,196,187,72,153,186,90,187,21,48,36,240,148,41,184,231,25,125,81,184,65,253,16,95,27,184,66,133,138,21,42,116,14,118,157,13,175,
+    110,131,64,56,46,117,45,222,3,48,59,84,184,20,53,196,183,222,226,36,239,115,26,183,81,99,10,53,62,66,82,240,21,96,105,143,117,14,187,5,64,1,75,253,143,92,205,64,182,155,49,8,87,223,
+    81,7,113,115,78,187,84,231,134,143,227,237,138,106,115,174,233,7,43,79,166,194,204,43,83,36,216,152,98,74,210,169,170,252,183,230,207,95,32,255,173,80,181,112,199,145,249,118,40,87,
+    198,143,178,8,220,161,163,78,95,2,222,197,79,212,218,69,143,107,160,20,94,175,198,76,41,132,188,68,245,165,229,194,14,188,22,109,202,200,233,228,219,16,124,27,200,212,85,120,117,102,
+    95,224,173,224,39,176,242,85,93,124,213,203,120,20,51,120,238,220,174,179,103,219,192,40,220,168,100,201,50,101,56,137,75,1,11,165,46,234,150,125,14,255,97,134,183,113,227,137,12,44,
+    69,89,128,161,77,230,95,161,57,101,49,90,62,80,234,129,82,60,56,214,190,183,121,192,113,113,246,106,213,205,183,176,175,188,103,1,123,1,31,207,87,216,100,176,55,214,209,192,184,5,161,
+    72,153,0,47,95,79,95,8,55,127,230,231,205,69,184,169,91,110,75,243,124,203,26,96,17,214,190,246,211,210,22,45,89,180,40,101,61,207,124,208,24,56,133,211,120,201,248,20,51,239,129,192,
+    75,167,79,25,57,114,234,84,228,29,57,178,190,158,153,44,30,202,43,192,85,29,222,106,12,92,213,239,41,80,153,142,75,67,96,35,172,140,27,53,98,225,146,165,236,77,86,172,75,161,124,103,
+    45,152,56,113,38,12,124,85,35,172,129,185,68,75,153,30,252,128,23,12,140,235,81,55,223,28,189,26,25,12,39,139,93,224,146,37,105,168,227,93,203,22,72,214,178,101,2,217,139,138,238,6,
+    50,217,200,143,223,14,101,229,251,194,7,54,37,218,26,3,219,15,195,91,180,8,123,209,138,152,98,61,181,197,106,6,243,167,159,182,173,94,181,116,233,20,0,110,215,174,157,218,118,85,207,
+    239,95,89,186,15,241,99,62,43,87,246,234,51,54,192,166,201,161,157,52,101,100,12,31,151,134,143,49,134,129,82,136,240,115,37,233,31,66,153,91,6,235,114,7,21,93,186,116,153,53,107,22,
+    232,98,44,152,56,115,230,196,153,186,155,101,183,193,131,117,12,123,192,51,38,95,138,27,174,5,216,24,7,149,203,112,77,45,83,70,235,146,92,185,240,40,107,1,203,254,34,234,219,151,98,
+    224,2,2,76,125,169,178,101,203,132,151,232,242,29,187,104,95,122,110,248,6,121,136,214,162,249,248,208,164,37,187,56,135,119,207,179,144,215,203,77,207,116,97,221,202,165,51,16,184,
+    97,59,230,213,190,241,197,131,201,11,190,148,192,149,67,230,174,170,106,95,217,42,197,77,209,35,4,76,194,129,28,46,93,186,145,254,84,248,215,224,26,190,216,98,44,176,99,34,36,49,166,
+    240,4,43,133,5,248,131,193,22,50,140,154,244,200,233,1,229,27,37,124,115,236,8,75,99,245,181,47,194,196,101,202,70,225,202,215,1,223,210,59,101,213,14,50,61,134,227,93,161,244,57,94,
+    6,91,21,186,44,125,57,158,87,190,235,231,167,234,39,164,113,14,47,81,147,211,233,248,67,181,198,66,76,87,162,173,132,4,158,60,178,193,228,118,182,47,85,232,7,75,4,30,109,115,123,133,
+    219,177,62,87,160,69,45,43,127,31,173,170,134,243,248,237,106,253,101,65,88,3,207,157,237,11,39,148,54,255,118,59,119,33,230,116,153,3,177,208,248,178,48,0,15,241,128,7,59,192,20,207,
+    49,242,96,155,75,80,255,125,195,191,33,178,4,140,196,164,202,171,35,220,227,50,255,180,34,118,255,23,134,51,229,113,208,138,35,87,245,68,39,101,103,184,203,170,114,165,120,37,125,41,
+    199,75,209,36,122,41,143,151,190,30,170,253,93,183,110,246,124,231,73,74,187,230,75,125,214,182,220,153,150,201,75,204,95,104,130,1,24,122,86,237,92,222,226,33,79,46,98,94,122,208,
+    182,51,191,193,190,60,159,238,125,19,194,88,129,128,181,176,219,153,166,205,153,165,49,115,203,119,128,247,186,116,161,239,87,250,134,93,168,98,142,206,96,6,118,51,120,72,64,119,88,
+    146,252,148,52,248,3,21,239,191,255,254,13,36,235,196,205,153,7,251,162,112,9,28,46,153,20,102,3,219,183,60,12,89,203,160,178,45,90,54,0,204,188,183,186,190,144,192,84,183,75,233,170,
+    109,190,231,149,47,70,50,247,162,117,18,239,146,30,179,44,46,185,190,248,91,171,87,98,2,79,105,80,11,128,219,26,223,224,211,169,30,122,8,94,111,127,80,249,86,141,240,13,150,25,4,230,
+    20,118,133,187,52,81,190,229,249,109,71,8,210,53,35,62,17,38,224,89,51,103,145,176,244,163,69,121,152,45,76,168,73,73,12,156,196,190,239,107,224,247,223,15,2,63,142,134,79,60,17,43,
+    135,69,152,210,184,116,201,124,165,243,133,0,151,239,8,127,123,250,23,176,117,168,176,91,161,111,145,250,108,250,101,114,218,170,128,218,241,109,21,52,3,44,227,96,29,42,109,119,255,
+    180,59,184,190,68,57,188,116,30,248,78,78,108,80,171,126,203,150,205,34,125,81,23,124,111,215,9,108,166,154,209,183,138,106,126,205,191,189,80,33,147,193,91,4,152,136,97,64,12,33,205,
+    108,23,84,237,88,62,1,58,18,106,194,134,124,213,191,101,225,58,241,69,224,153,12,204,85,89,132,193,119,8,16,127,8,63,240,99,73,20,226,139,192,192,74,202,161,190,255,126,252,241,199,
+    159,128,168,241,132,24,63,241,248,227,145,41,12,33,143,94,83,253,92,225,163,239,76,9,126,226,74,71,121,46,91,89,71,88,247,76,204,128,161,172,11,236,76,5,8,112,227,198,142,239,34,38,
+    230,135,135,211,179,237,210,117,6,83,18,99,246,98,215,75,245,178,16,120,50,248,18,112,203,166,24,1,95,72,222,135,114,231,54,188,236,91,245,81,179,225,72,150,183,138,240,52,76,33,58,
+    2,166,190,201,59,0,240,150,181,107,133,88,158,188,51,27,148,187,240,229,120,148,182,156,185,157,204,108,156,21,66,60,139,82,120,2,205,116,232,114,76,217,60,4,35,201,10,113,78,250,80,
+    50,247,253,247,51,245,5,90,248,5,190,222,140,239,25,223,59,239,4,223,58,200,91,167,36,100,48,19,171,254,19,117,147,203,123,194,244,115,8,176,151,194,210,187,130,207,175,130,159,94,
+    182,108,41,53,19,167,118,24,234,254,136,169,103,248,160,209,117,240,162,158,14,159,110,141,143,16,57,157,38,166,193,23,83,120,62,62,35,116,62,2,39,226,110,169,102,226,251,80,211,96,
+    113,126,8,226,118,5,172,86,177,13,176,242,165,126,71,33,61,212,147,129,28,2,167,105,97,247,241,59,98,76,255,8,90,207,22,94,126,186,245,186,93,252,239,18,95,202,224,49,170,87,53,204,
+    52,185,73,46,177,246,253,208,246,125,63,204,23,129,107,104,96,55,44,96,181,149,155,159,132,84,154,176,204,83,146,58,134,4,101,114,135,32,112,217,178,207,25,224,14,229,72,23,191,31,
+    224,83,205,188,27,79,196,67,199,164,49,251,46,92,104,218,171,69,234,153,223,242,132,120,179,246,79,49,111,17,39,48,198,252,249,41,169,169,243,230,205,67,223,248,90,241,77,57,30,114,
+    104,145,85,112,21,176,232,86,117,120,31,81,147,236,246,72,94,102,98,158,143,195,179,53,107,109,226,228,174,114,129,139,222,141,210,21,112,241,19,190,93,79,235,157,235,101,150,85,3,
+    207,114,19,248,3,76,225,193,170,43,245,33,132,159,198,31,122,192,255,249,79,8,240,19,42,30,15,15,172,218,119,214,168,81,179,102,157,58,86,71,186,108,217,146,194,230,234,62,255,188,
+    15,220,129,206,94,148,45,215,129,223,239,96,1,227,116,142,245,95,195,239,89,192,106,149,20,129,103,35,171,248,194,168,2,223,40,97,26,6,47,89,132,11,74,188,111,135,11,244,231,139,62,
+    255,28,63,97,201,124,242,149,189,82,241,248,112,215,135,84,250,242,248,8,108,111,55,186,118,2,63,26,76,95,190,201,217,57,199,201,3,117,4,198,131,23,107,61,227,110,86,124,219,45,249,
+    219,245,169,169,27,82,83,117,15,113,151,54,22,224,89,52,87,57,76,1,99,80,67,155,244,33,1,115,26,43,100,250,152,157,192,255,9,8,63,174,128,31,143,17,79,60,113,231,157,53,238,172,89,
+    179,230,157,214,88,184,236,45,220,248,118,112,128,193,215,38,6,100,49,133,183,2,220,161,44,31,197,192,149,20,242,125,94,254,11,248,237,178,52,243,70,251,252,31,144,93,14,208,254,46,
+    232,194,190,224,53,71,7,151,106,29,122,145,144,215,147,228,105,194,8,140,79,60,162,189,82,181,106,17,240,67,15,217,217,123,123,72,56,9,92,76,178,87,167,175,186,224,40,191,74,97,250,
+    199,33,48,157,143,91,171,35,153,127,234,198,143,71,163,237,130,184,95,112,163,121,68,174,89,48,81,192,51,103,214,228,65,18,249,66,207,9,133,63,164,236,117,128,89,217,247,69,224,255,
+    68,36,176,75,202,165,219,0,131,240,205,53,33,141,49,145,5,248,185,178,141,40,255,202,219,192,72,245,188,91,164,245,200,190,131,250,133,117,120,174,67,135,142,252,31,60,207,25,140,27,
+    128,111,133,193,250,205,239,223,140,255,180,97,152,192,141,23,144,39,249,18,240,130,5,248,74,31,157,195,31,34,202,69,168,170,214,132,53,240,34,4,158,75,187,89,227,9,248,33,191,241,
+    13,7,46,86,149,183,120,62,74,119,76,20,43,118,71,192,87,166,211,101,49,132,129,233,97,231,107,253,64,93,58,120,147,154,150,138,77,200,198,221,27,55,242,227,115,161,195,160,132,177,
+    70,207,162,250,76,179,207,131,63,84,131,91,173,171,107,180,73,98,248,8,193,126,16,41,156,37,96,105,165,37,68,152,202,39,179,105,79,25,16,48,86,7,124,99,249,118,80,5,187,17,159,171,
+    226,57,89,51,110,120,30,62,189,17,8,227,96,157,254,210,31,12,30,54,102,236,216,198,141,27,163,239,108,202,211,133,228,139,49,137,222,114,50,127,242,201,39,159,171,7,128,215,92,66,201,
+    204,15,3,159,3,194,243,230,207,155,61,27,125,19,226,75,148,70,96,35,124,123,120,84,208,135,226,104,11,209,29,119,20,163,39,247,233,7,204,241,29,161,183,169,245,18,7,152,202,180,139,
+    12,191,226,45,251,105,252,84,206,109,187,55,110,195,135,99,111,148,231,36,115,157,102,96,153,136,30,166,125,121,0,244,1,38,170,15,12,217,12,194,3,232,51,62,84,163,224,136,12,30,24,
+    179,68,115,33,191,211,19,126,174,36,1,163,25,11,119,81,35,1,230,213,209,200,154,91,231,15,52,210,39,36,27,117,160,145,131,12,23,241,119,30,24,140,61,65,254,118,28,156,52,102,194,216,
+    198,11,198,235,122,188,144,120,39,170,152,52,113,18,133,6,134,119,38,113,26,139,55,100,56,250,210,148,18,158,22,108,78,87,147,197,246,45,102,5,237,68,194,183,214,3,4,243,50,175,2,230,
+    185,152,231,159,143,59,44,207,39,216,170,44,77,108,217,154,134,63,216,119,251,182,109,214,206,237,221,27,153,24,74,52,252,219,120,4,204,11,71,240,13,206,190,239,179,222,7,100,12,176,
+    22,51,165,240,0,252,248,128,1,3,224,155,224,63,33,25,12,194,3,7,198,20,86,159,102,132,105,43,10,31,125,227,105,136,142,122,160,39,84,150,110,35,206,244,14,234,147,27,73,6,211,127,223,
+    197,2,110,220,184,81,201,231,134,125,128,61,125,174,59,73,73,19,198,142,157,56,17,18,21,129,23,114,250,18,237,8,8,120,139,200,12,108,5,10,83,2,131,239,156,217,179,23,137,111,2,249,
+    90,186,15,230,14,209,85,39,30,45,95,126,240,166,240,230,85,188,183,193,43,207,200,220,170,128,15,11,49,222,151,155,182,197,232,166,241,195,26,183,110,225,167,90,235,103,157,239,145,
+    39,158,167,111,36,96,252,222,229,61,148,50,68,98,224,247,63,224,89,12,10,191,84,115,63,139,63,172,128,67,250,88,4,252,68,12,95,211,23,99,224,154,117,106,106,225,4,44,187,93,112,185,
+    199,5,238,34,148,141,156,179,144,94,52,230,1,46,188,77,168,211,165,113,163,49,53,146,6,127,64,9,252,111,5,60,145,128,177,72,35,239,164,73,162,171,130,83,57,32,76,5,26,129,231,204,182,
+    124,75,119,170,96,229,111,190,156,108,154,47,159,197,203,192,69,239,0,92,157,190,133,117,121,230,75,217,157,211,35,208,39,164,111,91,2,214,73,172,35,205,188,187,131,30,184,186,157,
+    92,51,50,128,86,73,83,67,188,136,58,89,52,4,150,46,180,53,193,172,219,88,40,198,216,159,182,27,98,171,129,230,4,102,97,126,79,251,6,128,173,95,219,195,101,45,204,69,26,136,18,58,52,
+    166,212,76,72,232,226,5,3,55,138,1,140,203,220,93,102,127,251,237,108,180,155,213,120,236,88,156,150,1,220,255,64,91,66,223,175,73,73,72,56,30,27,92,106,108,13,48,252,149,109,231,48,
+    97,72,97,2,150,41,127,240,173,216,169,98,72,129,214,192,69,85,220,33,184,119,20,133,31,234,105,140,58,127,205,9,93,2,150,249,84,6,14,33,222,74,79,106,60,204,247,156,243,35,206,245,
+    19,162,196,119,99,58,39,240,172,207,102,142,157,224,173,29,9,176,22,254,112,240,96,175,41,30,66,217,75,111,164,147,69,47,26,18,112,201,247,9,191,91,21,0,230,79,39,95,120,83,82,229,
+    48,70,66,227,132,132,198,30,111,66,163,70,86,119,42,24,99,25,120,14,175,164,52,110,60,118,2,251,202,247,225,127,192,120,64,210,144,17,152,193,216,167,154,243,249,39,224,59,73,18,120,
+    160,68,44,96,108,131,41,129,235,48,48,237,115,150,242,156,239,118,122,226,118,65,4,46,104,217,178,47,217,90,143,69,46,92,68,95,177,159,223,61,254,197,99,121,2,62,122,244,112,136,49,
+    254,154,110,144,193,91,190,182,243,209,71,121,22,197,193,253,25,82,164,119,67,6,207,161,4,86,192,102,245,151,190,36,106,48,244,65,176,51,205,194,146,194,250,107,199,192,82,157,31,15,
+    45,209,79,104,92,87,152,128,81,184,134,5,76,123,78,188,12,110,92,178,145,221,157,82,59,83,68,151,186,199,141,27,143,231,204,132,150,85,249,254,71,202,11,10,15,24,50,100,132,87,131,
+    117,2,15,28,56,100,0,253,52,8,43,181,250,237,17,35,6,41,99,108,157,103,55,1,223,132,46,14,240,237,146,189,5,57,138,230,206,87,244,118,159,87,1,235,243,176,234,17,55,249,189,227,95,
+    165,30,144,78,52,2,43,97,86,62,236,196,214,163,199,142,237,80,199,212,15,28,144,199,80,236,85,205,240,174,117,179,231,44,96,95,127,245,247,195,15,204,104,55,54,240,128,1,90,120,0,199,
+    64,29,78,10,255,219,73,222,127,7,82,184,230,51,44,236,22,91,21,212,93,210,146,141,76,2,235,207,160,189,101,188,205,140,199,180,192,59,98,196,152,36,254,14,252,183,249,46,28,48,96,8,
+    55,179,159,120,194,244,119,214,255,2,37,60,98,208,136,65,131,140,240,156,73,227,199,235,53,89,117,19,67,69,174,206,5,77,20,243,210,215,233,91,121,233,235,249,34,240,115,225,192,118,
+    200,99,56,143,31,167,199,149,19,240,129,131,244,64,198,227,251,15,74,10,67,47,122,214,196,177,106,157,208,90,249,197,117,66,5,252,193,7,150,239,135,22,176,121,239,125,195,59,208,9,
+    6,134,236,177,61,67,129,65,24,128,33,198,214,168,67,106,190,176,157,169,161,223,2,100,12,186,220,127,154,52,158,204,134,12,25,240,190,219,69,8,7,254,68,167,240,0,91,24,126,3,83,121,
+    16,36,244,112,28,45,193,32,120,206,236,241,36,172,128,153,152,70,66,249,242,209,33,87,202,224,162,5,93,95,143,183,176,122,2,74,126,215,151,51,248,1,39,131,143,70,241,202,115,86,15,
+    238,167,147,203,248,104,152,3,135,232,137,155,251,169,59,189,103,247,122,4,54,43,253,195,244,82,33,35,179,48,14,136,41,167,135,248,25,236,36,51,124,213,134,48,234,160,65,252,117,18,
+    97,0,253,143,227,249,239,112,224,129,53,158,169,75,117,186,17,40,53,106,108,11,250,149,88,183,183,146,220,11,198,203,6,81,232,58,33,220,2,30,247,32,47,251,202,255,205,6,14,22,233,137,
+    4,108,85,33,148,29,132,175,248,47,34,97,172,207,227,231,16,176,94,113,151,28,198,94,114,81,241,45,90,212,79,95,135,183,72,225,34,54,111,176,64,227,177,19,110,130,35,129,45,223,19,7,
+    15,102,72,2,31,160,103,93,227,35,204,169,159,149,190,126,17,2,243,150,89,189,216,175,223,67,56,238,82,127,24,210,201,74,146,95,142,25,131,111,7,224,27,250,2,13,98,95,245,133,26,240,
+    132,35,10,173,52,126,185,245,199,116,231,154,50,24,82,184,110,93,200,97,135,178,177,99,61,86,154,90,93,142,161,193,109,188,96,193,248,241,50,75,129,61,38,232,29,75,183,24,254,98,3,
+    254,19,2,60,96,32,1,143,112,132,173,18,61,64,125,171,170,192,119,135,15,39,223,241,77,198,143,111,156,96,124,113,125,186,24,188,40,224,128,174,230,45,108,23,103,227,235,229,47,31,27,
+    43,107,3,31,141,0,86,23,154,159,63,152,33,119,1,29,194,103,19,28,58,196,237,48,2,99,133,86,59,42,237,125,209,178,107,86,132,17,216,19,30,3,99,37,178,165,157,92,67,216,119,132,250,118,
+    151,230,247,137,1,79,120,25,251,111,234,134,233,47,185,233,147,225,151,243,153,103,70,212,133,80,114,99,245,123,220,190,202,207,53,107,24,223,137,26,118,252,120,80,29,63,137,121,213,
+    184,135,180,254,19,38,60,80,141,117,13,241,68,104,107,195,128,177,64,83,159,75,124,177,66,235,45,81,229,120,255,65,49,225,13,68,144,183,136,199,235,250,222,90,64,157,250,228,10,45,
+    192,71,99,37,48,61,146,96,191,60,197,158,30,203,8,190,199,113,156,180,126,221,58,0,150,205,58,161,192,60,48,254,208,0,227,150,142,33,252,57,67,134,209,33,166,9,35,152,120,2,125,201,
+    234,62,243,204,32,205,251,132,223,103,86,192,143,63,46,95,114,25,6,203,23,115,248,240,186,54,48,166,174,45,44,206,216,76,243,175,198,141,211,190,50,187,104,226,19,238,52,133,2,19,160,
+    158,211,248,196,116,149,85,35,172,187,16,131,172,32,95,40,208,77,154,176,111,249,4,157,191,65,221,130,81,201,91,68,223,66,229,219,210,213,11,183,49,239,3,124,89,25,2,31,11,17,62,122,
+    212,73,96,12,186,181,13,125,241,10,107,76,224,61,144,191,216,4,155,253,118,62,176,244,187,120,233,97,240,135,184,52,60,100,200,224,36,108,161,229,247,25,24,133,225,13,78,14,77,28,14,
+    192,38,127,3,93,170,127,91,171,13,26,88,127,37,159,97,96,71,212,234,63,169,67,54,58,127,39,142,31,135,255,207,177,35,108,226,137,60,197,56,113,162,3,108,53,17,30,48,101,48,206,55,227,
+    183,132,20,31,213,141,112,133,57,129,113,0,236,150,103,190,241,37,8,124,135,137,194,246,180,134,181,176,224,251,170,244,69,96,174,208,223,199,29,19,97,203,56,196,247,226,5,190,138,
+    143,46,135,161,4,70,96,92,106,144,13,179,19,140,241,24,231,104,195,96,181,68,156,148,132,239,65,37,118,190,9,38,76,152,57,97,196,196,153,52,185,171,186,41,3,221,57,172,8,96,89,90,210,
+    190,3,125,96,120,175,238,216,96,55,186,113,221,17,152,227,19,39,66,250,66,254,142,29,59,194,84,91,4,118,70,61,94,2,107,96,236,65,81,245,149,158,19,141,110,135,171,214,101,80,168,239,
+    112,46,208,182,175,230,85,41,44,207,125,41,202,3,222,162,78,234,186,201,235,241,202,205,56,228,123,243,173,46,48,11,111,101,227,163,58,108,95,126,180,196,33,186,105,243,0,117,162,247,
+    224,68,37,46,37,1,14,2,155,118,88,203,217,194,131,135,37,37,13,179,195,248,206,196,115,17,240,58,113,65,4,240,227,17,192,186,247,44,249,251,204,51,82,161,173,35,113,80,142,235,170,
+    246,88,3,99,40,95,123,246,216,234,24,15,151,10,61,208,77,96,171,66,211,255,20,124,185,240,226,252,5,12,136,220,24,104,235,178,47,238,105,236,212,201,205,223,98,218,87,14,52,203,185,
+    117,79,87,53,189,249,243,134,37,175,229,251,64,41,85,161,21,240,49,13,124,52,134,239,197,11,208,248,238,63,192,115,149,123,244,68,244,196,153,42,248,12,56,87,221,9,230,196,240,176,
+    97,102,135,22,142,159,236,58,142,215,62,160,237,196,89,179,104,189,13,191,166,73,129,189,58,145,192,212,250,62,9,65,188,117,85,48,101,221,154,28,234,131,117,49,165,199,141,27,215,88,
+    124,33,220,5,2,82,30,206,9,60,156,90,84,2,126,220,239,97,9,176,130,99,95,94,20,28,62,104,248,160,17,240,65,238,43,226,239,127,52,124,184,2,198,239,168,217,180,213,173,188,227,91,172,
+    156,197,11,184,242,234,224,42,222,252,81,188,124,56,191,148,58,54,162,154,224,239,25,248,216,209,64,136,239,166,255,90,192,23,48,135,105,193,97,15,2,203,134,44,178,229,93,179,58,62,
+    155,249,217,204,153,159,153,3,135,110,226,234,247,208,151,129,121,247,237,216,17,3,147,146,6,60,225,11,71,231,47,243,2,48,249,14,175,203,217,73,57,59,182,102,77,91,184,49,127,124,156,
+    10,248,98,143,7,97,223,215,90,227,227,78,49,213,104,215,87,1,163,228,36,53,61,181,72,38,33,135,75,124,52,252,35,124,249,232,163,79,62,129,55,195,241,227,147,198,193,232,183,43,109,
+    100,116,124,113,138,170,168,123,149,162,175,107,175,232,135,102,239,109,183,134,250,106,96,223,248,152,202,223,99,218,247,196,197,147,39,47,66,251,123,128,231,176,118,111,116,129,39,
+    176,47,94,130,54,147,223,206,180,122,215,94,255,75,189,79,192,36,44,192,19,208,87,175,16,105,231,72,223,26,79,74,128,239,112,149,170,82,162,209,22,215,31,106,214,33,90,52,6,224,241,
+    86,52,230,20,166,206,221,112,170,208,86,47,26,68,104,120,67,41,76,85,154,38,202,121,190,77,18,120,184,89,68,88,180,248,115,46,211,18,128,138,111,185,28,12,39,224,113,8,172,158,68,199,
+    192,143,168,234,108,149,99,159,55,118,191,202,246,53,39,251,76,2,111,136,59,17,20,62,118,204,169,207,146,192,224,11,113,158,102,177,176,64,171,29,149,146,187,99,185,78,35,237,103,42,
+    2,13,179,6,230,22,217,202,97,158,215,31,147,52,224,3,90,113,120,194,21,86,171,251,78,117,126,162,134,229,251,12,246,176,198,81,166,54,110,236,100,48,248,214,145,36,38,96,109,140,53,
+    122,56,118,147,134,79,148,180,251,132,38,19,225,21,126,12,31,46,125,38,213,207,34,218,255,40,96,46,187,202,119,241,226,197,139,22,113,10,123,131,45,252,19,213,4,7,206,79,202,195,216,
+    43,85,170,82,158,55,85,145,240,29,110,85,246,187,85,121,67,167,52,60,223,82,65,223,231,191,223,0,192,90,216,15,199,247,36,196,37,32,134,33,177,6,54,91,162,39,204,28,59,150,178,246,
+    51,55,12,240,4,95,216,212,105,252,214,152,53,139,58,227,73,73,52,43,109,167,176,51,98,82,11,134,106,9,88,1,215,122,6,11,49,180,175,216,246,170,22,184,134,0,215,169,163,218,225,198,
+    141,233,171,108,9,67,150,82,251,56,220,120,124,162,243,208,34,70,90,145,150,252,133,2,172,243,151,246,59,91,190,178,113,131,86,247,229,67,188,190,128,190,21,241,102,158,74,124,147,
+    134,108,208,80,125,171,80,221,204,121,125,223,7,76,129,222,112,4,128,79,100,205,247,210,165,75,168,124,226,252,113,92,12,86,25,204,37,26,97,103,217,185,171,129,85,95,74,1,15,179,135,
+    200,146,197,152,194,179,168,158,59,192,74,217,204,123,60,33,27,181,12,111,173,90,181,56,131,107,62,131,192,9,9,170,171,92,71,112,109,224,113,84,36,113,165,29,187,59,179,137,152,122,
+    63,147,198,25,152,207,63,31,55,137,58,76,92,105,121,98,77,77,155,14,120,156,242,23,62,38,186,252,223,204,227,45,178,159,59,177,136,219,101,18,110,66,235,251,208,123,166,228,229,168,
+    194,190,178,118,239,116,152,245,100,100,228,132,85,80,216,247,229,2,125,132,128,3,196,255,181,120,201,247,18,242,94,34,226,19,39,142,211,44,214,174,117,86,141,254,140,78,130,35,233,
+    44,253,30,11,143,225,62,151,53,80,54,39,75,105,7,234,176,49,170,186,11,48,8,155,61,209,122,26,146,148,113,190,185,198,64,181,5,235,206,39,159,44,193,190,79,214,124,166,206,51,80,136,
+    199,241,4,32,1,51,173,132,240,142,27,79,227,20,58,97,71,111,199,75,127,75,120,193,68,43,9,240,112,53,117,58,192,154,132,228,230,87,125,83,224,30,216,69,139,230,81,208,31,15,111,23,
+    205,91,148,56,119,17,254,26,95,240,88,31,247,174,200,183,10,101,48,94,175,70,190,118,251,75,184,133,77,238,22,202,149,43,115,93,175,5,182,26,96,13,236,17,159,56,225,249,94,210,190,
+    0,140,194,123,55,110,220,96,54,69,251,190,150,49,232,170,98,237,244,184,120,18,211,1,166,18,13,194,94,3,12,160,240,5,173,225,4,36,39,166,111,137,18,148,193,37,164,18,163,47,213,96,
+    28,246,202,199,32,212,208,87,18,88,159,161,196,159,165,88,79,154,84,107,210,231,110,26,114,130,126,50,92,134,180,3,7,90,147,144,106,116,4,233,249,249,162,217,115,231,225,30,118,237,
+    203,239,233,15,205,155,59,151,78,138,80,227,139,247,91,33,110,165,42,186,68,59,147,25,206,100,100,161,204,42,179,93,161,195,27,224,35,6,88,57,159,240,194,241,149,34,253,11,9,111,224,
+    19,27,11,108,83,121,231,59,79,25,71,77,19,198,120,249,75,115,152,12,60,150,198,89,19,56,133,63,252,32,0,12,37,152,42,50,190,62,3,63,106,213,196,19,103,119,214,170,165,110,200,37,76,
+    147,190,32,202,125,44,116,166,193,145,202,96,98,165,35,148,28,74,24,247,208,168,195,8,86,153,85,195,158,65,222,220,148,158,222,248,28,178,52,222,210,100,219,249,243,83,83,231,115,168,
+    131,34,120,167,37,232,86,229,228,197,27,78,9,88,223,180,88,184,112,94,117,241,83,174,44,244,154,117,242,6,122,208,207,217,13,240,145,35,191,196,157,136,25,212,254,106,222,211,36,252,
+    59,0,31,63,206,41,188,240,187,239,140,48,251,126,135,161,63,194,141,243,103,51,25,120,152,125,242,223,1,150,26,78,192,3,6,120,194,212,75,166,120,178,150,4,36,111,9,122,8,1,190,75,137,
+    170,14,173,39,168,169,104,22,198,217,141,241,122,232,139,190,115,241,28,229,108,47,4,7,74,235,146,121,75,22,125,14,157,98,25,248,200,216,86,17,219,190,147,62,215,160,120,78,129,206,
+    238,181,96,92,60,13,66,47,201,201,107,147,187,137,111,181,74,120,209,52,221,127,202,151,84,243,16,216,207,222,92,214,62,216,44,101,111,12,223,76,128,47,90,190,103,240,229,244,105,16,
+    254,253,247,99,0,188,125,227,134,13,27,214,33,166,149,195,172,251,157,73,97,157,199,246,132,181,149,192,131,135,241,116,165,6,198,245,197,1,142,48,124,85,105,20,84,203,9,188,222,158,
+    142,75,107,96,17,238,146,32,91,115,26,227,202,176,244,157,129,183,46,10,147,239,92,57,13,45,7,102,103,227,155,228,100,97,154,143,57,44,212,144,204,102,84,204,192,131,236,249,171,73,
+    115,77,202,174,85,217,154,154,154,106,142,134,208,241,16,230,117,238,141,175,42,9,92,204,153,225,40,84,200,46,206,183,101,89,55,180,62,115,129,254,229,151,56,24,249,196,224,189,164,
+    243,247,216,25,8,4,254,157,129,143,31,129,28,102,225,89,179,22,136,233,119,10,248,59,183,86,243,196,135,18,86,139,76,116,14,17,123,97,250,183,104,15,8,8,235,1,240,0,234,99,213,120,
+    230,25,5,139,71,241,24,87,157,151,166,150,24,145,5,88,237,189,226,5,36,28,25,97,175,89,120,25,147,207,217,89,135,237,146,241,87,169,186,174,166,152,122,251,185,158,246,208,171,246,
+    52,170,66,225,217,45,102,83,19,75,192,18,169,238,217,159,94,244,236,240,106,158,46,132,246,45,170,58,208,46,111,230,190,55,7,121,67,124,17,216,35,222,105,101,239,197,157,166,245,101,
+    224,211,167,1,248,119,248,15,143,239,32,225,239,191,255,206,143,89,4,172,127,165,133,39,88,192,195,228,132,26,207,117,168,245,198,33,67,120,19,151,154,202,24,48,144,118,106,224,58,
+    81,173,90,67,27,36,214,175,223,76,69,211,166,45,233,80,124,61,172,210,216,215,138,79,136,87,41,156,208,197,90,59,162,254,20,166,48,243,10,102,72,164,90,193,53,87,11,243,104,106,184,
+    94,54,192,130,143,192,244,39,206,11,255,3,187,161,111,229,94,22,111,21,219,183,42,249,22,83,190,102,88,148,53,223,91,67,116,195,124,127,191,61,78,61,229,52,88,155,241,163,155,133,247,
+    204,153,179,103,68,88,128,127,145,28,14,35,246,192,89,120,130,93,163,73,152,239,61,164,73,48,190,170,118,8,159,73,123,255,113,123,178,3,119,226,128,111,131,196,68,124,50,99,219,102,
+    248,8,175,230,168,219,10,133,249,97,96,20,9,9,77,154,36,116,74,104,2,63,235,36,134,247,186,192,200,23,19,24,128,117,178,174,93,155,22,2,140,207,197,241,153,177,99,60,105,156,8,75,240,
+    168,121,118,19,85,221,195,129,187,117,235,209,163,50,62,86,90,128,213,147,242,228,136,47,246,176,76,23,186,136,53,240,205,74,215,217,167,21,222,64,254,254,254,123,220,197,152,161,125,
+    13,176,45,124,228,200,6,34,254,62,166,178,41,210,51,157,34,173,128,39,168,251,91,120,139,52,188,62,110,166,43,7,138,47,0,3,109,171,214,173,36,90,67,180,194,115,211,77,21,50,192,210,
+    88,4,72,155,112,87,11,113,185,215,140,163,34,35,193,143,147,132,128,159,212,73,29,250,101,90,218,218,158,91,28,99,168,193,212,213,166,110,154,90,19,226,89,71,226,37,224,224,185,204,
+    158,221,176,237,197,135,134,139,239,35,22,176,156,220,54,67,36,39,127,179,210,121,142,224,181,125,211,216,247,55,15,248,68,164,239,89,39,133,185,74,163,240,17,37,44,204,97,214,122,
+    192,36,196,106,161,152,124,213,24,24,90,224,33,234,32,154,204,71,243,192,4,124,135,54,104,48,153,120,41,218,232,104,213,138,175,182,104,10,190,137,80,158,229,169,216,216,14,55,73,232,
+    2,233,11,186,24,201,115,103,207,181,117,183,134,135,152,171,128,132,94,11,61,167,185,248,253,161,230,54,199,141,151,121,48,174,207,115,187,234,63,119,173,156,165,238,69,182,157,145,
+    183,71,53,244,85,109,110,177,98,206,205,11,228,235,13,124,11,229,207,159,37,223,72,94,43,127,177,64,255,254,251,233,232,12,134,66,109,234,243,89,11,216,202,97,1,222,224,32,7,133,173,
+    254,244,76,83,165,7,15,83,192,210,199,54,192,143,155,189,26,212,0,67,251,219,150,128,5,246,133,54,47,188,160,136,155,99,52,131,87,124,112,178,185,93,4,145,145,183,91,183,228,228,110,
+    146,188,148,171,234,228,134,31,91,249,116,199,225,45,91,109,97,232,27,3,99,139,22,45,212,21,98,179,155,140,155,45,189,181,185,201,118,250,246,226,78,21,117,155,49,122,208,227,179,116,
+    255,234,145,71,172,203,23,100,12,76,179,148,222,180,198,223,240,213,167,214,129,151,50,76,124,1,248,244,233,184,77,17,201,11,31,48,233,123,25,126,48,177,6,38,225,95,142,88,196,14,243,
+    119,146,207,74,120,193,44,26,77,125,54,211,222,10,32,91,58,198,170,196,86,194,180,162,128,229,153,186,53,207,96,2,39,182,149,228,125,193,4,9,119,111,213,156,141,65,184,43,0,119,131,
+    97,167,204,27,117,162,123,70,214,234,204,221,178,53,128,107,175,145,170,15,168,99,60,72,172,46,137,35,99,136,185,37,226,231,182,208,182,118,243,219,203,4,141,123,69,183,154,185,234,
+    136,158,199,165,127,169,102,161,139,4,120,243,95,99,250,42,222,207,102,65,250,126,247,173,206,95,0,62,125,250,76,220,137,72,96,147,190,151,33,2,192,150,48,24,243,171,159,203,223,217,
+    217,44,194,51,173,73,75,228,165,133,36,170,210,35,38,12,73,26,48,0,115,119,0,246,159,159,224,97,231,208,90,212,195,106,219,150,106,243,11,78,144,112,247,86,173,42,55,111,94,185,57,
+    223,28,211,147,250,55,234,22,153,100,186,134,2,203,174,150,61,154,133,160,71,183,31,166,115,241,106,44,69,247,181,170,78,85,178,167,107,251,234,228,237,43,23,149,81,198,202,3,137,77,
+    10,75,254,74,125,206,159,63,171,190,165,194,117,129,119,22,231,239,6,211,193,58,141,192,153,244,175,148,239,229,115,82,164,79,59,69,90,11,167,29,81,65,198,54,116,160,53,86,59,1,38,
+    176,47,221,210,131,49,98,4,46,248,219,199,87,112,84,130,163,223,6,245,209,55,8,12,209,29,227,33,124,83,185,114,229,158,61,123,246,48,69,146,47,25,193,135,192,242,227,216,13,96,119,
+    245,206,27,239,253,12,113,244,232,207,242,147,147,208,116,144,86,95,79,35,61,170,248,144,46,115,26,124,15,105,96,236,89,245,83,192,42,99,105,89,208,110,129,239,176,243,55,111,86,121,
+    125,95,205,219,1,190,134,192,251,237,247,26,24,133,192,55,10,248,146,221,252,106,96,147,195,1,225,94,70,216,212,108,167,235,245,189,61,235,69,121,140,168,179,120,81,153,178,24,183,
+    87,36,37,37,89,219,17,159,65,223,161,208,133,118,125,95,164,176,137,43,87,198,55,240,218,179,71,15,154,91,128,232,37,188,164,123,244,141,163,248,130,1,148,253,127,230,120,47,24,4,45,
+    196,44,156,166,133,131,35,162,52,106,215,225,255,211,83,120,251,97,244,237,235,2,63,250,40,232,250,192,202,55,175,83,157,99,10,223,90,202,93,245,125,224,57,185,176,128,138,51,127,149,
+    85,254,254,194,190,103,195,129,47,253,176,83,249,94,150,0,224,115,22,176,223,16,11,244,47,1,102,191,243,37,215,46,81,206,210,86,59,58,98,188,128,247,204,242,30,169,65,102,187,233,240,
+    161,67,193,183,126,253,182,170,243,108,124,93,97,29,76,203,196,252,132,238,55,222,56,250,198,27,111,188,248,198,207,38,222,139,25,138,152,114,56,45,173,178,125,197,148,159,187,42,68,
+    23,159,253,110,120,141,48,230,175,13,108,251,58,201,27,203,215,230,125,78,45,251,10,47,167,239,134,13,190,175,0,251,237,239,165,77,8,124,242,146,100,239,229,43,0,12,97,23,105,59,137,
+    221,8,19,182,71,203,124,191,37,103,50,248,210,109,136,250,2,147,17,106,67,34,77,29,1,111,131,6,13,44,224,23,108,96,163,108,249,226,47,25,184,127,255,62,125,250,191,241,246,27,18,33,
+    178,191,98,4,222,245,132,183,246,178,110,138,115,80,105,248,44,29,115,248,70,122,9,67,249,86,119,124,31,117,74,52,37,176,236,99,207,235,238,164,203,31,139,183,148,63,167,225,241,42,
+    95,25,1,19,240,185,176,12,62,105,234,179,246,181,128,165,163,101,165,112,180,242,6,221,34,59,19,34,11,22,170,187,166,23,126,71,7,233,39,26,97,53,221,139,201,171,125,131,192,175,216,
+    194,218,87,55,205,47,1,239,139,47,190,161,227,231,55,188,220,253,21,95,108,95,27,249,103,213,173,230,206,180,125,255,144,53,138,166,158,219,86,244,85,188,47,169,250,28,244,125,212,
+    246,45,198,192,198,55,147,137,171,2,5,162,120,233,162,167,239,190,87,89,164,251,207,12,124,246,220,185,184,75,209,237,239,89,193,189,114,229,202,229,43,127,24,224,51,129,34,29,51,145,
+    143,240,55,150,40,227,5,136,223,169,203,166,241,158,56,117,101,45,29,232,155,56,81,118,72,49,47,251,182,109,219,206,204,111,144,239,43,24,94,161,214,209,7,227,197,23,251,240,247,193,
+    43,38,125,77,125,54,158,193,48,192,71,205,197,7,60,225,181,54,45,124,150,164,191,7,108,95,230,204,151,210,61,250,104,49,23,88,250,207,89,153,183,42,80,192,241,13,242,126,167,120,181,
+    47,38,240,111,152,192,151,1,248,210,73,53,175,225,240,94,146,238,243,21,21,4,124,54,0,140,198,162,252,123,12,228,35,71,186,126,127,68,17,47,212,215,119,174,91,56,103,221,66,186,102,
+    106,34,31,8,18,223,201,147,71,14,29,58,18,98,242,228,201,237,56,218,91,77,240,43,28,47,26,230,176,192,79,121,21,227,149,215,32,94,255,249,245,215,197,247,231,247,98,0,255,42,192,135,
+    15,31,181,46,182,208,215,15,5,112,15,115,75,111,21,232,234,213,171,186,9,172,149,205,36,135,229,155,57,111,129,172,243,42,95,105,129,49,131,49,192,245,196,137,147,246,214,13,213,125,
+    190,114,229,170,1,166,20,134,255,242,180,39,236,68,38,169,44,73,44,151,17,243,69,128,11,209,150,79,4,241,234,28,176,142,148,152,50,197,6,238,221,187,119,31,237,107,231,177,197,26,240,
+    125,237,85,244,197,144,18,253,107,204,208,192,246,213,37,122,206,218,189,200,4,194,248,246,173,166,210,55,4,248,209,16,224,188,89,41,206,124,96,223,157,144,244,120,55,104,94,93,160,
+    17,24,125,175,196,93,10,13,106,126,207,98,250,94,189,202,175,82,163,207,158,115,251,89,63,135,26,255,30,93,177,55,218,194,116,57,49,222,255,166,246,40,114,124,52,25,159,37,132,209,
+    144,109,149,47,2,131,176,214,125,129,133,95,113,146,214,196,171,226,251,234,107,74,216,24,135,43,191,23,0,182,110,167,241,102,194,142,26,223,176,242,28,69,76,23,136,234,6,56,115,93,
+    199,183,172,205,107,233,42,94,203,151,90,224,203,161,192,103,84,239,138,124,175,210,171,74,225,115,63,159,60,107,128,25,121,107,22,83,89,148,133,152,239,35,150,251,16,23,46,0,223,57,
+    116,127,39,38,240,244,233,83,166,64,238,78,193,244,109,223,174,61,71,155,54,237,219,247,214,194,92,123,95,125,37,42,28,92,29,130,108,247,162,163,50,248,232,97,251,80,173,155,181,228,
+    219,227,37,59,125,251,169,242,156,137,47,1,223,81,36,243,4,86,247,2,63,16,228,229,59,52,191,15,231,53,190,103,206,40,224,62,59,93,94,237,123,21,227,207,171,44,204,53,250,228,111,246,
+    96,24,227,183,159,99,148,236,80,99,92,71,222,5,47,250,206,90,60,198,246,201,156,207,249,130,86,96,5,95,52,6,223,169,237,53,111,155,222,109,124,96,142,8,92,166,125,213,215,125,93,167,
+    242,175,215,0,124,56,176,68,113,180,114,143,128,175,255,140,245,168,10,77,67,164,44,249,150,186,86,94,242,229,22,248,212,89,80,139,59,115,230,210,153,255,158,12,229,21,223,191,174,
+    58,41,124,78,186,210,212,26,159,57,125,242,183,211,14,119,208,217,19,198,237,62,123,229,210,90,124,75,15,234,92,248,249,66,217,200,136,180,24,163,71,79,153,50,26,31,218,56,85,1,247,
+    238,45,53,26,43,241,171,118,188,162,127,178,62,174,93,95,189,70,99,0,62,26,125,247,144,37,252,78,116,121,246,230,57,108,224,42,144,192,170,5,206,44,123,85,250,62,167,159,3,98,112,221,
+    166,87,241,42,95,26,3,35,90,220,89,89,204,103,91,124,223,245,253,235,47,2,86,173,240,57,189,112,168,227,180,96,43,222,147,33,204,190,240,241,189,123,205,149,136,187,211,119,201,69,
+    172,139,23,47,158,62,125,6,196,84,59,68,184,189,221,8,191,26,18,175,189,248,138,95,146,9,213,251,69,102,196,42,129,51,11,171,247,76,221,103,75,55,48,16,182,124,171,64,23,43,179,4,118,
+    210,23,147,247,154,120,209,151,186,88,104,24,135,11,69,138,234,172,158,152,84,229,25,125,141,240,57,37,108,144,241,157,83,142,246,207,63,71,230,242,239,174,177,82,198,71,37,255,68,
+    55,222,175,132,88,181,10,125,167,77,155,134,111,44,96,14,170,209,26,24,211,211,201,228,215,130,241,234,125,175,7,200,99,17,187,195,224,76,137,245,248,215,224,246,237,107,242,217,7,
+    174,138,79,56,194,4,206,89,32,26,216,164,47,225,58,181,57,76,87,241,234,244,229,4,62,135,136,113,236,105,100,213,216,23,72,47,139,175,6,102,97,131,140,113,74,121,159,181,74,119,52,
+    177,70,70,226,29,59,118,128,47,30,87,220,191,63,3,149,241,129,186,43,150,47,95,5,188,211,62,197,55,83,129,120,121,123,79,216,202,96,85,132,3,117,217,2,126,49,228,131,49,132,173,169,
+    202,76,144,237,2,173,167,160,81,151,126,213,207,94,47,180,124,171,208,37,252,244,164,211,204,210,215,121,232,156,151,188,65,93,43,125,217,215,6,14,225,189,122,245,181,179,127,253,229,
+    9,83,149,62,119,230,220,169,83,231,78,157,101,104,110,152,149,122,150,140,213,158,174,227,199,241,238,75,14,186,233,116,31,198,138,21,96,188,108,217,242,105,20,203,150,47,111,191,172,
+    119,239,152,192,6,249,181,48,204,215,94,187,6,98,119,65,41,120,63,77,88,133,238,167,250,208,253,84,152,70,57,152,192,143,148,227,7,104,132,3,23,208,190,246,67,5,189,228,13,218,42,94,
+    246,149,49,48,1,95,185,226,227,74,113,86,233,235,10,99,18,159,121,5,73,127,59,123,78,199,101,59,179,131,196,90,217,209,230,59,214,140,47,2,239,4,224,205,43,246,45,243,194,2,22,225,
+    232,140,125,45,244,131,49,145,127,126,207,109,130,93,96,205,236,105,155,2,45,57,172,112,217,28,219,101,183,74,87,247,128,221,43,84,92,95,251,153,145,94,203,27,76,93,173,171,125,37,
+    129,175,92,61,23,119,197,11,165,11,189,103,31,248,170,154,210,186,114,206,178,165,249,106,83,189,253,249,76,27,249,244,209,62,150,48,159,100,59,65,183,246,156,223,140,198,146,194,251,
+    150,197,16,238,125,77,192,153,244,185,148,240,43,30,112,216,165,22,71,67,124,125,224,151,220,232,103,55,196,213,171,227,243,82,164,66,123,192,49,120,159,119,147,55,4,247,23,43,105,
+    240,203,220,7,187,189,0,241,7,106,254,17,167,216,60,94,59,125,93,97,248,198,56,247,7,252,160,63,192,11,147,199,186,131,237,16,255,246,155,253,43,58,202,166,148,79,28,58,116,224,192,
+    62,1,94,22,14,220,187,119,111,219,55,11,201,26,4,126,197,237,115,49,176,221,6,227,124,117,56,48,14,132,13,114,127,71,56,52,250,73,18,203,131,6,139,1,112,213,172,0,71,241,178,237,203,
+    17,184,38,125,77,2,67,137,190,26,26,127,5,66,126,227,202,185,179,108,121,57,144,248,14,242,57,123,52,229,32,243,240,25,95,128,248,210,165,19,199,46,209,5,47,0,124,232,192,206,157,88,
+    164,127,252,49,66,216,245,205,122,41,118,180,95,13,43,211,1,224,136,187,105,116,30,191,35,192,97,194,230,163,253,220,185,15,244,101,224,50,62,112,129,27,110,43,224,248,6,167,52,84,
+    242,190,20,138,171,120,9,248,172,6,62,23,2,252,231,95,161,161,127,63,212,213,250,173,63,20,241,41,111,192,28,18,120,92,145,215,179,240,6,189,67,59,49,34,128,123,91,192,158,240,235,
+    89,107,135,95,125,229,245,200,118,216,0,159,52,192,17,202,232,43,192,47,225,139,107,171,195,74,97,61,42,174,102,3,231,143,78,95,183,237,117,150,18,14,135,225,26,94,90,68,50,9,12,25,
+    108,215,229,176,212,13,10,95,13,212,115,255,183,206,133,164,49,143,154,105,96,117,198,234,111,243,4,218,197,147,120,209,26,249,238,12,243,229,28,246,128,21,81,40,156,46,201,177,251,
+    211,175,251,192,191,157,252,249,100,224,58,139,255,30,61,22,108,137,5,216,49,245,128,49,135,109,96,122,18,59,61,72,178,76,1,55,133,11,132,87,103,208,237,230,174,20,133,216,254,238,
+    20,200,179,47,158,166,175,61,1,253,1,192,167,174,254,249,231,159,248,138,134,127,254,121,234,175,191,254,204,84,56,88,207,3,250,86,31,251,172,23,220,51,83,91,113,213,201,114,16,86,
+    192,81,194,225,192,175,101,173,88,191,26,123,180,100,128,33,66,174,44,9,0,247,207,60,66,129,31,49,192,249,61,95,190,137,191,172,219,115,126,249,229,151,77,238,198,180,149,246,151,71,
+    173,42,1,227,124,196,215,254,186,122,42,11,73,28,150,244,17,105,236,5,246,185,101,31,223,57,66,86,196,23,47,106,224,31,195,129,151,69,180,193,175,191,118,237,241,250,171,175,58,243,
+    210,194,251,27,1,159,12,191,151,38,152,193,97,225,244,192,130,192,229,52,176,74,226,2,230,233,211,62,47,102,111,183,208,212,13,14,82,78,235,34,169,186,208,136,195,192,103,255,250,43,
+    118,109,182,222,191,242,71,116,119,44,208,78,255,225,243,170,223,160,62,154,202,99,46,212,23,89,56,202,87,103,113,31,107,162,50,96,27,179,239,245,122,140,16,222,223,78,11,240,201,176,
+    219,105,142,133,101,176,121,223,27,35,247,247,103,169,177,9,86,37,186,76,1,63,74,121,217,251,188,217,195,110,243,158,14,15,211,8,210,204,147,242,253,203,205,224,171,151,67,129,47,71,
+    48,210,175,78,185,3,230,115,167,130,93,177,144,161,54,14,183,240,45,10,159,185,116,70,114,56,83,96,36,238,243,163,13,204,97,21,225,87,174,81,214,0,159,194,73,117,190,166,130,7,111,
+    129,11,106,156,4,206,194,74,4,119,180,194,129,203,20,114,121,29,95,187,107,101,243,134,77,46,24,93,149,190,58,127,3,192,215,20,2,123,14,94,47,159,141,213,25,11,31,103,243,50,51,150,
+    107,252,107,201,206,33,37,28,131,248,199,31,95,177,102,158,67,177,148,42,228,247,235,89,13,244,61,133,196,60,60,247,238,166,113,132,15,103,45,12,112,95,15,184,92,17,31,184,148,219,
+    119,54,163,94,127,146,57,58,119,45,223,43,214,82,224,223,7,182,81,175,158,11,155,21,81,111,195,186,220,248,13,194,191,47,117,218,164,48,11,255,24,13,252,163,221,133,254,255,20,191,
+    94,58,37,192,103,228,58,176,72,223,172,10,135,164,176,2,38,97,24,43,241,35,97,237,105,201,14,37,229,0,40,249,222,30,205,27,24,113,158,85,188,231,174,252,255,1,142,114,207,172,207,109,
+    218,109,22,86,211,224,40,188,211,2,142,32,166,223,137,225,251,234,223,243,69,220,179,81,192,6,249,90,50,56,36,133,9,24,133,203,176,48,133,191,168,96,102,173,220,37,192,159,195,97,149,
+    173,226,117,242,247,47,24,38,217,153,119,234,175,152,35,97,7,240,175,168,25,17,249,93,7,249,143,88,157,50,3,124,114,103,108,98,248,8,3,51,174,198,124,37,115,224,152,201,206,233,123,
+    22,95,34,128,173,20,62,124,141,192,150,48,141,131,11,150,163,167,178,151,41,82,164,72,8,239,243,54,239,239,191,248,147,24,22,167,63,248,196,23,47,125,3,192,103,253,98,27,202,230,182,
+    193,17,113,206,249,20,41,202,127,134,117,224,174,90,41,44,57,108,136,127,12,100,47,6,249,190,114,77,245,249,242,159,49,126,243,212,169,203,151,79,225,118,7,1,150,189,226,23,67,125,
+    143,250,11,135,215,32,252,104,149,71,233,146,187,114,148,197,2,236,172,231,31,217,240,189,115,64,65,233,254,230,208,158,59,119,230,148,94,173,245,71,41,146,73,108,21,23,161,23,214,
+    157,50,191,134,209,114,104,111,251,111,244,212,46,235,26,237,10,107,227,16,223,31,41,29,175,169,24,159,186,46,46,102,254,202,158,135,179,103,213,228,154,190,137,198,47,208,42,133,123,
+    100,29,216,8,227,178,18,10,87,33,226,114,236,235,12,125,227,242,225,65,235,192,254,12,165,171,37,79,157,13,204,48,252,97,119,100,255,146,98,252,255,0,31,173,242,213,84,250,229,151,
+    0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,241,79,84,84,79,0,12,0,
+    128,0,3,0,64,67,70,70,32,110,107,78,158,0,0,13,16,0,0,102,92,71,68,69,70,29,125,29,163,0,0,115,108,0,0,1,54,71,80,79,83,30,172,113,184,0,0,116,164,0,0,60,104,71,83,85,66,237,81,41,
+    229,0,0,177,12,0,0,11,194,79,83,47,50,89,2,241,130,0,0,1,48,0,0,0,96,99,109,97,112,35,126,40,112,0,0,7,204,0,0,5,36,104,101,97,100,30,195,108,251,0,0,0,204,0,0,0,54,104,104,101,97,
+    9,212,7,8,0,0,1,4,0,0,0,36,104,109,116,120,62,14,81,214,0,0,188,208,0,0,7,224,109,97,120,112,1,248,80,0,0,0,1,40,0,0,0,6,110,97,109,101,63,106,212,237,0,0,1,144,0,0,6,60,112,111,115,
+    116,255,64,0,80,0,0,12,240,0,0,0,32,0,1,0,0,0,2,0,0,153,141,170,112,95,15,60,245,0,3,3,232,0,0,0,0,221,23,225,123,0,0,0,0,221,24,71,102,255,52,255,23,6,71,4,32,0,0,0,6,0,2,0,0,24,0,
+    240,3,0,1,0,0,3,242,255,16,0,100,6,203,255,52,255,52,6,71,18,0,1,26,0,3,5,0,81,1,248,0,0,80,6,0,242,3,0,4,2,40,1,244,0,5,0,0,2,138,2,88,0,0,0,75,8,0,99,1,94,0,50,1,44,47,0,1,7,0,64,
+    128,0,0,71,187,0,1,13,0,210,0,0,0,73,84,70,79,0,192,0,32,251,4,108,0,128,3,242,0,240,32,0,0,147,32,0,242,1,1,233,2,211,0,0,0,32,0,12,0,0,0,24,1,38,128,0,68,1,0,0,31,66,0,99,1,1,0,11,
+    0,31,24,0,83,2,0,11,0,42,12,0,243,2,3,0,11,0,53,0,3,0,1,4,9,0,0,0,122,0,64,12,0,83,1,0,28,0,186,12,0,83,2,0,14,0,214,12,0,83,3,0,50,0,228,12,0,23,4,36,0,83,5,0,26,1,22,24,0,83,6,0,
+    28,1,48,12,0,83,7,0,100,1,76,12,0,83,8,0,38,1,176,12,0,68,9,0,24,1,84,0,83,11,0,58,1,238,24,0,83,12,0,66,2,40,12,0,83,13,1,220,2,106,12,0,83,14,0,54,4,70,12,0,83,16,0,14,4,124,12,0,
+    82,17,0,12,4,138,12,0,99,1,0,0,62,4,150,12,0,83,1,0,22,4,212,12,0,83,2,0,22,4,234,12,0,246,21,3,0,22,5,0,65,108,116,101,114,110,97,116,101,32,71,44,32,97,44,32,114,101,103,105,115,
+    116,101,114,101,100,32,115,105,103,110,31,0,22,103,11,0,22,116,11,0,241,16,81,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,55,0,45,10,0,241,20,50,0,49,
+    0,32,0,73,0,110,0,100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,117,28,0,247,0,114,0,121,0,46,0,32,0,65,0,108,0,108,0,32,82,0,17,115,14,0,241,18,101,0,115,0,101,
+    0,114,0,118,0,101,0,100,0,46,0,83,0,97,0,116,0,111,0,115,0,104,0,105,0,32,0,77,24,0,241,10,105,0,117,0,109,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,50,0,46,0,48,2,0,187,59,0,73,0,
+    84,0,70,0,79,0,59,64,0,25,45,64,0,17,86,106,0,81,115,0,105,0,111,176,0,6,66,0,10,118,0,10,54,0,10,28,0,49,32,0,105,186,0,241,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,146,0,113,
+    107,0,32,0,111,0,102,26,0,17,104,8,1,15,32,1,21,15,40,0,19,81,68,0,101,0,110,22,1,113,65,0,110,0,103,0,103,118,0,17,97,160,1,209,116,0,112,0,115,0,58,0,47,0,47,0,105,122,1,2,150,1,
+    19,116,148,1,27,102,146,1,93,99,0,111,0,109,58,0,17,119,2,0,31,46,66,0,24,17,84,168,1,0,18,1,0,244,1,17,110,42,2,17,83,6,1,49,116,0,119,160,0,0,16,2,2,52,1,177,112,0,114,0,111,0,116,
+    0,101,0,99,6,0,51,100,0,32,38,2,0,2,2,49,32,0,100,148,0,0,18,2,113,116,0,105,0,99,0,32,88,2,0,38,0,0,210,0,0,56,0,49,114,0,110,32,2,2,194,1,17,97,82,2,15,134,1,1,0,144,2,0,56,0,0,230,
+    0,12,200,2,0,62,2,17,119,148,2,17,89,20,1,0,102,0,81,103,0,114,0,101,178,1,0,124,2,0,228,1,0,214,1,0,206,0,89,105,0,102,0,121,210,1,0,106,2,17,32,80,1,0,32,0,0,250,0,17,98,34,0,0,154,
+    0,17,109,68,0,6,126,0,0,86,0,0,32,3,0,64,3,6,20,2,0,66,0,17,39,70,2,83,111,0,119,0,110,150,2,0,240,2,29,112,66,2,14,222,0,0,114,0,6,98,0,12,168,3,0,30,0,0,46,1,0,214,0,17,110,152,0,
+    0,202,0,0,244,2,17,103,244,2,53,111,0,114,138,1,49,100,0,117,138,1,2,78,1,49,32,0,99,6,1,2,176,0,61,115,0,46,30,2,6,244,0,19,104,218,1,17,46,98,1,49,109,0,47,208,1,91,114,0,109,0,115,
+    130,3,8,192,3,0,4,4,8,198,1,0,26,2,49,71,0,44,232,1,0,6,0,0,46,1,17,103,96,3,2,38,0,0,18,4,21,32,188,0,15,62,0,1,17,103,88,4,2,46,0,0,128,1,0,10,0,0,152,3,15,44,0,1,18,81,254,6,96,
+    0,3,0,0,0,20,46,5,1,8,0,241,136,4,5,16,0,0,0,138,0,128,0,6,0,10,0,47,0,57,0,126,0,169,0,172,0,185,1,35,1,43,1,49,1,55,1,72,1,77,1,107,1,126,1,146,1,255,2,27,2,55,2,199,2,221,3,4,3,
+    8,3,12,3,18,3,39,3,53,3,56,3,169,3,192,30,133,30,243,32,20,32,26,32,30,32,34,32,38,32,48,32,50,32,58,32,66,32,68,32,112,32,121,32,137,32,172,33,23,33,34,33,46,33,94,33,153,34,2,34,
+    6,34,15,34,18,34,26,34,30,34,43,34,72,34,96,34,101,37,161,37,179,37,203,37,207,38,46,39,19,248,255,251,4,255,255,238,6,241,36,48,0,58,0,161,0,171,0,174,0,187,1,38,1,46,1,52,1,57,1,
+    74,1,80,1,110,1,146,1,250,2,24,2,55,2,198,2,216,3,0,3,6,3,10,3,18,3,38,3,53,3,55,140,0,179,128,30,242,32,19,32,24,32,28,32,32,140,0,19,57,140,0,113,116,32,128,32,172,33,22,140,0,183,
+    91,33,144,34,2,34,5,34,15,34,17,140,0,117,100,37,160,37,178,37,202,140,0,17,0,140,0,16,216,134,7,15,4,0,1,32,255,229,22,0,32,255,166,6,0,2,4,0,176,254,177,254,158,254,188,0,0,253,93,
+    253,224,7,80,0,0,0,225,87,26,0,241,49,225,45,225,98,225,132,225,49,225,11,225,0,224,202,224,202,224,156,224,202,0,0,224,139,224,133,223,237,0,0,223,142,0,0,223,125,0,0,223,116,223,
+    107,223,95,223,61,223,31,0,0,220,0,219,240,0,0,219,206,219,118,218,146,8,215,234,7,240,30,138,0,0,0,166,1,46,1,62,1,64,1,86,2,38,2,48,2,54,2,60,2,90,2,96,2,150,0,0,2,180,2,190,0,0,
+    2,194,2,196,2,206,2,214,2,218,118,0,49,0,0,2,188,0,194,2,214,2,224,2,226,0,0,2,226,2,230,24,0,10,6,0,34,2,214,16,0,32,2,210,36,0,2,4,0,2,18,0,34,0,0,74,0,2,72,0,0,20,0,0,36,0,240,255,
+    255,205,1,114,1,84,1,90,1,86,1,117,1,145,1,167,1,91,1,99,1,100,1,76,1,122,1,82,1,103,1,87,1,93,1,81,1,92,1,129,1,126,1,128,1,88,1,166,0,1,0,14,0,15,0,21,0,25,0,35,0,36,0,41,0,43,0,
+    52,0,54,0,56,0,62,0,63,0,69,0,80,0,82,0,83,0,87,0,93,0,98,0,108,0,109,0,114,0,115,0,120,1,97,1,78,1,98,1,181,1,94,1,206,0,125,0,138,0,139,0,145,0,149,0,159,0,160,0,165,0,167,0,176,
+    0,178,0,180,0,186,0,187,0,193,0,204,0,206,0,207,0,211,0,218,0,223,0,233,0,234,0,239,0,240,0,245,1,95,1,175,1,96,1,134,1,85,1,115,1,120,1,116,1,121,1,176,1,169,1,204,1,170,1,104,1,135,
+    1,171,1,208,1,174,1,132,1,60,1,61,1,199,1,143,1,168,1,79,1,202,1,59,1,105,1,70,1,69,1,71,1,89,0,6,0,2,0,4,0,11,0,5,0,9,0,12,0,18,0,32,0,26,0,29,0,30,0,48,0,44,0,45,0,46,0,22,0,68,0,
+    73,0,70,0,71,0,78,0,72,1,124,0,76,0,102,0,99,0,100,0,101,0,116,0,81,0,217,0,130,0,126,0,128,0,135,0,129,0,133,0,136,0,142,0,156,0,150,0,153,0,154,0,172,0,168,0,169,0,170,0,146,0,192,
+    0,197,0,194,0,195,0,202,0,196,1,125,0,200,0,227,0,224,0,225,0,226,0,241,0,205,0,243,0,7,0,131,0,3,0,127,0,8,0,132,0,16,0,140,0,19,0,143,0,20,0,144,0,17,0,141,0,23,0,147,0,24,0,148,
+    0,33,0,157,0,27,0,151,0,31,0,155,0,34,0,158,0,28,0,152,0,38,0,162,0,37,0,161,0,40,0,164,0,39,0,163,0,42,0,166,0,51,0,175,0,49,0,173,0,50,0,174,0,47,1,220,0,53,0,177,0,55,0,179,0,57,
+    0,181,0,59,0,183,0,58,0,182,0,60,0,184,0,61,0,185,0,64,0,188,0,66,0,190,0,65,0,189,0,67,0,191,0,75,0,199,0,74,0,198,0,79,0,203,0,84,0,208,0,86,0,210,0,85,0,209,0,88,0,212,0,91,0,215,
+    0,90,0,214,0,89,0,213,0,96,0,221,0,95,0,220,0,94,0,219,0,107,0,232,0,104,0,229,0,106,0,231,0,103,0,228,0,105,0,230,0,111,0,236,0,117,0,242,0,118,0,121,0,246,0,123,0,248,0,122,0,247,
+    0,10,0,134,0,13,0,137,0,77,0,201,0,92,0,216,0,97,0,222,1,203,1,201,1,200,1,205,1,210,1,209,1,211,1,207,1,186,1,187,1,189,1,193,1,194,1,191,1,185,1,184,1,192,1,188,1,190,1,242,1,198,
+    0,113,0,238,0,110,0,235,0,112,0,237,0,119,0,244,1,102,1,101,1,109,1,110,1,108,1,177,1,178,1,80,1,180,1,172,1,153,1,147,1,149,1,151,1,155,1,156,1,154,1,148,1,150,1,152,1,136,1,139,1,
+    141,1,123,1,131,1,130,1,159,1,158,0,252,1,1,1,2,0,253,0,254,0,3,226,2,98,0,0,255,61,0,80,10,0,10,6,0,240,8,1,0,4,2,0,1,1,1,15,83,97,116,111,115,104,105,45,77,101,100,105,117,109,19,
+    0,240,43,64,249,45,0,249,46,1,249,47,12,0,249,48,2,249,49,3,248,23,4,251,87,12,3,219,12,4,251,96,251,125,29,0,0,6,71,250,180,5,29,0,0,28,99,15,29,0,0,31,94,16,177,29,0,0,93,100,18,
+    13,0,242,255,255,145,96,17,1,23,2,0,1,0,7,0,14,0,21,0,31,0,38,0,44,0,50,0,61,0,71,0,77,0,83,0,89,0,95,0,105,0,112,0,119,0,125,0,136,0,148,0,158,0,162,0,172,0,179,0,186,0,192,0,203,
+    0,215,0,221,0,227,0,239,0,243,0,249,0,255,1,11,1,14,1,27,1,34,1,45,1,51,1,57,1,69,1,75,1,83,1,94,1,106,1,110,1,116,1,124,1,136,1,149,1,156,1,163,1,168,1,174,1,180,1,191,1,200,1,206,
+    1,217,1,223,1,229,1,239,1,245,1,251,2,2,2,9,2,19,2,26,2,32,2,38,2,49,2,59,2,65,2,71,2,77,2,83,2,93,2,100,2,107,2,113,2,124,2,136,2,146,2,150,2,160,2,167,2,174,2,180,2,191,2,203,2,209,
+    2,215,2,227,2,231,2,237,2,243,2,255,3,2,3,15,3,22,3,33,3,39,3,45,3,57,3,63,3,71,3,82,3,94,3,98,3,104,3,112,3,124,3,137,3,144,3,151,3,156,3,162,3,168,3,179,3,188,3,194,3,205,3,211,3,
+    217,3,227,3,233,3,239,3,245,3,248,3,253,4,2,4,5,4,8,4,11,4,14,4,17,4,22,4,24,4,31,4,37,4,43,4,51,4,58,4,65,4,71,4,79,4,87,4,94,4,107,4,119,4,131,4,145,4,158,4,171,4,183,4,197,4,211,
+    4,224,4,233,4,241,4,249,5,3,5,12,5,21,5,29,5,39,5,49,5,58,5,67,5,75,5,83,5,93,5,102,5,111,5,119,5,129,5,139,5,148,5,161,5,174,5,187,5,199,5,213,5,227,5,240,5,248,5,252,6,4,6,16,6,25,
+    6,36,6,44,6,52,6,60,6,69,6,76,6,85,6,92,6,97,6,108,6,115,6,122,6,132,6,139,6,148,6,155,6,164,6,171,6,180,6,189,6,200,6,206,6,213,6,222,6,233,6,240,6,255,7,4,7,9,7,23,7,32,7,38,7,44,
+    7,59,7,71,7,84,7,93,7,102,7,118,7,132,7,141,7,150,7,158,7,167,7,177,7,197,7,212,7,223,7,236,7,255,8,19,8,22,8,33,8,49,8,66,8,81,8,87,8,95,8,106,8,117,8,133,8,147,8,158,8,170,8,182,
+    8,192,8,207,8,218,8,229,8,245,9,6,9,21,9,30,9,41,9,54,9,71,9,84,9,99,9,113,9,133,9,152,9,171,9,189,9,204,9,207,10,1,10,62,10,76,10,83,65,98,114,101,118,101,65,109,97,99,114,111,110,
+    65,111,103,111,110,101,107,65,114,105,110,103,97,99,117,116,101,65,69,97,99,117,116,101,67,97,99,117,116,101,67,99,97,114,111,110,67,99,105,114,99,117,109,102,108,101,120,67,100,111,
+    116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,111,97,116,69,98,114,101,118,101,69,99,97,114,111,110,69,100,111,116,97,99,99,101,110,116,69,98,0,18,69,98,0,118,71,98,114,101,
+    118,101,71,75,0,98,71,99,111,109,109,97,43,0,21,71,53,0,85,72,98,97,114,73,14,0,18,73,67,0,18,73,67,0,118,73,116,105,108,100,101,74,67,0,23,75,67,0,17,76,177,0,17,76,150,0,24,76,24,
+    0,65,100,111,116,78,28,0,17,78,28,0,23,78,28,0,242,2,69,110,103,79,104,117,110,103,97,114,117,109,108,97,117,116,79,111,0,97,79,115,108,97,115,104,52,0,18,82,6,0,1,58,0,23,82,58,0,
+    17,83,24,0,150,83,99,101,100,105,108,108,97,83,147,0,23,83,37,0,81,84,98,97,114,84,59,0,19,84,41,0,23,84,30,0,24,85,122,0,18,85,122,0,18,85,233,0,97,85,114,105,110,103,85,238,0,17,
+    87,105,0,22,87,97,0,246,1,87,100,105,101,114,101,115,105,115,87,103,114,97,118,101,89,26,0,17,89,17,0,17,90,49,0,21,90,67,1,113,71,46,115,115,48,49,97,126,1,18,97,102,0,18,97,102,0,
+    16,97,102,0,1,46,0,33,97,101,7,0,18,99,6,0,1,178,0,22,99,88,0,21,99,76,0,17,100,27,0,113,100,99,114,111,97,116,101,82,0,17,101,18,0,21,101,34,0,18,101,98,0,18,101,98,0,17,103,36,0,
+    22,103,75,0,23,103,0,1,21,103,53,0,85,104,98,97,114,105,14,0,18,105,67,0,18,105,67,0,17,105,6,1,22,106,67,0,23,107,67,0,17,108,177,0,17,108,132,0,24,108,24,0,65,100,111,116,110,28,
+    0,17,110,28,0,23,110,28,0,72,101,110,103,111,122,1,18,111,111,0,22,111,244,1,17,114,58,0,17,114,58,0,23,114,58,0,17,115,24,0,19,115,203,1,22,115,147,0,23,115,37,0,81,116,98,97,114,
+    116,59,0,19,116,41,0,23,116,30,0,24,117,122,0,18,117,122,0,18,117,233,0,16,117,142,1,17,117,238,0,17,119,105,0,22,119,97,0,20,119,244,1,17,119,227,1,22,121,26,0,17,121,17,0,17,122,
+    49,0,21,122,67,1,17,97,244,1,16,103,6,0,32,50,116,6,0,144,51,102,95,102,102,95,102,95,105,5,0,240,23,108,102,95,116,102,95,121,116,95,105,116,95,116,116,95,121,79,109,101,103,97,112,
+    105,122,101,114,111,46,116,102,111,110,101,46,116,102,116,119,12,0,64,116,104,114,101,14,0,160,102,111,117,114,46,116,102,102,105,118,14,0,241,9,115,105,120,46,116,102,115,101,118,
+    101,110,46,116,102,101,105,103,104,116,46,116,102,110,105,57,0,1,70,0,128,105,110,102,101,114,105,111,114,76,0,4,12,0,0,82,0,5,12,0,1,88,0,4,14,0,1,94,0,5,13,0,0,100,0,4,13,0,0,106,
+    0,5,12,0,1,112,0,4,14,0,2,118,0,4,14,0,1,124,0,4,13,0,1,130,0,64,100,110,111,109,126,0,0,8,0,0,122,0,1,8,0,1,118,0,0,10,0,1,114,0,1,9,0,0,110,0,0,9,0,0,106,0,1,8,0,1,102,0,0,10,0,2,
+    98,0,0,10,0,1,94,0,0,9,0,1,90,0,49,110,117,109,216,0,0,8,0,0,90,0,1,8,0,1,90,0,0,10,0,1,90,0,1,9,0,0,90,0,0,9,0,0,90,0,1,8,0,1,90,0,0,10,0,2,90,0,0,10,0,1,90,0,0,9,0,1,90,0,49,115,
+    117,112,54,1,1,68,0,5,13,0,0,72,0,4,13,0,0,76,0,5,12,0,1,80,0,4,14,0,2,84,0,4,14,0,1,88,0,4,13,0,16,97,196,18,240,4,105,115,109,69,117,114,111,110,111,116,101,113,117,97,108,103,114,
+    101,97,218,18,0,12,0,65,108,101,115,115,21,0,97,97,112,112,114,111,120,11,0,241,71,101,109,112,116,121,115,101,116,105,110,102,105,110,105,116,121,105,110,116,101,103,114,97,108,105,
+    110,99,114,101,109,101,110,116,112,114,111,100,117,99,116,115,117,109,109,97,116,105,111,110,114,97,100,105,99,97,108,109,105,99,114,111,112,97,114,116,105,97,108,100,105,102,102,97,
+    114,114,111,119,117,112,97,114,114,111,119,78,69,14,0,16,114,48,2,1,10,0,33,83,69,7,0,65,100,111,119,110,9,0,33,83,87,7,0,65,108,101,102,116,9,0,18,78,16,0,65,98,111,116,104,16,0,64,
+    117,112,100,110,250,2,114,108,101,98,108,97,99,107,11,0,240,19,108,111,122,101,110,103,101,102,105,108,108,101,100,98,111,120,115,113,117,97,114,101,119,104,105,116,101,116,114,105,
+    97,103,117,112,7,0,97,110,103,108,101,117,112,22,0,241,4,112,101,97,99,101,99,104,101,99,107,115,111,117,110,100,99,111,112,121,147,0,240,4,101,115,116,105,109,97,116,101,100,110,117,
+    109,101,114,111,109,105,110,117,34,1,4,3,20,0,70,3,20,49,135,3,69,99,111,109,98,109,3,0,13,0,1,134,3,0,9,0,1,137,3,0,9,0,8,233,3,0,16,0,0,174,0,2,67,7,1,14,0,0,42,7,0,9,0,1,33,5,0,
+    9,0,0,254,3,0,8,0,1,1,4,0,9,0,2,29,4,0,10,0,1,64,4,181,116,117,114,110,101,100,97,98,111,118,101,20,0,2,60,7,1,15,0,2,136,6,0,11,0,1,200,4,48,108,111,110,107,5,128,98,98,114,97,99,
+    107,101,116,83,1,4,15,2,3,19,0,1,244,0,4,20,0,50,73,84,70,159,7,1,230,0,7,164,7,3,16,0,6,169,7,2,17,0,5,252,0,1,15,0,16,81,6,0,64,52,100,111,116,74,2,33,106,97,3,1,0,19,0,3,117,6,2,
+    11,0,6,0,1,2,16,0,4,75,1,2,14,0,1,64,1,2,11,0,2,248,0,2,12,0,2,26,5,2,12,0,0,33,1,6,10,0,7,101,0,1,50,1,1,26,0,2,111,6,0,11,0,23,50,116,6,3,16,0,10,196,0,22,50,126,6,1,32,0,0,183,5,
+    0,9,0,18,51,188,5,3,11,0,2,86,1,3,13,0,10,65,0,17,51,228,5,0,113,1,224,46,97,108,116,115,116,114,111,107,101,115,104,111,114,238,5,2,132,1,6,14,0,10,29,0,82,46,99,97,115,101,49,0,4,
+    167,1,2,19,0,0,117,8,5,53,0,6,19,0,9,37,0,5,122,1,1,122,0,67,105,50,46,48,83,12,240,21,32,105,115,32,97,32,116,114,97,100,101,109,97,114,107,32,111,102,32,116,104,101,32,73,110,100,
+    105,97,110,32,84,121,112,101,32,70,240,2,68,114,121,46,67,243,2,175,32,50,48,49,55,45,50,48,50,49,40,0,2,82,32,65,108,108,32,40,2,164,32,114,101,115,101,114,118,101,100,46,111,0,2,
+    194,12,3,14,0,32,0,176,133,12,243,255,255,255,255,255,255,255,255,255,255,255,219,5,0,13,0,44,0,54,0,58,0,64,0,69,0,76,0,84,0,244,1,2,1,9,1,15,1,23,1,29,1,34,1,118,1,140,1,180,1,199,
+    1,214,1,251,2,9,2,32,2,45,2,66,2,74,2,82,2,87,2,93,2,103,2,113,2,118,2,153,2,232,2,235,3,37,3,78,3,82,3,122,3,143,3,168,3,195,3,220,3,238,3,243,4,3,4,18,4,33,4,47,4,57,4,69,4,74,4,
+    81,4,92,4,109,4,119,4,128,4,137,4,151,4,164,4,174,4,182,4,194,4,205,4,212,4,219,4,228,4,234,4,240,4,246,4,251,5,0,5,38,5,122,5,129,5,135,5,199,6,17,6,90,6,160,6,211,7,5,7,11,7,57,7,
+    113,7,155,7,203,7,251,8,40,8,64,8,104,8,127,8,166,8,206,8,231,9,7,9,39,9,77,9,109,9,139,9,154,9,178,9,204,9,239,10,16,10,50,10,81,10,111,10,136,10,152,10,167,10,194,10,217,10,242,11,
+    9,11,20,11,44,11,66,11,89,11,112,11,133,11,144,11,160,11,178,11,200,11,222,11,243,12,6,12,26,12,37,12,56,12,61,12,80,12,90,12,96,12,114,12,132,12,148,12,162,12,179,12,186,12,198,12,
+    214,12,230,12,237,12,252,13,5,13,15,13,24,13,38,13,50,13,57,13,67,13,78,13,89,13,101,13,112,13,123,13,134,13,145,13,156,13,163,13,173,13,183,13,193,13,203,13,213,13,223,13,233,13,242,
+    13,251,14,4,14,13,14,22,14,31,251,25,5,11,21,138,29,223,248,125,6,14,21,132,49,5,209,107,68,173,64,27,251,32,49,34,251,42,92,29,31,147,50,5,225,248,125,6,43,251,137,51,29,21,247,13,
+    221,198,244,163,31,68,29,21,233,64,29,117,107,111,160,118,11,107,113,59,29,11,21,47,6,72,32,29,11,60,211,252,46,233,248,46,11,21,78,165,88,183,106,30,89,125,111,105,94,26,100,160,111,
+    175,125,30,93,123,109,103,94,26,53,211,100,247,51,247,59,235,197,239,224,80,184,251,5,30,251,52,6,95,118,152,166,163,157,154,170,141,31,128,167,172,133,174,27,247,18,225,215,247,2,
+    188,118,187,107,169,31,158,153,162,149,169,27,145,145,139,137,147,31,219,7,140,134,132,139,133,27,89,98,115,98,117,31,156,106,95,150,97,27,251,15,51,57,251,5,31,230,140,21,209,189,
+    187,212,211,190,91,69,70,89,93,66,65,90,185,208,30,100,252,29,21,180,167,160,192,140,30,247,52,6,196,165,122,100,87,83,113,251,6,251,3,96,159,190,31,14,170,166,165,171,170,112,166,
+    108,108,113,112,108,107,11,74,90,251,12,31,61,11,129,137,136,129,31,11,5,217,6,56,247,30,5,11,5,61,6,82,46,11,21,183,116,165,11,21,251,29,227,32,247,31,216,203,173,196,171,30,41,7,
+    46,79,79,47,57,85,181,211,127,30,45,6,251,16,157,230,64,247,25,27,247,42,234,237,247,46,31,248,105,55,7,132,56,5,200,108,78,175,60,27,251,34,50,251,0,251,30,31,233,141,21,229,195,211,
+    233,235,195,71,45,43,81,71,44,47,82,211,231,30,14,21,247,55,247,21,235,247,36,170,31,120,29,251,116,247,29,251,40,247,98,31,14,252,155,21,251,59,245,37,247,63,247,62,245,242,247,58,
+    30,248,102,40,252,96,7,251,7,76,74,251,6,251,7,75,203,247,8,30,248,96,41,7,14,21,38,80,68,43,43,83,211,239,240,196,211,235,235,197,68,37,30,14,247,74,249,103,21,41,253,103,248,52,230,
+    251,210,6,11,251,11,167,5,71,155,106,174,197,26,210,198,185,230,220,190,97,67,144,30,238,6,247,17,131,50,216,251,30,27,251,41,39,55,251,16,11,21,197,233,196,45,45,29,34,6,56,251,30,
+    5,11,247,11,112,5,208,123,170,103,82,26,67,78,94,43,48,81,183,208,137,30,39,6,11,30,229,6,232,137,69,199,32,27,251,0,63,11,7,247,17,80,218,251,21,70,77,106,83,108,30,129,214,5,54,252,
+    125,6,11,101,29,47,6,225,32,29,11,112,108,107,165,113,171,31,11,111,158,173,30,14,21,206,190,190,205,11,31,195,4,104,116,164,176,175,163,11,173,163,113,104,102,116,114,104,31,11,248,
+    125,45,6,14,21,35,200,71,247,10,112,30,55,29,251,16,145,237,62,247,39,27,247,46,240,222,247,22,241,79,203,251,10,166,31,53,29,31,14,252,182,21,232,6,224,247,153,157,198,148,171,144,
+    163,25,144,112,149,101,155,90,224,251,154,24,228,6,247,59,248,125,5,41,6,57,251,146,125,96,130,105,131,100,25,131,174,123,196,131,163,58,247,146,24,43,6,57,251,146,128,107,126,98,131,
+    96,25,130,182,129,176,128,175,58,247,146,24,42,6,14,111,29,14,51,6,83,123,91,109,66,27,46,85,196,242,132,31,248,14,140,5,174,7,247,37,48,235,251,31,251,34,42,33,251,45,251,44,238,35,
+    247,36,30,135,248,72,21,222,192,85,58,31,251,174,6,225,151,191,188,221,27,14,253,145,21,133,164,165,135,170,27,214,188,174,223,172,31,247,123,248,235,5,42,96,29,40,6,247,89,252,151,
+    122,92,5,77,116,103,132,94,27,76,6,14,252,118,71,29,21,251,186,237,247,186,7,247,135,248,65,5,32,6,251,52,251,181,126,115,137,133,130,121,25,131,156,133,153,129,156,251,53,247,181,
+    24,251,2,6,14,21,247,151,7,234,190,202,227,211,185,99,40,30,251,170,233,247,191,57,29,14,247,112,251,35,247,46,251,97,251,96,251,35,251,47,251,111,251,112,247,34,251,46,247,96,11,241,
+    249,48,21,251,182,199,247,237,251,36,84,7,248,210,181,21,58,6,252,101,253,90,5,218,6,11,21,230,252,28,7,248,27,248,180,5,227,252,140,49,248,18,7,252,24,252,178,5,48,7,14,180,220,134,
+    31,79,6,103,129,119,114,30,98,109,195,79,94,29,11,248,182,54,29,11,247,57,241,35,251,60,251,58,37,35,251,53,31,251,26,11,21,171,167,166,171,172,111,167,107,107,112,111,106,107,11,247,
+    156,127,21,217,205,173,206,171,31,147,50,5,223,11,6,247,153,251,96,21,247,108,247,96,251,108,6,11,249,156,101,29,47,6,224,32,29,11,133,123,122,136,125,27,102,113,160,195,31,11,21,73,
+    89,29,11,249,59,39,29,212,6,11,250,33,21,48,6,71,32,29,212,6,11,30,137,112,119,123,103,142,8,105,7,198,134,183,181,205,26,14,21,48,6,71,251,24,5,212,6,11,247,25,5,48,6,224,32,29,11,
+    6,252,102,253,90,5,219,6,11,247,6,218,251,6,247,45,45,251,45,63,60,215,11,251,41,222,251,4,247,36,220,202,178,202,172,11,167,196,187,103,163,101,128,44,29,11,27,84,106,92,64,145,31,
+    11,235,218,43,247,45,45,251,45,43,60,235,11,6,251,37,252,30,251,34,248,30,5,11,6,103,129,119,115,30,11,21,58,248,136,220,7,11,5,99,174,7,191,165,114,100,11,6,100,251,93,5,11,21,73,
+    247,25,5,11,223,193,193,225,30,11,195,79,27,83,11,233,196,45,5,11,181,248,164,21,35,200,71,247,10,112,30,55,29,251,16,145,237,62,247,39,27,247,46,240,222,247,22,241,79,203,251,10,166,
+    31,53,29,31,11,21,62,204,90,236,235,204,188,216,192,108,185,88,153,30,178,155,163,174,184,26,211,81,183,55,55,81,94,68,95,162,104,178,123,30,89,122,107,96,85,26,218,247,96,21,178,172,
+    162,189,188,171,116,99,102,110,112,87,85,110,167,176,30,129,251,87,21,186,178,165,192,194,178,112,93,91,100,114,85,85,100,164,187,30,14,248,30,249,23,110,29,11,180,247,251,111,29,11,
+    21,46,212,78,247,7,247,8,219,198,232,212,98,177,56,159,30,53,160,5,91,151,115,161,172,26,184,172,165,198,196,172,108,90,141,56,29,82,49,67,180,96,226,118,31,225,119,5,190,126,155,119,
+    106,26,94,101,112,73,77,101,169,189,30,14,21,235,219,93,47,166,31,243,6,247,31,115,251,15,230,251,50,27,251,105,251,34,251,48,251,112,251,115,247,33,251,40,247,97,245,227,185,202,178,
+    31,146,41,5,221,248,35,251,226,52,247,134,118,6,251,38,40,76,251,15,251,41,37,240,247,67,247,63,233,247,7,247,48,30,11,21,251,119,247,34,251,35,247,99,247,95,247,19,247,33,247,80,30,
+    206,251,238,52,247,135,7,251,33,134,48,63,251,22,27,251,40,40,240,247,69,247,66,238,247,3,247,43,242,218,92,43,172,31,244,6,247,46,103,251,15,220,251,52,27,251,105,251,33,251,47,251,
+    114,31,11,21,235,6,247,69,248,208,247,67,252,208,5,233,6,247,110,249,103,5,39,6,251,25,252,79,129,107,129,102,127,78,25,128,193,129,177,127,178,251,28,248,78,24,33,6,251,29,252,78,
+    128,101,128,104,127,81,25,129,194,129,177,129,177,251,24,248,78,24,37,6,14,155,247,213,21,207,251,213,247,131,6,247,106,247,36,247,38,247,107,247,108,251,38,247,38,251,108,31,251,127,
+    251,212,71,6,247,210,57,21,221,251,44,247,122,247,22,7,78,29,247,122,6,14,159,248,124,21,66,192,95,208,210,190,183,210,200,99,175,85,148,30,225,218,5,191,251,111,84,247,34,7,51,59,
+    99,29,103,116,117,101,101,115,162,178,31,248,184,247,114,21,58,90,29,11,247,74,22,117,29,11,175,251,73,21,128,157,160,134,167,27,193,185,93,29,163,188,5,168,107,7,94,44,150,110,5,147,
+    157,151,142,158,27,164,155,127,117,117,120,125,109,116,121,146,149,119,31,14,247,178,247,77,7,247,27,251,178,5,247,1,6,251,39,247,197,5,229,168,189,211,239,26,247,27,47,221,251,47,
+    30,251,165,253,103,6,237,249,15,21,247,67,6,229,193,93,55,56,87,90,48,31,251,68,6,11,217,7,192,155,170,200,30,181,220,6,142,121,117,140,121,27,50,43,29,251,109,217,7,192,154,170,200,
+    30,181,220,6,142,121,118,140,121,27,49,43,29,7,14,21,202,251,84,7,236,218,5,199,188,169,190,198,26,228,84,193,48,49,82,79,43,137,30,206,6,199,169,173,191,190,166,110,84,97,117,103,
+    94,102,30,251,50,251,22,5,86,7,14,35,6,50,112,55,82,33,27,251,38,43,247,2,247,61,247,61,235,247,2,247,38,244,220,82,45,166,31,244,6,247,40,112,251,17,236,251,55,27,251,99,251,33,251,
+    43,251,115,11,247,1,6,215,247,87,5,247,120,251,87,248,75,230,251,233,247,121,247,199,226,251,199,247,118,247,233,229,252,198,6,67,252,80,21,247,30,247,246,5,196,251,246,6,14,247,188,
+    221,21,83,29,247,152,91,29,251,165,7,40,188,90,225,167,167,144,149,164,30,11,6,251,157,249,103,5,251,1,6,251,156,253,103,5,247,198,248,203,21,144,154,144,156,141,149,141,128,144,122,
+    144,125,247,3,251,194,24,251,137,6,14,247,54,22,247,151,7,234,190,202,227,211,185,99,40,30,251,170,233,247,191,57,29,11,248,224,247,38,21,226,53,248,126,251,19,7,251,233,252,126,5,
+    52,248,10,251,38,233,247,38,7,251,254,226,21,247,160,248,22,5,252,22,7,14,247,56,22,247,31,7,222,226,247,35,251,118,5,247,0,6,251,78,247,186,247,79,247,87,5,251,10,6,251,109,251,122,
+    5,248,113,45,253,116,7,11,21,169,166,165,171,170,112,166,109,38,29,247,53,22,169,166,165,171,170,112,166,109,38,29,11,247,92,248,211,21,178,114,161,108,127,130,136,135,132,30,171,201,
+    29,88,81,66,26,85,171,106,179,179,165,167,177,30,11,173,99,151,30,169,151,158,167,175,26,196,94,174,73,73,93,181,29,100,126,114,105,97,26,208,247,50,21,167,162,157,11,247,92,249,30,
+    21,193,107,172,99,99,113,111,101,100,165,117,169,151,148,141,143,146,30,107,111,113,100,132,30,97,7,209,148,190,198,212,26,11,21,183,115,165,104,107,117,37,29,167,145,146,140,141,144,
+    30,137,113,120,123,103,142,8,105,7,197,134,184,181,205,26,14,47,29,103,107,117,37,29,167,145,146,140,141,144,30,138,113,119,123,103,142,8,105,7,197,134,184,181,205,26,14,47,29,103,
+    108,116,37,29,167,146,146,140,142,144,87,29,21,175,150,159,161,30,174,169,83,202,27,197,172,180,220,135,179,29,106,92,64,146,31,11,21,84,137,122,111,97,66,70,228,48,27,59,88,73,47,
+    191,29,51,236,27,219,190,206,233,31,14,247,54,140,21,247,158,7,223,188,205,230,209,186,99,40,30,251,170,233,247,191,7,247,17,79,218,251,17,63,80,103,86,108,30,11,21,251,17,215,51,247,
+    30,247,21,226,221,247,22,30,248,159,41,252,155,7,64,103,89,57,59,100,190,210,30,175,44,7,14,251,150,7,34,92,84,53,67,94,179,244,30,247,165,45,251,196,7,251,12,203,62,247,6,211,204,
+    174,190,167,30,149,65,5,11,21,143,120,125,141,122,27,72,90,105,88,119,31,133,213,5,51,252,124,233,247,151,6,233,194,193,228,30,181,6,14,251,59,41,251,5,251,39,251,39,42,247,4,247,60,
+    247,60,236,247,3,247,39,247,39,237,251,3,251,60,30,14,30,174,169,83,202,27,197,172,180,220,134,31,79,97,29,97,110,103,214,0,242,2,72,73,88,89,72,71,188,90,207,62,29,164,173,63,29,11,
+    72,15,0,19,208,15,0,243,105,247,6,248,241,21,173,167,167,173,174,111,166,105,105,111,112,104,105,167,111,173,31,93,252,241,21,11,247,235,249,60,21,94,116,112,95,95,116,165,185,30,68,
+    6,53,192,85,224,102,29,11,247,48,22,247,106,247,136,251,106,247,137,5,251,8,6,247,106,251,137,251,106,251,136,5,11,21,78,101,165,191,187,173,171,222,147,31,247,17,149,5,113,7,47,85,
+    81,50,30,14,175,29,132,138,131,27,117,124,151,161,11,247,146,22,247,8,6,251,106,247,136,247,62,0,244,155,251,106,251,137,5,11,244,249,164,21,171,167,166,171,171,111,167,107,107,112,
+    111,107,106,166,113,171,31,14,247,40,247,255,21,177,172,171,176,178,106,171,101,100,106,107,100,102,172,107,178,31,11,7,247,42,247,22,5,247,20,247,3,190,212,242,26,247,31,46,227,251,
+    37,251,39,11,21,55,6,69,32,29,208,6,247,112,247,25,21,53,6,60,32,29,209,6,11,247,15,249,148,21,244,6,221,185,29,14,187,163,180,190,26,209,92,185,66,65,89,90,70,204,29,11,192,154,170,
+    196,30,181,220,6,142,121,117,140,121,27,54,43,29,11,6,199,106,76,172,64,27,251,37,52,251,2,251,42,251,41,225,33,247,34,31,11,247,30,127,21,177,172,171,177,133,0,17,101,133,0,241,128,
+    205,95,192,64,114,119,132,128,125,31,158,211,5,247,34,194,251,76,6,94,11,21,43,83,211,240,239,195,211,235,235,198,67,39,37,80,68,43,31,14,21,184,145,108,158,114,27,110,108,120,94,145,
+    31,165,251,99,5,193,6,11,247,98,22,248,46,95,29,252,46,7,11,21,171,166,166,171,172,112,167,107,106,112,111,106,107,166,112,172,31,11,21,197,174,29,11,21,104,116,164,175,175,163,164,
+    173,173,163,113,104,103,116,114,104,31,11,22,75,96,188,29,181,94,74,30,11,153,249,13,178,29,11,169,166,165,170,170,112,166,109,107,113,113,107,108,32,10,18,170,18,0,240,49,108,108,
+    113,112,108,107,164,114,171,31,11,21,202,251,190,76,247,125,7,251,48,252,10,5,207,6,14,21,244,6,221,247,30,46,29,82,232,5,61,6,11,21,251,27,207,49,247,6,247,4,210,229,247,27,247,28,
+    71,11,27,192,186,93,29,155,191,7,245,111,45,29,34,6,57,251,30,5,11,26,93,172,104,191,155,153,141,144,152,30,206,7,135,130,11,114,111,98,100,114,163,179,31,78,6,65,194,94,208,30,11,
+    247,94,250,24,88,29,14,21,247,110,253,13,237,249,13,247,109,229,252,169,6,11,31,78,97,29,98,109,103,29,11,248,189,21,196,232,196,46,45,29,11,102,84,104,158,111,168,126,30,11,248,23,
+    249,199,21,52,6,75,251,14,5,207,6,11,247,45,45,251,45,43,60,235,252,46,7,14,25,144,162,142,205,29,11,247,29,161,0,242,99,252,10,207,248,73,251,60,76,7,14,101,99,107,107,100,100,171,
+    107,179,31,14,94,77,77,96,184,203,204,182,184,201,202,11,126,114,105,97,26,207,247,50,21,167,11,21,78,191,100,215,215,191,178,200,182,11,31,214,6,191,141,155,166,182,206,208,11,103,
+    101,118,158,166,30,131,251,43,21,11,122,92,5,77,116,102,132,95,27,76,11,107,107,100,101,171,107,11,5,210,6,202,247,117,21,98,109,11,131,138,132,27,117,124,151,161,163,146,1,242,14,
+    171,112,167,107,11,21,33,192,66,234,230,196,210,246,11,21,199,6,161,247,59,5,57,6,11,21,200,6,160,10,0,161,167,165,178,147,30,181,7,69,129,11,244,0,240,255,130,49,247,110,11,21,251,
+    43,247,0,33,247,39,11,30,200,6,178,163,163,177,176,11,165,174,26,208,83,70,7,104,11,116,160,109,178,84,24,185,171,11,247,97,247,36,247,46,247,112,11,1,0,34,0,0,171,0,1,135,0,0,172,
+    2,1,136,1,0,175,0,1,138,0,0,176,0,0,138,0,1,139,0,0,35,1,1,140,1,0,177,0,1,142,1,0,37,0,0,154,0,1,144,1,0,38,0,0,178,0,1,146,1,0,179,1,1,148,0,0,181,0,1,149,1,0,39,1,1,151,3,0,41,0,
+    1,155,0,0,42,0,0,182,2,1,156,0,0,185,0,1,157,2,0,43,0,1,160,0,0,44,0,1,161,0,0,45,0,1,162,3,0,140,0,0,46,1,1,166,3,0,186,0,0,48,0,0,187,3,1,170,1,0,141,0,1,172,0,0,191,0,0,142,0,0,
+    49,0,0,157,0,0,50,1,1,173,2,0,52,0,1,176,0,0,192,0,1,177,2,0,53,0,1,180,3,0,54,0,0,193,3,1,184,4,0,55,1,1,189,3,0,57,1,0,197,0,1,193,0,0,198,0,1,194,0,0,59,0,1,195,0,0,199,0,1,196,
+    1,0,66,0,0,200,0,1,198,0,0,201,2,1,199,1,0,204,0,1,201,0,0,205,0,0,144,0,1,202,0,0,67,1,1,203,1,0,206,0,1,205,1,0,69,0,0,167,0,1,207,1,0,70,0,0,207,0,1,209,1,0,208,1,1,211,0,0,210,
+    0,1,212,1,0,71,1,1,214,3,0,73,0,1,218,0,0,74,0,0,211,2,1,219,0,0,214,0,1,220,2,0,75,0,1,223,0,0,76,0,1,224,0,0,77,0,1,225,3,0,146,0,0,78,1,1,229,3,0,215,170,41,176,0,216,3,1,233,1,
+    0,147,0,1,235,103,33,241,41,0,148,0,0,81,0,0,162,0,0,82,1,1,236,2,0,84,0,1,239,0,0,221,0,1,240,2,0,149,0,0,85,0,1,243,3,0,86,0,0,222,3,1,247,4,0,87,1,1,252,3,0,89,1,0,226,79,35,240,
+    40,227,0,2,1,0,0,91,0,2,2,0,0,228,0,2,3,8,0,109,1,2,12,4,0,17,9,2,17,40,0,150,0,0,164,0,0,169,0,2,58,5,0,99,0,0,155,0,0,158,0,0,163,0,1,64,152,41,241,5,2,64,0,0,61,0,0,114,0,0,116,
+    0,0,27,0,0,13,0,0,121,164,35,112,96,0,0,4,0,0,15,4,35,33,0,123,178,35,240,47,104,0,0,28,0,0,16,0,0,64,0,0,92,0,0,94,0,0,60,0,0,62,0,0,9,1,0,137,0,0,111,0,0,14,0,0,106,0,0,120,0,0,107,
+    1,0,118,0,0,105,0,0,119,0,0,65,0,0,8,0,0,117,0,12,42,241,22,97,0,0,103,0,0,5,0,2,65,0,0,101,0,0,98,0,0,100,0,0,12,0,0,166,0,0,168,0,0,159,0,0,30,0,2,66,82,42,240,7,29,0,2,67,1,0,156,
+    0,2,69,0,0,95,0,0,151,0,2,70,8,0,6,61,42,240,85,2,79,18,0,33,0,0,7,0,0,115,0,0,102,0,0,170,0,0,165,0,2,98,0,0,153,0,0,161,0,0,93,0,0,160,0,0,112,1,2,99,1,0,63,0,2,101,16,0,125,0,0,
+    129,0,0,136,0,0,133,0,0,126,0,0,131,0,0,130,0,0,124,0,0,134,0,0,128,0,0,135,0,0,132,0,0,127,0,2,118,7,0,145,0,2,126,26,1,0,1,248,128,18,240,255,255,255,255,51,29,0,35,0,46,0,70,0,82,
+    0,95,0,108,0,120,0,160,0,191,1,21,1,33,1,39,1,52,1,124,1,151,1,166,1,182,2,24,2,38,2,51,2,88,2,91,2,147,2,150,2,173,2,184,2,204,2,219,2,232,2,249,3,10,3,23,3,36,3,66,3,89,3,94,3,121,
+    3,137,3,146,3,229,3,244,4,22,4,28,4,40,4,50,4,65,4,81,4,93,4,106,4,129,4,145,4,151,4,166,4,170,4,179,4,183,4,203,4,212,4,221,4,247,5,29,5,83,5,90,5,103,5,115,5,125,5,175,5,208,5,216,
+    5,228,5,238,6,0,6,10,6,40,6,54,6,62,6,76,6,94,6,186,6,233,7,27,7,100,7,104,7,117,7,133,7,142,7,146,7,159,7,174,7,236,7,249,8,2,8,6,8,34,8,50,8,111,8,120,8,126,8,135,8,146,8,163,8,174,
+    8,185,8,198,9,4,9,26,9,44,9,82,9,156,9,166,9,178,9,192,9,202,10,11,10,18,10,28,10,43,10,60,10,68,10,96,10,107,10,122,10,135,10,140,10,146,10,158,10,184,10,198,10,211,10,221,10,233,
+    11,56,11,73,11,152,11,175,12,60,12,206,13,8,13,14,13,25,13,39,13,97,13,107,13,118,13,132,13,231,13,253,14,57,14,71,14,81,14,90,14,105,14,114,14,144,14,152,14,162,14,175,14,215,14,247,
+    15,79,15,100,15,117,15,146,15,168,15,178,15,198,15,203,15,214,15,224,15,237,15,248,16,5,16,15,16,51,16,64,16,92,16,102,16,107,16,115,16,120,16,137,16,148,16,155,16,182,16,216,17,30,
+    17,34,17,47,17,59,17,67,17,105,17,138,17,144,17,153,17,162,17,179,17,190,17,199,17,212,18,59,18,167,18,184,19,35,19,96,19,158,19,220,19,225,19,240,19,254,20,8,20,13,20,27,20,40,20,
+    158,20,180,20,190,21,12,21,17,21,40,21,59,21,120,21,128,21,135,21,144,21,154,21,179,21,189,21,198,21,211,21,220,21,241,21,253,22,32,22,106,22,116,22,127,22,209,22,221,23,15,23,22,23,
+    34,23,45,23,61,23,75,23,104,23,116,23,132,23,144,23,151,23,157,23,162,23,172,23,231,23,249,24,20,24,63,24,104,24,141,24,182,24,214,25,14,25,74,25,117,25,187,25,204,25,247,26,47,26,
+    50,26,107,26,179,26,203,27,36,27,108,27,176,27,198,27,241,28,41,28,44,28,101,28,173,28,197,29,30,29,102,29,130,29,138,29,145,29,208,29,245,29,251,30,53,30,61,30,67,30,126,30,163,30,
+    179,30,210,30,241,31,2,31,33,31,70,31,95,31,104,31,149,31,185,31,201,31,247,32,22,32,58,32,63,32,99,32,104,32,177,32,222,32,250,33,2,33,10,33,73,33,111,33,118,33,176,33,184,33,191,
+    33,251,34,6,34,38,34,56,34,74,34,93,34,141,34,191,34,245,35,69,36,71,36,87,36,112,36,137,36,156,36,195,36,230,37,17,37,59,37,141,37,146,37,216,38,39,38,50,38,55,38,96,38,113,38,124,
+    38,193,39,6,39,26,39,46,39,92,39,137,39,150,39,163,39,176,39,205,39,233,39,238,39,243,40,27,40,61,40,94,40,99,40,104,40,109,40,112,40,182,41,27,41,156,42,12,42,76,42,173,42,228,42,
+    253,43,8,43,52,43,103,43,116,43,170,43,197,43,227,44,5,44,40,44,70,44,105,44,112,44,128,44,250,45,96,45,136,45,182,45,199,45,235,46,8,46,56,46,131,46,139,46,190,46,224,46,254,47,33,
+    47,66,47,100,47,129,47,162,47,191,47,254,48,55,48,60,48,100,48,143,48,148,48,164,48,177,48,206,49,47,49,70,49,235,50,101,50,141,51,3,51,132,51,185,51,226,52,24,52,68,52,80,52,102,52,
+    123,52,154,52,240,53,56,53,85,53,111,53,227,53,231,53,235,53,239,53,243,53,247,53,251,53,255,54,3,54,7,54,11,54,19,54,61,54,99,54,103,54,119,54,123,54,127,54,131,54,135,54,139,54,143,
+    54,147,54,151,54,155,54,163,54,198,54,202,54,206,54,226,54,246,55,39,55,63,55,88,55,98,55,110,55,147,55,152,55,157,55,169,55,189,55,205,55,222,55,234,56,20,56,53,56,91,56,166,56,205,
+    56,214,56,222,56,251,57,4,57,38,57,60,57,129,57,151,57,159,57,170,57,187,57,200,57,213,57,232,57,248,58,16,251,19,189,251,111,21,248,36,250,207,252,36,254,207,6,189,189,21,250,107,
+    247,192,254,107,251,192,7,14,174,247,6,22,92,10,174,248,91,86,29,251,147,253,156,34,10,174,248,34,250,34,73,10,68,6,53,192,85,224,224,192,193,225,30,251,247,254,34,34,10,174,247,165,
+    249,156,164,29,57,253,156,12,0,144,143,249,172,127,29,251,190,253,172,49,0,114,1,249,156,84,29,251,71,26,0,128,99,249,203,39,10,46,254,16,12,0,244,40,6,22,70,10,181,6,92,119,115,103,
+    103,26,93,173,104,190,155,153,52,10,130,132,138,132,27,116,125,151,161,163,158,168,183,156,31,140,123,29,174,247,223,249,149,61,29,205,88,190,72,72,89,89,72,71,187,35,11,64,251,109,
+    253,205,96,0,241,13,91,250,180,33,10,251,147,254,47,21,70,10,242,6,251,145,249,70,5,170,160,159,174,180,26,206,88,189,101,11,255,14,96,158,104,171,119,30,251,144,253,69,5,247,210,249,
+    106,21,105,116,164,176,175,163,164,172,63,29,127,251,51,189,13,3,255,93,174,247,129,249,169,134,29,76,253,169,34,10,247,182,146,22,121,29,247,182,249,66,86,29,252,229,253,156,21,121,
+    29,151,223,22,247,178,6,247,35,226,212,247,12,225,98,197,59,165,31,211,169,175,195,222,26,247,11,53,211,251,33,30,251,168,6,247,162,52,21,224,187,98,67,64,93,95,58,31,251,70,247,124,
+    6,247,78,251,209,21,222,187,97,67,64,92,96,55,31,251,78,247,124,6,14,247,8,248,20,128,27,21,3,241,14,247,8,248,148,250,33,39,29,212,6,97,253,167,49,29,247,8,247,227,249,156,38,10,62,
+    6,247,23,254,49,16,0,100,211,251,73,21,128,158,190,15,207,156,173,247,48,145,247,14,233,169,247,32,25,24,15,28,225,251,105,247,16,251,36,247,81,125,31,114,87,132,10,239,15,240,0,118,
+    31,14,247,8,247,223,249,157,126,10,247,23,253,168,112,0,224,248,24,249,172,163,29,135,253,183,49,29,234,247,215,107,12,12,157,16,240,11,253,103,6,247,120,249,13,21,78,29,248,178,6,
+    14,234,113,29,234,247,149,249,156,21,244,6,222,59,10,16,81,220,10,95,247,41,254,37,21,216,16,0,13,59,0,240,30,95,248,161,22,230,251,235,247,121,247,201,226,251,201,247,118,247,235,
+    229,252,77,40,10,95,248,61,72,10,247,79,253,156,35,10,95,248,4,250,34,73,10,67,6,53,193,255,12,128,225,254,34,35,10,95,247,140,37,1,96,61,6,247,252,254,38,15,0,113,135,249,156,54,29,
+    247,252,48,0,224,247,112,249,172,60,10,165,113,170,31,247,36,253,172,30,0,178,192,249,172,79,29,166,112,171,31,247,117,17,0,114,227,249,156,58,29,247,154,47,0,16,69,171,2,64,247,240,
+    254,16,108,0,159,100,22,109,10,158,168,184,156,31,149,0,0,255,74,67,248,102,247,199,21,228,251,176,247,129,247,230,229,252,72,253,103,237,247,199,7,14,247,30,107,29,14,247,30,248,98,
+    250,35,21,93,116,112,96,95,115,160,10,225,223,192,193,225,30,251,31,251,160,87,10,247,30,247,230,249,157,21,196,134,10,247,26,251,26,87,10,247,30,107,29,186,253,129,103,10,247,30,248,
+    31,121,10,138,251,42,228,18,54,241,60,14,234,145,10,249,103,41,251,203,251,250,247,203,41,40,10,234,145,10,248,176,221,223,57,238,41,40,251,250,238,41,40,58,55,220,252,176,7,237,248,
+    48,21,247,20,247,250,251,20,7,14,251,252,154,10,6,14,251,252,247,149,250,33,33,10,150,86,37,10,251,252,215,122,10,247,76,10,0,176,192,249,172,45,10,108,112,59,29,107,70,15,0,32,247,
+    25,73,1,82,165,112,172,31,188,16,0,112,60,249,156,123,10,226,86,28,0,144,148,249,203,36,10,247,65,251,61,13,0,192,247,13,22,92,119,116,103,103,148,29,163,159,223,3,246,53,249,103,41,
+    40,10,251,252,178,249,169,71,10,198,172,76,29,247,95,73,37,10,41,159,247,93,137,29,41,247,235,249,157,21,197,134,10,251,138,252,212,137,29,155,96,10,14,155,96,10,247,107,252,55,132,
+    29,34,52,29,14,34,247,150,250,24,151,10,150,94,5,24,144,14,34,52,29,192,248,101,199,29,9,0,80,247,55,251,89,133,42,0,241,18,247,41,247,108,21,170,165,165,170,170,113,165,108,107,113,
+    114,107,108,166,113,170,31,14,34,155,247,148,21,207,171,5,251,180,61,0,242,94,247,136,7,247,63,221,5,219,7,251,63,57,5,247,200,41,251,247,7,71,107,5,14,247,125,247,72,22,247,201,7,
+    240,137,213,134,174,30,247,102,252,155,5,231,6,247,103,248,157,5,134,88,138,90,251,27,26,251,178,235,249,103,41,7,251,141,252,244,251,141,248,244,5,43,253,103,6,14,246,247,74,22,49,
+    10,14,246,248,129,250,33,33,10,251,117,253,156,62,10,246,247,209,249,156,171,29,87,254,38,62,10,32,0,241,100,247,235,59,10,246,248,137,251,123,21,234,193,200,237,31,249,175,41,252,
+    195,7,156,10,237,248,196,6,248,10,252,202,5,82,7,84,117,113,94,124,118,142,145,120,30,122,55,5,130,168,166,136,167,27,14,246,247,168,249,169,21,175,149,159,161,30,174,169,83,203,27,
+    197,172,136,10,114,30,98,110,195,78,94,29,106,253,169,62,10,247,42,249,116,247,254,41,10,247,42,248,148,250,33,33,10,247,202,47,10,247,42,247,223,122,10,248,119,10,0,20,200,189,1,65,
+    247,159,252,66,40,0,96,59,82,29,248,22,47,10,0,113,84,250,33,21,55,6,68,176,15,22,113,176,15,32,247,140,30,0,32,247,156,204,1,64,248,108,252,166,54,0,80,249,116,247,254,82,52,0,144,
+    144,250,26,151,10,247,207,252,44,14,0,36,247,186,204,1,243,170,248,138,252,63,41,10,248,153,180,247,255,21,251,109,247,34,251,50,247,100,247,4,239,191,216,182,30,251,9,248,75,230,251,
+    233,247,121,247,200,226,251,200,247,118,247,233,229,252,75,33,7,212,88,40,185,35,27,251,100,251,35,251,49,251,108,31,242,140,21,247,60,245,247,2,247,36,247,37,244,251,2,251,61,251,
+    62,34,251,3,251,36,251,36,32,247,4,247,62,30,14,137,248,1,247,150,21,247,33,231,237,247,27,247,31,48,232,251,34,31,251,173,253,103,237,247,150,6,247,58,248,13,21,231,194,87,48,50,85,
+    82,42,31,251,54,247,181,6,14,137,248,1,247,33,21,247,33,231,238,247,17,247,21,48,232,251,34,31,251,75,247,28,41,253,103,237,247,33,6,247,58,247,250,21,231,194,86,59,59,50,0,255,38,
+    162,6,14,247,42,249,34,91,21,203,197,63,225,5,198,205,174,231,247,0,26,73,29,210,203,158,172,193,30,196,247,214,21,62,118,73,102,91,30,43,247,0,75,81,234,32,5,118,104,98,128,93,27,
+    5,18,2,240,9,31,14,166,115,29,14,166,248,69,250,33,88,29,251,57,253,157,90,10,166,247,148,249,157,26,5,240,8,185,29,147,254,38,90,10,166,115,29,247,108,252,115,102,10,89,105,29,14,
+    89,248,46,117,3,240,4,251,174,251,140,65,29,89,247,126,249,156,21,243,137,10,251,1,252,22,15,0,20,113,247,5,194,173,29,172,5,247,37,145,232,221,247,17,26,186,23,241,27,30,53,29,35,
+    200,71,247,10,112,31,55,29,145,251,8,225,64,247,23,130,115,88,24,132,10,108,117,121,146,149,118,31,14,89,247,121,249,156,65,10,251,1,90,0,240,21,105,29,247,189,253,14,131,29,74,167,
+    29,14,74,247,14,247,240,21,247,2,251,240,237,247,240,247,2,221,251,2,247,95,202,29,251,95,184,25,50,74,247,120,86,5,80,251,23,251,173,178,44,0,20,110,132,0,53,27,193,185,172,24,239,
+    161,184,5,166,249,13,202,29,253,13,164,6,110,77,70,22,2,240,15,118,31,14,74,167,29,247,214,253,209,103,10,223,218,247,149,43,10,223,248,116,72,10,251,206,50,29,223,247,190,172,5,32,
+    251,33,11,0,208,167,249,172,60,10,164,113,171,31,251,249,252,171,37,0,16,26,153,5,208,251,131,50,29,223,248,51,250,33,153,29,252,12,39,0,16,123,144,2,81,251,44,253,15,43,78,0,3,76,
+    28,255,12,30,142,142,139,142,27,107,118,123,110,109,148,29,162,158,168,181,156,31,247,9,169,209,232,247,27,26,96,28,5,242,10,223,247,248,249,149,21,206,189,190,205,205,88,190,73,143,
+    29,251,169,252,204,43,10,223,247,154,107,3,255,37,162,141,29,251,15,252,168,43,10,181,247,177,22,241,6,247,164,249,103,5,37,6,251,67,252,97,127,107,122,91,122,82,25,124,193,125,180,
+    123,180,251,68,248,98,24,34,6,14,248,14,247,122,22,12,24,50,241,5,248,14,249,7,72,10,251,202,57,10,248,14,248,81,249,156,127,10,251,29,12,0,240,36,58,249,172,99,10,251,245,253,172,
+    112,29,248,14,248,173,82,29,251,126,57,10,157,247,156,247,253,21,251,140,251,253,5,247,7,6,247,86,247,178,163,97,166,95,167,98,25,247,3,251,51,5,225,19,240,26,137,247,254,247,134,247,
+    253,5,251,5,6,251,83,251,180,118,179,115,179,107,186,25,251,5,247,53,5,251,9,6,14,118,247,147,247,186,71,29,118,248,64,128,2,240,1,52,70,29,118,247,139,249,156,21,196,104,29,217,69,
+    10,225,15,0,20,116,60,4,255,3,251,22,252,134,71,29,118,247,231,82,29,128,70,29,95,248,183,22,148,27,5,224,95,248,44,86,29,247,117,253,156,75,29,95,247,123,16,8,96,137,10,248,34,254,
+    38,15,0,242,22,176,249,172,125,10,247,155,253,172,75,29,247,31,108,29,14,46,247,103,127,32,10,46,248,33,249,59,135,10,39,252,194,32,10,46,247,232,237,20,68,96,95,115,159,63,7,48,92,
+    253,72,26,0,130,108,248,182,21,196,174,29,212,40,0,144,85,248,198,127,29,251,35,252,210,27,0,66,199,67,10,115,23,0,128,41,248,229,39,10,201,253,54,22,0,255,39,103,127,144,10,158,6,
+    107,10,247,199,7,247,24,57,203,251,13,251,18,55,72,37,30,221,6,198,184,174,218,205,188,110,57,30,125,7,251,46,127,5,251,7,130,72,83,49,26,50,201,80,244,30,166,212,63,21,4,81,46,247,
+    165,248,175,152,10,240,12,142,29,77,252,243,32,10,46,182,29,46,253,89,138,10,234,97,198,70,166,30,156,159,149,165,169,26,182,10,255,1,73,88,88,73,110,148,113,154,119,30,66,114,94,84,
+    64,26,111,0,10,255,169,198,248,151,165,29,107,252,78,147,29,46,247,71,248,195,68,10,173,180,220,134,179,29,107,92,64,145,31,231,252,207,32,10,247,147,183,247,29,21,49,201,80,247,3,
+    232,212,183,209,171,30,67,179,211,97,231,27,247,14,220,199,243,163,31,50,6,84,124,92,108,65,27,43,87,201,237,131,31,248,16,55,10,247,35,50,237,251,33,61,76,107,85,98,30,191,112,79,
+    173,57,27,251,14,56,72,37,31,221,6,197,183,175,216,212,184,100,67,30,110,7,251,49,135,5,32,137,67,90,43,26,248,207,247,179,21,224,190,83,59,31,251,177,6,220,151,192,194,223,27,252,
+    112,251,174,21,192,173,163,212,141,30,247,27,143,5,109,7,58,85,86,53,77,99,166,193,30,14,247,147,248,191,85,29,252,61,252,45,146,0,117,242,106,112,247,45,22,146,228,5,72,171,204,105,
+    216,27,247,34,227,245,247,40,247,43,55,247,2,251,32,59,73,105,75,107,31,247,223,81,10,234,247,138,21,239,197,211,235,235,196,67,39,38,82,67,43,43,81,210,241,30,14,46,175,247,136,44,
+    10,46,248,31,46,10,251,164,251,194,44,10,46,247,110,248,182,38,10,61,6,40,252,76,44,10,46,175,247,136,21,251,37,223,41,247,21,127,30,115,88,149,110,5,147,158,151,142,157,27,165,155,
+    127,117,117,119,125,109,98,5,242,11,91,7,128,158,159,134,168,173,29,173,247,1,146,221,208,157,239,25,97,10,46,247,105,77,29,40,82,0,246,107,162,120,10,251,126,251,210,44,10,112,80,
+    29,249,116,46,251,218,157,29,158,224,160,29,99,175,247,134,21,251,39,243,32,247,44,247,41,247,2,243,247,71,247,29,93,247,9,39,247,11,30,201,168,115,195,58,101,124,154,124,155,123,153,
+    25,251,2,6,168,112,165,112,163,112,45,94,24,163,84,247,4,192,192,77,173,85,163,74,25,181,101,84,161,79,27,251,28,251,5,34,251,36,31,234,136,21,233,203,212,239,237,201,68,45,42,75,67,
+    40,40,77,211,234,30,14,113,0,255,15,247,213,248,217,153,10,251,194,253,43,160,29,112,80,29,248,213,201,199,77,238,46,40,251,51,79,247,51,251,59,109,23,2,47,158,224,67,23,0,70,54,247,
+    171,127,33,35,240,7,54,248,36,85,29,104,252,194,35,29,54,145,29,251,27,253,72,35,29,54,247,115,65,1,209,62,6,247,30,253,76,35,29,54,117,10,247,30,33,0,113,247,87,248,198,21,42,29,139,
+    11,23,54,181,26,145,61,252,210,35,29,54,116,10,142,8,0,82,247,202,67,10,180,48,0,16,44,197,3,64,247,19,253,54,85,0,81,171,127,21,143,6,223,5,0,54,14,129,191,155,152,52,10,131,196,29,
+    157,11,242,9,138,6,212,161,188,192,157,216,8,68,29,251,202,155,248,125,21,40,29,247,8,218,251,8,131,28,48,54,10,120,107,28,175,50,73,164,10,7,14,110,176,247,149,233,34,65,241,12,110,
+    247,242,249,67,21,93,115,113,140,10,193,193,225,30,252,20,252,66,48,29,110,247,117,180,29,35,119,34,64,251,2,251,188,17,0,240,10,226,248,244,21,167,118,161,124,10,96,73,26,95,162,113,
+    175,170,162,162,170,30,251,189,251,243,29,0,160,174,248,205,197,29,107,112,112,106,107,85,11,240,1,251,137,251,204,48,29,87,136,29,247,214,45,253,115,7,14,10,0,240,23,55,247,50,199,
+    251,50,238,45,40,77,79,201,252,212,7,14,144,29,233,64,29,247,131,249,59,33,10,54,252,182,36,29,197,248,182,65,10,227,10,0,241,5,174,248,198,45,10,38,29,251,20,252,198,36,29,247,7,248,
+    198,125,10,92,11,0,128,42,248,182,21,72,89,29,130,37,0,242,0,130,248,229,36,10,216,253,42,36,29,144,29,171,6,93,147,15,1,98,24,1,147,15,2,39,26,2,180,11,65,140,64,29,160,153,4,81,76,
+    29,246,252,195,83,0,240,25,241,21,172,168,167,173,174,110,166,106,104,112,112,104,105,166,111,174,31,251,63,253,207,61,10,197,248,182,54,29,103,253,148,61,10,251,11,126,29,14,5,0,240,
+    9,247,138,59,10,252,29,50,10,14,252,29,247,133,250,31,88,29,148,253,155,21,249,116,81,17,0,144,50,10,247,38,248,205,200,29,14,33,0,240,6,241,59,10,251,164,50,10,247,117,247,196,21,
+    171,166,166,170,172,112,166,107,106,19,1,64,166,113,172,31,62,0,240,18,56,22,248,7,7,198,167,5,210,7,80,111,5,247,186,45,251,231,7,81,111,5,68,7,197,167,5,251,218,7,14,247,127,130,
+    29,225,182,7,217,186,188,210,205,181,97,62,30,251,190,232,15,0,240,37,189,210,205,182,95,62,30,251,189,231,247,212,7,247,5,71,209,251,4,63,80,101,78,116,30,200,114,85,177,63,27,70,
+    87,107,93,114,31,130,203,5,55,252,125,6,14,87,124,29,14,87,248,52,88,1,241,39,251,60,252,182,72,29,87,247,132,248,182,171,29,144,253,64,72,29,87,124,29,247,168,33,102,10,87,247,54,
+    22,141,10,251,233,7,84,121,113,94,123,129,141,144,120,30,123,54,5,131,167,155,138,164,27,220,11,162,248,7,57,29,14,87,247,91,248,195,186,11,35,175,168,186,11,49,115,30,97,186,11,240,
+    12,163,252,195,72,29,93,175,247,137,42,10,93,248,51,46,10,251,184,48,10,93,247,125,77,29,251,11,9,0,51,102,248,198,16,9,224,227,251,209,42,10,93,247,217,248,182,58,29,251,109,28,0,
+    80,242,113,10,251,246,9,0,16,58,196,1,96,251,22,252,53,42,10,74,0,243,84,21,54,173,68,195,94,30,81,45,5,224,6,174,196,5,127,170,174,132,176,27,247,38,247,0,245,247,43,223,106,208,84,
+    185,31,193,226,5,57,6,108,89,5,153,107,103,146,100,27,51,10,31,234,22,241,204,210,234,161,159,135,132,158,30,251,70,251,178,5,112,170,123,182,189,26,247,212,22,37,73,68,45,119,119,
+    142,146,122,30,247,67,247,176,5,166,109,154,97,90,26,14,171,0,47,251,193,108,0,81,32,247,89,62,1,243,14,150,159,161,141,29,38,251,206,42,10,247,225,175,247,137,203,29,228,212,178,204,
+    183,30,74,180,210,100,227,27,141,4,12,247,36,240,4,55,10,247,37,48,235,251,31,53,69,100,74,98,30,203,95,66,178,51,238,0,240,9,249,37,247,71,21,222,193,85,58,31,251,175,6,225,151,191,
+    188,221,27,252,198,251,71,21,4,1,160,233,205,68,37,37,73,68,45,44,74,27,6,240,31,112,207,251,111,21,233,247,191,6,79,171,204,106,217,27,247,37,221,247,4,247,41,247,42,52,244,251,32,
+    61,73,104,72,106,31,132,227,5,54,6,234,251,137,21,241,197,210,88,6,33,38,39,88,6,241,1,211,239,30,14,112,248,200,247,139,21,247,42,54,245,251,31,132,6,166,30,247,223,45,254,79,233,
+    247,191,7,79,0,244,0,3,247,41,31,45,138,21,38,82,66,43,43,81,212,240,158,6,115,30,14,112,175,247,140,21,28,36,241,18,217,204,172,199,172,30,251,191,232,249,88,55,7,131,51,5,206,107,
+    72,174,62,27,251,32,51,34,251,42,31,234,135,21,240,226,28,81,68,37,39,80,67,45,39,208,30,14,251,151,106,10,14,251,151,247,210,249,63,74,18,240,2,247,8,82,139,29,251,151,247,33,248,
+    186,131,10,247,182,251,87,14,0,240,4,106,10,251,70,252,149,104,10,251,71,86,10,14,251,71,247,241,249,76,44,0,255,16,251,127,85,10,251,71,247,64,248,199,131,10,78,252,195,109,29,251,
+    71,167,247,34,21,53,201,81,238,130,30,115,88,223,11,4,0,0,7,2,146,18,5,23,12,159,155,173,5,245,144,211,197,227,26,231,35,34,225,251,71,247,59,248,199,21,197,76,10,247,30,5,34,66,5,
+    16,78,153,0,240,97,86,10,247,47,251,140,132,29,90,247,54,22,248,159,7,222,192,190,215,209,180,95,77,72,95,97,69,30,90,61,188,6,247,0,197,88,52,59,85,79,39,31,55,59,6,135,158,176,137,
+    167,27,247,48,231,233,247,21,230,88,208,49,168,31,195,163,171,194,202,26,247,3,59,210,251,17,251,25,50,56,251,29,30,252,152,7,14,251,201,162,29,14,251,201,247,98,22,247,119,210,212,
+    68,247,2,95,29,251,2,68,66,210,251,119,28,0,255,5,247,141,248,193,200,29,96,253,104,21,248,46,235,218,43,183,29,251,201,237,9,13,4,18,162,73,30,15,9,13,9,0,108,0,241,12,243,33,133,
+    29,79,248,42,248,125,33,29,79,248,39,85,29,228,82,33,29,79,247,113,77,29,247,155,10,0,22,90,40,7,34,53,22,49,7,32,186,66,35,0,81,205,67,10,247,57,35,0,65,230,113,10,167,9,0,17,47,36,
+    7,48,143,251,65,76,0,194,74,100,10,46,138,29,14,79,247,171,248,175,216,12,128,89,190,72,143,29,247,19,33,62,0,240,5,77,248,195,134,29,247,173,69,33,29,251,10,247,97,22,232,6,247,96,
+    80,21,14,255,11,165,122,96,123,97,131,107,25,131,169,125,180,122,185,32,247,165,24,39,6,14,247,33,247,65,22,153,40,7,44,80,10,150,40,46,56,10,148,40,48,56,10,42,74,0,241,2,248,145,
+    46,10,251,141,66,29,247,33,247,219,248,182,127,10,63,11,0,175,196,248,198,99,10,251,184,252,198,21,103,0,53,241,7,55,248,182,123,10,251,65,66,29,251,37,247,10,22,247,12,247,71,247,
+    14,251,71,184,36,241,28,59,247,134,247,62,247,139,5,32,6,251,13,251,74,251,16,247,74,5,251,1,6,247,62,251,139,251,63,251,134,5,14,251,21,160,251,111,83,10,251,21,248,11,245,5,112,160,
+    69,29,251,21,247,86,79,7,17,44,11,0,19,63,80,7,48,203,253,161,39,0,34,247,178,71,7,240,34,251,84,69,29,251,62,248,55,22,218,251,158,7,247,158,247,225,5,216,252,17,60,247,156,7,251,
+    156,251,226,5,63,7,14,251,62,247,245,46,10,247,45,252,182,63,10,251,62,247,68,27,9,97,61,6,247,218,253,64,16,0,241,15,120,120,10,247,83,252,198,63,10,114,248,87,248,125,34,29,52,193,
+    247,200,41,29,251,182,122,29,14,139,66,10,198,8,241,0,118,29,247,134,66,10,247,110,252,46,232,248,125,251,203,213,8,19,196,213,8,18,54,85,37,243,30,119,10,7,249,48,247,19,21,173,165,
+    165,173,172,113,166,105,105,114,112,106,105,164,113,173,31,14,247,130,66,10,247,101,252,46,233,249,116,45,251,139,251,101,118,29,129,33,9,17,121,196,44,243,4,235,218,43,162,10,251,
+    121,217,7,156,29,7,14,247,60,247,210,251,111,3,42,241,20,217,186,178,219,170,77,10,43,96,29,251,114,217,6,119,10,67,40,29,247,45,7,247,59,252,72,193,29,6,14,71,248,35,22,233,143,0,
+    48,6,156,29,27,0,240,5,109,7,186,247,91,21,172,165,165,173,173,113,165,106,105,113,113,105,105,165,129,0,64,66,248,120,22,243,10,118,139,251,101,217,7,192,153,186,0,33,75,164,83,0,
+    161,101,252,46,7,14,84,248,94,248,245,190,0,82,173,113,165,105,106,61,0,176,172,31,251,144,252,245,21,248,46,247,97,171,0,96,125,251,191,183,29,142,173,33,240,21,47,247,111,252,47,
+    232,248,47,235,217,43,247,45,46,251,45,251,111,162,10,43,61,235,252,47,7,14,247,72,247,97,22,248,47,247,34,169,0,86,73,193,29,62,6,205,0,241,1,171,77,10,42,6,251,36,252,29,251,35,248,
+    29,5,251,103,60,0,1,56,0,255,255,255,193,6,14,160,247,177,22,213,7,59,169,91,214,220,26,237,213,203,232,233,212,75,42,63,97,62,53,105,30,65,247,108,213,43,7,197,187,173,209,216,26,
+    247,23,37,242,251,40,251,39,35,37,251,25,63,172,70,196,90,30,44,65,6,14,133,247,3,22,233,248,46,247,76,251,182,6,52,175,104,216,163,168,141,143,168,30,216,7,88,140,5,108,140,119,152,
+    178,26,247,167,241,218,252,203,60,233,7,14,205,188,247,253,21,251,117,247,3,251,41,247,79,247,78,247,3,247,41,247,117,247,116,251,8,247,44,251,73,251,74,251,8,251,44,251,116,30,236,
+    22,247,72,213,247,0,247,19,247,19,212,251,0,251,72,251,70,66,251,0,251,19,251,19,65,247,0,247,70,30,14,251,155,247,79,249,15,21,253,15,233,249,103,251,138,51,7,14,87,248,170,140,21,
+    230,251,226,152,29,41,38,251,47,136,30,237,6,242,141,197,204,228,27,226,191,85,48,62,106,90,251,9,38,31,251,125,251,93,5,64,7,14,80,247,148,248,10,21,247,7,199,81,52,46,78,79,45,48,
+    81,194,233,31,42,6,251,42,241,52,247,34,247,39,247,2,232,247,38,247,22,46,222,251,15,154,30,247,90,247,81,5,218,252,85,52,247,217,147,10,148,125,29,103,247,184,127,21,247,48,246,244,
+    247,42,247,31,44,242,251,39,85,91,124,110,101,31,187,247,84,5,247,183,229,251,254,139,10,240,198,70,46,41,76,74,41,47,82,196,232,31,42,6,251,36,235,45,247,40,30,14,123,247,33,248,130,
+    21,65,38,113,79,53,26,251,38,247,8,251,5,247,42,247,41,247,6,247,0,247,43,247,35,38,247,0,251,42,114,113,134,129,114,30,247,73,247,132,5,251,6,6,251,61,252,113,21,238,207,209,237,235,
+    207,69,40,40,71,68,43,41,71,210,238,30,14,32,147,249,103,21,49,248,42,7,251,169,253,13,5,241,6,247,166,249,13,5,229,7,14,137,186,247,93,21,251,20,244,54,247,53,247,52,245,224,247,19,
+    228,87,211,58,165,30,207,166,177,196,213,26,247,6,43,216,251,34,251,36,42,62,251,5,66,176,82,207,110,30,59,110,88,69,146,10,229,230,196,95,70,69,82,94,48,49,80,185,210,30,119,251,224,
+    21,219,205,190,242,243,205,88,59,58,72,87,37,36,72,191,220,30,14,123,248,106,247,121,21,213,240,165,200,224,26,247,39,251,8,247,5,251,42,251,41,251,6,251,1,251,42,251,36,240,251,0,
+    247,42,164,165,144,149,164,30,251,73,251,132,5,247,6,6,247,61,248,113,21,40,71,69,41,43,71,209,238,238,207,211,235,237,207,67,40,30,14,172,182,247,252,21,251,119,244,251,39,247,74,
+    247,74,244,247,39,247,119,247,117,251,0,247,43,251,71,251,71,251,0,251,43,251,117,30,236,22,247,71,203,247,1,247,18,247,18,203,251,1,251,71,251,69,75,251,1,251,18,251,18,75,247,1,247,
+    69,30,14,172,247,192,226,21,251,88,52,248,113,226,251,78,249,16,251,173,51,247,78,6,14,172,248,213,140,21,230,251,225,152,29,40,38,251,47,137,30,236,6,242,142,250,1,4,159,172,247,190,
+    248,10,21,247,8,198,250,1,22,192,84,52,247,216,147,10,172,125,29,172,247,213,250,1,17,245,250,1,243,16,45,242,251,40,86,91,124,111,101,31,186,247,83,5,247,184,229,251,255,139,10,241,
+    197,70,46,41,77,74,41,46,83,250,1,242,0,234,45,247,41,30,14,172,247,58,248,130,21,64,38,114,250,1,146,7,251,5,247,42,247,42,247,5,250,1,241,0,39,247,0,251,42,113,113,134,128,114,30,
+    247,73,247,133,159,18,162,61,252,113,21,238,206,209,237,236,206,250,1,132,42,71,210,238,30,14,172,216,250,1,18,168,250,1,250,3,165,249,13,5,229,7,14,172,203,247,93,21,251,20,245,54,
+    247,52,250,1,20,178,250,1,247,14,35,251,35,41,62,251,5,66,177,82,207,110,30,58,111,88,68,146,10,230,229,197,95,70,69,81,94,49,48,250,1,176,243,242,205,88,59,58,73,87,37,36,71,250,1,
+    241,1,172,248,130,247,121,21,214,240,164,200,224,26,247,39,251,7,250,1,50,42,251,5,250,1,145,239,251,0,247,42,165,165,144,150,250,1,67,133,5,247,5,250,1,82,72,69,41,42,72,250,1,17,
+    236,250,1,240,27,251,98,167,247,9,172,29,230,251,6,251,3,67,48,251,28,30,207,22,244,181,199,212,211,180,79,142,10,252,28,247,13,247,166,186,29,251,168,247,218,39,119,7,0,243,255,65,
+    34,247,11,21,156,146,139,138,150,31,193,134,166,107,95,26,88,103,108,89,88,106,170,191,30,72,6,49,202,84,226,225,208,194,227,220,82,186,70,148,30,247,8,242,5,200,251,167,76,247,85,
+    7,251,14,251,1,5,93,7,14,251,138,248,1,123,21,200,87,247,184,52,7,251,98,251,183,5,77,247,119,55,205,223,7,251,108,200,21,247,42,247,107,5,251,107,7,14,251,162,159,181,91,10,251,140,
+    227,247,98,21,93,77,123,101,86,26,49,211,69,232,231,209,205,233,228,77,202,47,125,125,137,134,126,30,246,247,35,5,62,6,47,251,182,21,194,177,180,196,193,178,98,84,83,100,98,85,82,101,
+    180,195,30,14,251,189,247,206,247,166,170,29,251,143,165,158,106,29,251,140,247,183,175,21,185,201,155,177,191,26,230,68,209,46,47,68,72,45,51,202,76,231,153,154,142,144,153,30,251,
+    2,251,37,5,216,6,231,247,182,21,85,101,97,83,84,101,181,193,195,177,180,194,195,177,98,83,30,14,251,163,169,247,65,198,29,244,85,214,44,49,82,66,33,30,199,138,21,218,170,185,195,196,
+    170,93,60,62,108,93,82,83,108,184,217,30,14,252,54,241,247,183,21,251,183,199,247,238,251,36,84,7,14,251,222,247,167,22,194,251,35,7,190,180,5,198,155,29,162,115,99,105,121,110,95,
+    103,30,251,5,48,5,96,7,14,251,233,159,247,3,152,10,199,99,176,85,147,30,225,218,5,192,10,45,249,194,58,99,29,104,161,10,14,251,205,247,80,206,21,72,197,206,183,194,95,247,116,66,64,
+    10,251,217,247,41,133,21,215,191,190,212,159,29,251,74,196,131,5,158,151,162,151,165,27,180,165,110,99,98,176,29,14,251,200,215,247,136,21,102,90,128,110,95,26,67,197,83,133,10,247,
+    0,148,10,168,182,179,169,110,98,96,110,110,98,96,109,168,182,30,14,251,251,247,87,247,182,21,251,21,251,182,5,201,6,247,20,247,182,5,195,251,136,83,7,14,251,209,166,234,190,29,113,
+    88,10,251,200,247,135,240,21,176,189,150,167,183,26,212,81,195,65,64,83,84,65,68,190,91,158,10,251,0,195,29,110,97,98,109,168,180,181,168,168,181,181,169,111,96,30,14,251,163,169,248,
+    186,198,29,245,85,213,44,49,82,67,32,30,199,22,217,170,185,195,196,170,94,60,61,108,93,82,83,108,185,217,30,14,252,54,35,49,243,28,14,251,222,247,167,248,14,21,193,251,35,7,190,181,
+    5,198,187,163,180,189,26,210,92,184,66,65,89,91,69,204,29,162,115,100,104,121,111,95,102,30,251,5,49,37,1,79,248,124,152,10,47,46,2,3,37,1,33,248,81,38,1,16,193,38,1,240,9,7,251,51,
+    251,120,5,89,7,205,193,21,247,0,247,46,5,251,46,7,14,251,217,89,10,30,1,35,249,2,30,1,241,0,66,197,84,133,10,246,148,10,169,182,179,169,109,98,97,29,1,17,167,29,1,32,118,10,9,1,227,
+    248,108,190,29,114,174,99,151,30,168,151,158,167,174,121,44,240,34,103,84,104,157,111,169,126,30,100,126,114,104,97,26,208,247,51,21,167,162,156,175,174,162,122,111,111,117,121,192,
+    29,173,168,158,177,177,167,120,105,105,112,119,100,100,111,158,174,30,14,73,1,161,248,115,21,176,188,150,168,183,26,211,74,1,243,0,85,65,68,190,90,158,10,32,195,29,109,97,98,109,169,
+    73,1,193,110,97,30,14,251,99,167,248,177,172,29,231,120,3,19,47,120,3,82,200,212,211,180,78,120,3,34,249,84,120,3,34,247,222,121,3,47,248,185,121,3,39,95,144,248,1,248,50,122,3,16,
+    33,248,108,123,3,47,249,16,123,3,38,33,249,84,123,3,34,248,85,124,3,47,248,102,125,3,35,247,17,252,125,247,234,249,90,21,59,90,29,14,197,74,29,248,174,22,194,251,36,7,190,180,5,199,
+    155,29,161,115,99,105,122,84,3,81,164,74,29,248,37,54,3,49,182,194,96,54,3,34,201,114,18,0,18,196,72,3,244,10,67,64,10,210,74,29,247,182,234,21,78,190,100,216,215,190,178,200,182,114,
+    88,10,247,0,114,20,0,33,215,216,20,0,131,129,29,174,175,162,74,10,119,254,41,240,27,174,168,157,176,177,168,121,104,105,111,120,100,101,60,29,247,15,89,10,248,131,247,230,105,10,93,
+    174,74,72,93,181,29,101,189,29,162,157,175,174,163,74,10,48,42,135,132,251,43,21,174,167,157,177,50,0,212,188,118,10,248,194,182,105,10,94,174,73,72,94,205,42,111,100,189,29,163,157,
+    174,54,0,8,242,86,251,108,231,248,203,21,168,128,162,135,169,135,120,122,122,122,118,109,100,83,24,186,107,179,194,159,166,150,162,147,163,25,148,118,150,206,29,100,195,120,169,124,
+    155,118,157,25,162,142,165,143,10,127,119,127,118,126,25,144,162,143,205,29,142,115,145,114,30,118,153,119,150,103,151,77,160,24,119,87,5,14,247,169,247,230,248,206,21,173,127,165,
+    135,162,136,120,122,123,122,118,110,99,82,81,0,240,3,168,150,161,147,163,25,147,117,151,206,29,101,196,117,168,125,155,119,81,0,241,14,166,143,171,151,205,163,24,118,191,76,118,104,
+    126,121,129,116,124,25,144,163,142,164,175,26,207,84,71,7,103,96,0,240,7,117,153,119,150,104,152,77,159,24,119,88,5,251,74,252,45,21,174,127,165,136,160,93,0,240,1,121,118,111,100,
+    82,24,185,107,180,194,159,168,150,162,146,161,174,0,49,115,160,110,201,42,241,26,101,195,117,168,126,154,118,159,25,162,142,166,143,10,126,118,128,119,126,184,29,144,115,143,114,30,
+    119,152,117,150,105,152,76,161,24,119,86,5,248,194,115,79,0,63,161,136,119,79,0,20,244,10,163,142,165,157,10,75,117,105,126,119,129,118,125,184,29,143,115,144,114,30,118,152,118,151,
+    104,2,1,242,135,251,143,233,249,102,21,45,6,247,175,253,102,5,232,6,14,251,217,247,43,247,63,21,192,182,183,190,192,96,183,86,86,95,95,86,88,184,95,191,31,14,251,116,247,94,247,13,
+    21,218,206,205,218,218,73,207,59,59,71,71,60,60,207,73,219,31,14,251,223,151,29,252,11,4,75,10,100,106,107,100,101,172,107,178,31,14,251,243,247,101,178,21,194,105,174,97,99,112,110,
+    99,102,167,115,172,151,147,141,143,146,30,108,110,112,98,132,30,97,7,210,148,193,199,211,26,14,247,2,158,29,247,123,22,75,10,99,194,29,179,31,247,122,22,178,172,171,177,178,106,171,
+    100,100,81,44,0,74,0,240,17,225,247,75,247,109,21,149,213,147,247,24,247,24,26,247,60,251,0,251,60,7,251,22,146,251,25,149,64,30,176,251,123,209,46,241,42,178,178,106,171,187,29,251,
+    225,247,39,249,117,21,99,194,29,179,75,10,31,102,251,122,21,129,63,132,251,24,251,22,26,251,61,247,0,247,61,7,247,23,131,247,25,129,213,30,14,208,201,247,181,21,121,51,5,239,112,53,
+    112,232,53,10,247,46,100,29,7,0,208,5,6,156,227,5,251,4,6,167,247,37,5,243,12,0,241,2,36,53,10,45,100,29,251,45,53,10,46,100,29,251,8,6,121,144,27,96,111,251,37,5,232,22,37,0,241,162,
+    247,46,6,110,251,37,5,14,251,243,158,29,14,45,247,177,247,67,21,164,7,190,175,171,192,177,30,197,181,207,190,244,26,247,19,51,229,251,34,251,27,37,40,251,25,30,236,6,221,198,201,218,
+    221,190,82,62,73,94,102,90,101,30,85,97,84,93,54,26,114,7,187,251,81,21,177,172,172,177,177,106,172,187,29,45,247,179,249,117,21,101,106,106,101,101,172,106,177,179,171,171,178,178,
+    107,171,99,31,100,251,81,21,114,7,88,103,107,87,101,30,80,97,71,88,34,26,251,19,227,49,247,35,247,26,241,238,247,25,30,42,6,57,80,78,60,57,88,195,216,205,185,176,187,177,30,194,181,
+    193,185,224,26,164,7,14,251,147,115,10,247,80,247,99,161,29,14,252,55,115,10,174,1,63,210,251,216,157,1,15,241,189,251,143,232,22,247,175,249,102,5,45,6,251,174,253,102,5,14,42,199,
+    47,21,248,46,213,252,46,6,14,251,201,184,247,219,21,207,165,108,91,31,251,109,7,75,183,97,208,30,200,213,92,6,113,123,156,168,31,247,104,7,196,117,174,87,156,30,191,155,161,173,197,
+    26,247,104,7,167,155,156,165,30,186,214,78,6,70,95,96,75,31,251,108,7,90,113,109,71,30,14,251,201,206,64,21,208,183,181,203,31,247,109,7,187,165,170,206,30,216,7,72,113,169,188,31,
+    247,108,7,203,95,182,70,30,77,64,186,6,165,155,122,111,31,251,104,7,81,162,105,191,123,30,87,122,116,104,82,26,251,104,7,110,123,122,113,30,92,65,6,14,251,240,247,37,138,21,249,112,
+    247,21,214,251,107,254,5,247,107,213,7,14,251,240,144,64,21,247,107,250,5,251,107,64,247,21,253,112,251,21,40,0,240,83,171,251,65,21,54,247,9,89,247,68,247,69,26,247,79,195,247,64,
+    218,247,2,30,61,6,41,251,13,84,251,70,251,62,26,251,73,200,251,66,231,251,7,30,14,251,240,218,251,65,21,230,247,7,200,247,66,247,73,26,247,62,84,247,70,42,247,13,30,60,6,219,251,2,
+    194,251,64,251,79,26,251,69,89,251,68,54,251,9,30,14,248,182,206,247,114,21,250,162,223,254,123,32,16,216,13,0,240,13,249,197,223,253,197,6,14,251,88,202,247,115,21,247,197,223,251,
+    197,6,14,166,149,29,248,94,251,136,21,208,29,12,177,49,96,14,166,146,29,247,252,156,37,14,7,50,243,15,14,251,109,149,29,14,251,109,146,29,14,251,78,101,10,247,71,22,194,107,171,98,
+    100,112,112,100,100,165,117,170,88,3,240,36,111,113,100,132,30,96,7,210,149,190,197,212,26,14,251,78,128,29,247,71,22,178,113,161,108,128,130,137,135,132,30,170,201,29,87,81,66,26,
+    85,171,106,180,178,166,167,177,30,14,251,78,130,34,0,131,193,107,172,98,100,112,111,101,74,0,240,4,150,10,97,7,210,148,190,198,212,26,14,252,1,128,29,14,252,1,130,5,0,241,255,255,174,
+    101,10,14,251,246,14,73,247,139,138,21,221,247,0,6,243,152,209,206,156,235,8,44,6,81,122,95,104,66,27,51,77,207,241,244,200,206,227,208,188,107,77,155,31,234,6,124,236,70,205,33,152,
+    8,247,1,57,251,1,7,251,13,121,59,39,251,28,26,251,29,221,43,247,11,120,30,14,180,248,187,221,21,201,202,61,215,5,166,178,155,186,190,26,190,123,187,112,179,30,217,215,77,202,61,62,
+    5,167,100,91,155,87,27,87,91,123,111,100,31,60,216,77,76,218,62,5,113,100,123,91,88,26,88,155,93,165,100,30,60,62,201,76,218,216,5,112,178,187,123,191,27,191,186,155,166,179,31,157,
+    247,91,21,54,67,69,54,53,69,209,224,226,208,209,226,225,210,69,52,30,14,89,247,149,42,21,203,226,6,247,24,151,224,219,247,11,26,239,81,202,251,12,166,30,100,148,5,247,140,7,204,130,
+    178,98,143,75,8,236,6,132,247,8,62,213,251,13,150,8,225,75,52,7,251,22,128,54,58,251,6,26,36,200,73,247,10,112,30,175,131,5,251,141,7,63,147,92,181,137,203,8,39,6,145,251,9,226,64,
+    247,24,131,8,123,248,66,21,69,156,106,176,197,26,203,184,182,213,149,30,251,125,7,222,251,3,21,208,123,172,102,81,26,76,93,96,64,129,30,247,123,7,14,150,248,92,127,21,183,184,145,150,
+    182,31,234,7,126,101,93,132,96,27,251,21,45,198,247,2,103,31,247,169,212,251,184,6,138,152,138,152,153,26,152,140,153,140,151,30,247,184,212,251,169,6,247,2,175,233,198,247,26,27,174,
+    188,133,128,173,31,231,7,150,106,92,146,98,27,251,76,251,28,40,251,55,97,31,61,66,205,6,138,126,138,126,125,26,126,140,126,140,126,30,73,66,216,6,251,57,181,247,29,43,247,69,27,14,
+    101,212,248,40,21,51,247,61,7,94,251,216,5,104,135,114,120,108,27,47,49,230,6,235,191,186,225,150,31,185,247,227,5,247,80,227,251,68,6,163,247,68,5,180,144,161,157,172,27,235,229,50,
+    6,43,82,85,48,127,31,114,251,72,5,14,140,248,8,22,247,33,213,221,247,42,31,45,6,45,138,105,92,41,27,251,95,6,195,163,169,199,204,26,170,134,167,131,166,30,247,104,216,251,131,6,126,
+    177,127,176,178,26,220,193,189,224,221,191,98,60,145,30,238,6,247,22,131,45,217,251,26,27,251,34,44,47,251,20,100,149,101,152,103,31,68,62,237,6,148,110,146,109,109,26,65,91,77,68,
+    129,30,48,7,14,135,247,128,247,250,21,251,36,66,247,66,73,251,66,66,247,66,251,38,232,247,38,247,65,212,251,65,205,247,65,212,251,35,6,247,106,248,1,5,251,2,6,251,73,251,219,251,73,
+    247,219,5,251,3,6,14,172,219,248,13,21,59,247,102,251,103,219,247,103,247,102,219,251,102,247,102,59,251,102,7,14,172,219,248,13,21,59,248,136,219,7,14,172,247,49,248,203,21,82,82,
+    247,65,251,65,251,66,251,66,196,82,247,66,247,66,247,66,251,66,196,196,251,10,0,240,27,247,65,82,196,251,66,251,65,5,14,172,247,222,248,65,21,175,170,170,174,176,108,169,103,102,109,
+    109,102,104,169,108,176,31,251,142,54,98,29,251,142,251,193,27,0,34,175,175,27,0,32,103,103,27,0,241,25,14,172,219,248,80,98,29,252,136,251,102,98,29,14,172,247,25,158,21,229,6,212,
+    247,26,5,247,176,220,251,132,6,209,247,21,5,247,62,220,251,18,20,0,241,34,49,6,66,251,26,5,251,176,58,247,132,6,69,251,21,5,251,62,58,247,18,6,14,172,248,216,247,90,21,237,7,252,136,
+    247,69,5,47,7,248,39,251,26,252,39,251,26,5,47,7,27,0,240,6,5,21,252,39,247,26,248,39,247,26,5,231,7,252,136,251,69,5,41,7,248,7,0,1,30,0,18,183,57,0,48,65,5,46,57,0,226,21,252,39,
+    251,22,5,47,7,102,4,58,248,136,220,64,0,16,102,64,0,112,22,248,39,247,21,5,232,64,0,18,65,64,0,243,46,65,5,252,136,251,10,155,10,172,219,248,61,21,58,247,102,251,67,219,247,67,247,
+    102,220,251,102,247,67,59,251,67,7,251,102,252,61,155,10,172,248,141,248,109,21,85,137,122,111,97,66,70,227,48,27,59,88,73,48,191,29,50,169,55,80,64,251,82,135,29,35,0,16,15,7,0,240,
+    61,192,247,248,21,252,123,57,248,33,251,82,229,6,14,247,86,248,44,127,21,247,92,247,45,247,51,247,107,222,117,213,99,200,31,231,222,93,189,51,59,5,204,76,52,177,40,27,251,92,251,44,
+    251,50,251,108,56,162,64,178,78,31,51,59,186,89,223,216,5,75,202,225,101,237,27,251,150,202,16,240,237,60,247,1,247,9,247,41,212,202,112,91,185,30,252,38,252,2,5,115,183,125,192,198,
+    26,247,150,251,177,21,67,77,166,186,94,31,248,38,248,2,5,163,96,152,86,80,26,251,59,251,1,251,10,251,43,30,14,247,143,190,247,176,21,251,1,219,59,247,3,221,196,179,224,197,30,54,197,
+    195,99,222,27,247,3,218,219,247,1,247,2,60,219,251,3,57,82,99,54,81,31,224,81,82,179,57,27,251,4,60,59,251,2,31,227,22,204,180,180,204,194,185,104,68,175,30,69,103,93,103,84,27,75,
+    97,181,203,31,247,249,22,210,174,185,174,195,27,203,181,97,75,75,97,97,75,84,92,175,209,104,31,14,251,114,247,2,126,21,220,198,198,225,31,248,98,7,177,159,159,170,30,213,224,60,6,57,
+    80,79,54,31,252,98,7,101,119,119,108,30,65,54,6,14,193,249,17,22,221,7,251,138,249,21,5,36,6,251,136,253,19,5,55,7,247,177,248,214,21,140,143,146,156,141,148,141,131,143,127,143,129,
+    247,82,252,132,24,252,33,6,14,200,247,74,22,249,13,247,215,222,53,243,221,103,252,155,40,10,64,248,143,22,230,252,0,7,247,116,247,163,251,115,247,163,5,247,255,229,252,110,39,6,247,
+    109,251,152,251,109,251,155,5,39,7,14,224,247,89,22,230,6,247,138,249,17,5,247,39,226,251,103,6,251,119,252,240,251,37,248,4,5,41,6,14,79,247,48,251,111,21,130,247,150,5,109,162,176,
+    118,188,27,209,190,174,190,167,31,149,65,5,223,248,125,46,251,150,6,34,92,84,53,67,94,179,244,30,247,165,45,253,88,7,14,145,193,247,142,21,251,52,247,7,37,247,34,247,40,247,12,244,
+    247,86,247,55,69,247,36,251,42,247,28,30,251,12,6,247,12,37,206,56,176,37,8,183,100,79,162,82,27,251,30,251,7,33,251,46,31,233,138,21,241,210,213,238,236,207,67,37,34,69,64,41,42,69,
+    213,243,30,14,247,197,84,10,61,166,29,14,249,86,84,10,248,37,22,247,0,62,215,33,33,62,63,251,0,32,216,62,245,245,216,216,246,30,252,115,166,29,248,37,22,75,96,101,54,240,123,181,184,
+    202,201,182,94,74,30,14,247,49,247,6,248,35,21,247,133,247,129,5,253,16,213,249,16,7,247,134,251,129,192,193,251,224,247,219,251,224,251,219,5,14,247,109,247,210,249,28,21,247,229,
+    6,252,231,252,231,192,86,248,231,248,231,5,251,229,215,248,101,252,102,7,14,247,206,248,134,248,212,21,247,130,251,131,253,56,138,5,65,249,56,7,251,130,251,131,192,86,247,222,247,221,
+    251,222,247,221,5,14,247,107,249,87,248,104,21,138,251,230,252,229,248,229,86,87,248,229,252,230,5,251,229,64,6,248,102,138,5,248,68,0,242,8,43,249,46,247,165,21,251,131,251,130,5,
+    249,80,64,253,80,7,251,131,247,130,86,86,65,0,241,14,247,222,5,14,247,110,248,163,213,21,251,230,140,248,232,248,233,86,191,252,232,252,232,5,247,229,63,252,102,63,0,241,117,206,248,
+    79,132,21,251,130,247,130,5,249,56,214,253,56,6,247,130,247,131,86,192,251,222,251,222,247,222,251,221,5,14,247,97,199,249,103,21,252,102,214,247,229,7,248,221,252,230,191,192,252,
+    220,248,230,247,230,140,5,214,7,14,248,98,199,247,156,21,247,137,251,138,5,247,0,7,38,239,247,124,140,5,138,7,248,85,140,40,40,5,251,2,7,247,135,247,139,251,136,247,136,5,251,1,7,239,
+    41,251,119,140,5,251,116,138,6,251,122,138,239,238,5,247,1,7,14,123,247,196,251,64,21,247,139,34,0,145,6,40,39,5,249,61,7,238,39,42,25,241,19,139,247,136,251,136,251,136,5,247,0,6,
+    238,239,138,251,119,5,251,115,7,140,251,123,40,239,5,251,0,6,14,247,163,58,10,5,0,129,213,4,251,65,251,34,247,33,34,5,0,8,0,240,30,65,247,65,247,34,251,34,251,65,251,66,251,33,251,
+    33,251,66,31,14,133,248,197,247,247,21,251,96,247,247,5,46,6,251,96,251,247,247,96,251,247,5,232,6,247,0,23,0,241,2,46,251,165,251,46,247,165,247,46,247,165,5,14,247,95,149,10,5,0,
+    241,38,249,15,64,21,252,196,252,196,248,196,7,14,247,231,199,22,249,226,6,252,59,249,90,5,14,247,232,248,120,249,93,21,252,60,253,91,5,249,227,6,253,101,208,21,247,190,248,135,247,
+    189,252,135,5,146,0,64,251,207,248,25,85,47,240,255,255,190,16,247,26,247,50,155,30,251,164,7,251,147,251,61,5,122,178,129,182,185,26,249,10,22,94,129,96,122,100,30,251,145,247,60,
+    5,247,164,7,247,49,121,247,15,251,26,251,53,26,252,205,251,78,21,247,113,247,38,5,251,165,7,49,148,60,187,87,209,8,247,181,247,38,21,247,111,251,38,89,70,60,91,49,129,25,14,236,247,
+    142,146,21,248,20,248,98,75,192,251,216,252,25,251,47,247,59,82,79,5,14,247,189,247,151,247,114,21,56,199,87,236,214,202,173,193,163,30,82,149,182,108,208,27,246,212,240,247,39,247,
+    125,251,66,247,60,251,134,251,130,251,74,251,73,251,130,251,133,247,73,251,73,247,131,232,225,167,193,210,31,107,193,5,91,76,63,113,60,27,251,93,251,44,247,47,247,97,247,94,247,45,
+    247,47,247,92,247,96,247,37,251,33,251,90,251,4,97,63,78,101,120,158,178,31,247,66,7,247,6,70,204,251,11,251,8,63,78,46,30,215,6,193,180,170,211,209,175,105,72,30,126,7,251,33,128,
+    5,251,0,131,79,85,59,26,226,142,21,186,173,165,213,145,30,247,7,149,5,116,7,54,89,88,57,80,107,163,185,30,14,219,248,220,22,247,2,6,251,4,247,20,5,174,195,159,211,221,26,48,6,85,130,
+    91,123,100,30,251,65,247,89,5,232,202,176,195,211,26,228,71,200,40,37,68,74,48,85,162,95,201,68,30,251,12,77,82,68,50,26,251,13,241,59,247,47,230,216,167,189,195,30,251,192,248,151,
+    21,187,171,170,190,189,169,110,92,85,110,95,78,102,30,83,203,122,169,177,26,56,252,21,21,204,175,186,229,189,30,247,95,251,122,5,100,99,85,119,72,27,34,76,187,218,31,14,99,167,248,
+    158,21,251,19,219,63,247,2,30,187,252,31,222,249,179,251,23,6,251,2,59,64,251,18,31,248,90,252,236,21,249,180,93,253,180,7,14,251,45,248,74,248,5,21,208,102,184,52,159,30,42,161,5,
+    92,149,114,164,172,26,184,172,165,198,196,173,109,89,140,56,29,80,55,88,162,102,191,115,31,81,116,102,91,84,26,70,174,93,227,119,30,236,118,5,187,129,164,114,106,26,94,106,113,80,82,
+    105,169,189,137,30,50,6,46,141,209,79,246,27,247,0,215,197,223,191,115,177,87,162,31,198,161,176,188,194,26,50,132,21,89,101,106,65,65,101,172,189,189,177,173,213,213,177,105,89,30,
+    14,247,84,248,45,125,21,247,100,247,54,247,57,247,103,247,102,251,54,247,56,251,100,251,99,251,54,251,56,251,102,251,103,247,53,251,57,247,100,31,200,4,251,65,251,23,247,28,247,71,
+    247,69,247,24,247,28,247,64,247,65,247,24,251,27,251,70,251,71,251,23,251,28,251,66,31,251,77,247,205,21,251,10,215,59,247,5,230,210,194,221,153,30,63,6,94,126,104,114,87,27,71,93,
+    192,218,217,187,193,208,190,172,115,93,151,31,216,6,224,125,72,192,45,27,251,3,60,56,251,10,31,14,251,27,93,10,95,198,21,223,194,7,183,55,5,180,6,88,233,5,170,150,156,164,169,26,183,
+    105,165,89,30,49,251,122,6,202,2,226,21,114,122,125,111,30,87,215,191,6,167,156,127,114,53,0,240,131,107,193,21,209,190,7,191,172,170,190,187,105,169,88,31,51,251,122,6,176,247,87,
+    21,189,6,169,156,124,110,109,122,123,109,31,89,6,14,154,247,12,249,61,21,251,130,184,247,130,233,181,251,125,97,7,247,202,251,130,21,247,78,7,222,251,78,5,178,6,221,247,81,5,251,81,
+    181,247,172,97,7,38,251,127,36,247,127,5,97,251,172,6,14,251,233,247,159,248,248,21,210,86,192,68,68,86,86,68,67,192,87,210,210,192,191,211,30,81,22,99,112,111,100,100,112,167,179,
+    179,166,167,178,178,166,111,99,30,14,251,196,247,16,52,21,214,250,2,64,6,12,0,240,1,91,249,171,21,64,251,247,214,6,64,252,159,21,214,247,248,22,0,243,7,204,247,18,247,169,21,201,247,
+    179,242,198,36,239,77,39,36,80,242,6,14,251,203,21,0,240,255,15,9,244,198,34,233,242,198,36,247,9,77,251,9,36,80,242,45,38,80,240,6,14,247,44,199,247,245,21,251,107,247,28,251,39,247,
+    96,247,17,243,200,237,188,30,101,153,5,60,97,46,85,36,27,33,55,182,213,87,31,247,72,248,194,7,140,154,139,158,158,26,247,98,251,28,247,15,251,85,251,84,251,30,251,38,251,103,30,239,
+    247,85,21,213,188,220,189,239,27,234,223,101,71,189,31,251,92,252,95,7,14,249,13,28,4,188,248,138,21,247,26,36,240,251,29,251,28,34,37,251,25,251,24,246,35,247,26,247,29,242,240,247,
+    27,30,254,154,252,138,21,49,10,250,163,248,137,21,52,75,74,52,54,72,206,224,227,203,202,227,227,202,76,51,30,203,252,17,21,222,252,66,56,7,14,251,19,247,46,248,36,21,235,247,132,235,
+    251,132,5,222,6,251,25,247,215,5,47,6,251,25,251,215,5,14,252,82,247,26,249,63,21,176,143,115,156,115,27,116,114,122,102,143,31,158,251,78,5,189,6,14,118,247,196,247,106,21,247,40,
+    247,6,247,6,247,39,247,39,251,6,247,6,251,40,251,40,251,8,251,6,251,39,251,39,247,7,251,6,247,41,31,183,4,251,17,47,231,247,17,247,17,231,6,0,241,195,15,232,46,251,16,251,15,46,45,
+    251,15,31,92,224,21,235,201,7,188,43,5,190,6,82,247,0,5,173,155,156,164,175,26,189,101,172,80,30,35,251,160,6,247,45,247,75,21,112,119,121,107,30,83,227,195,6,172,158,123,112,31,14,
+    251,126,94,10,252,52,150,29,252,18,130,10,252,17,177,29,251,135,110,10,251,169,114,10,251,169,154,29,251,139,111,10,251,207,95,10,251,120,98,10,251,150,199,249,194,36,10,14,252,66,
+    247,47,249,203,21,167,118,160,111,133,132,138,137,134,30,140,165,159,154,175,137,8,173,7,81,144,94,97,73,26,95,163,113,174,171,161,161,171,30,14,252,66,247,45,47,47,29,104,107,116,
+    116,108,111,160,117,167,146,146,140,142,144,30,137,112,119,124,103,142,8,104,7,198,134,183,182,205,26,14,252,20,116,29,36,248,120,248,175,21,56,6,251,253,252,217,5,224,6,14,136,0,33,
+    139,111,132,0,0,32,0,1,144,0,7,168,0,1,164,0,4,144,0,82,52,247,5,22,92,149,38,153,173,104,191,154,153,52,10,131,131,40,54,20,14,195,0,251,48,252,46,247,1,247,172,21,248,172,242,194,
+    251,58,253,26,247,58,194,7,14,252,46,247,0,249,196,21,252,172,36,84,247,58,249,26,251,58,84,7,14,250,236,227,22,247,108,249,80,251,108,81,29,247,152,253,80,21,247,109,249,80,251,109,
+    13,0,242,0,252,89,4,247,108,247,97,251,108,6,14,247,31,248,74,201,51,240,3,95,95,116,160,10,224,102,29,252,104,252,188,67,29,247,31,247,205,169,50,65,76,10,247,29,161,34,96,29,5,251,
+    86,252,54,25,0,240,75,108,29,248,46,252,101,131,29,247,31,248,7,121,10,251,222,252,70,67,29,247,42,249,35,251,24,21,174,218,251,46,211,5,247,14,194,217,247,18,247,54,26,73,29,30,142,
+    143,139,142,27,247,128,248,10,21,140,29,207,22,233,64,29,83,251,114,61,10,114,248,49,249,66,135,10,247,16,75,34,29,114,247,248,249,67,21,93,116,113,140,10,69,52,147,163,251,90,34,29,
+    114,247,124,180,19,64,33,247,189,36,0,208,101,248,205,21,168,29,247,53,22,168,29,220,59,33,0,113,215,248,189,84,29,247,92,29,0,159,57,248,236,39,10,247,178,251,72,248,76,12,127,114,
+    248,109,100,10,56,7,29,77,2,162,129,247,136,51,29,114,247,181,248,182,149,55,6,199,66,240,24,163,173,173,163,114,104,102,116,114,104,31,247,54,251,5,34,29,114,182,29,247,39,251,100,
+    21,132,49,121,179,108,167,102,156,25,157,160,150,167,170,21,45,243,3,73,72,88,88,73,109,148,112,156,119,30,50,104,86,51,251,8,26,228,36,1,0,73,19,30,132,77,144,251,156,153,165,29,247,
+    60,251,151,113,0,112,87,248,202,21,174,150,160,247,50,132,82,202,27,197,173,181,220,134,207,64,241,31,107,92,63,145,31,247,208,63,34,29,52,145,29,251,252,252,8,41,29,52,117,10,52,251,
+    130,41,29,52,247,220,248,237,21,168,118,160,124,10,97,72,26,95,162,113,174,171,105,41,243,47,166,251,185,41,29,52,116,10,251,114,251,146,41,29,251,194,170,247,192,21,66,200,49,7,40,
+    188,90,225,79,10,30,127,217,5,83,29,216,219,212,59,247,2,91,29,251,2,7,14,251,182,247,128,248,192,199,29,199,253,21,21,108,10,38,0,0,22,0,17,39,2,36,98,159,134,168,27,192,186,11,49,
+    241,9,127,44,29,156,173,5,140,6,79,10,31,127,217,5,108,10,58,172,92,198,124,30,112,83,51,44,80,150,142,158,27,164,51,44,160,120,125,109,117,120,146,149,119,31,14,228,33,240,75,95,251,
+    2,21,183,116,165,104,107,116,37,29,168,128,10,183,78,10,93,247,202,248,192,153,10,14,44,190,249,5,21,78,247,206,200,7,14,252,14,159,247,202,21,247,103,240,5,209,7,251,103,38,5,14,251,
+    161,159,247,213,21,247,210,221,251,210,6,14,247,3,149,248,175,21,249,98,224,253,98,6,14,251,142,159,247,188,21,247,229,247,53,211,52,241,119,229,251,53,5,14,36,248,220,249,103,21,46,
+    6,252,187,253,103,5,234,6,14,252,52,244,249,207,21,172,168,166,173,174,110,167,106,104,112,111,104,105,166,112,174,31,14,126,152,249,244,155,251,49,153,251,140,153,6,251,125,153,7,
+    219,10,231,11,219,146,144,12,12,231,142,142,12,13,247,122,20,249,7,21,177,19,0,133,2,0,1,0,48,0,57,0,60,0,80,0,88,0,95,0,107,0,115,0,119,0,129,0,168,0,206,0,222,0,233,0,240,0,244,0,
+    248,1,11,1,19,1,27,1,35,1,41,1,47,65,98,241,182,61,1,99,1,102,1,115,1,144,1,148,1,173,1,193,1,207,1,221,1,226,1,230,1,242,1,254,2,10,2,17,2,28,2,36,2,45,2,53,2,60,2,64,2,70,2,76,2,
+    81,2,190,2,225,3,44,3,48,3,115,3,118,3,145,3,175,3,179,3,233,3,238,4,32,4,45,4,57,4,92,4,132,4,161,4,170,4,176,4,206,4,224,4,239,4,254,5,28,5,63,5,71,5,81,5,91,5,118,5,136,5,145,5,
+    150,5,157,5,164,5,171,5,178,5,201,5,216,5,225,5,239,5,249,6,1,6,21,6,37,6,56,6,64,6,82,6,100,6,107,6,124,6,141,6,158,6,170,6,179,6,189,6,201,6,208,6,222,6,230,6,243,6,254,7,4,7,15,
+    7,26,7,37,7,46,7,56,7,66,7,76,7,86,7,96,7,106,7,116,7,124,120,62,255,0,151,7,160,7,169,7,178,7,184,7,190,7,196,138,10,81,48,24,255,0,147,29,21,48,6,72,32,29,211,6,11,21,92,10,21,82,
+    56,0,128,21,247,141,208,251,141,6,11,220,54,17,237,31,68,16,222,31,68,243,13,81,232,5,11,21,247,140,208,251,140,6,11,253,103,7,14,21,73,29,207,29,30,36,22,140,29,203,29,218,41,162,
+    247,43,251,0,245,251,38,51,10,30,205,41,10,201,40,3,34,51,15,110,79,13,240,4,251,46,234,37,247,36,247,10,230,210,245,158,30,97,10,21,112,10,38,82,4,96,112,10,11,249,59,39,183,0,240,
+    15,252,50,41,10,251,193,42,10,248,195,7,248,6,252,195,5,237,249,103,41,252,195,6,156,10,6,11,247,56,22,206,43,147,11,251,39,251,0,33,251,43,11,162,68,113,11,6,178,247,93,5,11,217,69,
+    240,3,11,140,5,174,7,11,58,247,146,24,11,253,156,112,29,248,85,83,19,58,240,22,67,247,66,247,107,247,106,251,67,247,67,251,106,251,106,251,67,251,66,251,107,251,107,247,66,251,66,247,
+    107,31,11,33,104,10,21,42,29,20,52,1,11,39,40,11,21,95,43,65,197,45,252,188,125,43,32,124,128,125,43,111,14,21,49,10,14,21,137,37,5,2,203,28,70,88,7,205,194,203,28,33,21,196,26,80,
+    2,163,45,19,11,25,37,16,109,105,37,213,46,11,248,182,84,29,11,71,10,197,11,6,57,132,40,215,11,203,247,72,5,247,196,6,204,251,72,5,11,184,72,16,11,179,59,0,216,1,5,159,71,148,11,121,
+    112,111,117,120,102,101,11,172,70,146,11,232,196,46,5,217,6,56,11,86,79,242,2,11,181,205,26,14,167,167,144,149,164,11,248,125,5,41,6,11,215,73,245,6,247,1,104,232,78,205,30,210,233,
+    5,46,6,105,94,5,176,84,73,159,64,27,36,79,243,63,2,174,46,200,73,31,69,46,5,234,6,172,182,5,104,193,204,119,212,27,207,29,31,252,228,22,247,60,236,247,3,247,39,191,186,125,113,176,
+    30,251,217,252,63,5,104,187,119,203,215,26,248,125,22,251,59,41,251,5,251,39,87,94,153,164,102,30,247,216,248,64,5,174,91,159,75,64,26,14,232,37,1,235,79,47,77,10,231,79,2,240,31,248,
+    43,248,188,21,247,0,63,216,32,33,63,62,251,0,32,215,62,245,246,215,216,246,30,248,17,247,62,21,43,6,252,185,253,102,5,235,6,230,248,188,21,75,95,188,29,154,15,95,248,197,252,17,21,
+    202,15,0,80,11,252,57,109,29,74,42,15,0,78,43,145,11,110,29,14,129,29,175,174,162,95,1,240,6,192,29,174,168,157,177,177,167,121,104,105,112,120,100,100,60,29,247,41,248,8,210,31,117,
+    211,159,29,251,73,196,130,210,31,240,210,111,98,99,176,29,11,21,117,29,14,21,52,206,77,231,232,204,202,230,226,77,202,53,109,113,132,124,119,30,165,238,5,247,65,202,251,116,6,84,251,
+    119,202,129,5,166,160,165,152,174,27,193,176,102,83,83,102,103,85,86,101,174,191,31,14,70,10,242,123,29,247,139,247,218,21,247,9,227,227,247,9,247,9,51,227,251,9,251,9,49,50,251,8,
+    251,8,228,50,247,10,31,173,4,41,67,212,237,237,211,212,237,236,211,66,41,41,67,66,42,31,11,247,8,249,164,21,169,29,247,53,22,169,29,14,247,48,249,140,61,29,206,88,189,142,29,14,154,
+    10,247,58,6,247,24,247,59,247,89,251,225,5,247,6,6,251,138,248,52,247,134,247,199,5,251,9,6,251,214,252,46,5,11,45,6,81,122,89,104,72,27,50,82,207,244,245,200,207,228,202,189,106,77,
+    155,31,233,6,247,1,122,53,209,251,15,27,251,35,42,33,251,45,31,14,245,249,160,68,10,172,22,7,241,29,79,6,103,129,118,115,30,98,109,196,79,27,83,106,91,64,146,31,14,21,129,10,247,53,
+    22,129,10,11,22,107,10,248,125,11,247,92,173,21,194,107,171,99,99,113,254,23,145,169,151,148,142,150,10,96,7,209,247,23,64,11,21,183,115,138,6,241,11,117,107,111,161,118,167,128,10,
+    184,78,10,47,29,103,108,116,37,29,167,146,145,140,142,145,87,29,241,9,0,15,0,96,146,140,142,144,87,29,65,30,3,249,29,2,233,71,33,114,173,228,31,175,159,167,175,26,196,11,247,240,248,
+    129,66,75,11,49,11,109,10,14,60,177,11,83,29,247,152,91,29,251,165,7,11,38,60,242,21,175,29,196,29,11,247,87,250,24,21,56,6,68,251,24,5,208,6,247,113,247,24,21,52,6,61,251,24,5,209,
+    6,14,247,149,250,25,1,62,240,28,86,224,223,193,192,225,30,14,170,165,165,171,170,113,166,108,11,249,59,153,29,11,247,10,249,148,126,10,14,247,48,249,42,161,29,11,247,168,248,198,163,
+    29,11,213,51,16,164,87,0,114,249,47,21,251,21,251,181,174,33,18,181,174,33,128,11,192,154,170,200,54,10,121,39,50,98,49,43,29,11,248,198,32,62,80,11,249,173,197,29,125,48,16,106,125,
+    48,21,11,20,55,65,11,101,29,47,213,81,240,7,111,132,132,138,136,134,30,141,166,159,154,175,136,8,174,7,80,144,95,11,163,10,65,74,1,99,82,0,198,49,17,11,114,73,69,5,217,6,57,41,10,144,
+    11,21,197,104,29,216,69,10,11,88,1,1,55,11,34,123,104,61,77,20,11,202,0,2,52,74,0,70,74,99,247,94,249,148,58,29,12,6,112,5,61,6,82,45,81,233,46,74,12,138,45,243,3,11,214,213,195,193,
+    213,210,88,188,66,130,130,138,136,130,30,221,11,155,10,229,57,251,29,5,11,21,48,6,71,32,29,212,6,11,43,83,18,11,92,6,2,123,74,243,6,144,10,219,247,199,6,11,6,51,252,7,222,118,5,180,
+    172,195,168,200,27,11,123,55,24,11,191,83,241,69,11,34,36,98,79,67,66,97,199,242,30,14,157,10,76,117,104,11,21,218,206,174,195,164,31,149,60,5,11,247,74,22,247,213,247,250,251,213,
+    237,11,52,26,247,8,247,231,21,206,198,183,11,7,251,97,251,89,5,74,7,14,5,68,6,76,251,117,21,180,169,11,199,22,249,90,249,90,253,90,6,11,143,146,30,107,125,26,128,11,21,47,6,72,251,
+    24,5,69,5,4,212,80,0,233,73,0,223,73,113,58,6,11,247,74,249,103,22,7,244,21,11,21,248,136,220,252,136,6,14,252,6,248,195,5,41,253,103,11,143,172,151,205,162,24,118,192,11,212,148,148,
+    140,142,148,30,57,11,30,77,32,11,166,39,77,194,52,192,86,11,116,117,101,101,115,162,178,31,224,74,2,85,74,161,11,90,251,12,31,61,11,0,1,0,146,71,1,114,102,81,2,0,49,0,1,2,0,51,12,0,
+    12,64,105,209,1,0,21,0,21,0,1,0,25,0,25,0,1,74,105,48,1,0,41,224,73,241,9,0,43,0,43,0,1,0,52,0,52,0,1,0,54,0,54,0,1,0,56,0,56,0,1,96,105,240,6,1,0,67,0,67,0,1,0,69,0,69,0,1,0,76,0,
+    76,0,1,0,80,175,114,241,9,0,83,0,83,0,1,0,87,0,87,0,1,0,93,0,93,0,1,0,98,0,98,0,1,132,105,241,152,1,0,115,0,115,0,1,0,120,0,120,0,1,0,124,0,125,0,1,0,136,0,136,0,1,0,138,0,139,0,1,
+    0,145,0,145,0,1,0,149,0,149,0,1,0,160,0,160,0,1,0,165,0,165,0,1,0,167,0,167,0,1,0,178,0,178,0,1,0,180,0,180,0,1,0,186,0,187,0,1,0,193,0,193,0,1,0,204,0,204,0,1,0,206,0,207,0,1,0,211,
+    0,211,0,1,0,217,0,218,0,1,0,223,0,223,0,1,0,234,0,234,0,1,0,239,0,240,0,1,0,245,0,245,0,1,0,249,0,251,0,1,0,253,1,5,0,1,1,184,1,198,0,3,1,200,1,211,0,3,1,220,1,221,0,1,1,240,1,247,
+    206,108,0,56,1,240,21,10,0,90,0,116,0,2,68,70,76,84,0,14,108,97,116,110,0,18,0,56,0,0,0,52,0,8,65,90,69,32,0,52,67,65,84,6,0,16,82,6,0,241,4,75,65,90,32,0,52,77,79,76,32,0,52,82,79,
+    77,32,0,52,84,30,0,112,84,82,75,32,0,52,0,244,107,0,252,115,144,1,0,2,107,101,114,110,0,14,136,91,65,0,20,0,0,144,1,0,6,0,0,166,73,64,6,9,68,0,152,116,241,4,1,0,8,0,1,0,12,0,34,0,7,
+    0,172,1,214,0,2,0,3,172,0,17,0,172,0,17,15,166,0,17,27,134,1,0,38,0,15,8,107,7,17,67,107,91,25,80,10,107,49,115,0,120,124,1,17,136,118,1,51,145,0,149,254,106,14,252,106,0,72,1,20,223,
+    252,106,208,0,249,0,250,0,251,0,253,0,254,0,255,1,156,104,113,2,1,3,1,4,1,5,56,1,161,35,0,0,0,142,0,0,1,36,0,249,74,49,0,154,0,183,73,35,0,202,4,0,224,190,0,0,0,238,0,0,0,244,0,0,0,
+    226,0,33,74,49,1,0,172,212,1,51,2,0,184,32,0,83,202,0,1,0,196,48,0,0,40,0,64,208,0,0,0,66,108,17,220,52,0,53,3,0,232,68,0,241,12,4,0,250,0,5,1,0,0,6,1,6,0,5,1,12,0,5,1,18,0,6,1,24,
+    0,5,1,30,132,0,64,1,0,197,2,8,2,17,168,6,0,17,78,6,0,17,136,6,0,17,104,6,0,49,98,0,13,152,2,177,0,0,1,1,7,0,253,0,1,0,190,24,0,17,87,118,1,17,175,12,0,113,106,2,198,0,1,0,170,12,0,
+    17,143,6,0,17,184,6,0,17,174,178,1,17,156,12,0,16,200,6,0,32,1,1,6,0,144,0,209,2,82,0,1,0,125,1,200,2,240,4,179,1,106,0,1,1,113,2,70,0,1,0,189,1,160,0,1,1,6,18,0,208,0,106,2,211,0,
+    67,3,172,3,178,0,0,3,246,0,64,0,0,0,3,250,0,1,157,3,0,5,0,48,3,196,3,50,1,0,11,0,96,0,0,0,4,132,3,4,1,3,14,0,48,3,214,3,10,1,0,52,0,160,226,0,0,3,232,3,238,0,0,3,40,1,0,18,0,16,250,
+    53,2,3,41,0,64,0,4,6,4,212,117,3,15,0,66,4,18,4,24,11,0,176,4,30,0,0,4,36,4,42,0,0,4,44,119,0,98,0,50,54,4,60,28,0,0,6,0,64,4,66,4,180,8,0,2,4,0,64,4,72,5,134,10,0,160,4,78,4,84,4,
+    90,4,96,4,102,14,0,2,4,0,66,4,108,4,114,10,0,0,6,0,64,4,120,4,126,8,0,2,4,0,242,1,4,132,4,138,0,0,4,144,0,0,4,150,0,0,4,156,22,0,2,6,0,66,4,162,4,168,10,0,0,6,0,41,4,174,112,0,48,186,
+    4,192,22,0,2,4,0,67,4,198,6,58,10,0,211,204,0,0,4,210,4,216,0,0,4,222,4,228,20,0,18,234,8,0,0,6,0,64,4,240,4,246,8,0,2,4,0,48,4,252,5,102,3,2,13,0,83,0,5,8,5,14,11,0,119,0,0,0,5,20,
+    5,26,14,0,99,32,5,38,0,0,5,64,119,130,5,50,5,56,0,0,5,62,32,0,66,5,68,5,74,10,0,0,6,0,64,5,80,5,86,8,0,2,4,0,64,5,92,5,98,10,0,224,5,104,5,110,0,0,6,136,5,116,0,0,5,122,18,0,66,0,0,
+    5,128,52,1,2,14,0,6,6,0,32,5,140,12,0,32,5,146,6,0,2,4,0,66,5,152,5,158,10,0,0,6,0,65,5,164,5,170,8,0,144,176,5,182,5,188,5,194,5,200,14,0,2,4,0,66,5,206,5,212,10,0,0,6,0,96,5,218,
+    5,224,5,230,10,0,0,4,0,64,5,236,5,242,8,0,2,4,0,66,5,248,5,254,10,0,0,6,0,64,6,4,7,78,8,0,2,4,0,48,6,10,6,148,113,2,13,0,85,0,0,0,6,22,11,0,80,0,6,28,6,34,14,0,128,6,40,6,46,0,0,6,
+    52,122,1,32,6,64,18,0,98,0,0,6,70,6,76,10,0,0,6,0,48,6,82,6,128,120,0,11,0,0,68,0,51,94,6,100,11,0,0,14,0,55,106,6,112,14,0,114,118,6,124,0,0,6,130,18,0,66,6,136,6,142,10,0,0,6,0,48,
+    6,148,6,32,4,81,0,6,160,6,166,16,0,16,172,6,0,2,4,0,49,6,178,6,26,3,17,6,24,3,49,6,196,6,16,3,144,6,208,6,214,0,0,6,220,6,60,4,2,41,0,0,114,0,0,18,4,3,14,0,49,6,238,6,12,3,145,6,250,
+    7,0,0,0,7,6,7,2,3,144,7,18,7,24,0,0,7,30,7,152,4,163,0,7,42,7,48,0,0,7,54,7,244,2,96,7,66,0,0,7,72,38,1,34,7,84,71,0,34,7,90,8,0,3,6,0,128,1,1,75,2,220,0,1,2,30,0,32,1,2,40,113,48,
+    1,2,50,18,0,128,1,7,2,212,0,1,1,169,12,4,16,1,252,2,144,1,1,54,2,219,0,1,1,127,18,0,32,0,175,238,3,33,1,45,42,0,16,57,18,0,32,2,13,6,0,129,1,74,2,214,0,1,1,101,12,0,32,139,2,110,6,
+    0,32,1,49,1,1,105,42,0,17,105,24,0,17,105,54,4,16,133,18,0,0,219,78,65,0,1,0,182,24,0,17,145,48,0,0,153,0,49,1,1,90,30,0,17,134,120,4,17,182,6,0,32,223,1,58,7,112,185,1,120,0,1,1,174,
+    30,0,16,1,52,2,0,132,4,81,220,0,1,1,116,66,0,96,98,2,192,0,1,1,188,2,49,1,1,132,36,0,16,132,24,0,129,3,77,0,10,0,1,1,133,180,0,48,128,2,213,36,0,1,168,0,16,121,30,0,33,1,53,120,0,0,
+    0,3,49,1,1,30,54,0,17,28,24,0,17,25,12,0,113,25,1,134,0,1,1,100,12,0,0,12,2,48,1,1,193,30,0,128,2,210,2,204,0,1,1,150,12,0,33,1,247,30,0,17,247,12,0,17,48,12,0,17,83,12,0,17,28,12,
+    0,0,22,123,49,1,1,115,102,0,0,38,3,145,1,1,17,1,246,0,1,1,165,36,0,17,216,6,0,16,175,18,0,32,2,160,12,0,224,3,214,255,249,0,1,0,215,2,119,0,1,1,91,18,0,32,1,15,30,0,16,1,208,2,49,1,
+    1,230,24,0,1,192,7,225,2,20,2,224,0,1,1,181,2,95,0,1,1,18,42,0,17,111,6,0,96,26,1,253,0,1,1,242,2,48,1,0,163,30,0,1,178,8,144,1,1,79,2,57,0,1,1,5,36,0,48,0,117,2,66,8,17,117,12,0,16,
+    164,72,0,225,0,147,1,122,0,1,0,117,1,128,0,1,1,186,114,0,16,233,30,0,33,1,36,12,0,17,33,12,0,17,35,12,0,0,20,117,80,1,1,35,0,245,236,1,1,84,0,2,72,0,16,234,12,0,16,0,186,4,224,1,0,
+    194,1,250,0,1,0,225,2,7,0,1,0,84,115,16,1,202,80,65,0,1,0,158,36,0,16,161,78,0,32,0,197,100,2,129,0,158,1,49,0,1,1,23,90,0,16,25,24,0,33,1,243,6,0,17,129,18,0,0,176,5,48,1,1,12,54,
+    0,32,1,9,24,0,32,0,251,24,0,18,0,218,115,17,229,12,0,16,229,24,0,33,1,33,246,0,0,64,3,34,1,2,44,1,16,20,30,0,32,1,38,30,0,129,0,138,2,130,0,1,0,209,12,0,17,183,82,2,64,182,1,40,0,218,
+    6,176,0,0,1,2,242,2,217,0,1,2,236,30,0,32,3,42,14,1,128,1,224,2,125,0,1,1,227,18,0,128,2,228,2,99,0,1,1,241,168,0,18,2,14,1,0,222,116,16,1,6,84,64,0,1,1,187,74,1,33,1,187,42,0,113,
+    117,2,115,0,1,1,217,74,1,17,157,66,0,16,145,24,0,32,1,160,66,0,32,0,173,66,0,33,1,219,24,0,1,20,1,32,2,222,24,0,32,1,235,24,0,32,2,48,174,0,16,2,214,3,48,1,0,175,18,0,32,0,115,18,0,
+    0,53,82,32,0,1,103,83,240,5,0,1,0,116,1,246,0,2,0,8,0,2,0,10,32,228,0,1,2,118,76,9,79,1,54,3,46,2,0,1,134,6,210,6,210,3,76,4,58,2,0,34,32,164,2,0,0,26,0,12,4,0,69,4,76,6,142,2,0,150,
+    156,6,156,6,162,6,162,6,180,2,0,2,58,0,10,6,0,163,6,210,6,216,8,114,9,104,10,42,2,0,23,64,2,0,21,70,2,0,31,104,2,0,0,53,114,13,184,2,0,53,210,16,48,2,0,18,74,2,0,79,32,164,16,88,2,
+    0,2,119,180,16,180,16,206,16,102,2,0,49,206,16,152,22,0,11,4,0,69,21,250,16,124,2,0,95,166,16,166,32,182,2,0,1,137,16,130,16,130,16,152,16,166,2,0,31,206,2,0,0,0,118,0,83,206,16,232,
+    17,22,2,0,23,48,2,0,112,70,32,208,32,208,17,204,6,0,46,32,188,2,0,69,18,98,20,60,2,0,52,86,22,16,2,0,34,21,236,2,0,225,32,188,32,194,32,208,21,250,32,182,32,208,22,16,166,0,240,42,
+    208,22,16,22,42,22,84,22,122,22,204,23,10,23,96,23,146,23,192,24,62,24,132,24,194,24,204,24,210,24,216,24,234,24,244,24,250,25,16,26,62,26,88,25,68,25,68,25,22,25,68,25,118,25,184,
+    26,62,18,0,65,26,94,29,20,2,0,17,34,2,0,49,76,29,86,4,0,81,200,29,116,29,154,4,0,213,200,29,246,29,252,30,2,30,144,32,158,32,158,210,1,0,32,1,15,190,0,0,35,32,194,2,0,17,208,224,0,
+    145,208,0,2,0,30,0,1,0,40,38,12,241,96,61,0,40,0,69,0,144,0,50,0,146,0,147,0,126,0,149,0,179,0,128,0,182,0,182,0,159,0,186,0,253,0,160,0,255,1,1,0,228,1,3,1,5,0,231,1,8,1,17,0,234,
+    1,25,1,25,0,244,1,39,1,39,0,245,1,42,1,42,0,246,1,45,1,45,0,247,1,48,1,49,0,248,1,55,1,55,0,250,1,68,1,68,0,251,1,76,1,76,0,252,1,81,1,83,0,253,1,85,1,85,1,0,36,119,240,39,1,1,95,1,
+    95,1,8,1,97,1,97,1,9,1,99,1,99,1,10,1,101,1,114,1,11,1,118,1,118,1,25,1,166,1,167,1,26,1,171,1,172,1,28,1,215,1,218,1,30,1,220,1,239,1,104,12,243,255,255,255,255,255,255,184,108,255,
+    158,0,233,255,222,1,88,255,226,1,93,0,9,1,166,255,231,1,167,255,247,1,173,255,166,0,59,0,1,255,246,0,2,255,246,0,3,255,246,0,4,255,246,0,5,255,246,0,6,255,246,0,7,255,246,0,8,255,246,
+    0,9,255,246,0,10,255,246,0,11,255,246,0,12,255,246,0,13,255,246,0,52,0,4,0,53,0,4,0,93,255,240,0,94,255,240,0,95,255,240,0,96,255,240,0,97,255,240,0,108,255,236,0,109,255,241,0,110,
+    255,241,0,111,255,241,0,112,255,241,0,113,255,241,0,114,255,239,0,115,255,232,0,116,255,232,0,117,255,232,0,118,255,232,0,119,255,232,0,233,255,246,0,234,255,246,0,235,255,246,0,236,
+    255,246,0,237,255,246,0,238,255,246,0,240,255,246,0,241,255,246,0,242,255,246,0,243,255,246,0,244,255,246,0,250,255,250,1,76,0,9,1,82,255,241,1,83,255,241,1,87,255,241,1,90,0,9,1,91,
+    0,9,1,93,255,246,1,101,255,246,1,102,255,246,1,103,255,246,1,173,255,231,1,232,255,250,1,233,255,250,1,234,255,250,1,235,255,250,0,4,0,108,255,236,0,114,255,246,1,93,255,236,1,173,
+    255,246,0,144,0,1,255,211,0,2,255,211,0,3,255,211,0,4,255,211,0,5,255,211,0,6,255,211,0,7,255,211,0,8,255,211,0,9,255,211,0,10,255,211,0,11,255,211,0,12,255,211,0,13,255,211,0,52,255,
+    207,0,53,255,207,0,125,255,216,0,126,255,216,0,127,255,216,0,128,255,216,0,129,255,216,0,130,255,216,0,131,255,216,0,132,255,216,0,133,255,216,0,134,255,216,0,135,255,216,0,136,255,
+    216,0,137,255,216,0,139,255,218,0,140,255,218,0,141,255,218,0,142,255,218,0,143,255,218,0,144,255,218,0,145,255,218,0,146,255,218,0,147,255,218,0,148,255,218,0,149,255,218,0,150,255,
+    218,0,151,255,218,0,152,255,218,0,153,255,218,0,154,255,218,0,155,255,218,0,156,255,218,0,157,255,218,0,158,255,218,0,160,255,226,0,161,255,226,0,162,255,226,0,163,255,226,0,164,255,
+    226,0,186,255,226,0,187,255,226,0,188,255,226,0,189,255,226,0,190,255,226,0,191,255,226,0,192,255,226,0,193,255,218,0,194,255,218,0,195,255,218,0,196,255,218,0,197,255,218,0,198,255,
+    218,0,199,255,218,0,200,255,218,0,201,255,218,0,202,255,218,0,203,255,218,0,204,255,226,0,206,255,218,0,207,255,226,0,208,255,226,0,209,255,226,0,210,255,226,0,211,255,237,0,212,255,
+    237,0,213,255,237,0,214,255,237,0,215,255,237,0,216,255,237,0,223,255,226,0,224,255,226,0,225,255,226,0,226,255,226,0,227,255,226,0,228,255,226,0,229,255,226,0,230,255,226,0,231,255,
+    226,0,232,255,226,0,233,255,232,0,234,255,232,0,235,255,232,0,236,255,232,0,237,255,232,0,238,255,232,0,239,255,232,0,240,255,232,0,241,255,232,0,242,255,232,0,243,255,232,0,244,255,
+    232,0,245,255,242,0,246,255,242,0,247,255,242,0,248,255,242,0,249,255,218,0,250,255,220,1,76,0,9,1,82,255,146,1,83,255,146,1,87,255,146,1,90,0,9,1,91,0,9,1,93,255,196,1,96,0,20,1,98,
+    0,20,1,100,0,20,1,101,255,236,1,102,255,236,1,103,255,236,1,104,255,246,1,106,255,246,1,110,0,26,1,112,0,26,1,167,255,226,1,173,0,14,1,222,255,218,1,223,255,218,1,224,255,218,1,225,
+    255,218,1,226,255,218,1,227,255,218,1,228,255,218,1,229,255,218,1,230,255,218,1,231,255,218,1,232,255,220,1,233,255,220,1,234,255,220,1,235,255,220,0,3,0,108,255,232,1,93,0,17,1,173,
+    255,246,0,1,1,93,255,236,0,4,0,233,255,212,1,93,0,10,1,166,255,206,1,167,255,226,0,7,0,108,255,187,0,233,255,216,1,88,255,216,1,93,0,21,1,166,255,226,1,167,255,246,1,173,255,156,0,
+    1,0,233,255,243,0,102,0,1,255,222,0,2,255,222,0,3,255,222,0,4,255,222,0,5,255,222,0,6,255,222,0,7,255,222,0,8,255,222,0,9,255,222,0,10,255,222,0,11,255,222,0,12,255,222,0,13,255,222,
+    0,52,255,202,0,53,255,202,0,125,255,236,0,126,255,236,0,127,255,236,0,128,255,236,0,129,255,236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,
+    0,136,255,236,0,137,255,236,0,139,255,234,0,140,255,234,0,141,255,234,0,142,255,234,0,143,255,234,0,144,255,234,0,145,255,234,0,146,255,234,0,147,255,234,0,148,255,234,0,149,255,234,
+    0,150,255,234,0,151,255,234,0,152,255,234,0,153,255,234,0,154,255,234,0,155,255,234,0,156,255,234,0,157,255,234,0,158,255,234,0,160,255,234,0,161,255,234,0,162,255,234,0,163,255,234,
+    0,164,255,234,0,193,255,234,0,194,255,234,0,195,255,234,0,196,255,234,0,197,255,234,0,198,255,234,0,199,255,234,0,200,255,234,0,201,255,234,0,202,255,234,0,203,255,234,0,206,255,234,
+    0,211,255,252,0,212,255,252,0,213,255,252,0,214,255,252,0,215,255,252,0,216,255,252,0,249,255,234,0,250,255,234,1,76,0,20,1,82,255,158,1,83,255,158,1,87,255,158,1,90,0,20,1,91,0,20,
+    1,93,255,207,1,101,255,226,1,102,255,226,1,103,255,226,1,104,255,236,1,106,255,236,1,167,255,226,1,171,0,20,1,172,0,20,1,222,255,234,1,223,255,234,1,224,255,234,1,225,255,234,1,226,
+    255,234,1,227,255,234,1,228,255,234,1,229,255,234,1,230,255,234,1,231,255,234,1,232,255,234,1,233,255,234,1,234,255,234,1,235,255,234,0,61,0,1,255,237,0,2,255,237,0,3,255,237,0,4,255,
+    237,0,5,255,237,0,6,255,237,0,7,255,237,0,8,255,237,0,9,255,237,0,10,255,237,0,11,255,237,0,12,255,237,0,13,255,237,0,108,255,227,0,109,255,237,0,110,255,237,0,111,255,237,0,112,255,
+    237,0,113,255,237,0,114,255,223,0,115,255,213,0,116,255,213,0,117,255,213,0,118,255,213,0,119,255,213,0,211,0,11,0,212,0,11,0,213,0,11,0,214,0,11,0,215,0,11,0,216,0,11,0,233,0,11,0,
+    234,0,11,0,235,0,11,0,236,0,11,0,237,0,11,0,238,0,11,0,239,0,6,0,240,0,11,0,241,0,11,0,242,0,11,0,243,0,11,0,244,0,11,1,76,255,246,1,82,255,197,1,83,255,197,1,87,255,197,1,90,255,246,
+    1,91,255,246,1,93,255,232,1,101,0,10,1,102,0,10,1,103,0,10,1,109,255,222,1,110,255,216,1,111,255,222,1,112,255,216,1,167,255,252,1,171,255,252,1,172,255,252,1,173,255,226,0,48,0,1,
+    255,235,0,2,255,235,0,3,255,235,0,4,255,235,0,5,255,235,0,6,255,235,0,7,255,235,0,8,255,235,0,9,255,235,0,10,255,235,0,11,255,235,0,12,255,235,0,13,255,235,0,93,255,231,0,94,255,231,
+    0,95,255,231,0,96,255,231,0,97,255,231,0,108,255,224,0,109,255,232,0,110,255,232,0,111,255,232,0,112,255,232,0,113,255,232,0,114,255,234,0,115,255,204,0,116,255,204,0,117,255,204,0,
+    118,255,204,0,119,255,204,0,120,0,9,0,121,0,9,0,122,0,9,0,123,0,9,210,0,151,236,1,83,255,236,1,87,255,236,210,0,240,28,247,1,108,255,226,1,109,255,225,1,110,255,216,1,111,255,225,1,
+    112,255,216,1,113,255,226,1,173,255,226,0,5,0,108,255,249,0,233,255,252,1,166,255,236,136,3,64,1,173,255,236,180,20,240,19,255,241,0,8,0,108,0,10,0,233,255,217,0,239,255,217,1,88,255,
+    252,1,93,255,187,1,166,255,216,1,167,255,216,1,173,226,92,1,38,6,242,255,255,38,167,255,249,0,209,0,1,255,158,0,2,255,158,0,3,255,158,0,4,255,158,0,5,255,158,0,6,255,158,0,7,255,158,
+    0,8,255,158,0,9,255,158,0,10,255,158,0,11,255,158,0,12,255,158,0,13,255,158,0,15,255,224,0,16,255,224,0,17,255,224,0,18,255,224,0,19,255,224,0,20,255,224,0,36,255,224,0,37,255,224,
+    0,38,255,224,0,39,255,224,0,40,255,224,0,52,255,172,0,53,255,172,0,69,255,224,0,70,255,224,0,71,255,224,0,72,255,224,0,73,255,224,0,74,255,224,0,75,255,224,0,76,255,224,0,77,255,224,
+    0,78,255,224,0,79,255,224,0,82,255,224,0,87,255,252,0,88,255,252,0,89,255,252,0,90,255,252,0,91,255,252,0,92,255,252,0,93,0,10,0,94,0,10,0,95,0,10,0,96,0,10,0,97,0,10,0,124,255,224,
+    0,125,255,177,0,126,255,177,0,127,255,177,0,128,255,177,0,129,255,177,0,130,255,177,0,131,255,177,0,132,255,177,0,133,255,177,0,134,255,177,0,135,255,177,0,136,255,177,0,137,255,177,
+    0,139,255,177,0,140,255,177,0,141,255,177,0,142,255,177,0,143,255,177,0,144,255,177,0,145,255,177,0,146,255,177,0,147,255,177,0,148,255,177,0,149,255,177,0,150,255,177,0,151,255,177,
+    0,152,255,177,0,153,255,177,0,154,255,177,0,155,255,177,0,156,255,177,0,157,255,177,0,158,255,177,0,159,255,243,0,160,255,177,0,161,255,177,0,162,255,177,0,163,255,177,0,164,255,177,
+    0,186,255,207,0,187,255,207,0,188,255,207,0,189,255,207,0,190,255,207,0,191,255,207,0,192,255,207,0,193,255,177,0,194,255,177,0,195,255,177,0,196,255,177,0,197,255,177,0,198,255,177,
+    0,199,255,177,0,200,255,177,0,201,255,177,0,202,255,177,0,203,255,177,0,204,255,207,0,206,255,177,0,207,255,207,0,208,255,207,0,209,255,207,0,210,255,207,0,211,255,197,0,212,255,197,
+    0,213,255,197,0,214,255,197,0,215,255,197,0,216,255,197,0,218,255,247,0,219,255,247,0,220,255,247,0,221,255,247,0,222,255,247,0,223,255,207,0,224,255,207,0,225,255,207,0,226,255,207,
+    0,227,255,207,0,228,255,207,0,229,255,207,0,230,255,207,0,231,255,207,0,232,255,207,0,233,255,227,0,234,255,217,0,235,255,217,0,236,255,217,0,237,255,217,0,238,84,2,240,107,0,240,255,
+    227,0,241,255,227,0,242,255,227,0,243,255,227,0,244,255,227,0,245,255,227,0,246,255,227,0,247,255,227,0,248,255,227,0,249,255,177,0,250,255,177,0,251,255,247,0,252,255,243,0,253,255,
+    243,0,254,255,243,0,255,255,243,1,0,255,243,1,1,255,243,1,2,255,243,1,3,255,247,1,4,255,247,1,5,255,247,1,76,0,20,1,81,255,212,1,82,255,162,1,83,255,162,1,87,255,162,1,88,255,247,1,
+    90,0,20,1,91,0,20,1,92,124,6,241,141,255,178,1,101,255,187,1,102,255,187,1,103,255,187,1,104,255,196,1,105,255,227,1,106,255,196,1,107,255,227,1,108,255,176,1,113,255,176,1,166,255,
+    207,1,167,255,192,1,171,255,247,1,172,255,247,1,215,255,224,1,216,255,224,1,217,255,224,1,218,255,224,1,219,255,224,1,222,255,177,1,223,255,177,1,224,255,177,1,225,255,177,1,226,255,
+    177,1,227,255,177,1,228,255,177,1,229,255,177,1,230,255,177,1,231,255,177,1,232,255,177,1,233,255,177,1,234,255,177,1,235,255,177,1,236,255,247,1,237,255,247,1,238,255,247,1,239,255,
+    247,0,6,0,233,255,227,0,239,255,237,174,0,255,255,51,93,255,203,1,166,255,212,1,167,255,202,0,151,0,15,255,227,0,16,255,227,0,17,255,227,0,18,255,227,0,19,255,227,0,20,255,227,0,36,
+    255,227,0,37,255,227,0,38,255,227,0,39,255,227,0,40,255,227,0,52,255,247,0,53,255,247,0,69,255,227,0,70,255,227,0,71,255,227,0,72,255,227,0,73,255,227,0,74,255,227,0,75,255,227,0,76,
+    255,227,0,77,255,227,0,78,255,227,0,79,255,227,0,82,255,227,0,124,255,227,0,125,255,247,0,126,255,247,0,127,255,247,0,128,255,247,0,129,255,247,0,130,255,247,0,131,255,247,0,132,255,
+    247,0,133,255,247,0,134,255,247,0,135,255,247,0,136,255,247,0,137,255,247,0,139,255,227,0,140,255,227,0,141,255,227,0,142,255,227,0,143,255,227,0,144,255,227,0,145,255,227,0,146,255,
+    227,0,147,255,227,0,148,255,227,0,149,255,227,0,150,255,227,0,151,255,227,0,152,255,227,0,153,255,227,0,154,255,227,0,155,255,227,0,156,255,227,0,157,255,227,0,158,255,227,0,159,255,
+    247,0,160,255,236,0,161,255,236,0,162,255,236,0,163,255,236,0,164,255,236,0,193,255,227,0,194,255,227,0,195,255,227,0,196,255,227,0,197,255,227,0,198,255,227,0,199,255,227,0,200,255,
+    227,0,201,255,227,0,202,255,227,0,203,255,227,0,206,255,227,184,2,4,255,22,237,0,224,255,237,0,225,255,237,0,226,255,237,0,227,255,237,0,228,255,237,0,229,255,237,0,230,255,237,0,231,
+    255,237,0,232,255,237,130,9,6,15,126,9,1,51,249,255,227,160,2,249,10,247,0,253,255,247,0,254,255,247,0,255,255,247,1,0,255,247,1,1,255,247,1,2,255,247,160,2,241,34,88,255,233,1,96,
+    0,30,1,98,0,30,1,100,0,30,1,101,255,230,1,102,255,230,1,103,255,230,1,104,255,216,1,106,255,216,1,109,255,247,1,110,255,252,1,111,255,247,1,112,160,5,17,227,148,12,243,100,171,255,
+    227,1,172,255,227,1,215,255,227,1,216,255,227,1,217,255,227,1,218,255,227,1,219,255,227,1,222,255,227,1,223,255,227,1,224,255,227,1,225,255,227,1,226,255,227,1,227,255,227,1,228,255,
+    227,1,229,255,227,1,230,255,227,1,231,255,227,1,236,255,247,1,237,255,247,1,238,255,247,1,239,255,247,0,6,0,233,255,203,0,239,255,218,1,88,255,232,1,93,255,184,1,166,255,187,1,167,
+    255,185,0,3,0,233,255,240,20,13,241,0,240,0,3,0,108,255,177,0,233,255,236,1,173,255,216,60,6,145,187,0,114,255,227,0,233,255,249,182,2,49,173,255,206,60,6,2,28,0,209,238,0,239,0,20,
+    1,166,255,247,1,167,255,227,88,6,209,3,1,84,0,31,1,88,0,52,1,173,0,86,78,0,0,32,4,17,246,78,0,17,6,92,0,2,78,0,17,239,78,0,49,123,0,30,82,0,8,26,0,17,234,26,0,49,93,255,252,26,0,241,
+    30,11,0,93,255,196,0,94,255,196,0,95,255,196,0,96,255,196,0,97,255,196,0,108,255,207,0,109,255,234,0,110,255,234,0,111,255,234,0,112,255,234,0,113,255,234,72,0,240,2,234,0,233,0,15,
+    0,239,0,30,1,93,255,238,1,166,0,10,244,6,1,202,0,112,194,0,233,255,241,0,239,230,6,131,0,4,1,173,255,217,0,33,22,0,15,126,13,3,31,239,130,13,4,241,24,245,255,246,0,246,255,246,0,247,
+    255,246,0,248,255,246,1,76,255,240,1,82,255,246,1,83,255,246,1,87,255,246,1,90,255,240,1,91,255,240,196,0,241,14,105,255,238,1,107,255,238,1,109,255,236,1,110,255,230,1,111,255,236,
+    1,112,255,230,1,171,255,236,1,172,102,1,241,88,226,0,37,0,114,255,247,0,138,0,9,0,165,0,9,0,166,0,9,0,167,0,13,0,168,0,13,0,169,0,13,0,170,0,13,0,171,0,13,0,172,0,13,0,173,0,13,0,174,
+    0,13,0,175,0,13,0,176,0,9,0,177,0,9,0,178,0,9,0,179,0,9,0,180,0,9,0,181,0,9,0,182,0,9,0,183,0,9,0,184,0,9,0,185,0,9,0,205,0,9,0,217,0,9,170,1,255,30,88,0,13,1,96,0,18,1,98,0,18,1,100,
+    0,18,1,109,0,9,1,110,0,9,1,111,0,9,1,112,0,9,1,173,0,26,1,220,0,13,1,221,0,9,0,118,138,11,36,243,10,226,0,53,255,226,0,93,255,217,0,94,255,217,0,95,255,217,0,96,255,217,0,97,255,217,
+    12,10,255,94,227,0,110,255,227,0,111,255,227,0,112,255,227,0,113,255,227,0,114,255,232,0,115,255,203,0,116,255,203,0,117,255,203,0,118,255,203,0,119,255,203,0,120,255,225,0,121,255,
+    225,0,122,255,225,0,123,255,225,0,125,255,234,0,126,255,234,0,127,255,234,0,128,255,234,0,129,255,234,0,130,255,234,0,131,255,234,0,132,255,234,0,133,255,234,0,134,255,234,0,135,255,
+    234,0,136,255,234,0,137,255,234,222,11,132,160,249,0,212,255,249,0,213,255,249,0,242,21,115,215,255,249,0,216,255,249,222,11,255,26,231,1,82,255,173,1,83,255,173,1,87,255,173,1,93,
+    255,237,1,101,255,222,1,102,255,222,1,103,255,222,1,104,255,242,1,106,255,242,1,167,255,222,202,11,24,209,231,1,233,255,231,1,234,255,231,1,235,255,231,38,3,17,217,118,1,81,239,0,10,
+    1,93,190,3,17,222,190,3,159,101,0,52,255,252,0,53,255,252,192,1,4,31,217,204,11,2,255,132,115,255,218,0,116,255,218,0,117,255,218,0,118,255,218,0,119,255,218,0,139,255,237,0,140,255,
+    237,0,141,255,237,0,142,255,237,0,143,255,237,0,144,255,237,0,145,255,237,0,146,255,237,0,147,255,237,0,148,255,237,0,149,255,237,0,150,255,237,0,151,255,237,0,152,255,237,0,153,255,
+    237,0,154,255,237,0,155,255,237,0,156,255,237,0,157,255,237,0,158,255,237,0,193,255,237,0,194,255,237,0,195,255,237,0,196,255,237,0,197,255,237,0,198,255,237,0,199,255,237,0,200,255,
+    237,0,201,255,237,0,202,255,237,0,203,255,237,0,206,255,237,66,13,6,241,162,218,0,20,0,219,0,20,0,220,0,20,0,221,0,20,0,222,0,20,0,234,0,10,0,235,0,10,0,236,0,10,0,237,0,10,0,238,0,
+    10,0,240,0,10,0,241,0,10,0,242,0,10,0,243,0,10,0,244,0,10,0,249,255,237,0,251,0,20,1,3,0,20,1,4,0,20,1,5,0,20,1,82,255,252,1,83,255,252,1,87,255,252,1,101,255,217,1,102,255,217,1,103,
+    255,217,1,104,255,232,1,106,255,232,1,166,255,252,1,167,255,242,1,173,255,236,1,222,255,237,1,223,255,237,1,224,255,237,1,225,255,237,1,226,255,237,1,227,255,237,1,228,255,237,1,229,
+    255,237,1,230,255,237,1,231,255,237,1,236,0,20,1,237,0,20,1,238,0,20,1,239,122,140,17,108,26,6,0,70,5,240,2,211,0,5,0,114,0,11,1,88,0,20,1,93,255,222,1,167,68,4,33,0,36,212,1,2,74,
+    3,2,212,1,17,237,34,2,177,173,255,231,0,10,1,11,255,250,1,15,164,4,241,2,215,1,83,255,215,1,87,255,215,1,93,255,241,1,108,255,206,50,12,2,46,12,241,2,206,0,9,1,9,255,247,1,13,255,252,
+    1,15,0,17,1,16,40,5,19,20,166,6,19,247,166,6,241,10,247,0,20,1,9,0,4,1,10,0,4,1,11,0,4,1,12,255,236,1,13,255,249,1,15,150,18,213,20,1,82,0,9,1,83,0,9,1,87,0,9,140,9,59,93,0,20,150,
+    14,245,122,226,1,106,255,226,1,110,255,250,1,112,255,250,0,15,1,9,255,246,1,10,255,240,1,11,0,13,1,12,255,255,1,13,255,254,1,15,0,16,1,76,0,10,1,82,255,239,1,83,255,239,1,87,255,239,
+    1,90,0,10,1,91,0,10,1,101,0,9,1,102,0,9,1,103,0,9,0,21,1,9,255,218,1,10,255,230,1,11,255,255,1,12,255,245,1,13,255,245,1,14,255,240,1,15,255,222,1,17,255,232,1,26,0,10,1,76,255,247,
+    1,82,255,235,1,83,255,235,1,87,255,235,1,90,255,247,1,91,255,247,34,15,241,10,109,255,207,1,110,255,207,1,111,255,207,1,112,255,207,0,12,1,9,255,238,1,10,255,241,230,0,121,15,255,252,
+    1,17,255,250,66,0,51,109,255,252,190,7,16,252,190,7,161,0,11,1,9,255,212,1,10,255,242,50,0,1,194,0,105,255,200,1,17,255,236,54,0,17,110,236,7,241,0,247,0,31,1,8,255,240,1,9,0,14,1,
+    10,255,250,50,0,251,48,12,255,215,1,13,255,240,1,14,255,230,1,15,0,50,1,16,255,246,1,17,0,9,1,76,0,49,1,82,255,157,1,83,255,157,1,87,255,157,1,90,0,49,1,91,0,49,1,93,255,171,1,96,0,
+    40,1,98,0,40,1,100,0,40,234,10,49,186,1,105,102,8,48,186,1,107,106,8,243,1,0,36,1,110,0,36,1,111,0,36,1,112,0,36,0,17,222,0,2,172,0,50,12,255,250,114,1,225,255,246,1,82,255,245,1,83,
+    255,245,1,87,255,245,250,13,241,12,101,255,252,1,102,255,252,1,103,255,252,1,109,255,242,1,110,255,242,1,111,255,242,1,112,255,242,184,1,209,249,1,10,255,252,1,11,255,240,1,12,255,
+    230,60,2,145,14,255,247,1,15,255,245,1,16,114,1,6,114,2,240,20,109,255,240,1,110,255,236,1,111,255,240,1,112,255,236,0,2,1,12,255,126,1,26,255,226,0,1,1,45,0,14,0,1,1,40,126,21,241,
+    9,1,38,255,251,1,42,255,246,1,45,0,23,1,55,0,23,0,2,1,145,0,10,1,146,200,27,81,68,0,40,0,5,26,0,112,48,255,251,1,52,255,246,34,0,241,51,1,68,255,216,0,1,1,42,255,206,0,11,0,108,255,
+    247,0,109,255,247,0,110,255,247,0,111,255,247,0,112,255,247,0,113,255,247,0,115,255,243,0,116,255,243,0,117,255,243,0,118,255,243,0,119,255,243,0,12,0,108,255,162,0,233,255,173,20,
+    8,255,88,8,255,215,1,9,255,175,1,11,255,239,1,12,255,239,1,13,255,235,1,14,255,226,1,15,255,226,1,16,255,245,1,17,255,230,0,16,0,186,0,50,0,187,0,50,0,188,0,50,0,189,0,50,0,190,0,50,
+    0,191,0,50,0,192,0,50,0,204,0,50,0,207,0,50,0,208,0,50,0,209,0,50,0,210,0,50,1,109,0,20,1,110,0,20,1,111,0,20,1,112,0,20,0,33,208,8,4,241,4,187,0,109,255,217,0,110,255,217,0,111,255,
+    217,0,112,255,217,0,113,164,5,241,74,243,0,115,255,184,0,116,255,184,0,117,255,184,0,118,255,184,0,119,255,184,0,233,255,226,0,234,255,236,0,235,255,236,0,236,255,236,0,237,255,236,
+    0,238,255,236,0,239,255,236,0,240,255,226,0,241,255,226,0,242,255,226,0,243,255,226,0,244,255,226,0,245,255,236,0,246,255,236,0,247,255,236,0,248,255,236,0,6,0,108,200,3,241,2,20,1,
+    10,0,10,1,12,255,199,1,13,255,236,1,15,0,44,220,9,255,140,212,0,173,0,1,255,187,0,2,255,187,0,3,255,187,0,4,255,187,0,5,255,187,0,6,255,187,0,7,255,187,0,8,255,187,0,9,255,187,0,10,
+    255,187,0,11,255,187,0,12,255,187,0,13,255,187,0,15,255,236,0,16,255,236,0,17,255,236,0,18,255,236,0,19,255,236,0,20,255,236,0,36,255,236,0,37,255,236,0,38,255,236,0,39,255,236,0,40,
+    255,236,0,52,255,167,0,53,255,167,0,69,255,236,0,70,255,236,0,71,255,236,0,72,255,236,0,73,255,236,0,74,255,236,0,75,255,236,0,76,255,236,0,77,255,236,0,78,255,236,0,79,255,236,0,82,
+    255,236,212,15,2,192,115,0,4,0,116,0,4,0,117,0,4,0,22,27,255,255,77,119,0,4,0,124,255,236,0,125,255,167,0,126,255,167,0,127,255,167,0,128,255,167,0,129,255,167,0,130,255,167,0,131,
+    255,167,0,132,255,167,0,133,255,167,0,134,255,167,0,135,255,167,0,136,255,167,0,137,255,167,0,139,255,167,0,140,255,167,0,141,255,167,0,142,255,167,0,143,255,167,0,144,255,167,0,145,
+    255,167,0,146,255,167,0,147,255,167,0,148,255,167,0,149,255,167,0,150,255,167,0,151,255,167,0,152,255,167,0,153,255,167,0,154,255,167,0,155,255,167,0,156,255,167,0,157,255,167,0,158,
+    255,167,0,160,255,176,0,161,255,176,0,162,255,176,0,163,255,176,0,164,255,176,0,186,255,206,0,187,255,206,0,188,255,206,0,189,255,206,0,190,255,206,0,191,255,206,0,192,255,206,0,193,
+    255,167,0,194,255,167,0,195,255,167,0,196,255,167,0,197,255,167,0,198,255,167,0,199,255,167,0,200,255,167,0,201,255,167,0,202,255,167,0,203,255,167,0,204,255,206,0,206,255,167,0,207,
+    255,206,0,208,255,206,0,209,255,206,0,210,255,206,0,211,255,198,0,212,255,198,0,213,255,198,0,214,255,198,0,215,255,198,0,216,255,198,0,223,255,216,0,224,255,216,0,225,255,216,0,226,
+    255,216,0,227,255,216,0,228,255,216,0,229,255,216,0,230,255,216,0,231,255,216,0,232,255,216,0,233,255,227,0,234,255,227,0,235,255,227,0,236,255,227,0,237,255,227,0,238,255,227,0,239,
+    255,227,208,15,4,241,14,238,0,246,255,238,0,247,255,238,0,248,255,238,0,249,255,167,0,250,255,176,1,8,255,241,1,9,0,15,70,5,145,12,255,171,1,13,255,226,1,14,104,2,241,12,40,1,16,255,
+    236,1,93,255,134,1,215,255,236,1,216,255,236,1,217,255,236,1,218,255,236,1,219,40,7,240,37,167,1,223,255,167,1,224,255,167,1,225,255,167,1,226,255,167,1,227,255,167,1,228,255,167,1,
+    229,255,167,1,230,255,167,1,231,255,167,1,232,255,176,1,233,255,176,1,234,255,176,1,235,255,72,153,211,114,0,30,1,9,0,11,1,15,0,40,0,10,188,12,16,230,248,25,1,224,18,113,9,255,193,
+    1,10,255,197,110,5,2,214,3,0,214,5,48,247,0,2,154,10,35,1,12,162,22,49,196,0,114,4,1,240,4,242,0,239,255,232,1,9,255,208,1,10,255,207,1,15,255,206,0,9,168,11,1,96,0,179,11,255,236,
+    1,12,255,185,1,13,255,227,210,0,80,26,1,16,255,242,150,7,227,0,11,0,114,255,243,1,8,255,216,1,10,255,245,26,5,0,42,0,18,217,78,4,3,42,0,0,24,6,49,88,0,10,178,4,211,167,0,233,255,186,
+    1,8,255,206,1,9,255,180,50,0,0,86,7,0,46,1,16,222,122,0,1,46,1,0,86,3,17,1,204,12,240,10,1,1,12,255,216,0,35,0,1,255,231,0,2,255,231,0,3,255,231,0,4,255,231,0,5,220,9,192,255,231,0,
+    7,255,231,0,8,255,231,0,9,254,7,243,19,255,231,0,11,255,231,0,12,255,231,0,13,255,231,0,93,255,216,0,94,255,216,0,95,255,216,0,96,255,216,0,97,255,216,78,13,15,126,4,1,240,22,227,0,
+    115,255,187,0,116,255,187,0,117,255,187,0,118,255,187,0,119,255,187,0,120,255,240,0,121,255,240,0,122,255,240,0,123,255,240,62,5,247,31,0,131,0,15,255,243,0,16,255,243,0,17,255,243,
+    0,18,255,243,0,19,255,243,0,20,255,243,0,36,255,243,0,37,255,243,0,38,255,243,0,39,255,243,0,40,255,243,190,16,241,90,243,0,70,255,243,0,71,255,243,0,72,255,243,0,73,255,243,0,74,255,
+    243,0,75,255,243,0,76,255,243,0,77,255,243,0,78,255,243,0,79,255,243,0,82,255,243,0,93,255,192,0,94,255,192,0,95,255,192,0,96,255,192,0,97,255,192,0,98,255,243,0,99,255,243,0,100,255,
+    243,0,101,255,243,0,102,255,243,0,103,255,243,0,104,255,243,0,105,255,243,0,106,255,243,0,107,255,243,216,14,255,28,109,255,187,0,110,255,187,0,111,255,187,0,112,255,187,0,113,255,
+    187,0,115,255,157,0,116,255,157,0,117,255,157,0,118,255,157,0,119,255,157,0,124,255,243,38,17,36,243,134,243,0,140,255,243,0,141,255,243,0,142,255,243,0,143,255,243,0,144,255,243,0,
+    145,255,243,0,146,255,243,0,147,255,243,0,148,255,243,0,149,255,243,0,150,255,243,0,151,255,243,0,152,255,243,0,153,255,243,0,154,255,243,0,155,255,243,0,156,255,243,0,157,255,243,
+    0,158,255,243,0,193,255,243,0,194,255,243,0,195,255,243,0,196,255,243,0,197,255,243,0,198,255,243,0,199,255,243,0,200,255,243,0,201,255,243,0,202,255,243,0,203,255,243,0,206,255,243,
+    0,211,255,247,0,212,255,247,0,213,255,247,0,214,255,247,0,215,255,247,0,216,255,247,162,19,14,210,3,15,206,3,1,241,56,249,255,243,1,114,255,216,1,215,255,243,1,216,255,243,1,217,255,
+    243,1,218,255,243,1,219,255,243,1,222,255,243,1,223,255,243,1,224,255,243,1,225,255,243,1,226,255,243,1,227,255,243,1,228,255,243,1,229,255,243,1,230,255,243,1,231,255,243,0,1,0,114,
+    2,26,0,244,22,49,114,255,227,74,8,0,140,22,48,1,1,173,200,7,1,114,2,0,106,16,17,243,240,16,0,144,22,16,2,92,3,0,78,16,64,0,2,13,166,218,32,96,14,76,16,48,0,47,176,117,23,255,2,39,0,
+    35,36,4,4,0,8,24,0,80,255,197,255,217,255,96,41,85,0,0,0,255,226,34,0,5,10,0,4,18,0,4,8,0,36,255,224,10,0,12,8,0,160,255,204,255,232,255,231,0,0,255,245,26,0,34,255,211,104,0,48,255,
+    216,255,54,5,0,19,0,5,4,0,16,255,120,159,115,0,255,237,0,0,255,244,38,0,16,253,29,0,48,255,239,255,8,35,147,0,255,157,255,193,255,177,255,245,74,0,210,226,0,0,255,236,255,226,255,215,
+    255,202,255,226,34,0,0,46,0,10,4,0,6,188,0,10,24,0,11,14,0,0,14,35,11,19,0,2,15,0,0,148,0,66,255,251,255,241,14,0,6,6,0,64,255,242,255,239,14,0,96,255,157,255,198,255,177,210,0,1,14,
+    0,0,148,0,159,246,255,232,255,215,255,206,0,0,148,0,5,0,42,0,6,4,0,48,255,247,255,164,35,6,17,0,15,10,0,10,0,144,0,105,0,9,0,0,255,250,39,0,7,192,0,1,34,0,3,29,0,35,255,236,190,1,35,
+    9,0,214,41,48,0,0,255,138,160,4,32,0,19,248,9,0,5,7,0,3,114,1,18,244,242,0,32,255,183,222,0,5,29,0,0,12,2,121,246,255,237,255,232,255,222,20,0,144,237,255,224,255,247,0,0,255,252,162,
+    44,34,255,242,116,0,0,18,0,240,1,0,0,255,231,255,232,0,0,255,247,255,184,255,182,255,191,54,0,0,148,0,224,0,26,0,0,255,176,255,166,255,156,255,156,0,30,22,0,32,0,0,224,117,0,248,1,
+    0,14,0,16,255,108,9,0,9,0,3,4,0,34,255,252,9,0,32,255,244,94,0,2,12,0,2,6,0,8,138,0,15,236,1,17,0,56,1,64,255,246,255,249,62,0,8,228,2,0,16,0,0,116,2,80,255,232,255,236,255,170,36,
+    2,17,0,15,6,0,2,4,238,1,1,48,0,16,244,112,1,97,255,184,255,203,255,197,92,0,18,240,156,1,96,255,236,255,242,255,230,158,0,6,222,1,0,218,2,0,81,0,32,255,234,20,1,0,10,0,2,4,0,2,142,
+    0,0,48,2,192,255,234,255,203,255,227,255,217,0,0,255,225,134,0,34,255,173,34,0,16,0,132,37,0,126,1,3,92,1,3,22,0,15,7,0,0,14,210,1,15,37,0,0,15,19,0,2,2,208,2,8,27,0,34,255,246,234,
+    0,160,255,157,255,203,255,183,255,236,255,236,122,3,1,192,1,81,0,255,246,255,220,228,2,0,168,45,8,53,0,15,12,0,1,5,111,44,36,255,236,84,0,0,39,0,0,58,1,32,0,10,56,2,1,10,0,0,19,0,2,
+    220,2,50,246,255,221,122,0,32,0,20,234,119,2,80,2,0,31,0,96,255,231,255,216,255,231,106,120,80,255,184,255,206,255,236,40,240,2,0,255,176,0,7,0,30,0,30,255,167,255,146,255,166,255,
+    176,40,0,1,4,0,6,118,0,50,251,255,246,38,155,1,24,0,11,5,0,101,255,222,255,236,255,216,160,4,18,221,31,0,1,238,0,0,196,38,2,15,0,5,204,3,15,188,1,10,49,213,255,222,188,1,0,144,25,51,
+    0,255,177,59,0,3,7,0,0,186,2,0,162,2,1,218,0,5,156,0,3,29,0,49,0,0,4,68,48,3,15,0,96,255,206,255,247,255,225,13,0,0,46,0,1,254,2,16,20,26,1,1,18,0,18,247,90,3,0,12,0,15,4,0,15,48,255,
+    197,255,122,10,15,41,0,12,65,255,157,255,204,112,2,96,153,255,184,255,197,255,128,39,0,110,2,209,227,255,168,255,244,255,203,255,213,255,157,255,157,67,0,240,22,16,255,207,0,0,255,
+    183,0,0,255,146,0,20,0,10,255,237,255,252,255,247,255,176,255,217,255,176,255,187,255,159,0,0,255,193,255,232,160,0,96,255,187,255,182,255,217,46,0,0,56,0,208,255,247,255,208,255,252,
+    255,227,255,222,255,193,255,244,41,49,0,0,10,112,0,2,78,0,48,20,0,20,52,0,160,0,0,255,196,255,247,255,216,255,232,130,0,64,255,177,255,229,40,3,101,255,177,255,191,255,196,140,6,16,
+    242,64,0,224,255,217,255,217,255,177,255,177,0,16,0,10,0,30,102,0,1,50,0,48,167,0,20,130,4,128,0,26,0,26,255,176,255,226,54,0,23,255,38,46,0,138,0,5,4,0,4,118,4,3,17,0,71,255,217,255,
+    237,2,3,18,17,23,0,48,255,226,255,196,18,1,166,2,0,18,0,0,0,3,0,8,0,11,4,0,7,126,5,99,0,0,255,207,255,227,206,0,7,64,2,4,50,0,4,126,5,1,56,3,16,20,194,6,4,26,0,1,8,0,0,226,49,0,119,
+    123,176,15,255,238,255,245,255,234,255,243,255,212,148,123,35,255,215,80,2,48,30,0,26,131,123,1,122,3,3,140,7,35,255,243,98,4,14,84,2,120,0,255,240,255,236,0,9,182,0,0,234,2,4,74,2,
+    1,114,0,0,232,1,3,168,0,35,255,221,254,5,1,16,0,0,2,6,1,16,0,16,10,206,0,65,255,252,255,252,20,3,48,242,255,254,148,2,3,132,0,0,152,5,16,10,72,0,2,194,3,1,224,2,7,96,6,15,24,8,10,18,
+    209,24,8,0,62,0,9,24,8,3,216,0,2,24,0,0,6,0,0,114,4,32,255,242,6,0,0,14,0,0,4,0,160,255,236,255,252,255,239,255,222,255,227,140,0,143,255,183,255,207,255,187,255,236,228,3,7,12,242,
+    0,0,68,0,15,4,0,18,9,218,1,4,50,0,65,255,226,255,211,234,0,17,246,200,6,0,100,7,48,222,0,0,172,2,64,0,0,255,192,248,3,130,255,236,255,146,255,183,255,167,208,4,2,56,0,0,14,0,32,255,
+    167,6,0,2,16,0,35,0,11,8,0,8,7,0,15,112,0,1,0,212,2,2,24,2,49,0,0,54,45,0,0,48,40,1,9,0,6,5,0,0,90,5,0,230,0,39,255,236,2,5,2,220,1,2,160,1,2,202,2,0,76,0,3,53,0,33,255,167,120,40,
+    3,14,0,2,7,0,0,60,0,0,218,0,1,70,3,2,19,0,8,6,0,2,74,0,16,243,248,6,8,23,0,15,12,0,5,33,255,197,110,2,73,0,255,197,255,216,49,0,176,3,0,52,0,65,255,197,255,197,220,4,5,104,49,7,30,
+    1,0,33,0,1,4,0,0,20,0,35,255,202,14,5,27,219,74,0,17,222,64,0,48,0,255,206,50,5,65,0,0,0,21,51,0,0,248,0,0,124,1,4,13,0,3,8,0,2,222,0,32,255,216,150,0,32,255,246,120,8,0,236,0,2,4,
+    0,65,255,252,255,246,48,4,112,246,255,236,255,163,255,187,118,0,3,55,0,15,7,0,4,5,206,7,1,74,48,7,37,0,0,80,46,3,15,0,48,255,217,255,148,31,0,144,0,19,197,19,0,7,7,0,38,255,213,13,
+    0,4,24,4,6,18,0,2,10,0,32,255,242,56,6,1,46,9,56,216,255,196,4,3,2,32,0,7,6,0,0,78,4,1,40,11,0,112,9,7,24,0,0,126,0,0,110,4,0,8,0,49,243,255,238,148,0,1,226,3,10,36,0,10,14,0,0,254,
+    3,1,80,2,20,240,232,0,1,32,0,5,160,2,48,255,240,255,206,23,0,200,163,19,7,160,4,112,197,0,31,0,40,0,9,24,6,0,44,0,0,88,1,0,8,0,1,4,0,49,18,0,41,8,0,0,5,0,16,51,5,0,4,210,8,1,12,0,4,
+    5,0,2,94,0,0,32,0,112,86,0,81,0,56,0,46,10,55,4,29,0,15,8,0,19,68,255,187,255,232,44,6,15,50,0,7,32,255,222,104,9,3,230,0,20,0,56,4,1,232,4,114,206,255,212,255,222,255,250,208,4,2,
+    66,0,0,92,6,96,0,0,0,20,255,252,212,0,2,132,1,0,68,2,2,30,0,4,6,0,2,24,0,4,14,0,15,8,0,7,0,248,6,4,30,0,0,80,0,3,12,0,17,2,162,55,17,13,254,5,255,18,34,0,13,0,36,0,40,0,33,0,52,0,79,
+    0,38,0,83,0,107,0,66,0,109,0,113,0,91,0,115,0,144,0,96,34,44,2,241,6,205,0,160,0,207,0,232,0,180,0,234,0,238,0,206,0,240,0,253,0,211,52,44,17,225,52,44,17,228,4,44,17,231,4,44,208,
+    232,1,87,1,87,0,235,1,90,1,92,0,236,4,44,32,0,239,4,44,32,0,240,4,44,128,0,241,1,101,1,113,0,242,248,43,33,0,255,248,43,17,1,248,43,49,5,0,2,182,57,241,12,11,0,8,0,12,0,13,0,5,0,15,
+    0,20,0,17,0,21,0,24,0,29,0,25,0,34,0,5,184,0,145,24,0,52,0,53,0,46,0,54,172,170,241,32,56,0,61,0,16,0,62,0,68,0,13,0,69,0,78,0,1,0,79,0,79,0,5,0,83,0,86,0,28,0,87,0,92,0,15,0,93,0,
+    97,0,23,0,98,0,107,0,9,232,0,17,22,73,67,176,21,0,120,0,123,0,27,0,124,0,124,46,55,241,61,0,135,0,7,0,136,0,137,0,4,0,138,0,138,0,2,0,139,0,144,0,14,0,146,0,146,0,2,0,147,0,147,0,43,
+    0,149,0,158,0,4,0,159,0,159,0,42,0,160,0,164,0,20,0,165,0,166,0,10,0,167,0,175,0,3,0,176,0,177,0,31,0,178,0,179,0,39,88,45,17,43,190,160,241,22,10,0,193,0,202,0,2,0,203,0,203,0,4,0,
+    204,0,205,0,2,0,207,0,210,0,26,0,211,0,217,0,11,0,218,0,222,0,6,84,1,17,18,209,67,240,22,12,0,245,0,248,0,25,0,250,0,250,0,19,0,251,0,251,0,6,0,252,0,252,0,42,0,253,0,253,0,3,0,255,
+    0,255,0,6,57,59,208,0,12,1,1,1,1,0,3,1,3,1,3,0,254,56,145,4,0,6,1,5,1,5,0,12,138,1,209,34,1,81,1,81,0,44,1,82,1,83,0,32,144,1,209,32,1,90,1,91,0,34,1,92,1,92,0,44,150,1,17,33,150,1,
+    17,33,150,1,242,30,33,1,101,1,103,0,30,1,104,1,104,0,41,1,105,1,105,0,40,1,106,1,106,0,41,1,107,1,107,0,40,1,108,1,108,0,38,1,109,1,109,0,37,1,110,158,24,96,1,111,0,37,1,112,162,24,
+    97,1,113,1,113,0,38,210,1,16,35,210,1,16,0,210,1,241,4,220,0,3,1,221,1,221,0,31,1,232,1,235,0,19,1,236,1,239,116,174,113,68,0,1,0,13,0,6,222,1,17,2,216,1,17,11,216,1,17,2,216,1,209,
+    36,0,69,0,79,0,2,0,82,0,82,0,2,192,1,17,14,192,1,17,21,192,1,17,10,192,1,17,20,192,1,17,19,192,1,17,23,192,1,113,2,0,125,0,137,0,5,186,1,113,4,0,139,0,158,0,1,168,1,17,12,168,1,17,
+    18,168,1,17,4,168,1,17,9,168,1,113,25,0,178,0,185,0,4,162,1,83,7,0,193,0,203,188,59,160,7,0,205,0,205,0,4,0,206,0,56,33,0,168,1,209,7,0,211,0,216,0,13,0,217,0,217,0,4,174,1,113,3,0,
+    223,0,232,0,8,180,1,17,16,180,1,17,15,180,1,64,22,0,249,0,16,52,0,186,1,17,17,186,1,113,3,0,252,1,2,0,12,32,3,17,3,150,1,17,28,150,1,17,35,150,1,17,26,150,1,17,26,150,1,17,28,150,1,
+    241,4,35,1,96,1,96,0,27,1,98,1,98,0,27,1,100,1,100,0,27,150,1,17,24,150,1,17,34,150,1,17,33,150,1,17,34,150,1,17,33,150,1,17,32,150,1,17,31,150,1,113,30,1,111,1,111,0,31,150,1,17,30,
+    150,1,17,32,150,1,209,29,1,215,1,219,0,2,1,220,1,220,0,9,150,1,113,25,1,222,1,231,0,1,156,1,17,17,156,1,17,3,36,12,91,10,1,86,2,148,104,60,0,220,54,4,104,60,17,228,104,60,17,228,104,
+    60,17,228,104,60,17,96,104,60,17,140,104,60,17,184,104,60,16,228,104,60,33,1,14,104,60,16,19,86,51,0,52,60,129,0,4,0,5,0,6,0,11,220,3,0,38,60,176,16,0,17,0,18,0,19,0,20,0,21,176,5,
+    5,44,0,4,42,0,31,7,44,0,24,31,8,44,0,24,31,9,44,0,10,1,158,53,5,132,0,15,174,0,23,0,28,22,0,182,4,14,218,0,112,23,97,97,108,116,0,140,76,153,224,0,148,99,99,109,112,0,154,100,108,105,
+    103,0,160,169,157,241,5,0,166,102,114,97,99,0,172,108,105,103,97,0,200,108,111,99,108,0,206,6,0,17,212,6,0,17,218,6,0,16,224,121,157,240,0,0,230,111,114,100,110,0,236,112,110,117,109,
+    0,242,115,84,0,112,248,115,105,110,102,0,254,54,161,240,22,1,4,115,115,48,50,1,14,115,115,48,51,1,24,115,115,48,52,1,34,115,117,98,115,1,44,115,117,112,115,1,50,116,110,117,109,1,48,
+    62,0,146,58,0,12,14,51,1,0,47,154,1,19,0,36,50,0,190,61,0,160,63,241,8,13,0,15,0,17,0,19,0,21,0,23,0,25,0,27,0,29,0,31,0,33,0,35,46,0,0,104,7,16,1,254,177,32,0,1,82,17,1,208,165,0,
+    64,0,17,8,30,0,0,116,10,49,1,0,37,12,0,2,204,53,17,42,12,0,112,48,0,6,0,1,0,43,41,0,1,10,0,16,44,237,60,1,10,0,16,45,211,53,1,10,0,64,46,0,0,1,220,8,16,1,24,8,33,0,1,20,13,243,88,1,
+    0,39,0,49,0,100,1,50,1,228,2,38,2,38,2,98,2,64,2,64,2,98,9,22,2,118,6,88,6,144,2,172,4,214,4,234,6,88,5,4,6,88,5,32,6,88,5,62,6,88,5,94,6,88,5,128,6,88,5,164,6,88,5,202,6,88,5,242,
+    6,88,6,28,6,88,6,102,6,144,6,158,6,192,6,216,6,230,7,36,7,112,8,90,8,160,8,194,8,228,8,248,9,22,16,1,0,172,53,240,81,100,0,47,0,124,1,215,1,216,1,217,1,218,1,219,0,92,0,97,0,249,1,
+    222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,0,250,1,232,1,233,1,234,1,235,0,171,0,216,0,251,1,236,1,237,1,239,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,212,1,
+    213,1,183,1,240,1,246,1,243,1,244,63,242,81,47,0,36,0,37,0,38,0,39,0,40,0,82,0,90,0,96,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,160,0,161,0,162,0,163,0,164,
+    0,167,0,214,0,218,0,219,0,220,0,222,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,97,1,98,1,171,1,190,1,198,1,241,1,242,0,70,1,0,180,63,177,154,0,11,0,28,0,34,0,46,0,58,109,136,
+    241,130,94,0,106,0,118,0,130,0,142,0,2,0,222,1,238,0,5,1,18,1,28,1,38,1,48,1,58,0,5,1,19,1,29,1,39,1,49,1,59,0,5,1,20,1,30,1,40,1,50,1,60,0,5,1,21,1,31,1,41,1,51,1,61,0,5,1,22,1,32,
+    1,42,1,52,1,62,0,5,1,23,1,33,1,43,1,53,1,63,0,5,1,24,1,34,1,44,1,54,1,64,0,5,1,25,1,35,1,45,1,55,1,65,0,5,1,26,1,36,1,46,1,56,1,66,0,5,1,27,1,37,1,47,1,57,1,67,0,2,0,2,0,221,0,221,
+    0,0,104,52,2,74,2,80,2,0,10,0,28,10,138,129,0,1,0,74,0,1,0,46,142,4,19,3,18,0,113,56,0,2,0,20,0,28,20,0,0,204,16,96,2,1,197,1,198,0,170,168,49,184,1,195,100,2,0,93,2,0,194,1,17,10,
+    230,4,81,221,0,1,0,2,70,171,6,220,1,49,14,0,4,208,1,113,216,0,222,0,1,0,4,122,1,32,214,0,42,0,2,60,0,0,136,0,0,92,0,0,228,65,6,54,0,113,30,0,12,1,58,1,59,72,171,241,4,62,1,63,1,64,
+    1,65,1,66,1,67,1,212,1,213,0,2,0,2,42,53,115,0,1,97,1,98,0,10,18,3,240,2,8,0,2,2,48,0,24,0,16,0,24,0,2,0,40,0,42,98,49,1,90,65,4,48,0,81,1,1,93,1,93,93,139,240,33,23,0,48,0,78,0,108,
+    0,136,0,164,0,190,0,216,0,240,1,8,1,30,1,52,1,72,1,92,1,110,1,128,1,144,1,160,1,174,1,188,1,200,1,212,1,222,1,232,0,68,67,0,253,7,10,4,0,0,83,138,2,233,9,0,38,181,10,28,0,2,14,0,0,
+    246,3,17,10,132,0,2,16,0,4,6,0,8,58,0,15,32,0,3,0,100,14,4,46,0,4,8,0,8,54,0,29,9,86,0,0,108,0,0,126,2,4,46,0,0,8,0,8,50,0,14,28,0,0,114,139,0,38,0,4,4,0,8,46,0,0,150,58,4,24,0,0,212,
+    1,0,202,21,8,16,0,0,170,1,0,252,0,0,190,1,8,24,0,0,11,140,4,16,0,8,80,0,21,5,176,0,0,168,0,2,240,1,0,88,0,6,72,0,6,20,0,17,0,70,176,10,30,0,0,38,7,0,18,0,0,34,67,0,8,0,6,56,0,0,102,
+    0,0,84,0,10,22,0,0,14,0,0,96,2,4,140,0,0,48,0,17,14,200,2,2,88,67,48,6,255,231,146,0,37,1,93,62,2,1,192,3,97,4,50,0,1,1,96,40,0,27,16,26,0,96,24,0,2,1,60,1,208,65,58,0,0,18,28,0,146,
+    3,252,0,3,1,32,1,32,1,30,183,27,20,30,0,81,222,0,4,1,2,2,0,0,114,69,59,0,0,22,32,0,83,190,0,5,0,226,2,0,0,116,48,59,0,0,24,34,0,85,156,0,6,0,192,2,0,17,202,160,0,27,26,36,0,87,120,
+    0,7,0,156,2,0,0,30,175,0,222,141,17,6,168,3,18,8,210,3,105,3,82,0,8,0,118,2,0,17,128,78,0,27,30,78,0,91,42,0,9,0,78,2,0,17,88,42,0,27,32,42,0,0,72,19,29,36,2,0,2,72,4,17,34,44,4,18,
+    48,2,63,48,0,1,1,132,10,0,150,1,119,8,0,1,2,196,0,40,74,0,96,1,0,18,0,1,2,252,21,0,170,1,17,36,228,3,81,38,1,47,0,0,234,56,0,36,3,4,56,0,48,140,0,30,250,26,3,200,1,19,20,8,0,128,4,
+    1,180,0,3,0,193,1,116,70,49,1,0,63,170,0,2,34,0,0,162,56,0,178,4,49,18,1,27,10,1,4,72,0,55,68,0,10,72,0,16,46,50,60,1,78,0,32,4,1,100,2,0,228,43,49,8,0,14,200,38,145,2,0,167,1,4,0,
+    2,0,218,44,13,0,70,70,87,2,0,159,0,218,62,0,17,62,134,0,209,6,0,14,0,22,0,30,0,36,0,42,0,48,54,12,240,3,159,0,167,0,254,0,3,0,159,0,180,0,252,0,2,0,159,1,152,2,32,167,1,138,5,48,180,
+    0,255,84,0,0,134,2,34,0,159,158,1,1,124,68,241,16,180,0,29,0,64,0,68,0,72,0,76,0,80,0,84,0,88,0,92,0,96,0,100,0,104,0,108,0,112,0,116,186,69,241,0,128,0,132,0,136,0,140,0,144,0,148,
+    0,152,0,156,110,11,81,168,0,172,0,176,84,71,96,1,1,215,0,1,1,238,35,145,217,0,1,1,218,0,1,1,219,244,70,160,1,1,222,0,1,1,223,0,1,1,22,63,64,225,0,1,1,86,36,240,0,227,0,1,1,228,0,1,
+    1,229,0,1,1,230,0,1,158,10,32,0,250,162,10,241,29,0,1,1,233,0,1,1,234,0,1,1,235,0,1,0,251,0,1,1,236,0,1,1,237,0,1,1,238,0,1,1,239,0,1,1,183,0,1,1,240,0,2,0,7,74,12,17,0,62,12,113,5,
+    0,125,0,135,0,6,148,0,17,17,186,11,179,22,1,171,1,171,0,27,1,190,1,190,76,6,0,154,1,0,164,5,22,17,246,7,15,240,7,3,33,1,183,196,10,0,56,15,17,0,88,0,17,5,76,0,21,16,224,1,87,2,0,16,
+    0,5,22,8,0,14,4,0,36,14,0,230,1,0,4,0,0,156,6,0,34,0,2,42,8,48,238,1,239,146,2,1,150,0,0,30,0,0,4,0,0,24,5,49,6,1,137,136,1,0,192,69,2,20,0,85,2,0,12,0,3,60,8,19,3,228,7,0,156,2,0,
+    188,0,0,246,4,16,20,74,0,2,136,6,175,0,0,1,244,0,50,2,150,0,12,4,0,21,64,3,149,0,7,4,0,143,2,127,0,84,2,231,0,41,4,0,2,117,210,0,84,2,210,0,16,8,0,63,71,0,84,4,0,18,125,43,0,84,2,253,
+    0,41,4,0,2,72,0,82,3,1,11,0,84,4,0,192,255,254,1,11,255,251,1,11,0,74,1,11,2,41,225,0,9,1,11,0,51,1,11,255,234,2,17,0,20,4,0,49,131,0,84,4,0,31,10,4,0,2,127,16,3,92,0,84,2,222,4,0,
+    3,79,3,9,0,41,4,0,17,128,4,120,0,41,2,113,0,84,4,0,0,48,0,73,2,142,0,84,4,0,63,65,0,32,4,0,2,61,50,0,14,4,0,63,199,0,79,4,0,18,124,157,0,10,3,237,0,15,4,0,141,2,133,0,16,2,94,0,10,
+    4,0,57,71,0,36,4,0,127,254,0,41,2,22,0,44,4,0,21,34,3,114,4,0,143,2,88,0,68,2,22,0,36,4,0,2,83,88,0,36,2,75,8,0,0,4,0,31,30,4,0,19,141,1,61,0,16,2,86,0,37,4,0,241,26,63,0,68,2,63,0,
+    6,0,230,0,52,0,230,0,68,0,230,255,236,0,230,255,233,0,230,0,56,0,230,255,248,0,230,255,247,0,230,0,30,0,230,218,36,144,200,0,230,255,200,1,252,0,70,4,0,41,0,234,4,0,49,59,1,99,16,0,
+    49,12,3,94,84,0,0,88,0,14,4,0,63,69,0,36,4,0,17,33,3,192,228,0,17,68,12,1,17,88,108,41,19,68,4,0,159,58,1,112,0,57,1,192,0,28,4,0,1,140,2,66,0,68,1,62,0,16,4,0,79,2,55,0,62,4,0,17,
+    140,1,253,0,8,3,0,0,13,4,0,141,1,226,0,10,1,242,0,8,4,0,56,201,0,38,4,0,241,81,2,90,0,36,2,28,0,27,1,81,0,16,2,115,0,16,3,101,0,16,3,97,0,16,2,105,0,16,3,27,0,16,2,47,0,16,2,42,0,16,
+    2,60,0,16,2,118,0,16,3,39,0,16,2,136,0,69,2,109,0,17,2,181,0,49,1,108,0,35,2,63,0,43,2,56,0,30,2,124,0,34,2,79,0,48,2,99,0,41,2,8,0,8,2,113,0,47,12,0,243,12,148,0,43,2,148,0,104,2,
+    148,0,87,2,148,0,72,2,148,0,34,2,148,0,77,2,148,0,66,8,0,16,64,12,0,240,3,1,165,0,28,0,235,0,21,1,95,0,26,1,95,0,21,1,125,62,44,225,0,20,1,123,0,26,1,74,0,16,1,120,0,26,12,0,241,20,
+    100,0,30,0,209,0,18,1,41,0,22,1,30,0,20,1,58,0,14,1,46,0,25,1,63,0,28,1,12,0,12,1,54,0,27,12,0,15,40,0,21,27,164,120,0,31,119,120,0,3,240,53,0,138,255,52,2,173,0,18,2,140,0,18,2,177,
+    0,20,2,186,0,18,2,223,0,20,2,238,0,25,2,164,0,12,1,155,0,27,3,136,0,27,1,120,0,0,1,46,0,54,1,147,0,54,1,40,0,76,1,20,0,66,2,225,0,66,1,38,0,75,4,0,65,2,184,0,44,20,0,241,0,21,0,33,
+    2,21,0,33,1,116,0,51,0,208,0,51,44,0,178,120,0,0,2,18,0,60,1,62,0,45,26,13,240,15,0,59,1,23,0,5,1,23,0,48,1,23,0,0,4,149,0,67,3,183,0,67,1,175,0,63,2,142,0,40,4,0,35,1,154,4,0,53,185,
+    0,62,4,0,23,6,4,0,177,17,0,0,2,49,0,46,2,156,0,54,116,4,243,4,126,0,23,2,77,0,45,2,116,0,30,2,111,0,20,2,148,0,80,4,0,19,99,8,0,4,16,0,15,8,0,9,241,14,69,3,53,0,30,3,110,0,51,1,149,
+    0,30,2,169,0,44,2,176,0,84,2,40,0,33,2,200,0,0,188,2,243,18,121,0,54,3,164,0,42,5,53,0,42,3,16,0,60,3,76,0,60,3,173,0,60,3,74,0,60,3,10,0,60,3,77,16,0,210,64,0,60,4,65,0,60,2,99,0,
+    60,3,130,4,0,99,2,109,0,60,3,62,4,0,83,198,0,60,3,199,24,0,242,10,212,0,34,3,156,0,44,2,195,0,46,2,75,0,28,1,218,0,36,3,51,0,40,1,236,4,0,193,2,130,0,26,1,30,0,19,1,67,0,124,4,0,240,
+    33,59,0,23,1,60,0,23,3,11,0,60,4,236,0,84,1,244,0,71,0,181,0,46,2,94,0,40,1,137,0,59,0,211,0,46,0,245,0,44,0,246,0,43,1,128,0,41,1,24,0,0,4,0,241,16,124,0,51,1,56,0,39,1,143,0,45,1,
+    113,0,60,0,197,0,42,0,197,0,40,0,243,0,36,2,12,0,40,48,0,0,36,0,18,94,20,0,1,56,0,7,80,0,1,76,0,0,56,0,52,211,0,42,72,0,193,0,217,0,46,0,217,0,5,6,203,0,88,108,5,7,4,0,0,36,6,3,208,
+    4,17,200,148,3,0,152,3,15,4,0,13,48,28,0,27,188,3,4,4,0,64,1,69,0,16,200,3,4,4,0,240,2,2,69,1,54,2,20,0,51,0,249,0,20,1,102,0,20,2,20,4,176,121,0,20,2,12,255,196,0,211,0,43,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,238,79,84,84,79,0,12,0,128,0,3,0,64,67,70,70,32,51,136,134,199,0,0,12,
+    244,0,0,99,84,71,68,69,70,29,125,29,163,0,0,112,72,0,0,1,54,71,80,79,83,38,143,126,34,0,0,113,128,0,0,60,116,71,83,85,66,237,81,41,229,0,0,173,244,0,0,11,194,79,83,47,50,88,151,241,
+    108,0,0,1,48,0,0,0,96,99,109,97,112,35,126,40,112,0,0,7,176,0,0,5,36,104,101,97,100,30,208,108,227,0,0,0,204,0,0,0,54,104,104,101,97,9,225,7,9,0,0,1,4,0,0,0,36,104,109,116,120,29,193,
+    85,155,0,0,185,184,0,0,7,224,109,97,120,112,1,248,80,0,0,0,1,40,0,0,0,6,110,97,109,101,54,183,203,225,0,0,1,144,0,0,6,30,112,111,115,116,255,64,0,80,0,0,12,212,0,0,0,32,0,1,0,0,0,2,
+    0,0,82,47,60,24,95,15,60,245,0,3,3,232,0,0,0,0,221,23,225,123,0,0,0,0,221,24,71,99,255,53,255,32,6,83,4,2,0,0,0,6,0,6,0,0,25,0,241,2,1,0,0,3,242,255,16,0,100,6,203,255,53,255,53,6,
+    83,74,0,0,26,0,3,4,0,81,1,248,0,0,80,6,0,242,3,0,4,2,23,1,144,0,5,0,0,2,138,2,88,0,0,0,75,8,0,99,1,94,0,50,1,44,47,0,1,7,0,64,128,0,0,71,187,0,1,13,0,210,0,0,0,73,84,70,79,0,192,0,
+    32,251,4,108,0,128,3,242,0,240,32,0,0,147,32,0,48,1,228,2,18,1,146,32,0,12,0,0,0,22,1,14,128,0,68,1,0,0,31,66,0,99,1,1,0,11,0,31,24,0,83,2,0,11,0,42,12,0,243,2,3,0,11,0,53,0,3,0,1,
+    4,9,0,0,0,122,0,64,12,0,83,1,0,14,0,186,12,0,83,2,0,14,0,200,12,0,83,3,0,52,0,214,12,0,83,4,0,30,1,10,12,0,83,5,0,26,1,40,12,0,83,6,0,30,1,66,12,0,83,7,0,100,1,96,12,0,83,8,0,38,1,
+    196,12,0,83,9,0,24,1,234,12,0,83,11,0,58,2,2,12,0,83,12,0,66,2,60,12,0,83,13,1,220,2,126,12,0,82,14,0,54,4,90,12,0,99,1,0,0,62,4,144,12,0,83,1,0,22,4,206,12,0,83,2,0,22,4,228,12,0,
+    246,21,3,0,22,4,250,65,108,116,101,114,110,97,116,101,32,71,44,32,97,44,32,114,101,103,105,115,116,101,114,101,100,32,115,105,103,110,31,0,22,103,11,0,22,116,11,0,241,16,81,0,67,0,
+    111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,55,0,45,10,0,241,20,50,0,49,0,32,0,73,0,110,0,100,0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,
+    117,28,0,247,0,114,0,121,0,46,0,32,0,65,0,108,0,108,0,32,82,0,17,115,14,0,241,34,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,83,0,97,0,116,0,111,0,115,0,104,0,105,0,82,0,101,0,103,
+    0,117,0,108,0,97,0,114,0,50,0,46,0,48,2,0,187,59,0,73,0,84,0,70,0,79,0,59,50,0,27,45,52,0,10,80,0,27,32,30,0,17,86,124,0,81,115,0,105,0,111,194,0,6,98,0,10,56,0,15,86,0,13,17,105,206,
+    0,241,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,180,0,113,107,0,32,0,111,0,102,26,0,17,104,28,1,15,52,1,21,15,40,0,19,113,68,0,101,0,110,0,105,98,1,81,110,0,103,0,103,118,0,17,97,
+    180,1,209,116,0,112,0,115,0,58,0,47,0,47,0,105,142,1,2,170,1,19,116,168,1,27,102,166,1,93,99,0,111,0,109,58,0,17,119,2,0,31,46,66,0,24,17,84,188,1,0,18,1,0,8,2,17,110,62,2,17,83,6,
+    1,49,116,0,119,160,0,0,36,2,2,52,1,177,112,0,114,0,111,0,116,0,101,0,99,6,0,51,100,0,32,58,2,0,22,2,49,32,0,100,148,0,0,38,2,113,116,0,105,0,99,0,32,108,2,0,38,0,0,210,0,0,56,0,49,
+    114,0,110,52,2,2,196,1,17,97,102,2,15,134,1,1,0,164,2,0,56,0,0,230,0,12,220,2,0,96,2,17,119,168,2,17,89,20,1,0,102,0,81,103,0,114,0,101,178,1,0,144,2,49,32,0,105,214,1,0,206,0,89,105,
+    0,102,0,121,210,1,0,140,2,17,32,80,1,0,32,0,0,250,0,17,98,34,0,0,154,0,17,109,68,0,6,126,0,0,86,0,0,52,3,0,84,3,6,20,2,0,66,0,17,39,70,2,83,111,0,119,0,110,152,2,0,4,3,29,112,66,2,
+    14,222,0,0,114,0,6,98,0,12,188,3,0,30,0,0,46,1,0,214,0,17,110,152,0,0,160,2,0,246,2,17,103,246,2,53,111,0,114,138,1,49,100,0,117,138,1,2,78,1,49,32,0,99,6,1,2,176,0,61,115,0,46,30,
+    2,6,244,0,19,104,218,1,17,46,98,1,49,109,0,47,208,1,81,114,0,109,0,115,254,3,8,172,1,0,0,2,49,71,0,44,206,1,0,6,0,0,20,1,17,103,18,2,2,38,0,0,12,4,21,32,162,0,0,60,4,2,24,0,0,80,1,
+    0,10,0,63,32,0,103,84,0,2,31,116,22,0,2,16,81,44,6,0,226,6,96,0,3,0,0,0,20,42,5,1,8,0,243,216,4,5,16,0,0,0,138,0,128,0,6,0,10,0,47,0,57,0,126,0,169,0,172,0,185,1,35,1,43,1,49,1,55,
+    1,72,1,77,1,107,1,126,1,146,1,255,2,27,2,55,2,199,2,221,3,4,3,8,3,12,3,18,3,39,3,53,3,56,3,169,3,192,30,133,30,243,32,20,32,26,32,30,32,34,32,38,32,48,32,50,32,58,32,66,32,68,32,112,
+    32,121,32,137,32,172,33,23,33,34,33,46,33,94,33,153,34,2,34,6,34,15,34,18,34,26,34,30,34,43,34,72,34,96,34,101,37,161,37,179,37,203,37,207,38,46,39,19,248,255,251,4,255,255,0,0,0,32,
+    0,48,0,58,0,161,0,171,0,174,0,187,1,38,1,46,1,52,1,57,1,74,1,80,1,110,1,146,1,250,2,24,2,55,2,198,2,216,3,0,3,6,3,10,3,18,3,38,3,53,3,55,3,169,3,192,30,128,30,242,32,19,32,24,32,28,
+    32,32,32,38,32,48,32,50,32,57,140,0,113,116,32,128,32,172,33,22,140,0,183,91,33,144,34,2,34,5,34,15,34,17,140,0,117,100,37,160,37,178,37,202,140,0,17,0,140,0,17,216,62,1,15,5,0,0,32,
+    255,229,21,0,32,255,166,6,0,2,4,0,176,254,177,254,158,254,188,0,0,253,93,253,196,7,80,0,0,0,225,87,26,0,241,49,225,45,225,98,225,132,225,49,225,11,225,0,224,202,224,202,224,156,224,
+    202,0,0,224,139,224,133,223,237,0,0,223,142,0,0,223,125,0,0,223,116,223,107,223,95,223,61,223,31,0,0,220,0,219,240,0,0,219,206,219,118,218,146,8,215,206,7,240,30,138,0,0,0,166,1,46,
+    1,62,1,64,1,86,2,38,2,48,2,54,2,60,2,90,2,96,2,150,0,0,2,180,2,190,0,0,2,194,2,196,2,206,2,214,2,218,118,0,49,0,0,2,188,0,194,2,214,2,224,2,226,0,0,2,226,2,230,24,0,10,6,0,34,2,214,
+    16,0,32,2,210,36,0,2,4,0,2,18,0,34,0,0,74,0,2,72,0,0,20,0,0,36,0,241,31,1,114,1,84,1,90,1,86,1,117,1,145,1,167,1,91,1,99,1,100,1,76,1,122,1,82,1,103,1,87,1,93,1,81,1,92,1,129,1,126,
+    1,128,1,88,1,166,82,8,241,255,255,154,15,0,21,0,25,0,35,0,36,0,41,0,43,0,52,0,54,0,56,0,62,0,63,0,69,0,80,0,82,0,83,0,87,0,93,0,98,0,108,0,109,0,114,0,115,0,120,1,97,1,78,1,98,1,181,
+    1,94,1,206,0,125,0,138,0,139,0,145,0,149,0,159,0,160,0,165,0,167,0,176,0,178,0,180,0,186,0,187,0,193,0,204,0,206,0,207,0,211,0,218,0,223,0,233,0,234,0,239,0,240,0,245,1,95,1,175,1,
+    96,1,134,1,85,1,115,1,120,1,116,1,121,1,176,1,169,1,204,1,170,1,104,1,135,1,171,1,208,1,174,1,132,1,60,1,61,1,199,1,143,1,168,1,79,1,202,1,59,1,105,1,70,1,69,1,71,1,89,0,6,0,2,0,4,
+    0,11,0,5,0,9,0,12,0,18,0,32,0,26,0,29,0,30,0,48,0,44,0,45,0,46,0,22,0,68,0,73,0,70,0,71,0,78,0,72,1,124,0,76,0,102,0,99,0,100,0,101,0,116,0,81,0,217,0,130,0,126,0,128,0,135,0,129,0,
+    133,0,136,0,142,0,156,0,150,0,153,0,154,0,172,0,168,0,169,0,170,0,146,0,192,0,197,0,194,0,195,0,202,0,196,1,125,0,200,0,227,0,224,0,225,0,226,0,241,0,205,0,243,0,7,0,131,0,3,0,127,
+    0,8,0,132,0,16,0,140,0,19,0,143,0,20,0,144,0,17,0,141,0,23,0,147,0,24,0,148,0,33,0,157,0,27,0,151,0,31,0,155,0,34,0,158,0,28,0,152,0,38,0,162,0,37,0,161,0,40,0,164,0,39,0,163,0,42,
+    0,166,0,51,0,175,0,49,0,173,0,50,0,174,0,47,1,220,0,53,0,177,0,55,0,179,0,57,0,181,0,59,0,183,0,58,0,182,0,60,0,184,0,61,0,185,0,64,0,188,0,66,0,190,0,65,0,189,0,67,0,191,0,75,0,199,
+    0,74,0,198,0,79,0,203,0,84,0,208,0,86,0,210,0,85,0,209,0,88,0,212,0,91,0,215,0,90,0,214,0,89,0,213,0,96,0,221,0,95,0,220,0,94,0,219,0,107,0,232,0,104,0,229,0,106,0,231,0,103,0,228,
+    0,105,0,230,0,111,0,236,0,117,0,242,0,118,0,121,0,246,0,123,0,248,0,122,0,247,0,10,0,134,0,13,0,137,0,77,0,201,0,92,0,216,0,97,0,222,1,203,1,201,1,200,1,205,1,210,1,209,1,211,1,207,
+    1,186,1,187,1,189,1,193,1,194,1,191,1,185,1,184,1,192,1,188,1,190,1,242,1,198,0,113,0,238,0,110,0,235,0,112,0,237,0,119,0,244,1,102,1,101,1,109,1,110,1,108,1,177,1,178,1,80,1,180,1,
+    172,1,153,1,147,1,149,1,151,1,155,1,156,1,154,1,148,1,150,1,152,1,136,1,139,1,141,1,123,1,131,1,130,1,159,1,158,0,252,1,1,1,2,0,253,0,254,0,3,227,2,81,0,255,61,0,80,9,0,11,5,0,240,
+    9,1,0,4,2,0,1,1,1,16,83,97,116,111,115,104,105,45,82,101,103,117,108,97,114,20,0,240,43,64,249,45,0,249,46,1,249,47,12,0,249,48,2,249,49,3,249,50,4,251,87,12,3,219,12,4,251,95,251,
+    116,29,0,0,6,83,250,150,5,29,0,0,28,223,15,29,0,0,31,218,16,177,29,0,0,89,243,18,13,0,241,255,255,125,220,17,1,24,2,0,1,0,7,0,14,0,21,0,31,0,38,0,44,0,50,0,61,0,71,0,77,0,83,0,89,0,
+    95,0,105,0,112,0,119,0,125,0,136,0,148,0,158,0,162,0,172,0,179,0,186,0,192,0,203,0,215,0,221,0,227,0,239,0,243,0,249,0,255,1,11,1,14,1,27,1,34,1,45,1,51,1,57,1,69,1,75,1,83,1,94,1,
+    106,1,110,1,116,1,124,1,136,1,149,1,156,1,163,1,168,1,174,1,180,1,191,1,200,1,206,1,217,1,223,1,229,1,239,1,245,1,251,2,2,2,9,2,19,2,26,2,32,2,38,2,49,2,59,2,65,2,71,2,77,2,83,2,93,
+    2,100,2,107,2,113,2,124,2,136,2,146,2,150,2,160,2,167,2,174,2,180,2,191,2,203,2,209,2,215,2,227,2,231,2,237,2,243,2,255,3,2,3,15,3,22,3,33,3,39,3,45,3,57,3,63,3,71,3,82,3,94,3,98,3,
+    104,3,112,3,124,3,137,3,144,3,151,3,156,3,162,3,168,3,179,3,188,3,194,3,205,3,211,3,217,3,227,3,233,3,239,3,245,3,248,3,253,4,2,4,5,4,8,4,11,4,14,4,17,4,22,4,24,4,31,4,37,4,43,4,51,
+    4,58,4,65,4,71,4,79,4,87,4,94,4,107,4,119,4,131,4,145,4,158,4,171,4,183,4,197,4,211,4,224,4,233,4,241,4,249,5,3,5,12,5,21,5,29,5,39,5,49,5,58,5,67,5,75,5,83,5,93,5,102,5,111,5,119,
+    5,129,5,139,5,148,5,161,5,174,5,187,5,199,5,213,5,227,5,240,5,248,5,252,6,4,6,16,6,25,6,36,6,44,6,52,6,60,6,69,6,76,6,85,6,92,6,97,6,108,6,115,6,122,6,132,6,139,6,148,6,155,6,164,6,
+    171,6,180,6,189,6,200,6,206,6,213,6,222,6,233,6,240,6,255,7,4,7,9,7,23,7,32,7,38,7,44,7,59,7,71,7,84,7,93,7,102,7,118,7,132,7,141,7,150,7,158,7,167,7,177,7,197,7,212,7,223,7,236,7,
+    255,8,19,8,22,8,33,8,49,8,66,8,81,8,87,8,95,8,106,8,117,8,133,8,147,8,158,8,170,8,182,8,192,8,207,8,218,8,229,8,245,9,6,9,21,9,30,9,41,9,54,9,71,9,84,9,99,9,113,9,133,9,152,9,171,9,
+    189,9,204,9,207,10,1,10,62,10,77,10,84,10,90,65,98,114,101,118,101,65,109,97,99,114,111,110,65,111,103,111,110,101,107,65,114,105,110,103,97,99,117,116,101,65,69,97,99,117,116,101,
+    67,97,99,117,116,101,67,99,97,114,111,110,67,99,105,114,99,117,109,102,108,101,120,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,111,97,116,69,82,0,17,69,45,0,
+    21,69,34,0,18,69,98,0,129,69,111,103,111,110,101,107,71,36,0,22,71,75,0,98,71,99,111,109,109,97,77,0,21,71,53,0,85,72,98,97,114,73,14,0,18,73,67,0,18,73,67,0,118,73,116,105,108,100,
+    101,74,67,0,23,75,67,0,17,76,190,0,17,76,132,0,24,76,24,0,65,100,111,116,78,28,0,17,78,28,0,23,78,28,0,242,2,69,110,103,79,104,117,110,103,97,114,117,109,108,97,117,116,79,111,0,97,
+    79,115,108,97,115,104,52,0,18,82,6,0,1,58,0,23,82,58,0,17,83,24,0,150,83,99,101,100,105,108,108,97,83,147,0,23,83,37,0,81,84,98,97,114,84,59,0,19,84,41,0,23,84,30,0,24,85,122,0,18,
+    85,122,0,18,85,233,0,16,85,142,1,17,85,238,0,17,87,105,0,22,87,97,0,246,1,87,100,105,101,114,101,115,105,115,87,103,114,97,118,101,89,26,0,17,89,17,0,17,90,49,0,21,90,67,1,113,71,46,
+    115,115,48,49,97,126,1,18,97,102,0,18,97,102,0,16,97,102,0,1,46,0,33,97,101,7,0,18,99,6,0,1,178,0,22,99,88,0,21,99,76,0,17,100,27,0,17,100,244,1,17,101,82,0,17,101,18,0,21,101,34,0,
+    18,101,98,0,18,101,98,0,17,103,36,0,22,103,75,0,23,103,0,1,21,103,53,0,85,104,98,97,114,105,14,0,18,105,67,0,18,105,67,0,17,105,6,1,22,106,67,0,23,107,67,0,17,108,177,0,17,108,132,
+    0,24,108,24,0,65,100,111,116,110,28,0,17,110,28,0,23,110,28,0,72,101,110,103,111,122,1,18,111,111,0,22,111,244,1,17,114,58,0,17,114,58,0,23,114,58,0,17,115,24,0,19,115,203,1,22,115,
+    147,0,23,115,37,0,81,116,98,97,114,116,59,0,19,116,41,0,23,116,30,0,24,117,122,0,18,117,122,0,18,117,233,0,16,117,142,1,17,117,238,0,17,119,105,0,22,119,97,0,20,119,244,1,17,119,227,
+    1,22,121,26,0,17,121,17,0,17,122,49,0,21,122,67,1,17,97,244,1,16,103,6,0,32,50,116,6,0,144,51,102,95,102,102,95,102,95,105,5,0,240,23,108,102,95,116,102,95,121,116,95,105,116,95,116,
+    116,95,121,79,109,101,103,97,112,105,122,101,114,111,46,116,102,111,110,101,46,116,102,116,119,12,0,64,116,104,114,101,14,0,160,102,111,117,114,46,116,102,102,105,118,14,0,241,9,115,
+    105,120,46,116,102,115,101,118,101,110,46,116,102,101,105,103,104,116,46,116,102,110,105,57,0,1,70,0,128,105,110,102,101,114,105,111,114,76,0,4,12,0,0,82,0,5,12,0,1,88,0,4,14,0,1,94,
+    0,5,13,0,0,100,0,4,13,0,0,106,0,5,12,0,1,112,0,4,14,0,2,118,0,4,14,0,1,124,0,4,13,0,1,130,0,64,100,110,111,109,126,0,0,8,0,0,122,0,1,8,0,1,118,0,0,10,0,1,114,0,1,9,0,0,110,0,0,9,0,
+    0,106,0,1,8,0,1,102,0,0,10,0,2,98,0,0,10,0,1,94,0,0,9,0,1,90,0,49,110,117,109,216,0,0,8,0,0,90,0,1,8,0,1,90,0,0,10,0,1,90,0,1,9,0,0,90,0,0,9,0,0,90,0,1,8,0,1,90,0,0,10,0,2,90,0,0,10,
+    0,1,90,0,0,9,0,1,90,0,49,115,117,112,54,1,1,68,0,5,13,0,0,72,0,4,13,0,0,76,0,5,12,0,1,80,0,4,14,0,2,84,0,4,14,0,1,88,0,4,13,0,16,97,195,18,240,4,105,115,109,69,117,114,111,110,111,
+    116,101,113,117,97,108,103,114,101,97,217,18,0,12,0,65,108,101,115,115,21,0,97,97,112,112,114,111,120,11,0,241,71,101,109,112,116,121,115,101,116,105,110,102,105,110,105,116,121,105,
+    110,116,101,103,114,97,108,105,110,99,114,101,109,101,110,116,112,114,111,100,117,99,116,115,117,109,109,97,116,105,111,110,114,97,100,105,99,97,108,109,105,99,114,111,112,97,114,116,
+    105,97,108,100,105,102,102,97,114,114,111,119,117,112,97,114,114,111,119,78,69,14,0,16,114,48,2,1,10,0,33,83,69,7,0,65,100,111,119,110,9,0,33,83,87,7,0,65,108,101,102,116,9,0,18,78,
+    16,0,65,98,111,116,104,16,0,64,117,112,100,110,250,2,114,108,101,98,108,97,99,107,11,0,240,19,108,111,122,101,110,103,101,102,105,108,108,101,100,98,111,120,115,113,117,97,114,101,
+    119,104,105,116,101,116,114,105,97,103,117,112,7,0,97,110,103,108,101,117,112,22,0,241,4,112,101,97,99,101,99,104,101,99,107,115,111,117,110,100,99,111,112,121,147,0,240,4,101,115,
+    116,105,109,97,116,101,100,110,117,109,101,114,111,109,105,110,117,34,1,4,2,20,0,70,3,20,49,135,3,69,99,111,109,98,109,3,0,13,0,1,134,3,0,9,0,1,137,3,0,9,0,8,233,3,0,16,0,0,174,0,97,
+    117,109,102,108,101,120,14,0,0,42,7,0,9,0,1,33,5,0,9,0,0,254,3,0,8,0,1,1,4,0,9,0,2,29,4,0,10,0,1,64,4,181,116,117,114,110,101,100,97,98,111,118,101,20,0,2,60,7,1,15,0,2,136,6,0,11,
+    0,1,200,4,48,108,111,110,107,5,128,98,98,114,97,99,107,101,116,83,1,4,15,2,3,19,0,1,244,0,4,20,0,50,73,84,70,159,7,1,230,0,7,164,7,3,16,0,6,169,7,2,17,0,5,252,0,1,15,0,16,81,6,0,64,
+    52,100,111,116,74,2,33,106,97,3,1,0,19,0,3,117,6,2,11,0,6,0,1,2,16,0,4,75,1,2,14,0,1,64,1,2,11,0,2,248,0,2,12,0,2,26,5,2,12,0,0,33,1,6,10,0,7,101,0,1,50,1,1,26,0,2,111,6,0,11,0,23,
+    50,116,6,3,16,0,10,196,0,22,50,126,6,1,32,0,0,183,5,0,9,0,18,51,188,5,3,11,0,2,86,1,3,13,0,10,65,0,17,51,228,5,0,113,1,224,46,97,108,116,115,116,114,111,107,101,115,104,111,114,238,
+    5,2,132,1,6,14,0,10,29,0,82,46,99,97,115,101,49,0,4,167,1,2,19,0,0,117,8,5,53,0,6,19,0,9,37,0,5,122,1,1,122,0,67,105,50,46,48,86,12,240,21,32,105,115,32,97,32,116,114,97,100,101,109,
+    97,114,107,32,111,102,32,116,104,101,32,73,110,100,105,97,110,32,84,121,112,101,32,70,240,2,68,114,121,46,67,243,2,175,32,50,48,49,55,45,50,48,50,49,40,0,2,82,32,65,108,108,32,40,2,
+    164,32,114,101,115,101,114,118,101,100,46,111,0,3,197,12,3,15,0,128,78,111,114,109,97,108,0,169,142,12,241,36,16,0,26,0,34,0,67,0,73,0,76,0,114,0,124,0,129,1,30,1,116,1,132,1,151,1,
+    169,1,176,1,184,1,188,1,193,1,204,1,211,1,223,1,240,1,250,2,2,2,14,2,22,58,12,248,255,255,255,255,255,255,255,255,255,255,221,42,2,48,2,53,2,58,2,63,2,142,2,145,2,192,2,233,3,50,3,
+    77,3,102,3,121,3,144,3,183,3,199,3,213,3,227,3,244,3,252,4,11,4,25,4,32,4,37,4,54,4,64,4,73,4,80,4,88,4,94,4,101,4,108,4,118,4,128,4,134,4,140,4,146,5,20,5,125,5,217,6,45,6,52,6,55,
+    6,134,6,140,6,145,6,220,7,28,7,77,7,100,7,147,7,205,8,6,8,62,8,116,8,169,8,192,8,242,9,33,9,62,9,104,9,145,9,165,9,193,9,232,9,242,9,246,10,26,10,56,10,75,10,89,10,125,10,160,10,193,
+    10,224,11,0,11,9,11,38,11,68,11,86,11,114,11,140,11,164,11,189,11,207,11,230,11,244,12,1,12,24,12,31,12,47,12,63,12,85,12,104,12,124,12,144,12,163,12,168,12,187,12,206,12,225,12,231,
+    12,249,13,9,13,26,13,43,13,59,13,75,13,89,13,98,13,113,13,120,13,135,13,149,13,163,13,177,13,189,13,202,13,214,13,226,13,238,13,250,14,0,14,11,14,22,14,33,14,44,14,48,14,53,14,60,14,
+    70,14,80,14,90,14,99,14,108,14,117,14,126,14,135,14,144,14,153,14,159,87,29,201,6,63,247,14,5,52,6,63,251,14,5,11,21,67,6,78,251,11,5,196,6,11,21,66,6,79,251,11,5,11,21,135,29,202,
+    248,120,6,66,251,134,21,251,4,77,59,33,34,78,219,247,4,247,4,201,219,245,245,199,59,251,4,30,14,21,56,29,214,74,29,21,89,29,21,251,55,239,41,247,58,247,55,239,238,247,54,30,248,103,
+    67,252,100,7,251,16,70,69,251,14,251,17,70,207,247,18,30,248,100,67,7,14,21,166,162,162,166,166,116,163,112,11,161,117,167,31,11,21,79,164,89,182,106,30,93,127,113,107,97,26,102,158,
+    114,173,126,30,95,123,109,102,93,26,53,210,97,247,45,247,49,234,197,235,218,81,183,34,30,251,57,6,94,117,153,168,165,159,155,173,141,31,127,167,171,132,175,27,247,12,223,215,247,1,
+    188,116,189,106,169,31,158,155,160,149,167,27,145,145,139,137,149,31,201,7,140,134,132,139,133,27,93,103,118,101,119,31,158,111,94,151,95,27,251,11,54,60,251,3,31,205,22,217,197,194,
+    220,221,196,85,60,61,83,88,57,55,83,191,216,30,107,252,24,21,188,174,166,203,30,247,46,6,205,169,118,94,77,77,107,251,13,251,9,90,164,198,31,14,21,251,24,223,251,1,247,30,222,206,179,
+    207,172,30,251,7,7,38,73,72,40,52,79,185,217,124,30,70,6,251,9,158,226,69,247,16,27,247,34,231,233,247,36,31,248,105,79,7,132,42,5,210,108,75,178,55,27,251,34,54,251,1,251,24,31,208,
+    140,21,237,199,220,243,245,199,63,36,35,77,63,34,37,78,220,238,30,14,21,251,44,232,38,247,29,247,2,225,204,238,162,30,121,29,21,179,118,162,108,113,118,118,111,114,159,121,164,144,
+    84,29,183,48,29,21,165,163,161,166,166,115,53,29,117,116,112,112,161,117,166,31,11,85,29,116,116,112,112,11,81,213,252,62,208,248,62,11,175,201,26,14,249,150,82,29,11,21,75,6,252,95,
+    253,90,5,202,6,11,249,39,34,29,195,6,11,250,13,21,67,6,79,251,11,5,195,6,11,162,113,112,117,116,112,112,161,117,166,31,247,38,22,85,29,11,248,232,21,247,124,194,251,124,6,11,247,36,
+    22,249,109,62,29,11,209,247,82,5,247,222,6,209,251,82,5,11,247,150,247,248,205,252,64,11,151,141,143,150,30,192,7,136,131,11,248,128,24,64,6,11,253,96,7,14,77,248,136,201,7,11,70,253,
+    109,7,11,162,117,166,31,11,113,193,84,27,11,252,176,21,208,6,239,247,196,152,179,147,168,146,165,25,145,110,147,109,151,103,239,251,196,24,206,6,247,56,248,120,5,67,6,43,251,184,122,
+    87,137,127,129,99,25,130,175,127,181,130,165,44,247,184,24,68,6,43,251,184,134,123,123,90,131,100,25,129,178,130,172,128,171,44,247,184,24,68,6,14,106,29,14,21,134,161,161,137,168,
+    27,208,186,170,215,167,31,247,114,248,231,5,68,6,251,45,252,58,251,48,248,58,5,66,6,247,88,252,149,118,82,5,74,115,97,136,97,27,86,6,14,252,107,21,251,191,211,247,191,7,247,132,248,
+    53,5,60,6,251,67,251,201,126,114,139,139,130,121,25,132,155,133,151,131,154,251,69,247,201,24,58,6,14,21,49,207,81,247,1,247,2,213,196,226,209,101,178,55,160,30,56,160,5,86,152,113,
+    165,176,26,191,177,168,207,204,178,106,83,141,30,206,6,229,136,73,195,37,27,35,68,85,54,73,180,95,223,118,31,222,118,5,196,125,159,116,99,26,87,95,107,64,71,97,174,195,30,11,155,128,
+    117,117,118,127,113,119,121,145,149,121,31,97,7,128,156,158,135,165,27,185,182,164,191,182,11,21,205,252,48,7,248,50,248,222,5,203,252,133,73,248,45,7,252,48,252,220,5,73,7,14,247,
+    110,251,32,247,45,251,93,199,29,251,109,247,32,251,45,247,93,11,21,73,95,169,198,193,176,179,230,147,31,247,35,150,5,113,7,34,80,68,37,30,14,6,251,158,249,96,5,50,6,251,155,253,96,
+    5,247,190,248,251,21,143,149,143,152,140,145,140,132,144,127,142,129,247,26,251,254,24,251,177,6,14,196,155,169,199,30,181,194,29,64,80,97,251,1,31,45,11,249,170,39,29,112,116,115,
+    112,112,161,116,167,31,11,157,248,120,21,47,29,247,122,252,62,208,248,62,11,21,226,6,215,247,14,5,77,6,82,50,81,228,5,77,6,11,146,29,248,170,178,50,29,11,247,154,127,21,220,207,175,
+    214,173,31,146,40,5,199,11,6,247,153,251,96,21,247,108,247,96,251,108,6,11,88,29,213,251,12,5,11,30,180,194,29,11,144,140,141,144,30,136,114,122,123,110,140,8,109,7,183,137,11,165,
+    162,161,166,166,116,162,113,112,11,247,71,247,0,247,14,247,50,11,21,197,228,196,50,5,11,21,80,247,12,5,67,6,11,208,248,120,70,6,14,163,113,104,103,116,114,11,247,34,243,246,247,39,
+    11,5,184,251,102,93,247,38,7,48,11,21,174,150,158,160,30,173,165,85,11,21,166,163,162,166,11,247,134,5,58,6,11,161,163,143,147,164,11,21,50,200,82,246,237,214,189,213,168,30,61,176,
+    212,93,234,27,247,7,214,193,29,88,105,59,27,33,79,211,247,6,133,31,248,22,173,6,247,28,52,233,251,25,57,73,102,76,100,30,200,114,76,178,57,27,251,10,60,76,41,31,202,6,203,188,178,223,
+    217,190,95,58,30,106,7,251,56,135,5,33,137,68,92,45,26,248,206,247,196,21,231,198,76,46,31,251,207,6,233,150,201,201,230,27,252,136,251,193,21,198,176,168,220,141,30,247,45,143,5,106,
+    7,47,78,77,44,69,94,169,202,30,14,21,247,3,103,233,77,205,30,206,227,5,68,6,100,88,5,179,84,71,162,62,27,199,29,251,3,175,45,202,74,31,72,51,5,211,6,177,189,5,99,194,206,117,216,27,
+    247,92,247,33,247,45,247,109,31,252,243,22,86,29,199,193,121,107,181,30,251,245,252,99,5,95,192,114,212,225,26,248,169,22,251,70,251,1,251,15,251,50,79,86,157,171,96,30,247,246,248,
+    99,5,183,86,164,66,53,26,14,183,248,166,21,41,198,75,247,4,112,30,247,13,109,5,216,121,175,97,75,26,57,72,88,34,41,73,188,214,135,30,65,6,251,9,148,233,66,247,31,27,247,40,235,218,
+    247,16,236,81,203,251,4,166,31,251,15,169,5,64,158,102,179,202,26,220,205,191,240,229,194,93,58,147,30,212,6,247,12,128,54,211,251,21,27,251,36,43,60,251,12,31,11,21,63,204,91,230,
+    230,204,187,215,192,108,184,87,154,30,180,155,163,175,184,26,210,81,182,60,58,82,95,70,94,162,103,180,123,30,88,122,107,95,86,26,206,247,99,21,183,177,163,190,190,176,115,94,98,106,
+    109,84,82,107,170,180,30,128,251,92,21,192,182,166,196,196,183,110,88,87,95,110,82,83,95,168,191,30,14,248,23,249,40,103,29,11,103,29,14,21,244,223,89,41,169,31,217,6,247,22,111,251,
+    9,225,251,43,27,251,97,251,32,251,46,251,111,251,113,247,32,251,38,247,95,247,8,229,193,210,177,31,146,251,6,5,196,248,24,251,219,75,247,151,102,6,251,64,251,9,81,251,12,251,53,251,
+    2,247,5,247,78,247,75,243,247,14,247,57,30,11,182,247,246,106,29,11,252,64,69,29,14,21,251,117,247,33,251,32,247,94,247,87,247,20,247,24,247,92,30,194,251,235,74,247,160,7,251,57,136,
+    39,50,251,37,27,251,53,32,247,3,247,78,247,79,246,247,12,247,56,247,2,226,89,34,177,31,216,6,247,39,101,251,12,215,251,45,27,251,100,251,31,251,44,251,115,31,11,21,208,6,247,84,248,
+    244,247,84,252,244,5,207,6,247,107,249,96,5,66,6,251,40,252,129,131,112,130,104,128,84,25,128,185,129,175,128,175,251,48,59,29,251,48,252,128,128,104,129,108,127,87,25,130,186,130,
+    175,129,174,251,37,59,29,14,247,197,22,154,29,251,219,70,77,208,251,219,6,247,118,247,219,21,201,251,46,247,153,247,33,7,247,69,247,4,251,5,251,71,251,70,251,4,251,6,251,67,31,251,
+    35,247,153,6,14,21,174,151,158,159,30,173,165,85,197,27,192,167,176,208,137,31,89,6,103,129,121,11,160,248,123,21,71,188,95,206,209,186,182,207,197,99,178,83,145,30,228,221,92,29,54,
+    5,105,166,7,194,169,113,96,102,114,115,98,98,114,165,179,31,248,160,247,115,50,29,11,21,159,145,139,138,150,31,195,132,168,105,92,26,82,99,104,83,83,103,174,195,30,85,6,55,198,82,226,
+    224,206,193,226,220,80,188,67,145,30,247,13,247,3,5,191,251,159,88,247,95,7,251,24,251,11,5,100,7,14,177,251,60,21,128,156,158,135,165,27,185,182,164,191,182,108,162,101,129,130,137,
+    136,129,31,161,186,5,166,7,111,140,97,47,148,114,5,148,159,149,142,158,27,163,155,128,117,117,119,127,112,119,122,145,149,120,31,14,21,247,189,247,101,7,247,38,251,189,5,219,6,251,
+    45,247,201,5,231,164,193,211,242,26,247,19,51,219,251,37,30,251,159,253,96,6,211,249,31,21,247,87,6,237,200,88,46,48,81,85,40,31,251,89,6,14,21,97,83,123,103,88,26,50,209,70,229,227,
+    208,205,231,225,78,204,47,123,123,136,132,123,30,247,0,247,35,5,76,6,35,251,178,21,199,180,184,201,198,181,94,79,78,97,94,80,77,98,184,200,30,14,21,181,195,154,176,190,26,228,69,208,
+    50,50,70,72,48,52,201,74,230,156,155,142,146,154,30,32,251,35,5,201,6,244,247,178,21,79,97,95,78,79,97,183,199,200,181,184,199,200,181,94,78,30,14,233,7,196,155,169,200,83,29,65,79,
+    97,251,1,31,45,251,122,233,7,75,29,7,14,62,6,43,108,49,78,251,5,27,251,49,34,247,12,247,72,247,73,244,247,12,247,49,247,4,227,76,36,169,31,216,6,247,34,110,251,13,232,251,46,27,251,
+    94,251,30,251,42,251,112,11,21,190,251,98,7,244,224,5,203,191,171,192,198,26,226,85,193,52,52,82,79,46,30,193,6,203,172,176,195,196,169,108,79,95,114,97,88,98,30,251,46,251,18,5,94,
+    7,14,247,3,249,166,21,165,162,161,166,165,116,163,188,29,247,38,22,165,162,161,166,165,116,163,189,29,40,29,14,247,39,249,143,21,200,186,187,199,200,92,186,78,78,92,93,77,77,184,93,
+    202,31,186,4,105,116,164,176,175,163,164,172,173,163,113,104,102,116,114,104,31,14,69,6,77,120,81,99,67,27,41,75,216,247,7,247,11,208,214,237,206,197,102,72,157,31,208,6,239,120,57,
+    204,251,4,27,251,33,46,35,251,44,31,14,249,170,21,165,162,161,166,166,116,53,29,117,116,112,112,161,117,166,31,11,172,29,251,173,208,247,188,7,247,14,84,218,251,25,69,75,104,77,107,
+    30,129,223,5,79,252,120,6,11,21,166,162,161,166,166,116,162,112,233,7,2,62,8,7,253,7,224,11,249,167,136,29,110,99,73,144,31,11,22,128,29,252,7,241,55,247,37,7,233,236,247,46,251,134,
+    5,219,6,251,79,247,183,247,78,247,85,5,52,6,251,132,251,142,5,248,131,62,29,11,99,120,117,108,106,26,99,168,110,183,152,58,29,133,138,132,27,119,125,148,161,161,156,166,179,156,31,
+    248,120,11,21,179,119,162,108,112,119,180,8,255,110,163,145,84,29,182,48,29,109,29,116,30,98,64,29,90,111,99,73,143,31,11,251,149,7,251,7,84,77,46,62,88,180,247,7,30,247,171,69,251,
+    193,7,251,10,201,61,247,6,215,206,177,195,166,30,148,57,5,11,247,217,248,126,21,143,122,126,140,124,27,71,88,105,87,120,31,134,214,5,74,252,120,208,247,168,6,231,196,199,228,30,177,
+    6,11,67,113,120,132,127,124,31,160,220,5,247,29,185,251,65,6,96,251,65,186,131,5,158,153,162,151,166,27,183,167,109,97,11,64,0,11,246,255,225,14,133,38,5,219,105,68,173,61,27,251,32,
+    52,32,251,38,251,38,220,251,2,247,35,221,205,177,212,174,31,146,40,5,11,109,29,115,30,99,64,29,90,11,199,169,205,27,247,5,204,60,39,33,69,67,251,0,37,76,201,242,31,67,6,251,33,231,
+    49,247,36,30,14,202,6,204,189,177,223,210,196,109,44,30,123,7,251,52,126,5,251,5,130,71,83,50,26,54,200,81,242,30,11,21,200,186,187,200,199,92,175,29,105,116,164,175,175,163,164,172,
+    11,247,17,186,208,243,26,247,23,49,226,251,27,251,33,44,40,251,42,135,30,211,6,247,3,142,204,211,11,245,248,253,21,167,163,162,167,167,115,163,111,111,116,115,111,111,162,116,167,31,
+    105,252,253,21,11,148,114,5,148,159,150,142,157,27,163,155,128,117,117,119,127,113,118,122,145,149,120,31,14,250,13,21,71,6,79,251,11,5,193,6,247,85,247,11,21,68,6,66,251,11,5,194,
+    6,11,93,29,196,27,192,168,176,208,136,31,90,6,103,129,121,115,30,11,21,34,78,219,247,4,247,3,200,220,244,245,201,58,251,3,251,4,77,59,33,31,14,238,249,51,21,251,182,188,247,227,251,
+    20,94,7,11,238,249,166,39,29,111,117,115,112,111,40,29,14,6,209,105,75,174,59,27,251,36,56,251,2,251,38,251,37,222,251,0,247,33,31,11,247,87,249,49,158,29,11,247,162,248,196,39,29,
+    112,116,115,112,112,161,116,167,31,11,22,247,104,247,134,251,104,95,29,247,104,251,134,200,29,11,247,23,128,21,173,168,167,172,173,110,168,105,105,110,110,105,106,168,111,173,31,11,
+    197,80,42,54,105,89,251,24,251,7,31,251,121,251,92,5,82,7,14,247,107,247,35,247,36,247,106,247,106,251,36,247,36,251,108,31,251,108,11,21,174,143,115,155,118,27,117,114,123,104,143,
+    31,159,251,91,5,184,6,11,21,242,66,214,37,37,65,64,36,36,213,65,241,241,212,213,242,30,11,164,29,213,187,11,21,251,23,251,180,5,192,6,247,20,247,180,5,186,251,125,92,7,11,21,166,160,
+    159,167,167,118,160,112,111,119,118,111,111,159,119,167,31,11,10,1,240,79,99,112,193,85,27,90,110,99,11,151,249,30,170,29,11,167,174,26,193,94,172,77,77,94,105,86,105,158,111,169,126,
+    30,11,21,190,251,183,88,247,128,7,251,50,252,18,5,195,6,14,21,95,117,113,95,95,116,165,183,30,83,6,62,187,92,214,11,106,98,26,198,247,49,21,170,165,156,175,175,165,122,108,109,11,249,
+    50,21,94,117,114,95,95,116,164,184,36,0,245,6,11,22,184,251,41,7,196,185,5,201,190,162,177,189,26,206,11,247,69,250,9,122,11,240,255,81,14,132,195,29,157,166,178,156,31,11,21,247,112,
+    253,30,211,249,30,247,113,205,252,149,6,11,185,29,197,247,205,6,11,247,145,7,247,1,195,211,238,219,190,99,251,5,30,11,21,165,163,162,166,166,115,163,113,111,116,115,112,11,163,25,148,
+    117,151,115,161,108,176,87,24,178,165,11,186,78,78,92,93,78,76,184,93,202,31,187,4,11,75,247,235,7,251,113,251,110,5,89,7,14,110,86,69,51,26,232,247,239,21,214,203,187,11,248,197,21,
+    186,6,156,247,47,5,75,6,11,133,123,123,136,125,27,101,113,161,191,31,11,207,247,10,134,31,248,21,173,6,247,29,11,36,30,189,138,21,217,173,189,198,199,174,11,198,29,42,81,236,11,5,247,
+    186,205,251,238,6,53,251,252,11,247,51,22,247,222,248,23,251,222,210,11,21,221,205,175,200,169,31,148,54,5,11,209,210,186,188,208,207,186,90,68,30,11,191,29,110,11,189,29,63,29,11,
+    113,112,116,116,112,112,11,199,22,249,90,249,90,253,90,6,11,26,200,92,186,78,78,92,93,77,11,163,120,165,152,147,142,143,145,30,11,194,241,165,31,72,6,75,122,11,199,6,142,123,119,140,
+    122,27,11,138,133,27,118,125,148,161,161,11,252,30,248,232,5,66,253,96,11,104,111,111,105,105,167,110,174,11,236,197,42,247,45,71,251,45,11,251,92,251,33,251,46,251,109,11,251,104,
+    251,134,5,11,1,0,34,0,0,171,0,1,135,0,0,172,2,1,136,1,0,175,0,1,138,0,0,176,34,34,240,255,54,1,139,0,0,35,1,1,140,1,0,177,0,1,142,1,0,37,0,0,154,0,1,144,1,0,38,0,0,178,0,1,146,1,0,
+    179,1,1,148,0,0,181,0,1,149,1,0,39,1,1,151,3,0,41,0,1,155,0,0,42,0,0,182,2,1,156,0,0,185,0,1,157,2,0,43,0,1,160,0,0,44,0,1,161,0,0,45,0,1,162,3,0,140,0,0,46,1,1,166,3,0,186,0,0,48,
+    0,0,187,3,1,170,1,0,141,0,1,172,0,0,191,0,0,142,0,0,49,0,0,157,0,0,50,1,1,173,2,0,52,0,1,176,0,0,192,0,1,177,2,0,53,0,1,180,3,0,54,0,0,193,3,1,184,4,0,55,1,1,189,3,0,57,1,0,197,0,1,
+    193,0,0,198,0,1,194,0,0,59,0,1,195,0,0,199,0,1,196,1,0,66,0,0,200,0,1,198,0,0,201,2,1,199,1,0,204,0,1,201,0,0,205,0,0,144,0,1,202,0,0,67,1,1,203,1,0,206,0,1,205,1,0,69,0,0,167,0,1,
+    207,1,0,70,0,0,207,0,1,209,1,0,208,1,1,211,0,0,210,0,1,212,1,0,71,1,1,214,3,0,73,0,1,218,0,0,74,0,0,211,2,1,219,0,0,214,0,1,220,2,0,75,0,1,223,0,0,76,0,1,224,0,0,77,0,1,225,3,0,146,
+    0,0,78,1,1,229,3,0,215,0,85,30,160,216,3,1,233,1,0,147,0,1,235,227,33,241,41,0,148,0,0,81,0,0,162,0,0,82,1,1,236,2,0,84,0,1,239,0,0,221,0,1,240,2,0,149,0,0,85,0,1,243,3,0,86,0,0,222,
+    3,1,247,4,0,87,1,1,252,3,0,89,1,0,226,203,35,240,40,227,0,2,1,0,0,91,0,2,2,0,0,228,0,2,3,8,0,109,1,2,12,4,0,17,9,2,17,40,0,150,0,0,164,0,0,169,0,2,58,5,0,99,0,0,155,0,0,158,0,0,163,
+    0,1,64,248,41,240,6,2,64,0,0,61,0,0,114,0,0,116,0,0,27,0,0,13,0,0,121,0,85,0,112,96,0,0,4,0,0,15,128,35,241,95,0,123,0,0,3,0,0,104,0,0,28,0,0,16,0,0,64,0,0,92,0,0,94,0,0,60,0,0,62,
+    0,0,9,1,0,137,0,0,111,0,0,14,0,0,106,0,0,120,0,0,107,1,0,118,0,0,105,0,0,119,0,0,65,0,0,8,0,0,117,0,0,1,0,0,97,0,0,103,0,0,5,0,2,65,0,0,101,0,0,98,0,0,100,0,0,12,0,0,166,0,0,168,0,
+    0,159,0,0,30,0,2,66,178,42,240,7,29,0,2,67,1,0,156,0,2,69,0,0,95,0,0,151,0,2,70,8,0,6,157,42,240,85,2,79,18,0,33,0,0,7,0,0,115,0,0,102,0,0,170,0,0,165,0,2,98,0,0,153,0,0,161,0,0,93,
+    0,0,160,0,0,112,1,2,99,1,0,63,0,2,101,16,0,125,0,0,129,0,0,136,0,0,133,0,0,126,0,0,131,0,0,130,0,0,124,0,0,134,0,0,128,0,0,135,0,0,132,0,0,127,0,2,118,7,0,145,0,2,126,26,1,0,1,248,
+    242,18,242,255,255,255,255,56,28,0,36,0,47,0,63,0,74,0,103,0,116,0,129,0,158,0,178,1,7,1,17,1,65,1,124,1,196,1,223,1,236,1,250,2,118,2,130,2,141,2,161,2,164,2,217,2,220,2,240,2,253,
+    3,9,3,24,3,37,3,50,3,61,3,72,3,85,3,117,3,140,3,145,3,162,3,253,4,23,4,41,4,56,4,94,4,100,4,112,4,124,4,135,4,145,4,161,4,174,4,202,4,219,4,225,4,238,4,242,4,251,4,255,5,11,5,27,5,
+    36,5,62,5,100,5,155,5,162,5,173,5,183,5,193,5,243,5,253,6,5,6,21,6,33,6,45,6,57,6,69,6,83,6,91,6,105,6,117,6,211,7,2,7,52,7,121,7,125,7,140,7,152,7,161,7,165,7,180,7,191,7,238,7,249,
+    8,2,8,6,8,40,8,60,8,109,8,123,8,129,8,142,8,151,8,162,8,171,8,180,8,193,9,20,9,38,9,49,9,87,9,155,9,167,9,177,9,191,9,201,10,6,10,13,10,21,10,47,10,83,10,93,10,121,10,136,10,147,10,
+    169,10,174,10,180,10,192,10,208,10,218,10,243,10,255,11,11,11,42,11,61,11,144,11,156,11,163,11,175,11,230,11,236,11,249,12,7,12,54,12,78,12,104,12,114,12,218,12,247,13,11,13,17,13,
+    29,13,38,13,51,13,60,13,72,13,80,13,96,13,107,13,145,13,180,13,186,13,205,13,220,14,10,14,37,14,47,14,67,14,71,14,80,14,88,14,116,14,131,14,144,14,152,14,161,14,182,14,209,14,217,14,
+    222,14,230,14,235,14,250,15,5,15,12,15,37,15,71,15,140,15,144,15,155,15,169,15,177,15,230,15,252,16,2,16,11,16,20,16,33,16,42,16,51,16,62,16,161,17,9,17,26,17,92,17,154,17,212,18,22,
+    18,27,18,40,18,60,18,70,18,75,18,89,18,103,18,205,18,216,18,226,19,48,19,53,19,76,19,95,19,128,19,136,19,149,19,159,19,169,19,180,19,192,19,201,19,212,19,254,20,15,20,27,20,66,20,143,
+    20,155,20,164,20,245,20,255,21,46,21,53,21,63,21,74,21,101,21,111,21,140,21,154,21,170,21,197,21,214,21,220,21,225,21,235,22,34,22,52,22,72,22,126,22,148,22,180,22,205,22,232,23,27,
+    23,87,23,130,23,198,23,215,23,237,24,11,24,14,24,37,24,113,24,137,24,227,25,26,25,92,25,114,25,136,25,166,25,169,25,192,26,12,26,36,26,126,26,181,26,228,26,236,26,243,26,251,27,32,
+    27,38,27,45,27,53,27,59,27,66,27,92,27,108,27,137,27,179,27,185,27,217,28,18,28,27,28,45,28,102,28,128,28,133,28,185,28,228,29,8,29,13,29,70,29,75,29,157,29,215,30,8,30,16,30,24,30,
+    32,30,70,30,77,30,84,30,92,30,99,30,107,30,116,30,146,30,165,30,172,30,185,30,205,31,29,31,47,31,148,32,131,32,147,32,172,32,197,32,222,33,5,33,35,33,86,33,131,33,225,33,230,34,47,
+    34,126,34,137,34,142,34,183,34,200,34,211,35,24,35,93,35,113,35,133,35,179,35,224,35,237,35,250,36,7,36,31,36,39,36,44,36,49,36,74,36,115,36,140,36,145,36,150,36,155,36,158,36,229,
+    37,74,37,202,38,59,38,123,38,220,39,17,39,42,39,50,39,94,39,114,39,129,39,183,39,210,39,239,40,17,40,58,40,94,40,137,40,153,40,169,41,35,41,129,41,168,41,214,41,231,42,11,42,40,42,
+    90,42,174,42,182,42,231,43,8,43,38,43,72,43,102,43,136,43,165,43,198,43,227,44,30,44,83,44,88,44,128,44,171,44,176,44,192,44,205,44,234,45,75,45,99,46,7,46,130,46,168,47,34,47,163,
+    47,216,48,1,48,55,48,99,48,111,48,133,48,154,48,185,49,15,49,87,49,116,49,142,50,2,50,6,50,10,50,14,50,18,50,22,50,30,50,34,50,38,50,42,50,46,50,54,50,96,50,135,50,139,50,155,50,159,
+    50,163,50,167,50,171,50,179,50,183,50,187,50,191,50,195,50,203,50,210,50,214,50,218,50,237,51,1,51,51,51,68,51,82,51,92,51,113,51,160,51,164,51,193,51,205,51,223,51,237,52,6,52,27,
+    52,40,52,98,52,146,52,225,53,5,53,14,53,22,53,68,53,77,53,110,53,122,53,167,53,175,53,181,53,193,53,210,53,223,53,235,53,254,54,14,54,35,33,189,251,103,21,248,36,250,197,252,36,254,
+    197,6,189,189,21,250,97,247,192,254,97,251,192,7,14,178,226,22,56,29,214,74,29,178,248,64,52,29,251,157,253,150,36,29,178,248,24,250,14,157,29,187,215,30,251,249,254,14,36,29,178,247,
+    156,37,10,251,7,253,150,36,29,178,247,141,249,170,21,46,29,161,117,167,252,19,241,6,116,116,112,112,40,29,251,200,253,170,36,29,178,247,239,249,150,51,10,251,96,69,0,241,18,247,98,
+    249,206,71,10,251,11,254,5,36,29,178,226,22,56,29,165,6,98,120,118,108,106,134,10,132,27,119,124,148,161,161,202,8,242,53,140,74,29,178,247,214,249,147,21,200,185,187,200,199,93,106,
+    10,251,127,253,195,36,29,178,248,64,250,150,33,29,251,157,254,31,21,56,29,214,6,251,148,249,68,5,171,158,160,173,179,191,29,97,159,105,172,121,30,251,144,253,67,5,247,199,249,100,21,
+    104,24,13,207,173,172,163,113,104,102,116,114,105,31,130,34,224,18,3,255,58,178,247,124,96,10,44,253,167,36,29,247,183,148,22,216,6,221,247,99,5,247,135,251,99,248,63,205,251,247,247,
+    153,247,213,204,251,213,247,150,247,247,205,252,179,6,36,252,82,21,247,42,248,16,5,208,252,16,6,14,247,183,249,46,250,13,34,29,195,6,252,216,253,150,21,59,0,25,241,109,162,226,22,247,
+    169,6,247,28,225,212,247,7,227,97,197,56,166,31,213,168,176,196,223,26,247,7,54,209,251,30,30,251,154,6,247,153,75,21,235,193,92,59,54,88,89,49,31,251,90,247,154,6,247,97,251,217,21,
+    232,195,90,58,56,84,90,45,31,251,97,247,154,6,14,247,15,248,15,128,21,247,46,247,17,230,247,27,172,31,117,29,251,112,247,28,251,41,247,92,31,14,247,15,248,125,250,13,33,29,105,253,
+    161,45,10,247,15,247,230,249,150,137,10,247,9,254,27,14,0,255,21,213,251,60,21,128,157,158,135,164,27,186,181,164,191,182,108,162,102,129,129,137,136,129,31,155,173,247,41,143,247,
+    12,229,171,247,24,25,241,14,30,247,3,251,101,247,15,251,37,247,76,125,31,115,87,148,114,5,148,160,149,98,12,33,119,121,98,12,130,247,15,247,216,37,10,247,9,150,0,255,37,248,18,76,29,
+    136,253,181,45,10,239,247,197,22,154,29,253,96,6,247,105,249,30,21,100,10,248,220,6,14,239,108,29,239,247,148,249,150,21,226,6,215,247,13,5,77,162,10,247,17,254,15,21,224,11,0,13,56,
+    0,240,1,108,248,152,22,205,251,249,247,153,247,215,204,251,215,57,29,86,22,240,8,108,248,39,250,13,33,29,247,81,253,150,36,10,108,247,255,250,14,123,10,236,254,14,12,0,176,144,249,
+    150,42,10,77,6,247,232,254,16,15,0,114,130,249,150,32,29,247,232,40,0,144,115,249,170,45,29,247,39,253,170,26,0,82,188,76,29,247,112,11,0,82,214,49,29,247,143,35,0,240,1,72,249,206,
+    40,10,247,228,254,5,36,10,108,248,104,22,98,207,14,124,53,10,153,58,29,169,29,133,0,255,42,76,248,88,247,207,21,204,251,185,247,162,247,242,205,252,58,253,96,211,247,207,7,14,247,36,
+    101,29,14,247,36,248,90,250,15,130,10,186,216,30,251,15,251,123,102,29,247,36,247,222,249,151,32,29,247,11,251,3,7,19,59,1,113,0,101,185,253,139,21,179,118,92,15,3,16,24,240,17,247,
+    36,248,24,249,171,173,29,111,162,117,167,31,138,251,23,102,29,238,184,29,249,96,68,251,211,252,23,247,211,67,60,15,0,240,30,248,181,225,202,53,247,0,68,251,0,252,23,247,0,67,251,0,
+    56,76,222,252,181,7,211,248,33,21,247,40,248,23,251,40,7,14,251,252,158,10,6,14,251,252,247,122,117,1,209,144,85,39,10,251,252,204,249,150,131,10,247,48,12,0,112,189,249,170,124,29,
+    102,65,23,0,82,247,15,76,29,175,10,0,161,41,249,150,88,29,214,251,12,5,205,37,0,17,146,89,1,49,44,251,57,39,0,23,3,90,1,4,244,12,240,16,249,96,67,60,29,251,252,172,249,167,130,29,247,
+    67,68,21,67,253,96,211,6,14,43,159,247,89,104,10,43,247,226,62,1,241,28,251,144,252,210,104,10,149,93,10,14,149,93,10,247,114,252,20,44,29,42,49,10,14,42,247,122,250,9,33,29,144,89,
+    154,10,14,42,49,10,194,248,131,21,187,213,12,32,74,6,16,0,65,247,59,251,57,41,0,240,127,247,41,247,144,21,164,161,160,164,165,117,161,114,113,118,118,112,114,161,118,164,31,14,42,155,
+    247,154,21,210,173,5,251,188,248,37,205,251,221,247,156,7,247,86,232,5,203,7,251,86,46,5,247,214,67,251,248,7,68,105,5,14,247,125,247,50,22,247,243,7,247,1,137,218,135,166,30,247,125,
+    252,202,5,208,6,247,125,248,205,5,135,90,137,84,251,17,26,251,232,210,249,96,67,7,251,153,253,11,251,153,249,11,5,68,253,96,6,14,246,247,51,22,48,10,14,246,248,100,52,29,251,121,253,
+    150,60,10,246,247,206,63,10,60,254,16,10,0,0,28,0,240,61,247,214,59,10,246,248,129,251,113,21,223,187,195,231,31,249,169,68,252,232,7,196,29,211,248,233,6,248,34,252,237,5,74,7,80,
+    116,111,91,125,117,143,145,117,30,126,75,5,131,165,164,136,166,27,14,246,247,160,96,10,80,253,167,60,10,247,55,249,105,247,250,34,10,247,55,248,127,196,4,96,196,6,247,202,252,48,16,
+    0,99,247,218,37,10,248,97,12,0,112,203,122,29,247,160,252,68,24,0,98,248,46,49,29,248,8,24,0,98,248,70,143,29,247,153,12,0,32,247,160,165,1,64,248,93,252,159,38,0,0,86,0,224,98,29,
+    247,55,248,125,250,10,33,29,247,204,252,45,14,0,240,159,247,186,125,29,248,116,252,65,34,10,248,184,182,247,252,21,251,107,247,36,251,49,247,96,247,15,246,198,233,185,30,251,33,248,
+    64,205,251,248,247,153,247,214,204,251,214,57,29,251,26,7,229,89,251,2,196,251,10,27,251,94,251,36,251,48,251,105,31,214,140,21,247,69,247,7,247,14,247,51,247,52,247,7,251,14,251,71,
+    251,71,251,6,251,15,251,52,251,51,251,8,247,17,247,71,30,14,147,247,252,247,155,21,247,29,227,237,247,22,247,27,52,229,251,30,31,251,165,253,96,211,247,155,6,247,83,248,24,21,238,200,
+    79,40,41,79,73,35,31,251,79,247,215,6,14,147,247,252,247,36,21,247,29,227,237,247,12,247,18,52,229,251,30,31,251,93,247,30,68,2,32,247,36,50,0,145,5,21,238,200,79,50,51,79,72,50,0,
+    240,51,196,6,14,247,55,249,32,98,21,188,184,64,223,5,201,204,176,233,247,3,26,72,29,212,204,159,176,193,30,214,247,205,21,51,112,64,93,86,30,44,245,91,94,232,34,5,113,99,90,124,84,
+    27,251,50,251,0,247,14,247,71,86,29,247,50,247,1,182,0,176,31,14,173,84,10,14,173,248,49,250,14,59,6,240,19,251,69,253,151,113,29,173,247,154,249,151,78,29,112,254,17,113,29,173,84,
+    10,247,117,252,97,47,10,96,99,29,14,96,248,23,159,1,240,2,195,6,251,158,251,132,54,10,96,247,128,63,10,251,8,251,254,11,0,240,34,114,62,10,154,172,5,247,33,144,229,217,247,12,26,236,
+    81,203,251,4,166,30,99,10,41,198,75,247,4,112,31,120,10,147,251,1,222,68,247,17,130,115,88,24,142,29,96,247,114,37,58,0,0,69,0,241,17,99,29,247,172,253,9,47,10,70,161,29,14,70,247,
+    13,248,6,21,247,3,252,6,211,248,6,247,4,201,251,4,247,110,64,16,240,12,73,247,112,251,110,251,3,6,14,70,247,116,249,150,21,227,6,215,247,14,152,10,251,28,251,134,170,54,0,115,106,62,
+    10,160,184,5,155,109,16,16,73,122,16,64,155,6,110,77,247,5,96,159,149,142,158,27,163,189,26,81,119,127,112,119,122,247,5,243,8,70,161,29,247,196,253,195,109,10,182,137,183,48,29,226,
+    221,247,141,38,29,226,248,90,220,0,160,187,46,10,226,247,181,37,10,251,37,9,0,112,166,122,29,251,230,252,177,33,0,224,9,49,29,251,126,46,10,226,248,33,143,29,251,237,29,0,16,123,110,
+    2,81,251,41,253,12,38,70,0,3,9,30,178,146,146,139,140,146,30,112,120,124,113,112,72,20,5,87,28,5,79,20,223,155,165,178,156,31,247,2,169,204,228,247,23,26,50,30,5,241,140,226,247,239,
+    249,147,139,29,172,90,29,105,31,251,157,252,202,38,29,226,247,149,125,29,251,18,252,174,38,29,174,247,176,22,214,6,247,164,249,96,5,65,6,251,82,252,133,128,112,121,89,124,87,25,123,
+    189,125,178,124,178,251,83,248,134,24,62,6,14,248,9,247,120,22,208,6,247,84,248,244,247,84,252,244,5,207,6,247,107,249,96,5,66,6,251,40,252,129,131,112,130,104,128,84,25,128,185,129,
+    175,128,175,251,48,59,29,251,48,252,128,128,104,129,108,127,87,25,130,186,130,175,129,174,251,37,59,29,14,248,9,248,232,250,13,33,29,251,184,55,10,248,9,248,67,37,10,251,33,10,0,16,
+    52,141,6,240,101,251,226,253,170,107,29,248,9,248,151,49,29,251,122,55,10,145,247,156,247,249,21,251,141,251,249,5,223,6,247,101,247,194,157,107,168,95,163,105,25,247,28,251,84,5,225,
+    6,251,142,247,251,247,138,247,249,5,56,6,251,100,251,198,122,171,116,177,105,187,25,251,25,247,80,5,54,6,14,108,247,145,247,191,79,10,108,248,31,52,29,73,68,29,108,247,123,249,150,
+    21,196,228,196,50,5,202,6,63,247,14,5,52,6,62,251,14,5,224,26,0,189,108,249,170,21,46,29,40,29,247,37,22,10,22,144,251,0,252,127,79,10,108,247,206,236,9,127,134,68,29,113,248,175,22,
+    163,28,5,48,113,248,26,248,1,240,2,196,6,247,117,253,150,71,29,113,247,131,63,10,248,12,254,16,11,0,50,175,249,170,49,20,1,5,20,240,28,247,148,253,170,71,29,247,43,104,29,14,55,247,
+    103,127,32,10,55,248,8,249,39,50,10,54,252,188,32,10,55,247,224,249,40,130,10,187,215,30,251,69,253,52,16,0,66,100,38,10,204,26,0,96,85,248,196,21,46,29,61,30,48,247,38,22,180,0,64,
+    251,20,252,208,35,0,98,183,248,176,51,10,115,37,0,128,42,248,232,71,10,200,253,43,24,0,243,19,103,127,185,29,148,6,103,10,247,205,7,247,20,57,195,251,4,251,11,59,76,41,30,138,29,155,
+    195,73,29,55,247,158,248,173,123,21,80,106,10,84,252,233,50,0,255,26,255,249,176,21,69,6,80,251,6,5,194,6,61,253,74,171,29,233,95,194,71,162,30,156,158,149,164,168,187,29,148,114,156,
+    121,30,66,116,94,85,66,26,210,21,10,144,191,248,145,21,64,10,103,252,89,102,0,245,118,68,248,193,101,10,224,252,205,32,10,247,162,186,247,26,97,29,247,162,248,172,51,29,252,48,252,
+    42,97,29,117,247,24,22,146,238,5,64,173,206,103,220,27,247,33,223,247,0,247,37,247,38,57,247,2,251,33,57,73,103,68,105,31,247,231,62,29,209,247,135,21,155,10,251,4,78,59,34,33,77,219,
+    247,4,30,14,53,177,247,133,43,29,53,248,6,249,39,50,10,251,148,251,191,43,29,53,247,112,248,176,42,10,76,6,34,252,57,43,29,53,177,247,133,21,251,36,222,41,247,17,129,30,115,88,149,
+    193,3,247,15,70,29,108,162,101,129,130,137,136,128,31,155,173,240,145,217,202,161,233,25,121,29,53,247,98,248,176,87,29,201,29,2,18,34,85,0,145,155,248,196,94,29,166,115,163,112,196,
+    21,241,6,162,116,166,31,251,117,251,211,43,29,117,80,29,249,109,70,251,229,87,10,112,107,0,48,37,243,251,187,0,244,76,41,244,247,0,247,64,247,36,91,247,5,251,5,247,14,30,207,176,117,
+    183,58,94,122,155,123,154,122,154,25,55,6,167,113,164,114,164,114,52,91,24,160,95,241,195,205,69,178,81,167,57,25,192,98,76,169,70,27,251,27,251,4,32,251,34,31,209,137,21,247,0,214,
+    219,247,1,246,211,61,33,251,4,64,58,251,0,32,66,219,247,1,30,14,114,0,97,148,29,247,197,248,221,172,20,144,48,5,75,6,251,185,253,58,145,143,0,241,47,248,213,199,188,79,242,70,36,251,
+    53,90,247,53,251,77,87,10,61,247,167,127,33,10,61,248,13,249,39,33,29,113,252,188,33,10,61,112,10,251,10,253,52,33,10,61,247,118,248,176,137,10,247,17,253,54,33,10,61,119,10,247,17,
+    31,0,241,0,247,89,248,196,124,29,71,252,208,33,10,61,150,29,144,8,0,66,247,188,248,176,190,8,18,174,36,0,112,46,54,29,247,13,253,43,69,0,243,43,167,127,21,144,144,139,144,27,112,121,
+    124,113,112,53,10,153,151,141,143,149,30,192,7,136,132,169,29,206,160,184,189,158,213,8,83,10,251,201,157,248,120,21,47,29,247,6,197,251,6,233,7,196,155,170,200,30,180,198,211,20,240,
+    14,65,79,52,10,7,14,117,178,247,148,42,29,117,247,238,166,29,186,91,215,213,187,187,216,30,251,255,252,50,19,0,176,114,138,10,62,251,13,5,251,12,251,186,15,0,240,27,217,248,227,21,
+    164,119,158,115,134,134,138,138,134,30,141,164,156,154,168,138,8,169,7,95,141,96,103,77,26,98,159,117,170,166,159,160,166,30,251,178,251,227,46,0,240,20,171,248,206,21,166,163,161,
+    166,167,115,162,112,112,116,116,111,112,63,29,251,132,251,206,42,29,95,102,10,247,221,70,253,108,7,14,10,0,240,18,69,247,52,188,251,52,242,70,36,78,90,200,252,212,7,14,141,29,89,29,
+    247,106,51,29,74,252,176,37,29,188,38,10,224,8,0,24,173,124,3,3,191,31,224,188,29,251,0,252,196,37,29,246,248,196,173,29,112,135,24,16,104,15,0,144,247,25,248,176,21,80,161,10,135,
+    56,0,244,7,130,54,29,220,253,31,37,29,141,29,159,6,128,29,70,7,14,156,248,193,144,29,94,23,96,73,143,31,244,252,193,66,0,50,253,21,166,212,24,34,112,110,212,24,240,6,168,31,251,56,
+    253,209,107,10,188,38,10,95,253,132,107,10,251,16,127,29,14,5,0,240,7,247,115,59,10,252,23,55,29,14,252,23,247,108,52,29,143,253,150,21,249,109,62,15,0,144,55,29,247,16,248,209,159,
+    10,14,31,0,240,11,221,59,10,251,168,55,29,247,92,247,205,21,165,162,162,165,166,117,161,112,111,117,117,112,112,63,43,0,240,4,247,36,22,248,7,7,201,169,5,195,7,77,109,5,247,194,70,
+    251,227,9,0,16,84,19,0,241,52,251,231,7,14,247,128,247,33,22,247,192,7,213,188,199,220,212,186,91,57,30,251,196,207,247,191,7,214,187,200,220,213,185,90,56,30,251,195,206,247,209,7,
+    247,4,70,207,34,61,80,99,76,117,30,202,116,82,179,63,27,71,85,108,88,115,31,131,208,91,27,240,4,14,95,90,10,14,95,248,26,51,29,251,64,252,176,57,10,95,247,131,162,3,255,32,77,6,117,
+    253,42,57,10,95,90,10,247,149,40,44,29,95,247,33,22,172,29,251,242,75,10,123,127,141,144,120,30,125,76,5,132,164,154,137,165,27,223,188,195,231,31,248,5,181,27,1,240,30,14,95,247,85,
+    248,193,93,29,197,27,191,168,176,160,29,73,143,31,137,252,193,57,10,101,177,247,134,41,10,101,248,27,65,10,251,169,44,10,101,247,118,38,10,251,18,9,0,240,3,103,248,196,45,29,251,211,
+    251,210,41,10,101,247,202,67,10,251,107,22,0,80,226,113,10,251,219,9,0,129,60,54,29,251,22,252,45,41,66,0,243,80,21,54,174,67,195,94,30,83,48,5,203,6,178,201,5,124,171,175,131,179,
+    27,91,29,223,105,210,85,184,31,189,221,5,76,6,107,87,5,155,105,101,148,98,70,10,209,140,21,247,4,211,219,243,168,166,133,127,162,30,251,91,251,213,5,104,174,118,190,200,26,247,244,
+    22,251,6,66,60,36,112,113,145,149,117,30,247,89,247,211,5,173,105,159,89,81,26,14,159,0,47,251,190,104,0,77,97,247,86,248,193,136,29,77,28,241,131,32,251,207,41,10,247,239,177,247,
+    134,21,251,39,243,32,247,34,232,215,185,212,180,30,65,178,212,94,232,27,247,6,215,193,29,87,105,60,27,36,76,180,29,51,232,251,24,48,68,94,65,101,30,212,97,64,185,46,70,10,249,36,247,
+    88,140,10,252,222,251,87,116,10,117,211,251,103,21,208,247,196,6,69,173,204,104,221,27,247,35,220,247,2,247,38,247,38,55,246,251,32,58,71,103,64,105,31,132,237,5,79,6,209,251,134,21,
+    76,10,244,200,59,251,4,251,3,78,58,34,33,77,220,247,3,30,14,117,248,182,247,135,21,247,38,56,247,0,251,32,221,5,168,30,247,231,70,254,64,208,247,196,7,81,0,129,37,31,69,22,251,3,78,
+    57,56,0,164,4,155,10,30,14,117,177,247,136,21,122,28,241,12,204,174,209,173,30,251,196,208,249,75,79,7,132,41,5,214,104,72,175,58,27,251,32,55,32,251,38,61,5,97,4,200,219,244,245,201,
+    124,0,81,77,58,33,34,78,124,0,241,9,251,153,132,29,14,251,153,247,179,249,45,33,29,247,6,83,134,29,251,153,247,28,248,182,1,10,112,13,152,10,247,157,251,69,20,0,255,37,132,29,251,63,
+    252,163,129,29,251,64,80,10,14,251,64,247,214,249,63,34,29,196,6,251,107,105,29,251,64,247,63,248,200,78,29,75,252,186,69,29,14,251,64,170,247,28,21,56,197,83,233,131,95,6,0,1,117,
+    16,156,154,172,5,241,144,207,195,222,26,47,37,47,73,10,43,37,20,0,130,0,96,49,248,200,32,29,75,127,0,240,97,80,10,247,52,251,127,44,29,96,247,33,22,248,156,7,232,199,195,223,217,183,
+    88,72,66,89,92,62,30,89,80,189,6,247,10,202,82,44,52,78,69,251,4,31,49,82,6,135,158,180,137,167,27,247,48,227,235,247,15,232,82,213,44,161,31,201,161,175,197,204,26,245,63,209,251,
+    8,251,17,52,59,251,25,30,252,152,7,14,251,200,127,10,14,251,200,247,75,22,247,135,210,194,68,247,20,182,29,251,20,68,84,210,251,135,28,0,242,8,247,126,248,198,159,10,88,253,98,21,248,
+    62,236,197,42,146,10,251,200,133,10,152,7,18,11,1,9,17,68,164,70,29,107,103,17,49,160,184,5,80,0,241,19,221,40,44,29,86,248,48,248,120,21,131,29,199,248,120,6,14,86,248,14,65,10,247,
+    2,83,35,10,86,247,105,38,10,247,153,10,0,16,90,149,3,32,207,63,21,0,113,189,248,176,82,29,247,64,23,0,65,213,113,10,199,9,0,255,0,47,54,29,247,149,251,59,35,10,86,248,68,126,29,70,
+    17,31,16,240,1,14,86,247,163,248,173,139,29,173,90,29,104,31,247,33,38,91,0,255,39,73,248,193,130,29,247,172,66,35,10,251,12,247,99,22,208,6,247,93,248,120,5,68,6,251,19,251,204,125,
+    104,126,107,130,106,25,130,171,126,172,126,174,251,17,247,204,24,65,6,14,247,28,247,66,22,149,39,50,112,72,10,14,247,28,248,114,127,7,177,251,120,65,29,247,28,247,205,38,10,62,9,0,
+    16,190,252,0,95,251,162,252,196,21,106,0,28,44,72,10,251,39,2,102,0,241,75,33,67,10,251,58,65,29,251,43,230,22,247,27,247,86,247,28,251,86,5,221,6,251,63,247,133,247,64,247,135,5,59,
+    6,251,28,251,86,251,29,247,86,5,58,6,247,64,251,134,251,65,251,134,5,14,251,27,162,251,103,67,29,251,27,247,234,51,29,251,134,56,10,251,27,247,69,248,176,32,29,47,56,10,251,27,247,
+    54,248,196,21,165,21,11,17,53,254,20,97,63,29,251,177,253,151,48,0,240,25,153,67,10,251,73,56,10,251,55,248,40,22,197,251,173,7,247,173,248,6,5,195,252,1,81,247,172,7,251,172,252,7,
+    5,84,7,14,251,55,247,220,217,10,160,247,44,252,176,61,10,251,55,247,70,0,6,97,76,6,247,195,253,42,16,0,29,113,93,9,182,247,75,252,196,61,10,120,248,90,248,120,56,43,242,0,88,10,62,
+    198,247,199,41,29,251,178,89,10,14,129,77,75,8,83,116,29,247,114,77,164,39,48,120,251,191,90,8,241,103,169,198,83,29,67,79,52,10,251,122,233,7,75,29,7,249,12,247,40,21,167,159,159,
+    166,167,119,161,111,112,118,117,111,112,160,119,166,31,14,247,109,77,29,247,111,252,62,207,249,109,71,251,137,251,111,116,29,125,248,113,22,248,62,198,29,251,140,233,7,108,10,247,140,
+    252,62,7,14,247,50,247,208,251,103,21,134,161,161,137,167,27,211,184,172,213,125,10,252,59,251,49,248,59,5,251,105,233,6,75,29,65,47,29,247,55,7,247,66,252,91,78,41,178,96,136,98,27,
+    86,6,14,62,248,27,22,143,0,240,1,6,108,10,247,122,7,173,247,88,159,29,14,56,248,84,22,45,10,113,137,251,110,233,7,196,154,167,0,48,80,52,10,67,0,16,110,108,0,240,3,68,248,68,249,2,
+    159,29,251,141,253,2,21,248,62,247,106,252,62,68,0,242,17,175,146,10,126,247,75,22,248,63,247,119,252,63,208,248,63,235,196,43,247,45,70,251,45,251,119,153,10,7,14,247,57,28,0,131,
+    40,7,247,65,252,93,119,83,132,0,109,85,82,6,134,161,162,179,0,250,255,255,164,90,153,10,6,14,173,247,170,22,197,7,50,173,88,223,223,26,245,221,208,240,239,221,70,33,59,93,55,44,101,
+    30,81,247,95,197,36,7,206,189,176,215,220,26,247,26,35,237,251,33,251,33,33,41,251,27,60,175,63,207,88,30,36,81,6,14,135,247,8,22,207,248,59,247,95,251,204,6,58,172,108,207,162,164,
+    140,143,164,30,195,7,84,140,5,109,140,119,152,182,26,247,197,244,200,252,178,78,236,7,14,216,194,247,250,21,251,115,246,251,40,247,72,247,71,246,247,40,247,115,247,114,251,1,247,42,
+    251,69,251,70,251,1,251,42,251,114,30,210,22,247,79,218,247,11,247,29,247,29,218,251,11,251,79,251,78,60,251,12,251,29,251,29,60,247,12,247,78,30,14,251,164,247,73,249,31,21,253,31,
+    208,249,96,251,107,74,7,14,95,248,153,22,206,251,253,7,247,59,247,38,5,247,35,140,29,238,27,234,153,29,101,247,145,248,20,21,247,20,209,78,41,35,70,71,32,38,75,201,242,31,68,139,10,
+    43,150,10,252,70,176,29,160,94,10,116,247,182,141,10,83,87,121,107,99,31,193,247,117,183,29,196,121,5,182,178,137,29,136,247,28,248,111,21,72,47,116,81,56,26,251,35,247,5,251,3,247,
+    36,247,35,247,3,246,247,39,247,32,40,247,1,251,41,106,108,132,122,105,30,247,80,247,141,5,55,6,251,88,252,111,21,247,1,214,217,247,1,245,215,61,251,1,251,1,63,60,33,251,1,64,218,247,
+    1,30,14,37,148,249,96,21,73,248,50,7,251,175,253,30,5,213,6,247,174,249,30,5,205,7,14,145,190,247,87,21,251,15,242,55,247,44,247,44,242,223,247,14,229,84,211,56,165,30,210,166,179,
+    198,214,26,247,3,48,214,251,28,251,29,45,64,251,2,65,180,80,211,110,30,54,177,29,237,236,202,91,62,60,76,88,42,41,75,192,218,30,117,251,233,21,227,211,196,247,3,247,5,211,82,51,50,
+    65,80,251,1,251,3,65,198,228,30,14,136,248,103,247,134,21,207,230,161,197,222,26,247,36,251,5,247,3,251,36,251,35,143,10,170,145,157,172,30,251,80,251,142,147,10,251,1,33,63,217,247,
+    0,247,1,215,218,245,247,1,215,60,251,1,30,14,193,187,247,249,21,251,116,244,251,39,247,69,247,69,244,247,39,247,116,247,115,33,247,41,251,68,251,68,33,251,41,251,115,30,210,22,247,
+    78,214,247,12,247,28,247,28,214,251,12,251,78,251,77,64,251,12,251,28,251,28,64,247,12,247,77,30,14,193,247,209,204,21,251,92,74,248,92,204,251,78,249,31,251,150,74,247,80,6,14,193,
+    248,203,22,206,251,252,7,247,58,247,38,5,247,36,140,29,237,27,235,153,29,193,247,188,248,20,21,247,19,210,78,41,35,69,71,33,38,75,201,242,31,67,139,10,44,150,10,252,71,176,29,193,94,
+    10,193,247,214,141,10,84,86,121,108,99,31,193,247,116,183,29,195,121,5,182,179,137,29,193,247,57,248,111,21,71,155,1,24,36,155,1,160,105,108,132,121,105,30,247,81,247,142,155,1,17,
+    89,155,1,241,2,215,217,247,0,246,214,61,251,1,251,1,64,60,32,251,0,63,155,1,36,193,226,155,1,130,176,253,30,5,214,6,247,173,155,1,209,193,215,247,87,21,251,15,241,55,247,45,247,43,
+    155,1,225,85,211,56,165,30,209,166,180,198,214,26,247,3,47,155,1,243,13,46,64,251,2,65,179,80,211,110,30,55,177,29,236,237,201,91,62,60,77,88,41,42,75,192,218,30,116,155,1,241,6,4,
+    247,4,211,82,51,50,66,80,251,2,251,2,64,198,228,30,14,193,248,131,155,1,24,162,155,1,241,3,36,143,10,171,146,157,173,30,251,82,251,143,147,10,251,0,32,64,155,1,82,214,218,246,247,0,
+    155,1,241,160,251,82,170,247,7,21,251,26,205,50,247,3,247,1,207,228,247,26,247,27,163,10,251,27,30,194,22,247,1,183,205,217,216,183,73,251,1,32,95,73,62,61,95,205,246,30,14,252,24,
+    247,8,247,174,148,10,251,154,247,210,39,118,29,251,152,247,34,247,16,111,29,251,122,247,249,126,21,189,87,247,188,68,7,251,105,251,187,5,88,247,123,52,192,226,7,251,113,189,21,247,
+    60,247,127,5,251,127,7,14,251,145,161,179,85,10,251,125,225,247,86,114,29,251,176,247,199,247,174,163,29,251,130,167,156,100,29,251,125,247,180,180,115,29,251,151,168,247,60,149,10,
+    211,47,52,83,70,181,29,89,61,62,105,89,78,80,105,188,217,30,14,252,48,238,247,181,21,251,181,8,37,243,21,93,7,14,251,215,247,153,167,29,94,182,69,70,91,156,10,164,113,98,103,121,110,
+    91,99,30,251,1,51,5,104,7,14,251,222,160,245,182,41,241,225,181,207,198,98,177,83,145,30,229,222,92,29,53,5,106,166,7,194,169,113,95,102,114,116,98,98,114,164,180,31,14,251,196,247,
+    79,105,10,251,207,247,36,134,21,211,189,188,208,202,96,190,133,29,96,111,110,96,97,111,165,182,31,88,6,69,191,94,207,30,14,251,190,210,247,123,21,107,96,129,111,97,26,70,194,85,210,
+    209,193,192,209,207,89,188,69,127,129,137,135,128,30,220,245,5,80,6,70,251,110,21,182,170,170,184,182,170,108,96,94,109,108,95,94,108,170,184,30,14,251,241,247,87,247,180,158,29,14,
+    251,202,166,230,21,80,189,102,210,211,188,144,10,170,151,158,81,10,251,190,247,129,243,21,171,182,149,166,182,26,208,84,193,68,69,85,86,69,71,190,90,208,151,149,141,143,150,30,58,33,
+    5,198,6,208,247,110,21,96,108,108,94,96,108,170,182,183,169,171,183,184,170,108,94,30,14,251,151,168,248,185,149,10,212,47,52,83,69,181,29,90,60,63,105,88,78,80,105,189,216,30,14,252,
+    48,146,29,25,1,129,248,17,21,185,251,40,7,195,224,36,243,10,176,189,26,206,94,183,69,70,91,93,73,30,189,6,180,165,164,179,179,164,114,97,103,121,111,48,1,17,103,48,1,35,248,123,49,
+    1,15,231,42,11,1,49,1,240,21,248,85,21,71,187,207,181,184,97,247,114,79,7,251,52,251,116,5,96,7,194,184,21,247,9,247,55,5,251,55,7,14,251,207,82,10,52,1,32,248,248,52,1,37,112,96,52,
+    1,148,208,89,187,69,127,128,137,135,129,52,1,240,3,109,21,182,170,169,184,182,170,109,96,94,109,107,95,94,108,170,185,52,1,17,149,48,1,242,9,248,109,21,80,189,101,210,211,188,177,198,
+    179,115,173,100,152,30,169,150,158,168,173,26,194,11,38,16,85,11,38,241,35,127,30,100,126,115,106,98,26,198,247,48,21,170,165,157,175,175,165,121,108,110,115,119,101,99,117,159,168,
+    30,131,251,42,69,10,102,109,118,98,99,109,159,177,30,14,251,190,247,129,248,122,113,1,80,181,26,208,84,194,113,1,112,68,71,190,91,208,151,150,58,16,43,58,32,113,1,18,184,113,1,128,
+    93,30,14,251,83,170,248,174,34,3,17,49,34,3,144,229,247,26,247,26,163,10,251,26,34,3,19,0,34,3,50,0,251,0,35,3,34,247,0,36,3,34,249,92,36,3,34,247,222,37,3,175,248,190,111,29,251,126,
+    247,249,248,53,38,3,16,33,248,106,39,3,34,249,4,39,3,33,249,92,39,3,34,248,83,40,3,247,17,248,107,115,29,252,125,247,212,249,90,50,29,14,167,79,29,248,154,167,29,93,182,70,69,92,156,
+    10,163,113,98,103,122,9,3,242,26,136,79,29,248,30,126,10,193,184,21,247,10,247,57,5,251,57,7,14,178,110,29,248,30,105,10,180,79,29,247,176,230,21,80,188,102,211,78,10,222,110,13,0,
+    241,9,189,102,210,210,189,144,10,169,151,159,81,10,237,82,10,248,103,247,226,21,75,6,252,96,163,50,1,47,0,1,194,2,130,166,10,100,151,30,169,151,158,153,39,19,78,153,39,224,168,126,
+    30,101,126,114,165,29,116,119,100,99,117,160,128,1,245,5,43,69,10,103,109,118,98,100,108,159,176,30,14,163,149,29,248,161,180,50,105,0,241,18,78,10,251,95,231,248,205,21,168,128,164,
+    133,169,135,121,122,121,121,118,108,102,85,24,178,112,178,192,161,170,150,161,146,162,72,39,245,94,160,109,177,86,24,178,166,102,193,117,170,125,156,119,157,25,162,142,166,145,173,
+    151,203,161,24,120,184,78,117,104,127,118,127,117,126,25,144,163,143,165,175,26,206,92,72,7,103,142,114,145,114,30,117,153,117,150,103,151,78,160,24,122,95,5,14,247,164,247,221,248,
+    209,21,174,127,166,134,162,136,121,122,122,120,117,109,101,85,24,179,111,177,193,160,168,151,162,147,163,25,147,117,151,115,161,109,176,85,24,178,167,102,0,240,46,163,142,165,144,173,
+    151,202,162,24,122,183,78,118,103,126,122,130,113,123,25,145,164,141,164,176,26,205,92,73,7,102,143,115,144,113,30,118,153,117,151,104,151,79,159,24,121,96,5,251,66,252,39,21,175,126,
+    165,136,161,136,121,121,99,0,240,11,102,85,24,177,112,179,192,160,169,150,162,146,174,29,103,193,116,170,126,153,118,161,25,163,142,166,88,0,243,10,161,24,121,184,78,118,104,126,117,
+    128,118,157,10,92,142,10,78,160,24,121,94,5,248,174,116,68,0,114,120,121,122,120,118,109,101,13,1,0,68,0,48,147,174,29,2,1,3,68,0,0,156,0,16,203,68,0,192,77,118,104,126,119,128,117,
+    157,10,91,142,10,137,0,253,61,95,5,14,251,149,208,249,96,21,70,6,247,172,253,96,5,208,6,14,251,223,247,30,247,63,21,185,179,178,185,187,100,178,92,91,100,100,91,93,179,100,186,31,14,
+    251,122,247,81,247,19,21,213,201,202,212,213,77,202,65,63,77,76,65,65,202,77,214,31,14,251,216,121,10,252,19,4,25,42,241,5,14,251,236,247,86,173,21,189,108,168,103,104,115,114,104,
+    105,163,119,167,151,45,40,242,21,111,113,113,103,133,30,102,7,201,148,187,193,201,26,14,225,152,29,247,107,160,10,104,111,110,105,106,167,111,174,31,247,106,160,10,105,13,0,244,29,
+    173,31,14,251,227,247,52,247,107,21,147,210,144,247,23,247,22,26,247,61,64,251,61,7,251,21,143,251,24,147,68,30,165,251,121,21,172,168,168,173,173,110,167,106,94,40,1,51,0,100,28,249,
+    110,21,197,29,27,0,240,32,31,113,251,120,21,131,67,135,251,23,251,22,26,251,61,214,247,61,7,247,23,134,247,23,131,210,30,14,208,199,247,168,21,126,74,5,244,74,10,208,6,180,247,103,
+    5,247,68,10,0,16,181,10,0,241,3,3,6,151,204,5,251,3,6,172,247,56,5,244,6,152,204,5,33,24,0,129,70,6,97,251,103,5,251,67,47,0,241,9,71,74,10,251,14,6,127,74,5,247,14,6,106,251,56,5,
+    208,22,171,247,56,5,247,68,13,0,255,166,14,251,236,152,29,14,48,247,157,247,56,21,165,7,192,174,172,195,179,30,198,183,205,190,242,26,247,14,54,232,251,29,251,18,40,42,251,17,30,209,
+    6,226,207,208,226,231,198,73,54,66,90,98,87,99,30,83,97,86,95,57,26,113,7,176,251,70,21,173,167,168,173,173,111,167,105,197,29,31,14,48,247,170,249,110,21,106,110,110,105,105,168,111,
+    172,174,168,167,173,173,110,168,104,31,111,251,70,21,112,7,86,104,107,84,99,30,79,95,73,88,35,26,251,14,224,47,247,29,247,18,238,235,247,18,30,69,6,51,71,71,53,46,80,205,224,212,189,
+    179,191,179,30,195,182,191,183,220,26,166,7,14,251,181,118,10,247,52,247,91,155,29,14,252,66,118,10,14,251,216,121,10,202,251,230,178,1,15,241,255,84,251,149,207,22,247,173,249,96,
+    5,69,6,251,171,253,96,5,14,51,199,61,21,248,34,198,252,34,6,14,251,206,184,247,223,21,206,159,109,99,31,251,118,7,83,176,101,201,30,195,195,89,6,113,123,157,165,31,247,116,7,188,121,
+    170,92,155,30,186,153,157,170,188,26,247,116,7,165,155,157,165,30,189,195,83,6,77,102,101,83,31,251,118,7,99,119,110,72,30,14,251,206,200,80,21,200,177,177,195,31,247,118,7,179,159,
+    169,206,30,198,7,72,119,168,179,31,247,118,7,195,101,177,78,30,83,83,188,6,166,155,121,113,31,251,116,7,90,156,108,186,125,30,92,123,122,108,90,26,251,116,7,113,123,121,112,30,90,83,
+    6,14,251,243,247,7,136,21,249,106,247,27,195,251,90,253,218,247,90,195,7,14,251,243,144,80,21,247,90,249,218,251,90,83,247,27,253,106,251,27,6,14,251,244,247,146,251,49,21,60,247,2,
+    87,247,63,247,68,26,247,72,193,247,60,216,247,0,30,76,6,53,251,11,86,251,64,251,57,26,251,64,194,251,62,223,251,7,30,14,251,244,202,251,49,21,223,247,7,194,247,62,247,64,26,247,57,
+    87,247,64,52,247,11,30,76,6,216,251,0,194,251,60,251,72,26,251,68,86,251,63,60,251,2,30,14,248,168,205,247,124,21,250,130,200,254,130,6,14,247,213,205,247,124,21,249,175,200,253,175,
+    6,14,251,80,203,247,124,21,247,182,201,251,182,6,14,127,124,10,248,69,251,134,21,220,6,251,104,247,134,247,104,95,29,16,43,240,32,14,127,117,10,247,194,151,29,14,251,125,124,10,14,
+    251,125,117,10,14,251,91,98,10,247,54,22,188,109,167,104,104,115,114,106,104,192,29,111,113,113,104,133,151,10,251,91,95,25,0,240,22,174,116,158,113,127,130,137,135,133,30,167,165,
+    164,174,146,30,176,7,77,129,92,86,77,26,89,170,111,173,174,163,164,172,30,14,251,91,97,41,0,48,188,109,168,66,0,240,4,105,105,192,29,110,113,114,104,132,151,10,251,253,95,10,14,251,
+    253,97,5,0,241,255,255,170,98,10,14,251,221,14,83,247,147,138,21,201,246,6,240,149,207,201,159,230,8,69,6,77,119,91,101,59,27,40,68,214,247,5,247,8,208,213,237,214,195,104,72,157,31,
+    210,6,121,229,71,201,37,150,8,247,0,77,251,0,7,251,17,126,57,39,251,31,26,251,30,225,43,247,13,124,30,14,161,248,165,234,21,186,186,61,216,5,167,176,155,186,189,26,190,122,187,111,
+    177,30,218,216,92,186,61,62,5,167,101,91,156,87,27,88,92,122,111,101,31,61,216,92,92,218,62,5,111,101,122,91,88,26,89,156,92,166,102,30,61,62,186,92,217,216,5,110,177,186,122,190,27,
+    191,187,156,168,177,31,165,247,73,21,51,65,66,49,51,65,212,227,229,212,213,228,230,212,65,49,30,14,96,247,146,40,21,192,227,6,247,23,149,222,216,247,7,26,235,82,202,251,5,167,30,95,
+    150,5,247,167,7,216,131,185,95,146,64,8,211,6,129,247,5,63,209,251,8,147,8,226,86,52,7,251,19,129,56,62,251,3,26,41,198,76,247,4,112,30,178,129,5,251,170,7,53,146,84,186,135,209,8,
+    65,6,147,251,2,224,67,247,18,132,8,113,248,55,21,63,158,102,180,202,26,212,193,189,224,148,30,251,153,7,221,49,21,216,121,176,97,74,26,65,84,89,51,130,30,247,157,7,14,188,248,100,127,
+    21,184,188,146,151,181,31,208,7,127,102,89,130,94,27,251,37,251,0,213,247,22,104,31,247,193,196,251,203,6,138,153,138,153,153,26,155,140,154,140,153,30,247,203,196,251,192,6,247,19,
+    175,244,212,247,38,27,180,192,132,127,175,31,207,7,151,105,88,146,94,27,251,77,251,28,37,251,58,100,31,59,82,210,6,138,124,138,124,124,26,125,140,125,140,125,30,68,82,219,6,251,63,
+    177,247,31,39,247,71,27,14,90,212,248,38,21,74,247,62,7,90,251,239,5,108,134,116,120,112,27,42,73,235,6,209,185,177,212,149,31,189,247,244,5,247,75,204,251,65,6,167,247,91,5,174,144,
+    159,156,169,27,230,205,55,6,62,93,97,65,129,31,110,251,93,5,14,142,247,251,22,247,30,208,214,247,40,31,70,6,251,0,99,90,36,30,251,114,6,197,163,176,206,209,26,177,132,174,129,171,30,
+    247,119,198,251,140,6,122,183,124,180,185,26,227,197,193,233,229,195,93,55,147,30,213,6,247,14,128,51,212,251,19,27,251,27,49,54,251,14,93,153,96,154,97,31,61,80,239,6,150,105,148,
+    105,102,26,62,89,69,64,125,30,73,7,14,126,247,133,247,236,21,251,49,82,247,72,66,251,72,83,247,72,251,50,207,247,50,247,71,195,251,71,212,247,71,196,251,48,6,247,110,248,8,5,59,6,251,
+    87,251,240,251,89,247,240,5,58,6,14,193,219,248,4,21,77,247,111,251,112,201,247,112,247,111,201,251,111,247,111,77,251,111,7,14,193,219,248,4,21,61,29,14,193,247,41,248,198,21,95,95,
+    247,73,251,73,251,74,251,74,183,95,247,74,247,74,247,74,251,74,183,183,251,10,0,240,14,247,73,95,183,251,74,251,73,5,14,193,247,222,248,72,128,10,251,142,36,21,61,29,251,142,251,179,
+    128,10,97,0,241,23,66,21,61,29,252,136,251,98,21,61,29,14,193,247,37,158,21,208,6,217,247,35,5,247,180,201,251,147,6,218,247,36,5,247,68,201,251,35,20,0,240,34,70,6,61,251,35,5,251,
+    180,77,247,147,6,60,251,36,5,251,68,77,247,35,6,14,193,248,216,247,102,21,209,7,252,136,247,71,5,70,7,248,59,251,37,252,59,251,38,5,71,7,27,0,240,6,238,21,252,59,247,38,248,59,247,
+    37,5,208,7,252,136,251,71,5,69,7,248,7,0,0,29,0,64,247,182,21,210,56,0,18,69,56,0,161,35,252,59,251,36,5,71,7,87,4,113,59,1,34,0,16,74,64,0,82,36,248,59,247,35,64,0,48,69,5,68,64,0,
+    208,68,5,252,136,251,6,21,248,136,201,252,136,6,200,0,245,10,42,21,78,247,111,251,80,201,247,80,247,111,200,251,111,247,79,77,251,79,7,251,111,252,42,36,0,240,32,248,158,248,96,21,
+    76,136,10,201,68,10,199,230,31,81,251,75,21,77,136,119,111,94,60,58,236,49,27,63,91,79,51,31,197,6,200,68,10,200,229,31,14,193,248,158,248,4,43,0,0,16,0,16,230,16,0,240,61,183,247,
+    229,21,252,108,77,248,41,251,87,206,6,14,247,87,248,35,127,21,247,90,247,43,247,47,247,107,225,115,215,98,200,31,230,222,103,178,51,59,5,206,76,51,178,39,27,251,90,251,43,251,47,251,
+    108,53,163,63,181,78,31,50,58,175,100,225,217,5,73,201,227,100,239,27,251,170,222,32,240,228,71,247,11,247,17,247,51,219,209,107,85,189,30,252,67,252,30,5,109,188,122,199,206,26,247,
+    170,251,196,21,59,69,171,193,90,31,248,67,248,30,5,169,90,156,80,71,26,251,70,251,11,251,18,251,52,30,14,247,145,195,247,174,21,35,214,66,243,220,196,181,225,196,30,53,195,196,97,220,
+    27,243,214,212,243,242,65,213,34,58,82,96,53,83,31,225,82,82,182,58,27,34,65,65,36,31,206,22,208,184,184,210,195,188,102,62,181,30,61,97,90,102,83,27,69,93,184,209,31,247,242,22,216,
+    181,188,176,195,27,210,184,94,70,69,93,94,69,83,90,176,217,97,31,14,251,127,245,125,21,204,188,189,206,31,248,150,7,170,159,159,166,30,213,201,63,6,74,90,90,72,31,252,150,7,108,119,
+    119,112,30,65,76,6,14,197,249,2,22,199,7,251,140,249,36,5,53,6,251,138,253,33,5,76,7,247,172,249,0,21,141,144,144,152,140,145,141,133,142,129,142,131,247,104,252,196,24,252,73,6,14,
+    206,247,51,22,249,30,247,246,9,50,250,87,96,252,134,60,29,66,248,127,22,205,252,22,7,247,120,247,182,251,120,247,186,5,248,22,205,252,101,64,6,247,114,251,175,251,114,251,175,5,64,
+    7,14,227,247,90,22,205,6,247,143,249,32,5,247,35,204,251,83,6,251,128,253,10,251,50,248,32,5,66,6,14,86,247,27,251,103,21,135,247,144,5,108,163,182,117,191,27,214,199,177,195,166,31,
+    148,57,5,199,248,120,70,251,149,6,124,53,240,43,253,76,7,14,155,196,247,137,21,251,43,247,2,33,247,31,247,41,247,2,247,0,247,71,247,70,60,247,29,251,52,247,28,30,50,6,247,21,251,3,
+    211,59,180,251,11,8,193,97,75,168,72,27,251,29,251,4,251,0,150,24,240,46,138,21,247,3,217,221,247,1,245,214,60,251,2,251,8,61,57,251,0,33,63,219,247,6,30,14,247,195,77,10,79,132,10,
+    14,249,68,77,10,248,21,22,242,65,214,37,37,66,64,36,36,212,65,241,241,213,213,242,30,252,81,132,24,0,112,69,91,90,71,72,91,188,75,50,32,207,208,75,50,242,137,14,247,32,241,248,30,21,
+    247,134,247,128,5,253,10,198,249,10,7,247,133,251,128,181,182,251,205,247,199,251,205,251,199,5,14,247,123,247,231,249,37,21,247,228,6,252,251,252,252,181,98,248,251,248,251,5,251,
+    228,199,248,73,252,74,7,14,247,198,248,137,248,199,21,247,129,251,131,5,253,58,81,249,58,6,251,129,251,131,180,98,247,202,247,201,251,202,247,201,5,14,247,121,249,96,248,76,21,138,
+    251,229,252,250,248,249,98,98,248,250,252,250,5,251,229,80,248,74,248,73,6,14,247,24,249,17,247,140,21,251,130,251,130,5,249,92,80,253,92,7,251,130,247,130,97,97,62,0,242,15,247,202,
+    5,14,247,124,248,134,197,21,251,229,140,248,253,248,252,97,181,252,252,252,253,5,247,229,79,252,74,248,127,0,48,48,126,21,51,0,240,204,5,249,58,198,253,58,6,247,130,247,131,97,180,
+    251,202,251,202,247,202,251,201,5,14,247,117,199,249,96,21,252,74,198,247,229,7,248,247,252,251,180,180,252,246,248,251,247,229,140,5,198,7,14,248,84,199,247,148,21,247,110,251,112,
+    5,225,7,37,243,247,122,140,5,138,7,248,107,140,40,37,5,50,7,247,108,247,113,251,109,247,111,5,52,7,240,37,251,120,140,5,251,138,138,6,251,119,138,239,241,5,227,7,14,92,247,171,251,
+    55,21,247,112,247,109,5,51,6,37,39,5,249,81,7,241,39,5,227,6,251,112,247,108,251,111,251,108,5,225,6,242,239,138,251,120,5,251,137,7,140,251,120,36,239,5,53,6,14,247,186,58,10,14,247,
+    186,58,10,203,4,251,72,251,38,247,38,247,72,247,72,247,38,247,39,247,72,247,71,247,40,251,40,251,71,251,72,251,39,251,38,251,72,31,14,137,248,180,247,247,21,251,99,247,247,100,24,241,
+    18,98,251,247,247,98,251,247,5,210,6,247,26,247,247,21,251,61,251,185,251,61,247,185,247,61,247,185,5,14,247,116,190,29,5,0,241,38,249,30,79,21,252,226,252,226,248,226,7,14,247,252,
+    199,22,249,226,6,252,59,249,90,5,14,247,254,248,120,249,92,21,252,60,253,91,5,249,228,6,253,121,198,21,247,209,248,167,247,208,252,167,5,151,0,240,255,255,79,251,218,248,26,21,247,
+    63,247,23,247,33,247,59,153,30,251,179,7,251,160,251,67,5,120,181,128,185,187,26,249,33,22,91,128,93,121,98,30,251,160,247,66,5,247,179,7,247,57,123,247,24,251,33,251,61,26,252,231,
+    251,78,21,247,132,247,47,5,251,186,7,40,148,52,192,85,216,8,247,190,247,47,21,247,131,251,46,85,62,53,85,40,130,25,14,247,27,247,139,146,21,248,19,248,96,87,181,251,226,252,39,251,
+    59,247,72,93,92,5,14,247,193,247,148,247,112,21,58,198,89,234,215,201,173,196,167,30,79,145,180,108,208,27,240,211,240,247,33,247,124,251,64,247,58,251,131,251,125,251,71,251,71,251,
+    125,251,128,247,70,251,71,247,126,235,226,170,196,211,31,111,180,5,87,75,60,112,55,27,251,95,251,47,247,50,247,99,247,96,247,48,247,50,247,94,247,100,247,41,251,37,251,95,251,8,93,
+    60,71,98,118,160,178,31,247,83,7,247,0,72,200,251,5,251,3,66,80,51,30,199,6,198,184,174,215,219,178,101,62,30,124,7,251,39,128,5,32,130,78,85,60,26,203,140,21,194,180,170,217,146,30,
+    247,24,149,5,117,7,39,83,79,48,72,102,167,190,30,14,215,248,223,22,221,6,32,247,15,5,174,194,158,208,219,26,72,6,79,128,87,119,97,30,251,87,247,117,5,234,203,176,194,210,26,223,76,
+    195,47,42,74,79,53,86,165,96,204,63,30,251,21,69,85,72,48,26,251,10,237,62,247,43,233,217,170,195,195,30,251,129,248,3,21,74,214,123,169,175,26,193,175,173,197,195,173,107,87,83,107,
+    93,69,95,30,251,62,251,146,21,212,179,189,247,0,199,30,247,110,251,141,5,91,96,77,114,60,27,251,6,71,191,226,31,14,105,168,248,152,21,251,20,222,64,244,30,194,252,15,203,249,162,251,
+    11,6,34,56,65,251,18,31,248,72,252,220,21,249,164,93,253,164,7,14,251,32,248,63,247,254,21,208,101,183,54,157,30,41,160,5,86,151,112,167,176,26,192,73,10,82,142,30,205,6,229,136,73,
+    196,37,27,35,69,83,57,87,165,99,194,117,31,75,119,101,91,85,26,71,175,95,225,120,30,238,118,5,192,127,166,111,102,26,86,101,110,70,75,99,173,195,137,30,73,6,49,141,205,83,242,27,242,
+    210,194,221,191,112,179,84,161,31,204,159,177,187,193,26,72,136,21,84,95,105,56,56,94,173,194,194,184,173,222,222,183,105,84,30,14,247,103,248,44,125,21,247,101,247,52,247,54,247,102,
+    247,101,251,53,247,54,251,100,251,99,251,53,251,54,251,101,251,102,247,52,251,54,247,100,31,188,237,2,240,255,18,27,247,31,247,76,247,75,247,28,247,31,247,71,247,72,247,28,251,30,251,
+    76,251,76,251,27,251,31,251,73,31,251,75,247,213,21,251,10,216,57,247,2,225,208,190,217,157,30,79,6,91,123,99,112,82,27,63,87,198,227,226,193,200,218,194,176,113,89,153,31,200,6,218,
+    123,74,190,52,27,251,5,61,56,251,12,31,14,251,18,86,10,96,198,21,223,191,7,183,55,5,177,6,89,231,5,169,149,155,163,169,26,181,108,164,90,30,55,251,115,6,247,20,247,46,21,114,122,125,
+    111,30,90,215,188,6,167,156,127,114,31,14,251,18,86,10,108,194,21,209,188,7,189,170,168,187,186,107,167,90,31,56,251,114,6,173,247,82,21,187,6,168,156,125,109,109,122,125,110,31,91,
+    6,14,169,247,12,249,59,21,251,133,179,247,133,233,176,251,120,102,7,247,194,251,133,21,247,84,7,226,251,84,5,176,6,225,247,87,5,251,87,177,247,170,101,7,35,251,128,33,247,128,5,101,
+    251,170,6,14,251,235,247,141,248,247,21,207,88,189,73,72,88,89,71,72,190,89,206,205,190,189,206,30,90,22,98,111,110,99,98,111,168,180,180,167,169,180,179,167,110,97,30,14,251,187,247,
+    19,54,21,196,250,2,82,6,12,0,240,3,76,249,173,21,82,251,252,196,6,82,252,154,21,196,247,252,82,6,80,29,243,5,16,247,162,21,189,247,190,238,187,40,239,89,39,40,91,238,6,14,251,199,21,
+    0,240,12,16,239,187,39,242,238,187,40,247,15,89,251,15,40,91,238,36,41,91,237,6,14,247,65,199,247,245,68,42,251,255,113,28,251,39,247,96,247,17,243,200,237,188,30,101,153,5,60,97,46,
+    85,36,27,33,55,182,213,87,31,247,72,248,194,7,140,154,139,158,158,26,247,98,251,28,247,15,251,85,251,84,251,30,251,38,251,103,30,239,247,85,21,213,188,220,189,239,27,234,223,101,71,
+    189,31,251,92,252,95,7,14,249,13,28,4,166,248,132,21,247,25,35,240,251,27,251,27,35,37,251,24,251,24,245,33,247,25,247,27,243,242,247,27,30,254,155,252,132,21,48,10,250,160,248,131,
+    21,39,65,65,41,44,62,216,236,237,213,212,237,238,212,67,40,30,178,252,7,21,201,252,58,77,7,14,251,13,247,31,248,36,21,243,247,142,242,251,142,5,203,6,251,25,247,208,5,71,6,251,25,251,
+    208,5,14,252,68,247,17,249,63,21,171,142,118,154,119,27,119,117,124,107,142,31,157,251,73,5,181,6,14,135,247,194,247,104,21,247,39,247,5,247,6,247,36,247,37,251,6,247,6,251,38,251,
+    39,251,7,251,5,251,38,251,37,247,7,251,5,247,39,31,178,4,251,19,46,232,247,18,247,18,232,233,247,19,247,17,234,44,251,17,251,16,44,44,251,17,31,91,226,21,238,202,7,189,40,5,185,6,82,
+    247,1,5,172,154,157,164,175,26,187,101,172,83,30,40,251,158,6,247,42,247,75,21,111,118,121,107,30,82,229,196,6,172,159,123,111,31,14,251,130,119,29,252,44,147,29,252,24,135,10,252,
+    22,168,29,251,162,110,10,251,179,241,249,146,32,29,14,251,179,122,10,251,155,111,10,251,204,120,29,251,127,92,10,251,146,199,249,201,40,10,14,252,58,247,34,249,188,21,164,119,157,114,
+    91,36,241,60,96,141,95,103,77,26,99,160,116,170,165,160,160,167,30,14,252,58,247,30,57,21,179,119,161,108,112,119,119,111,114,159,121,163,145,144,139,141,144,30,114,136,122,124,110,
+    27,110,7,183,137,182,174,202,26,14,252,13,112,29,32,248,95,248,170,21,76,6,251,248,252,211,5,203,6,14,141,0,48,155,111,10,133,0,0,32,0,5,149,0,7,177,0,1,173,0,4,149,0,100,51,242,22,
+    103,10,14,172,0,251,48,252,30,239,247,169,21,248,177,246,186,251,51,253,15,247,51,186,7,14,252,30,247,4,249,198,21,252,177,32,92,247,51,249,15,251,51,92,7,14,28,4,109,239,22,247,108,
+    249,80,251,108,81,29,247,152,253,80,21,247,109,249,80,251,109,13,0,240,3,252,89,4,247,108,247,97,251,108,6,14,247,43,248,66,250,15,129,162,47,161,252,79,252,173,66,29,247,43,247,197,
+    100,46,48,92,252,53,14,0,226,104,29,248,29,252,89,47,10,247,43,247,255,249,171,207,60,241,29,111,40,29,251,212,252,73,66,29,247,55,249,33,251,24,21,166,198,251,70,220,5,247,27,187,
+    227,247,23,247,63,26,72,29,30,142,141,139,142,27,247,151,248,6,21,247,27,240,7,15,251,50,114,10,30,14,211,22,89,29,82,251,104,21,132,164,153,137,165,27,224,231,45,240,27,248,193,70,
+    252,189,75,10,124,127,141,144,119,30,14,120,248,24,249,49,50,10,247,34,73,35,29,120,247,240,166,29,187,91,214,214,186,187,216,30,189,251,78,18,0,145,116,138,10,63,251,13,5,247,184,
+    32,0,99,101,248,206,21,145,10,19,41,32,145,10,18,73,32,238,53,39,0,241,1,199,248,186,21,81,247,11,5,66,6,214,251,11,5,247,95,46,0,255,3,58,248,241,71,10,247,180,251,68,35,29,120,248,
+    102,126,29,78,7,223,62,12,35,129,247,181,73,67,165,10,76,10,175,73,164,120,247,174,248,183,21,200,186,186,200,181,64,114,76,184,94,202,31,186,4,157,51,82,163,173,172,163,114,157,51,
+    64,247,64,251,2,106,0,244,30,6,249,176,21,68,6,81,251,6,5,193,6,247,51,251,90,21,133,38,118,189,102,172,96,155,25,158,159,150,165,169,187,29,149,113,155,121,30,46,106,83,48,251,9,26,
+    232,34,0,98,63,242,10,30,146,40,5,202,248,120,6,251,138,152,21,64,10,247,65,251,147,88,10,120,247,84,248,202,185,62,22,177,175,61,240,21,98,64,29,91,110,99,72,143,31,247,204,57,35,
+    29,62,112,10,251,226,251,245,41,29,62,119,10,48,251,125,41,29,62,247,208,248,218,223,2,240,9,115,133,134,139,137,134,30,141,163,157,156,168,138,8,168,7,95,141,95,104,76,26,99,160,58,
+    39,240,47,159,167,30,251,149,251,167,41,29,62,150,29,251,103,251,145,41,29,251,197,247,165,200,21,179,29,247,9,219,194,59,247,20,66,10,251,20,78,84,200,251,14,7,57,179,90,217,96,29,
+    30,14,251,178,247,109,178,29,195,253,35,91,10,12,0,231,31,62,10,155,174,5,143,6,96,29,31,129,198,5,69,61,241,1,247,192,66,10,251,197,7,73,165,94,190,124,30,112,82,142,203,31,240,59,
+    97,38,47,10,124,247,204,178,29,14,251,10,211,248,244,21,90,247,181,188,7,14,252,10,159,247,209,21,247,85,231,5,195,7,251,85,46,5,14,251,163,159,247,219,21,247,187,201,251,187,6,14,
+    246,146,248,180,21,249,79,203,253,79,6,14,251,121,159,247,194,21,247,229,247,53,162,48,242,14,229,251,53,5,14,32,248,195,249,96,21,68,6,252,184,253,96,5,211,6,14,252,44,238,249,223,
+    94,29,168,87,39,240,32,110,112,162,116,168,31,14,126,152,249,242,155,251,54,153,251,138,153,6,251,116,152,7,198,10,206,11,198,143,143,12,12,206,142,141,12,13,247,105,20,248,242,21,
+    177,19,0,135,61,58,0,185,89,254,252,57,0,65,0,80,0,85,0,90,0,97,0,105,0,131,0,146,0,150,0,154,0,176,0,180,0,187,0,206,0,213,0,222,0,227,0,233,0,239,1,18,1,22,1,26,1,30,1,68,1,71,1,
+    75,1,100,1,124,1,131,1,145,1,152,1,166,1,171,1,183,1,193,1,202,1,210,1,217,1,224,1,230,1,236,1,242,2,27,2,69,2,108,2,114,2,136,2,167,2,202,3,4,3,59,3,109,3,115,3,132,3,138,3,144,3,
+    162,3,185,3,218,4,0,4,39,4,44,4,82,4,119,4,156,4,176,4,188,4,224,4,244,5,21,5,35,5,40,5,66,5,88,5,117,5,142,5,152,5,159,5,182,5,201,5,212,5,235,5,240,5,247,5,254,6,21,6,44,6,51,6,57,
+    6,73,6,85,6,105,6,109,6,128,6,147,6,152,6,167,6,178,6,188,6,196,6,203,6,220,6,231,6,248,7,8,7,24,7,39,7,54,7,69,7,75,7,89,7,101,7,114,7,125,7,137,7,149,7,159,7,170,7,181,7,192,7,203,
+    7,214,7,224,7,234,7,244,7,248,8,2,8,11,8,20,8,29,8,35,8,41,171,29,70,44,64,21,247,6,214,170,62,64,83,10,21,72,109,40,136,33,247,45,247,109,30,65,22,244,3,4,7,36,24,21,56,52,32,60,29,
+    144,52,99,11,248,176,32,29,11,225,50,131,21,247,124,194,251,124,6,11,165,38,241,4,91,29,247,40,35,246,251,34,251,34,35,32,251,40,30,209,140,116,10,53,53,255,3,14,5,77,6,82,51,81,227,
+    5,11,251,11,5,11,251,190,41,10,44,54,3,240,22,252,157,38,29,109,10,183,137,182,48,29,248,232,7,248,31,252,232,5,210,249,96,68,252,232,6,196,29,6,11,247,51,249,96,154,10,11,113,64,162,
+    43,10,195,6,11,21,81,161,10,11,13,74,1,109,47,34,11,21,115,48,63,30,120,10,70,72,2,240,4,99,10,31,14,253,150,107,29,253,131,67,29,21,123,29,14,248,86,82,197,53,240,3,67,247,67,247,
+    107,247,107,251,67,247,67,251,107,251,106,251,68,251,8,0,255,2,107,247,67,251,67,247,107,31,11,40,129,29,21,48,10,14,21,51,35,6,86,60,21,128,156,159,193,54,1,171,44,50,129,31,11,203,
+    53,34,11,104,33,67,17,173,203,47,1,176,76,129,196,6,11,247,8,197,251,8,27,34,242,17,63,81,215,11,248,176,82,29,11,142,159,165,184,212,217,42,238,27,215,187,11,21,176,170,158,178,179,
+    170,120,102,11,27,74,1,0,83,65,98,123,194,251,123,6,11,76,76,129,11,177,168,207,204,178,106,11,132,23,113,11,7,80,118,111,91,11,160,78,241,1,11,248,35,248,188,156,29,247,255,247,56,
+    21,66,6,252,179,84,3,240,14,247,13,248,188,21,69,91,89,72,71,91,189,186,29,248,158,252,24,156,29,11,210,189,176,198,180,115,173,99,147,26,176,159,162,29,100,126,115,115,10,130,251,
+    43,123,0,161,179,178,170,120,102,103,109,118,99,99,131,26,15,110,76,20,213,170,247,28,69,29,11,162,29,101,126,114,115,10,198,26,32,99,109,198,26,65,247,36,248,12,41,30,255,45,203,96,
+    189,133,29,97,111,109,96,97,111,166,181,31,88,6,70,191,93,207,30,11,73,6,75,121,88,105,60,27,35,77,180,29,50,232,251,23,251,30,45,35,251,43,251,44,234,37,247,34,30,134,248,86,140,10,
+    14,247,51,22,177,71,35,253,97,11,21,54,205,77,227,229,204,202,226,225,77,201,54,107,111,130,122,117,30,168,247,9,5,247,67,190,251,108,6,85,251,113,191,130,5,166,162,168,152,175,27,
+    198,179,99,80,79,98,98,81,81,97,179,196,31,14,247,133,247,223,21,247,6,224,224,247,7,247,5,53,224,251,5,251,5,51,53,251,4,251,6,226,53,247,6,31,170,4,42,68,211,236,234,211,211,235,
+    234,211,68,43,42,67,67,44,31,11,148,29,151,202,145,29,125,6,192,247,165,200,91,10,11,247,33,22,123,29,11,153,5,2,88,5,3,143,5,208,11,235,249,163,21,174,150,158,160,30,173,165,84,28,
+    43,240,59,177,160,29,72,143,31,14,158,10,247,70,6,247,33,247,67,247,102,251,245,5,223,6,251,139,248,49,247,135,247,195,5,53,6,251,237,252,67,5,11,248,206,247,44,21,203,55,248,136,43,
+    7,251,242,252,136,5,75,248,12,251,44,209,247,44,7,252,4,203,21,247,190,248,62,5,167,36,80,247,76,248,221,21,15,23,115,126,131,136,135,133,30,168,15,23,18,78,15,23,240,23,169,111,174,
+    174,162,164,172,30,11,249,167,101,10,11,247,76,249,32,21,188,109,168,105,104,115,114,105,105,162,120,165,151,148,141,143,145,30,111,25,23,1,168,26,192,185,192,202,26,11,247,76,171,
+    21,188,109,167,37,0,34,106,104,37,0,16,144,37,0,34,113,104,205,26,1,37,0,15,175,75,17,31,11,81,74,0,50,11,144,29,22,7,0,78,71,208,247,33,140,21,247,155,7,232,193,216,243,214,192,50,
+    68,4,17,72,162,82,218,251,19,58,80,100,81,108,30,177,71,35,134,10,101,67,1,169,71,242,21,11,21,251,16,213,54,247,21,247,13,223,217,247,22,30,248,156,67,252,154,7,54,97,82,48,52,93,
+    195,224,30,167,69,7,14,126,10,118,31,191,56,5,251,56,7,14,175,29,64,10,11,220,8,7,96,196,155,169,197,30,181,208,67,67,118,140,122,27,4,38,10,11,72,161,144,144,140,140,144,30,137,114,
+    122,124,44,78,194,11,247,62,250,9,21,71,6,79,43,10,192,189,70,242,19,69,6,66,43,10,194,6,14,247,130,250,10,157,29,186,216,30,14,247,229,249,40,123,10,11,249,39,21,72,6,78,43,10,193,
+    40,0,16,68,40,0,62,195,6,11,172,53,49,11,165,29,160,31,66,160,168,30,11,191,44,32,242,212,48,43,113,6,66,60,36,35,67,218,152,18,255,3,13,151,29,11,247,22,249,47,155,29,11,247,104,248,
+    176,131,10,11,97,77,3,240,17,11,247,33,248,8,21,173,168,168,172,173,110,167,105,105,110,111,105,106,168,110,173,31,11,247,8,249,146,78,29,14,129,201,50,70,11,247,144,22,136,25,55,200,
+    29,11,152,80,96,11,206,21,72,187,206,199,32,19,115,199,32,242,18,95,7,11,133,10,7,11,21,172,167,167,171,172,111,167,106,106,111,111,106,107,167,111,172,31,11,21,95,116,113,95,95,117,
+    98,70,241,1,186,92,214,214,187,11,164,29,214,186,11,87,29,202,6,62,213,51,1,130,83,176,22,69,91,90,72,71,91,188,186,29,11,35,39,129,62,182,29,252,62,11,53,10,133,73,140,11,247,65,249,
+    146,51,10,14,180,21,240,5,11,21,226,6,216,247,14,5,76,162,10,11,248,186,21,197,227,196,51,5,13,50,240,37,13,5,52,6,11,6,251,35,234,52,247,33,247,37,243,232,247,34,247,22,11,21,230,
+    199,77,46,31,251,206,6,234,151,199,199,230,27,11,127,21,247,42,241,241,247,36,247,26,47,246,251,41,11,157,30,208,114,144,114,30,118,153,116,150,104,152,11,251,3,5,20,241,7,251,32,238,
+    251,1,247,41,173,11,166,10,99,151,30,11,165,162,161,165,166,116,162,8,70,33,113,11,186,69,48,42,81,236,101,3,0,237,52,243,49,89,248,111,21,251,0,63,61,11,21,252,18,194,248,69,251,42,
+    88,7,14,21,37,191,67,231,228,195,208,242,241,85,11,224,251,26,146,30,247,106,247,105,5,197,11,30,102,7,200,148,186,192,202,26,14,5,76,6,82,51,82,227,5,76,6,81,0,65,82,236,252,63,91,
+    7,1,204,57,241,18,6,11,247,3,201,220,245,244,200,58,251,3,11,94,73,30,189,6,179,165,165,179,179,11,125,25,144,163,142,165,176,26,205,18,7,1,138,7,241,2,11,21,187,6,156,247,48,5,74,
+    6,11,22,164,10,11,247,12,70,11,50,12,5,11,119,7,196,77,6,11,73,230,251,3,251,1,71,48,11,163,30,17,11,214,84,17,11,6,6,17,11,142,110,0,190,110,32,0,0,130,68,49,49,0,1,2,0,51,12,0,12,
+    56,102,209,1,0,21,0,21,0,1,0,25,0,25,0,1,66,102,48,1,0,41,92,70,32,0,43,77,70,241,3,0,52,0,52,0,1,0,54,0,54,0,1,0,56,0,56,0,1,88,102,240,0,1,0,67,0,67,0,1,0,69,0,69,0,1,0,76,147,69,
+    32,0,80,139,111,48,0,83,0,166,111,241,2,87,0,87,0,1,0,93,0,93,0,1,0,98,0,98,0,1,124,102,241,10,1,0,115,0,115,0,1,0,120,0,120,0,1,0,124,0,125,0,1,0,136,0,136,0,1,130,102,240,12,1,0,
+    145,0,145,0,1,0,149,0,149,0,1,0,160,0,160,0,1,0,165,0,165,0,1,0,167,47,70,193,0,178,0,178,0,1,0,180,0,180,0,1,156,102,144,1,0,193,0,193,0,1,0,204,107,70,1,166,102,241,10,1,0,211,0,
+    211,0,1,0,217,0,218,0,1,0,223,0,223,0,1,0,234,0,234,0,1,182,102,241,26,1,0,245,0,245,0,1,0,249,0,251,0,1,0,253,1,5,0,1,1,184,1,198,0,3,1,200,1,211,0,3,1,220,1,221,0,1,1,240,1,247,198,
+    105,0,106,112,240,21,10,0,90,0,116,0,2,68,70,76,84,0,14,108,97,116,110,0,18,0,56,0,0,0,52,0,8,65,90,69,32,0,52,67,65,84,6,0,16,82,6,0,241,4,75,65,90,32,0,52,77,79,76,32,0,52,82,79,
+    77,32,0,52,84,30,0,112,84,82,75,32,0,52,0,236,104,0,216,112,144,1,0,2,107,101,114,110,0,14,125,88,33,0,20,122,104,0,108,0,0,4,0,80,2,0,6,9,80,34,70,241,5,0,1,0,8,0,1,0,12,0,34,0,7,
+    0,172,1,220,0,2,0,3,172,0,17,0,172,0,17,15,166,0,17,27,134,1,0,38,0,15,0,104,7,121,67,0,69,0,76,0,80,2,104,49,115,0,120,124,1,17,136,118,1,0,248,103,2,246,103,14,244,103,0,72,1,20,
+    223,244,103,208,0,249,0,250,0,251,0,253,0,254,0,255,1,147,101,113,2,1,3,1,4,1,5,56,1,33,35,0,75,72,49,1,42,0,43,70,0,121,71,99,0,154,0,0,0,202,4,0,19,190,24,0,64,250,0,0,0,252,113,
+    211,166,0,1,0,172,0,1,0,178,0,2,0,184,32,0,83,202,0,1,0,196,48,0,64,208,0,0,0,54,105,81,220,0,0,0,226,52,0,240,27,3,0,238,0,0,0,244,0,0,0,250,0,4,1,0,0,5,1,6,0,6,1,12,0,5,1,18,0,5,
+    1,24,0,6,1,30,0,5,1,36,0,0,1,130,113,113,184,2,204,0,1,0,71,6,0,17,120,6,0,17,147,6,0,17,96,6,0,80,91,0,17,0,1,111,71,96,0,1,0,251,0,252,140,0,1,24,0,48,77,0,4,122,2,1,12,0,17,185,
+    6,0,113,99,2,198,0,1,0,151,12,0,17,129,6,0,17,176,6,0,17,152,184,1,17,146,12,0,16,186,6,0,32,1,1,6,0,240,13,0,217,2,71,0,1,0,117,1,134,0,1,0,168,1,102,0,1,1,100,2,64,0,1,0,189,1,158,
+    122,2,0,18,0,208,0,99,2,204,0,67,3,172,3,178,0,0,3,252,0,64,0,0,0,3,0,1,0,162,3,1,4,0,48,3,196,5,102,2,1,12,0,80,0,0,3,202,3,14,1,4,14,0,32,214,3,20,1,0,52,0,160,226,0,0,3,232,3,238,
+    0,0,3,22,1,0,18,0,16,250,175,115,3,41,0,68,0,4,6,4,248,3,114,0,0,0,4,18,4,24,26,0,176,4,30,0,0,4,36,4,42,0,0,4,14,116,0,28,0,50,54,4,60,28,0,0,6,0,64,4,66,4,72,8,0,2,4,0,64,4,78,4,
+    84,10,0,160,4,90,4,96,4,102,4,108,4,114,14,0,2,4,0,66,4,120,4,126,10,0,0,6,0,64,4,132,4,138,8,0,2,4,0,242,1,4,144,4,150,0,0,4,156,0,0,4,162,0,0,4,168,22,0,2,6,0,66,4,174,4,180,10,0,
+    0,6,0,64,4,186,4,192,8,0,2,4,0,66,4,198,4,204,10,0,0,6,0,49,4,210,4,98,107,240,1,0,0,4,222,0,0,4,228,4,234,0,0,4,240,4,246,28,0,66,0,0,4,252,8,0,0,6,0,64,5,2,5,8,8,0,2,4,0,48,5,14,
+    5,90,3,2,13,0,83,0,5,26,5,32,11,0,103,0,0,0,5,38,5,16,116,32,5,50,108,1,34,5,62,32,0,115,5,68,5,74,0,0,5,158,104,66,5,86,5,92,24,0,0,6,0,64,5,98,5,128,8,0,2,4,0,64,5,104,5,110,10,0,
+    128,5,116,5,122,0,0,6,148,28,0,32,5,134,18,0,98,0,0,5,140,5,146,10,0,10,6,0,16,5,54,2,54,0,5,158,22,0,71,5,164,5,170,14,0,48,176,5,182,14,0,144,5,188,5,194,5,200,5,206,5,62,117,0,17,
+    0,0,182,0,51,218,5,224,11,0,0,14,0,84,230,5,236,5,242,16,0,68,5,248,5,254,12,0,103,0,0,6,4,6,10,14,0,33,16,7,192,1,2,18,0,66,6,22,6,28,10,0,2,6,0,34,6,34,8,0,0,6,0,65,6,40,6,46,8,0,
+    208,52,6,58,0,0,6,64,6,70,0,0,6,76,18,0,80,0,0,6,82,6,84,117,2,13,0,83,0,6,94,6,100,11,0,119,0,0,0,6,106,6,112,14,0,55,118,6,124,14,0,114,130,6,136,0,0,6,142,18,0,48,6,148,6,20,4,2,
+    13,0,65,0,6,160,6,218,109,64,6,172,6,178,19,0,19,6,12,3,1,12,0,32,190,6,10,4,32,0,6,64,4,64,0,6,208,6,12,4,160,0,6,220,6,226,0,0,6,232,6,10,4,0,39,0,1,4,0,19,6,254,2,0,13,0,48,6,250,
+    7,7,0,161,0,7,6,7,12,0,0,7,18,7,244,2,145,7,30,7,36,0,0,7,42,7,240,2,147,7,54,7,60,0,0,7,66,7,230,2,96,7,78,0,0,7,96,38,1,33,7,90,61,0,50,0,7,96,8,0,3,6,0,144,1,1,66,2,209,0,1,2,75,
+    244,3,33,2,120,6,0,16,47,18,0,128,0,247,2,205,0,1,1,126,12,0,17,1,24,0,112,1,44,2,208,0,1,1,254,1,48,1,0,165,238,3,33,1,40,30,0,17,58,54,0,0,159,3,144,1,1,81,2,201,0,1,1,94,18,0,33,
+    1,132,30,0,17,129,12,0,17,97,12,0,0,124,0,49,1,1,97,54,4,16,123,18,0,0,68,76,32,0,1,201,75,65,0,1,1,136,18,0,17,233,48,0,16,80,12,0,32,1,77,12,0,32,0,123,126,4,33,1,22,12,0,17,159,
+    12,0,209,8,1,139,0,1,0,185,1,118,0,1,1,164,42,0,16,217,30,0,33,1,102,12,0,17,106,12,0,113,91,2,190,0,1,1,91,12,0,17,128,24,0,0,226,2,145,1,3,65,0,10,0,1,1,129,192,0,17,126,228,0,17,
+    96,180,0,17,107,42,0,17,50,42,0,0,36,3,49,1,1,24,12,0,17,21,24,0,17,12,12,0,0,116,4,80,1,1,12,1,145,90,0,1,18,0,0,68,3,32,1,1,218,2,145,1,2,159,2,199,0,1,1,132,48,0,17,233,30,0,2,204,
+    0,17,32,12,0,0,160,1,49,1,1,27,12,0,17,27,36,0,17,107,12,0,17,133,12,0,113,10,1,235,0,1,1,157,12,0,17,200,6,0,16,173,18,0,16,2,48,4,241,0,1,3,245,255,253,0,1,0,153,2,160,0,1,1,83,30,
+    0,16,8,30,0,128,1,222,2,161,0,1,1,9,18,0,208,2,0,2,217,0,1,1,172,2,89,0,1,1,154,113,48,1,1,103,24,0,128,1,24,1,244,0,1,1,40,12,0,32,0,156,30,0,32,0,82,38,9,65,1,60,2,73,34,6,0,104,
+    77,16,110,218,1,16,0,244,3,48,1,0,144,72,0,225,0,158,1,81,0,1,0,110,1,126,0,1,1,179,108,0,16,247,66,0,33,1,27,12,0,17,25,12,0,17,28,12,0,18,71,12,0,96,0,242,0,1,1,109,84,0,32,1,117,
+    18,0,32,0,249,12,0,33,0,249,12,0,128,180,1,240,0,1,0,215,2,234,18,17,209,18,0,17,121,6,0,17,149,36,0,17,149,12,0,48,179,2,206,32,9,97,1,47,0,1,1,15,90,0,16,18,24,0,33,1,225,6,0,17,
+    115,18,0,17,140,12,0,16,9,54,0,16,1,13,3,48,1,0,235,24,0,32,0,236,24,0,33,0,222,12,0,16,222,12,0,33,1,26,246,0,1,252,112,17,2,242,8,32,1,14,30,0,32,1,39,30,0,48,0,128,2,158,9,17,193,
+    12,0,16,162,82,2,32,0,176,90,7,32,2,189,18,0,32,2,204,14,1,33,2,201,12,0,16,243,14,1,129,1,198,2,106,0,1,1,198,18,0,112,182,2,93,0,1,1,221,168,0,17,2,168,0,18,2,110,1,16,148,30,0,32,
+    1,160,60,0,32,1,160,12,0,129,2,105,2,101,0,1,1,209,74,1,17,145,66,0,0,82,6,48,1,1,130,66,0,32,0,169,66,0,33,1,190,24,0,2,120,0,16,175,24,0,32,1,214,24,0,32,2,23,174,0,16,2,226,3,48,
+    1,0,173,18,0,17,0,160,2,32,0,141,90,0,240,3,0,107,1,235,0,2,0,8,0,2,0,10,32,228,0,1,2,118,88,9,79,1,54,3,46,2,0,1,134,6,210,6,210,3,76,4,58,2,0,34,32,164,2,0,0,26,0,12,4,0,69,4,76,
+    6,142,2,0,150,156,6,156,6,162,6,162,6,180,2,0,2,58,0,10,6,0,163,6,210,6,216,8,114,9,104,10,42,2,0,23,64,2,0,21,70,2,0,31,104,2,0,0,53,114,13,184,2,0,53,210,16,48,2,0,18,74,2,0,79,32,
+    164,16,88,2,0,2,119,180,16,180,16,206,16,102,2,0,49,206,16,152,22,0,11,4,0,69,21,250,16,124,2,0,95,166,16,166,32,182,2,0,1,137,16,130,16,130,16,152,16,166,2,0,31,206,2,0,0,0,118,0,
+    83,206,16,232,17,22,2,0,23,48,2,0,112,70,32,208,32,208,17,204,6,0,46,32,188,2,0,69,18,98,20,60,2,0,52,86,22,16,2,0,34,21,236,2,0,225,32,188,32,194,32,208,21,250,32,182,32,208,22,16,
+    166,0,240,42,208,22,16,22,42,22,84,22,122,22,204,23,10,23,96,23,146,23,192,24,62,24,132,24,194,24,204,24,210,24,216,24,234,24,244,24,250,25,16,26,62,26,88,25,68,25,68,25,22,25,68,25,
+    118,25,184,26,62,18,0,65,26,94,29,20,2,0,17,34,2,0,49,76,29,86,4,0,81,200,29,116,29,154,4,0,213,200,29,246,29,252,30,2,30,144,32,158,32,158,210,1,0,32,1,15,190,0,0,35,32,194,2,0,17,
+    208,224,0,128,208,0,2,0,30,0,1,0,88,4,240,157,52,0,61,0,40,0,69,0,144,0,50,0,146,0,147,0,126,0,149,0,179,0,128,0,182,0,182,0,159,0,186,0,253,0,160,0,255,1,1,0,228,1,3,1,5,0,231,1,8,
+    1,17,0,234,1,25,1,25,0,244,1,39,1,39,0,245,1,42,1,42,0,246,1,45,1,45,0,247,1,48,1,49,0,248,1,55,1,55,0,250,1,68,1,68,0,251,1,76,1,76,0,252,1,81,1,83,0,253,1,85,1,85,1,0,1,87,1,93,1,
+    1,1,95,1,95,1,8,1,97,1,97,1,9,1,99,1,99,1,10,1,101,1,114,1,11,1,118,1,118,1,25,1,166,1,167,1,26,1,171,1,172,1,28,1,215,1,218,1,30,1,220,1,239,1,116,12,243,255,255,255,255,255,255,184,
+    108,255,165,0,233,255,224,1,88,255,226,1,93,0,4,1,166,255,231,1,167,255,252,1,173,255,166,0,59,0,1,255,246,0,2,255,246,0,3,255,246,0,4,255,246,0,5,255,246,0,6,255,246,0,7,255,246,0,
+    8,255,246,0,9,255,246,0,10,255,246,0,11,255,246,0,12,255,246,0,13,255,246,0,52,0,2,0,53,0,2,0,93,255,238,0,94,255,238,0,95,255,238,0,96,255,238,0,97,255,238,0,108,255,236,0,109,255,
+    241,0,110,255,241,0,111,255,241,0,112,255,241,0,113,255,241,0,114,255,243,0,115,255,234,0,116,255,234,0,117,255,234,0,118,255,234,0,119,255,234,0,233,255,246,0,234,255,246,0,235,255,
+    246,0,236,255,246,0,237,255,246,0,238,255,246,0,240,255,246,0,241,255,246,0,242,255,246,0,243,255,246,0,244,255,246,0,250,255,248,1,76,0,4,1,82,255,241,1,83,255,241,1,87,255,241,1,
+    90,0,4,1,91,0,4,1,93,255,246,1,101,255,246,1,102,255,246,1,103,255,246,1,173,255,231,1,232,255,248,1,233,255,248,1,234,255,248,1,235,255,248,0,4,0,108,255,236,0,114,255,246,1,93,255,
+    236,1,173,255,246,0,144,0,1,255,211,0,2,255,211,0,3,255,211,0,4,255,211,0,5,255,211,0,6,255,211,0,7,255,211,0,8,255,211,0,9,255,211,0,10,255,211,0,11,255,211,0,12,255,211,0,13,255,
+    211,0,52,255,212,0,53,255,212,0,125,255,216,0,126,255,216,0,127,255,216,0,128,255,216,0,129,255,216,0,130,255,216,0,131,255,216,0,132,255,216,0,133,255,216,0,134,255,216,0,135,255,
+    216,0,136,255,216,0,137,255,216,0,139,255,218,0,140,255,218,0,141,255,218,0,142,255,218,0,143,255,218,0,144,255,218,0,145,255,218,0,146,255,218,0,147,255,218,0,148,255,218,0,149,255,
+    218,0,150,255,218,0,151,255,218,0,152,255,218,0,153,255,218,0,154,255,218,0,155,255,218,0,156,255,218,0,157,255,218,0,158,255,218,0,160,255,226,0,161,255,226,0,162,255,226,0,163,255,
+    226,0,164,255,226,0,186,255,226,0,187,255,226,0,188,255,226,0,189,255,226,0,190,255,226,0,191,255,226,0,192,255,226,0,193,255,218,0,194,255,218,0,195,255,218,0,196,255,218,0,197,255,
+    218,0,198,255,218,0,199,255,218,0,200,255,218,0,201,255,218,0,202,255,218,0,203,255,218,0,204,255,226,0,206,255,218,0,207,255,226,0,208,255,226,0,209,255,226,0,210,255,226,0,211,255,
+    242,0,212,255,242,0,213,255,242,0,214,255,242,0,215,255,242,0,216,255,242,0,223,255,226,0,224,255,226,0,225,255,226,0,226,255,226,0,227,255,226,0,228,255,226,0,229,255,226,0,230,255,
+    226,0,231,255,226,0,232,255,226,0,233,255,234,0,234,255,234,0,235,255,234,0,236,255,234,0,237,255,234,0,238,255,234,0,239,255,234,0,240,255,234,0,241,255,234,0,242,255,234,0,243,255,
+    234,0,244,255,234,0,245,255,244,0,246,255,244,0,247,255,244,0,248,255,244,0,249,255,218,0,250,255,218,1,76,0,4,1,82,255,146,1,83,255,146,1,87,255,146,1,90,0,4,1,91,0,4,1,93,255,196,
+    1,96,0,20,1,98,0,20,1,100,0,20,1,101,255,236,1,102,255,236,1,103,255,236,1,104,255,246,1,106,255,246,1,110,0,28,1,112,0,28,1,167,255,226,1,173,0,12,1,222,255,218,1,223,255,218,1,224,
+    255,218,1,225,255,218,1,226,255,218,1,227,255,218,1,228,255,218,1,229,255,218,1,230,255,218,1,231,255,218,1,232,255,218,1,233,255,218,1,234,255,218,1,235,255,218,0,3,0,108,255,237,
+    1,93,0,24,1,173,255,246,0,1,1,93,255,236,0,4,0,233,255,214,1,93,0,10,1,166,255,206,1,167,255,226,0,7,0,108,255,192,0,233,255,216,1,88,255,216,1,93,0,26,1,166,255,226,1,167,255,246,
+    1,173,255,156,0,1,0,233,255,250,0,102,0,1,255,227,0,2,255,227,0,3,255,227,0,4,255,227,0,5,255,227,0,6,255,227,0,7,255,227,0,8,255,227,0,9,255,227,0,10,255,227,0,11,255,227,0,12,255,
+    227,0,13,255,227,0,52,255,204,0,53,255,204,0,125,255,236,0,126,255,236,0,127,255,236,0,128,255,236,0,129,255,236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,
+    0,135,255,236,0,136,255,236,0,137,255,236,0,139,255,235,0,140,255,235,0,141,255,235,0,142,255,235,0,143,255,235,0,144,255,235,0,145,255,235,0,146,255,235,0,147,255,235,0,148,255,235,
+    0,149,255,235,0,150,255,235,0,151,255,235,0,152,255,235,0,153,255,235,0,154,255,235,0,155,255,235,0,156,255,235,0,157,255,235,0,158,255,235,0,160,255,235,0,161,255,235,0,162,255,235,
+    0,163,255,235,0,164,255,235,0,193,255,235,0,194,255,235,0,195,255,235,0,196,255,235,0,197,255,235,0,198,255,235,0,199,255,235,0,200,255,235,0,201,255,235,0,202,255,235,0,203,255,235,
+    0,206,255,235,0,211,255,254,0,212,255,254,0,213,255,254,0,214,255,254,0,215,255,254,0,216,255,254,0,249,255,235,0,250,255,235,1,76,0,20,1,82,255,168,1,83,255,168,1,87,255,168,1,90,
+    0,20,1,91,0,20,1,93,255,212,1,101,255,226,1,102,255,226,1,103,255,226,1,104,255,236,1,106,255,236,1,167,255,226,1,171,0,20,1,172,0,20,1,222,255,235,1,223,255,235,1,224,255,235,1,225,
+    255,235,1,226,255,235,1,227,255,235,1,228,255,235,1,229,255,235,1,230,255,235,1,231,255,235,1,232,255,235,1,233,255,235,1,234,255,235,1,235,255,235,0,61,0,1,255,242,0,2,255,242,0,3,
+    255,242,0,4,255,242,0,5,255,242,0,6,255,242,0,7,255,242,0,8,255,242,0,9,255,242,0,10,255,242,0,11,255,242,0,12,255,242,0,13,255,242,0,108,255,232,0,109,255,242,0,110,255,242,0,111,
+    255,242,0,112,255,242,0,113,255,242,0,114,255,230,0,115,255,220,0,116,255,220,0,117,255,220,0,118,255,220,0,119,255,220,0,211,0,16,0,212,0,16,0,213,0,16,0,214,0,16,0,215,0,16,0,216,
+    0,16,0,233,0,16,0,234,0,16,0,235,0,16,0,236,0,16,0,237,0,16,0,238,0,16,0,239,0,8,0,240,0,16,0,241,0,16,0,242,0,16,0,243,0,16,0,244,0,16,1,76,255,246,1,82,255,202,1,83,255,202,1,87,
+    255,202,1,90,255,246,1,91,255,246,1,93,255,234,1,101,0,10,1,102,0,10,1,103,0,10,1,109,255,224,1,110,255,216,1,111,255,224,1,112,255,216,1,167,255,254,1,171,255,254,1,172,255,254,1,
+    173,255,226,0,48,0,1,255,233,0,2,255,233,0,3,255,233,0,4,255,233,0,5,255,233,0,6,255,233,0,7,255,233,0,8,255,233,0,9,255,233,0,10,255,233,0,11,255,233,0,12,255,233,0,13,255,233,0,93,
+    255,231,0,94,255,231,0,95,255,231,0,96,255,231,0,97,255,231,0,108,255,228,0,109,255,234,0,110,255,234,0,111,255,234,0,112,255,234,0,113,255,234,0,114,255,235,0,115,255,208,0,116,255,
+    208,0,117,255,208,0,118,255,208,0,119,255,208,0,120,0,4,0,121,0,4,0,122,0,4,0,123,0,4,210,0,151,236,1,83,255,236,1,87,255,236,210,0,240,28,252,1,108,255,226,1,109,255,220,1,110,255,
+    216,1,111,255,220,1,112,255,216,1,113,255,226,1,173,255,226,0,5,0,108,255,250,0,233,255,254,1,166,255,236,136,3,64,1,173,255,236,192,20,241,23,255,241,0,8,0,108,0,10,0,233,255,222,
+    0,239,255,222,1,88,255,254,1,93,255,192,1,166,255,216,1,167,255,216,1,173,0,30,0,2,38,6,242,255,255,38,167,255,253,0,209,0,1,255,165,0,2,255,165,0,3,255,165,0,4,255,165,0,5,255,165,
+    0,6,255,165,0,7,255,165,0,8,255,165,0,9,255,165,0,10,255,165,0,11,255,165,0,12,255,165,0,13,255,165,0,15,255,228,0,16,255,228,0,17,255,228,0,18,255,228,0,19,255,228,0,20,255,228,0,
+    36,255,228,0,37,255,228,0,38,255,228,0,39,255,228,0,40,255,228,0,52,255,177,0,53,255,177,0,69,255,228,0,70,255,228,0,71,255,228,0,72,255,228,0,73,255,228,0,74,255,228,0,75,255,228,
+    0,76,255,228,0,77,255,228,0,78,255,228,0,79,255,228,0,82,255,228,0,87,255,254,0,88,255,254,0,89,255,254,0,90,255,254,0,91,255,254,0,92,255,254,0,93,0,10,0,94,0,10,0,95,0,10,0,96,0,
+    10,0,97,0,10,0,124,255,228,0,125,255,182,0,126,255,182,0,127,255,182,0,128,255,182,0,129,255,182,0,130,255,182,0,131,255,182,0,132,255,182,0,133,255,182,0,134,255,182,0,135,255,182,
+    0,136,255,182,0,137,255,182,0,139,255,182,0,140,255,182,0,141,255,182,0,142,255,182,0,143,255,182,0,144,255,182,0,145,255,182,0,146,255,182,0,147,255,182,0,148,255,182,0,149,255,182,
+    0,150,255,182,0,151,255,182,0,152,255,182,0,153,255,182,0,154,255,182,0,155,255,182,0,156,255,182,0,157,255,182,0,158,255,182,0,159,255,250,0,160,255,182,0,161,255,182,0,162,255,182,
+    0,163,255,182,0,164,255,182,0,186,255,212,0,187,255,212,0,188,255,212,0,189,255,212,0,190,255,212,0,191,255,212,0,192,255,212,0,193,255,182,0,194,255,182,0,195,255,182,0,196,255,182,
+    0,197,255,182,0,198,255,182,0,199,255,182,0,200,255,182,0,201,255,182,0,202,255,182,0,203,255,182,0,204,255,212,0,206,255,182,0,207,255,212,0,208,255,212,0,209,255,212,0,210,255,212,
+    0,211,255,209,0,212,255,209,0,213,255,209,0,214,255,209,0,215,255,209,0,216,255,209,0,218,255,252,0,219,255,252,0,220,255,252,0,221,255,252,0,222,255,252,0,223,255,212,0,224,255,212,
+    0,225,255,212,0,226,255,212,0,227,255,212,0,228,255,212,0,229,255,212,0,230,255,212,0,231,255,212,0,232,255,212,0,233,255,232,0,234,255,222,0,235,255,222,0,236,255,222,0,237,255,222,
+    0,238,84,2,240,107,0,240,255,232,0,241,255,232,0,242,255,232,0,243,255,232,0,244,255,232,0,245,255,232,0,246,255,232,0,247,255,232,0,248,255,232,0,249,255,182,0,250,255,182,0,251,255,
+    252,0,252,255,250,0,253,255,250,0,254,255,250,0,255,255,250,1,0,255,250,1,1,255,250,1,2,255,250,1,3,255,252,1,4,255,252,1,5,255,252,1,76,0,20,1,81,255,214,1,82,255,164,1,83,255,164,
+    1,87,255,164,1,88,255,252,1,90,0,20,1,91,0,20,1,92,124,6,241,141,255,188,1,101,255,192,1,102,255,192,1,103,255,192,1,104,255,196,1,105,255,232,1,106,255,196,1,107,255,232,1,108,255,
+    176,1,113,255,176,1,166,255,212,1,167,255,194,1,171,255,252,1,172,255,252,1,215,255,228,1,216,255,228,1,217,255,228,1,218,255,228,1,219,255,228,1,222,255,182,1,223,255,182,1,224,255,
+    182,1,225,255,182,1,226,255,182,1,227,255,182,1,228,255,182,1,229,255,182,1,230,255,182,1,231,255,182,1,232,255,182,1,233,255,182,1,234,255,182,1,235,255,182,1,236,255,252,1,237,255,
+    252,1,238,255,252,1,239,255,252,0,6,0,233,255,232,0,239,255,242,174,0,255,255,51,93,255,210,1,166,255,217,1,167,255,204,0,151,0,15,255,232,0,16,255,232,0,17,255,232,0,18,255,232,0,
+    19,255,232,0,20,255,232,0,36,255,232,0,37,255,232,0,38,255,232,0,39,255,232,0,40,255,232,0,52,255,252,0,53,255,252,0,69,255,232,0,70,255,232,0,71,255,232,0,72,255,232,0,73,255,232,
+    0,74,255,232,0,75,255,232,0,76,255,232,0,77,255,232,0,78,255,232,0,79,255,232,0,82,255,232,0,124,255,232,0,125,255,252,0,126,255,252,0,127,255,252,0,128,255,252,0,129,255,252,0,130,
+    255,252,0,131,255,252,0,132,255,252,0,133,255,252,0,134,255,252,0,135,255,252,0,136,255,252,0,137,255,252,0,139,255,232,0,140,255,232,0,141,255,232,0,142,255,232,0,143,255,232,0,144,
+    255,232,0,145,255,232,0,146,255,232,0,147,255,232,0,148,255,232,0,149,255,232,0,150,255,232,0,151,255,232,0,152,255,232,0,153,255,232,0,154,255,232,0,155,255,232,0,156,255,232,0,157,
+    255,232,0,158,255,232,0,159,255,252,0,160,255,236,0,161,255,236,0,162,255,236,0,163,255,236,0,164,255,236,0,193,255,232,0,194,255,232,0,195,255,232,0,196,255,232,0,197,255,232,0,198,
+    255,232,0,199,255,232,0,200,255,232,0,201,255,232,0,202,255,232,0,203,255,232,0,206,255,232,184,2,4,255,22,239,0,224,255,239,0,225,255,239,0,226,255,239,0,227,255,239,0,228,255,239,
+    0,229,255,239,0,230,255,239,0,231,255,239,0,232,255,239,130,9,6,15,126,9,1,51,249,255,232,160,2,249,10,252,0,253,255,252,0,254,255,252,0,255,255,252,1,0,255,252,1,1,255,252,1,2,255,
+    252,160,2,241,34,88,255,240,1,96,0,30,1,98,0,30,1,100,0,30,1,101,255,243,1,102,255,243,1,103,255,243,1,104,255,216,1,106,255,216,1,109,255,252,1,110,255,254,1,111,255,252,1,112,160,
+    5,17,232,148,12,243,100,171,255,232,1,172,255,232,1,215,255,232,1,216,255,232,1,217,255,232,1,218,255,232,1,219,255,232,1,222,255,232,1,223,255,232,1,224,255,232,1,225,255,232,1,226,
+    255,232,1,227,255,232,1,228,255,232,1,229,255,232,1,230,255,232,1,231,255,232,1,236,255,252,1,237,255,252,1,238,255,252,1,239,255,252,0,6,0,233,255,210,0,239,255,225,1,88,255,234,1,
+    93,255,195,1,166,255,192,1,167,255,191,0,3,0,233,255,238,20,13,241,0,238,0,3,0,108,255,182,0,233,255,236,1,173,255,216,60,6,240,1,192,0,114,255,232,0,233,255,253,0,239,255,239,1,173,
+    255,178,17,19,108,28,0,209,248,0,239,0,20,1,166,255,252,1,167,255,232,88,6,209,3,1,84,0,15,1,88,0,41,1,173,0,73,78,0,0,32,4,17,246,78,0,17,6,92,0,2,78,0,17,243,78,0,49,123,0,30,82,
+    0,8,26,0,17,235,26,0,49,93,255,254,26,0,241,30,11,0,93,255,196,0,94,255,196,0,95,255,196,0,96,255,196,0,97,255,196,0,108,255,212,0,109,255,245,0,110,255,245,0,111,255,245,0,112,255,
+    245,0,113,255,245,72,0,240,2,245,0,233,0,15,0,239,0,30,1,93,255,248,1,166,0,10,244,6,1,202,0,112,205,0,233,255,241,0,239,230,6,131,0,2,1,173,255,222,0,33,22,0,15,126,13,3,31,239,130,
+    13,4,241,24,245,255,246,0,246,255,246,0,247,255,246,0,248,255,246,1,76,255,238,1,82,255,246,1,83,255,246,1,87,255,246,1,90,255,238,1,91,255,238,196,0,241,14,105,255,248,1,107,255,248,
+    1,109,255,236,1,110,255,228,1,111,255,236,1,112,255,228,1,171,255,236,1,172,102,1,241,88,226,0,37,0,114,255,252,0,138,0,4,0,165,0,4,0,166,0,4,0,167,0,6,0,168,0,6,0,169,0,6,0,170,0,
+    6,0,171,0,6,0,172,0,6,0,173,0,6,0,174,0,6,0,175,0,6,0,176,0,4,0,177,0,4,0,178,0,4,0,179,0,4,0,180,0,4,0,181,0,4,0,182,0,4,0,183,0,4,0,184,0,4,0,185,0,4,0,205,0,4,0,217,0,4,170,1,243,
+    110,88,0,6,1,96,0,8,1,98,0,8,1,100,0,8,1,109,0,4,1,110,0,4,1,111,0,4,1,112,0,4,1,173,0,13,1,220,0,6,1,221,0,4,0,118,0,1,255,224,0,2,255,224,0,3,255,224,0,4,255,224,0,5,255,224,0,6,
+    255,224,0,7,255,224,0,8,255,224,0,9,255,224,0,10,255,224,0,11,255,224,0,12,255,224,0,13,255,224,0,52,255,226,0,53,255,226,0,93,255,222,0,94,255,222,0,95,255,222,0,96,255,222,0,97,255,
+    222,12,10,255,94,232,0,110,255,232,0,111,255,232,0,112,255,232,0,113,255,232,0,114,255,234,0,115,255,210,0,116,255,210,0,117,255,210,0,118,255,210,0,119,255,210,0,120,255,220,0,121,
+    255,220,0,122,255,220,0,123,255,220,0,125,255,235,0,126,255,235,0,127,255,235,0,128,255,235,0,129,255,235,0,130,255,235,0,131,255,235,0,132,255,235,0,133,255,235,0,134,255,235,0,135,
+    255,235,0,136,255,235,0,137,255,235,222,11,132,243,6,253,0,212,255,253,0,213,255,253,0,214,255,253,0,215,255,253,0,216,255,253,222,11,255,26,231,1,82,255,180,1,83,255,180,1,87,255,
+    180,1,93,255,242,1,101,255,224,1,102,255,224,1,103,255,224,1,104,255,244,1,106,255,244,1,167,255,224,202,11,24,209,231,1,233,255,231,1,234,255,231,1,235,255,231,38,3,17,222,118,1,81,
+    239,0,10,1,93,190,3,17,224,190,3,159,101,0,52,255,254,0,53,255,254,192,1,4,31,222,204,11,2,255,132,115,255,225,0,116,255,225,0,117,255,225,0,118,255,225,0,119,255,225,0,139,255,239,
+    0,140,255,239,0,141,255,239,0,142,255,239,0,143,255,239,0,144,255,239,0,145,255,239,0,146,255,239,0,147,255,239,0,148,255,239,0,149,255,239,0,150,255,239,0,151,255,239,0,152,255,239,
+    0,153,255,239,0,154,255,239,0,155,255,239,0,156,255,239,0,157,255,239,0,158,255,239,0,193,255,239,0,194,255,239,0,195,255,239,0,196,255,239,0,197,255,239,0,198,255,239,0,199,255,239,
+    0,200,255,239,0,201,255,239,0,202,255,239,0,203,255,239,0,206,255,239,66,13,6,241,162,218,0,20,0,219,0,20,0,220,0,20,0,221,0,20,0,222,0,20,0,234,0,10,0,235,0,10,0,236,0,10,0,237,0,
+    10,0,238,0,10,0,240,0,10,0,241,0,10,0,242,0,10,0,243,0,10,0,244,0,10,0,249,255,239,0,251,0,20,1,3,0,20,1,4,0,20,1,5,0,20,1,82,255,254,1,83,255,254,1,87,255,254,1,101,255,222,1,102,
+    255,222,1,103,255,222,1,104,255,234,1,106,255,234,1,166,255,254,1,167,255,244,1,173,255,236,1,222,255,239,1,223,255,239,1,224,255,239,1,225,255,239,1,226,255,239,1,227,255,239,1,228,
+    255,239,1,229,255,239,1,230,255,239,1,231,255,239,1,236,0,20,1,237,0,20,1,238,0,20,1,239,126,137,17,108,26,6,0,70,5,240,2,211,0,5,0,114,0,16,1,88,0,20,1,93,255,224,1,167,68,4,33,0,
+    38,212,1,2,74,3,2,212,1,17,242,34,2,177,173,255,231,0,10,1,11,255,248,1,15,164,4,241,2,210,1,83,255,210,1,87,255,210,1,93,255,241,1,108,255,206,50,12,2,46,12,241,2,206,0,9,1,9,255,
+    252,1,13,255,254,1,15,0,24,1,16,40,5,19,20,166,6,19,252,166,6,241,10,252,0,20,1,9,0,2,1,10,0,2,1,11,0,2,1,12,255,228,1,13,255,250,1,15,150,18,213,20,1,82,0,4,1,83,0,4,1,87,0,4,140,
+    9,59,93,0,20,150,14,240,10,226,1,106,255,226,1,110,255,248,1,112,255,248,0,15,1,9,255,246,1,10,255,238,1,11,2,31,241,127,255,250,1,13,255,255,1,15,0,18,1,76,0,10,1,82,255,232,1,83,
+    255,232,1,87,255,232,1,90,0,10,1,91,0,10,1,101,0,4,1,102,0,4,1,103,0,4,0,21,1,9,255,228,1,10,255,228,1,11,255,250,1,12,255,240,1,13,255,240,1,14,255,238,1,15,255,227,1,17,255,234,1,
+    26,0,10,1,76,255,252,1,82,255,230,1,83,255,230,1,87,255,230,1,90,255,252,1,91,255,252,1,104,255,236,1,106,255,236,1,109,255,212,1,110,255,212,1,111,255,212,1,112,255,212,0,12,1,9,255,
+    248,1,10,255,241,230,0,121,15,255,254,1,17,255,248,66,0,51,109,255,254,190,7,16,254,190,7,161,0,11,1,9,255,214,1,10,255,244,50,0,1,194,0,105,255,198,1,17,255,236,54,0,17,110,236,7,
+    241,0,252,0,31,1,8,255,238,1,9,0,12,1,10,255,248,50,0,251,48,12,255,210,1,13,255,238,1,14,255,228,1,15,0,50,1,16,255,246,1,17,0,4,1,76,0,44,1,82,255,162,1,83,255,162,1,87,255,162,1,
+    90,0,44,1,91,0,44,1,93,255,171,1,96,0,40,1,98,0,40,1,100,0,40,234,10,49,186,1,105,102,8,48,186,1,107,106,8,245,5,0,38,1,110,0,38,1,111,0,38,1,112,0,38,0,17,1,9,255,239,172,0,50,12,
+    255,248,114,1,225,255,246,1,82,255,240,1,83,255,240,1,87,255,240,250,13,241,12,101,255,254,1,102,255,254,1,103,255,254,1,109,255,244,1,110,255,244,1,111,255,244,1,112,255,244,184,1,
+    209,253,1,10,255,254,1,11,255,238,1,12,255,225,60,2,145,14,255,252,1,15,255,240,1,16,114,1,6,114,2,241,0,109,255,238,1,110,255,236,1,111,255,238,1,112,255,236,60,2,176,126,1,26,255,
+    226,0,1,1,45,0,14,176,26,0,126,21,241,9,1,38,255,251,1,42,255,246,1,45,0,23,1,55,0,23,0,2,1,145,0,10,1,146,194,27,81,68,0,40,0,5,26,0,112,48,255,251,1,52,255,246,34,0,241,51,1,68,255,
+    216,0,1,1,42,255,206,0,11,0,108,255,252,0,109,255,252,0,110,255,252,0,111,255,252,0,112,255,252,0,113,255,252,0,115,255,250,0,116,255,250,0,117,255,250,0,118,255,250,0,119,255,250,
+    0,12,0,108,255,164,0,233,255,180,20,8,240,18,8,255,210,1,9,255,191,1,11,255,232,1,12,255,232,1,13,255,230,1,14,255,226,1,15,255,226,1,16,255,240,1,17,202,14,255,51,0,186,0,50,0,187,
+    0,50,0,188,0,50,0,189,0,50,0,190,0,50,0,191,0,50,0,192,0,50,0,204,0,50,0,207,0,50,0,208,0,50,0,209,0,50,0,210,0,50,1,109,0,20,1,110,0,20,1,111,0,20,1,112,0,20,0,33,208,8,4,241,4,192,
+    0,109,255,222,0,110,255,222,0,111,255,222,0,112,255,222,0,113,164,5,241,74,250,0,115,255,195,0,116,255,195,0,117,255,195,0,118,255,195,0,119,255,195,0,233,255,226,0,234,255,236,0,235,
+    255,236,0,236,255,236,0,237,255,236,0,238,255,236,0,239,255,236,0,240,255,226,0,241,255,226,0,242,255,226,0,243,255,226,0,244,255,226,0,245,255,236,0,246,255,236,0,247,255,236,0,248,
+    255,236,0,6,0,108,200,3,241,0,20,1,10,0,10,1,12,255,192,1,13,255,236,1,15,236,147,255,142,108,255,214,0,173,0,1,255,192,0,2,255,192,0,3,255,192,0,4,255,192,0,5,255,192,0,6,255,192,
+    0,7,255,192,0,8,255,192,0,9,255,192,0,10,255,192,0,11,255,192,0,12,255,192,0,13,255,192,0,15,255,236,0,16,255,236,0,17,255,236,0,18,255,236,0,19,255,236,0,20,255,236,0,36,255,236,0,
+    37,255,236,0,38,255,236,0,39,255,236,0,40,255,236,0,52,255,172,0,53,255,172,0,69,255,236,0,70,255,236,0,71,255,236,0,72,255,236,0,73,255,236,0,74,255,236,0,75,255,236,0,76,255,236,
+    0,77,255,236,0,78,255,236,0,79,255,236,0,82,255,236,212,15,2,48,115,0,2,214,36,255,255,86,0,117,0,2,0,118,0,2,0,119,0,2,0,124,255,236,0,125,255,172,0,126,255,172,0,127,255,172,0,128,
+    255,172,0,129,255,172,0,130,255,172,0,131,255,172,0,132,255,172,0,133,255,172,0,134,255,172,0,135,255,172,0,136,255,172,0,137,255,172,0,139,255,172,0,140,255,172,0,141,255,172,0,142,
+    255,172,0,143,255,172,0,144,255,172,0,145,255,172,0,146,255,172,0,147,255,172,0,148,255,172,0,149,255,172,0,150,255,172,0,151,255,172,0,152,255,172,0,153,255,172,0,154,255,172,0,155,
+    255,172,0,156,255,172,0,157,255,172,0,158,255,172,0,160,255,176,0,161,255,176,0,162,255,176,0,163,255,176,0,164,255,176,0,186,255,206,0,187,255,206,0,188,255,206,0,189,255,206,0,190,
+    255,206,0,191,255,206,0,192,255,206,0,193,255,172,0,194,255,172,0,195,255,172,0,196,255,172,0,197,255,172,0,198,255,172,0,199,255,172,0,200,255,172,0,201,255,172,0,202,255,172,0,203,
+    255,172,0,204,255,206,0,206,255,172,0,207,255,206,0,208,255,206,0,209,255,206,0,210,255,206,0,211,255,208,0,212,255,208,0,213,255,208,0,214,255,208,0,215,255,208,0,216,255,208,0,223,
+    255,216,0,224,255,216,0,225,255,216,0,226,255,216,0,227,255,216,0,228,255,216,0,229,255,216,0,230,255,216,0,231,255,216,0,232,255,216,0,233,255,232,0,234,255,232,0,235,255,232,0,236,
+    255,232,0,237,255,232,0,238,255,232,0,239,255,232,208,15,4,241,14,248,0,246,255,248,0,247,255,248,0,248,255,248,0,249,255,172,0,250,255,176,1,8,255,241,1,9,0,15,70,5,145,12,255,171,
+    1,13,255,226,1,14,104,2,241,12,40,1,16,255,236,1,93,255,145,1,215,255,236,1,216,255,236,1,217,255,236,1,218,255,236,1,219,40,7,243,54,172,1,223,255,172,1,224,255,172,1,225,255,172,
+    1,226,255,172,1,227,255,172,1,228,255,172,1,229,255,172,1,230,255,172,1,231,255,172,1,232,255,176,1,233,255,176,1,234,255,176,1,235,255,176,0,3,0,114,0,30,1,9,0,16,1,15,0,40,0,10,188,
+    12,16,243,248,25,1,224,18,113,9,255,200,1,10,255,202,110,5,2,214,3,113,254,1,17,255,252,0,2,96,7,19,12,162,22,49,196,0,114,4,1,240,4,244,0,239,255,234,1,9,255,218,1,10,255,212,1,15,
+    255,206,0,9,168,11,1,96,0,179,11,255,236,1,12,255,180,1,13,255,232,210,0,80,28,1,16,255,244,150,7,227,0,11,0,114,255,250,1,8,255,216,1,10,255,240,26,5,0,42,0,18,222,78,4,3,42,0,0,24,
+    6,49,88,0,10,178,4,211,172,0,233,255,186,1,8,255,206,1,9,255,193,50,0,19,236,46,1,16,224,122,0,1,46,1,0,86,3,17,1,204,12,240,10,1,1,12,255,216,0,35,0,1,255,231,0,2,255,231,0,3,255,
+    231,0,4,255,231,0,5,220,9,192,255,231,0,7,255,231,0,8,255,231,0,9,254,7,243,19,255,231,0,11,255,231,0,12,255,231,0,13,255,231,0,93,255,216,0,94,255,216,0,95,255,216,0,96,255,216,0,
+    97,255,216,78,13,15,126,4,1,240,22,232,0,115,255,192,0,116,255,192,0,117,255,192,0,118,255,192,0,119,255,192,0,120,255,238,0,121,255,238,0,122,255,238,0,123,255,238,62,5,247,31,0,131,
+    0,15,255,250,0,16,255,250,0,17,255,250,0,18,255,250,0,19,255,250,0,20,255,250,0,36,255,250,0,37,255,250,0,38,255,250,0,39,255,250,0,40,255,250,190,16,241,90,250,0,70,255,250,0,71,255,
+    250,0,72,255,250,0,73,255,250,0,74,255,250,0,75,255,250,0,76,255,250,0,77,255,250,0,78,255,250,0,79,255,250,0,82,255,250,0,93,255,194,0,94,255,194,0,95,255,194,0,96,255,194,0,97,255,
+    194,0,98,255,250,0,99,255,250,0,100,255,250,0,101,255,250,0,102,255,250,0,103,255,250,0,104,255,250,0,105,255,250,0,106,255,250,0,107,255,250,216,14,255,28,109,255,192,0,110,255,192,
+    0,111,255,192,0,112,255,192,0,113,255,192,0,115,255,162,0,116,255,162,0,117,255,162,0,118,255,162,0,119,255,162,0,124,255,250,38,17,36,243,134,250,0,140,255,250,0,141,255,250,0,142,
+    255,250,0,143,255,250,0,144,255,250,0,145,255,250,0,146,255,250,0,147,255,250,0,148,255,250,0,149,255,250,0,150,255,250,0,151,255,250,0,152,255,250,0,153,255,250,0,154,255,250,0,155,
+    255,250,0,156,255,250,0,157,255,250,0,158,255,250,0,193,255,250,0,194,255,250,0,195,255,250,0,196,255,250,0,197,255,250,0,198,255,250,0,199,255,250,0,200,255,250,0,201,255,250,0,202,
+    255,250,0,203,255,250,0,206,255,250,0,211,255,252,0,212,255,252,0,213,255,252,0,214,255,252,0,215,255,252,0,216,255,252,162,19,14,210,3,15,206,3,1,241,56,249,255,250,1,114,255,216,
+    1,215,255,250,1,216,255,250,1,217,255,250,1,218,255,250,1,219,255,250,1,222,255,250,1,223,255,250,1,224,255,250,1,225,255,250,1,226,255,250,1,227,255,250,1,228,255,250,1,229,255,250,
+    1,230,255,250,1,231,255,250,0,1,0,114,2,26,0,244,22,49,114,255,232,74,8,0,140,22,48,1,1,173,200,7,1,114,2,0,106,16,17,250,240,16,0,144,22,16,2,92,3,0,78,16,48,0,2,13,2,15,112,0,14,
+    76,16,48,0,47,56,114,63,255,246,0,1,0,2,8,24,0,81,255,202,255,222,255,98,37,48,0,0,255,96,41,1,50,0,6,10,0,1,15,0,7,5,0,39,255,228,13,0,9,11,0,160,255,208,255,234,255,231,0,0,255,240,
+    23,0,34,255,211,104,0,96,255,216,255,220,255,216,18,0,6,4,0,32,255,251,12,0,99,255,239,0,0,255,244,38,0,1,192,39,65,255,240,255,235,26,0,115,162,255,200,255,182,255,240,74,0,240,0,
+    226,0,0,255,236,255,226,255,210,255,204,255,226,255,245,34,0,14,4,0,15,178,0,7,9,44,0,0,120,37,9,17,0,4,13,0,0,148,0,68,255,251,255,241,16,0,4,8,0,64,255,244,255,243,12,0,96,255,162,
+    255,208,255,182,210,0,1,14,0,0,148,0,64,246,255,234,255,54,6,31,0,148,0,5,0,42,0,6,4,0,16,255,162,21,6,15,0,15,10,0,12,0,144,0,0,168,34,41,255,248,41,0,7,192,0,1,34,0,3,29,0,35,255,
+    236,190,1,32,4,0,250,37,1,22,0,23,255,28,39,16,255,144,36,1,22,0,4,5,0,3,114,1,18,245,242,0,32,255,190,222,0,4,28,0,0,8,0,128,255,246,255,242,255,234,255,224,12,0,4,4,0,64,255,239,
+    255,228,56,0,32,255,254,174,44,0,84,0,0,118,1,0,18,0,240,1,0,0,255,231,255,234,0,0,255,252,255,188,255,187,255,191,50,0,0,148,0,224,0,28,0,0,255,176,255,166,255,156,255,156,0,30,22,
+    0,17,0,176,114,4,50,1,16,255,100,9,3,23,0,0,7,0,19,255,190,40,32,255,245,26,2,0,18,0,4,4,0,8,138,0,0,118,0,4,24,0,15,8,0,5,32,255,250,90,2,0,6,0,10,228,2,2,48,0,1,188,1,32,236,255,
+    128,44,2,17,0,15,6,0,2,4,238,1,1,74,0,16,245,112,1,96,255,195,255,210,255,202,148,1,0,94,1,1,8,0,80,236,255,244,255,228,158,0,2,108,0,0,73,0,0,218,2,1,8,0,16,235,20,1,0,10,0,2,4,0,
+    35,255,253,8,0,208,235,255,235,255,210,255,232,255,222,0,0,255,220,134,0,20,255,6,43,3,158,42,0,254,0,15,230,0,11,0,124,0,2,78,0,15,6,0,29,2,86,3,8,54,0,34,255,246,234,0,160,255,162,
+    255,210,255,190,255,236,255,236,36,0,1,192,1,127,0,255,246,255,218,255,206,112,0,20,0,214,46,1,89,0,36,255,236,84,0,0,15,0,0,58,1,97,0,10,0,0,255,254,10,0,0,19,0,1,254,116,66,255,246,
+    255,221,122,0,1,42,153,19,0,196,2,0,8,0,48,231,255,216,124,7,113,0,0,255,188,255,206,255,16,42,1,168,8,178,30,0,30,255,172,255,146,255,166,255,176,71,0,1,204,48,3,11,0,80,255,251,255,
+    246,255,70,40,3,16,0,10,7,0,64,255,224,255,236,138,4,0,220,0,66,0,0,255,221,30,0,1,238,0,0,18,39,2,15,0,18,0,130,4,15,188,1,12,49,220,255,227,188,1,0,6,6,32,0,255,208,40,3,62,0,0,7,
+    0,4,188,1,1,218,0,5,18,1,0,26,0,1,4,0,49,2,0,6,8,0,1,5,0,96,255,206,255,252,255,220,11,0,0,46,0,1,254,2,16,20,246,3,1,18,0,18,252,90,3,0,12,0,15,4,0,15,48,255,202,255,30,26,15,41,0,
+    12,1,198,4,163,232,0,0,255,163,255,188,255,202,255,110,45,225,255,232,255,178,255,248,255,210,255,220,255,162,255,162,67,0,240,22,18,255,212,0,0,255,190,0,0,255,146,0,20,0,10,255,242,
+    255,254,255,252,255,176,255,222,255,176,255,192,255,170,0,0,255,200,255,234,160,0,96,255,192,255,187,255,222,46,0,0,56,0,208,255,252,255,218,255,254,255,232,255,227,255,200,255,154,
+    41,49,0,0,10,224,2,2,78,0,48,20,0,20,52,0,160,0,0,255,196,255,252,255,216,255,234,130,0,64,255,182,255,230,40,3,101,255,182,255,191,255,196,140,6,16,244,64,0,224,255,222,255,222,255,
+    182,255,182,0,18,0,10,0,30,102,0,1,50,0,48,172,0,20,130,4,128,0,28,0,28,255,176,255,226,54,0,32,255,197,128,0,15,4,0,0,4,118,4,3,27,0,66,255,222,255,242,210,5,1,17,0,0,52,40,0,112,
+    2,32,226,255,196,18,1,166,2,0,24,0,2,36,2,0,10,0,9,4,0,7,126,5,99,0,0,255,212,255,232,206,0,7,64,2,4,48,0,0,32,4,0,12,0,33,255,237,0,156,3,78,3,0,18,0,1,4,0,2,148,46,243,4,15,0,15,
+    255,237,255,247,255,245,255,250,255,214,0,14,0,0,255,210,80,2,113,30,0,28,0,18,0,0,122,3,3,150,7,35,255,239,88,4,14,84,2,32,0,255,196,14,24,4,182,0,0,234,2,4,74,2,1,114,0,0,230,0,3,
+    168,0,40,255,221,184,0,0,2,6,1,16,0,16,10,6,0,65,255,254,255,254,20,3,48,244,255,255,148,2,3,132,0,0,152,5,1,76,46,2,194,3,0,156,4,4,226,0,2,94,0,15,24,8,8,18,210,24,8,3,40,0,6,24,
+    8,3,216,0,2,24,0,0,6,0,0,36,1,32,255,244,6,0,0,14,0,0,4,0,33,255,236,78,2,48,224,255,232,140,0,128,255,190,255,212,255,192,255,236,124,3,0,30,0,15,4,0,0,9,162,1,15,32,0,0,15,19,0,5,
+    15,56,0,2,65,255,226,255,211,234,0,17,246,200,6,0,100,7,48,224,0,0,172,2,64,0,0,255,194,248,3,128,255,236,255,146,255,190,255,172,59,49,4,91,0,0,14,0,32,255,172,6,0,3,18,0,0,242,42,
+    3,11,0,5,7,0,15,112,0,1,0,212,2,2,24,2,49,0,0,49,42,0,0,48,40,1,9,0,6,5,0,0,90,5,0,216,1,39,255,236,2,5,2,220,1,2,160,1,2,202,2,0,76,0,3,53,0,33,255,172,120,40,3,14,0,2,7,0,0,60,0,
+    0,218,0,1,70,3,2,19,0,8,6,0,2,74,0,1,66,7,8,23,0,15,12,0,5,33,255,202,110,2,0,104,7,24,156,36,0,0,176,3,0,16,0,65,255,202,255,202,220,4,5,114,48,7,30,1,0,33,0,1,4,0,0,20,0,35,255,204,
+    14,5,27,220,74,0,17,224,64,0,48,0,255,206,50,5,65,0,0,0,26,51,0,0,248,0,0,124,1,4,13,0,3,8,0,2,222,0,32,255,216,150,0,32,255,246,120,8,0,236,0,2,4,0,65,255,254,255,246,48,4,112,246,
+    255,236,255,170,255,192,118,0,3,55,0,15,7,0,4,3,118,3,14,2,7,0,84,45,3,52,0,64,255,222,255,252,232,4,0,108,8,3,19,0,7,7,0,2,212,0,2,17,0,10,54,3,2,20,0,0,6,0,32,255,244,56,6,1,46,9,
+    56,216,255,196,4,3,0,30,0,9,4,0,22,20,114,10,0,178,3,8,28,0,4,166,7,65,255,250,255,248,148,0,3,242,3,8,36,0,10,12,0,0,254,3,1,80,2,37,238,255,70,50,9,206,2,32,238,255,206,23,3,162,
+    7,1,160,4,112,202,0,36,0,40,0,4,24,6,0,76,0,0,88,1,0,8,0,1,4,0,32,8,0,238,46,1,11,0,1,10,54,50,0,0,11,13,0,9,6,0,2,254,2,0,32,0,153,73,0,65,0,43,0,33,0,41,32,0,15,13,0,16,68,255,192,
+    255,234,44,6,15,47,0,7,64,255,224,255,202,152,1,1,230,0,35,0,255,148,159,0,54,1,130,255,206,255,214,255,224,255,248,208,4,2,66,0,0,92,6,0,174,5,32,255,254,212,0,2,132,1,0,68,2,2,30,
+    0,4,6,0,2,24,0,4,14,0,15,8,0,7,0,120,0,4,30,0,0,80,0,3,12,0,17,2,174,55,145,13,0,0,0,15,0,34,0,13,76,1,255,10,33,0,52,0,79,0,38,0,83,0,107,0,66,0,109,0,113,0,91,0,115,0,144,0,96,34,
+    44,2,241,6,205,0,160,0,207,0,232,0,180,0,234,0,238,0,206,0,240,0,253,0,211,52,44,17,225,52,44,17,228,4,44,17,231,4,44,241,28,232,1,87,1,87,0,235,1,90,1,92,0,236,1,95,1,95,0,239,1,97,
+    1,97,0,240,1,99,1,99,0,241,1,101,1,113,0,242,1,171,1,172,0,255,248,43,17,1,248,43,49,5,0,2,194,57,241,12,11,0,8,0,12,0,13,0,5,0,15,0,20,0,17,0,21,0,24,0,29,0,25,0,34,0,5,184,0,145,
+    24,0,52,0,53,0,46,0,54,172,167,241,32,56,0,61,0,16,0,62,0,68,0,13,0,69,0,78,0,1,0,79,0,79,0,5,0,83,0,86,0,28,0,87,0,92,0,15,0,93,0,97,0,23,0,98,0,107,0,9,232,0,241,82,22,0,115,0,119,
+    0,21,0,120,0,123,0,27,0,124,0,124,0,1,0,125,0,135,0,7,0,136,0,137,0,4,0,138,0,138,0,2,0,139,0,144,0,14,0,146,0,146,0,2,0,147,0,147,0,43,0,149,0,158,0,4,0,159,0,159,0,42,0,160,0,164,
+    0,20,0,165,0,166,0,10,0,167,0,175,0,3,0,176,0,177,0,31,0,178,0,179,0,39,88,45,17,43,193,157,241,22,10,0,193,0,202,0,2,0,203,0,203,0,4,0,204,0,205,0,2,0,207,0,210,0,26,0,211,0,217,0,
+    11,0,218,0,222,0,6,84,1,240,29,18,0,240,0,244,0,12,0,245,0,248,0,25,0,250,0,250,0,19,0,251,0,251,0,6,0,252,0,252,0,42,0,253,0,253,0,3,0,255,0,255,0,6,1,87,59,192,12,1,1,1,1,0,3,1,3,
+    1,3,0,10,57,145,4,0,6,1,5,1,5,0,12,138,1,80,34,1,81,1,81,140,24,65,1,83,0,32,144,1,209,32,1,90,1,91,0,34,1,92,1,92,0,44,150,1,17,33,150,1,17,33,150,1,241,52,33,1,101,1,103,0,30,1,104,
+    1,104,0,41,1,105,1,105,0,40,1,106,1,106,0,41,1,107,1,107,0,40,1,108,1,108,0,38,1,109,1,109,0,37,1,110,1,110,0,36,1,111,1,111,0,37,1,112,1,112,0,36,1,113,1,113,0,38,210,1,16,35,210,
+    1,16,0,210,1,241,4,220,0,3,1,221,1,221,0,31,1,232,1,235,0,19,1,236,1,239,120,161,113,68,0,1,0,13,0,6,222,1,17,2,216,1,17,11,216,1,17,2,216,1,209,36,0,69,0,79,0,2,0,82,0,82,0,2,192,
+    1,17,14,192,1,17,21,192,1,17,10,192,1,17,20,192,1,17,19,192,1,17,23,192,1,113,2,0,125,0,137,0,5,186,1,64,4,0,139,0,238,56,0,168,1,17,12,168,1,17,18,168,1,0,168,31,49,175,0,9,168,1,
+    49,25,0,178,110,31,0,99,159,83,7,0,193,0,203,200,59,49,7,0,205,130,31,16,206,42,130,1,168,1,145,7,0,211,0,216,0,13,0,217,150,31,0,174,1,113,3,0,223,0,232,0,8,180,1,17,16,180,1,17,15,
+    180,1,113,22,0,249,0,249,0,1,186,1,17,17,186,1,113,3,0,252,1,2,0,12,32,3,17,3,150,1,17,28,150,1,113,35,1,82,1,83,0,26,150,1,17,26,150,1,17,28,150,1,241,4,35,1,96,1,96,0,27,1,98,1,98,
+    0,27,1,100,1,100,0,27,150,1,17,24,150,1,17,34,150,1,17,33,150,1,17,34,150,1,17,33,150,1,17,32,150,1,17,31,150,1,17,30,150,1,17,31,150,1,17,30,150,1,17,32,104,3,209,29,1,215,1,219,0,
+    2,1,220,1,220,0,9,150,1,113,25,1,222,1,231,0,1,156,1,17,17,156,1,16,3,85,2,107,0,10,1,86,2,148,116,60,0,178,14,4,116,60,17,228,116,60,17,228,116,60,17,228,116,60,17,96,116,60,17,140,
+    116,60,17,184,116,60,16,228,116,60,16,1,90,10,49,255,0,19,14,51,177,2,0,3,0,4,0,5,0,6,0,11,220,3,0,50,60,176,16,0,17,0,18,0,19,0,20,0,21,64,16,5,44,0,4,42,0,31,7,44,0,24,31,8,44,0,
+    24,31,9,44,0,10,1,210,52,15,174,0,32,0,28,22,0,182,4,14,218,0,112,23,97,97,108,116,0,140,77,150,224,0,148,99,99,109,112,0,154,100,108,105,103,0,160,170,154,241,5,0,166,102,114,97,99,
+    0,172,108,105,103,97,0,200,108,111,99,108,0,206,6,0,17,212,6,0,17,218,6,0,16,224,122,154,240,0,0,230,111,114,100,110,0,236,112,110,117,109,0,242,115,84,0,112,248,115,105,110,102,0,
+    254,55,158,240,22,1,4,115,115,48,50,1,14,115,115,48,51,1,24,115,115,48,52,1,34,115,117,98,115,1,44,115,117,112,115,1,50,116,110,117,109,1,214,59,0,200,11,0,236,61,51,1,0,47,154,1,19,
+    0,36,50,0,202,61,17,0,158,1,241,4,15,0,17,0,19,0,21,0,23,0,25,0,27,0,29,0,31,0,33,88,7,0,154,63,0,46,0,17,5,58,0,0,82,14,0,211,162,0,18,0,0,252,58,0,138,174,0,12,0,17,37,30,0,17,38,
+    6,0,0,144,61,144,1,0,48,0,6,0,1,0,43,29,0,1,10,0,81,44,0,0,1,1,10,0,64,45,0,0,1,156,14,97,1,0,46,0,0,1,6,54,17,0,44,55,1,20,13,243,88,1,0,39,0,49,0,100,1,50,1,228,2,38,2,38,2,98,2,
+    64,2,64,2,98,9,22,2,118,6,88,6,144,2,172,4,214,4,234,6,88,5,4,6,88,5,32,6,88,5,62,6,88,5,94,6,88,5,128,6,88,5,164,6,88,5,202,6,88,5,242,6,88,6,28,6,88,6,102,6,144,6,158,6,192,6,216,
+    6,230,7,36,7,112,8,90,8,160,8,194,8,228,8,248,9,22,16,1,0,172,53,240,81,100,0,47,0,124,1,215,1,216,1,217,1,218,1,219,0,92,0,97,0,249,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,
+    1,230,1,231,0,250,1,232,1,233,1,234,1,235,0,171,0,216,0,251,1,236,1,237,1,239,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,212,1,213,1,183,1,240,1,246,1,243,1,0,64,242,81,47,0,
+    36,0,37,0,38,0,39,0,40,0,82,0,90,0,96,0,125,0,126,0,127,0,128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,160,0,161,0,162,0,163,0,164,0,167,0,214,0,218,0,219,0,220,0,222,1,18,1,19,
+    1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,97,1,98,1,171,1,190,1,198,1,241,1,242,0,70,1,0,192,63,240,16,154,0,11,0,28,0,34,0,46,0,58,0,70,0,82,0,94,0,106,0,118,0,130,0,142,0,2,0,222,
+    1,238,188,62,240,53,1,28,1,38,1,48,1,58,0,5,1,19,1,29,1,39,1,49,1,59,0,5,1,20,1,30,1,40,1,50,1,60,0,5,1,21,1,31,1,41,1,51,1,61,0,5,1,22,1,32,1,42,1,52,1,62,0,5,1,23,1,33,1,43,1,53,
+    1,63,0,63,241,39,1,34,1,44,1,54,1,64,0,5,1,25,1,35,1,45,1,55,1,65,0,5,1,26,1,36,1,46,1,56,1,66,0,5,1,27,1,37,1,47,1,57,1,67,0,2,0,2,0,221,0,221,0,0,104,52,0,10,2,0,28,66,51,10,0,28,
+    250,64,17,74,16,2,0,150,1,19,3,18,0,113,56,0,2,0,20,0,28,162,4,0,36,63,96,2,1,197,1,198,0,174,165,16,184,1,136,1,24,0,0,180,64,32,2,0,234,32,1,74,65,33,0,2,74,168,0,70,0,2,26,0,49,
+    14,0,4,208,1,113,216,0,222,0,1,0,4,122,1,16,214,142,135,1,170,2,0,48,1,17,6,128,63,0,240,65,6,54,0,113,30,0,12,1,58,1,59,76,168,240,0,62,1,63,1,64,1,65,1,66,1,67,1,212,1,213,200,0,
+    1,194,0,113,0,1,97,1,98,0,10,100,17,1,108,0,192,2,48,0,24,0,16,0,24,0,2,0,40,166,29,16,1,136,66,21,1,48,0,80,1,1,93,1,93,144,135,240,34,0,23,0,48,0,78,0,108,0,136,0,164,0,190,0,216,
+    0,240,1,8,1,30,1,52,1,72,1,92,1,110,1,128,1,144,1,160,1,174,1,188,1,200,1,212,1,222,1,232,0,80,67,0,253,7,10,4,0,0,180,57,2,233,9,0,132,3,10,28,0,2,14,0,0,246,3,16,10,84,58,11,4,0,
+    8,58,0,15,32,0,3,59,0,0,9,52,0,0,200,0,0,32,1,0,114,0,31,1,30,0,2,0,110,21,2,120,0,4,6,0,8,104,0,0,106,1,4,24,0,0,8,0,0,156,0,25,7,100,0,8,46,0,12,26,0,17,0,56,4,0,56,0,0,4,0,8,42,
+    0,0,100,4,0,20,0,0,4,0,0,84,0,21,5,84,0,8,38,0,8,22,0,0,16,20,0,46,0,10,210,0,0,96,2,0,22,0,0,68,0,0,20,7,10,30,0,4,18,0,0,178,2,10,26,0,0,102,0,0,52,0,10,22,0,0,14,0,0,249,4,0,82,
+    0,2,4,0,0,84,137,0,64,1,0,42,2,80,1,0,6,255,231,168,0,37,1,93,62,2,1,192,3,97,4,50,0,1,1,96,216,2,27,16,26,0,113,24,0,2,1,60,1,70,28,0,26,18,28,0,96,3,252,0,3,1,32,164,3,1,30,0,27,
+    20,30,0,81,222,0,4,1,2,2,0,0,126,69,59,0,0,22,32,0,83,190,0,5,0,226,2,0,0,116,48,59,0,0,24,34,0,85,156,0,6,0,192,2,0,17,202,102,0,27,26,36,0,87,120,0,7,0,156,2,0,0,108,67,0,102,138,
+    2,48,6,18,8,210,3,105,3,82,0,8,0,118,2,0,17,128,78,0,27,30,78,0,91,42,0,9,0,78,2,0,17,88,42,0,27,32,42,0,0,72,19,29,36,2,0,17,46,44,0,17,34,44,4,49,48,1,57,236,3,32,1,1,132,10,0,150,
+    1,119,8,0,1,2,196,0,40,74,0,96,1,0,18,0,1,2,94,21,0,164,1,17,36,180,3,81,38,1,47,0,0,234,56,0,36,3,4,56,0,48,140,0,30,196,14,3,44,69,19,20,8,0,128,4,1,180,0,3,0,193,1,128,70,49,1,0,
+    63,126,0,4,234,1,17,246,134,0,18,18,92,62,1,138,0,0,128,0,55,68,0,10,72,0,16,46,50,60,1,78,0,0,102,68,145,2,0,240,0,3,0,8,0,14,200,38,145,2,0,167,1,4,0,2,0,218,44,13,0,176,61,87,2,
+    0,159,0,218,62,0,17,62,134,0,209,6,0,14,0,22,0,30,0,36,0,42,0,48,54,12,49,159,0,167,0,171,64,159,0,180,0,66,31,32,159,1,152,2,32,167,1,138,5,48,180,0,255,84,0,0,134,2,34,0,159,158,
+    1,1,164,3,145,180,0,29,0,64,0,68,0,72,194,69,241,2,84,0,88,0,92,0,96,0,100,0,104,0,108,0,112,0,116,198,69,241,0,128,0,132,0,136,0,140,0,144,0,148,0,152,0,156,110,11,81,168,0,172,0,
+    176,96,71,96,1,1,215,0,1,1,238,35,0,248,62,80,218,0,1,1,219,134,68,240,4,0,1,1,222,0,1,1,223,0,1,1,224,0,1,1,225,0,1,1,86,36,240,0,227,0,1,1,228,0,1,1,229,0,1,1,230,0,1,158,10,32,0,
+    250,162,10,160,0,1,1,233,0,1,1,234,0,1,114,61,0,62,71,240,3,1,236,0,1,1,237,0,1,1,238,0,1,1,239,0,1,1,183,58,71,65,0,2,0,7,74,12,17,0,62,12,17,5,212,13,17,6,148,0,17,17,104,13,179,
+    22,1,171,1,171,0,27,1,190,1,190,76,6,0,154,1,0,164,5,22,17,246,7,15,240,7,3,32,1,183,4,71,3,94,0,0,44,14,17,5,76,0,21,16,224,1,87,2,0,16,0,5,22,8,0,14,4,0,124,12,0,46,2,0,4,0,0,94,
+    8,0,34,0,2,42,8,48,238,1,239,12,2,1,150,0,0,30,0,0,4,0,0,116,1,49,6,1,137,136,1,0,0,64,2,20,0,85,2,0,12,0,3,60,8,19,3,228,7,0,156,2,0,188,0,0,60,7,16,20,74,0,2,136,6,175,0,0,1,244,
+    0,50,2,133,0,14,4,0,21,64,3,129,0,9,4,0,143,2,117,0,87,2,217,0,43,4,0,2,117,194,0,87,2,194,0,18,8,0,63,63,0,87,4,0,18,125,31,0,87,2,238,0,43,4,0,179,193,0,87,2,193,0,4,0,246,0,87,4,
+    0,240,14,3,0,246,0,1,0,246,0,73,0,246,0,18,0,246,0,7,0,246,0,48,0,246,255,240,1,254,0,20,4,0,64,2,104,0,87,4,0,47,1,253,4,0,2,127,16,3,71,0,87,2,201,4,0,3,79,3,1,0,43,4,0,17,128,4,
+    130,0,43,2,102,0,87,4,0,0,48,0,73,2,128,0,87,4,0,63,51,0,35,4,0,2,61,25,0,12,4,0,63,181,0,82,4,0,18,124,129,0,10,3,211,0,15,4,0,141,2,100,0,14,2,63,0,10,4,0,57,68,0,41,4,0,127,245,
+    0,43,2,10,0,47,4,0,21,34,3,108,4,0,143,2,72,0,72,2,8,0,38,4,0,2,83,72,0,38,2,67,8,0,0,4,0,31,16,4,0,19,141,1,41,0,18,2,72,0,39,4,0,240,32,50,0,72,2,50,0,11,0,213,0,55,0,213,0,72,0,
+    213,255,243,0,213,255,240,0,213,0,56,0,213,0,1,0,213,255,247,0,213,0,30,0,213,255,223,0,213,255,199,4,0,64,1,226,0,75,4,0,41,0,219,4,0,49,59,1,74,16,0,49,13,3,74,84,0,0,88,0,14,4,0,
+    63,56,0,38,4,0,17,33,3,185,228,0,17,72,12,1,115,72,0,38,1,89,0,72,4,0,159,60,1,89,0,56,1,178,0,31,4,0,1,140,2,51,0,72,1,42,0,18,4,0,79,2,41,0,66,4,0,17,140,1,230,0,9,2,230,0,14,4,0,
+    141,1,199,0,10,1,215,0,9,4,0,56,187,0,39,4,0,240,81,2,75,0,38,2,17,0,34,1,64,0,18,2,84,0,18,3,60,0,18,3,55,0,18,2,80,0,18,2,252,0,18,2,17,0,18,2,11,0,18,2,23,0,18,2,81,0,18,3,3,0,18,
+    2,128,0,74,2,90,0,19,2,171,0,55,1,78,0,35,2,50,0,45,2,56,0,39,2,115,0,40,2,71,0,54,2,91,0,46,1,248,0,9,2,100,0,51,12,0,240,8,2,148,0,48,2,148,0,117,2,148,0,96,2,148,0,81,2,148,0,40,
+    2,148,0,28,16,241,34,74,2,148,0,87,2,148,0,76,2,148,0,74,1,160,0,31,0,218,0,21,1,88,0,28,1,90,0,22,1,120,0,21,1,97,0,22,1,117,0,28,1,66,0,16,1,112,0,28,12,0,241,20,91,0,29,0,194,0,
+    20,1,27,0,22,1,20,0,21,1,46,0,15,1,35,0,24,1,52,0,29,1,1,0,12,1,40,0,27,12,0,15,40,0,21,27,159,120,0,31,116,120,0,3,240,53,0,117,255,53,2,122,0,20,2,91,0,20,2,133,0,21,2,135,0,20,2,
+    177,0,21,2,192,0,24,2,118,0,12,1,147,0,29,3,110,0,29,1,93,0,0,1,19,0,51,1,120,0,51,1,26,0,78,1,6,0,68,2,180,0,68,1,15,0,73,4,0,65,2,163,0,47,20,0,241,0,3,0,34,2,3,0,34,1,61,0,46,0,
+    176,0,46,44,0,240,32,93,0,0,2,6,0,60,1,36,0,45,1,36,0,5,0,255,0,52,0,255,0,5,0,254,0,52,0,254,0,0,4,114,0,66,3,159,0,66,1,162,0,64,2,82,0,40,4,0,35,1,117,4,0,52,151,0,61,4,0,38,0,245,
+    4,0,193,1,21,0,0,2,38,0,48,2,116,0,52,116,4,243,4,143,0,28,2,45,0,42,2,97,0,32,2,81,0,20,2,148,0,80,4,0,19,104,8,0,4,16,0,15,8,0,9,240,10,75,3,33,0,27,3,91,0,56,1,115,0,30,2,152,0,
+    42,2,161,0,87,2,21,0,26,242,8,1,188,2,243,18,110,0,57,3,141,0,48,5,14,0,48,2,234,0,60,3,69,0,60,3,144,0,60,3,67,0,60,2,226,0,60,3,70,16,0,210,63,0,60,4,30,0,60,2,47,0,60,3,132,4,0,
+    99,2,92,0,60,3,62,4,0,83,198,0,60,3,200,24,0,242,10,229,0,31,3,139,0,42,2,170,0,46,2,60,0,29,1,210,0,39,3,49,0,40,1,224,4,0,193,2,124,0,26,1,7,0,14,1,55,0,127,4,0,241,36,42,0,25,1,
+    43,0,25,3,11,0,60,4,215,0,87,1,229,0,76,0,174,0,48,2,90,0,40,1,112,0,61,0,198,0,49,0,218,0,42,0,220,0,45,1,80,0,42,1,63,0,40,4,0,209,87,0,49,1,38,0,39,1,115,0,46,1,96,244,180,209,43,
+    0,184,0,40,0,229,0,38,1,243,0,40,48,0,0,36,0,19,63,20,0,0,56,0,7,80,0,1,76,0,0,56,0,52,191,0,41,72,0,193,0,212,0,48,0,212,0,5,6,203,0,100,108,5,7,4,0,0,36,6,3,208,4,17,199,148,3,0,
+    152,3,15,4,0,13,48,17,0,34,188,3,4,4,0,64,1,45,0,18,200,3,4,4,0,240,17,2,79,1,56,1,232,0,72,0,232,0,20,1,79,0,20,2,201,0,7,1,121,0,20,1,243,255,196,0,198,0,47,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,
+    171,171,171,216,216,216,98,98,98,141,141,141,235,235,235,218,218,218,150,150,150,38,38,38,250,250,250,22,22,22,100,100,100,8,8,8,140,140,140,103,103,103,0,0,0,73,73,73,37,37,37,146,
+    146,146,219,219,219,109,109,109,255,255,255,10,10,10,254,254,254,126,126,126,113,113,113,226,226,226,24,24,24,58,58,58,108,108,108,39,39,39,36,36,36,218,218,218,36,36,36,71,71,71,72,
+    72,72,103,103,103,104,104,104,217,217,217,37,37,37,103,103,103,109,109,109,68,68,68,87,87,87,145,145,145,197,197,197,35,35,35,67,67,67,69,69,69,69,69,69,35,35,35,138,138,138,215,215,
+    215,87,87,87,145,145,145,27,27,27,216,216,216,8,8,8,106,106,106,136,136,136,10,10,10,10,10,10,10,10,10,35,35,35,58,58,58,69,14,143,131,0,0,0,64,116,82,78,83,31,89,24,154,159,31,89,
+    85,209,146,87,41,207,139,0,253,253,253,252,253,1,253,253,3,254,254,15,16,172,15,175,207,206,176,206,77,115,178,47,46,210,78,14,176,46,114,47,110,142,145,108,110,40,208,45,146,75,140,
+    48,115,174,207,80,46,195,147,196,229,0,0,10,185,73,68,65,84,120,218,237,221,13,83,226,58,20,6,224,182,124,40,172,55,138,68,11,45,31,130,32,32,136,186,136,46,238,174,252,255,127,117,
+    91,16,154,150,164,176,67,197,230,240,190,51,247,206,172,222,117,231,250,236,73,114,146,180,26,12,33,29,3,223,2,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,
+    8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,
+    0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,95,28,110,219,54,128,233,102,137,203,1,76,54,150,85,180,156,35,19,62,30,96,206,242,211,82,
+    169,148,177,142,75,216,56,30,223,159,165,69,206,122,71,37,124,44,192,54,123,57,91,2,151,50,24,162,73,2,127,22,176,151,30,179,213,117,14,96,93,71,232,204,26,56,175,2,182,9,18,31,99,
+    5,231,229,138,222,7,93,139,28,241,241,84,112,0,252,83,81,193,238,207,225,52,211,169,163,130,245,172,224,252,26,56,35,43,82,206,94,150,131,248,25,173,62,138,22,176,109,115,155,43,128,
+    45,1,56,118,146,30,222,83,18,166,4,204,131,165,146,4,248,125,13,60,148,212,168,205,122,235,207,191,51,27,192,169,140,115,59,155,21,45,5,190,181,234,131,75,83,73,137,238,180,202,6,240,
+    247,214,111,175,86,174,84,202,253,162,194,39,19,83,162,54,123,153,110,93,132,1,248,123,99,213,42,101,47,149,242,173,28,40,14,88,92,100,151,110,1,156,202,101,242,109,121,153,74,255,
+    69,34,180,101,12,190,31,6,83,180,141,69,86,42,51,171,172,132,107,22,143,221,233,40,70,5,185,208,68,209,154,130,73,2,151,43,157,77,163,112,35,108,171,199,239,169,129,62,56,157,67,116,
+    0,92,150,76,195,161,62,41,166,73,150,111,131,0,56,5,192,189,114,80,194,155,211,176,136,56,172,71,71,232,89,137,102,23,76,171,77,234,4,37,92,169,213,55,166,89,99,170,108,132,235,103,
+    1,190,203,24,128,211,25,183,38,8,111,78,195,238,122,161,60,13,215,183,247,87,163,180,237,168,9,192,169,24,164,251,177,211,240,80,53,12,215,131,37,214,240,158,161,130,211,223,10,203,
+    166,97,177,17,14,109,118,121,191,173,36,236,98,113,0,167,88,56,52,13,135,187,97,91,117,34,44,202,159,189,48,27,192,41,94,103,217,234,105,88,108,132,69,96,241,28,137,90,143,196,200,
+    157,7,179,177,114,26,182,89,81,177,89,21,20,112,137,92,1,83,187,209,17,51,13,219,204,158,74,150,202,156,245,166,91,11,152,251,1,112,74,166,97,65,184,118,31,26,192,243,146,59,27,187,
+    156,35,113,225,223,0,254,238,212,195,211,176,192,194,173,229,96,60,125,23,63,106,9,231,72,134,130,215,48,243,35,77,47,242,144,3,142,116,195,225,75,238,247,249,76,102,248,83,60,14,228,
+    194,192,45,63,71,226,204,157,52,47,47,47,187,35,45,133,233,85,112,120,26,158,69,85,28,35,50,216,186,193,85,30,217,125,74,206,140,183,203,170,7,92,109,106,121,204,68,240,218,172,56,
+    13,87,106,145,207,241,229,63,34,224,48,102,137,229,85,180,217,244,121,125,225,110,78,67,97,138,247,162,185,85,171,40,128,101,127,29,222,213,5,236,253,122,114,249,233,235,101,4,224,
+    148,148,240,203,106,26,174,252,183,181,177,93,45,163,167,121,137,175,55,60,11,65,5,31,18,209,191,230,30,51,13,47,47,224,245,239,118,249,98,239,153,225,48,255,46,91,61,55,171,34,176,
+    1,224,3,102,241,156,152,242,49,193,219,126,197,75,191,184,11,9,103,178,62,215,251,165,121,41,250,86,179,58,30,21,107,10,124,127,91,171,213,58,189,152,237,135,113,199,251,15,172,29,
+    39,109,123,115,56,136,14,207,158,117,30,171,232,67,197,157,249,245,89,41,255,215,83,149,177,188,42,255,101,6,136,12,207,213,166,137,62,248,80,171,100,86,92,174,161,60,226,218,173,203,
+    164,143,35,241,141,134,232,159,254,132,208,234,121,209,35,141,244,28,235,52,4,182,217,124,189,87,229,19,119,230,254,152,157,236,223,32,35,27,25,158,223,12,236,69,31,14,88,216,170,242,
+    31,85,233,207,6,108,143,114,149,100,20,29,158,243,218,62,248,175,63,240,231,72,157,220,251,53,120,100,245,188,216,134,214,246,34,128,150,192,194,13,232,181,113,63,118,77,253,79,190,
+    249,136,239,155,206,79,132,107,185,200,178,103,81,224,5,241,236,37,145,247,20,214,179,161,238,247,210,212,250,189,44,122,174,162,239,107,101,25,113,185,214,75,96,124,48,154,161,225,
+    217,208,251,189,59,154,110,116,88,29,25,177,247,161,226,190,26,30,176,88,190,217,156,230,215,240,180,221,170,116,111,23,207,243,71,133,107,214,222,195,67,176,195,225,111,110,232,126,
+    205,82,87,96,255,219,222,251,79,66,188,247,227,249,156,189,85,131,225,153,235,126,141,86,223,195,134,5,113,177,31,53,238,236,15,156,235,86,171,139,225,153,194,147,194,58,159,7,47,206,
+    7,138,145,145,122,255,23,108,112,102,101,188,117,86,215,36,241,86,67,189,15,252,109,127,135,242,101,214,95,47,184,252,171,208,60,129,177,225,125,100,228,104,188,181,82,251,27,29,126,
+    189,190,172,215,212,225,123,178,251,140,254,84,94,74,74,224,202,142,79,108,45,214,212,149,114,39,161,67,7,155,115,34,15,41,145,184,147,181,192,232,117,102,157,30,67,40,2,51,198,108,
+    80,210,6,246,215,212,71,248,99,175,142,9,24,1,112,18,179,189,110,203,47,0,239,230,202,197,71,132,109,0,147,145,245,11,86,184,12,148,51,140,145,97,233,212,35,3,120,75,247,181,252,46,
+    229,114,35,211,156,188,117,187,254,89,113,115,226,162,130,41,248,250,21,59,26,153,19,15,182,233,195,86,253,232,118,199,18,192,106,95,195,92,20,236,26,86,72,30,192,4,124,223,46,163,
+    174,193,53,120,109,38,97,221,129,253,221,141,47,250,102,79,20,186,139,171,30,218,188,21,222,32,1,91,175,59,201,23,112,51,6,184,91,71,5,127,25,173,80,58,117,119,60,24,60,62,181,90,237,
+    214,211,60,97,96,243,82,157,234,4,115,240,151,198,189,27,15,30,61,216,118,251,124,157,246,56,89,224,81,140,111,51,199,1,252,85,25,60,133,97,215,105,37,57,108,218,44,39,29,162,23,11,
+    234,174,70,151,181,116,3,182,90,231,202,156,36,185,135,200,67,139,172,117,167,212,236,190,189,153,6,118,178,190,42,78,140,239,249,99,178,192,118,182,90,93,193,54,61,88,115,98,230,70,
+    182,187,218,3,1,240,23,172,175,216,224,60,22,56,217,215,181,219,147,110,179,219,205,78,76,115,52,18,190,79,122,29,39,105,6,252,20,7,60,72,246,152,199,103,180,114,162,235,226,176,80,
+    179,57,77,179,33,58,14,184,149,120,47,204,5,88,93,119,130,52,171,224,71,181,111,123,254,5,127,162,254,119,43,53,3,30,43,112,219,173,199,58,67,8,180,73,143,81,216,167,199,199,193,124,
+    236,66,146,202,70,199,73,107,5,59,24,140,93,71,168,110,132,4,48,115,198,243,185,21,84,44,199,109,89,98,192,235,146,5,44,81,96,184,30,71,5,35,0,222,171,1,230,52,30,48,4,176,220,119,
+    181,130,3,48,81,223,156,153,53,77,155,225,37,44,41,91,127,37,229,107,158,94,123,57,157,188,51,221,141,13,232,202,124,175,63,115,250,102,104,78,76,170,130,199,243,187,68,124,221,236,
+    117,144,174,201,117,59,3,38,10,60,246,55,49,91,243,189,175,91,120,19,240,233,181,152,83,51,167,111,25,19,1,182,131,99,136,249,254,21,156,187,142,228,52,171,45,49,149,10,118,159,18,
+    187,92,185,81,193,139,100,205,123,45,137,137,0,143,219,9,94,174,228,44,123,45,201,98,164,230,0,254,142,60,38,122,53,203,43,97,169,176,87,198,250,189,92,152,2,176,251,148,240,221,59,
+    206,70,10,225,83,237,132,9,0,143,35,143,57,36,208,42,249,63,182,48,123,74,66,88,115,96,155,109,220,195,59,73,66,192,191,69,121,111,202,202,216,4,240,65,125,221,232,69,218,164,46,223,
+    249,196,142,185,89,198,89,0,127,231,240,220,30,36,247,181,23,61,209,200,60,69,5,167,100,245,236,247,192,227,68,191,252,130,216,8,143,212,121,0,127,215,234,249,252,252,201,73,252,207,
+    240,141,141,92,48,82,103,93,0,31,42,243,246,198,179,73,95,145,229,72,61,89,150,177,126,63,198,65,95,224,187,136,111,107,191,246,232,119,225,79,225,151,138,216,67,181,204,108,54,59,
+    49,176,209,113,160,112,86,136,12,207,238,62,251,27,63,254,92,249,41,196,173,169,89,114,63,255,18,192,219,83,111,109,93,61,59,15,141,198,243,201,78,95,109,233,123,117,245,59,126,164,
+    198,97,195,225,98,181,183,173,158,239,26,23,126,158,119,88,121,253,186,90,229,215,182,217,24,192,135,90,66,183,66,195,179,164,126,151,190,23,23,15,59,76,192,107,224,191,63,24,173,104,
+    251,34,180,160,7,86,108,110,124,124,250,94,220,56,255,0,124,245,7,192,41,43,225,150,226,10,199,170,128,47,46,54,150,215,142,122,136,142,155,134,1,124,224,101,150,191,142,110,63,41,
+    30,13,126,189,80,0,59,31,141,155,198,195,171,124,145,181,109,26,6,240,97,91,225,193,96,172,250,92,97,237,123,19,194,172,55,36,31,12,149,48,173,105,88,103,224,184,69,173,19,20,240,115,
+    232,19,15,159,31,109,56,170,89,248,234,143,3,224,180,44,181,148,123,27,39,1,112,168,19,118,110,86,31,254,80,15,210,191,1,156,250,172,29,35,165,26,192,71,187,167,191,52,167,97,162,192,
+    66,1,127,200,155,167,200,200,77,118,26,38,10,28,244,72,145,46,248,46,168,236,152,102,152,80,55,76,19,248,85,181,196,98,175,55,234,253,143,130,32,92,0,112,154,243,16,0,191,170,38,231,
+    155,205,203,91,20,167,97,146,192,245,96,137,85,80,15,222,155,231,199,20,167,97,146,192,31,138,30,201,207,179,98,245,69,117,26,166,8,236,8,75,172,186,122,244,150,0,19,236,134,13,218,
+    5,252,16,51,61,203,142,17,127,252,165,86,194,20,129,149,61,82,124,35,28,157,134,255,2,56,157,185,139,43,96,161,131,106,72,127,247,111,0,167,61,207,234,30,41,196,175,184,8,80,160,213,
+    10,211,3,14,142,19,164,131,176,19,215,8,139,211,48,141,2,38,8,124,23,211,35,133,103,232,87,249,23,88,94,161,69,31,156,126,224,198,150,17,92,121,83,254,215,239,2,153,243,36,122,192,
+    193,54,214,201,22,224,15,118,4,33,184,200,122,136,45,224,45,141,48,128,53,88,101,61,203,110,93,237,218,8,3,88,131,156,60,111,222,155,220,121,142,6,176,22,85,172,254,212,171,226,50,
+    15,128,201,45,194,0,76,19,184,129,33,154,118,30,226,219,40,0,107,95,194,207,71,180,136,62,206,159,217,80,240,166,225,155,7,7,192,116,243,122,231,28,201,255,41,126,234,10,128,17,0,35,
+    0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,
+    12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,198,183,0,192,8,128,17,0,35,0,70,0,140,0,24,17,243,63,152,
+    242,43,39,122,238,35,80,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,
+    10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,243,243,243,242,242,242,233,233,233,225,225,225,223,
+    223,223,220,220,220,218,218,218,217,217,217,216,216,216,210,210,210,191,191,191,188,188,188,186,186,186,184,184,184,182,182,182,181,181,181,180,180,180,176,176,176,165,165,165,155,
+    155,155,150,150,150,148,148,148,146,146,146,145,145,145,144,144,144,141,141,141,135,135,135,127,127,127,119,119,119,113,113,113,112,112,112,111,111,111,109,109,109,108,108,108,104,
+    104,104,96,96,96,89,89,89,82,82,82,76,76,76,69,69,69,62,62,62,54,54,54,48,48,48,41,41,41,37,37,37,36,36,36,34,34,34,30,30,30,26,26,26,22,22,22,18,18,18,16,16,16,14,14,14,11,11,11,8,
+    8,8,6,6,6,4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,99,214,191,40,0,0,13,80,73,68,65,84,120,218,237,221,121,115,218,56,24,6,112,154,80,32,16,142,112,19,110,130,109,204,109,131,3,4,36,125,255,111,
+    181,54,198,39,134,118,24,186,65,202,243,252,177,179,179,73,211,217,254,170,87,183,136,49,68,232,196,240,71,0,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,
+    1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,
+    128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,252,173,161,20,192,162,235,82,0,11,156,221,238,135,10,255,8,96,125,172,200,242,100,243,35,133,
+    197,7,166,108,46,245,122,253,126,79,89,255,68,225,152,248,190,134,52,24,90,233,169,87,190,107,191,7,48,175,192,179,222,240,195,204,112,32,95,44,210,219,149,166,173,62,9,128,185,4,30,
+    219,192,102,102,209,192,212,88,46,172,172,41,128,121,4,158,156,128,135,131,241,133,246,187,180,179,216,0,152,203,49,150,11,172,236,34,155,240,106,113,2,94,1,152,71,224,149,116,170,
+    208,3,41,114,28,189,215,156,22,172,19,0,115,8,188,149,7,167,78,120,48,143,2,222,44,1,204,117,200,200,169,209,189,73,20,240,122,177,68,137,22,99,148,213,83,35,124,15,186,11,252,9,224,
+    7,118,188,180,95,100,142,178,6,31,167,81,150,188,61,111,194,206,24,122,185,212,118,0,126,220,102,234,253,243,236,75,134,52,112,70,89,171,243,239,49,188,10,141,121,240,227,250,126,233,
+    75,99,127,97,161,106,175,184,19,165,243,81,22,113,43,244,82,196,105,176,40,45,88,83,134,31,146,162,71,10,187,139,149,145,163,172,157,38,116,133,22,4,120,62,236,153,5,184,39,69,78,131,
+    204,153,176,211,9,247,70,87,42,180,142,181,232,71,173,207,27,123,166,59,28,72,58,35,81,51,97,201,158,9,15,251,114,120,45,139,174,92,96,131,1,248,65,129,231,3,167,143,149,180,200,54,
+    236,204,132,63,134,225,181,172,47,175,66,111,1,252,168,192,179,190,227,215,151,35,198,201,222,134,210,176,55,13,125,121,227,85,232,61,128,31,189,5,31,167,186,231,235,205,190,81,86,
+    127,116,8,126,77,244,10,45,6,176,33,121,194,125,197,8,11,83,166,59,95,30,200,193,175,122,21,122,185,5,240,227,18,123,123,250,102,21,86,194,203,85,199,81,152,243,229,96,39,189,93,254,
+    177,66,147,175,61,1,240,55,55,225,173,218,247,9,171,135,112,27,222,143,250,78,141,14,118,194,222,70,195,250,194,207,254,212,53,77,223,80,0,127,179,176,226,19,238,143,191,194,194,222,
+    40,43,112,170,99,175,253,97,25,235,176,90,44,172,243,60,6,128,191,123,42,172,120,85,250,163,167,6,87,45,205,81,150,51,145,234,7,128,125,27,13,145,21,122,239,140,193,248,157,67,9,179,
+    217,176,118,183,245,45,198,9,9,2,175,78,251,13,161,213,104,227,250,86,240,151,254,167,10,14,224,255,113,40,237,23,30,4,187,90,74,38,253,143,227,217,104,37,208,20,215,87,183,130,119,
+    222,62,4,191,103,1,196,217,15,102,186,111,178,244,49,12,173,104,236,199,214,229,134,158,18,92,7,249,92,92,217,104,216,121,29,52,128,31,99,189,195,217,247,181,154,240,48,180,241,176,
+    155,169,202,40,124,63,201,217,74,138,218,10,222,122,237,151,231,101,16,129,142,236,152,194,195,43,194,140,238,200,217,153,0,99,97,41,46,34,26,240,70,243,251,106,95,0,126,4,225,153,
+    89,155,189,69,75,35,52,148,142,184,6,78,13,205,212,211,207,125,63,189,37,46,203,151,223,101,46,161,14,221,81,54,117,155,112,196,198,66,100,190,182,155,221,249,183,25,1,95,157,227,163,
+    0,98,157,170,164,7,79,248,234,109,194,63,252,152,144,239,23,3,240,195,16,143,221,173,195,222,248,214,31,178,94,10,227,43,26,48,165,123,119,85,178,63,187,237,194,55,89,47,252,190,43,
+    190,247,137,133,107,193,108,167,158,214,52,100,227,38,96,119,121,242,228,123,96,0,126,52,225,227,139,13,178,118,147,239,33,224,187,92,241,126,18,79,188,171,43,166,240,84,85,148,201,
+    141,167,156,131,245,121,205,253,73,75,46,129,41,33,228,122,235,188,249,213,164,157,127,252,188,52,248,191,235,16,227,178,141,218,131,161,139,183,145,34,215,52,254,46,219,128,175,0,
+    5,141,203,22,188,157,78,103,203,61,187,118,227,236,214,166,183,245,90,176,38,196,85,150,24,135,237,119,210,105,212,27,109,105,60,223,29,203,245,93,203,168,123,10,111,33,200,57,233,
+    24,127,190,227,70,189,217,124,111,212,106,173,190,186,216,218,197,250,126,63,254,52,200,18,197,151,59,96,202,140,78,189,249,110,198,68,54,141,187,202,204,96,215,138,245,13,211,36,43,
+    186,40,167,104,249,3,30,219,190,39,227,122,173,209,145,39,199,213,136,59,17,19,99,165,235,107,97,174,57,240,7,172,214,92,96,199,184,110,118,200,218,29,159,147,37,2,221,51,228,15,120,
+    82,247,3,31,141,155,141,122,189,221,27,233,12,17,0,88,111,55,66,194,39,227,90,123,66,1,202,255,40,154,170,245,134,9,26,101,220,154,49,2,82,238,167,73,95,106,187,86,139,52,174,201,12,
+    109,152,251,133,14,51,171,177,212,174,159,27,55,107,157,61,68,69,0,102,214,43,253,114,167,81,171,191,251,141,155,245,246,6,77,88,4,96,123,198,187,154,142,58,205,186,175,67,110,54,58,
+    159,0,22,164,5,219,75,208,235,249,184,219,114,138,117,179,89,83,14,16,21,4,216,53,222,204,71,178,213,33,191,55,26,181,238,26,13,88,32,96,215,216,236,144,165,78,179,213,185,241,16,22,
+    128,31,188,63,182,59,228,153,117,195,19,190,226,1,123,131,46,248,10,11,108,23,107,240,138,12,140,0,24,192,8,128,17,0,35,0,70,0,140,0,216,63,11,198,36,88,92,224,19,46,136,69,4,118,90,
+    238,118,189,195,66,165,96,192,244,180,147,180,95,205,84,185,219,233,42,43,8,139,2,76,221,46,119,179,84,122,237,247,90,173,222,168,215,58,115,104,10,1,108,219,146,141,54,29,125,116,
+    26,213,90,195,58,49,107,166,222,197,118,176,0,192,22,225,86,159,170,82,167,85,175,29,15,221,57,167,238,154,141,41,78,69,11,208,130,233,92,238,182,27,86,85,110,6,143,205,54,107,42,90,
+    48,239,192,214,199,121,55,77,219,247,230,249,185,247,102,125,4,96,238,129,137,82,123,143,184,211,96,223,93,153,1,152,115,96,194,150,173,247,11,186,205,90,119,123,87,96,74,14,7,10,224,
+    255,25,120,90,111,70,225,190,155,211,164,174,126,79,223,211,68,140,28,8,5,240,255,8,60,11,94,29,109,218,247,70,107,141,118,103,116,215,91,43,230,143,50,102,234,248,248,144,63,225,218,
+    152,43,96,202,244,86,176,225,154,163,233,86,71,26,77,173,39,53,238,234,187,170,103,158,99,241,215,142,60,255,226,219,152,51,224,93,183,214,180,27,174,137,91,109,180,7,202,100,105,28,
+    124,53,245,94,131,245,114,236,215,211,243,211,175,216,175,84,121,56,221,114,108,204,219,52,105,214,178,110,169,28,171,114,87,93,26,228,52,30,186,239,94,18,97,131,88,60,254,252,244,
+    252,28,127,54,141,19,111,157,201,250,216,33,83,0,255,115,225,105,175,213,108,119,37,117,102,191,227,252,47,206,67,83,118,40,197,226,79,118,142,198,177,223,217,238,241,117,83,202,93,
+    59,230,111,169,114,167,205,79,31,22,249,207,182,249,41,43,187,192,158,241,107,75,93,49,238,118,37,57,124,194,193,169,202,255,238,247,56,176,119,63,176,101,252,28,127,138,153,131,174,
+    170,204,219,5,70,14,119,147,254,253,45,149,3,147,99,102,23,28,204,115,60,110,13,186,178,26,95,194,56,116,23,61,29,203,90,163,172,51,99,19,57,86,220,114,37,44,220,135,114,220,165,117,
+    19,54,125,125,50,39,74,17,198,241,152,204,14,0,254,46,94,91,231,46,43,29,74,229,245,57,22,123,138,135,106,117,60,86,69,11,254,190,241,215,70,215,247,119,249,243,183,126,134,174,182,
+    94,227,177,216,175,128,177,5,76,0,252,29,33,108,213,171,86,42,237,249,125,132,143,138,235,73,39,255,219,52,182,70,88,14,112,27,37,250,155,124,103,149,108,190,80,200,149,167,119,170,
+    161,244,96,33,239,102,82,57,21,51,139,245,179,213,33,199,159,226,35,180,224,239,169,207,243,74,174,84,44,22,75,185,234,253,78,208,82,251,101,97,77,174,90,131,174,95,214,234,116,125,
+    79,209,7,255,255,188,132,77,202,249,210,155,149,82,238,174,109,140,146,99,69,214,165,234,235,239,95,207,169,222,6,243,224,111,25,94,141,74,133,226,209,247,173,152,27,220,104,112,105,
+    121,140,30,183,25,200,122,42,171,26,195,74,214,119,248,238,149,178,227,251,86,202,222,246,232,236,81,151,146,171,131,174,187,126,0,8,128,255,218,151,200,121,215,247,173,152,159,220,
+    82,162,169,117,224,218,184,210,64,169,117,74,139,187,147,215,49,33,218,239,192,100,117,124,75,185,250,45,27,2,230,32,173,93,206,230,91,83,193,142,102,242,15,76,216,118,152,247,251,
+    86,231,183,249,102,19,137,84,50,241,170,138,117,63,130,255,167,12,217,174,147,43,250,234,179,233,75,110,248,41,70,37,145,201,164,211,153,212,235,152,29,0,252,64,237,119,109,250,190,
+    121,237,183,169,223,210,2,9,155,102,94,210,47,102,50,169,172,80,159,252,16,227,221,215,104,101,75,174,239,91,174,29,246,37,228,111,142,203,17,166,36,50,47,199,100,146,5,145,132,99,
+    156,251,234,245,156,235,91,44,230,187,70,208,230,111,95,41,53,129,83,233,151,147,112,162,160,139,35,204,53,48,101,203,128,111,174,119,8,251,146,137,164,78,118,231,194,161,125,99,107,
+    3,216,19,78,86,196,17,142,113,237,59,171,248,124,223,242,210,46,236,59,107,21,178,217,66,107,17,18,182,87,45,252,223,75,15,109,167,70,91,109,184,42,204,167,123,240,252,164,63,219,84,
+    125,190,133,55,137,6,85,40,211,42,217,98,169,84,204,85,131,7,169,204,127,167,159,70,64,152,176,101,46,233,9,39,107,134,32,109,152,107,224,81,222,155,30,21,138,163,240,237,6,122,232,
+    218,127,1,172,197,75,226,255,133,171,143,74,62,212,174,41,155,102,61,225,116,162,189,19,163,13,115,221,7,119,220,6,92,44,148,207,125,217,170,98,47,96,150,114,237,0,165,94,78,36,146,
+    201,68,118,226,55,36,108,238,23,78,181,247,66,8,115,13,220,117,128,139,249,242,248,140,131,176,241,105,129,186,152,171,249,142,66,210,125,211,94,211,72,148,2,27,199,7,54,246,6,90,233,
+    116,170,251,69,112,63,248,123,231,72,242,105,10,92,202,87,166,231,219,60,148,246,115,14,112,195,3,54,91,234,201,49,147,144,2,29,173,57,87,242,9,191,188,12,68,120,92,141,107,96,173,
+    146,183,206,112,20,143,190,231,93,244,103,53,239,0,75,30,213,129,141,146,233,211,96,249,157,134,103,195,25,79,56,245,42,31,248,127,32,145,239,105,210,184,156,203,23,242,185,90,212,
+    242,179,57,181,117,135,216,37,223,95,0,226,2,167,19,229,224,71,225,153,179,39,233,180,98,105,11,43,252,15,165,57,95,232,152,118,42,149,170,20,249,2,26,101,146,83,161,243,21,223,119,
+    120,107,26,166,96,232,111,134,41,220,75,248,133,199,220,11,115,254,24,41,99,107,237,147,69,251,110,27,39,224,82,238,195,87,106,41,51,178,118,19,78,191,164,194,123,131,148,238,58,169,
+    23,111,73,43,167,51,188,209,241,189,253,48,187,112,185,159,176,153,123,138,39,184,123,64,89,243,119,230,212,9,247,194,45,148,50,218,78,166,189,37,45,153,247,189,67,254,247,131,47,29,
+    148,99,138,51,196,42,4,151,150,205,233,80,194,1,174,69,76,174,54,85,119,209,50,147,104,243,94,163,197,189,93,184,111,187,21,186,27,120,123,129,176,165,59,79,202,159,175,57,91,235,35,
+    238,214,97,162,138,65,214,227,206,161,156,101,142,208,33,60,179,119,206,219,130,231,163,44,251,151,26,21,183,137,119,209,130,31,21,88,117,43,116,249,76,209,41,194,153,223,106,68,31,
+    123,96,90,57,153,73,167,211,153,151,204,4,192,143,90,161,59,110,133,238,236,195,235,25,93,183,133,86,163,186,240,3,155,229,18,169,84,50,145,12,255,82,0,63,204,252,105,85,201,23,47,
+    220,100,57,48,245,180,94,149,78,102,35,239,49,17,54,111,100,95,179,21,133,255,45,37,65,129,9,155,184,115,164,114,120,29,211,91,141,54,59,225,232,26,76,217,65,91,24,34,252,73,136,218,
+    130,105,239,180,211,84,204,215,194,35,101,202,54,229,132,179,90,41,71,119,178,246,127,36,216,108,120,212,10,189,241,54,26,134,244,124,159,169,229,118,194,109,118,233,194,25,193,134,
+    255,3,87,232,169,119,214,227,188,8,19,38,39,156,13,165,242,86,236,103,196,69,109,193,146,91,161,171,235,136,213,170,73,198,233,132,179,154,216,31,229,33,234,52,201,57,205,83,202,13,
+    207,75,45,97,186,187,223,144,25,3,152,199,22,220,117,238,59,20,35,207,2,236,188,181,42,9,192,60,246,193,138,221,130,139,133,138,22,121,24,160,227,2,183,208,7,243,8,188,40,231,75,197,
+    82,41,178,66,31,143,237,164,156,81,86,101,47,180,176,176,243,224,81,57,151,207,101,115,237,11,167,61,214,78,39,156,44,24,0,230,50,211,118,181,222,81,47,93,65,161,167,78,56,147,168,
+    238,81,162,249,28,103,237,55,123,118,233,224,171,57,19,78,190,28,239,123,103,84,12,178,120,237,135,175,60,27,78,233,87,59,101,221,110,72,201,68,236,79,180,20,248,189,232,171,47,11,
+    83,182,29,87,178,165,186,202,4,207,79,126,16,124,183,250,20,255,127,242,231,2,159,223,17,6,240,79,170,225,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,17,0,
+    3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,
+    1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,34,98,254,3,127,195,203,65,121,219,107,89,0,0,0,0,73,69,78,68,174,66,96,130,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,
+    80,76,84,69,217,217,217,156,156,156,219,219,219,234,234,234,21,21,21,97,97,97,19,19,19,165,165,165,145,145,145,59,59,59,250,250,250,100,100,100,138,138,138,105,105,105,0,0,0,73,73,
+    73,146,146,146,37,37,37,219,219,219,109,109,109,255,255,255,10,10,10,254,254,254,126,126,126,113,113,113,226,226,226,25,25,25,36,36,36,55,55,55,87,87,87,216,216,216,108,108,108,68,
+    68,68,72,72,72,103,103,103,109,109,109,71,71,71,27,27,27,41,41,41,70,70,70,104,104,104,146,146,146,215,215,215,10,10,10,35,35,35,34,34,34,72,72,72,137,137,137,217,217,217,8,8,8,35,
+    35,35,71,71,71,105,105,105,10,10,10,35,35,35,68,68,68,105,105,105,121,121,121,138,138,138,168,168,168,34,34,34,58,58,58,135,135,135,140,140,140,23,37,214,43,0,0,0,64,116,82,78,83,92,
+    33,40,161,81,28,157,92,157,46,207,91,210,154,0,253,253,253,253,253,1,253,253,3,254,254,18,209,15,12,174,174,80,206,76,207,175,44,17,110,50,209,143,206,177,81,12,78,210,43,109,141,148,
+    112,145,47,114,47,145,12,50,75,115,173,154,213,103,133,0,0,10,24,73,68,65,84,120,218,237,221,11,87,218,72,0,134,225,0,130,90,235,168,144,54,18,2,136,23,16,69,84,180,42,94,255,255,191,
+    218,4,185,76,146,9,216,37,210,204,240,126,231,236,246,116,173,237,57,251,244,155,76,102,38,193,18,196,232,88,252,47,0,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,
+    76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,
+    1,24,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,181,136,29,252,99,3,108,178,239,236,7,128,205,75,190,80,40,88,185,245,18,182,214,168,191,214,239,32,63,242,107,37,108,173,155,239,
+    186,9,91,107,227,155,43,140,129,127,91,0,155,8,156,159,248,254,46,112,13,6,24,224,108,50,218,182,147,4,108,203,192,54,192,250,222,232,42,241,28,145,251,49,5,118,1,214,52,185,124,62,
+    167,22,182,133,55,5,78,158,70,223,222,222,2,156,221,250,58,214,77,185,92,190,80,174,100,248,192,211,89,244,15,91,13,124,91,250,245,235,87,105,3,224,140,166,95,168,86,203,229,106,181,
+    161,42,168,45,220,194,130,6,111,252,250,204,6,192,25,93,200,40,127,166,122,33,148,51,173,41,240,111,53,112,105,12,124,9,112,54,83,168,142,133,203,106,192,5,192,147,2,27,86,97,131,128,
+    27,19,224,106,195,137,111,10,218,139,128,75,83,224,63,0,103,188,193,85,197,98,164,12,172,90,171,156,21,24,224,140,95,131,213,131,244,108,179,65,13,124,57,3,190,5,56,147,192,185,155,
+    89,133,27,185,232,32,189,0,248,207,204,183,196,36,75,131,10,199,12,23,0,155,90,96,147,174,193,182,184,152,86,184,124,147,143,220,43,217,98,115,14,176,177,5,54,11,56,47,15,210,145,153,
+    244,124,96,99,11,108,212,90,244,220,65,250,69,2,190,136,2,155,91,96,195,118,147,28,121,144,14,175,73,219,243,128,205,45,176,105,219,133,242,76,250,34,239,216,106,224,70,4,216,224,2,
+    155,182,225,159,60,72,251,248,210,142,191,157,80,224,75,182,11,179,13,108,59,141,89,133,253,65,218,145,129,127,36,156,217,249,99,232,34,150,129,192,163,153,116,121,54,72,75,77,181,
+    197,203,143,132,6,155,92,96,227,14,221,37,15,210,210,98,116,120,130,109,116,129,205,3,182,95,194,131,180,45,149,123,92,225,66,248,68,135,209,5,54,239,216,172,239,24,170,240,139,252,
+    149,81,135,11,249,53,42,176,174,192,182,227,124,101,144,14,93,133,3,97,203,178,242,34,241,10,44,0,206,202,56,60,251,183,226,139,197,217,214,255,69,100,177,67,254,225,51,183,102,23,
+    88,75,96,31,200,59,47,38,18,203,131,244,166,52,68,143,190,193,142,126,207,237,87,10,124,235,2,188,202,228,172,198,205,77,195,202,37,30,114,183,170,227,29,135,151,197,71,220,47,23,21,
+    216,29,244,106,181,135,51,128,87,55,139,186,40,87,253,148,27,150,163,36,182,237,220,231,175,184,249,202,131,162,127,22,20,248,181,119,48,202,21,192,171,190,211,245,137,55,139,234,22,
+    59,86,163,209,176,94,190,244,136,74,105,222,45,146,59,56,24,167,246,10,240,138,6,104,233,70,183,220,200,9,161,58,97,39,68,177,254,213,103,204,54,74,151,165,146,218,247,170,119,48,205,
+    0,224,213,20,88,218,49,10,136,47,242,73,196,75,191,80,167,253,112,32,165,7,240,106,128,95,100,224,128,184,144,87,97,46,255,190,164,171,154,236,123,80,2,120,69,196,141,16,240,168,197,
+    202,129,122,185,184,161,250,250,217,0,120,69,21,222,44,71,132,191,131,56,82,95,127,146,213,6,120,117,211,232,168,240,152,56,53,225,215,104,125,117,157,68,107,186,22,29,220,9,43,136,
+    243,223,86,223,3,22,58,86,219,97,97,53,20,196,141,151,84,58,172,168,175,190,15,28,234,217,96,159,177,173,32,174,94,164,1,60,136,215,87,223,165,104,109,247,131,3,200,24,113,245,198,
+    17,206,210,195,115,148,183,119,37,4,192,25,33,206,45,13,236,214,12,170,175,208,251,68,71,176,109,24,34,174,222,12,151,6,222,136,212,247,85,8,128,255,37,113,95,34,174,54,250,75,95,131,
+    195,192,3,87,0,252,79,133,125,208,252,132,184,90,78,225,53,163,27,38,213,87,24,112,232,46,32,206,5,196,213,242,77,26,175,145,109,79,175,193,53,253,235,43,140,56,85,25,16,215,173,212,
+    222,229,62,153,69,247,206,132,0,56,59,196,147,137,117,10,194,181,81,125,219,2,224,44,17,199,143,211,253,255,59,165,215,171,87,87,8,128,9,192,4,96,2,48,1,152,0,12,48,1,56,99,119,191,
+    206,103,108,28,13,1,30,139,218,241,87,201,18,19,128,67,142,110,219,243,188,92,46,119,125,125,157,195,209,144,6,59,231,215,155,126,182,182,158,63,252,252,252,249,115,127,148,238,123,
+    241,155,255,96,215,117,207,252,108,108,156,1,252,141,185,238,238,39,100,43,253,81,250,236,234,234,106,48,24,60,60,244,122,189,218,40,90,238,17,235,3,108,139,205,253,228,44,127,24,43,
+    82,217,135,216,217,202,201,54,241,25,192,223,227,59,236,206,1,222,74,23,216,237,29,36,230,1,224,239,200,139,216,217,159,11,156,234,24,61,72,246,213,172,194,26,1,239,238,175,174,193,
+    181,57,192,7,0,255,131,6,95,167,10,124,6,240,234,239,144,196,112,94,129,235,233,78,177,230,1,247,92,128,191,101,150,101,111,37,250,62,59,41,223,38,61,204,1,214,235,73,22,157,110,147,
+    138,207,146,233,207,32,31,31,31,207,207,207,155,233,175,100,37,143,209,53,205,158,84,210,107,37,107,248,190,251,254,254,30,44,78,230,218,110,219,149,245,83,78,232,9,225,96,149,163,
+    231,231,225,161,52,208,109,41,203,132,237,66,219,249,134,223,212,13,150,177,6,27,65,206,206,206,92,109,79,89,106,182,22,109,219,147,45,66,71,144,117,105,48,1,24,96,2,48,1,152,0,76,
+    0,254,95,55,80,28,173,52,25,120,222,135,116,0,172,127,123,133,168,15,135,233,173,124,56,117,7,224,108,249,94,111,5,71,43,211,220,82,114,0,206,14,239,249,120,151,105,43,157,93,37,239,
+    237,237,205,51,134,216,50,160,190,211,195,120,239,105,84,248,168,181,183,183,215,58,50,133,216,210,157,119,248,33,237,17,247,83,240,221,251,76,171,227,26,65,172,245,171,12,29,225,109,
+    118,195,167,163,151,254,28,142,214,222,36,102,180,216,210,186,190,231,31,161,147,59,221,101,129,235,226,109,79,74,203,128,107,177,182,192,254,93,175,243,30,57,154,245,177,252,223,153,
+    206,94,40,167,71,186,207,168,45,125,235,59,220,138,159,157,93,114,132,142,52,248,147,184,173,53,177,165,107,125,235,239,138,179,209,203,231,181,181,103,22,177,165,105,125,227,15,26,
+    110,13,83,89,231,232,236,237,41,136,105,240,74,251,43,156,231,40,111,247,189,159,210,58,86,167,165,36,246,0,94,157,111,252,57,195,143,97,122,163,232,227,157,138,248,206,3,248,159,249,
+    118,175,189,84,47,146,143,119,170,18,123,0,175,8,56,58,62,7,107,208,105,250,58,106,226,35,45,103,90,26,126,250,168,211,141,212,55,206,107,47,127,112,122,59,70,92,210,242,101,62,26,
+    2,159,135,128,159,21,245,253,187,247,131,59,182,250,209,136,104,139,1,94,81,138,18,112,119,71,57,58,215,119,118,119,119,150,123,162,212,137,17,223,1,188,242,107,112,240,216,168,226,
+    195,191,143,79,42,135,135,149,230,249,151,126,191,246,81,167,243,230,38,16,191,157,206,128,31,185,6,175,8,184,56,94,163,220,186,86,213,215,31,195,79,14,43,126,14,79,250,95,185,214,
+    142,8,79,31,197,34,226,187,186,16,0,175,38,185,231,110,176,180,81,87,158,179,179,235,247,35,95,95,248,105,81,231,28,177,61,190,231,109,121,201,3,245,105,43,216,30,214,244,67,58,244,
+    92,201,18,195,227,227,162,250,222,200,17,231,149,113,14,155,241,201,117,244,23,79,175,178,119,9,39,237,130,255,186,61,58,195,3,240,42,133,69,226,49,89,111,82,224,56,112,124,106,237,
+    158,46,190,205,213,123,67,88,211,237,194,196,119,8,7,5,158,2,223,71,56,139,197,243,200,133,212,149,14,112,244,231,253,113,0,103,37,253,230,196,183,82,57,14,181,175,126,127,82,169,156,
+    28,215,19,26,172,233,109,208,154,1,59,226,184,50,187,4,123,242,200,92,111,30,142,242,36,57,134,79,112,28,9,7,96,93,11,108,139,167,207,47,28,86,138,178,99,251,84,251,237,132,117,2,14,
+    23,56,52,24,215,79,14,149,87,230,237,208,90,149,3,112,182,227,74,5,222,145,184,28,81,156,2,239,134,255,74,200,131,244,54,13,214,168,192,253,208,87,102,192,145,155,39,207,236,65,218,
+    172,6,123,73,83,104,91,26,162,155,145,53,169,35,169,194,29,227,6,105,203,216,2,71,238,120,37,224,232,13,239,93,104,144,182,1,214,238,10,28,6,142,237,65,120,45,121,144,6,88,191,43,240,
+    232,254,105,6,92,143,126,159,201,131,180,73,13,150,239,129,207,99,78,187,83,224,199,200,48,236,132,6,233,71,26,172,65,129,163,171,208,254,79,155,18,112,20,191,45,15,210,46,192,217,
+    76,113,94,129,237,80,131,157,121,131,244,145,81,243,44,203,200,2,55,157,248,167,27,78,143,1,84,30,21,167,244,164,65,186,213,166,193,153,204,253,188,43,176,45,125,57,190,169,48,59,217,
+    97,220,166,131,65,192,205,217,62,176,163,56,137,247,36,1,215,227,253,63,146,39,210,54,192,89,6,14,239,23,77,129,167,3,248,78,28,88,216,222,41,13,206,116,102,21,245,167,208,170,179,
+    150,51,224,39,5,176,60,72,111,3,156,201,212,155,227,211,178,69,197,16,43,205,193,148,13,246,191,165,51,29,161,153,100,101,245,62,105,124,222,221,158,59,201,78,58,77,91,255,124,50,184,
+    227,1,156,213,65,218,59,126,122,58,238,47,186,139,74,62,46,253,216,233,116,12,91,200,50,170,193,243,158,57,147,143,75,223,39,204,146,141,124,91,173,97,71,118,18,159,26,13,3,255,253,
+    247,3,156,117,250,47,1,211,96,173,129,15,1,54,57,237,147,47,63,147,6,176,150,21,158,30,140,62,7,216,200,212,239,71,79,54,84,142,215,105,132,94,171,143,213,233,63,53,79,78,154,235,229,
+    187,102,159,155,212,246,60,33,0,54,248,58,44,132,112,0,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,
+    0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,
+    0,76,0,38,0,3,76,12,205,127,247,194,43,119,54,12,188,93,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,
+    0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,159,159,159,216,216,216,211,211,211,105,105,105,233,233,233,143,143,143,30,30,30,148,148,148,121,121,121,12,12,12,139,
+    139,139,123,123,123,235,235,235,0,0,0,37,37,37,146,146,146,73,73,73,219,219,219,109,109,109,254,254,254,10,10,10,254,254,254,126,126,126,113,113,113,225,225,225,55,55,55,218,218,218,
+    108,108,108,35,35,35,70,70,70,106,106,106,24,24,24,71,71,71,72,72,72,87,87,87,109,109,109,39,39,39,36,36,36,68,68,68,103,103,103,27,27,27,35,35,35,35,35,35,35,35,35,214,214,214,67,
+    67,67,137,137,137,103,103,103,73,73,73,139,139,139,215,215,215,145,145,145,167,167,167,8,8,8,10,10,10,59,59,59,252,252,252,9,9,9,10,10,10,215,215,215,36,36,36,68,68,68,90,90,90,102,
+    102,102,6,247,200,161,0,0,0,64,116,82,78,83,36,89,38,92,161,163,82,89,44,142,206,149,216,0,253,253,253,253,253,1,253,253,3,254,254,15,208,173,145,145,141,15,175,210,11,209,13,208,47,
+    46,43,78,111,176,176,79,110,80,17,143,111,209,17,44,208,42,204,112,175,145,48,110,41,16,9,186,13,65,0,0,10,41,73,68,65,84,120,218,237,221,135,82,219,74,0,133,97,201,54,54,144,43,192,
+    86,178,174,184,99,83,12,54,29,66,123,255,183,186,146,141,85,87,130,33,2,180,203,127,230,206,220,25,72,200,132,47,103,181,69,18,134,69,180,142,193,183,0,96,2,48,1,152,0,76,0,38,0,19,
+    128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,
+    76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,242,227,129,123,0,107,156,241,209,201,193,73,231,17,96,93,219,219,217,
+    89,230,8,96,61,115,188,242,221,57,56,4,88,203,28,188,2,239,28,3,172,232,24,124,212,57,217,74,172,231,161,7,124,2,176,146,57,60,73,237,231,225,14,192,106,247,247,100,39,117,18,85,246,
+    128,59,0,171,24,15,240,68,190,216,61,218,225,26,172,116,58,30,224,81,234,36,26,96,69,115,242,198,53,246,248,141,127,0,0,43,178,204,77,18,236,188,13,44,134,2,224,220,230,209,7,62,25,
+    167,2,63,210,96,197,47,194,210,142,250,67,120,210,82,121,82,46,31,245,0,86,161,194,146,133,208,208,219,231,72,216,170,108,238,239,57,233,79,0,86,161,194,241,81,184,231,3,75,91,186,
+    88,250,238,237,13,38,150,13,112,62,115,148,90,97,239,115,7,178,233,149,245,180,247,154,125,26,156,215,140,253,203,108,252,58,251,198,78,229,100,176,6,30,52,1,86,177,194,233,192,205,
+    254,158,7,252,8,112,94,211,243,43,28,155,73,149,83,128,3,3,180,3,220,3,88,197,10,167,156,53,8,107,226,251,58,215,96,38,89,74,84,248,49,9,184,28,159,65,247,3,5,190,181,4,192,42,84,56,
+    114,164,112,156,8,108,91,251,129,2,159,106,226,171,41,240,248,32,233,42,156,114,214,80,14,13,208,186,108,71,107,122,79,214,113,82,133,147,183,162,155,131,208,0,109,1,252,205,185,223,
+    218,186,191,78,188,10,7,42,60,126,15,176,208,115,128,86,23,248,250,230,183,147,155,251,222,219,21,46,75,63,30,118,23,214,169,150,3,180,186,192,75,95,39,127,175,223,172,240,177,116,
+    163,35,178,74,26,7,7,232,166,101,1,252,205,227,243,239,117,110,238,223,170,240,145,236,227,225,185,151,24,135,7,104,27,224,111,206,214,111,63,242,18,251,247,63,71,102,83,71,206,34,
+    249,160,115,248,51,6,104,101,129,255,6,128,127,223,148,211,42,28,63,81,58,44,31,70,86,192,147,192,0,221,215,105,128,214,162,193,78,182,100,87,225,213,132,185,243,142,61,229,102,112,
+    128,158,88,0,231,96,18,29,6,150,151,248,176,211,233,188,227,214,201,240,0,253,164,213,0,173,238,44,250,62,34,44,45,241,251,18,218,163,236,143,45,26,156,139,148,111,34,194,127,175,63,
+    252,181,250,218,14,208,42,239,100,93,255,141,150,248,254,163,71,184,251,218,14,208,106,239,69,223,103,83,226,192,53,88,179,25,180,234,192,241,18,203,23,76,239,158,69,15,146,7,104,33,
+    4,192,121,152,107,253,139,112,255,54,177,227,52,56,47,37,254,251,193,175,115,123,90,46,247,146,121,31,79,79,111,1,206,67,137,111,174,51,254,242,46,239,100,127,144,86,112,128,63,121,
+    193,20,42,241,71,129,229,143,20,174,120,85,190,13,64,139,59,58,2,27,151,55,89,183,247,118,95,237,59,45,245,184,101,199,223,245,184,207,148,119,124,26,216,3,81,243,160,88,151,123,178,
+    182,254,109,142,37,231,45,135,120,213,220,231,210,230,166,59,247,74,124,115,255,121,237,165,193,57,88,50,101,200,219,124,138,241,58,243,104,38,89,154,100,241,52,136,243,166,109,116,
+    1,172,62,175,162,79,253,3,28,75,179,47,229,125,82,243,164,24,224,72,194,143,40,121,188,167,170,222,8,0,112,52,183,3,9,111,79,217,19,7,128,163,19,232,211,56,175,165,240,129,146,82,192,
+    182,159,47,3,222,159,88,74,159,23,26,74,181,43,110,45,50,199,14,62,101,168,60,175,82,192,182,101,152,166,105,24,5,187,80,136,20,59,211,63,199,123,81,199,64,125,94,149,128,109,203,188,
+    251,227,230,238,238,174,228,196,92,106,27,205,213,231,50,204,235,115,74,131,167,91,245,121,21,2,118,124,255,200,242,223,127,165,82,33,227,65,250,180,223,239,63,53,45,45,158,65,51,148,
+    241,53,238,254,36,229,206,252,12,11,94,194,242,149,185,178,42,127,82,82,200,84,88,104,195,171,82,131,205,52,224,146,78,143,244,2,44,1,110,34,172,58,176,125,151,6,188,0,88,211,89,52,
+    67,180,118,235,224,207,159,100,1,252,77,41,152,166,187,197,81,186,139,74,155,2,95,13,128,215,136,67,195,40,20,10,230,133,249,176,196,190,43,153,56,234,209,96,201,57,210,88,92,21,4,
+    140,154,0,7,152,67,135,134,159,48,62,219,194,9,91,149,185,44,117,150,87,131,149,245,112,56,20,182,13,176,78,89,204,139,211,233,203,48,122,167,187,0,88,139,188,116,71,53,39,163,81,187,
+    221,237,118,139,197,226,124,58,29,46,198,52,88,147,52,187,245,186,227,91,247,179,214,158,143,1,86,62,182,53,175,197,243,10,221,125,1,88,253,180,235,181,164,212,187,138,237,153,1,28,
+    207,56,13,184,54,85,107,166,5,176,228,18,156,2,92,171,21,1,254,234,100,188,70,21,86,17,224,60,237,116,196,118,38,254,121,146,53,76,174,112,189,54,1,248,171,121,13,247,62,233,76,133,
+    159,219,254,34,41,2,220,86,236,41,127,67,117,94,97,206,170,213,86,41,235,3,225,121,177,219,109,183,71,163,224,26,201,205,104,202,44,250,43,121,175,28,222,70,195,249,175,85,200,182,
+    195,171,217,150,16,183,183,147,162,147,87,237,81,247,153,141,142,175,228,189,112,120,171,203,52,30,22,159,60,113,91,188,136,169,130,55,195,43,10,44,150,188,173,53,175,155,194,167,157,
+    26,10,95,91,189,19,68,67,213,246,26,97,222,106,213,252,244,114,217,42,222,89,96,168,201,91,136,242,86,171,21,238,187,211,2,216,85,44,60,180,26,17,222,70,235,10,96,29,128,221,246,62,
+    84,163,188,78,46,240,213,163,193,46,111,76,183,81,189,48,0,214,0,216,182,47,164,188,15,89,61,33,172,201,157,118,170,2,219,86,37,238,155,33,175,29,250,31,192,223,80,224,89,116,110,85,
+    109,45,121,51,50,105,78,231,243,103,139,159,62,250,109,5,46,180,26,17,222,139,66,134,47,97,153,182,221,141,231,238,144,6,127,27,240,39,242,218,214,116,180,186,213,110,52,215,168,196,
+    106,1,15,253,6,59,188,230,85,182,187,75,221,250,250,204,183,219,164,193,223,35,124,225,241,206,156,133,81,198,111,200,26,121,103,191,26,149,88,177,101,210,176,212,112,83,157,45,219,
+    107,203,230,97,31,100,23,214,109,173,30,184,113,163,171,201,59,3,20,3,118,207,247,91,173,68,222,127,90,232,52,71,161,187,55,218,122,76,167,213,59,108,24,26,47,86,82,75,109,203,184,
+    152,149,42,31,218,213,178,189,107,240,186,196,197,158,6,194,202,237,69,219,86,34,175,251,150,135,150,59,128,127,232,246,14,97,61,143,34,194,237,169,250,37,86,175,193,201,143,139,58,
+    190,171,141,174,70,235,99,59,211,211,200,221,148,78,137,121,25,105,158,46,208,87,235,85,84,195,252,216,32,189,40,214,226,37,182,1,206,11,112,105,189,74,110,204,222,251,91,34,163,244,
+    235,102,86,128,216,93,48,1,156,15,95,211,223,228,42,189,247,114,30,57,60,178,173,97,55,90,98,181,183,46,13,125,124,141,192,54,215,59,94,140,182,228,29,70,91,236,148,120,62,138,92,137,
+    219,67,128,115,0,44,30,2,7,17,70,228,45,27,78,98,190,155,103,219,151,27,103,146,231,125,163,37,174,205,21,158,105,25,218,20,216,172,86,19,10,44,219,253,112,10,127,185,235,102,195,144,
+    92,137,195,37,174,183,105,112,190,6,232,89,100,29,44,42,149,51,35,242,235,197,198,238,42,231,177,209,220,17,126,14,150,24,224,28,172,141,11,179,208,0,45,130,150,149,203,88,85,133,85,
+    217,93,199,136,15,192,225,18,43,247,84,191,134,192,193,1,58,124,131,165,79,185,49,14,254,134,51,15,248,92,194,183,90,48,213,185,6,231,102,128,14,92,128,103,133,208,94,151,55,22,239,
+    6,30,221,22,1,96,89,133,221,95,209,44,190,222,0,208,126,81,248,123,163,3,176,109,95,205,146,102,208,206,100,217,131,220,8,2,251,31,118,62,46,27,129,189,93,143,238,194,2,56,71,3,116,
+    120,151,82,88,70,0,82,54,201,114,178,41,31,130,221,201,214,188,248,172,246,55,199,208,193,183,16,28,160,141,240,0,29,152,77,157,135,62,94,124,171,194,122,220,211,97,104,224,107,248,
+    3,116,236,28,41,8,124,22,250,212,139,95,225,203,205,36,75,49,20,156,38,125,59,240,67,202,67,164,195,36,224,160,252,174,198,79,38,170,255,150,157,208,22,214,67,51,34,117,21,152,46,23,
+    195,203,227,197,165,95,97,97,9,128,115,154,94,120,128,22,81,255,95,114,224,240,74,73,223,10,171,14,44,172,105,224,105,7,217,57,255,185,167,56,143,0,27,161,10,219,0,231,19,216,223,132,
+    110,60,200,148,252,185,212,115,184,222,161,10,159,233,58,70,43,255,74,127,31,88,254,144,127,207,3,222,158,68,129,23,219,30,240,246,139,5,112,78,133,47,82,6,232,224,84,106,187,23,107,
+    127,168,194,54,192,57,221,230,152,45,95,133,38,125,137,131,109,61,251,192,146,225,253,82,251,10,235,176,85,105,152,173,106,117,102,10,233,37,122,243,50,121,191,202,14,204,192,156,137,
+    180,0,56,167,29,182,12,195,72,156,131,201,206,26,36,252,187,27,77,26,156,87,97,251,213,89,6,92,73,219,113,254,1,21,214,228,192,63,233,213,41,225,179,6,91,50,130,239,166,30,252,3,156,
+    251,101,114,37,117,158,28,172,240,57,67,180,126,192,193,10,211,96,37,129,55,18,182,162,215,21,30,158,167,126,30,224,188,207,176,223,0,22,214,244,117,34,125,174,231,66,88,251,31,171,
+    227,95,99,229,63,240,200,182,54,151,255,6,206,53,61,110,248,57,192,219,207,242,33,216,93,70,159,85,166,186,254,253,127,206,36,107,99,156,188,81,162,113,180,191,6,123,119,79,166,204,
+    161,36,207,166,1,172,140,176,177,161,245,105,209,143,191,6,187,239,101,248,245,235,236,199,254,140,70,253,255,226,58,190,35,24,224,80,174,108,219,22,52,152,0,76,0,38,0,19,128,9,192,
+    4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,
+    128,1,38,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,201,42,255,3,239,45,50,160,220,60,91,202,0,0,0,0,73,69,78,68,174,66,96,130,0,
+    0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,154,154,154,149,149,149,25,25,25,212,212,212,227,227,227,229,
+    229,229,140,140,140,111,111,111,115,115,115,9,9,9,141,141,141,93,93,93,233,233,233,0,0,0,73,73,73,37,37,37,146,146,146,219,219,219,109,109,109,255,255,255,254,254,254,10,10,10,126,
+    126,126,113,113,113,226,226,226,26,26,26,36,36,36,86,86,86,217,217,217,56,56,56,108,108,108,104,104,104,41,41,41,35,35,35,70,70,70,69,69,69,35,35,35,35,35,35,69,69,69,108,108,108,217,
+    217,217,70,70,70,68,68,68,71,71,71,89,89,89,214,214,214,103,103,103,145,145,145,57,57,57,71,71,71,9,9,9,37,37,37,104,104,104,107,107,107,145,145,145,215,215,215,10,10,10,184,184,184,
+    215,215,215,26,26,26,253,253,253,10,10,10,145,145,145,34,34,34,251,85,88,213,0,0,0,64,116,82,78,83,28,90,94,31,155,94,154,45,100,140,209,140,196,0,253,253,253,253,252,1,253,253,3,254,
+    254,18,208,14,206,19,180,79,15,109,141,48,171,146,110,206,175,15,78,177,42,109,15,179,45,207,44,50,112,144,206,145,210,46,80,47,209,174,145,79,118,60,81,179,0,0,10,128,73,68,65,84,
+    120,218,237,157,11,87,218,74,20,70,19,64,192,246,142,21,198,6,16,121,41,168,32,130,245,253,168,250,255,255,213,77,120,101,18,38,104,151,1,147,97,239,181,110,93,171,80,186,116,247,59,
+    57,115,102,146,107,9,48,26,139,31,1,130,1,193,128,96,64,48,32,24,16,12,8,70,48,32,24,16,12,8,6,4,3,130,1,193,8,6,4,3,130,1,193,128,96,64,48,32,24,16,140,96,64,48,32,24,16,12,8,6,4,
+    3,130,17,12,8,6,4,3,130,1,193,128,96,64,48,130,1,193,128,96,64,48,32,24,16,12,8,6,4,35,24,16,12,8,6,4,3,130,1,193,128,96,4,3,130,1,193,128,96,64,48,32,24,16,140,96,64,176,49,72,41,
+    17,108,178,222,249,47,8,54,210,175,16,89,171,62,249,138,96,35,253,62,229,142,142,142,46,173,237,50,188,53,130,29,97,29,85,61,114,206,86,25,182,182,38,191,217,163,106,201,163,250,224,
+    32,216,68,193,118,105,206,211,54,69,120,123,4,95,86,231,130,159,17,188,165,130,29,105,222,66,121,27,5,95,234,5,207,220,74,4,39,215,162,140,140,160,20,207,115,191,213,157,40,137,217,
+    157,157,157,134,97,134,45,163,82,26,29,65,85,240,131,238,45,82,88,59,127,15,14,14,254,179,205,50,108,153,228,55,123,249,240,96,183,221,37,175,246,197,143,4,231,14,166,100,141,50,108,
+    25,228,215,62,42,85,171,165,156,165,247,231,11,62,215,255,3,152,249,61,200,181,73,112,34,253,62,149,170,83,127,58,195,206,252,229,136,55,72,57,15,176,97,17,54,168,68,63,84,87,148,96,
+    41,156,163,249,235,71,203,195,74,247,159,199,1,130,147,29,224,133,64,237,66,87,122,163,232,185,224,172,70,240,3,130,19,141,227,11,116,13,90,26,131,206,249,66,240,83,184,15,115,245,
+    255,93,248,205,213,185,6,39,49,193,190,224,82,53,55,90,22,92,63,95,188,190,20,81,41,118,252,0,239,208,69,39,211,240,101,201,231,89,87,132,35,75,120,48,192,125,4,39,52,194,126,68,53,
+    69,90,21,188,179,36,88,9,240,51,131,142,164,26,222,241,19,92,61,207,74,25,153,240,144,67,41,179,74,128,37,130,83,81,164,47,69,164,224,106,232,53,131,175,192,102,9,150,74,145,246,182,
+    245,157,160,197,231,8,193,82,74,63,192,127,179,18,193,201,141,240,83,116,145,86,142,116,84,115,65,193,226,217,220,0,27,182,93,168,22,233,208,174,96,112,183,33,240,167,106,71,74,128,
+    17,156,232,34,61,10,22,105,169,78,66,148,221,6,181,199,118,163,109,112,128,13,59,209,225,22,105,101,220,17,242,152,93,204,42,207,219,254,11,82,246,255,243,3,252,132,224,196,175,149,
+    252,8,7,174,181,202,58,57,176,27,17,8,112,78,24,135,105,130,101,253,65,41,210,118,192,228,165,102,29,44,69,61,103,114,128,141,59,116,23,156,73,171,3,45,41,179,231,85,247,165,106,41,
+    87,151,250,53,112,206,192,243,180,198,157,170,12,12,180,2,227,14,215,125,238,168,84,58,186,12,254,1,63,192,7,22,130,211,96,216,122,40,233,79,231,184,246,172,108,54,27,252,45,101,74,
+    121,110,226,129,120,3,5,171,59,195,231,161,151,252,95,53,130,237,136,159,198,117,230,245,117,247,26,193,155,148,232,76,255,139,48,252,28,49,210,152,158,156,14,254,78,35,247,209,21,
+    56,243,248,219,35,131,224,13,134,116,62,188,208,226,200,92,85,211,70,71,93,178,63,24,114,236,254,158,145,65,240,198,112,236,183,113,190,104,121,46,181,210,156,121,191,252,137,117,85,
+    118,103,149,223,89,124,61,94,17,188,33,187,98,56,222,247,24,219,142,254,153,27,82,140,242,147,126,121,244,169,15,124,206,253,253,155,219,17,43,227,235,242,120,141,224,13,21,232,252,
+    254,140,177,61,210,42,246,250,229,167,167,236,167,63,50,155,213,30,180,187,126,253,173,130,224,13,249,109,237,251,140,237,186,174,223,154,74,151,159,253,68,237,123,107,153,128,94,74,
+    244,230,3,60,225,222,62,113,203,182,179,220,105,253,195,206,189,238,189,161,248,210,100,109,78,240,219,126,144,251,162,86,241,215,80,186,171,41,187,44,147,54,37,216,222,15,243,195,
+    83,28,231,89,155,165,248,166,117,25,156,74,193,133,31,251,203,138,223,44,17,223,221,249,75,241,125,77,235,32,43,157,93,244,114,132,61,222,98,251,94,118,127,155,81,158,211,58,232,112,
+    251,232,188,94,113,44,207,56,187,14,199,247,49,35,16,188,105,244,138,243,163,24,62,250,209,156,248,166,86,176,215,49,23,223,52,134,109,241,229,102,58,99,80,124,83,156,96,207,99,97,
+    89,241,219,215,107,244,174,65,241,21,105,222,15,246,20,143,138,161,134,122,252,245,207,125,53,40,190,34,221,27,254,222,132,178,17,84,28,111,130,211,187,56,50,67,176,119,60,71,136,19,
+    85,113,12,215,224,107,131,226,43,210,127,100,199,219,16,62,177,239,231,1,174,199,176,76,202,152,19,95,97,194,153,44,79,113,221,158,236,16,231,227,121,214,119,230,245,241,209,140,248,
+    10,51,14,221,201,137,98,187,24,223,247,114,125,45,4,130,19,166,120,242,85,128,145,130,189,142,218,145,14,58,205,21,12,8,70,48,32,24,16,12,8,6,4,3,130,39,203,95,119,253,235,177,129,
+    191,170,86,171,221,220,188,191,223,32,120,237,82,167,78,165,19,188,209,119,13,180,107,237,23,79,106,167,211,235,117,187,135,135,191,60,14,51,8,94,31,161,187,9,235,163,122,161,80,180,
+    237,117,124,23,181,78,119,33,53,72,6,193,235,164,61,42,20,44,219,37,159,31,143,239,239,167,59,133,249,216,255,159,177,47,58,181,83,14,107,8,94,23,69,87,234,143,123,205,105,187,241,
+    40,222,191,232,58,218,239,175,95,239,8,94,15,117,253,113,232,184,206,114,168,116,86,248,253,213,65,240,90,154,171,136,59,26,214,18,225,222,42,193,25,4,175,197,239,232,126,133,224,251,
+    122,172,87,225,238,42,193,47,8,94,71,3,45,10,43,252,238,231,107,27,75,48,93,244,154,4,23,87,9,142,249,26,252,98,198,21,216,156,4,223,199,253,141,44,117,89,135,135,135,221,94,175,211,
+    73,217,40,43,77,77,150,124,139,110,177,10,177,207,178,110,186,135,158,211,137,212,247,247,155,155,118,187,38,82,72,170,186,104,39,188,76,186,191,255,49,206,231,109,219,118,214,49,171,
+    172,189,212,82,233,52,197,131,142,70,209,155,93,141,243,111,158,84,219,178,28,171,221,152,219,135,244,11,118,45,54,44,167,30,122,166,149,228,60,165,49,9,94,60,103,197,153,237,40,17,
+    92,179,4,11,253,35,173,192,32,193,128,96,64,48,130,1,193,128,224,13,178,161,179,149,8,254,166,197,147,242,43,152,39,216,205,238,176,213,186,138,233,211,106,239,189,94,218,54,141,204,
+    22,44,69,253,174,236,242,179,29,139,223,233,105,142,222,59,130,19,19,223,214,89,165,82,46,87,42,205,56,14,102,45,78,235,116,51,8,78,74,124,43,229,9,149,219,24,158,85,169,108,242,119,
+    121,210,93,18,226,219,156,251,45,199,17,225,224,81,142,195,76,13,193,223,234,183,127,187,208,235,10,62,235,127,249,35,195,199,237,14,59,53,4,127,95,124,11,205,178,66,165,217,143,57,
+    193,83,197,47,8,254,30,191,109,53,190,211,107,240,151,215,194,53,205,77,43,41,86,156,234,199,9,15,155,33,191,110,128,191,62,236,200,104,111,56,235,189,32,248,27,22,71,1,189,149,102,
+    33,150,143,190,233,234,21,115,170,114,163,139,163,225,93,40,190,229,219,122,92,159,174,87,156,74,195,169,77,112,40,190,110,3,221,18,49,222,220,240,210,77,249,109,163,41,23,220,88,138,
+    239,93,59,222,123,87,196,203,242,237,73,61,4,111,168,62,55,238,214,26,223,133,226,80,67,221,69,240,134,250,171,86,57,20,223,161,230,93,255,176,63,28,245,222,151,206,33,130,191,129,
+    118,179,242,81,124,157,89,43,246,47,109,155,118,85,172,42,230,26,188,169,43,176,210,96,85,202,205,161,174,60,215,11,173,79,47,154,174,6,167,209,35,103,95,113,26,3,156,250,4,187,139,
+    163,190,238,234,123,123,230,190,168,171,220,26,142,247,92,254,68,111,28,205,20,247,218,8,222,212,26,248,182,178,58,190,238,27,38,251,195,103,195,79,180,94,19,191,46,39,43,222,155,233,
+    116,152,100,109,80,112,125,90,163,221,248,142,52,86,164,24,206,22,81,149,59,71,126,212,176,157,204,252,238,93,244,133,129,164,116,29,92,104,186,249,44,123,163,73,109,234,230,171,168,
+    202,89,248,209,44,225,126,217,17,153,185,224,189,99,225,32,56,49,125,86,235,246,182,165,223,90,240,3,236,126,249,168,70,203,69,133,118,25,24,104,56,165,130,157,192,151,176,179,197,
+    24,100,233,34,236,246,203,131,118,240,131,78,125,193,127,110,72,112,114,20,71,13,39,28,81,80,142,240,4,174,171,237,73,90,47,6,193,53,146,47,120,239,184,230,32,56,249,225,254,233,175,
+    146,91,129,0,207,171,241,85,84,141,222,203,24,87,164,45,243,252,246,149,0,215,181,237,212,69,96,95,177,113,161,20,233,43,18,156,214,0,171,87,219,19,253,66,201,115,143,224,164,251,245,
+    231,152,193,43,176,90,139,3,51,141,64,159,181,151,65,112,194,135,32,197,178,18,96,169,122,60,142,90,15,245,149,34,29,72,55,130,19,184,64,110,70,180,208,106,80,195,11,222,64,145,238,
+    35,56,201,1,86,182,138,131,103,104,85,193,167,65,193,193,34,125,106,212,109,168,150,185,1,62,107,4,52,58,98,16,37,88,136,90,176,72,59,8,78,65,128,139,193,36,170,130,143,151,66,122,
+    245,71,41,210,13,18,156,84,250,74,128,175,194,117,248,74,17,188,212,124,15,212,129,150,65,69,218,40,193,142,104,249,39,1,126,138,240,190,209,201,138,213,110,112,160,53,32,193,137,15,
+    176,102,31,169,177,40,195,127,52,135,51,12,45,210,150,89,1,246,143,106,221,45,119,74,109,95,112,67,19,225,129,145,125,150,89,9,86,2,92,88,86,228,15,157,53,130,131,69,26,193,201,92,
+    35,249,83,202,59,93,159,228,175,133,180,123,10,126,9,223,51,103,207,193,32,193,82,140,252,227,180,67,157,224,227,15,18,234,31,207,50,167,141,54,42,193,253,185,224,202,93,91,119,137,
+    62,254,232,112,206,233,226,100,135,131,224,36,54,89,179,227,180,21,109,128,87,13,163,231,100,188,42,125,97,210,166,176,89,77,86,253,174,50,65,251,36,135,21,195,104,165,211,30,12,78,
+    218,2,193,73,165,86,108,150,203,205,86,68,192,51,31,10,54,239,105,151,230,109,23,14,135,163,168,10,62,136,158,85,250,239,50,236,161,181,230,109,248,139,168,59,133,87,14,163,141,197,
+    192,83,149,78,100,15,118,101,238,209,171,45,18,188,2,127,220,124,188,53,207,150,222,42,193,237,139,15,187,104,4,167,122,157,60,48,248,30,21,4,123,138,167,43,225,63,39,2,193,134,114,
+    114,124,113,124,218,16,8,6,4,167,245,66,44,28,4,3,130,1,193,128,96,64,48,32,24,16,140,96,64,48,32,24,16,12,8,6,4,3,130,1,193,8,6,4,3,130,1,193,128,96,64,48,32,24,193,128,96,64,48,32,
+    24,16,12,8,6,4,35,24,16,12,8,6,4,3,130,1,193,128,96,64,48,130,1,193,128,96,64,48,32,24,16,12,8,70,48,32,24,16,12,8,6,4,3,130,1,193,8,230,71,128,96,64,48,32,24,16,12,8,6,4,3,130,17,
+    12,8,6,4,3,130,1,193,128,96,64,48,130,193,72,254,7,214,115,53,200,119,39,137,89,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,216,216,216,161,161,161,24,24,24,212,212,212,
+    235,235,235,143,143,143,115,115,115,161,161,161,16,16,16,121,121,121,140,140,140,100,100,100,231,231,231,0,0,0,73,73,73,146,146,146,37,37,37,219,219,219,109,109,109,255,255,255,254,
+    254,254,10,10,10,126,126,126,113,113,113,226,226,226,24,24,24,36,36,36,38,38,38,109,109,109,58,58,58,69,69,69,71,71,71,72,72,72,107,107,107,169,169,169,217,217,217,36,36,36,87,87,87,
+    35,35,35,104,104,104,214,214,214,216,216,216,88,88,88,104,104,104,35,35,35,145,145,145,69,69,69,103,103,103,107,107,107,58,58,58,100,100,100,137,137,137,138,138,138,10,10,10,34,34,
+    34,8,8,8,36,36,36,70,70,70,68,68,68,26,26,26,10,10,10,70,70,70,137,137,137,251,251,251,95,134,125,97,0,0,0,64,116,82,78,83,91,36,87,34,159,164,98,103,141,49,214,144,194,0,253,253,253,
+    253,252,1,253,253,3,254,254,17,207,16,207,14,111,174,209,146,9,207,176,11,80,80,140,174,44,109,144,209,140,17,174,48,47,79,143,207,112,43,44,18,80,43,177,48,109,211,215,3,65,15,0,0,
+    10,99,73,68,65,84,120,218,237,221,105,87,226,202,26,134,225,0,34,218,123,151,10,209,200,32,163,130,76,130,3,98,35,14,255,255,95,29,194,16,146,34,9,30,118,16,170,184,159,15,174,213,
+    141,173,171,189,124,107,78,97,8,162,117,12,126,4,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,
+    9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,120,55,177,106,
+    166,105,2,172,109,76,215,71,128,117,244,181,82,134,81,163,130,181,245,53,190,47,47,47,191,141,195,173,97,67,115,223,203,89,14,87,216,208,218,55,241,61,7,254,78,4,9,191,157,124,188,
+    126,196,115,0,43,93,192,193,37,252,246,122,101,231,3,96,197,129,143,2,62,103,230,123,117,21,7,88,113,224,156,111,9,199,231,190,87,175,111,0,43,23,75,152,14,112,64,39,124,178,0,214,
+    182,132,245,174,96,243,104,77,39,252,234,0,83,193,74,10,55,93,157,176,25,210,66,95,189,210,7,171,222,9,251,181,209,203,22,250,4,96,37,59,225,216,183,35,236,7,252,161,125,23,172,5,176,
+    105,90,65,235,84,197,208,78,248,237,74,251,46,88,7,96,211,249,176,102,38,108,6,119,193,44,116,236,115,106,137,88,223,159,216,3,92,95,249,148,15,253,187,96,13,128,251,198,109,58,221,
+    50,250,126,194,174,213,232,203,239,216,202,103,188,234,223,5,171,15,92,104,166,179,233,108,54,221,172,249,214,112,45,164,19,62,128,73,146,242,192,166,72,165,231,105,250,181,210,166,
+    112,3,31,222,36,73,253,10,30,181,178,11,225,73,133,174,8,215,188,203,209,7,55,73,82,29,216,20,163,91,7,56,237,51,17,178,68,59,235,234,132,173,67,155,36,169,15,28,91,86,176,127,13,139,
+    127,157,18,78,137,218,161,77,146,52,232,131,143,92,192,62,53,28,178,28,189,190,133,30,199,135,141,49,192,59,46,225,219,80,97,207,76,216,219,66,175,157,36,13,243,23,23,23,249,33,192,
+    187,21,54,210,233,16,225,201,111,128,3,124,105,186,95,92,55,73,42,12,47,102,105,0,188,199,194,166,168,31,249,239,55,172,153,36,21,186,115,223,139,124,14,224,93,198,90,83,195,203,153,
+    240,183,103,45,36,188,133,206,57,190,23,23,113,128,247,168,134,179,19,225,154,231,213,132,255,32,235,42,236,56,150,219,23,224,93,3,75,194,183,9,239,116,104,113,110,71,58,150,245,26,
+    50,73,42,184,125,213,238,132,245,216,15,150,132,61,43,26,147,97,214,244,249,21,249,72,199,73,112,11,157,187,115,251,230,11,0,239,94,184,41,213,176,183,31,78,24,70,66,94,170,94,76,147,
+    86,11,184,224,241,101,20,189,23,221,112,191,41,213,176,233,241,159,125,146,240,17,254,120,11,175,95,197,125,117,57,147,101,138,154,71,184,85,147,74,220,247,33,240,248,36,66,111,95,
+    109,14,221,77,6,203,110,225,116,98,211,199,9,255,234,229,171,207,169,74,91,56,27,182,42,253,179,140,243,122,249,106,116,108,214,242,236,44,73,59,71,63,174,95,143,111,94,125,95,157,
+    206,69,187,132,165,81,214,166,190,99,1,240,126,181,210,142,176,17,133,239,95,1,240,190,213,112,162,149,206,218,39,240,54,42,96,105,125,99,44,0,222,195,86,218,104,182,154,198,102,107,
+    79,113,253,234,87,73,224,176,123,205,236,151,114,98,195,139,177,134,46,223,59,77,124,149,3,158,234,134,220,93,55,123,93,252,215,10,190,27,11,128,119,51,142,18,162,111,137,112,228,77,
+    51,94,250,234,115,235,142,161,152,111,204,56,186,157,116,178,137,173,24,119,245,243,85,11,216,20,137,219,172,157,244,109,51,149,168,175,235,144,255,239,204,183,145,186,5,1,240,142,
+    124,157,149,140,172,253,192,217,236,18,202,8,11,57,215,184,187,235,54,132,0,120,87,13,180,123,63,193,46,228,35,35,182,165,14,25,224,223,79,77,58,94,183,40,228,152,37,14,250,198,96,
+    141,42,88,6,158,26,219,61,178,81,67,88,187,38,218,83,200,173,4,194,26,140,162,77,207,147,72,233,224,83,58,68,209,105,82,172,149,14,32,206,30,129,169,195,66,71,205,104,205,198,86,171,
+    37,220,246,62,254,27,113,114,241,97,119,50,135,42,0,188,101,97,49,74,24,205,219,85,99,233,52,116,180,184,141,225,93,94,209,77,38,37,55,27,38,117,220,148,11,121,91,157,240,91,220,193,
+    85,242,24,188,122,219,133,243,107,237,138,49,163,229,46,228,108,51,122,223,241,4,247,66,78,3,224,223,168,227,69,33,223,206,11,217,126,154,33,210,22,122,220,240,86,174,147,46,192,191,
+    105,28,155,22,114,58,221,138,182,129,206,117,125,113,1,222,5,114,33,102,164,98,209,174,85,230,238,46,2,51,4,120,7,133,28,241,90,244,48,216,87,181,231,253,117,120,62,216,50,205,104,
+    39,72,185,124,48,176,106,155,137,188,189,172,223,0,43,8,56,223,85,238,44,30,192,63,173,224,124,119,168,226,73,75,128,253,210,149,112,239,186,141,191,138,158,211,2,216,47,238,103,88,
+    38,149,171,242,25,90,128,125,211,152,9,231,79,226,92,101,168,105,55,220,232,14,27,58,156,174,4,56,52,22,192,4,224,109,102,186,196,97,90,64,234,8,108,213,166,176,118,79,201,113,44,205,
+    128,77,107,86,180,177,216,75,50,153,252,226,192,157,78,192,11,220,92,251,126,144,60,159,230,225,5,97,77,128,231,184,245,211,227,5,238,76,56,38,232,135,53,0,158,239,241,127,37,31,206,
+    165,36,1,214,162,130,139,177,212,42,238,20,184,136,165,250,192,214,215,159,243,128,36,251,88,170,14,108,22,147,231,129,73,70,59,202,178,44,203,2,248,151,203,87,188,4,251,158,111,101,
+    144,101,1,252,171,3,172,144,2,254,138,246,123,253,141,151,74,159,69,215,168,29,224,223,72,80,7,252,144,124,137,246,27,189,87,206,38,169,244,222,11,179,121,55,192,187,171,224,135,228,
+    224,229,116,20,101,7,108,138,248,217,34,149,114,233,73,241,66,86,9,248,216,107,251,231,79,242,248,190,157,139,188,179,44,150,207,220,41,247,226,35,133,141,85,2,126,126,112,87,238,113,
+    123,190,31,111,69,188,74,249,116,38,167,210,155,247,200,0,111,87,56,54,19,254,147,252,122,153,149,147,25,125,89,89,62,192,211,66,46,197,139,0,111,91,184,255,53,24,76,154,229,233,31,
+    106,219,106,50,63,207,2,82,233,141,0,222,242,84,120,65,109,153,91,252,53,42,7,9,159,149,71,0,111,183,134,77,115,27,205,178,4,252,84,9,20,238,1,172,67,158,130,107,120,12,240,46,235,
+    59,170,175,148,251,44,149,253,203,184,161,218,250,165,78,111,171,19,169,177,24,189,247,124,140,159,0,222,217,16,91,212,173,200,246,12,103,253,124,113,82,200,210,64,90,185,81,150,161,
+    77,253,158,38,31,30,30,82,86,196,77,66,238,201,83,200,37,229,206,126,25,186,248,190,204,22,65,146,86,148,4,243,66,126,239,205,11,185,167,222,195,44,186,188,189,172,179,78,61,136,186,
+    198,230,133,92,234,149,79,158,20,252,209,232,241,6,209,238,179,0,167,209,183,162,150,194,103,114,13,221,124,207,95,54,27,231,154,34,116,83,202,110,172,149,220,24,54,116,243,61,63,222,
+    112,34,147,43,10,29,163,62,176,37,190,60,39,0,250,155,189,47,101,169,92,41,151,138,0,239,243,248,106,154,212,6,190,206,242,115,185,8,240,222,45,111,120,234,247,124,208,223,164,126,
+    11,101,117,183,139,180,6,158,96,166,188,190,155,76,131,235,226,125,185,33,88,4,120,159,124,235,3,175,111,97,147,14,216,18,165,51,109,133,13,165,125,115,3,185,126,61,35,104,171,110,
+    254,100,14,235,62,71,169,228,106,149,166,192,43,245,155,146,158,244,255,233,53,165,150,7,248,172,151,3,120,63,82,28,200,79,55,72,150,159,255,60,62,118,86,119,152,76,83,62,21,226,61,
+    41,219,3,120,63,234,55,41,207,143,164,250,189,191,185,158,228,230,121,109,13,203,167,116,122,69,128,247,32,114,253,154,82,187,251,156,185,206,76,178,42,220,238,116,58,207,210,23,243,
+    10,151,244,185,17,66,85,96,75,156,122,124,95,86,15,115,84,167,190,19,225,142,151,235,254,198,150,175,22,188,95,78,22,6,120,183,169,121,23,56,124,118,24,234,55,11,224,71,111,195,61,
+    45,236,107,137,221,18,159,122,214,176,170,192,166,103,133,99,245,146,29,107,2,153,241,1,22,163,199,153,251,117,230,89,250,165,136,107,89,195,234,2,127,133,110,32,153,78,11,157,185,
+    174,186,221,219,142,123,71,254,87,239,146,176,5,240,46,129,99,139,71,209,252,47,201,42,62,46,128,51,247,75,170,192,194,158,190,246,238,57,96,247,174,69,43,173,240,52,105,190,139,244,
+    224,119,132,195,25,67,75,109,177,93,193,139,191,191,169,175,252,67,89,24,224,157,10,219,231,236,254,12,124,111,231,48,69,199,105,161,31,235,1,149,45,119,194,114,13,87,158,0,222,109,
+    234,177,227,118,192,65,155,186,227,40,247,181,85,215,11,171,67,179,146,110,67,105,165,111,155,117,125,148,95,105,223,248,117,193,246,43,29,191,193,215,50,110,225,50,21,188,227,86,58,
+    232,54,43,247,88,234,166,47,119,206,206,43,69,191,182,189,4,176,10,181,93,13,172,211,190,179,0,146,241,127,207,240,146,86,51,37,77,31,31,45,6,180,208,118,137,46,71,89,199,254,227,179,
+    222,98,144,245,73,5,239,107,1,187,218,225,79,175,98,93,28,135,119,194,66,20,122,76,147,246,29,56,104,146,52,93,116,94,226,7,109,237,191,151,43,149,222,147,0,120,111,19,56,73,178,11,
+    116,217,9,7,63,237,59,210,229,224,142,161,101,1,63,47,187,96,159,129,148,123,38,92,15,158,128,89,0,239,45,176,107,146,100,249,180,223,206,171,255,232,127,79,188,142,192,222,157,36,
+    107,117,17,196,189,28,13,176,130,190,253,192,73,146,60,135,122,214,190,132,53,4,150,90,104,31,193,106,168,63,192,123,15,124,28,184,231,43,79,162,170,52,209,234,165,190,172,224,76,199,
+    167,66,221,203,32,143,5,128,21,172,224,197,40,42,104,181,121,185,28,125,211,214,189,141,214,115,161,99,222,201,78,90,96,51,116,29,228,90,255,81,150,158,192,163,106,230,250,250,58,83,
+    173,251,2,47,59,97,123,47,17,96,37,133,239,171,143,213,251,66,80,27,254,153,89,83,226,0,43,62,83,238,216,21,254,163,231,150,0,222,215,145,86,216,173,71,246,131,105,153,204,77,181,173,
+    255,47,243,193,222,23,221,111,127,22,14,225,255,121,168,192,243,55,245,0,88,99,226,195,120,195,97,174,244,7,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,
+    0,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,
+    48,1,152,0,76,0,38,0,19,128,1,230,71,0,48,1,152,0,76,0,38,0,19,128,9,192,7,148,255,1,67,189,53,98,41,5,242,28,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,240,241,79,84,
+    84,79,0,12,0,128,0,3,0,64,67,70,70,32,79,171,101,166,0,0,12,220,0,0,99,217,71,68,69,70,29,125,29,163,0,0,112,184,0,0,1,54,71,80,79,83,93,165,55,104,0,0,113,240,0,0,60,110,71,83,85,
+    66,237,81,41,229,0,0,174,96,0,0,11,194,79,83,47,50,89,210,241,121,0,0,1,48,0,0,0,96,99,109,97,112,35,126,40,112,0,0,7,152,0,0,5,36,104,101,97,100,30,183,109,21,0,0,0,204,0,0,0,54,104,
+    104,101,97,9,199,7,8,0,0,1,4,0,0,0,36,104,109,116,120,98,176,77,243,0,0,186,36,0,0,7,224,109,97,120,112,1,248,80,0,0,0,1,40,0,0,0,6,110,97,109,101,51,35,200,219,0,0,1,144,0,0,6,6,112,
+    111,115,116,255,64,0,80,0,0,12,188,0,0,0,32,0,1,0,0,0,2,0,0,38,248,30,215,95,15,60,245,0,3,3,232,0,0,0,0,221,23,225,123,0,0,0,0,221,24,71,105,255,52,255,12,6,58,4,66,0,1,0,6,0,2,0,
+    0,24,0,240,3,0,1,0,0,3,242,255,16,0,100,6,203,255,52,255,52,6,58,18,0,1,26,0,3,5,0,81,1,248,0,0,80,6,0,242,3,0,4,2,58,2,188,0,5,0,0,2,138,2,88,0,0,0,75,8,0,99,1,94,0,50,1,44,47,0,1,
+    7,0,64,128,0,0,71,187,0,1,13,0,210,0,0,0,73,84,70,79,0,160,0,32,251,4,108,0,128,3,242,0,240,32,0,0,147,32,0,242,1,1,238,2,219,0,0,0,32,0,12,0,0,0,22,1,14,128,0,68,1,0,0,31,66,0,99,
+    1,1,0,11,0,31,24,0,83,2,0,11,0,42,12,0,243,2,3,0,11,0,53,0,3,0,1,4,9,0,0,0,122,0,64,12,0,83,1,0,14,0,186,12,0,83,2,0,8,0,200,12,0,83,3,0,46,0,208,12,0,83,4,0,24,0,254,12,0,83,5,0,26,
+    1,22,12,0,83,6,0,24,1,48,12,0,83,7,0,100,1,72,12,0,83,8,0,38,1,172,12,0,83,9,0,24,1,210,12,0,83,11,0,58,1,234,12,0,83,12,0,66,2,36,12,0,83,13,1,220,2,102,12,0,82,14,0,54,4,66,12,0,
+    99,1,0,0,62,4,120,12,0,83,1,0,22,4,182,12,0,83,2,0,22,4,204,12,0,246,21,3,0,22,4,226,65,108,116,101,114,110,97,116,101,32,71,44,32,97,44,32,114,101,103,105,115,116,101,114,101,100,
+    32,115,105,103,110,31,0,22,103,11,0,22,116,11,0,241,16,81,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,55,0,45,10,0,241,20,50,0,49,0,32,0,73,0,110,0,100,
+    0,105,0,97,0,110,0,32,0,84,0,121,0,112,0,101,0,32,0,70,0,111,0,117,28,0,247,0,114,0,121,0,46,0,32,0,65,0,108,0,108,0,32,82,0,17,115,14,0,241,28,101,0,115,0,101,0,114,0,118,0,101,0,
+    100,0,46,0,83,0,97,0,116,0,111,0,115,0,104,0,105,0,66,0,111,0,108,0,100,0,50,0,46,0,48,2,0,187,59,0,73,0,84,0,70,0,79,0,59,44,0,21,45,46,0,10,68,0,21,32,24,0,17,86,106,0,81,115,0,105,
+    0,111,176,0,6,86,0,10,50,0,15,74,0,7,17,105,182,0,241,12,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,26,0,17,104,4,1,15,28,1,21,15,40,0,19,113,68,0,
+    101,0,110,0,105,74,1,81,110,0,103,0,103,118,0,17,97,156,1,209,116,0,112,0,115,0,58,0,47,0,47,0,105,118,1,2,146,1,19,116,144,1,27,102,142,1,93,99,0,111,0,109,58,0,17,119,2,0,31,46,66,
+    0,24,17,84,164,1,0,18,1,0,240,1,17,110,38,2,17,83,6,1,49,116,0,119,160,0,0,12,2,2,52,1,177,112,0,114,0,111,0,116,0,101,0,99,6,0,51,100,0,32,34,2,0,254,1,49,32,0,100,148,0,0,14,2,113,
+    116,0,105,0,99,0,32,84,2,0,38,0,0,210,0,0,56,0,49,114,0,110,28,2,2,190,1,17,97,78,2,15,134,1,1,0,140,2,0,56,0,0,230,0,12,196,2,81,108,0,97,0,119,144,2,17,89,20,1,0,102,0,81,103,0,114,
+    0,101,178,1,0,120,2,49,32,0,105,214,1,0,206,0,89,105,0,102,0,121,210,1,0,122,2,17,32,80,1,0,32,0,0,250,0,17,98,34,0,0,154,0,17,109,68,0,6,126,0,0,86,0,0,28,3,0,60,3,6,20,2,0,66,0,17,
+    39,70,2,83,111,0,119,0,110,146,2,0,236,2,29,112,66,2,14,222,0,0,114,0,6,98,0,12,164,3,0,30,0,0,46,1,0,214,0,17,110,152,0,0,160,2,0,240,2,17,103,240,2,53,111,0,114,138,1,49,100,0,117,
+    138,1,2,78,1,49,32,0,99,6,1,2,176,0,61,115,0,46,30,2,6,244,0,19,104,218,1,17,46,98,1,49,109,0,47,208,1,81,114,0,109,0,115,230,3,8,172,1,0,0,2,49,71,0,44,206,1,0,6,0,0,20,1,17,103,18,
+    2,2,38,0,0,244,3,21,32,162,0,0,36,4,2,24,0,0,80,1,0,10,0,63,32,0,103,84,0,2,31,116,22,0,2,16,81,20,6,0,202,6,96,0,3,0,0,0,20,18,5,1,8,0,241,136,4,5,16,0,0,0,138,0,128,0,6,0,10,0,47,
+    0,57,0,126,0,169,0,172,0,185,1,35,1,43,1,49,1,55,1,72,1,77,1,107,1,126,1,146,1,255,2,27,2,55,2,199,2,221,3,4,3,8,3,12,3,18,3,39,3,53,3,56,3,169,3,192,30,133,30,243,32,20,32,26,32,30,
+    32,34,32,38,32,48,32,50,32,58,32,66,32,68,32,112,32,121,32,137,32,172,33,23,33,34,33,46,33,94,33,153,34,2,34,6,34,15,34,18,34,26,34,30,34,43,34,72,34,96,34,101,37,161,37,179,37,203,
+    37,207,38,46,39,19,248,255,251,4,255,255,186,6,241,36,48,0,58,0,161,0,171,0,174,0,187,1,38,1,46,1,52,1,57,1,74,1,80,1,110,1,146,1,250,2,24,2,55,2,198,2,216,3,0,3,6,3,10,3,18,3,38,3,
+    53,3,55,140,0,179,128,30,242,32,19,32,24,32,28,32,32,140,0,19,57,140,0,113,116,32,128,32,172,33,22,140,0,183,91,33,144,34,2,34,5,34,15,34,17,140,0,117,100,37,160,37,178,37,202,140,
+    0,17,0,140,0,17,216,62,1,15,5,0,0,32,255,229,21,0,32,255,166,6,0,2,4,0,176,254,177,254,158,254,188,0,0,253,93,253,172,7,80,0,0,0,225,87,26,0,241,49,225,45,225,98,225,132,225,49,225,
+    11,225,0,224,202,224,202,224,156,224,202,0,0,224,139,224,133,223,237,0,0,223,142,0,0,223,125,0,0,223,116,223,107,223,95,223,61,223,31,0,0,220,0,219,240,0,0,219,206,219,118,218,146,
+    8,215,182,7,240,30,138,0,0,0,166,1,46,1,62,1,64,1,86,2,38,2,48,2,54,2,60,2,90,2,96,2,150,0,0,2,180,2,190,0,0,2,194,2,196,2,206,2,214,2,218,118,0,49,0,0,2,188,0,194,2,214,2,224,2,226,
+    0,0,2,226,2,230,24,0,10,6,0,34,2,214,16,0,32,2,210,36,0,2,4,0,2,18,0,34,0,0,74,0,2,72,0,0,20,0,0,36,0,241,31,1,114,1,84,1,90,1,86,1,117,1,145,1,167,1,91,1,99,1,100,1,76,1,122,1,82,
+    1,103,1,87,1,93,1,81,1,92,1,129,1,126,1,128,1,88,1,166,58,8,241,255,255,154,15,0,21,0,25,0,35,0,36,0,41,0,43,0,52,0,54,0,56,0,62,0,63,0,69,0,80,0,82,0,83,0,87,0,93,0,98,0,108,0,109,
+    0,114,0,115,0,120,1,97,1,78,1,98,1,181,1,94,1,206,0,125,0,138,0,139,0,145,0,149,0,159,0,160,0,165,0,167,0,176,0,178,0,180,0,186,0,187,0,193,0,204,0,206,0,207,0,211,0,218,0,223,0,233,
+    0,234,0,239,0,240,0,245,1,95,1,175,1,96,1,134,1,85,1,115,1,120,1,116,1,121,1,176,1,169,1,204,1,170,1,104,1,135,1,171,1,208,1,174,1,132,1,60,1,61,1,199,1,143,1,168,1,79,1,202,1,59,1,
+    105,1,70,1,69,1,71,1,89,0,6,0,2,0,4,0,11,0,5,0,9,0,12,0,18,0,32,0,26,0,29,0,30,0,48,0,44,0,45,0,46,0,22,0,68,0,73,0,70,0,71,0,78,0,72,1,124,0,76,0,102,0,99,0,100,0,101,0,116,0,81,0,
+    217,0,130,0,126,0,128,0,135,0,129,0,133,0,136,0,142,0,156,0,150,0,153,0,154,0,172,0,168,0,169,0,170,0,146,0,192,0,197,0,194,0,195,0,202,0,196,1,125,0,200,0,227,0,224,0,225,0,226,0,
+    241,0,205,0,243,0,7,0,131,0,3,0,127,0,8,0,132,0,16,0,140,0,19,0,143,0,20,0,144,0,17,0,141,0,23,0,147,0,24,0,148,0,33,0,157,0,27,0,151,0,31,0,155,0,34,0,158,0,28,0,152,0,38,0,162,0,
+    37,0,161,0,40,0,164,0,39,0,163,0,42,0,166,0,51,0,175,0,49,0,173,0,50,0,174,0,47,1,220,0,53,0,177,0,55,0,179,0,57,0,181,0,59,0,183,0,58,0,182,0,60,0,184,0,61,0,185,0,64,0,188,0,66,0,
+    190,0,65,0,189,0,67,0,191,0,75,0,199,0,74,0,198,0,79,0,203,0,84,0,208,0,86,0,210,0,85,0,209,0,88,0,212,0,91,0,215,0,90,0,214,0,89,0,213,0,96,0,221,0,95,0,220,0,94,0,219,0,107,0,232,
+    0,104,0,229,0,106,0,231,0,103,0,228,0,105,0,230,0,111,0,236,0,117,0,242,0,118,0,121,0,246,0,123,0,248,0,122,0,247,0,10,0,134,0,13,0,137,0,77,0,201,0,92,0,216,0,97,0,222,1,203,1,201,
+    1,200,1,205,1,210,1,209,1,211,1,207,1,186,1,187,1,189,1,193,1,194,1,191,1,185,1,184,1,192,1,188,1,190,1,242,1,198,0,113,0,238,0,110,0,235,0,112,0,237,0,119,0,244,1,102,1,101,1,109,
+    1,110,1,108,1,177,1,178,1,80,1,180,1,172,1,153,1,147,1,149,1,151,1,155,1,156,1,154,1,148,1,150,1,152,1,136,1,139,1,141,1,123,1,131,1,130,1,159,1,158,0,252,1,1,1,2,0,253,0,254,0,3,227,
+    2,81,0,255,61,0,80,9,0,11,5,0,240,6,1,0,4,2,0,1,1,1,13,83,97,116,111,115,104,105,45,66,111,108,100,17,0,240,43,64,249,45,0,249,46,1,249,47,12,0,249,48,2,249,49,3,249,50,4,251,87,12,
+    3,219,12,4,251,96,251,136,29,0,0,6,58,250,214,5,29,0,0,29,33,15,29,0,0,32,28,16,179,29,0,0,90,36,18,13,0,241,255,255,125,30,17,1,24,2,0,1,0,7,0,14,0,21,0,31,0,38,0,44,0,50,0,61,0,71,
+    0,77,0,83,0,89,0,95,0,105,0,112,0,119,0,125,0,136,0,148,0,158,0,162,0,172,0,179,0,186,0,192,0,203,0,215,0,221,0,227,0,239,0,243,0,249,0,255,1,11,1,14,1,27,1,34,1,45,1,51,1,57,1,69,
+    1,75,1,83,1,94,1,106,1,110,1,116,1,124,1,136,1,149,1,156,1,163,1,168,1,174,1,180,1,191,1,200,1,206,1,217,1,223,1,229,1,239,1,245,1,251,2,2,2,9,2,19,2,26,2,32,2,38,2,49,2,59,2,65,2,
+    71,2,77,2,83,2,93,2,100,2,107,2,113,2,124,2,136,2,146,2,150,2,160,2,167,2,174,2,180,2,191,2,203,2,209,2,215,2,227,2,231,2,237,2,243,2,255,3,2,3,15,3,22,3,33,3,39,3,45,3,57,3,63,3,71,
+    3,82,3,94,3,98,3,104,3,112,3,124,3,137,3,144,3,151,3,156,3,162,3,168,3,179,3,188,3,194,3,205,3,211,3,217,3,227,3,233,3,239,3,245,3,248,3,253,4,2,4,5,4,8,4,11,4,14,4,17,4,22,4,24,4,
+    31,4,37,4,43,4,51,4,58,4,65,4,71,4,79,4,87,4,94,4,107,4,119,4,131,4,145,4,158,4,171,4,183,4,197,4,211,4,224,4,233,4,241,4,249,5,3,5,12,5,21,5,29,5,39,5,49,5,58,5,67,5,75,5,83,5,93,
+    5,102,5,111,5,119,5,129,5,139,5,148,5,161,5,174,5,187,5,199,5,213,5,227,5,240,5,248,5,252,6,4,6,16,6,25,6,36,6,44,6,52,6,60,6,69,6,76,6,85,6,92,6,97,6,108,6,115,6,122,6,132,6,139,6,
+    148,6,155,6,164,6,171,6,180,6,189,6,200,6,206,6,213,6,222,6,233,6,240,6,255,7,4,7,9,7,23,7,32,7,38,7,44,7,59,7,71,7,84,7,93,7,102,7,118,7,132,7,141,7,150,7,158,7,167,7,177,7,197,7,
+    212,7,223,7,236,7,255,8,19,8,22,8,33,8,49,8,66,8,81,8,87,8,95,8,106,8,117,8,133,8,147,8,158,8,170,8,182,8,192,8,207,8,218,8,229,8,245,9,6,9,21,9,30,9,41,9,54,9,71,9,84,9,99,9,113,9,
+    133,9,152,9,171,9,189,9,204,9,207,10,1,10,62,10,74,10,81,10,90,65,98,114,101,118,101,65,109,97,99,114,111,110,65,111,103,111,110,101,107,65,114,105,110,103,97,99,117,116,101,65,69,
+    97,99,117,116,101,67,97,99,117,116,101,67,99,97,114,111,110,67,99,105,114,99,117,109,102,108,101,120,67,100,111,116,97,99,99,101,110,116,68,99,97,114,111,110,68,99,114,111,97,116,69,
+    82,0,17,69,45,0,21,69,34,0,18,69,98,0,129,69,111,103,111,110,101,107,71,36,0,22,71,75,0,98,71,99,111,109,109,97,77,0,21,71,53,0,85,72,98,97,114,73,14,0,18,73,67,0,18,73,67,0,118,73,
+    116,105,108,100,101,74,67,0,23,75,67,0,17,76,190,0,17,76,132,0,24,76,24,0,65,100,111,116,78,28,0,17,78,28,0,23,78,28,0,242,2,69,110,103,79,104,117,110,103,97,114,117,109,108,97,117,
+    116,79,111,0,97,79,115,108,97,115,104,52,0,18,82,6,0,1,58,0,23,82,58,0,17,83,24,0,150,83,99,101,100,105,108,108,97,83,147,0,23,83,37,0,81,84,98,97,114,84,59,0,19,84,41,0,23,84,30,0,
+    24,85,122,0,18,85,122,0,18,85,233,0,16,85,142,1,17,85,238,0,17,87,105,0,22,87,97,0,246,1,87,100,105,101,114,101,115,105,115,87,103,114,97,118,101,89,26,0,17,89,17,0,17,90,49,0,21,90,
+    67,1,113,71,46,115,115,48,49,97,126,1,18,97,102,0,18,97,102,0,16,97,102,0,1,46,0,33,97,101,7,0,18,99,6,0,1,178,0,22,99,88,0,21,99,76,0,17,100,27,0,17,100,244,1,17,101,82,0,17,101,18,
+    0,21,101,34,0,18,101,98,0,18,101,98,0,17,103,36,0,22,103,75,0,23,103,0,1,21,103,53,0,85,104,98,97,114,105,14,0,18,105,67,0,18,105,67,0,17,105,6,1,22,106,67,0,23,107,67,0,17,108,177,
+    0,17,108,132,0,24,108,24,0,65,100,111,116,110,28,0,17,110,28,0,23,110,28,0,72,101,110,103,111,122,1,18,111,111,0,22,111,244,1,17,114,58,0,17,114,58,0,23,114,58,0,17,115,24,0,19,115,
+    203,1,22,115,147,0,23,115,37,0,81,116,98,97,114,116,59,0,19,116,41,0,23,116,30,0,24,117,122,0,18,117,122,0,18,117,233,0,16,117,142,1,17,117,238,0,17,119,105,0,22,119,97,0,20,119,244,
+    1,17,119,227,1,22,121,26,0,17,121,17,0,17,122,49,0,21,122,67,1,17,97,244,1,16,103,6,0,32,50,116,6,0,144,51,102,95,102,102,95,102,95,105,5,0,240,23,108,102,95,116,102,95,121,116,95,
+    105,116,95,116,116,95,121,79,109,101,103,97,112,105,122,101,114,111,46,116,102,111,110,101,46,116,102,116,119,12,0,64,116,104,114,101,14,0,160,102,111,117,114,46,116,102,102,105,118,
+    14,0,241,9,115,105,120,46,116,102,115,101,118,101,110,46,116,102,101,105,103,104,116,46,116,102,110,105,57,0,1,70,0,128,105,110,102,101,114,105,111,114,76,0,4,12,0,0,82,0,5,12,0,1,
+    88,0,4,14,0,1,94,0,5,13,0,0,100,0,4,13,0,0,106,0,5,12,0,1,112,0,4,14,0,2,118,0,4,14,0,1,124,0,4,13,0,1,130,0,64,100,110,111,109,126,0,0,8,0,0,122,0,1,8,0,1,118,0,0,10,0,1,114,0,1,9,
+    0,0,110,0,0,9,0,0,106,0,1,8,0,1,102,0,0,10,0,2,98,0,0,10,0,1,94,0,0,9,0,1,90,0,49,110,117,109,216,0,0,8,0,0,90,0,1,8,0,1,90,0,0,10,0,1,90,0,1,9,0,0,90,0,0,9,0,0,90,0,1,8,0,1,90,0,0,
+    10,0,2,90,0,0,10,0,1,90,0,0,9,0,1,90,0,49,115,117,112,54,1,1,68,0,5,13,0,0,72,0,4,13,0,0,76,0,5,12,0,1,80,0,4,14,0,2,84,0,4,14,0,1,88,0,4,13,0,16,97,168,18,240,4,105,115,109,69,117,
+    114,111,110,111,116,101,113,117,97,108,103,114,101,97,190,18,0,12,0,65,108,101,115,115,21,0,97,97,112,112,114,111,120,11,0,241,71,101,109,112,116,121,115,101,116,105,110,102,105,110,
+    105,116,121,105,110,116,101,103,114,97,108,105,110,99,114,101,109,101,110,116,112,114,111,100,117,99,116,115,117,109,109,97,116,105,111,110,114,97,100,105,99,97,108,109,105,99,114,
+    111,112,97,114,116,105,97,108,100,105,102,102,97,114,114,111,119,117,112,97,114,114,111,119,78,69,14,0,16,114,48,2,1,10,0,33,83,69,7,0,65,100,111,119,110,9,0,33,83,87,7,0,65,108,101,
+    102,116,9,0,18,78,16,0,65,98,111,116,104,16,0,64,117,112,100,110,250,2,114,108,101,98,108,97,99,107,11,0,240,19,108,111,122,101,110,103,101,102,105,108,108,101,100,98,111,120,115,113,
+    117,97,114,101,119,104,105,116,101,116,114,105,97,103,117,112,7,0,97,110,103,108,101,117,112,22,0,241,4,112,101,97,99,101,99,104,101,99,107,115,111,117,110,100,99,111,112,121,147,0,
+    240,4,101,115,116,105,109,97,116,101,100,110,117,109,101,114,111,109,105,110,117,34,1,4,231,19,0,70,3,20,49,135,3,69,99,111,109,98,109,3,0,13,0,1,134,3,0,9,0,1,137,3,0,9,0,8,233,3,
+    0,16,0,0,174,0,97,117,109,102,108,101,120,14,0,0,42,7,0,9,0,1,33,5,0,9,0,0,254,3,0,8,0,1,1,4,0,9,0,2,29,4,0,10,0,1,64,4,181,116,117,114,110,101,100,97,98,111,118,101,20,0,2,60,7,1,
+    15,0,2,136,6,0,11,0,1,200,4,48,108,111,110,107,5,128,98,98,114,97,99,107,101,116,83,1,4,15,2,3,19,0,1,244,0,4,20,0,50,73,84,70,159,7,1,230,0,7,164,7,3,16,0,6,169,7,2,17,0,5,252,0,1,
+    15,0,16,81,6,0,64,52,100,111,116,74,2,33,106,97,3,1,0,19,0,3,117,6,2,11,0,6,0,1,2,16,0,4,75,1,2,14,0,1,64,1,2,11,0,2,248,0,2,12,0,2,26,5,2,12,0,0,33,1,6,10,0,7,101,0,1,50,1,1,26,0,
+    2,111,6,0,11,0,23,50,116,6,3,16,0,10,196,0,22,50,126,6,1,32,0,0,183,5,0,9,0,18,51,188,5,3,11,0,2,86,1,3,13,0,10,65,0,17,51,228,5,0,113,1,224,46,97,108,116,115,116,114,111,107,101,115,
+    104,111,114,238,5,2,132,1,6,14,0,10,29,0,82,46,99,97,115,101,49,0,4,167,1,2,19,0,0,117,8,5,53,0,6,19,0,9,37,0,5,122,1,1,122,0,67,105,50,46,48,83,12,240,21,32,105,115,32,97,32,116,114,
+    97,100,101,109,97,114,107,32,111,102,32,116,104,101,32,73,110,100,105,97,110,32,84,121,112,101,32,70,240,2,68,114,121,46,67,243,2,175,32,50,48,49,55,45,50,48,50,49,40,0,2,82,32,65,
+    108,108,32,40,2,164,32,114,101,115,101,114,118,101,100,46,111,0,0,194,12,3,12,0,96,83,101,109,105,45,98,210,12,16,171,142,12,49,42,0,55,82,22,243,255,255,255,255,255,255,154,87,0,126,
+    0,132,1,34,1,121,1,156,1,223,1,231,1,238,2,29,2,56,2,84,2,103,2,119,2,129,2,143,2,159,2,167,2,172,2,194,2,203,2,212,2,221,2,239,2,246,2,251,2,255,3,2,3,6,3,50,3,94,3,116,3,146,3,149,
+    3,171,3,192,3,205,3,221,3,228,3,231,3,241,4,4,4,15,4,22,4,32,4,42,4,50,4,57,4,69,4,76,4,83,4,90,4,95,4,104,4,113,4,119,4,125,5,9,5,112,5,218,6,58,6,151,6,233,6,251,7,2,7,16,7,22,7,
+    98,7,172,7,238,7,247,8,27,8,33,8,68,8,125,8,179,8,212,9,4,9,24,9,35,9,70,9,113,9,156,9,191,9,215,9,220,9,239,10,22,10,34,10,57,10,62,10,100,10,131,10,154,10,181,10,202,10,223,11,2,
+    11,35,11,66,11,94,11,119,11,131,11,158,11,183,11,195,11,206,11,222,11,238,12,6,12,17,12,41,12,65,12,89,12,96,12,119,12,142,12,165,12,179,12,190,12,197,12,216,12,236,12,245,13,9,13,
+    21,13,40,13,51,13,57,13,71,13,88,13,95,13,111,13,127,13,142,13,157,13,172,13,186,13,200,13,210,13,219,13,225,13,238,13,247,14,2,14,13,14,21,14,33,14,45,14,57,14,69,14,79,14,90,14,101,
+    14,112,14,123,14,134,14,141,14,148,14,158,14,168,14,178,14,188,14,198,14,208,14,217,14,224,21,247,21,229,204,247,0,160,31,251,5,6,92,125,95,113,72,27,58,52,29,251,40,251,37,38,32,251,
+    47,251,45,242,32,247,39,30,136,248,58,75,29,21,64,247,41,5,251,5,6,236,251,41,5,11,183,176,175,182,183,102,175,95,95,102,103,95,96,176,103,183,31,11,21,251,5,6,64,251,40,5,229,6,11,
+    21,82,29,21,251,64,247,4,32,247,69,247,70,247,4,247,0,247,63,30,248,100,251,20,252,92,7,35,81,80,35,35,82,197,244,30,248,92,251,20,7,14,21,177,171,171,177,11,21,77,165,88,183,105,30,
+    85,124,109,103,90,26,97,161,108,179,123,30,92,124,109,103,95,26,54,210,102,247,59,247,71,237,197,245,229,77,185,251,14,30,251,46,6,97,119,151,165,161,155,152,167,141,31,129,167,171,
+    134,174,27,247,25,227,215,247,5,187,120,185,109,168,31,158,153,163,149,168,27,145,145,139,138,147,31,238,7,140,133,132,139,132,27,84,92,111,93,118,31,156,104,93,149,98,27,251,20,48,
+    56,251,9,31,247,10,142,21,198,182,180,201,201,182,98,79,80,97,100,77,75,97,178,199,30,92,252,36,21,170,160,156,179,30,247,58,6,188,159,127,108,97,89,119,35,34,102,155,180,31,14,21,
+    251,35,231,34,247,32,210,200,168,185,170,30,57,7,57,85,86,55,64,90,177,203,131,30,251,14,6,251,24,154,236,58,247,34,27,247,52,238,242,247,57,31,248,105,251,5,7,132,71,5,192,110,81,
+    170,65,27,251,33,45,251,0,251,36,31,247,15,142,21,220,191,200,220,224,190,81,55,53,87,80,55,59,86,201,222,30,14,21,247,115,251,38,247,47,251,101,89,29,251,115,247,36,251,47,247,101,
+    201,29,30,251,27,22,251,46,53,38,251,26,77,29,30,14,21,247,65,247,26,241,247,46,167,31,251,25,6,58,115,63,87,40,27,251,26,53,239,247,47,247,48,224,237,247,27,236,212,89,54,164,31,247,
+    27,6,247,49,114,251,21,240,251,65,27,251,106,251,35,251,43,251,119,251,121,247,30,251,40,247,105,31,14,21,247,160,225,251,160,6,11,247,46,251,14,251,46,11,251,197,90,29,247,45,247,
+    3,245,247,46,247,46,251,3,245,251,45,251,45,251,3,33,251,46,30,247,14,22,229,197,200,223,223,197,78,49,49,81,78,55,55,81,200,229,30,14,163,29,161,114,172,147,147,141,143,146,30,137,
+    109,116,126,95,143,8,99,7,215,130,184,190,209,26,14,248,154,7,247,236,252,154,5,247,18,249,111,251,18,252,154,6,251,235,248,154,5,251,19,253,111,6,11,247,10,251,218,247,86,247,184,
+    247,5,251,184,247,80,247,218,247,10,11,27,165,155,127,117,116,121,124,105,114,120,146,150,116,31,11,176,29,251,17,6,49,251,48,5,11,190,171,201,194,98,162,100,127,128,137,136,129,31,
+    11,93,183,226,130,31,248,8,140,5,176,7,247,46,45,238,11,247,78,22,249,124,92,29,11,249,200,43,29,11,7,247,20,75,216,251,16,72,79,110,89,108,30,129,203,5,251,5,252,130,6,11,199,105,
+    177,92,95,109,108,95,11,251,124,5,81,7,218,203,21,11,175,169,169,176,175,109,170,103,11,80,208,27,203,178,185,234,131,31,67,6,103,129,116,114,30,97,11,21,196,238,196,40,5,11,171,145,
+    151,166,11,252,189,98,29,103,29,14,253,162,65,29,21,132,166,169,135,173,27,220,191,177,231,176,31,247,134,248,240,5,251,18,6,251,26,251,252,251,19,247,252,5,251,21,6,247,91,252,151,
+    125,102,5,81,118,202,29,252,131,21,251,180,247,20,247,180,7,247,138,248,79,5,251,31,6,251,35,251,158,126,115,135,127,130,121,25,131,157,132,155,128,159,251,36,247,158,24,251,35,6,14,
+    21,247,158,7,219,185,191,214,202,180,99,56,30,251,167,247,14,247,196,55,29,14,21,130,171,157,137,162,27,246,199,207,244,31,248,200,251,14,252,186,7,89,125,115,97,124,129,140,144,122,
+    30,14,21,136,29,21,84,109,161,184,179,168,164,215,146,31,242,147,5,113,7,63,91,94,64,30,14,21,146,159,145,161,142,153,141,124,146,117,145,120,223,251,128,24,251,90,6,14,153,248,130,
+    21,37,210,83,29,247,94,83,29,11,38,29,176,107,172,101,101,108,107,101,100,170,108,177,31,11,133,170,27,201,51,29,11,168,29,14,103,120,159,29,102,114,156,171,30,14,251,26,53,238,247,
+    48,247,48,225,238,247,26,247,26,225,40,251,48,11,85,118,114,98,98,26,88,177,97,200,11,248,28,179,29,252,28,11,198,29,78,236,234,200,200,236,30,11,21,213,6,166,247,73,5,38,6,11,247,
+    14,248,130,251,14,6,14,252,28,247,13,248,28,11,133,121,122,136,125,27,102,113,159,198,31,11,247,48,5,251,17,6,11,151,158,167,176,26,198,11,107,107,101,100,170,108,11,46,5,86,7,14,251,
+    101,251,37,251,48,251,114,11,21,251,46,247,3,33,247,45,11,199,7,188,154,171,11,251,13,253,124,7,11,21,45,202,78,247,6,229,210,177,206,174,30,73,181,210,100,228,27,247,22,227,206,245,
+    160,31,251,5,6,94,127,96,111,70,27,55,96,190,219,129,31,248,9,140,5,176,7,247,42,48,242,251,43,67,79,113,92,97,30,185,108,83,166,57,27,251,20,52,68,33,31,243,6,190,178,170,209,205,
+    178,108,76,30,115,7,251,41,135,5,251,1,137,66,88,42,26,248,208,247,159,21,215,183,91,73,31,251,143,6,207,151,181,185,216,27,252,84,251,153,21,186,168,157,205,141,30,247,5,143,5,111,
+    7,72,93,94,63,86,106,163,184,30,14,21,247,0,105,231,79,206,30,214,238,5,251,9,6,109,100,5,172,86,75,157,67,27,89,29,251,0,173,46,198,73,31,65,41,5,247,14,6,166,175,5,107,191,202,122,
+    209,27,201,29,31,252,211,22,247,48,225,238,247,26,182,177,129,120,171,30,251,184,252,22,5,112,181,125,193,203,26,248,76,198,3,243,25,97,102,149,156,108,30,247,182,248,23,5,165,97,153,
+    85,76,26,14,21,55,172,69,195,93,30,78,41,5,247,2,6,171,192,5,129,168,171,134,172,27,148,3,243,5,222,107,207,86,185,31,196,232,5,33,6,110,92,5,150,108,105,145,103,27,161,3,19,31,161,
+    3,255,123,153,153,137,136,151,30,251,44,251,136,5,120,164,128,173,178,26,247,176,22,49,81,78,55,127,128,140,141,129,30,247,40,247,134,5,156,114,149,107,102,26,14,178,248,163,21,251,
+    4,204,68,247,16,112,30,247,8,113,5,199,126,164,110,90,26,78,85,102,54,57,89,176,201,138,30,251,20,6,251,23,142,241,56,247,48,27,247,53,245,227,247,28,247,1,78,203,251,17,166,31,251,
+    7,164,5,78,153,111,168,191,26,200,190,177,218,211,184,102,76,142,30,247,20,6,247,24,135,45,221,251,40,27,251,46,33,50,251,20,31,11,93,0,73,240,61,14,21,247,11,6,207,247,104,164,220,
+    148,174,144,162,25,143,114,150,92,159,74,207,251,106,24,247,6,6,247,63,248,130,5,251,21,6,73,251,104,130,108,123,80,131,102,25,133,172,119,213,133,159,73,247,104,24,251,16,6,71,251,
+    104,123,90,130,108,130,91,25,130,185,129,182,128,178,74,23,0,241,39,19,6,14,21,58,29,102,109,108,103,102,169,109,176,31,247,70,22,58,29,11,248,37,249,3,103,29,11,21,42,217,73,247,15,
+    247,14,224,201,239,105,29,14,178,248,0,104,29,11,21,227,213,99,53,162,92,5,241,101,41,118,251,21,236,251,59,27,251,112,251,37,251,50,251,114,251,117,247,35,251,41,247,97,238,222,178,
+    195,179,31,147,55,5,247,0,248,47,251,232,251,5,247,113,136,6,251,9,62,69,251,19,251,27,45,228,247,55,247,50,222,244,247,37,30,11,21,251,121,247,36,251,39,247,104,247,103,247,18,247,
+    44,247,66,30,221,251,242,251,4,247,108,7,251,6,132,57,77,251,5,27,251,24,49,229,247,58,247,52,228,240,247,28,234,209,95,53,168,121,0,192,54,106,251,17,226,251,62,27,251,110,251,35,
+    121,0,242,255,161,31,11,215,97,177,56,158,30,50,160,5,97,149,117,157,167,26,176,167,161,187,186,167,112,97,140,30,247,8,6,235,138,64,203,251,3,27,251,6,57,81,42,60,182,97,228,119,31,
+    228,118,5,183,129,152,121,114,26,103,108,116,82,83,107,166,182,138,30,11,114,29,248,209,247,112,190,29,11,247,47,248,3,21,219,194,192,216,208,160,29,251,82,207,129,188,29,100,100,117,
+    113,99,105,116,160,177,31,66,6,59,198,95,210,30,11,247,101,22,110,29,11,172,251,88,21,128,159,161,133,171,27,201,189,171,201,194,98,162,100,127,128,137,136,129,31,166,191,5,170,7,102,
+    140,91,40,142,29,247,165,247,49,7,247,16,251,165,5,247,32,6,251,31,247,192,5,225,174,185,209,237,26,247,36,42,223,251,58,30,251,171,253,111,6,247,20,248,253,21,247,43,6,220,187,98,
+    66,65,91,96,58,31,251,43,6,11,21,51,208,76,234,235,206,203,233,227,76,203,52,112,117,134,128,121,30,160,218,5,247,61,214,251,125,6,83,251,125,216,128,5,165,156,162,151,173,27,188,171,
+    106,87,88,108,107,89,91,107,170,185,31,14,198,247,61,5,247,165,6,198,251,61,5,247,27,6,251,156,249,111,5,251,23,6,251,156,253,111,5,247,205,248,149,71,29,21,214,251,70,7,229,214,5,
+    194,185,168,187,197,26,230,81,195,45,46,80,77,40,136,30,221,6,194,166,170,185,184,163,112,89,101,121,110,99,106,30,251,53,251,26,5,76,7,14,158,248,126,21,59,197,95,209,212,195,185,
+    214,202,98,174,135,29,177,31,11,178,29,159,121,115,114,119,121,105,76,29,247,215,245,21,84,29,247,108,247,5,241,251,5,247,46,251,13,251,46,63,37,215,251,129,7,251,10,198,91,233,174,
+    61,29,30,11,247,14,249,161,21,175,170,169,176,175,108,170,103,103,109,108,103,102,168,103,2,13,20,0,240,107,14,248,245,247,31,21,247,4,50,248,116,251,53,7,251,223,252,116,5,251,4,248,
+    7,251,31,247,13,247,31,7,251,248,247,4,21,247,127,247,234,5,251,234,7,14,186,29,247,48,6,247,13,247,47,247,73,251,203,5,247,40,6,251,137,248,55,247,134,247,204,5,251,43,6,251,188,252,
+    20,5,11,247,77,22,247,158,7,219,185,191,214,202,180,99,56,30,251,167,247,14,247,196,55,29,11,249,175,124,29,11,85,118,113,98,98,145,29,165,161,170,188,157,31,140,190,5,246,26,11,247,
+    110,248,199,21,182,111,165,103,128,130,137,136,131,30,174,169,166,182,147,30,187,7,59,129,83,74,55,26,79,173,101,186,183,169,170,183,30,11,99,44,3,242,100,11,248,197,21,176,149,161,
+    163,30,175,174,59,29,105,198,73,27,75,102,84,53,148,31,11,249,171,131,29,11,21,213,194,194,211,211,83,195,66,67,83,84,66,65,193,86,213,31,205,4,104,116,164,177,175,163,163,173,174,
+    163,114,104,101,116,114,103,31,11,247,110,176,21,56,29,96,168,113,175,150,148,141,143,147,30,103,108,113,96,131,30,90,7,219,149,195,204,223,26,11,171,29,147,141,143,145,30,137,109,
+    117,126,95,143,8,99,7,214,98,8,95,163,29,162,114,171,125,8,3,10,145,0,33,76,101,145,0,2,21,0,34,176,173,166,0,3,21,0,182,247,77,22,247,162,7,213,184,193,216,201,32,1,242,24,7,247,20,
+    75,216,251,14,68,81,108,91,108,30,11,69,83,251,26,31,79,251,94,199,7,188,153,171,201,30,182,243,6,143,118,116,140,120,27,32,25,0,240,139,7,11,88,150,30,222,214,5,199,251,123,74,247,
+    30,7,56,64,5,92,182,7,187,160,115,105,106,118,118,106,105,116,159,11,247,10,252,6,7,248,0,248,135,5,247,6,252,148,251,10,247,245,7,251,253,252,130,5,251,11,7,14,21,75,192,98,220,221,
+    193,180,203,183,112,175,100,151,30,168,86,29,93,176,68,68,92,100,11,247,170,250,43,21,92,115,111,96,80,29,14,247,16,248,229,21,179,172,172,180,180,106,171,99,97,106,107,98,98,172,106,
+    181,31,78,252,229,21,11,5,55,6,84,251,125,21,177,168,167,178,177,166,111,101,99,113,113,100,99,111,165,179,30,14,247,243,249,83,64,0,247,5,95,80,29,11,152,105,5,145,155,152,142,159,
+    49,29,14,192,29,115,126,96,68,1,67,247,5,249,161,21,8,81,87,29,178,31,14,229,7,245,5,158,155,141,146,154,30,220,7,135,130,129,137,131,27,115,124,154,161,11,151,67,0,0,207,0,243,61,
+    17,6,49,252,19,247,5,115,5,177,165,190,167,195,27,227,190,81,54,50,11,247,148,22,247,48,6,251,109,247,139,247,109,247,139,5,251,48,6,251,108,251,139,5,11,249,87,21,91,114,112,96,95,
+    115,166,187,30,50,6,41,199,79,236,234,200,200,236,30,11,247,22,249,149,164,29,14,107,0,35,129,130,107,0,128,165,160,170,189,157,31,11,22,69,0,0,77,0,130,5,251,47,6,247,108,251,139,
+    77,0,242,26,247,88,249,45,21,251,20,251,184,5,212,6,247,19,247,184,5,205,251,147,73,7,11,249,163,60,29,235,6,49,85,29,48,251,48,5,11,188,153,174,29,156,1,242,61,11,247,123,22,79,29,
+    7,11,21,54,87,201,227,227,191,202,224,224,194,77,50,50,84,78,54,31,14,21,195,147,101,162,109,27,103,101,116,83,148,31,169,251,108,5,204,6,11,156,164,173,29,107,114,122,102,11,94,194,
+    59,115,121,133,130,126,31,156,199,5,247,38,204,251,89,6,92,11,39,1,240,32,102,87,29,177,31,11,22,81,101,99,84,83,101,179,197,197,177,179,195,194,177,99,81,30,11,21,187,112,169,99,102,
+    113,115,103,107,11,21,247,17,170,29,11,238,196,40,5,234,148,0,16,49,148,0,241,61,193,64,237,233,198,213,247,3,247,2,84,215,41,45,81,64,11,247,122,250,41,35,29,14,21,212,186,94,71,31,
+    251,140,6,213,151,183,178,211,27,11,157,110,168,126,30,100,126,114,103,96,26,218,247,52,21,11,6,230,247,48,5,43,6,82,40,82,238,5,43,6,11,21,187,113,169,98,102,0,246,21,162,114,171,
+    148,11,184,164,183,191,26,213,91,186,61,61,86,88,65,30,11,30,132,251,43,21,171,165,156,175,175,165,122,107,11,171,194,172,2,192,39,11,249,175,38,29,177,107,171,101,101,11,43,1,242,
+    75,48,247,48,5,11,199,29,100,151,30,11,103,96,26,219,247,52,21,164,159,157,174,173,11,235,241,43,44,29,44,37,234,11,199,249,186,21,247,160,224,251,160,6,14,21,252,1,222,248,77,251,
+    82,63,7,14,173,26,210,73,68,7,105,11,138,126,111,99,75,81,217,48,27,54,85,11,247,0,247,50,247,36,42,238,251,38,89,11,171,99,98,159,2,240,45,180,31,11,247,101,249,111,21,251,20,253,
+    111,247,20,11,6,247,157,248,249,5,247,10,7,14,5,158,149,162,151,164,27,176,164,113,11,6,251,50,247,3,51,247,35,247,40,11,21,40,6,252,109,253,90,5,238,6,11,30,181,96,3,131,117,140,119,
+    27,11,114,171,148,222,3,243,30,11,163,113,104,102,116,114,11,116,164,176,175,163,164,11,247,40,21,36,6,53,251,40,5,11,199,22,249,90,249,90,253,90,6,11,21,214,6,165,247,72,5,38,6,11,
+    106,2,224,42,199,11,98,221,221,192,180,203,183,113,175,11,114,90,4,240,30,142,147,30,104,11,247,102,247,38,247,48,247,114,11,109,128,91,27,66,6,14,1,0,34,0,0,171,0,1,135,0,0,172,2,
+    1,136,1,0,175,0,1,138,0,0,176,100,34,240,255,54,1,139,0,0,35,1,1,140,1,0,177,0,1,142,1,0,37,0,0,154,0,1,144,1,0,38,0,0,178,0,1,146,1,0,179,1,1,148,0,0,181,0,1,149,1,0,39,1,1,151,3,
+    0,41,0,1,155,0,0,42,0,0,182,2,1,156,0,0,185,0,1,157,2,0,43,0,1,160,0,0,44,0,1,161,0,0,45,0,1,162,3,0,140,0,0,46,1,1,166,3,0,186,0,0,48,0,0,187,3,1,170,1,0,141,0,1,172,0,0,191,0,0,142,
+    0,0,49,0,0,157,0,0,50,1,1,173,2,0,52,0,1,176,0,0,192,0,1,177,2,0,53,0,1,180,3,0,54,0,0,193,3,1,184,4,0,55,1,1,189,3,0,57,1,0,197,0,1,193,0,0,198,0,1,194,0,0,59,0,1,195,0,0,199,0,1,
+    196,1,0,66,0,0,200,0,1,198,0,0,201,2,1,199,1,0,204,0,1,201,0,0,205,0,0,144,0,1,202,0,0,67,1,1,203,1,0,206,0,1,205,1,0,69,0,0,167,0,1,207,1,0,70,0,0,207,0,1,209,1,0,208,1,1,211,0,0,
+    210,0,1,212,1,0,71,1,1,214,3,0,73,0,1,218,0,0,74,0,0,211,2,1,219,0,0,214,0,1,220,2,0,75,0,1,223,0,0,76,0,1,224,0,0,77,0,1,225,3,0,146,0,0,78,1,1,229,3,0,215,0,151,30,160,216,3,1,233,
+    1,0,147,0,1,235,37,34,241,41,0,148,0,0,81,0,0,162,0,0,82,1,1,236,2,0,84,0,1,239,0,0,221,0,1,240,2,0,149,0,0,85,0,1,243,3,0,86,0,0,222,3,1,247,4,0,87,1,1,252,3,0,89,1,0,226,13,36,240,
+    40,227,0,2,1,0,0,91,0,2,2,0,0,228,0,2,3,8,0,109,1,2,12,4,0,17,9,2,17,40,0,150,0,0,164,0,0,169,0,2,58,5,0,99,0,0,155,0,0,158,0,0,163,0,1,64,34,42,240,6,2,64,0,0,61,0,0,114,0,0,116,0,
+    0,27,0,0,13,0,0,121,0,85,0,112,96,0,0,4,0,0,15,194,35,33,0,123,112,36,240,47,104,0,0,28,0,0,16,0,0,64,0,0,92,0,0,94,0,0,60,0,0,62,0,0,9,1,0,137,0,0,111,0,0,14,0,0,106,0,0,120,0,0,107,
+    1,0,118,0,0,105,0,0,119,0,0,65,0,0,8,0,0,117,0,150,42,240,5,97,0,0,103,0,0,5,0,2,65,0,0,101,0,0,98,0,0,100,0,218,42,209,166,0,0,168,0,0,159,0,0,30,0,2,66,220,42,240,7,29,0,2,67,1,0,
+    156,0,2,69,0,0,95,0,0,151,0,2,70,8,0,6,199,42,240,85,2,79,18,0,33,0,0,7,0,0,115,0,0,102,0,0,170,0,0,165,0,2,98,0,0,153,0,0,161,0,0,93,0,0,160,0,0,112,1,2,99,1,0,63,0,2,101,16,0,125,
+    0,0,129,0,0,136,0,0,133,0,0,126,0,0,131,0,0,130,0,0,124,0,0,134,0,0,128,0,0,135,0,0,132,0,0,127,0,2,118,7,0,145,0,2,126,26,1,0,1,248,55,19,145,29,0,35,0,46,0,78,0,88,193,38,241,8,124,
+    0,153,0,166,0,234,0,244,1,24,1,71,1,144,1,151,1,162,1,176,2,24,97,31,144,86,2,89,2,149,2,152,2,178,85,37,241,13,2,234,2,247,3,4,3,17,3,40,3,51,3,79,3,105,3,110,3,134,3,155,3,164,3,
+    179,3,196,31,31,241,255,255,255,222,253,4,9,4,20,4,32,4,45,4,58,4,71,4,83,4,89,4,109,4,113,4,122,4,126,4,146,4,155,4,164,4,190,4,230,5,32,5,40,5,52,5,65,5,78,5,139,5,150,5,158,5,168,
+    5,178,5,192,5,202,5,214,5,226,5,234,5,248,6,6,6,80,6,128,6,178,6,232,6,236,6,251,7,19,7,28,7,32,7,41,7,53,7,144,7,152,7,161,7,165,7,202,7,221,8,1,8,10,8,16,8,25,8,34,8,45,8,56,8,67,
+    8,78,8,135,8,157,8,179,8,220,9,43,9,53,9,63,9,75,9,87,9,150,9,157,9,166,9,174,9,187,9,195,9,201,9,212,9,225,9,236,9,241,9,247,10,2,10,20,10,36,10,47,10,57,10,74,10,132,10,144,10,247,
+    11,1,11,8,11,20,11,65,11,71,11,82,11,94,11,135,11,147,11,160,11,171,12,15,12,38,12,59,12,104,12,114,12,123,12,136,12,149,12,159,12,167,12,177,12,195,13,10,13,28,13,34,13,45,13,55,13,
+    101,13,130,13,141,13,162,13,166,13,180,13,190,13,201,13,212,13,233,13,243,13,251,14,18,14,37,14,47,14,51,14,60,14,65,14,82,14,93,14,101,14,125,14,160,14,233,14,237,14,248,15,6,15,36,
+    15,75,15,85,15,91,15,100,15,115,15,128,15,137,15,148,15,161,15,167,15,178,15,190,16,24,16,71,16,136,16,199,16,204,16,217,16,233,16,254,17,3,17,15,17,31,17,138,17,156,17,166,17,243,
+    17,248,18,13,18,32,18,59,18,67,18,74,18,87,18,99,18,149,18,161,18,172,18,185,18,226,18,239,18,251,19,34,19,120,19,130,19,141,19,155,19,167,19,215,19,221,19,230,19,240,19,253,20,8,20,
+    37,20,49,20,63,20,77,20,84,20,90,20,95,20,105,20,149,20,169,20,193,20,255,21,25,21,51,21,77,21,107,21,165,21,226,22,12,22,79,22,98,22,161,22,218,22,221,23,8,23,22,23,35,23,115,23,129,
+    23,194,23,220,24,27,24,84,24,87,24,130,24,144,24,157,24,237,24,251,25,2,25,10,25,17,25,25,25,62,25,68,25,127,25,149,25,155,25,214,25,247,25,255,26,34,26,56,26,84,26,121,26,156,26,181,
+    26,213,27,15,27,49,27,54,27,103,27,108,27,133,27,138,27,173,27,178,27,230,28,33,28,40,28,48,28,56,28,64,28,102,28,109,28,168,28,190,28,197,29,1,29,10,29,46,29,71,29,96,29,128,29,154,
+    29,199,29,246,30,91,31,124,31,143,31,168,31,193,31,208,31,247,32,10,32,62,32,114,32,206,32,215,33,39,33,119,33,130,33,135,33,181,33,200,33,211,34,24,34,93,34,113,34,133,34,180,34,226,
+    34,240,34,254,35,12,35,41,35,49,35,54,35,59,35,88,35,129,35,151,35,156,35,161,35,166,35,169,35,242,36,87,36,219,37,75,37,146,37,246,38,46,38,71,38,82,38,126,38,177,38,190,38,244,39,
+    16,39,48,39,81,39,124,39,160,39,209,39,244,40,5,40,125,40,228,41,14,41,62,41,80,41,120,41,152,41,203,42,23,42,30,42,70,42,104,42,134,42,169,42,199,42,233,43,9,43,42,43,74,43,133,43,
+    192,43,197,43,237,44,25,44,30,44,46,44,59,44,88,44,185,44,208,45,118,45,242,46,26,46,150,47,23,47,76,47,117,47,171,47,215,47,227,47,249,48,16,48,51,48,137,48,209,48,239,49,9,49,125,
+    49,129,49,133,49,137,49,141,49,145,49,149,49,153,49,157,49,161,49,165,49,169,49,211,49,251,49,255,50,16,50,20,50,24,50,28,50,32,50,36,50,40,50,44,50,48,50,52,50,56,50,81,50,85,50,89,
+    50,109,50,128,50,210,50,243,51,8,51,18,51,38,51,83,51,87,51,92,51,103,51,113,51,123,51,167,51,189,51,207,52,3,52,43,52,146,52,194,52,203,52,215,53,5,53,14,53,56,53,80,53,140,53,149,
+    53,164,53,175,53,194,53,207,53,221,53,240,54,2,54,18,251,28,189,251,121,21,248,36,250,220,252,36,254,220,6,189,189,21,250,120,247,192,254,120,251,192,7,14,184,247,36,22,112,29,184,
+    248,121,34,10,251,135,253,163,36,10,184,248,46,250,57,21,92,115,111,95,95,115,166,187,30,50,6,42,200,78,235,234,200,200,236,30,251,246,254,57,36,10,184,247,176,49,10,94,42,0,242,6,
+    247,145,249,175,48,10,251,179,253,175,36,10,184,248,22,249,163,33,29,251,43,26,0,255,3,100,54,29,75,254,30,36,10,184,247,36,22,152,10,199,6,112,10,150,13,0,176,184,247,234,249,151,
+    105,10,251,90,253,217,65,0,224,122,250,214,39,10,230,6,251,137,254,66,21,152,10,201,13,164,142,249,72,5,170,162,158,176,181,26,82,12,240,67,96,157,103,169,117,30,251,142,253,73,5,247,
+    222,249,113,21,104,161,10,173,174,160,10,103,31,122,251,112,71,29,184,247,135,126,29,112,253,171,36,10,247,196,145,22,247,36,6,209,247,74,5,247,102,251,74,248,89,48,29,252,219,6,100,
+    252,77,21,247,17,247,215,5,183,251,215,6,14,247,196,249,89,250,55,115,0,95,252,242,253,163,21,47,0,13,241,88,154,220,22,247,188,6,247,43,226,212,247,17,224,100,197,62,164,31,208,168,
+    175,197,220,26,247,14,51,214,251,36,30,251,183,6,247,172,251,5,21,211,179,105,76,74,100,102,69,31,251,47,247,91,6,247,55,251,199,21,210,180,104,77,73,99,104,67,31,251,55,247,90,6,14,
+    247,15,248,26,127,42,29,247,15,248,174,34,10,89,253,175,42,29,247,15,247,224,249,163,41,10,247,40,254,75,14,0,255,6,209,251,88,21,128,160,161,74,29,156,173,247,56,146,247,18,239,166,
+    247,41,25,243,21,29,244,8,109,247,16,251,36,247,86,124,31,115,89,166,10,153,142,158,27,166,155,127,117,116,120,114,21,178,14,247,15,247,230,249,163,50,29,247,40,132,0,240,46,248,30,
+    133,10,135,253,187,42,29,243,247,236,22,247,104,247,38,247,41,247,107,247,110,251,41,247,41,251,108,31,251,148,253,111,6,247,136,248,249,21,62,10,248,131,6,14,243,86,10,243,247,151,
+    249,163,21,247,16,6,230,247,47,179,10,191,41,82,237,5,43,6,247,68,254,62,21,63,0,17,78,96,248,171,22,25,22,193,252,90,54,10,96,248,86,250,55,21,251,6,63,24,240,6,230,6,247,75,253,163,
+    38,10,96,248,10,250,57,21,92,115,154,10,78,236,233,81,12,240,1,212,254,57,38,10,96,247,135,249,163,164,29,248,18,254,63,13,0,16,141,209,0,33,248,18,48,0,160,247,109,249,175,101,10,
+    247,32,253,175,26,0,114,197,249,175,161,29,247,122,13,0,242,2,242,249,163,21,65,247,41,5,251,6,6,237,251,41,5,247,167,49,0,112,64,54,29,247,255,254,30,108,0,79,96,22,112,10,157,0,3,
+    240,3,70,248,117,247,191,21,247,7,251,164,247,91,247,216,247,10,252,88,242,10,208,247,191,7,14,247,38,100,29,14,247,38,248,108,168,0,49,114,154,10,249,12,240,12,235,30,251,51,251,202,
+    63,29,247,38,247,238,249,164,21,196,237,196,41,5,235,52,10,247,42,251,53,21,0,208,100,29,188,253,116,107,10,247,38,248,39,175,29,146,13,240,22,137,251,64,63,29,245,155,10,249,111,251,
+    20,251,194,251,216,247,194,44,10,7,14,245,155,10,248,170,218,247,1,60,227,251,20,51,251,216,6,0,242,13,61,251,1,217,252,170,7,247,20,248,65,21,244,247,216,34,7,14,251,238,186,29,6,
+    14,251,238,247,180,215,2,209,157,87,42,10,251,238,227,249,163,136,10,247,109,12,0,16,195,177,3,32,114,75,23,0,114,247,36,249,175,73,29,204,12,0,16,81,188,3,33,247,3,36,0,145,150,249,
+    200,43,29,247,90,251,67,38,0,128,25,22,111,10,249,111,44,10,88,0,240,8,185,249,171,132,29,247,127,79,42,10,55,159,247,98,109,10,55,247,246,249,164,21,197,210,0,240,14,234,52,10,251,
+    131,252,214,109,10,177,119,29,14,177,119,29,247,98,252,96,108,10,41,51,10,14,41,247,181,248,12,240,6,157,101,21,44,10,248,70,247,10,251,198,6,14,41,51,10,189,248,68,81,29,9,0,242,27,
+    247,50,251,123,130,29,41,51,10,247,40,247,68,21,177,170,171,176,176,108,171,101,101,107,108,101,102,172,107,176,31,14,41,155,247,140,21,204,170,5,251,171,62,0,240,47,247,114,7,247,
+    36,208,5,238,7,251,36,70,5,247,184,251,20,251,245,7,74,108,5,14,247,140,247,97,22,247,154,7,230,138,208,132,183,30,247,77,252,102,5,247,10,6,247,78,248,103,5,132,87,139,96,251,39,26,
+    251,117,247,16,155,24,241,32,7,251,128,252,218,251,128,248,218,5,251,16,253,111,6,14,247,14,247,99,22,47,29,14,247,14,248,162,34,10,251,113,253,163,59,10,247,14,247,212,249,163,41,
+    10,116,254,63,13,0,0,33,0,209,248,3,251,5,46,29,247,14,248,146,251,135,21,171,23,117,249,181,251,18,252,154,7,233,24,240,17,247,18,248,154,6,247,241,252,161,5,90,7,89,118,115,96,124,
+    120,142,144,122,30,118,251,0,5,129,171,167,136,169,27,107,0,241,19,176,126,29,134,253,171,59,10,247,42,249,128,248,2,41,29,247,42,248,173,34,10,247,201,46,10,247,42,247,228,154,29,
+    248,144,10,0,145,196,249,175,57,10,247,158,252,65,34,0,80,73,146,10,248,37,24,0,128,248,99,250,55,128,10,247,126,12,0,128,247,151,54,29,248,125,252,176,34,0,0,76,0,16,94,76,0,144,165,
+    250,45,35,29,247,209,252,43,14,0,241,118,247,187,249,171,110,10,248,161,252,61,41,29,248,132,178,248,2,21,251,111,247,31,251,51,247,104,240,229,181,196,179,30,52,248,90,48,29,252,90,
+    62,7,196,88,52,172,51,27,251,106,251,34,251,51,251,111,31,247,26,140,21,247,50,235,235,247,19,247,20,234,43,251,50,251,51,44,42,251,19,251,20,43,237,247,50,30,14,142,248,6,247,144,
+    21,247,38,235,238,247,33,247,35,44,235,251,39,31,251,181,253,111,247,20,247,144,6,247,28,248,1,21,224,187,95,59,59,92,92,51,31,251,26,247,143,6,48,0,18,30,48,0,50,23,247,25,48,0,224,
+    53,247,26,44,10,247,20,247,30,6,247,28,247,237,50,0,65,68,69,92,93,50,0,240,51,123,6,14,247,42,249,35,84,21,221,212,61,226,5,196,205,171,229,244,26,94,10,208,201,156,169,191,30,177,
+    247,223,21,75,124,84,112,97,30,42,247,1,58,66,236,251,1,5,125,110,107,132,103,27,77,29,31,14,173,108,29,14,173,248,92,250,56,211,5,244,2,251,42,253,164,89,10,173,247,142,249,164,75,
+    10,247,47,5,44,82,15,240,15,188,254,63,89,10,173,108,29,247,96,252,135,46,29,95,96,29,14,95,248,73,34,10,251,192,79,10,95,247,123,244,1,128,37,252,48,97,29,95,247,112,132,5,32,159,
+    162,132,5,147,5,247,41,146,236,225,247,22,26,17,23,31,30,17,23,18,3,107,23,240,77,31,124,10,142,251,14,228,58,247,30,129,116,90,24,146,29,14,95,247,128,49,10,37,79,10,95,96,29,247,
+    208,253,20,129,29,93,137,10,14,93,247,15,247,216,21,247,0,251,216,247,20,247,216,247,0,243,251,0,247,77,247,106,247,10,252,192,251,10,247,106,251,77,251,0,6,14,93,247,124,249,163,149,
+    10,82,238,5,43,6,251,17,251,218,142,56,0,16,115,168,0,0,44,6,102,162,185,5,178,248,249,52,0,240,25,252,249,176,6,110,78,123,10,14,93,137,10,247,233,253,224,107,10,234,215,247,159,37,
+    29,234,248,145,34,10,251,227,47,10,234,247,200,49,10,251,29,9,0,112,169,121,29,252,15,252,164,29,0,16,46,12,4,208,251,135,47,10,234,248,71,250,55,61,10,252,47,33,0,144,124,54,29,251,
+    48,253,19,37,29,68,0,255,16,21,251,63,247,2,33,247,67,137,30,102,116,121,105,105,145,29,164,160,170,186,157,31,247,16,170,213,237,247,31,26,218,29,3,114,234,248,2,249,151,21,212,31,
+    20,242,2,67,117,10,251,182,252,206,37,29,234,247,159,249,171,85,10,97,72,20,240,111,53,10,251,11,252,160,37,29,203,247,178,22,247,24,6,247,164,249,111,5,251,25,6,251,50,252,57,125,
+    102,124,94,121,75,25,123,198,125,182,123,183,251,52,248,57,24,251,28,6,14,248,35,247,125,22,247,18,6,247,51,248,168,247,48,252,168,5,247,16,6,247,114,249,111,5,251,22,6,251,10,252,
+    23,128,102,129,100,125,71,25,127,201,128,181,127,180,251,5,248,22,24,251,33,6,251,7,252,22,126,97,128,101,127,74,25,128,203,128,180,128,179,251,8,248,22,24,251,25,79,0,241,1,249,41,
+    34,10,251,222,55,10,248,35,248,96,49,10,251,24,10,0,128,65,121,29,252,10,253,175,84,22,0,17,198,31,1,240,73,130,55,10,184,247,157,248,1,21,251,140,252,1,5,247,42,6,247,70,247,159,168,
+    86,165,95,171,90,25,221,251,13,5,247,43,6,251,132,248,2,247,131,248,1,5,251,41,6,251,62,251,160,112,189,114,181,109,184,25,50,247,23,5,251,44,6,14,144,247,149,247,180,81,10,144,248,
+    102,34,10,251,3,66,29,144,247,157,154,29,227,8,0,16,125,251,3,240,19,251,46,252,143,81,10,144,248,2,146,10,120,66,29,91,248,193,22,136,29,91,248,65,34,10,247,118,253,163,69,29,91,247,
+    115,171,2,64,248,60,254,63,13,0,240,19,177,133,10,247,164,253,175,69,29,247,32,102,29,14,51,247,102,126,33,10,51,248,61,32,10,251,9,252,202,33,10,51,247,242,29,20,144,114,111,96,80,
+    29,251,120,253,96,18,0,80,116,248,189,119,10,170,18,18,220,34,0,112,84,99,10,251,53,252,214,27,0,66,217,65,10,114,21,0,208,40,248,226,21,247,159,225,251,159,6,201,253,69,27,0,240,51,
+    102,126,68,10,170,6,111,10,247,192,6,247,29,57,211,251,25,251,26,51,69,32,30,243,6,191,179,169,211,201,179,112,72,30,128,7,251,40,128,5,251,9,130,73,82,48,26,46,203,78,244,30,179,231,
+    70,29,51,247,173,248,177,127,29,68,253,0,153,0,243,18,49,249,226,21,34,6,69,251,24,5,223,6,251,4,253,107,68,10,246,247,192,6,235,98,204,69,168,30,156,161,149,166,170,240,9,239,83,67,
+    109,148,113,154,118,30,64,112,94,82,62,26,101,0,10,240,1,207,248,158,21,104,194,29,173,174,193,29,103,31,111,252,66,115,0,240,113,75,125,29,238,252,210,33,10,247,145,180,247,34,93,
+    29,247,145,248,213,32,10,252,74,252,47,93,29,122,247,68,22,147,216,5,82,168,202,106,213,27,247,34,232,244,247,44,247,48,53,247,2,251,33,64,73,106,84,107,31,247,214,251,14,253,124,7,
+    247,15,247,141,134,10,53,173,247,140,43,10,53,248,58,32,10,251,182,251,197,43,10,53,247,108,248,189,41,10,47,252,97,43,10,53,173,247,140,21,251,38,224,39,247,24,125,30,116,90,123,10,
+    83,7,128,160,161,133,170,27,201,51,190,9,242,3,10,147,226,215,153,247,1,25,96,10,53,247,113,248,189,40,10,47,65,0,245,107,170,248,201,73,29,251,136,251,209,43,10,122,63,10,249,124,
+    251,13,251,205,95,10,99,173,247,136,21,251,42,243,32,247,51,247,41,247,8,239,247,79,247,21,96,247,13,53,247,7,30,196,162,111,207,62,107,124,155,125,154,124,154,25,251,32,6,169,110,
+    165,110,163,109,38,98,24,166,71,247,14,188,178,87,166,91,161,89,25,170,103,94,153,87,27,251,27,251,7,39,251,39,31,247,14,134,21,218,191,203,229,228,189,76,59,59,88,77,50,50,87,202,
+    218,30,14,111,0,255,24,130,10,247,231,248,213,197,29,251,204,253,25,157,29,122,63,10,248,213,203,213,75,232,251,13,46,251,49,65,247,49,251,38,95,10,60,247,176,126,15,34,22,240,7,60,
+    248,62,32,10,95,252,202,32,29,60,141,29,251,47,253,96,32,29,60,247,112,41,1,64,247,46,253,102,13,0,16,117,1,1,33,247,46,35,0,209,247,85,99,10,51,252,214,32,29,60,127,10,141,8,0,82,
+    247,218,65,10,187,28,0,21,41,120,2,200,247,27,253,69,32,29,60,248,6,251,79,21,54,22,223,164,158,169,185,157,31,222,161,195,197,155,221,8,169,34,2,240,37,42,237,34,247,34,134,30,103,
+    117,122,105,105,153,10,50,248,232,75,29,251,189,66,10,247,10,241,251,10,91,29,201,159,10,32,68,165,10,117,174,247,150,40,29,117,247,246,149,29,252,43,252,85,11,0,96,120,132,10,41,251,
+    191,10,0,240,27,236,249,7,21,171,117,163,107,130,131,137,136,132,30,141,168,163,153,182,135,8,179,7,64,148,94,88,69,26,91,165,109,179,177,164,163,175,30,251,201,252,5,46,0,144,177,
+    248,205,21,177,171,170,177,177,92,23,240,10,107,107,100,101,170,108,178,31,251,142,251,203,40,29,92,133,29,247,206,251,15,253,124,7,14,11,0,241,10,39,247,48,213,251,48,232,251,15,46,
+    76,65,202,252,213,7,14,139,29,82,29,247,160,249,81,185,6,176,0,252,189,36,29,207,248,189,50,29,230,10,0,241,3,175,248,201,101,10,251,43,252,201,36,29,247,16,248,201,161,29,78,11,0,
+    52,61,248,189,127,35,0,194,10,16,123,43,0,240,8,130,248,226,43,29,211,253,56,36,29,139,29,186,6,122,29,6,14,165,248,197,140,10,1,25,193,106,198,72,27,76,101,53,10,247,1,252,197,73,
+    0,240,0,229,21,179,173,172,180,180,105,185,29,251,71,253,205,68,113,0,240,1,40,10,111,253,165,68,29,41,100,10,14,41,100,10,247,164,238,8,240,5,252,21,53,29,14,252,21,247,161,250,52,
+    35,29,154,253,160,21,249,124,92,17,0,115,53,29,247,63,248,200,197,11,0,240,3,16,102,10,251,145,53,29,247,145,247,185,38,29,177,106,172,102,99,0,1,64,171,107,179,31,60,0,240,19,78,22,
+    248,7,7,194,165,5,226,7,84,113,5,247,178,251,13,251,236,7,85,113,5,52,7,193,165,5,251,205,7,14,247,141,148,25,241,88,172,7,219,186,177,197,197,176,102,70,30,251,184,247,14,247,172,
+    7,220,184,177,198,197,177,102,68,30,251,183,247,13,247,215,7,247,6,73,211,251,12,64,81,102,82,114,30,196,113,87,176,64,27,68,89,107,98,114,31,129,197,5,251,4,252,130,6,14,92,120,29,
+    14,92,248,83,32,10,251,56,252,189,67,29,92,247,133,248,189,145,10,44,6,173,253,89,67,29,92,120,29,247,190,251,5,182,23,240,113,101,114,115,103,107,161,192,29,116,70,10,214,130,185,
+    190,209,26,14,92,247,77,22,151,10,251,223,7,89,124,115,98,123,130,140,144,122,30,119,251,0,5,130,170,157,137,163,27,245,200,207,244,31,248,10,55,29,14,92,247,97,125,29,191,252,197,
+    67,29,99,173,247,140,45,10,99,248,78,32,10,251,202,45,29,99,247,133,248,189,119,10,48,251,48,5,251,3,45,29,99,247,101,248,201,57,10,251,245,251,209,45,10,99,247,234,65,10,251,110,45,
+    29,99,248,4,249,81,128,10,252,21,48,0,16,56,173,1,80,251,22,252,64,45,246,3,51,140,95,29,76,0,248,20,251,197,95,29,99,247,92,248,197,110,10,45,251,205,45,10,247,224,173,247,140,90,
+    29,225,209,172,196,184,30,82,184,207,105,222,27,160,37,245,6,126,94,113,73,27,57,52,29,251,39,57,72,105,83,95,30,195,94,68,172,54,35,32,176,249,38,247,53,168,29,252,172,251,53,21,43,
+    32,10,204,35,240,22,122,202,251,121,21,247,14,247,187,6,89,170,203,110,213,27,247,39,223,247,4,247,46,247,47,47,240,251,31,64,74,106,82,109,31,131,214,224,37,241,3,247,15,251,139,134,
+    10,122,248,221,247,143,21,247,46,51,244,251,31,37,5,16,30,37,5,32,254,97,66,0,22,7,66,0,248,58,3,247,45,31,251,15,137,21,51,88,75,53,55,84,202,228,228,194,201,223,225,190,76,51,30,
+    14,122,173,247,145,21,251,46,223,251,4,247,39,212,204,168,189,170,30,251,187,247,13,249,103,251,4,7,131,64,5,196,109,74,172,64,27,251,31,47,38,251,47,31,247,14,133,21,190,25,240,21,
+    167,10,30,14,251,135,106,10,14,251,135,247,245,249,83,35,29,247,10,80,113,10,251,135,247,39,248,191,145,10,43,6,247,209,251,107,16,0,148,106,10,251,77,252,132,21,187,113,228,1,241,
+    46,143,29,251,65,83,10,14,251,65,248,16,249,90,35,29,251,149,82,10,251,65,247,66,248,198,21,247,16,170,29,81,252,204,101,29,251,65,164,247,42,21,50,204,77,244,128,30,116,90,146,29,
+    83,7,128,159,162,133,170,27,201,190,221,30,255,2,99,127,129,137,136,129,31,156,173,5,247,3,145,214,200,233,26,116,31,10,47,144,10,109,31,8,192,14,251,65,247,71,248,198,176,29,251,16,
+    6,184,26,16,81,141,0,16,83,11,14,240,89,155,108,10,98,247,77,22,248,163,7,210,185,185,205,201,176,102,82,79,101,103,77,30,93,40,185,6,237,191,95,61,66,92,90,53,31,62,35,6,135,158,172,
+    136,166,27,247,49,236,232,247,27,227,94,204,53,174,31,189,164,169,192,201,26,247,8,54,211,251,29,251,33,47,52,251,34,30,252,151,7,14,251,188,156,29,14,251,188,247,123,22,247,101,210,
+    233,68,228,179,29,50,68,45,210,251,101,26,0,240,5,247,159,248,187,81,29,103,253,112,21,248,28,235,241,43,147,10,251,188,242,67,10,1,210,31,240,0,200,51,29,163,185,5,170,79,29,178,6,
+    109,78,142,29,72,0,226,247,21,102,10,86,248,34,248,130,37,10,86,248,67,165,4,209,203,80,37,10,86,247,123,248,189,136,10,247,155,12,0,241,42,91,248,201,48,10,160,68,21,251,151,7,45,
+    102,94,62,71,102,177,233,30,247,158,251,14,251,201,7,251,13,206,62,247,6,205,203,171,186,169,30,148,73,5,247,5,248,130,6,14,86,247,224,248,189,33,29,247,49,62,0,97,249,249,81,61,10,
+    128,11,0,16,46,24,3,64,247,136,251,74,111,0,127,81,22,122,29,251,151,6,82,0,12,192,14,86,247,180,248,177,105,10,247,2,251,5,152,0,240,4,81,248,197,132,29,247,173,72,37,10,39,247,95,
+    22,247,12,6,247,98,33,34,255,16,18,6,49,251,119,118,85,121,87,132,108,25,133,166,122,190,118,198,53,247,119,24,251,22,6,14,247,53,247,64,22,96,34,62,224,247,53,248,179,32,10,251,165,
+    62,29,247,53,247,234,251,6,17,64,11,0,240,0,203,248,201,124,29,251,209,252,201,98,29,247,53,248,80,7,1,241,0,251,73,62,29,251,15,247,41,22,243,247,55,244,251,55,54,33,240,35,55,247,
+    136,247,60,247,142,5,251,29,6,34,251,60,251,1,247,60,5,251,34,6,247,62,251,144,251,62,251,134,5,14,32,159,251,121,65,29,32,248,49,32,10,251,187,64,29,32,247,104,99,0,16,42,10,0,16,
+    73,141,1,145,251,231,253,174,65,29,32,247,206,97,0,241,33,95,64,29,251,55,248,72,22,241,251,142,7,247,142,247,183,5,240,252,35,37,247,138,7,251,138,251,184,5,39,7,14,251,55,248,16,
+    32,10,247,46,252,189,60,10,251,55,247,66,183,7,49,244,253,89,14,0,16,128,173,8,242,12,247,92,252,201,60,10,123,248,82,248,130,35,10,56,188,247,201,39,29,251,173,116,29,14,165,72,29,
+    84,7,241,40,10,247,172,72,29,247,94,252,28,247,14,248,130,251,216,91,29,194,191,29,39,134,29,249,87,243,21,180,171,171,180,180,107,171,98,98,108,107,98,98,170,107,180,31,14,247,169,
+    72,29,247,90,252,28,247,13,252,8,161,142,251,90,91,10,148,66,10,247,100,63,0,0,153,2,241,16,44,29,251,100,199,7,155,29,7,14,247,87,247,213,251,121,21,132,166,170,135,172,27,225,189,
+    183,225,174,31,247,133,146,39,144,156,10,251,124,199,6,188,153,171,207,7,2,183,31,242,6,68,67,10,247,34,7,247,52,252,49,125,102,5,81,117,202,29,96,248,44,22,146,0,64,199,6,155,29,31,
+    0,208,94,7,200,247,95,138,10,14,93,66,10,247,89,112,0,240,37,249,124,251,14,251,142,251,89,199,7,188,151,174,29,71,165,10,116,248,125,248,231,138,10,251,150,252,231,21,248,28,247,87,
+    252,28,247,15,248,130,251,210,147,10,174,247,123,22,248,29,247,102,252,9,16,224,29,234,240,44,44,29,251,102,44,29,44,38,234,252,170,0,48,105,247,122,31,0,97,27,7,247,53,252,50,129,
+    0,241,0,109,128,92,27,66,37,6,132,166,169,135,172,27,226,188,189,0,16,134,189,0,113,19,156,10,251,118,71,10,58,0,255,255,255,47,6,14,160,247,185,22,231,7,69,165,95,205,216,26,227,205,
+    196,223,223,205,82,51,68,100,72,64,108,30,47,247,121,231,50,7,188,185,170,202,212,26,247,18,40,247,1,251,48,251,46,36,33,251,22,66,169,77,187,93,30,51,47,6,14,146,245,22,247,14,248,
+    30,247,55,251,156,6,46,178,99,226,165,174,141,145,172,30,239,7,91,140,5,107,121,152,173,31,247,133,237,239,252,232,39,230,7,14,208,182,248,0,21,251,118,247,7,251,43,247,86,247,86,247,
+    8,247,43,247,118,247,119,251,15,247,46,251,79,251,79,251,14,251,46,251,119,30,247,18,22,247,65,207,234,247,7,247,8,207,44,251,65,251,61,71,44,251,8,251,7,71,234,247,61,30,14,251,130,
+    247,86,248,252,21,252,252,247,15,249,111,251,175,251,7,7,14,92,248,189,140,21,247,11,251,196,7,247,24,247,5,5,247,3,234,195,216,241,26,247,40,42,228,251,48,251,47,37,35,251,52,138,
+    30,247,19,6,233,140,189,195,219,27,216,184,92,56,69,106,91,40,55,31,251,131,251,94,5,43,7,14,72,247,151,247,254,21,241,187,85,65,58,86,87,59,61,87,187,223,31,251,18,189,29,247,9,234,
+    247,42,247,21,52,221,251,4,161,30,247,70,247,56,5,241,252,100,251,5,247,196,7,251,80,251,65,5,56,7,14,149,118,29,103,247,187,127,21,247,55,247,3,184,29,95,126,116,104,31,178,247,44,
+    5,247,181,147,29,84,83,53,58,90,188,222,31,251,19,6,251,40,240,41,247,45,30,14,123,247,39,88,10,79,77,56,53,80,201,228,30,14,41,146,164,10,251,162,252,249,5,247,25,187,29,144,181,247,
+    99,21,251,25,247,1,53,247,61,247,62,247,1,226,247,24,227,89,210,62,131,10,174,84,203,110,30,63,110,90,69,52,26,247,34,247,222,21,199,192,177,222,221,191,101,78,78,87,101,57,56,86,178,
+    200,30,122,251,213,21,210,198,183,233,233,198,95,68,68,80,95,46,44,80,183,210,30,14,123,248,109,87,10,198,201,223,225,198,77,50,30,14,163,176,248,0,21,251,123,245,251,38,247,79,247,
+    79,245,247,38,247,123,247,119,251,2,247,45,251,75,251,75,251,2,251,45,251,119,30,247,18,22,247,62,192,237,247,6,247,6,192,41,251,62,251,59,86,42,251,6,251,6,86,236,247,59,30,14,163,
+    247,172,247,5,21,251,83,251,5,248,138,247,5,251,80,248,254,251,198,251,7,247,75,6,14,163,248,225,122,1,41,240,1,163,247,192,247,254,21,242,186,85,65,58,87,87,59,60,88,122,1,81,19,189,
+    29,247,10,122,1,79,51,221,251,3,122,1,4,242,15,163,118,29,163,247,212,127,21,247,54,247,4,184,29,94,126,115,104,31,179,247,45,5,247,180,147,29,85,83,52,122,1,242,3,18,6,251,40,239,
+    41,247,46,30,14,163,247,59,88,10,80,77,55,122,1,245,0,163,206,164,10,251,161,252,249,5,247,24,187,29,163,190,122,1,82,62,247,61,247,2,122,1,242,1,61,131,10,175,84,203,110,30,62,111,
+    90,68,52,26,247,35,122,1,241,9,221,221,192,101,78,78,86,101,57,57,86,178,200,30,121,251,213,21,210,199,183,232,233,199,122,1,48,45,45,79,122,1,130,163,248,129,87,10,199,201,222,122,
+    1,251,255,96,251,101,164,247,11,93,10,252,18,247,19,247,157,181,29,251,169,247,227,39,113,29,251,172,247,34,247,6,90,10,251,142,248,10,120,21,213,86,247,178,35,7,251,90,251,177,5,64,
+    247,114,58,219,220,7,251,101,213,21,247,21,247,81,5,251,81,7,14,251,166,157,183,111,29,251,142,230,247,110,21,89,71,122,100,84,26,47,212,67,236,235,211,207,235,230,76,200,46,128,127,
+    137,135,128,30,247,1,247,38,5,45,6,61,251,187,21,188,174,177,189,188,174,101,90,89,104,103,90,89,104,175,189,30,14,251,188,247,214,247,158,21,214,251,197,64,247,118,7,251,43,252,2,
+    5,221,6,14,251,144,163,160,80,10,251,142,247,187,169,21,189,207,156,179,193,26,231,66,211,42,43,67,72,42,48,203,79,231,150,151,141,143,151,30,251,2,251,39,5,233,6,217,247,187,21,90,
+    105,102,88,90,104,176,188,189,174,176,188,190,173,102,89,30,14,251,161,170,247,70,21,251,2,166,29,251,3,30,211,22,219,167,180,191,191,167,98,59,61,112,98,86,87,111,180,217,30,14,252,
+    45,245,247,184,157,10,14,251,216,247,182,22,204,251,30,7,185,176,5,195,172,29,212,6,177,161,161,174,173,160,117,101,107,121,110,100,107,30,251,10,88,29,251,230,158,247,8,21,60,197,
+    95,209,212,195,185,214,201,98,175,135,29,176,31,14,251,201,247,82,207,21,71,207,207,185,203,93,247,118,52,7,251,50,57,29,237,247,36,5,251,36,7,14,251,213,247,47,133,21,219,194,192,
+    215,209,160,29,251,83,207,130,188,29,99,101,47,40,254,27,14,251,196,220,247,152,21,97,82,127,109,93,26,63,199,82,219,219,196,194,217,213,88,188,63,131,131,138,137,132,30,223,247,3,
+    140,29,251,247,247,88,247,184,225,35,176,14,251,203,167,238,137,29,82,104,169,29,168,34,18,174,123,39,113,104,104,119,159,29,103,113,181,44,255,58,196,247,143,237,21,181,196,150,169,
+    185,26,215,79,196,60,59,81,84,61,65,191,90,215,146,147,140,141,146,30,56,251,3,5,223,6,193,247,125,21,101,111,111,100,101,111,167,177,179,166,165,178,179,166,113,99,30,14,251,161,170,
+    248,188,21,251,3,166,29,251,2,30,211,138,21,58,1,1,18,122,55,1,52,248,9,21,57,1,1,121,35,207,214,91,185,61,61,86,88,66,30,212,6,176,69,1,0,236,114,29,14,251,201,247,82,248,77,21,71,
+    207,72,10,49,1,32,107,29,17,1,120,249,13,21,97,83,127,108,17,1,49,189,63,132,17,1,48,222,247,2,17,1,32,153,29,253,0,107,248,108,137,29,83,103,29,36,246,7,165,159,156,174,174,159,122,
+    114,114,119,121,104,104,119,157,163,173,29,108,114,121,102,17,1,47,248,107,18,1,14,50,126,21,100,18,1,34,178,178,18,1,130,100,30,14,251,102,164,248,182,38,3,34,249,75,38,3,34,247,222,
+    39,3,175,248,180,90,10,251,149,248,10,248,47,40,3,16,33,248,110,41,3,47,249,28,41,3,39,47,249,76,41,3,0,34,248,87,42,3,47,248,96,43,3,35,225,252,109,248,3,249,90,158,10,14,245,64,10,
+    248,195,12,3,112,184,176,5,196,172,29,211,12,3,255,28,175,173,159,117,101,107,122,110,99,107,30,251,9,88,29,210,64,10,248,44,207,21,71,208,72,10,51,7,251,49,57,29,236,247,34,5,251,
+    34,7,14,241,106,29,25,0,3,242,21,247,11,64,10,247,188,238,21,75,192,177,29,167,151,158,167,143,10,99,126,114,178,29,160,121,115,114,118,121,105,76,29,247,42,106,29,32,0,244,28,199,
+    29,99,151,30,168,150,158,168,143,10,100,126,113,115,29,247,59,107,29,248,163,247,235,158,10,247,189,238,21,75,191,177,29,168,86,29,92,176,69,68,92,100,250,2,16,173,71,0,195,119,121,
+    104,76,29,232,153,29,248,231,184,190,75,0,65,98,221,220,193,234,36,0,82,0,4,69,40,81,82,104,158,110,167,78,38,242,128,115,29,251,108,230,248,201,21,169,128,161,136,167,135,119,122,
+    123,124,119,111,99,79,24,193,102,181,196,156,162,152,163,146,165,25,148,118,149,116,160,110,179,82,24,193,176,99,199,121,166,124,154,118,157,25,161,142,165,143,171,150,207,163,24,116,
+    201,73,117,105,127,119,127,120,126,25,144,162,142,164,173,26,210,74,68,7,105,142,115,145,115,30,118,153,120,150,105,151,74,160,24,116,78,5,14,247,191,247,240,248,203,21,171,127,165,
+    136,162,136,119,122,124,123,118,112,98,79,24,193,102,182,196,158,167,150,161,146,161,25,147,119,150,116,159,110,180,102,0,243,16,118,166,126,155,118,156,25,162,142,165,142,171,151,
+    207,163,24,115,201,74,117,104,127,121,128,118,125,25,144,161,143,165,108,38,242,18,143,115,144,115,30,118,152,120,150,106,152,74,160,24,115,78,5,251,82,252,50,21,172,127,165,136,160,
+    137,120,121,123,123,119,99,0,132,181,196,159,167,150,162,145,161,201,0,242,5,83,24,193,175,100,199,118,166,126,154,118,158,25,161,141,166,143,170,150,208,99,0,65,105,126,118,128,201,
+    0,69,143,164,182,29,94,0,177,105,152,75,161,24,115,77,5,248,218,115,192,0,82,161,137,119,121,124,93,0,18,192,192,0,112,162,146,161,25,147,118,150,38,1,9,93,0,85,162,141,165,143,170,
+    38,1,34,126,119,93,0,224,142,164,182,29,144,115,143,115,30,119,152,119,150,106,93,0,240,249,114,77,5,14,251,121,247,14,249,110,21,251,14,6,247,178,253,110,5,247,13,6,14,251,195,247,
+    59,247,64,21,197,188,188,196,197,90,188,81,80,90,91,80,81,188,91,198,31,14,251,94,247,110,247,5,21,223,212,210,224,224,68,212,53,53,66,67,53,54,212,68,225,31,14,251,217,247,47,247,
+    244,21,34,29,252,0,4,34,29,14,251,237,247,118,183,21,201,103,180,89,94,108,107,91,99,171,110,178,151,148,141,143,147,30,104,105,112,94,131,30,90,7,220,149,199,205,222,26,14,247,45,
+    247,37,127,21,34,29,247,141,22,34,29,247,141,22,34,29,14,251,208,247,100,247,111,21,153,216,149,247,26,247,25,26,247,60,251,36,251,60,7,251,22,148,251,26,152,59,30,189,251,124,21,182,
+    176,175,182,183,102,175,96,94,102,103,95,96,176,103,184,31,14,251,208,247,52,249,124,21,94,102,103,96,95,176,103,184,182,176,175,183,182,102,175,96,31,89,251,124,21,126,59,130,251,
+    26,251,22,26,251,60,247,36,247,60,7,247,25,129,247,26,125,216,30,14,222,203,247,195,21,116,251,6,5,235,6,102,251,81,246,0,105,176,247,81,5,247,20,14,0,80,5,6,162,247,6,130,29,81,163,
+    247,16,5,241,13,0,160,36,148,10,251,19,148,10,251,1,6,61,0,242,9,247,2,6,114,251,16,5,247,13,22,164,247,16,5,247,19,6,115,251,16,5,14,251,237,215,0,246,161,14,57,247,199,247,79,21,
+    162,7,190,177,169,188,174,30,197,180,208,190,246,26,247,25,49,225,251,41,251,37,34,38,251,35,30,247,19,6,216,188,192,210,209,181,94,71,81,98,105,94,103,30,86,98,83,92,48,26,116,7,199,
+    251,92,21,183,176,176,181,183,102,175,95,94,103,103,95,96,175,103,184,31,14,57,247,189,249,125,21,96,102,102,96,96,176,102,182,184,176,175,183,183,102,175,94,31,88,251,92,21,115,7,
+    89,102,108,89,104,30,81,99,70,88,32,26,251,25,230,52,247,41,247,37,243,241,247,34,30,251,18,6,63,90,85,68,68,97,185,206,198,180,173,185,174,30,191,181,195,185,230,26,163,7,14,251,94,
+    125,10,247,112,247,108,158,29,14,252,28,125,10,198,1,63,220,251,200,190,1,15,255,255,81,251,121,247,13,22,247,178,249,110,5,251,14,6,251,177,253,110,5,14,48,199,32,21,248,61,229,252,
+    61,6,14,251,179,184,247,215,21,208,172,107,81,31,251,97,7,65,190,92,216,30,208,233,94,6,114,123,156,170,31,247,91,7,206,110,177,81,157,30,197,158,168,177,206,26,247,91,7,170,155,155,
+    164,30,184,234,70,6,62,88,91,66,31,251,98,7,82,106,107,70,30,14,251,179,213,46,21,216,190,186,213,31,247,97,7,197,172,171,208,30,236,7,70,106,171,196,31,247,98,7,212,88,187,62,30,70,
+    44,184,6,164,155,123,108,31,251,91,7,72,168,101,197,120,30,81,121,110,101,72,26,251,91,7,108,123,122,114,30,94,45,6,14,251,222,247,70,140,21,249,120,247,15,234,251,126,254,53,247,126,
+    233,7,14,251,222,144,46,21,247,125,250,53,251,125,44,247,15,253,120,251,15,6,14,251,220,247,200,251,83,21,48,247,16,90,247,76,247,69,26,247,86,196,247,69,222,247,5,30,42,6,251,2,251,
+    17,83,251,76,251,67,26,251,84,205,251,71,239,251,6,30,14,251,220,236,251,83,21,239,247,6,206,247,71,247,84,26,247,67,82,247,76,251,2,247,17,30,42,6,222,251,5,196,251,69,251,86,26,251,
+    69,91,251,76,47,251,16,30,14,248,211,208,247,104,21,250,198,247,0,254,198,6,14,247,233,208,247,104,21,249,220,247,0,253,220,6,14,251,83,201,247,105,21,247,214,247,0,251,214,6,14,225,
+    148,29,248,122,251,139,21,185,44,1,192,14,225,121,10,248,61,152,29,14,251,76,148,5,0,240,0,121,10,14,251,49,128,29,247,90,22,56,29,96,167,113,81,42,0,171,46,17,109,171,46,16,69,29,
+    0,16,123,29,0,33,182,110,60,47,95,135,131,30,175,170,60,47,2,81,14,251,49,104,10,70,0,160,95,167,200,29,109,112,96,131,30,91,63,0,242,255,5,247,123,29,14,251,247,104,10,14,251,247,
+    128,29,14,252,2,14,77,247,131,138,21,242,247,1,6,246,155,213,212,151,241,8,251,15,6,85,126,100,109,75,27,61,87,197,231,231,192,198,216,201,179,110,83,153,31,247,15,6,127,243,67,209,
+    251,1,155,8,247,2,36,251,3,7,251,9,116,61,40,251,25,26,251,27,216,42,247,10,116,30,14,215,248,212,207,21,218,220,61,215,5,165,180,154,186,190,26,191,124,187,113,179,30,217,216,60,219,
+    61,62,5,166,98,91,154,87,27,86,90,123,113,99,31,60,216,60,59,218,61,5,114,99,124,91,88,26,89,154,91,164,99,30,60,62,218,58,218,217,5,112,180,188,124,191,27,190,188,154,166,180,31,147,
+    247,110,21,58,71,72,58,57,72,206,220,221,205,206,222,221,206,72,57,30,14,95,247,152,44,21,216,224,6,247,26,154,225,223,247,14,26,245,81,201,251,20,167,30,105,147,5,247,107,7,191,128,
+    169,104,141,85,8,247,16,6,135,247,12,61,218,251,18,152,8,224,62,54,7,251,25,125,51,55,251,9,26,251,2,202,69,247,18,112,30,171,132,5,251,105,7,74,147,102,175,138,196,8,251,20,6,41,29,
+    240,255,84,31,129,8,135,248,81,21,75,153,111,170,192,26,193,175,175,199,149,30,251,91,7,223,251,29,21,199,126,168,108,88,26,88,103,104,79,127,30,247,87,7,14,121,248,82,127,21,182,179,
+    144,149,185,31,247,15,7,127,99,97,132,99,27,251,3,60,183,226,102,31,247,142,230,251,163,6,138,151,138,151,152,26,150,139,150,140,150,30,247,164,230,251,143,6,228,176,221,184,247,11,
+    27,169,182,133,130,171,31,247,12,7,149,106,98,144,102,27,251,75,251,27,45,251,52,94,31,63,48,199,6,138,128,139,127,127,26,127,139,127,140,128,30,79,48,214,6,251,50,184,247,24,47,247,
+    68,27,14,128,212,248,42,21,251,6,247,60,7,100,251,190,5,101,134,112,119,104,27,52,251,9,224,6,247,19,196,197,239,152,31,180,247,207,5,247,86,247,6,251,71,6,158,247,42,5,187,145,163,
+    158,175,27,239,247,9,46,6,251,8,67,71,251,1,125,31,119,251,49,5,14,153,248,22,22,247,37,219,228,247,46,31,251,15,6,60,138,111,94,47,27,251,73,6,191,163,163,192,197,26,162,135,161,134,
+    160,30,247,86,234,251,118,6,129,171,130,170,173,26,211,189,185,214,210,187,104,65,143,30,247,20,6,247,31,135,37,223,251,33,27,251,43,37,38,251,25,107,147,107,149,108,31,75,44,235,6,
+    146,115,144,115,116,26,67,94,86,71,134,30,251,11,7,14,160,247,122,248,9,21,251,21,48,247,59,81,251,59,48,247,59,251,25,247,13,247,25,247,58,230,251,58,197,6,0,240,3,20,6,247,102,247,
+    250,5,251,37,6,251,56,251,196,251,55,247,196,12,0,243,10,14,163,219,248,24,21,37,247,91,251,92,241,247,92,247,91,241,251,91,247,91,37,251,91,7,25,0,64,248,136,241,7,208,13,241,13,248,
+    209,21,66,67,247,56,251,56,251,57,251,57,212,67,247,57,247,57,247,55,251,56,212,211,251,56,247,2,0,240,25,66,211,251,55,251,55,5,14,163,247,223,248,57,21,178,174,173,178,180,104,172,
+    100,98,104,106,98,100,174,105,180,31,251,143,74,73,10,251,141,251,208,27,0,34,179,179,27,0,32,99,99,27,0,0,106,0,240,4,96,73,10,252,136,251,107,73,10,14,163,247,11,157,21,247,7,6,206,
+    4,6,209,171,242,251,114,6,199,247,4,5,247,54,242,34,19,0,241,31,251,8,6,72,251,16,5,251,171,36,247,115,6,78,251,4,5,251,54,36,245,6,14,163,248,216,247,77,21,247,21,7,252,136,247,67,
+    77,10,248,16,251,13,252,16,251,13,131,49,0,28,0,241,12,20,21,252,16,247,13,248,16,247,13,5,247,11,7,252,136,251,67,5,251,21,7,248,136,251,68,5,60,0,19,183,60,0,17,61,60,0,225,6,252,
+    16,251,6,77,10,119,4,36,248,136,242,7,33,0,16,134,65,0,83,6,248,16,247,6,65,0,19,61,65,0,208,60,5,252,136,251,15,21,248,136,242,252,136,6,203,0,17,82,78,1,66,55,241,247,55,78,1,149,
+    54,37,251,54,7,251,91,252,82,36,0,240,25,248,122,248,125,21,94,183,29,66,44,74,10,167,179,199,197,61,234,27,224,193,212,238,31,45,251,91,21,93,183,29,67,43,74,10,168,179,199,197,60,
+    23,0,183,213,238,31,14,163,248,122,248,28,21,94,148,47,12,58,0,240,255,114,14,163,248,203,248,13,21,252,141,35,248,25,251,76,247,8,6,14,247,100,248,55,127,21,247,93,247,48,247,55,247,
+    107,220,118,212,102,199,31,230,222,83,201,51,59,5,201,76,53,176,42,27,251,95,251,45,251,53,251,109,59,161,65,176,79,31,52,60,196,77,222,215,5,77,202,224,102,235,27,251,128,248,14,21,
+    247,48,237,247,0,247,30,203,195,116,99,179,30,252,4,251,226,5,121,177,129,184,189,26,247,128,251,156,21,76,84,162,178,98,31,248,4,247,227,5,157,101,149,94,89,26,251,46,41,251,2,251,
+    31,30,14,247,155,185,247,179,21,251,9,225,54,247,9,224,195,175,222,199,30,56,198,195,103,223,27,247,11,224,224,247,9,247,10,54,225,251,11,56,82,103,55,80,31,223,79,82,175,55,27,251,
+    10,54,53,251,10,31,247,3,22,198,176,177,196,194,182,107,74,167,30,76,111,95,106,85,27,82,102,178,196,31,248,0,22,204,167,183,171,194,27,196,176,100,81,82,101,100,83,85,94,172,202,111,
+    31,14,251,84,247,6,126,21,238,209,210,246,31,248,39,7,185,159,159,175,30,214,247,2,55,6,39,69,69,32,31,252,39,7,92,119,120,104,30,64,251,3,6,14,203,249,33,22,246,7,251,135,249,4,5,
+    251,13,6,251,134,253,3,5,251,0,7,247,181,248,166,21,141,142,147,161,142,152,142,128,144,125,144,126,247,56,252,59,24,251,243,6,14,208,247,101,22,248,249,247,179,252,249,247,20,249,
+    111,252,179,54,10,76,248,162,22,247,10,251,232,7,247,111,247,142,251,109,247,137,5,247,230,247,10,252,121,251,20,6,247,104,251,127,251,104,251,131,12,2,80,14,235,247,89,22,131,36,32,
+    133,249,34,32,240,1,247,3,251,125,6,251,109,252,211,251,21,247,228,5,251,19,3,23,243,5,72,251,121,21,125,247,157,5,111,159,171,118,184,27,203,180,171,186,169,31,34,23,44,251,14,248,
+    22,240,180,253,103,7,14,148,189,247,147,21,251,61,247,14,40,247,36,247,40,247,23,240,247,103,247,40,80,247,44,251,31,247,28,30,251,48,6,247,1,47,200,53,173,55,8,173,102,85,154,92,27,
+    251,31,251,10,36,251,56,31,247,15,138,21,231,201,206,227,225,201,73,48,45,76,73,53,52,77,205,231,30,14,247,215,78,10,42,135,10,249,122,78,10,248,55,22,247,4,60,219,251,3,251,4,60,59,
+    251,4,251,4,218,59,247,4,247,3,218,219,247,4,30,252,152,162,29,248,55,135,10,247,83,247,18,248,41,21,247,133,247,130,5,253,23,232,249,23,7,247,133,251,130,205,205,251,246,247,243,251,
+    245,251,243,5,14,247,108,247,186,249,18,21,247,230,6,252,208,252,209,205,74,248,208,248,208,5,251,230,233,248,133,252,134,7,14,247,230,248,131,214,29,241,72,131,251,131,253,54,138,
+    5,47,249,54,7,251,131,251,132,205,73,247,245,247,244,251,245,247,244,5,14,247,106,249,77,248,135,21,138,251,230,252,207,248,206,74,74,248,206,252,207,5,251,230,45,248,134,248,134,6,
+    14,247,79,249,79,247,194,21,251,133,251,131,5,249,67,46,253,67,7,251,130,247,131,72,73,247,243,251,244,247,244,64,0,241,12,109,248,195,232,21,251,231,6,248,209,248,210,73,204,252,208,
+    252,209,5,247,230,45,7,138,252,133,5,66,0,242,12,230,248,115,138,21,251,131,247,131,5,249,54,232,253,54,6,247,131,247,132,73,204,251,245,251,245,247,194,0,240,129,90,199,249,111,21,
+    252,134,7,232,138,5,247,231,7,248,191,252,207,205,204,252,191,248,207,247,230,140,5,232,7,14,248,128,199,247,166,21,247,167,251,169,5,247,25,7,39,235,5,249,37,6,41,44,5,251,25,7,247,
+    166,247,168,251,166,247,165,5,251,25,7,238,44,251,117,140,5,140,251,92,138,7,251,123,138,237,233,5,247,26,7,14,173,247,225,251,74,21,247,169,247,167,5,251,26,6,44,39,5,249,38,7,234,
+    40,5,247,26,6,251,169,247,166,251,165,251,166,5,247,25,6,234,237,138,251,117,5,138,251,90,140,6,140,251,125,44,238,253,34,81,14,247,152,58,10,5,0,213,225,4,251,58,251,28,247,28,247,
+    58,247,58,247,8,0,240,9,251,29,251,57,251,58,251,27,251,28,251,59,31,14,144,248,217,247,247,21,251,94,247,247,181,60,193,251,94,251,247,247,94,251,247,5,247,9,6,24,0,241,2,28,251,140,
+    251,29,247,140,247,29,247,141,5,14,247,86,196,29,5,0,241,38,248,254,47,21,252,162,252,162,248,162,7,14,247,222,199,22,249,226,6,252,59,249,90,5,14,247,223,248,120,249,93,21,252,60,
+    253,90,5,249,227,6,253,80,220,21,247,168,248,98,247,168,252,98,5,147,0,240,2,251,194,248,24,21,247,45,247,8,247,20,247,40,158,30,251,148,213,1,240,159,55,5,123,175,130,180,181,26,248,
+    240,22,97,130,99,124,102,30,251,130,247,55,5,247,147,7,247,39,119,247,7,251,19,251,44,26,252,175,251,78,21,247,91,247,27,5,251,141,7,59,150,68,181,91,200,8,247,169,247,27,21,247,90,
+    251,27,91,78,69,97,59,129,25,14,209,247,145,146,21,248,22,248,99,60,206,251,203,252,10,251,34,247,44,69,64,5,14,247,200,247,154,247,117,21,52,200,86,240,211,204,174,189,159,30,84,153,
+    183,109,208,27,247,7,213,240,247,46,247,126,251,69,247,62,251,136,251,137,251,76,251,75,251,137,251,138,247,75,251,75,247,138,228,223,165,189,209,31,104,207,5,95,76,66,114,67,27,251,
+    92,251,40,247,43,247,95,247,94,247,8,0,240,255,255,255,255,201,92,247,91,247,33,251,29,251,84,251,0,102,66,84,105,122,157,177,31,247,47,7,247,13,68,208,251,17,251,15,60,75,42,30,233,
+    6,187,176,166,205,200,171,110,82,30,129,7,251,27,128,5,251,2,131,81,85,59,26,247,5,143,21,178,167,159,207,145,30,234,147,5,115,7,71,96,98,69,87,113,159,179,30,14,239,248,217,22,247,
+    34,6,251,11,247,26,5,176,197,159,212,224,26,251,11,6,91,132,97,126,104,30,251,39,247,57,5,230,200,178,197,212,26,234,65,205,32,251,0,60,69,42,84,161,94,196,73,30,251,4,85,81,66,50,
+    26,251,15,246,55,247,51,227,213,163,183,197,30,251,171,248,158,21,182,166,165,183,181,165,114,96,89,114,98,88,109,30,92,193,123,169,175,26,61,252,7,21,196,170,181,208,178,30,247,78,
+    251,101,5,111,104,94,124,84,27,45,82,182,210,31,14,106,166,248,166,21,251,19,216,63,247,6,30,181,252,49,244,249,197,251,39,6,251,5,61,62,251,16,31,248,111,252,254,21,249,198,93,253,
+    198,7,14,251,45,248,87,248,12,21,209,103,186,50,160,30,44,162,5,97,148,116,159,168,26,176,167,161,188,186,167,112,96,140,30,247,8,6,236,144,10,77,53,88,160,103,188,116,31,85,113,103,
+    90,82,26,70,175,91,228,119,30,235,117,5,180,130,163,118,110,26,103,111,117,90,91,111,166,181,138,30,251,7,6,42,215,76,247,3,247,5,221,200,225,190,118,175,90,163,30,193,163,175,188,
+    196,26,251,6,129,21,94,107,107,76,75,107,171,184,184,171,172,203,202,171,106,94,30,14,247,77,248,47,126,21,247,99,247,55,247,59,247,104,247,104,251,55,247,58,251,99,251,100,251,55,
+    251,58,251,104,251,104,247,55,251,59,247,100,31,213,4,251,58,251,19,247,24,247,65,247,64,247,19,247,24,247,58,247,57,247,18,251,23,251,65,251,65,251,18,251,24,251,57,31,251,80,247,
+    196,21,251,10,215,60,247,6,236,212,198,226,150,30,46,6,98,128,109,118,92,27,81,100,183,209,207,180,185,198,184,167,118,97,150,31,233,6,229,128,69,195,39,27,251,3,60,57,251,8,31,14,
+    251,22,92,10,94,197,21,225,196,7,184,53,5,184,6,87,235,5,170,151,156,166,170,26,185,104,166,86,30,43,251,131,6,247,33,247,55,21,114,122,124,110,30,85,216,193,6,169,155,127,114,31,14,
+    251,22,92,10,105,192,21,209,192,7,195,174,173,192,188,102,171,85,31,45,251,130,6,180,247,91,21,192,6,169,156,125,109,109,122,123,109,31,86,6,14,153,247,12,249,64,21,251,128,189,247,
+    128,233,186,251,130,92,7,247,211,251,128,21,247,72,7,217,251,72,5,181,6,217,247,75,5,251,75,186,247,175,92,7,40,251,125,40,247,125,5,92,251,175,6,14,251,216,247,180,248,248,21,215,
+    83,195,63,63,83,83,63,64,195,82,215,215,195,196,214,30,70,22,100,113,113,102,101,114,166,177,178,164,166,177,176,165,113,99,30,14,251,192,247,13,51,21,234,250,2,44,6,14,251,192,247,
+    108,249,170,21,44,251,242,234,6,44,252,164,21,234,247,242,44,6,14,251,194,247,21,247,177,21,214,247,166,247,0,211,251,0,239,64,39,32,67,246,6,14,251,192,247,21,247,177,21,214,247,1,
+    247,2,211,251,2,223,247,0,211,251,0,247,1,64,251,1,32,67,246,55,34,67,244,6,14,247,35,199,247,245,21,251,107,247,28,251,39,247,96,247,17,243,200,237,188,30,101,153,5,60,97,46,85,36,
+    27,33,55,182,213,87,31,247,72,248,194,7,140,154,139,158,158,26,247,98,251,28,247,15,251,85,251,84,251,30,251,38,251,103,30,239,247,85,21,213,188,220,189,239,27,234,223,101,71,189,31,
+    251,92,252,95,7,14,249,28,28,4,214,248,145,21,247,27,35,240,251,30,251,31,34,37,251,26,251,23,246,35,247,29,247,30,243,239,247,27,30,254,155,252,145,21,47,29,250,167,248,144,21,66,
+    84,85,66,66,82,195,210,215,192,191,216,215,191,87,63,30,230,252,28,21,244,252,76,34,7,14,251,11,247,63,248,36,21,226,247,122,227,251,122,5,244,6,251,25,247,223,5,251,11,6,251,25,251,
+    223,5,14,252,83,247,36,249,62,21,182,144,111,159,112,27,111,111,119,96,144,31,161,251,82,5,197,6,14,113,247,198,247,109,21,247,43,247,5,247,6,247,42,247,41,251,6,247,6,251,42,251,42,
+    251,8,251,7,251,40,251,41,247,8,251,7,247,42,31,188,4,251,15,48,230,247,16,247,15,230,230,247,15,247,14,229,48,251,15,251,15,49,47,251,14,31,93,221,21,233,201,7,187,45,5,195,6,82,246,
+    5,173,156,156,165,175,26,191,100,172,77,30,251,1,251,163,6,247,48,247,75,21,113,119,122,108,30,84,224,194,6,172,157,124,112,31,14,251,106,117,29,252,46,144,29,251,252,139,10,251,251,
+    167,29,251,89,118,10,251,142,120,10,251,142,150,29,251,107,138,29,251,195,97,10,251,98,98,10,251,140,180,29,252,60,247,63,249,220,21,170,117,164,106,131,131,138,135,133,30,141,168,
+    161,152,183,135,8,180,7,63,147,94,89,68,26,91,166,109,179,176,165,164,175,30,14,252,60,247,62,35,21,187,112,170,99,102,113,114,103,107,162,115,171,147,147,140,143,145,30,137,110,117,
+    125,95,144,8,98,7,215,130,184,215,34,240,18,252,13,109,29,55,248,148,248,181,21,33,6,252,2,252,224,5,247,2,6,14,251,251,167,29,251,107,138,29,251,142,150,29,33,0,1,143,0,8,167,0,245,
+    7,89,118,10,251,140,180,29,252,38,247,15,22,78,29,157,156,141,146,154,30,163,10,171,59,20,14,180,0,240,44,252,50,247,11,247,175,21,248,167,237,203,251,66,253,39,247,66,203,7,14,252,
+    50,242,249,194,21,252,167,41,75,247,66,249,39,251,66,75,7,14,250,227,214,22,247,108,249,80,251,108,6,247,153,251,96,21,247,108,247,96,12,0,175,152,253,80,21,247,109,249,80,251,109,
+    24,0,18,240,0,252,89,4,247,108,247,97,251,108,6,14,247,32,248,84,100,47,208,115,111,96,95,114,166,187,30,51,6,42,199,79,21,48,196,235,30,252,133,252,205,56,10,247,32,247,215,109,47,
+    0,155,46,48,80,252,56,21,0,228,102,29,248,64,252,113,129,29,247,32,248,15,175,29,21,69,80,251,232,252,67,56,144,45,242,17,37,251,24,21,184,241,251,24,201,5,247,2,201,207,247,13,247,
+    43,26,94,10,30,143,143,139,143,27,247,101,248,14,21,194,67,0,136,71,240,22,202,22,82,29,84,251,124,68,29,123,248,77,249,85,35,29,242,76,35,10,123,248,2,149,29,131,251,105,35,10,123,
+    247,132,132,10,247,193,20,0,65,247,100,248,205,7,64,208,174,76,10,109,103,101,168,110,176,31,247,71,22,143,70,240,0,174,109,170,103,102,109,109,103,101,169,110,176,31,198,64,54,0,112,
+    233,248,193,21,65,247,40,115,35,97,236,251,40,5,247,87,66,0,224,56,248,230,21,247,159,224,251,159,6,247,174,251,77,104,0,17,117,150,1,243,8,151,29,140,248,130,251,3,6,132,63,5,198,
+    109,70,171,65,27,251,31,46,38,251,47,97,35,247,4,219,198,178,190,170,31,147,62,5,129,247,139,50,10,123,247,189,248,181,155,63,36,83,67,155,63,4,51,41,64,247,41,251,9,92,0,83,42,249,
+    226,21,33,155,41,248,26,247,24,251,112,21,132,63,124,169,114,162,108,154,25,159,161,150,168,172,26,211,84,195,66,66,83,83,67,108,149,111,156,118,30,55,102,88,54,251,7,26,116,0,226,
+    30,147,62,5,247,6,248,130,6,251,178,154,21,103,192,59,34,174,173,207,59,96,104,31,247,54,251,154,143,0,246,4,91,248,201,21,176,149,160,163,30,175,174,80,208,27,203,178,186,233,162,
+    4,44,98,247,211,69,21,115,10,69,0,242,0,16,251,139,50,10,56,141,29,252,26,252,30,39,29,56,67,40,48,58,251,136,12,0,48,233,249,4,45,3,1,160,39,243,1,133,30,141,168,162,152,182,135,8,
+    180,7,64,147,94,89,68,160,39,245,59,164,175,30,251,184,251,207,39,29,56,127,10,251,125,251,148,39,29,251,177,167,247,195,21,45,201,85,7,251,10,198,91,233,174,61,29,30,125,238,5,84,
+    29,172,220,233,58,228,247,5,241,251,5,71,10,63,37,215,50,7,14,251,173,247,150,248,186,81,29,204,253,5,21,116,10,46,0,0,24,0,24,48,49,35,240,5,157,174,5,170,61,29,31,125,238,5,116,10,
+    41,179,90,206,124,30,113,85,63,63,36,156,152,116,51,160,121,124,105,114,119,146,150,117,31,14,50,33,161,93,251,12,46,29,72,247,199,248,186,195,60,0,75,71,240,53,14,85,167,249,24,21,
+    65,247,234,213,7,14,252,5,159,247,194,21,247,123,247,2,5,227,7,251,123,251,2,5,14,251,144,159,247,205,21,247,236,244,251,236,6,14,247,23,154,248,170,21,249,118,247,0,253,118,6,14,251,
+    151,159,247,180,21,247,229,247,53,19,49,128,229,251,53,5,14,55,248,248,137,61,243,2,10,6,252,190,253,111,5,247,14,6,14,252,46,247,4,249,189,82,64,240,30,185,29,14,126,152,249,247,155,
+    251,44,153,251,143,154,6,251,136,154,7,243,10,247,12,11,243,148,146,12,12,247,12,142,144,12,13,247,140,20,249,16,21,179,19,0,136,46,58,241,82,8,0,59,0,66,0,80,0,83,0,124,0,131,0,140,
+    0,145,0,153,0,160,0,177,0,182,0,227,0,231,0,235,0,242,0,247,1,8,1,25,1,38,1,43,1,47,1,51,1,54,1,69,1,107,1,111,1,136,1,152,1,168,1,184,1,200,1,205,1,212,1,217,1,228,1,236,1,243,1,250,
+    2,1,2,8,2,15,2,21,2,27,2,32,2,130,2,134,2,218,173,95,242,161,25,3,100,3,114,3,165,3,226,4,31,4,35,4,91,4,100,4,150,4,196,4,215,4,222,5,9,5,16,5,23,5,38,5,76,5,88,5,92,5,104,5,124,5,
+    136,5,143,5,156,5,175,5,210,5,222,5,230,6,2,6,5,6,38,6,70,6,88,6,109,6,116,6,124,6,131,6,136,6,142,6,150,6,174,6,181,6,190,6,201,6,217,6,225,6,247,7,13,7,21,7,30,7,49,7,52,7,57,7,63,
+    7,82,7,89,7,96,7,111,7,128,7,145,7,155,7,168,7,173,7,182,7,195,7,205,7,218,7,231,7,243,7,255,8,4,8,16,8,27,8,38,8,49,8,60,8,67,8,74,8,84,8,94,8,103,8,110,8,116,8,121,249,81,39,10,229,
+    6,11,180,44,15,5,45,26,0,150,51,58,229,6,11,220,2,63,21,112,29,53,37,22,16,21,174,49,81,54,10,21,251,5,26,53,240,23,11,21,197,165,29,11,149,10,81,238,5,44,6,11,21,44,10,247,20,6,14,
+    21,251,49,237,35,247,42,247,21,235,218,247,7,154,30,96,10,146,63,51,11,90,29,81,72,115,247,46,251,3,245,251,45,33,40,19,30,68,72,10,25,40,240,6,252,53,41,29,252,152,37,29,99,29,103,
+    108,129,10,11,249,163,40,10,11,21,69,65,197,167,10,227,192,202,224,224,193,77,50,30,14,238,63,2,151,51,113,6,11,6,49,247,47,5,196,75,49,47,5,11,128,67,177,253,111,7,14,253,163,84,10,
+    104,29,14,4,5,255,38,175,76,10,108,103,102,168,126,10,11,248,84,84,21,247,106,247,66,247,66,247,106,247,106,251,67,247,66,251,105,251,105,251,67,251,66,251,106,251,106,247,66,251,66,
+    247,106,31,11,21,47,29,14,21,177,36,5,240,26,21,37,6,58,251,40,5,225,6,247,143,195,29,226,6,11,247,43,230,45,251,47,251,44,50,45,251,38,31,251,15,11,247,158,126,21,214,203,172,196,
+    169,5,5,240,16,247,4,11,122,10,248,254,184,21,40,6,252,108,253,90,5,237,6,11,248,189,150,10,11,153,248,130,21,67,10,11,47,75,196,11,21,216,206,174,190,160,31,148,66,5,11,136,68,2,126,
+    68,18,11,226,69,18,11,8,31,33,11,21,5,18,112,11,31,233,6,180,140,152,251,65,144,6,229,11,108,170,103,103,109,11,94,18,240,20,11,248,52,248,189,21,247,4,59,219,251,3,251,3,59,59,251,
+    4,251,5,219,60,247,3,247,3,219,218,247,5,30,248,37,247,69,14,26,32,252,191,14,26,176,14,6,196,248,189,21,81,101,99,83,84,91,66,64,176,179,195,195,91,66,95,248,241,252,10,21,145,15,
+    6,249,123,11,251,148,97,29,21,60,204,90,242,241,205,188,218,194,107,183,89,154,30,176,153,164,173,184,26,213,80,186,51,49,82,90,68,95,161,105,176,123,30,89,123,108,94,86,26,231,247,
+    93,21,172,167,162,187,186,166,116,105,106,113,117,91,89,113,162,172,30,130,251,82,21,181,174,161,189,189,174,116,98,97,106,116,87,88,105,162,181,30,14,21,251,180,247,20,247,180,7,247,
+    138,248,79,5,251,31,6,251,35,251,158,126,115,135,127,130,121,25,131,157,132,155,128,159,251,36,247,158,24,251,35,6,14,252,48,101,29,164,247,42,40,73,47,11,21,135,49,55,35,140,10,23,
+    6,255,0,185,234,162,10,11,152,247,205,21,207,251,205,247,155,6,86,56,0,240,30,251,205,71,6,247,236,34,21,244,251,40,247,87,247,8,7,62,10,247,87,6,14,247,107,21,221,247,3,168,203,227,
+    26,247,42,251,10,247,8,251,50,251,48,251,8,251,59,37,254,245,40,241,33,247,43,157,158,142,144,157,30,251,67,251,125,5,247,38,6,247,30,248,115,21,51,81,78,52,55,80,200,227,228,11,248,
+    152,21,57,251,3,110,75,51,26,251,42,247,10,251,8,247,50,247,48,247,8,247,1,247,48,247,40,37,245,251,43,121,120,136,134,121,30,247,67,247,125,5,251,38,6,251,30,252,115,21,227,197,200,
+    226,223,198,78,51,50,11,21,110,29,14,21,153,147,139,138,149,31,192,136,162,109,99,26,95,109,110,95,94,109,166,187,30,58,6,44,206,84,226,227,210,195,230,220,85,184,73,150,30,247,1,234,
+    5,209,251,174,64,247,74,7,251,5,41,5,85,7,14,91,29,201,191,29,32,134,29,14,247,146,247,212,21,247,13,230,230,247,13,247,13,48,230,251,13,251,13,46,47,251,12,251,12,231,47,247,14,31,
+    177,4,39,66,213,239,239,212,213,239,238,212,65,39,39,66,65,40,31,11,21,251,29,209,49,247,10,247,7,213,229,247,29,247,29,70,232,251,11,251,6,64,46,251,29,30,222,22,240,178,193,206,206,
+    177,85,38,40,101,85,72,72,100,193,238,30,14,105,80,129,11,130,10,166,247,4,157,29,115,24,225,96,109,78,27,61,91,197,232,232,191,198,217,197,180,115,24,240,26,14,6,247,11,126,47,214,
+    251,27,27,251,38,38,251,0,251,45,31,14,247,58,249,137,127,29,14,247,9,249,157,131,29,14,248,201,21,141,10,247,71,22,84,75,32,129,10,166,79,145,247,25,7,211,214,247,21,251,100,206,40,
+    240,11,76,247,190,247,80,247,88,5,251,45,6,251,84,251,99,5,248,93,92,29,11,21,58,29,103,108,130,75,114,126,10,11,251,5,130,29,114,69,16,101,153,9,211,11,247,110,249,27,21,56,29,95,
+    168,200,29,108,51,25,18,11,62,52,193,84,195,66,117,10,11,248,9,248,132,114,10,32,69,32,99,101,134,69,242,1,162,143,29,171,29,146,141,142,146,30,136,110,117,70,10,215,52,72,241,24,21,
+    251,18,216,46,247,42,247,31,229,227,247,21,30,248,163,251,20,252,156,7,75,109,98,67,67,108,183,195,30,182,251,15,7,14,85,10,96,106,198,72,162,53,10,11,78,29,158,155,151,29,140,41,73,
+    241,3,26,88,178,97,199,158,155,141,146,155,30,163,10,123,154,161,165,161,170,70,255,21,114,10,14,21,144,119,122,141,122,27,73,92,106,90,118,31,132,211,5,251,7,252,129,247,14,247,132,
+    6,235,194,186,227,30,184,6,11,149,9,12,21,11,62,74,1,109,8,82,251,129,7,11,66,48,73,240,6,214,31,205,4,103,161,10,174,173,160,10,104,31,11,247,116,250,41,61,10,14,193,69,241,7,49,85,
+    29,11,247,28,249,149,50,29,14,247,87,152,29,11,245,249,45,157,10,11,217,59,63,49,29,11,207,77,4,130,11,247,77,249,37,158,29,11,226,76,242,3,141,10,11,247,174,248,201,103,10,169,108,
+    178,31,11,21,37,6,57,65,5,96,144,195,29,225,6,11,136,1,244,43,109,176,31,11,6,188,108,78,168,70,27,251,41,49,251,2,251,46,251,45,228,34,247,35,31,11,166,30,204,166,175,194,210,26,247,
+    11,38,218,251,42,251,43,36,59,251,8,68,11,248,193,60,29,235,52,10,11,249,175,85,0,4,239,45,240,25,51,88,77,53,55,84,200,228,30,14,162,29,14,21,196,165,29,11,156,248,249,142,10,11,21,
+    179,171,171,180,179,107,171,99,98,107,107,99,98,171,107,56,70,98,127,249,149,33,29,14,174,73,17,11,32,75,2,41,6,0,142,0,48,21,247,106,122,21,4,216,54,209,6,11,176,26,198,93,176,69,
+    67,93,100,82,104,30,35,21,11,231,76,54,11,75,10,59,71,242,12,11,249,163,150,10,11,44,29,44,37,234,252,28,7,14,6,176,247,82,5,251,13,6,102,251,82,5,40,0,0,17,56,18,11,5,60,3,194,84,
+    8,55,75,23,11,83,76,23,11,36,73,80,11,111,96,198,29,8,77,96,247,202,247,216,251,202,234,70,242,8,251,25,251,252,251,19,247,252,5,11,21,251,184,210,247,250,251,53,73,7,11,21,41,224,
+    70,54,237,6,11,148,71,18,11,0,75,18,11,15,75,21,11,133,82,21,11,217,50,17,11,185,9,65,248,33,7,11,204,42,32,7,14,72,10,129,155,11,54,87,201,227,11,0,96,103,1,84,68,0,11,0,97,0,2,0,
+    49,0,1,2,0,51,12,0,12,192,102,209,1,0,21,0,21,0,1,0,25,0,25,0,1,202,102,48,1,0,41,162,70,32,0,43,147,70,241,3,0,52,0,52,0,1,0,54,0,54,0,1,0,56,0,56,0,1,224,102,240,0,1,0,67,0,67,0,
+    1,0,69,0,69,0,1,0,76,217,69,32,0,80,251,111,241,9,0,83,0,83,0,1,0,87,0,87,0,1,0,93,0,93,0,1,0,98,0,98,0,1,4,103,241,10,1,0,115,0,115,0,1,0,120,0,120,0,1,0,124,0,125,0,1,0,136,0,136,
+    0,1,10,103,241,28,1,0,145,0,145,0,1,0,149,0,149,0,1,0,160,0,160,0,1,0,165,0,165,0,1,0,167,0,167,0,1,0,178,0,178,0,1,0,180,0,180,0,1,36,103,209,1,0,193,0,193,0,1,0,204,0,204,0,1,46,
+    103,241,10,1,0,211,0,211,0,1,0,217,0,218,0,1,0,223,0,223,0,1,0,234,0,234,0,1,62,103,240,26,1,0,245,0,245,0,1,0,249,0,251,0,1,0,253,1,5,0,1,1,184,1,198,0,3,1,200,1,211,0,3,1,220,1,221,
+    0,1,1,240,1,247,222,69,0,160,69,240,22,0,10,0,90,0,116,0,2,68,70,76,84,0,14,108,97,116,110,0,18,0,56,0,0,0,52,0,8,65,90,69,32,0,52,67,65,84,6,0,16,82,6,0,241,4,75,65,90,32,0,52,77,
+    79,76,32,0,52,82,79,77,32,0,52,84,30,0,112,84,82,75,32,0,52,0,116,105,0,72,113,241,0,1,0,2,107,101,114,110,0,14,109,97,114,107,0,20,162,1,0,144,113,0,4,0,80,2,0,6,9,74,104,70,241,5,
+    0,1,0,8,0,1,0,12,0,34,0,7,0,172,1,220,0,2,0,3,172,0,17,0,172,0,17,15,166,0,17,27,134,1,0,38,0,15,136,104,7,81,67,0,69,0,76,137,11,6,138,104,49,115,0,120,124,1,17,136,118,1,0,128,104,
+    2,126,104,14,124,104,0,72,1,20,223,124,104,208,0,249,0,250,0,251,0,253,0,254,0,255,1,30,102,113,2,1,3,1,4,1,5,56,1,33,35,0,145,72,49,1,42,0,187,71,49,0,154,0,121,70,35,0,202,4,0,192,
+    190,0,0,0,244,0,0,0,250,0,0,0,108,114,81,166,0,1,0,172,212,1,51,2,0,184,32,0,83,202,0,1,0,196,48,0,64,208,0,0,0,190,105,81,220,0,0,0,226,52,0,53,3,0,238,68,0,240,15,4,1,0,0,5,1,6,0,
+    6,1,12,0,5,1,18,0,5,1,24,0,6,1,30,0,5,1,36,0,0,1,242,113,113,211,2,219,0,1,0,191,6,0,17,86,6,0,17,155,6,0,17,112,6,0,80,106,0,10,0,1,145,71,161,0,1,1,20,0,255,0,1,0,210,24,0,113,98,
+    0,13,0,1,0,193,12,0,17,217,6,0,113,114,2,198,0,1,0,192,12,0,17,158,6,0,17,194,6,0,17,199,184,1,17,166,12,0,16,216,6,0,32,1,1,6,0,144,0,200,2,95,0,1,0,135,1,200,2,240,0,192,1,110,0,
+    1,1,127,2,76,0,1,0,189,1,162,108,0,0,18,0,208,0,113,2,219,0,67,3,172,3,178,0,0,3,252,0,64,0,0,0,3,0,1,1,163,3,0,5,0,48,3,196,3,56,1,0,11,0,0,28,0,32,208,3,10,1,4,14,0,32,220,3,16,1,
+    0,24,0,160,232,0,0,3,238,3,244,0,0,3,86,1,16,0,161,72,35,4,6,39,0,0,14,0,55,12,4,18,14,0,50,24,4,30,14,0,195,4,36,0,0,4,42,4,48,0,0,4,54,18,0,50,60,4,66,10,0,0,6,0,64,4,72,4,78,8,0,
+    2,4,0,64,4,84,4,90,10,0,160,4,96,4,102,4,108,4,114,4,120,14,0,2,4,0,66,4,126,4,132,10,0,0,6,0,64,4,138,4,144,8,0,2,4,0,242,1,4,150,4,156,0,0,4,162,0,0,4,168,0,0,4,174,22,0,2,6,0,66,
+    4,180,4,186,10,0,0,6,0,55,4,192,5,190,107,48,4,198,4,244,116,0,25,0,0,196,0,33,210,4,234,107,242,1,0,0,4,222,0,0,4,228,4,234,0,0,4,240,4,246,31,0,34,4,252,8,0,0,6,0,64,5,2,5,8,8,0,
+    2,4,0,48,5,14,5,90,3,2,13,0,83,0,5,26,6,148,11,0,119,0,0,0,5,32,5,38,14,0,96,44,5,50,0,0,5,214,3,0,28,0,114,62,5,68,0,0,5,74,32,0,66,5,80,5,86,10,0,0,6,0,64,5,92,5,98,8,0,2,4,0,64,
+    5,104,5,110,10,0,224,5,116,5,122,0,0,6,142,5,128,0,0,5,134,18,0,98,0,0,5,140,5,146,10,0,10,6,0,32,5,152,16,0,32,5,158,6,0,2,4,0,66,5,164,5,170,10,0,0,6,0,49,5,176,7,122,1,160,5,182,
+    5,188,5,194,5,200,5,206,22,0,2,4,0,51,5,212,5,252,108,0,16,0,96,5,224,5,230,5,236,10,0,0,4,0,64,5,242,5,248,8,0,2,4,0,48,5,254,6,38,118,2,13,0,50,0,6,10,84,0,2,15,0,66,6,16,6,22,10,
+    0,2,6,0,34,6,28,8,0,0,6,0,48,6,34,6,62,118,80,0,6,46,6,52,217,105,96,6,64,0,0,6,70,26,0,98,0,0,6,76,6,82,10,0,0,6,0,64,6,88,6,94,8,0,2,4,0,66,6,100,6,106,10,0,0,6,0,64,6,112,6,118,
+    8,0,2,4,0,131,6,124,6,130,0,0,6,136,14,0,24,142,136,1,64,6,154,6,160,24,0,65,6,166,6,172,8,0,16,178,6,0,2,4,0,49,6,184,6,18,3,16,6,16,4,64,0,6,202,6,16,4,160,0,6,214,6,220,0,0,6,226,
+    6,66,4,2,41,0,64,0,0,0,6,24,4,3,14,0,49,6,244,6,12,3,145,7,0,7,6,0,0,7,12,7,2,3,160,7,24,7,66,0,0,7,30,7,36,39,0,160,7,42,7,48,0,0,7,54,7,60,14,0,33,0,0,28,0,16,72,38,1,35,7,84,18,
+    0,1,242,2,2,12,0,0,232,3,112,1,86,2,233,0,1,2,244,0,32,1,2,190,1,48,1,2,54,18,0,32,1,25,244,3,33,1,182,36,0,17,139,18,0,17,133,12,0,17,65,12,0,16,105,12,0,32,0,185,244,3,33,1,50,18,
+    0,0,102,2,48,1,2,23,24,0,129,1,66,2,230,0,1,1,109,12,0,17,147,30,0,17,131,12,0,17,115,12,0,19,115,12,0,80,77,0,1,0,145,18,0,1,86,5,49,1,0,209,24,0,16,156,18,0,33,1,25,12,0,17,100,12,
+    0,16,96,12,0,33,0,146,144,0,17,47,12,0,16,209,12,0,225,0,176,1,152,0,1,0,185,1,122,0,1,1,186,42,0,0,84,2,0,150,4,80,233,0,1,1,128,42,0,112,1,106,2,195,0,1,1,196,1,49,1,1,137,36,0,16,
+    137,24,0,32,3,92,38,5,33,1,138,192,0,113,129,2,223,0,1,1,99,180,0,0,206,1,49,1,1,57,42,0,17,38,6,0,0,88,1,49,1,1,39,12,0,16,39,60,0,129,1,39,1,120,0,1,1,110,18,0,0,40,3,48,1,1,205,
+    24,0,112,3,12,2,209,0,1,1,244,2,48,1,2,6,30,0,16,2,178,4,48,1,1,66,12,0,32,1,121,36,0,33,1,30,12,0,17,124,6,0,0,184,3,128,1,1,25,2,3,0,1,1,68,4,16,1,31,78,64,0,1,1,177,18,0,32,2,111,
+    48,0,224,3,178,255,245,0,1,1,30,2,72,0,1,1,101,18,0,32,1,23,30,0,16,1,220,2,48,1,1,239,24,0,32,0,253,24,0,160,2,43,2,232,0,1,1,192,2,102,140,5,0,18,0,16,1,206,4,144,1,1,29,2,7,0,1,
+    1,26,18,0,32,0,171,30,0,32,0,83,12,0,128,1,100,2,39,0,1,1,17,12,0,32,0,125,252,0,32,0,186,66,0,225,0,135,1,168,0,1,0,125,1,129,0,1,1,194,108,0,0,156,3,49,1,1,47,12,0,16,41,48,0,33,
+    1,42,12,0,18,93,12,0,97,0,248,0,1,1,91,78,0,16,116,18,0,32,0,217,12,0,33,0,217,12,0,128,209,2,5,0,1,0,236,2,146,9,17,228,18,0,1,10,2,33,0,169,36,0,1,246,0,225,0,217,2,220,0,1,0,169,
+    1,52,0,1,1,32,90,0,16,32,42,0,16,2,244,4,49,1,1,144,18,0,0,24,6,48,1,1,17,54,0,16,1,251,9,48,1,1,14,24,0,32,0,191,42,0,33,0,237,12,0,16,237,12,0,33,1,41,240,0,0,56,3,49,1,2,45,18,0,
+    16,27,30,0,16,1,24,5,64,1,0,150,2,146,9,16,227,24,0,33,0,208,70,2,96,189,1,38,0,1,2,112,4,144,1,3,29,2,228,0,1,3,19,30,0,32,3,105,14,1,112,1,255,2,148,0,1,2,116,4,144,1,3,23,2,105,
+    0,1,2,8,168,0,33,2,59,84,0,1,54,0,32,1,175,48,0,32,1,217,68,1,17,1,246,0,129,2,132,2,131,0,1,1,227,74,1,16,169,66,0,33,1,168,36,0,16,193,66,0,33,1,251,18,0,16,251,18,0,32,3,20,18,0,
+    33,2,4,84,0,17,77,84,0,0,190,114,48,1,0,178,18,0,32,0,125,18,0,32,0,125,42,0,33,0,185,6,0,49,126,2,3,202,121,144,2,0,10,32,228,0,1,2,118,82,9,79,1,54,3,46,2,0,1,134,6,210,6,210,3,76,
+    4,58,2,0,34,32,164,2,0,0,26,0,12,4,0,69,4,76,6,142,2,0,150,156,6,156,6,162,6,162,6,180,2,0,2,58,0,10,6,0,163,6,210,6,216,8,114,9,104,10,42,2,0,23,64,2,0,21,70,2,0,31,104,2,0,0,53,114,
+    13,184,2,0,53,210,16,48,2,0,18,74,2,0,79,32,164,16,88,2,0,2,119,180,16,180,16,206,16,102,2,0,49,206,16,152,22,0,11,4,0,69,21,250,16,124,2,0,95,166,16,166,32,182,2,0,1,137,16,130,16,
+    130,16,152,16,166,2,0,31,206,2,0,0,0,118,0,83,206,16,232,17,22,2,0,23,48,2,0,112,70,32,208,32,208,17,204,6,0,46,32,188,2,0,69,18,98,20,60,2,0,52,86,22,16,2,0,34,21,236,2,0,225,32,188,
+    32,194,32,208,21,250,32,182,32,208,22,16,166,0,240,42,208,22,16,22,42,22,84,22,122,22,204,23,10,23,96,23,146,23,192,24,62,24,132,24,194,24,204,24,210,24,216,24,234,24,244,24,250,25,
+    16,26,62,26,88,25,68,25,68,25,22,25,68,25,118,25,184,26,62,18,0,65,26,94,29,20,2,0,17,34,2,0,49,76,29,86,4,0,81,200,29,116,29,154,4,0,213,200,29,246,29,252,30,2,30,144,32,158,32,158,
+    210,1,0,32,1,15,190,0,0,35,32,194,2,0,17,208,224,0,128,208,0,2,0,30,0,1,0,80,7,241,98,52,0,61,0,40,0,69,0,144,0,50,0,146,0,147,0,126,0,149,0,179,0,128,0,182,0,182,0,159,0,186,0,253,
+    0,160,0,255,1,1,0,228,1,3,1,5,0,231,1,8,1,17,0,234,1,25,1,25,0,244,1,39,1,39,0,245,1,42,1,42,0,246,1,45,1,45,0,247,1,48,1,49,0,248,1,55,1,55,0,250,1,68,1,68,0,251,1,76,1,76,0,252,1,
+    81,1,83,0,253,1,85,1,85,1,0,170,116,240,39,1,1,95,1,95,1,8,1,97,1,97,1,9,1,99,1,99,1,10,1,101,1,114,1,11,1,118,1,118,1,25,1,166,1,167,1,26,1,171,1,172,1,28,1,215,1,218,1,30,1,220,1,
+    239,1,110,12,243,255,255,255,255,255,255,184,108,255,150,0,233,255,219,1,88,255,226,1,93,0,14,1,166,255,231,1,167,255,242,1,173,255,166,0,59,0,1,255,246,0,2,255,246,0,3,255,246,0,4,
+    255,246,0,5,255,246,0,6,255,246,0,7,255,246,0,8,255,246,0,9,255,246,0,10,255,246,0,11,255,246,0,12,255,246,0,13,255,246,0,52,0,7,0,53,0,7,0,93,255,243,0,94,255,243,0,95,255,243,0,96,
+    255,243,0,97,255,243,0,108,255,236,0,109,255,241,0,110,255,241,0,111,255,241,0,112,255,241,0,113,255,241,0,114,255,235,0,115,255,229,0,116,255,229,0,117,255,229,0,118,255,229,0,119,
+    255,229,0,233,255,246,0,234,255,246,0,235,255,246,0,236,255,246,0,237,255,246,0,238,255,246,0,240,255,246,0,241,255,246,0,242,255,246,0,243,255,246,0,244,255,246,0,250,255,253,1,76,
+    0,14,1,82,255,241,1,83,255,241,1,87,255,241,1,90,0,14,1,91,0,14,1,93,255,246,1,101,255,246,1,102,255,246,1,103,255,246,1,173,255,231,1,232,255,253,1,233,255,253,1,234,255,253,1,235,
+    255,253,0,4,0,108,255,236,0,114,255,246,1,93,255,236,1,173,255,246,0,144,0,1,255,211,0,2,255,211,0,3,255,211,0,4,255,211,0,5,255,211,0,6,255,211,0,7,255,211,0,8,255,211,0,9,255,211,
+    0,10,255,211,0,11,255,211,0,12,255,211,0,13,255,211,0,52,255,202,0,53,255,202,0,125,255,216,0,126,255,216,0,127,255,216,0,128,255,216,0,129,255,216,0,130,255,216,0,131,255,216,0,132,
+    255,216,0,133,255,216,0,134,255,216,0,135,255,216,0,136,255,216,0,137,255,216,0,139,255,218,0,140,255,218,0,141,255,218,0,142,255,218,0,143,255,218,0,144,255,218,0,145,255,218,0,146,
+    255,218,0,147,255,218,0,148,255,218,0,149,255,218,0,150,255,218,0,151,255,218,0,152,255,218,0,153,255,218,0,154,255,218,0,155,255,218,0,156,255,218,0,157,255,218,0,158,255,218,0,160,
+    255,226,0,161,255,226,0,162,255,226,0,163,255,226,0,164,255,226,0,186,255,226,0,187,255,226,0,188,255,226,0,189,255,226,0,190,255,226,0,191,255,226,0,192,255,226,0,193,255,218,0,194,
+    255,218,0,195,255,218,0,196,255,218,0,197,255,218,0,198,255,218,0,199,255,218,0,200,255,218,0,201,255,218,0,202,255,218,0,203,255,218,0,204,255,226,0,206,255,218,0,207,255,226,0,208,
+    255,226,0,209,255,226,0,210,255,226,0,211,255,232,0,212,255,232,0,213,255,232,0,214,255,232,0,215,255,232,0,216,255,232,0,223,255,226,0,224,255,226,0,225,255,226,0,226,255,226,0,227,
+    255,226,0,228,255,226,0,229,255,226,0,230,255,226,0,231,255,226,0,232,255,226,0,233,255,229,0,234,255,229,0,235,255,229,0,236,255,229,0,237,255,229,0,238,255,229,0,239,255,229,0,240,
+    255,229,0,241,255,229,0,242,255,229,0,243,255,229,0,244,255,229,0,245,255,239,0,246,255,239,0,247,255,239,0,248,255,239,0,249,255,218,0,250,255,223,1,76,0,14,1,82,255,146,1,83,255,
+    146,1,87,255,146,1,90,0,14,1,91,0,14,1,93,255,196,1,96,0,20,1,98,0,20,1,100,0,20,1,101,255,236,1,102,255,236,1,103,255,236,1,104,255,246,1,106,255,246,1,110,0,23,1,112,0,23,1,167,255,
+    226,1,173,0,17,1,222,255,218,1,223,255,218,1,224,255,218,1,225,255,218,1,226,255,218,1,227,255,218,1,228,255,218,1,229,255,218,1,230,255,218,1,231,255,218,1,232,255,223,1,233,255,223,
+    1,234,255,223,1,235,255,223,0,3,0,108,255,227,1,93,0,9,1,173,255,246,0,1,1,93,255,236,0,4,0,233,255,209,1,93,0,10,1,166,255,206,1,167,255,226,0,7,0,108,255,182,0,233,255,216,1,88,255,
+    216,1,93,0,16,1,166,255,226,1,167,255,246,1,173,255,156,0,1,0,233,255,235,0,102,0,1,255,217,0,2,255,217,0,3,255,217,0,4,255,217,0,5,255,217,0,6,255,217,0,7,255,217,0,8,255,217,0,9,
+    255,217,0,10,255,217,0,11,255,217,0,12,255,217,0,13,255,217,0,52,255,199,0,53,255,199,0,125,255,236,0,126,255,236,0,127,255,236,0,128,255,236,0,129,255,236,0,130,255,236,0,131,255,
+    236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,0,136,255,236,0,137,255,236,0,139,255,232,0,140,255,232,0,141,255,232,0,142,255,232,0,143,255,232,0,144,255,232,0,145,255,
+    232,0,146,255,232,0,147,255,232,0,148,255,232,0,149,255,232,0,150,255,232,0,151,255,232,0,152,255,232,0,153,255,232,0,154,255,232,0,155,255,232,0,156,255,232,0,157,255,232,0,158,255,
+    232,0,160,255,232,0,161,255,232,0,162,255,232,0,163,255,232,0,164,255,232,0,193,255,232,0,194,255,232,0,195,255,232,0,196,255,232,0,197,255,232,0,198,255,232,0,199,255,232,0,200,255,
+    232,0,201,255,232,0,202,255,232,0,203,255,232,0,206,255,232,0,211,255,249,0,212,255,249,0,213,255,249,0,214,255,249,0,215,255,249,0,216,255,249,0,249,255,232,0,250,255,232,1,76,0,20,
+    1,82,255,148,1,83,255,148,1,87,255,148,1,90,0,20,1,91,0,20,1,93,255,202,1,101,255,226,1,102,255,226,1,103,255,226,1,104,255,236,1,106,255,236,1,167,255,226,1,171,0,20,1,172,0,20,1,
+    222,255,232,1,223,255,232,1,224,255,232,1,225,255,232,1,226,255,232,1,227,255,232,1,228,255,232,1,229,255,232,1,230,255,232,1,231,255,232,1,232,255,232,1,233,255,232,1,234,255,232,
+    1,235,255,232,0,61,0,1,255,232,0,2,255,232,0,3,255,232,0,4,255,232,0,5,255,232,0,6,255,232,0,7,255,232,0,8,255,232,0,9,255,232,0,10,255,232,0,11,255,232,0,12,255,232,0,13,255,232,0,
+    108,255,222,0,109,255,232,0,110,255,232,0,111,255,232,0,112,255,232,0,113,255,232,0,114,255,215,0,115,255,205,0,116,255,205,0,117,255,205,0,118,255,205,0,119,255,205,0,211,0,6,0,212,
+    0,6,0,213,0,6,0,214,0,6,0,215,0,6,0,216,0,6,0,233,0,6,0,234,0,6,0,235,0,6,0,236,0,6,0,237,0,6,0,238,0,6,0,239,0,3,0,240,0,6,0,241,0,6,0,242,0,6,0,243,0,6,0,244,0,6,1,76,255,246,1,82,
+    255,192,1,83,255,192,1,87,255,192,1,90,255,246,1,91,255,246,1,93,255,229,1,101,0,10,1,102,0,10,1,103,0,10,1,109,255,219,1,110,255,216,1,111,255,219,1,112,255,216,1,167,255,249,1,171,
+    255,249,1,172,255,249,1,173,255,226,0,48,0,1,255,238,0,2,255,238,0,3,255,238,0,4,255,238,0,5,255,238,0,6,255,238,0,7,255,238,0,8,255,238,0,9,255,238,0,10,255,238,0,11,255,238,0,12,
+    255,238,0,13,255,238,0,93,255,231,0,94,255,231,0,95,255,231,0,96,255,231,0,97,255,231,0,108,255,220,0,109,255,229,0,110,255,229,0,111,255,229,0,112,255,229,0,113,255,229,0,114,255,
+    232,0,115,255,200,0,116,255,200,0,117,255,200,0,118,255,200,0,119,255,200,0,120,0,14,0,121,0,14,0,122,0,14,0,123,0,14,210,0,151,236,1,83,255,236,1,87,255,236,210,0,240,28,242,1,108,
+    255,226,1,109,255,230,1,110,255,216,1,111,255,230,1,112,255,216,1,113,255,226,1,173,255,226,0,5,0,108,255,247,0,233,255,249,1,166,255,236,136,3,64,1,173,255,236,186,20,241,23,255,241,
+    0,8,0,108,0,10,0,233,255,212,0,239,255,212,1,88,255,249,1,93,255,182,1,166,255,216,1,167,255,216,1,173,0,30,0,2,38,6,242,255,255,38,167,255,245,0,209,0,1,255,150,0,2,255,150,0,3,255,
+    150,0,4,255,150,0,5,255,150,0,6,255,150,0,7,255,150,0,8,255,150,0,9,255,150,0,10,255,150,0,11,255,150,0,12,255,150,0,13,255,150,0,15,255,220,0,16,255,220,0,17,255,220,0,18,255,220,
+    0,19,255,220,0,20,255,220,0,36,255,220,0,37,255,220,0,38,255,220,0,39,255,220,0,40,255,220,0,52,255,167,0,53,255,167,0,69,255,220,0,70,255,220,0,71,255,220,0,72,255,220,0,73,255,220,
+    0,74,255,220,0,75,255,220,0,76,255,220,0,77,255,220,0,78,255,220,0,79,255,220,0,82,255,220,0,87,255,249,0,88,255,249,0,89,255,249,0,90,255,249,0,91,255,249,0,92,255,249,0,93,0,10,0,
+    94,0,10,0,95,0,10,0,96,0,10,0,97,0,10,0,124,255,220,0,125,255,172,0,126,255,172,0,127,255,172,0,128,255,172,0,129,255,172,0,130,255,172,0,131,255,172,0,132,255,172,0,133,255,172,0,
+    134,255,172,0,135,255,172,0,136,255,172,0,137,255,172,0,139,255,172,0,140,255,172,0,141,255,172,0,142,255,172,0,143,255,172,0,144,255,172,0,145,255,172,0,146,255,172,0,147,255,172,
+    0,148,255,172,0,149,255,172,0,150,255,172,0,151,255,172,0,152,255,172,0,153,255,172,0,154,255,172,0,155,255,172,0,156,255,172,0,157,255,172,0,158,255,172,0,159,255,235,0,160,255,172,
+    0,161,255,172,0,162,255,172,0,163,255,172,0,164,255,172,0,186,255,202,0,187,255,202,0,188,255,202,0,189,255,202,0,190,255,202,0,191,255,202,0,192,255,202,0,193,255,172,0,194,255,172,
+    0,195,255,172,0,196,255,172,0,197,255,172,0,198,255,172,0,199,255,172,0,200,255,172,0,201,255,172,0,202,255,172,0,203,255,172,0,204,255,202,0,206,255,172,0,207,255,202,0,208,255,202,
+    0,209,255,202,0,210,255,202,0,211,255,182,0,212,255,182,0,213,255,182,0,214,255,182,0,215,255,182,0,216,255,182,0,218,255,242,0,219,255,242,0,220,255,242,0,221,255,242,0,222,255,242,
+    0,223,255,202,0,224,255,202,0,225,255,202,0,226,255,202,0,227,255,202,0,228,255,202,0,229,255,202,0,230,255,202,0,231,255,202,0,232,255,202,0,233,255,222,0,234,255,212,0,235,255,212,
+    0,236,255,212,0,237,255,212,0,238,84,2,240,107,0,240,255,222,0,241,255,222,0,242,255,222,0,243,255,222,0,244,255,222,0,245,255,222,0,246,255,222,0,247,255,222,0,248,255,222,0,249,255,
+    172,0,250,255,172,0,251,255,242,0,252,255,235,0,253,255,235,0,254,255,235,0,255,255,235,1,0,255,235,1,1,255,235,1,2,255,235,1,3,255,242,1,4,255,242,1,5,255,242,1,76,0,20,1,81,255,209,
+    1,82,255,159,1,83,255,159,1,87,255,159,1,88,255,242,1,90,0,20,1,91,0,20,1,92,124,6,241,141,255,168,1,101,255,182,1,102,255,182,1,103,255,182,1,104,255,196,1,105,255,222,1,106,255,196,
+    1,107,255,222,1,108,255,176,1,113,255,176,1,166,255,202,1,167,255,189,1,171,255,242,1,172,255,242,1,215,255,220,1,216,255,220,1,217,255,220,1,218,255,220,1,219,255,220,1,222,255,172,
+    1,223,255,172,1,224,255,172,1,225,255,172,1,226,255,172,1,227,255,172,1,228,255,172,1,229,255,172,1,230,255,172,1,231,255,172,1,232,255,172,1,233,255,172,1,234,255,172,1,235,255,172,
+    1,236,255,242,1,237,255,242,1,238,255,242,1,239,255,242,0,6,0,233,255,222,0,239,255,232,174,0,255,255,51,93,255,195,1,166,255,207,1,167,255,199,0,151,0,15,255,222,0,16,255,222,0,17,
+    255,222,0,18,255,222,0,19,255,222,0,20,255,222,0,36,255,222,0,37,255,222,0,38,255,222,0,39,255,222,0,40,255,222,0,52,255,242,0,53,255,242,0,69,255,222,0,70,255,222,0,71,255,222,0,72,
+    255,222,0,73,255,222,0,74,255,222,0,75,255,222,0,76,255,222,0,77,255,222,0,78,255,222,0,79,255,222,0,82,255,222,0,124,255,222,0,125,255,242,0,126,255,242,0,127,255,242,0,128,255,242,
+    0,129,255,242,0,130,255,242,0,131,255,242,0,132,255,242,0,133,255,242,0,134,255,242,0,135,255,242,0,136,255,242,0,137,255,242,0,139,255,222,0,140,255,222,0,141,255,222,0,142,255,222,
+    0,143,255,222,0,144,255,222,0,145,255,222,0,146,255,222,0,147,255,222,0,148,255,222,0,149,255,222,0,150,255,222,0,151,255,222,0,152,255,222,0,153,255,222,0,154,255,222,0,155,255,222,
+    0,156,255,222,0,157,255,222,0,158,255,222,0,159,255,242,0,160,255,236,0,161,255,236,0,162,255,236,0,163,255,236,0,164,255,236,0,193,255,222,0,194,255,222,0,195,255,222,0,196,255,222,
+    0,197,255,222,0,198,255,222,0,199,255,222,0,200,255,222,0,201,255,222,0,202,255,222,0,203,255,222,0,206,255,222,184,2,4,255,22,234,0,224,255,234,0,225,255,234,0,226,255,234,0,227,255,
+    234,0,228,255,234,0,229,255,234,0,230,255,234,0,231,255,234,0,232,255,234,130,9,6,15,126,9,1,51,249,255,222,160,2,249,10,242,0,253,255,242,0,254,255,242,0,255,255,242,1,0,255,242,1,
+    1,255,242,1,2,255,242,160,2,241,34,88,255,225,1,96,0,30,1,98,0,30,1,100,0,30,1,101,255,214,1,102,255,214,1,103,255,214,1,104,255,216,1,106,255,216,1,109,255,242,1,110,255,249,1,111,
+    255,242,1,112,160,5,17,222,148,12,243,100,171,255,222,1,172,255,222,1,215,255,222,1,216,255,222,1,217,255,222,1,218,255,222,1,219,255,222,1,222,255,222,1,223,255,222,1,224,255,222,
+    1,225,255,222,1,226,255,222,1,227,255,222,1,228,255,222,1,229,255,222,1,230,255,222,1,231,255,222,1,236,255,242,1,237,255,242,1,238,255,242,1,239,255,242,0,6,0,233,255,195,0,239,255,
+    210,1,88,255,229,1,93,255,171,1,166,255,182,1,167,255,178,0,3,0,233,255,243,20,13,241,0,243,0,3,0,108,255,172,0,233,255,236,1,173,255,216,60,6,241,2,182,0,114,255,222,0,233,255,245,
+    0,239,255,234,1,173,255,206,60,6,2,28,0,209,228,0,239,0,20,1,166,255,242,1,167,255,222,88,6,192,3,1,84,0,49,1,88,0,65,1,173,0,252,137,17,108,32,4,17,246,78,0,17,6,92,0,2,78,0,17,235,
+    78,0,49,123,0,30,82,0,8,26,0,17,232,26,0,49,93,255,249,26,0,241,6,11,0,93,255,196,0,94,255,196,0,95,255,196,0,96,255,196,0,97,255,196,86,0,241,4,109,255,221,0,110,255,221,0,111,255,
+    221,0,112,255,221,0,113,255,221,72,0,240,2,221,0,233,0,15,0,239,0,30,1,93,255,228,1,166,0,10,244,6,1,202,0,112,181,0,233,255,241,0,239,230,6,131,0,7,1,173,255,212,0,33,22,0,15,126,
+    13,3,31,239,130,13,4,241,24,245,255,246,0,246,255,246,0,247,255,246,0,248,255,246,1,76,255,243,1,82,255,246,1,83,255,246,1,87,255,246,1,90,255,243,1,91,255,243,196,0,241,14,105,255,
+    228,1,107,255,228,1,109,255,236,1,110,255,233,1,111,255,236,1,112,255,233,1,171,255,236,1,172,102,1,241,88,226,0,37,0,114,255,242,0,138,0,14,0,165,0,14,0,166,0,14,0,167,0,21,0,168,
+    0,21,0,169,0,21,0,170,0,21,0,171,0,21,0,172,0,21,0,173,0,21,0,174,0,21,0,175,0,21,0,176,0,14,0,177,0,14,0,178,0,14,0,179,0,14,0,180,0,14,0,181,0,14,0,182,0,14,0,183,0,14,0,184,0,14,
+    0,185,0,14,0,205,0,14,0,217,0,14,170,1,243,110,88,0,21,1,96,0,28,1,98,0,28,1,100,0,28,1,109,0,14,1,110,0,14,1,111,0,14,1,112,0,14,1,173,0,42,1,220,0,21,1,221,0,14,0,118,0,1,255,219,
+    0,2,255,219,0,3,255,219,0,4,255,219,0,5,255,219,0,6,255,219,0,7,255,219,0,8,255,219,0,9,255,219,0,10,255,219,0,11,255,219,0,12,255,219,0,13,255,219,0,52,255,226,0,53,255,226,0,93,255,
+    212,0,94,255,212,0,95,255,212,0,96,255,212,0,97,255,212,12,10,255,94,222,0,110,255,222,0,111,255,222,0,112,255,222,0,113,255,222,0,114,255,229,0,115,255,195,0,116,255,195,0,117,255,
+    195,0,118,255,195,0,119,255,195,0,120,255,230,0,121,255,230,0,122,255,230,0,123,255,230,0,125,255,232,0,126,255,232,0,127,255,232,0,128,255,232,0,129,255,232,0,130,255,232,0,131,255,
+    232,0,132,255,232,0,133,255,232,0,134,255,232,0,135,255,232,0,136,255,232,0,137,255,232,222,11,132,243,6,245,0,212,255,245,0,213,255,245,0,214,255,245,0,215,255,245,0,216,255,245,222,
+    11,255,26,231,1,82,255,165,1,83,255,165,1,87,255,165,1,93,255,232,1,101,255,219,1,102,255,219,1,103,255,219,1,104,255,239,1,106,255,239,1,167,255,219,202,11,24,209,231,1,233,255,231,
+    1,234,255,231,1,235,255,231,38,3,17,212,118,1,81,239,0,10,1,93,190,3,17,219,190,3,159,101,0,52,255,249,0,53,255,249,192,1,4,31,212,204,11,2,255,132,115,255,210,0,116,255,210,0,117,
+    255,210,0,118,255,210,0,119,255,210,0,139,255,234,0,140,255,234,0,141,255,234,0,142,255,234,0,143,255,234,0,144,255,234,0,145,255,234,0,146,255,234,0,147,255,234,0,148,255,234,0,149,
+    255,234,0,150,255,234,0,151,255,234,0,152,255,234,0,153,255,234,0,154,255,234,0,155,255,234,0,156,255,234,0,157,255,234,0,158,255,234,0,193,255,234,0,194,255,234,0,195,255,234,0,196,
+    255,234,0,197,255,234,0,198,255,234,0,199,255,234,0,200,255,234,0,201,255,234,0,202,255,234,0,203,255,234,0,206,255,234,66,13,6,241,162,218,0,20,0,219,0,20,0,220,0,20,0,221,0,20,0,
+    222,0,20,0,234,0,10,0,235,0,10,0,236,0,10,0,237,0,10,0,238,0,10,0,240,0,10,0,241,0,10,0,242,0,10,0,243,0,10,0,244,0,10,0,249,255,234,0,251,0,20,1,3,0,20,1,4,0,20,1,5,0,20,1,82,255,
+    249,1,83,255,249,1,87,255,249,1,101,255,212,1,102,255,212,1,103,255,212,1,104,255,229,1,106,255,229,1,166,255,249,1,167,255,239,1,173,255,236,1,222,255,234,1,223,255,234,1,224,255,
+    234,1,225,255,234,1,226,255,234,1,227,255,234,1,228,255,234,1,229,255,234,1,230,255,234,1,231,255,234,1,236,0,20,1,237,0,20,1,238,0,20,1,239,0,138,17,108,26,6,0,70,5,240,2,211,0,5,
+    0,114,0,6,1,88,0,20,1,93,255,219,1,167,68,4,33,0,33,212,1,2,74,3,2,212,1,17,232,34,2,177,173,255,231,0,10,1,11,255,253,1,15,164,4,241,2,220,1,83,255,220,1,87,255,220,1,93,255,241,1,
+    108,255,206,50,12,2,46,12,241,2,206,0,9,1,9,255,242,1,13,255,249,1,15,0,9,1,16,40,5,19,20,166,6,19,242,166,6,241,10,242,0,20,1,9,0,7,1,10,0,7,1,11,0,7,1,12,255,245,1,13,255,247,1,15,
+    150,18,213,20,1,82,0,14,1,83,0,14,1,87,0,14,140,9,59,93,0,20,150,14,245,122,226,1,106,255,226,1,110,255,253,1,112,255,253,0,15,1,9,255,246,1,10,255,243,1,11,0,21,1,12,0,4,1,13,255,
+    252,1,15,0,13,1,76,0,10,1,82,255,247,1,83,255,247,1,87,255,247,1,90,0,10,1,91,0,10,1,101,0,14,1,102,0,14,1,103,0,14,0,21,1,9,255,208,1,10,255,233,1,11,0,4,1,12,255,250,1,13,255,250,
+    1,14,255,243,1,15,255,217,1,17,255,229,1,26,0,10,1,76,255,242,1,82,255,240,1,83,255,240,1,87,255,240,1,90,255,242,1,91,255,242,34,15,241,10,109,255,202,1,110,255,202,1,111,255,202,
+    1,112,255,202,0,12,1,9,255,228,1,10,255,241,230,0,121,15,255,249,1,17,255,253,66,0,51,109,255,249,190,7,16,249,190,7,161,0,11,1,9,255,209,1,10,255,239,50,0,1,194,0,105,255,203,1,17,
+    255,236,54,0,17,110,236,7,241,0,242,0,31,1,8,255,243,1,9,0,17,1,10,255,253,50,0,241,32,12,255,220,1,13,255,243,1,14,255,233,1,15,0,50,1,16,255,246,1,17,0,14,1,76,0,54,1,82,255,152,
+    1,83,255,152,1,87,255,152,1,90,0,54,1,91,0,54,196,7,187,96,0,40,1,98,0,40,1,100,0,40,234,10,49,186,1,105,102,8,48,186,1,107,106,8,245,5,0,33,1,110,0,33,1,111,0,33,1,112,0,33,0,17,1,
+    9,255,237,172,0,50,12,255,253,114,1,225,255,246,1,82,255,250,1,83,255,250,1,87,255,250,250,13,241,12,101,255,249,1,102,255,249,1,103,255,249,1,109,255,239,1,110,255,239,1,111,255,239,
+    1,112,255,239,184,1,209,245,1,10,255,249,1,11,255,243,1,12,255,235,60,2,145,14,255,242,1,15,255,250,1,16,114,1,6,114,2,240,20,109,255,243,1,110,255,236,1,111,255,243,1,112,255,236,
+    0,2,1,12,255,126,1,26,255,226,0,1,1,45,0,14,0,1,1,40,126,21,241,9,1,38,255,251,1,42,255,246,1,45,0,23,1,55,0,23,0,2,1,145,0,10,1,146,182,27,81,68,0,40,0,5,26,0,112,48,255,251,1,52,
+    255,246,34,0,241,51,1,68,255,216,0,1,1,42,255,206,0,11,0,108,255,242,0,109,255,242,0,110,255,242,0,111,255,242,0,112,255,242,0,113,255,242,0,115,255,235,0,116,255,235,0,117,255,235,
+    0,118,255,235,0,119,255,235,0,12,0,108,255,159,0,233,255,165,20,8,255,88,8,255,220,1,9,255,157,1,11,255,247,1,12,255,247,1,13,255,240,1,14,255,226,1,15,255,226,1,16,255,250,1,17,255,
+    233,0,16,0,186,0,50,0,187,0,50,0,188,0,50,0,189,0,50,0,190,0,50,0,191,0,50,0,192,0,50,0,204,0,50,0,207,0,50,0,208,0,50,0,209,0,50,0,210,0,50,1,109,0,20,1,110,0,20,1,111,0,20,1,112,
+    0,20,0,33,208,8,4,241,4,182,0,109,255,212,0,110,255,212,0,111,255,212,0,112,255,212,0,113,164,5,0,48,22,240,65,171,0,116,255,171,0,117,255,171,0,118,255,171,0,119,255,171,0,233,255,
+    226,0,234,255,236,0,235,255,236,0,236,255,236,0,237,255,236,0,238,255,236,0,239,255,236,0,240,255,226,0,241,255,226,0,242,255,226,0,243,255,226,0,244,255,226,0,245,255,236,0,246,255,
+    236,0,247,255,236,0,248,255,64,17,17,108,200,3,241,2,20,1,10,0,10,1,12,255,207,1,13,255,236,1,15,0,47,220,9,255,140,209,0,173,0,1,255,182,0,2,255,182,0,3,255,182,0,4,255,182,0,5,255,
+    182,0,6,255,182,0,7,255,182,0,8,255,182,0,9,255,182,0,10,255,182,0,11,255,182,0,12,255,182,0,13,255,182,0,15,255,236,0,16,255,236,0,17,255,236,0,18,255,236,0,19,255,236,0,20,255,236,
+    0,36,255,236,0,37,255,236,0,38,255,236,0,39,255,236,0,40,255,236,0,52,255,162,0,53,255,162,0,69,255,236,0,70,255,236,0,71,255,236,0,72,255,236,0,73,255,236,0,74,255,236,0,75,255,236,
+    0,76,255,236,0,77,255,236,0,78,255,236,0,79,255,236,0,82,255,236,212,15,2,241,255,87,115,0,7,0,116,0,7,0,117,0,7,0,118,0,7,0,119,0,7,0,124,255,236,0,125,255,162,0,126,255,162,0,127,
+    255,162,0,128,255,162,0,129,255,162,0,130,255,162,0,131,255,162,0,132,255,162,0,133,255,162,0,134,255,162,0,135,255,162,0,136,255,162,0,137,255,162,0,139,255,162,0,140,255,162,0,141,
+    255,162,0,142,255,162,0,143,255,162,0,144,255,162,0,145,255,162,0,146,255,162,0,147,255,162,0,148,255,162,0,149,255,162,0,150,255,162,0,151,255,162,0,152,255,162,0,153,255,162,0,154,
+    255,162,0,155,255,162,0,156,255,162,0,157,255,162,0,158,255,162,0,160,255,176,0,161,255,176,0,162,255,176,0,163,255,176,0,164,255,176,0,186,255,206,0,187,255,206,0,188,255,206,0,189,
+    255,206,0,190,255,206,0,191,255,206,0,192,255,206,0,193,255,162,0,194,255,162,0,195,255,162,0,196,255,162,0,197,255,162,0,198,255,162,0,199,255,162,0,200,255,162,0,201,255,162,0,202,
+    255,162,0,203,255,162,0,204,255,206,0,206,255,162,0,207,255,206,0,208,255,206,0,209,255,206,0,210,255,206,0,211,255,188,0,212,255,188,0,213,255,188,0,214,255,188,0,215,255,188,0,216,
+    255,188,0,223,255,216,0,224,255,216,0,225,255,216,0,226,255,216,0,227,255,216,0,228,255,216,0,229,255,216,0,230,255,216,0,231,255,216,0,232,255,216,0,233,255,222,0,234,255,222,0,235,
+    255,222,0,236,255,222,0,237,255,222,0,238,182,14,31,222,208,15,4,241,14,228,0,246,255,228,0,247,255,228,0,248,255,228,0,249,255,162,0,250,255,176,1,8,255,241,1,9,0,15,70,5,145,12,255,
+    171,1,13,255,226,1,14,104,2,241,12,40,1,16,255,236,1,93,255,121,1,215,255,236,1,216,255,236,1,217,255,236,1,218,255,236,1,219,40,7,243,54,162,1,223,255,162,1,224,255,162,1,225,255,
+    162,1,226,255,162,1,227,255,162,1,228,255,162,1,229,255,162,1,230,255,162,1,231,255,162,1,232,255,176,1,233,255,176,1,234,255,176,1,235,255,176,0,3,0,114,0,30,1,9,0,6,1,15,0,40,0,10,
+    188,12,16,214,248,25,1,224,18,113,9,255,185,1,10,255,192,110,5,2,214,3,0,214,5,49,242,0,2,96,7,19,12,162,22,49,196,0,114,4,1,240,4,239,0,239,255,229,1,9,255,198,1,10,255,202,1,15,255,
+    206,0,9,168,11,1,96,0,179,11,255,236,1,12,255,190,1,13,255,222,210,0,80,23,1,16,255,239,150,7,227,0,11,0,114,255,235,1,8,255,216,1,10,255,250,26,5,0,42,0,18,212,78,4,3,42,0,0,24,6,
+    49,88,0,10,178,4,211,162,0,233,255,186,1,8,255,206,1,9,255,164,50,0,19,236,46,1,16,219,122,0,1,46,1,0,86,3,17,1,204,12,240,10,1,1,12,255,216,0,35,0,1,255,231,0,2,255,231,0,3,255,231,
+    0,4,255,231,0,5,220,9,192,255,231,0,7,255,231,0,8,255,231,0,9,254,7,243,19,255,231,0,11,255,231,0,12,255,231,0,13,255,231,0,93,255,216,0,94,255,216,0,95,255,216,0,96,255,216,0,97,255,
+    216,78,13,15,126,4,1,240,22,222,0,115,255,182,0,116,255,182,0,117,255,182,0,118,255,182,0,119,255,182,0,120,255,243,0,121,255,243,0,122,255,243,0,123,255,243,62,5,247,31,0,131,0,15,
+    255,235,0,16,255,235,0,17,255,235,0,18,255,235,0,19,255,235,0,20,255,235,0,36,255,235,0,37,255,235,0,38,255,235,0,39,255,235,0,40,255,235,190,16,241,90,235,0,70,255,235,0,71,255,235,
+    0,72,255,235,0,73,255,235,0,74,255,235,0,75,255,235,0,76,255,235,0,77,255,235,0,78,255,235,0,79,255,235,0,82,255,235,0,93,255,189,0,94,255,189,0,95,255,189,0,96,255,189,0,97,255,189,
+    0,98,255,235,0,99,255,235,0,100,255,235,0,101,255,235,0,102,255,235,0,103,255,235,0,104,255,235,0,105,255,235,0,106,255,235,0,107,255,235,216,14,255,28,109,255,182,0,110,255,182,0,
+    111,255,182,0,112,255,182,0,113,255,182,0,115,255,152,0,116,255,152,0,117,255,152,0,118,255,152,0,119,255,152,0,124,255,235,38,17,36,255,134,235,0,140,255,235,0,141,255,235,0,142,255,
+    235,0,143,255,235,0,144,255,235,0,145,255,235,0,146,255,235,0,147,255,235,0,148,255,235,0,149,255,235,0,150,255,235,0,151,255,235,0,152,255,235,0,153,255,235,0,154,255,235,0,155,255,
+    235,0,156,255,235,0,157,255,235,0,158,255,235,0,193,255,235,0,194,255,235,0,195,255,235,0,196,255,235,0,197,255,235,0,198,255,235,0,199,255,235,0,200,255,235,0,201,255,235,0,202,255,
+    235,0,203,255,235,0,206,255,235,0,211,255,242,0,212,255,242,0,213,255,242,0,214,255,242,0,215,255,242,0,216,255,242,210,3,6,15,158,19,1,241,56,249,255,235,1,114,255,216,1,215,255,235,
+    1,216,255,235,1,217,255,235,1,218,255,235,1,219,255,235,1,222,255,235,1,223,255,235,1,224,255,235,1,225,255,235,1,226,255,235,1,227,255,235,1,228,255,235,1,229,255,235,1,230,255,235,
+    1,231,255,235,0,1,0,114,2,26,0,244,22,49,114,255,222,74,8,0,140,22,48,1,1,173,200,7,1,114,2,0,106,16,17,235,240,16,0,144,22,16,2,92,3,0,78,16,64,0,2,13,166,218,32,179,14,76,16,48,0,
+    47,0,37,0,0,255,24,39,5,186,36,3,9,0,8,24,0,81,255,192,255,212,255,86,37,48,0,0,255,50,34,1,36,0,6,10,0,1,15,0,7,5,0,16,255,130,41,7,16,0,6,11,0,145,255,200,255,229,255,231,0,0,255,
+    114,37,34,255,211,128,0,48,255,216,255,34,5,6,39,0,64,0,0,0,255,200,33,115,0,255,234,0,0,255,244,38,0,16,254,33,0,49,255,237,255,202,37,131,255,152,255,185,255,172,255,250,74,0,240,
+    0,226,0,0,255,236,255,226,255,220,255,199,255,226,255,221,42,0,14,4,0,15,178,0,7,9,44,0,25,14,14,0,7,13,0,0,148,0,71,255,251,255,241,19,0,1,11,0,64,255,239,255,235,9,0,100,255,152,
+    255,188,255,172,58,1,0,110,0,175,255,246,255,229,255,220,255,206,0,0,148,0,5,0,56,0,6,4,0,34,255,242,74,0,6,18,0,15,10,0,9,0,144,0,0,50,114,16,255,170,36,6,41,0,7,192,0,1,34,0,3,26,
+    0,35,255,236,190,1,16,14,165,114,2,21,0,34,255,243,8,0,0,6,0,32,255,249,6,0,8,4,0,3,114,1,18,242,242,0,32,255,175,222,0,9,32,0,121,246,255,232,255,229,255,219,20,0,144,234,255,220,
+    255,242,0,0,255,249,168,44,34,255,237,116,0,0,18,0,64,0,0,255,231,38,150,112,255,242,255,180,255,177,255,98,36,1,148,0,211,0,23,0,0,255,176,255,166,255,156,255,156,0,112,42,0,78,45,
+    2,52,0,64,0,0,255,239,74,1,6,100,0,4,168,0,70,255,242,255,239,22,0,0,10,0,8,138,0,10,52,0,0,30,0,14,4,0,0,60,2,64,255,246,255,247,26,0,8,228,2,0,16,0,0,116,2,48,255,229,255,162,7,2,
+    15,0,15,6,0,4,4,238,1,1,48,0,16,242,112,1,96,255,171,255,195,255,192,148,1,0,94,1,1,8,0,80,236,255,239,255,233,158,0,6,222,1,0,218,2,0,83,0,0,66,1,0,8,0,4,4,0,34,255,245,10,0,242,5,
+    255,232,255,232,255,195,255,222,255,212,0,0,255,230,255,222,0,0,255,165,26,0,1,200,158,0,34,3,18,239,92,1,3,22,0,15,7,0,0,23,255,226,41,15,31,0,0,15,19,0,8,0,184,1,10,31,0,34,255,246,
+    234,0,161,255,152,255,195,255,175,255,236,255,236,62,1,0,170,37,81,0,255,246,255,223,228,2,26,228,52,0,15,14,0,2,20,7,22,0,36,255,236,84,0,0,18,0,0,58,1,32,0,10,56,2,1,10,0,0,19,0,
+    2,220,2,50,246,255,221,122,0,48,0,20,0,162,38,5,130,4,240,1,255,231,255,216,255,231,0,17,0,0,255,180,255,206,255,179,51,0,240,1,255,176,0,11,0,30,0,30,255,162,255,146,255,166,255,176,
+    20,0,1,4,0,6,118,0,81,251,255,246,255,225,20,0,15,5,0,0,101,255,219,255,236,255,216,160,4,3,72,4,1,238,0,1,234,0,2,51,0,2,130,4,15,188,1,12,49,205,255,217,188,1,17,250,188,1,1,174,
+    42,2,62,0,0,6,0,0,186,2,0,162,2,1,218,0,5,156,0,0,26,0,1,4,0,39,7,255,166,44,96,255,206,255,242,255,230,24,0,0,46,0,1,254,2,16,20,26,1,1,18,0,20,242,38,3,0,14,0,15,4,0,13,64,255,192,
+    255,221,142,0,15,40,0,11,64,255,152,255,200,38,0,112,255,143,255,180,255,192,255,170,42,0,110,2,193,222,255,158,255,240,255,195,255,205,255,152,255,148,44,240,23,0,13,255,202,0,0,255,
+    175,0,0,255,146,0,20,0,10,255,232,255,249,255,242,255,176,255,212,255,176,255,182,255,146,0,0,255,185,255,229,160,0,96,255,182,255,177,255,212,46,0,0,122,0,208,255,242,255,198,255,
+    249,255,222,255,217,255,185,255,126,39,49,0,0,10,112,0,2,78,0,48,20,0,20,52,0,160,0,0,255,196,255,242,255,216,255,229,130,0,65,255,172,255,227,60,4,85,172,255,191,255,196,140,6,16,
+    239,64,0,224,255,212,255,212,255,172,255,172,0,13,0,10,0,30,102,0,1,50,0,48,162,0,20,130,4,128,0,23,0,23,255,176,255,226,54,0,32,255,187,128,0,15,4,0,0,4,118,4,3,27,0,70,255,212,255,
+    232,170,3,34,0,9,23,0,48,255,226,255,196,18,1,166,2,0,18,0,0,0,3,0,8,0,11,4,0,7,126,5,99,0,0,255,202,255,222,206,0,7,64,2,4,50,0,0,32,4,0,12,0,0,14,2,0,172,0,1,14,5,0,17,0,2,4,0,2,
+    142,46,208,15,0,15,255,239,255,243,255,221,255,235,255,209,252,3,0,94,7,1,80,2,48,30,0,23,108,120,1,122,3,3,150,7,5,82,3,14,84,2,120,0,255,243,255,236,0,14,182,0,0,234,2,4,74,2,2,115,
+    0,0,70,7,2,10,0,35,255,221,254,5,1,184,0,0,2,6,1,16,0,16,10,206,0,65,255,249,255,249,20,3,48,239,255,252,148,2,3,132,0,0,64,6,16,10,62,0,2,194,3,1,224,2,7,96,6,2,186,0,0,32,0,14,4,
+    0,34,255,207,24,8,2,26,0,7,24,8,3,216,0,2,24,0,0,6,0,0,36,1,16,255,138,15,0,13,0,1,4,0,160,255,236,255,249,255,247,255,219,255,222,140,0,142,255,175,255,202,255,182,255,236,194,4,1,
+    45,0,0,5,0,9,162,1,0,17,0,15,4,0,20,15,56,0,2,65,255,226,255,211,234,0,17,246,200,6,0,100,7,48,219,0,0,172,2,64,0,0,255,189,168,1,130,255,236,255,146,255,175,255,162,208,4,2,108,0,
+    0,14,0,32,255,162,6,0,2,16,0,0,152,121,3,10,0,6,7,0,15,112,0,1,0,212,2,2,24,2,0,142,123,0,44,0,0,48,40,0,8,0,7,4,0,0,90,5,0,216,1,39,255,236,2,5,0,196,3,2,192,2,4,202,2,0,76,0,3,54,
+    0,33,255,162,120,40,3,14,0,2,7,0,0,60,0,0,218,0,0,154,2,2,18,0,9,6,0,2,234,1,16,235,248,6,9,24,0,15,13,0,4,33,255,192,110,2,88,0,255,192,255,156,35,0,0,176,3,0,16,0,65,255,192,255,
+    192,220,4,0,234,46,0,17,0,23,0,30,1,1,16,0,0,5,0,0,20,0,35,255,199,14,5,27,217,74,0,17,219,64,0,48,0,255,206,50,5,17,0,103,123,0,52,0,15,74,0,4,16,176,62,7,32,255,216,150,0,32,255,
+    246,120,8,0,236,0,2,4,0,65,255,249,255,246,48,4,112,246,255,236,255,155,255,182,118,0,2,74,0,15,6,0,5,5,206,7,26,240,34,0,1,52,159,3,19,0,48,255,212,255,168,31,0,136,1,19,192,19,0,
+    7,7,0,16,255,236,46,3,16,0,4,24,4,3,15,0,5,7,0,33,255,239,42,4,0,46,9,48,216,255,196,10,3,5,27,0,12,9,0,22,20,114,10,0,178,3,8,31,0,4,166,7,65,255,235,255,228,148,0,1,226,3,8,34,0,
+    12,12,0,0,254,3,1,80,2,20,243,250,6,1,34,0,5,160,2,48,255,243,255,206,23,0,78,161,18,11,230,3,128,255,192,0,26,0,40,0,14,24,6,0,44,0,0,88,1,0,8,0,1,4,0,49,28,0,59,8,0,0,5,0,16,69,5,
+    0,1,10,54,1,9,0,7,5,0,2,94,0,0,32,0,112,102,0,99,0,72,0,62,7,125,7,32,0,15,11,0,16,68,255,182,255,229,44,6,15,47,0,7,65,255,219,255,204,128,6,1,216,11,16,255,196,46,0,164,1,0,196,10,
+    114,206,255,209,255,219,255,253,208,4,2,66,0,0,92,6,0,48,162,32,255,249,212,0,2,132,1,0,68,2,2,30,0,4,6,0,2,24,0,4,14,0,15,8,0,7,0,120,0,4,30,0,0,80,0,3,12,0,17,2,168,55,32,13,0,61,
+    126,255,18,34,0,13,0,36,0,40,0,33,0,52,0,79,0,38,0,83,0,107,0,66,0,109,0,113,0,91,0,115,0,144,0,96,34,44,2,241,6,205,0,160,0,207,0,232,0,180,0,234,0,238,0,206,0,240,0,253,0,211,52,
+    44,17,225,52,44,17,228,4,44,17,231,4,44,208,232,1,87,1,87,0,235,1,90,1,92,0,236,4,44,32,0,239,4,44,224,0,240,1,99,1,99,0,241,1,101,1,113,0,242,248,43,33,0,255,248,43,17,1,248,43,49,
+    5,0,2,188,57,241,12,11,0,8,0,12,0,13,0,5,0,15,0,20,0,17,0,21,0,24,0,29,0,25,0,34,0,5,184,0,145,24,0,52,0,53,0,46,0,54,22,168,241,32,56,0,61,0,16,0,62,0,68,0,13,0,69,0,78,0,1,0,79,0,
+    79,0,5,0,83,0,86,0,28,0,87,0,92,0,15,0,93,0,97,0,23,0,98,0,107,0,9,232,0,240,2,22,0,115,0,119,0,21,0,120,0,123,0,27,0,124,0,124,72,49,241,61,0,135,0,7,0,136,0,137,0,4,0,138,0,138,0,
+    2,0,139,0,144,0,14,0,146,0,146,0,2,0,147,0,147,0,43,0,149,0,158,0,4,0,159,0,159,0,42,0,160,0,164,0,20,0,165,0,166,0,10,0,167,0,175,0,3,0,176,0,177,0,31,0,178,0,179,0,39,88,45,17,43,
+    70,158,241,22,10,0,193,0,202,0,2,0,203,0,203,0,4,0,204,0,205,0,2,0,207,0,210,0,26,0,211,0,217,0,11,0,218,0,222,0,6,84,1,240,28,18,0,240,0,244,0,12,0,245,0,248,0,25,0,250,0,250,0,19,
+    0,251,0,251,0,6,0,252,0,252,0,42,0,253,0,253,0,3,0,255,0,255,0,6,63,59,208,0,12,1,1,1,1,0,3,1,3,1,3,0,4,57,145,4,0,6,1,5,1,5,0,12,138,1,209,34,1,81,1,81,0,44,1,82,1,83,0,32,144,1,209,
+    32,1,90,1,91,0,34,1,92,1,92,0,44,150,1,17,33,150,1,17,33,150,1,240,63,33,1,101,1,103,0,30,1,104,1,104,0,41,1,105,1,105,0,40,1,106,1,106,0,41,1,107,1,107,0,40,1,108,1,108,0,38,1,109,
+    1,109,0,37,1,110,1,110,0,36,1,111,1,111,0,37,1,112,1,112,0,36,1,113,1,113,0,38,1,171,1,172,0,35,1,215,1,218,0,210,1,241,4,220,0,3,1,221,1,221,0,31,1,232,1,235,0,19,1,236,1,239,250,
+    161,113,68,0,1,0,13,0,6,222,1,17,2,216,1,17,11,216,1,0,62,130,241,0,53,0,36,0,69,0,79,0,2,0,82,0,82,0,2,192,1,17,14,192,1,17,21,192,1,17,10,192,1,17,20,192,1,17,19,192,1,17,23,192,
+    1,113,2,0,125,0,137,0,5,186,1,113,4,0,139,0,158,0,1,168,1,17,12,168,1,17,18,168,1,17,4,168,1,17,9,168,1,113,25,0,178,0,185,0,4,162,1,83,7,0,193,0,203,194,59,144,7,0,205,0,205,0,4,0,
+    206,106,130,1,168,1,209,7,0,211,0,216,0,13,0,217,0,217,0,4,174,1,113,3,0,223,0,232,0,8,180,1,17,16,180,1,17,15,180,1,113,22,0,249,0,249,0,1,186,1,17,17,186,1,113,3,0,252,1,2,0,12,32,
+    3,17,3,150,1,17,28,150,1,17,35,150,1,17,26,150,1,17,26,150,1,17,28,150,1,241,4,35,1,96,1,96,0,27,1,98,1,98,0,27,1,100,1,100,0,27,150,1,17,24,150,1,17,34,150,1,17,33,150,1,17,34,150,
+    1,17,33,150,1,17,32,150,1,17,31,150,1,17,30,150,1,17,31,150,1,17,30,150,1,17,32,104,3,209,29,1,215,1,219,0,2,1,220,1,220,0,9,150,1,113,25,1,222,1,231,0,1,156,1,17,17,156,1,0,190,166,
+    0,0,60,91,10,1,86,2,148,112,60,0,34,17,4,112,60,17,228,112,60,17,228,112,60,17,228,112,60,17,96,112,60,17,140,112,60,17,184,112,60,16,228,112,60,33,1,14,112,60,1,166,51,0,60,60,129,
+    0,4,0,5,0,6,0,11,222,3,0,46,60,215,16,0,17,0,18,0,19,0,20,0,21,0,22,44,0,4,42,0,31,7,44,0,24,31,8,44,0,24,31,9,44,0,10,0,174,55,6,132,0,15,174,0,23,0,30,22,0,184,4,14,218,0,112,23,
+    97,97,108,116,0,140,212,150,241,23,0,148,99,99,109,112,0,154,100,108,105,103,0,160,100,110,111,109,0,166,102,114,97,99,0,172,108,105,103,97,0,200,108,111,99,108,0,206,6,0,17,212,6,
+    0,17,218,6,0,16,224,1,155,240,0,0,230,111,114,100,110,0,236,112,110,117,109,0,242,115,84,0,241,32,248,115,105,110,102,0,254,115,115,48,49,1,4,115,115,48,50,1,14,115,115,48,51,1,24,
+    115,115,48,52,1,34,115,117,98,115,1,44,115,117,112,115,1,50,116,110,117,109,252,55,2,0,62,66,0,0,1,0,164,55,2,16,0,0,246,9,0,198,61,0,168,63,241,6,13,0,15,0,17,0,19,0,21,0,23,0,25,
+    0,27,0,29,0,31,0,33,84,7,0,150,63,0,58,0,17,5,228,52,1,54,55,0,246,131,1,42,62,0,24,0,0,80,15,16,1,6,20,17,0,123,134,32,0,1,96,134,160,0,1,0,48,0,6,0,1,0,43,35,0,1,10,0,81,44,0,0,1,
+    1,10,0,81,45,0,0,1,2,10,0,66,46,0,0,1,132,2,0,32,13,17,1,22,13,241,88,1,0,39,0,49,0,100,1,50,1,228,2,38,2,38,2,98,2,64,2,64,2,98,9,22,2,118,6,88,6,144,2,172,4,214,4,234,6,88,5,4,6,
+    88,5,32,6,88,5,62,6,88,5,94,6,88,5,128,6,88,5,164,6,88,5,202,6,88,5,242,6,88,6,28,6,88,6,102,6,144,6,158,6,192,6,216,6,230,7,36,7,112,8,90,8,160,8,194,8,228,8,248,9,22,248,2,0,196,
+    0,240,83,2,0,100,0,47,0,124,1,215,1,216,1,217,1,218,1,219,0,92,0,97,0,249,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,0,250,1,232,1,233,1,234,1,235,0,171,0,216,0,251,
+    1,236,1,237,1,239,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,212,1,213,1,183,1,240,1,246,1,243,1,252,63,242,81,47,0,36,0,37,0,38,0,39,0,40,0,82,0,90,0,96,0,125,0,126,0,127,0,
+    128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,160,0,161,0,162,0,163,0,164,0,167,0,214,0,218,0,219,0,220,0,222,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,97,1,98,1,171,1,
+    190,1,198,1,241,1,242,0,70,1,0,188,63,240,16,154,0,11,0,28,0,34,0,46,0,58,0,70,0,82,0,94,0,106,0,118,0,130,0,142,0,2,0,222,1,238,184,62,240,53,1,28,1,38,1,48,1,58,0,5,1,19,1,29,1,39,
+    1,49,1,59,0,5,1,20,1,30,1,40,1,50,1,60,0,5,1,21,1,31,1,41,1,51,1,61,0,5,1,22,1,32,1,42,1,52,1,62,0,5,1,23,1,33,1,43,1,53,1,63,252,62,241,39,1,34,1,44,1,54,1,64,0,5,1,25,1,35,1,45,1,
+    55,1,65,0,5,1,26,1,36,1,46,1,56,1,66,0,5,1,27,1,37,1,47,1,57,1,67,0,2,0,2,0,221,0,221,0,0,106,52,0,10,2,112,0,0,2,0,10,0,28,168,19,129,0,1,0,74,0,1,0,46,254,64,19,3,18,0,113,56,0,2,
+    0,20,0,28,20,0,160,4,0,1,0,2,1,197,1,198,0,50,166,16,184,67,136,1,24,0,2,194,1,17,10,232,4,16,221,36,0,1,206,168,6,220,1,49,14,0,4,208,1,113,216,0,222,0,1,0,4,122,1,16,214,208,135,
+    1,206,2,0,48,1,17,6,92,0,0,236,65,6,54,0,240,12,30,0,12,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,212,1,213,200,0,1,194,0,113,0,1,97,1,98,0,10,118,13,1,134,0,192,2,48,0,24,
+    0,16,0,24,0,2,0,40,254,177,16,1,132,66,21,1,48,0,80,1,1,93,1,93,210,135,241,35,0,23,0,48,0,78,0,108,0,136,0,164,0,190,0,216,0,240,1,8,1,30,1,52,1,72,1,92,1,110,1,128,1,144,1,160,1,
+    174,1,188,1,200,1,212,1,222,1,232,0,11,58,67,0,1,8,8,4,0,0,239,76,2,235,9,31,1,34,0,6,0,104,16,8,52,0,2,12,0,8,58,0,31,10,92,0,0,0,30,4,29,9,24,0,8,54,0,15,30,0,1,0,96,136,2,96,0,4,
+    6,0,8,50,0,0,106,1,4,24,0,0,8,0,0,100,0,25,7,100,0,8,46,0,12,26,0,17,0,46,4,0,56,0,0,4,0,8,42,0,0,100,4,0,20,0,0,4,0,0,84,0,0,210,58,0,12,0,0,120,1,0,208,1,0,34,1,25,1,22,0,0,175,64,
+    14,34,0,2,4,2,0,54,0,0,100,137,0,32,0,8,102,0,17,3,170,0,0,96,0,0,22,0,0,4,0,0,88,0,0,219,4,0,12,0,0,24,0,0,58,0,6,112,0,0,14,0,0,30,0,0,72,0,2,4,0,0,184,15,0,32,0,0,42,2,80,1,0,6,
+    255,231,82,0,37,1,93,62,2,1,192,3,97,4,50,0,1,1,96,216,2,27,16,26,0,113,24,0,2,1,60,1,70,28,0,26,18,28,0,96,3,252,0,3,1,32,164,3,1,30,0,27,20,30,0,81,222,0,4,1,2,2,0,0,232,59,59,0,
+    0,22,32,0,83,190,0,5,0,226,2,0,0,118,48,59,0,0,24,34,0,85,156,0,6,0,192,2,0,17,202,102,0,27,26,36,0,87,120,0,7,0,156,2,0,17,166,38,0,27,28,38,0,89,82,0,8,0,118,2,0,17,128,40,0,27,30,
+    40,0,91,42,0,9,0,78,2,0,17,88,42,0,27,32,42,0,0,226,2,29,36,2,0,2,72,4,17,34,44,4,49,48,1,57,236,3,32,1,1,134,10,0,150,1,119,8,0,1,2,196,0,40,74,0,96,1,0,18,0,1,2,166,20,0,164,1,17,
+    36,180,3,81,38,1,47,0,0,236,56,0,36,3,4,56,0,48,140,0,30,252,26,1,254,6,51,1,0,20,8,0,128,4,1,180,0,3,0,193,1,124,70,49,1,0,63,170,0,4,234,1,17,246,134,0,49,18,1,27,134,0,4,72,0,55,
+    68,0,10,72,0,17,46,10,5,0,78,0,0,98,68,112,2,0,240,0,3,0,8,250,14,16,1,82,60,113,167,1,4,0,2,0,218,46,13,17,240,228,4,55,159,0,218,62,0,17,62,134,0,209,6,0,14,0,22,0,30,0,36,0,42,0,
+    48,56,12,49,159,0,167,132,171,160,159,0,180,0,252,0,2,0,159,1,152,2,32,167,1,138,5,48,180,0,255,84,0,0,134,2,35,0,159,112,5,0,164,3,145,180,0,29,0,64,0,68,0,72,190,69,241,2,84,0,88,
+    0,92,0,96,0,100,0,104,0,108,0,112,0,116,194,69,241,0,128,0,132,0,136,0,140,0,144,0,148,0,152,0,156,112,11,81,168,0,172,0,176,92,71,96,1,1,215,0,1,1,240,35,49,217,0,1,24,12,0,18,69,
+    128,249,0,1,1,222,0,1,1,206,63,128,224,0,1,1,225,0,1,1,88,36,192,227,0,1,1,228,0,1,1,229,0,1,1,152,64,0,24,3,16,250,164,10,48,0,1,1,42,64,17,234,122,63,16,1,58,71,241,11,1,236,0,1,
+    1,237,0,1,1,238,0,1,1,239,0,1,1,183,0,1,1,240,0,2,0,7,76,12,17,0,64,12,113,5,0,125,0,135,0,6,148,0,17,17,188,11,179,22,1,171,1,171,0,27,1,190,1,190,76,6,0,154,1,0,164,5,22,17,246,7,
+    15,240,7,3,33,1,183,196,10,0,58,15,17,0,88,0,17,5,76,0,21,16,224,1,87,2,0,16,0,5,22,8,0,14,4,0,38,14,0,230,1,0,4,0,4,34,0,2,42,8,48,238,1,239,12,2,1,150,0,0,30,0,0,4,0,0,116,1,49,6,
+    1,137,136,1,23,82,88,0,53,12,0,3,60,8,19,3,228,7,0,156,2,0,188,0,0,60,7,16,20,74,0,2,136,6,175,0,0,1,244,0,50,2,169,0,11,4,0,21,64,3,172,0,6,4,0,143,2,139,0,81,2,247,0,39,4,0,2,117,
+    228,0,81,2,228,0,13,8,0,63,81,0,81,4,0,18,124,55,0,81,3,14,0,39,4,0,194,2,230,0,81,2,230,0,3,1,34,0,81,4,0,241,15,255,248,1,34,255,245,1,34,0,75,1,34,0,1,1,34,0,11,1,34,0,54,1,34,255,
+    229,2,40,0,20,4,0,49,162,0,81,4,0,31,26,4,0,2,127,16,3,116,0,81,2,246,4,0,3,79,3,18,0,39,4,0,17,128,4,108,0,39,2,127,0,81,4,0,0,48,0,73,2,158,0,81,4,0,63,80,0,29,4,0,2,61,78,0,17,4,
+    0,63,219,0,76,4,0,18,124,188,0,10,4,11,0,15,4,0,141,2,169,0,17,2,129,0,10,4,0,56,76,0,31,4,0,143,3,8,0,39,2,36,0,41,4,0,21,34,3,121,4,0,143,2,107,0,63,2,38,0,34,4,0,2,83,107,0,34,2,
+    84,8,0,0,4,0,31,45,4,0,19,0,76,42,77,2,102,0,35,4,0,241,0,77,0,63,2,77,0,0,0,248,0,49,0,248,0,63,120,36,240,12,248,255,225,0,248,0,55,0,248,255,237,0,248,255,247,0,248,0,30,0,248,255,
+    209,0,248,255,201,4,0,64,2,26,0,65,4,0,41,0,251,4,0,49,59,1,127,16,0,49,11,3,117,84,0,0,88,0,14,4,0,0,188,0,15,4,0,16,33,3,200,228,0,17,63,12,1,115,107,0,34,1,137,0,63,4,0,159,56,1,
+    137,0,59,1,207,0,25,4,0,1,140,2,83,0,63,1,84,0,14,4,0,79,2,71,0,57,4,0,18,124,24,0,7,3,29,0,12,4,0,140,2,1,0,10,2,17,0,7,4,0,72,1,217,0,37,4,0,240,34,2,108,0,34,2,41,0,20,1,99,0,14,
+    2,150,0,14,3,148,0,14,3,145,0,14,2,133,0,14,3,63,0,14,2,81,0,14,2,78,0,14,2,101,0,14,2,159,0,14,3,16,0,241,28,145,0,63,2,131,0,15,2,193,0,43,1,142,0,34,2,77,0,37,2,57,0,20,2,134,0,
+    28,2,88,0,41,2,108,0,36,2,26,0,7,2,129,0,42,12,0,240,20,148,0,37,2,148,0,89,2,148,0,73,2,148,0,61,2,148,0,28,2,148,0,66,2,148,0,56,2,148,0,67,2,148,0,51,12,0,241,21,1,171,0,25,0,254,
+    0,20,1,103,0,24,1,100,0,20,1,130,0,19,1,106,0,18,1,130,0,24,1,84,0,17,1,128,0,24,12,0,241,20,111,0,31,0,227,0,16,1,56,0,22,1,42,0,19,1,71,0,13,1,59,0,25,1,76,0,27,1,25,0,13,1,69,0,
+    28,12,0,15,40,0,21,27,170,120,0,31,123,120,0,3,240,53,0,163,255,52,2,230,0,16,2,195,0,16,2,226,0,19,2,243,0,16,3,18,0,19,3,35,0,25,2,217,0,13,1,164,0,24,3,167,0,24,1,151,0,0,1,77,0,
+    59,1,178,0,59,1,55,0,74,1,35,0,64,3,21,0,64,1,64,0,78,4,0,64,2,207,0,41,20,0,64,2,42,0,32,4,0,0,40,0,35,0,244,44,0,240,32,151,0,0,2,33,0,60,1,93,0,45,1,93,0,5,1,50,0,67,1,50,0,5,1,
+    52,0,45,1,52,0,0,4,187,0,69,3,209,0,69,1,189,0,62,2,210,0,40,4,0,35,1,196,4,0,53,223,0,63,4,0,23,25,4,0,177,14,0,0,2,62,0,44,2,200,0,57,116,4,243,4,106,0,18,2,113,0,48,2,138,0,27,2,
+    145,0,20,2,148,0,80,4,0,19,93,8,0,4,16,0,15,8,0,9,241,14,62,3,76,0,35,3,131,0,46,1,188,0,30,2,188,0,47,2,193,0,81,2,61,0,41,2,220,0,0,188,2,243,18,133,0,50,3,191,0,34,5,98,0,34,3,59,
+    0,60,3,84,0,60,3,206,0,60,3,82,0,60,3,55,0,60,3,85,16,0,210,66,0,60,4,104,0,60,2,158,0,60,3,128,4,0,99,2,129,0,60,3,62,4,0,83,198,0,60,3,199,24,0,242,10,194,0,37,3,176,0,47,2,224,0,
+    46,2,91,0,27,1,227,0,32,3,53,0,40,1,250,4,0,193,2,138,0,26,1,56,0,24,1,80,0,121,4,0,240,9,78,0,22,1,80,0,22,3,11,0,60,5,4,0,81,2,5,0,66,0,189,0,42,2,62,45,241,8,166,0,56,0,226,0,43,
+    1,20,0,47,1,21,0,42,1,183,0,41,1,130,0,40,4,0,241,16,165,0,54,1,77,0,38,1,174,0,44,1,132,0,60,0,212,0,41,0,212,0,40,1,3,0,33,2,40,0,40,48,0,0,36,0,0,48,0,49,3,0,33,52,0,8,80,0,0,76,
+    0,0,56,0,52,234,0,44,72,0,192,0,222,0,43,0,222,0,5,6,203,0,75,108,5,9,4,0,51,18,0,39,208,4,17,201,148,3,0,152,3,15,4,0,13,48,41,0,20,188,3,4,4,0,64,1,95,0,14,200,3,4,4,0,240,17,2,57,
+    1,51,2,70,0,28,1,11,0,20,1,128,0,20,2,255,0,15,1,121,0,20,2,40,255,196,0,226,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,
+    3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,168,168,168,147,147,147,23,23,23,218,218,218,216,216,216,237,237,237,142,142,142,17,17,17,103,103,103,248,248,248,140,140,140,58,58,58,86,
+    86,86,104,104,104,112,112,112,0,0,0,37,37,37,73,73,73,146,146,146,109,109,109,219,219,219,254,254,254,254,254,254,10,10,10,126,126,126,113,113,113,226,226,226,26,26,26,41,41,41,55,
+    55,55,71,71,71,104,104,104,86,86,86,216,216,216,107,107,107,217,217,217,36,36,36,72,72,72,104,104,104,146,146,146,35,35,35,69,69,69,217,217,217,36,36,36,69,69,69,71,71,71,109,109,109,
+    68,68,68,27,27,27,34,34,34,34,34,34,71,71,71,103,103,103,104,104,104,107,107,107,35,35,35,145,145,145,8,8,8,122,122,122,214,214,214,213,213,213,10,10,10,10,10,10,136,136,136,97,208,
+    121,50,0,0,0,64,116,82,78,83,28,96,95,39,97,162,152,140,96,203,210,43,45,146,215,0,253,253,253,253,253,1,253,253,2,254,254,16,12,15,174,78,13,148,175,209,177,209,45,207,146,47,179,
+    208,113,144,207,78,45,82,113,20,18,109,143,45,177,50,48,78,110,175,209,48,112,139,16,164,0,0,10,172,73,68,65,84,120,218,237,221,105,91,219,56,20,134,97,103,3,10,116,68,9,78,21,178,
+    19,182,164,129,0,33,144,1,6,254,255,191,26,59,139,109,57,150,105,83,7,34,241,188,95,58,87,233,208,150,187,71,203,145,108,28,65,172,142,195,151,0,96,2,48,1,152,0,76,0,38,0,19,128,1,
+    38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,76,0,
+    6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,53,249,124,254,95,128,237,229,125,253,233,101,27,96,91,125,127,206,178,13,176,
+    157,249,111,14,252,83,63,74,223,220,93,222,61,2,108,102,254,93,248,234,75,120,251,192,203,175,60,192,134,3,255,167,249,21,119,7,179,228,1,54,27,248,85,51,62,207,125,15,126,213,0,54,
+    122,14,254,153,79,45,224,131,131,91,128,77,204,118,58,112,227,20,96,59,182,73,154,73,248,241,87,0,252,8,176,133,147,240,109,224,251,171,14,176,145,121,253,153,182,19,190,12,128,47,
+    89,69,111,108,220,105,86,89,101,213,194,17,154,109,210,230,250,42,63,232,39,225,237,212,17,186,6,240,230,254,21,138,165,82,177,160,17,78,93,101,133,35,244,169,0,120,83,235,55,87,241,
+    243,77,39,28,76,194,175,255,166,140,208,183,0,111,170,239,115,101,150,111,78,178,112,202,36,252,24,142,208,55,0,111,232,250,74,150,42,233,194,41,147,240,221,23,24,161,77,7,22,133,111,
+    11,224,74,41,113,148,214,79,194,181,176,141,117,7,176,1,192,149,146,155,32,172,111,117,4,7,13,7,7,55,0,111,42,176,83,170,84,210,107,88,219,234,136,140,208,53,128,55,86,184,88,137,10,
+    39,204,195,218,243,134,47,49,66,27,15,236,186,37,69,88,46,9,235,86,89,55,239,31,52,220,94,154,127,155,199,252,125,112,76,184,17,23,214,221,234,120,183,141,85,187,180,161,188,141,239,
+    100,73,117,26,174,20,151,186,150,175,201,171,172,247,14,26,110,78,173,104,130,216,208,139,126,139,9,187,154,86,135,82,193,239,181,177,2,223,131,211,58,192,159,189,148,254,150,38,156,
+    79,92,100,61,166,143,208,145,25,218,236,77,148,13,231,193,113,225,92,76,120,59,105,10,190,73,29,161,111,35,190,102,95,246,176,226,192,95,237,119,44,11,251,207,175,188,198,58,149,225,
+    16,157,48,66,223,30,28,0,188,97,194,81,224,227,162,183,246,82,151,210,203,15,160,221,233,251,208,170,175,217,151,61,44,185,178,19,107,120,84,116,135,135,203,203,232,211,229,250,204,
+    43,190,134,159,52,217,114,39,43,222,210,250,13,96,113,123,121,122,122,87,179,219,215,158,75,119,139,147,255,74,250,249,127,108,34,78,248,185,109,197,247,148,78,214,230,8,151,254,24,
+    88,59,112,219,177,7,182,11,216,19,237,252,61,176,234,123,105,254,49,147,69,192,82,52,74,127,52,7,39,12,217,49,95,11,110,195,219,116,241,221,21,139,11,60,165,213,10,56,114,199,195,154,
+    83,68,171,158,108,112,133,83,212,29,11,127,81,95,3,129,93,55,77,88,20,138,197,130,88,109,128,190,181,208,215,56,96,159,87,255,160,202,66,127,181,5,150,82,192,182,60,203,98,24,176,39,
+    231,200,153,164,171,35,118,87,220,32,41,192,214,60,171,100,22,176,127,186,223,239,119,158,157,84,99,241,247,192,246,60,139,230,152,85,191,207,71,199,94,142,186,157,151,66,59,115,227,
+    59,27,31,116,112,140,242,117,142,142,143,252,120,198,71,253,23,199,201,216,120,94,194,191,108,122,218,223,40,96,183,51,243,157,33,251,198,207,51,99,153,205,111,112,115,105,75,123,195,
+    72,96,87,140,186,17,224,89,33,119,23,19,114,54,191,199,227,237,173,101,79,57,24,5,124,31,3,14,140,11,153,9,91,23,163,22,89,237,206,18,240,194,216,17,18,76,243,23,89,185,163,36,225,
+    233,132,92,160,134,109,216,38,21,181,194,221,123,132,205,111,116,8,145,235,119,167,155,164,229,228,214,11,44,229,172,211,2,240,186,83,120,238,36,26,191,172,15,120,134,43,26,13,42,248,
+    3,70,105,255,15,157,100,188,38,224,5,110,47,127,213,108,94,237,1,188,246,200,105,235,106,84,120,233,31,41,19,178,147,57,240,220,86,140,122,131,171,179,31,179,228,77,155,233,141,60,
+    240,159,181,39,29,207,56,40,228,227,78,221,93,3,110,253,113,56,104,46,112,231,194,18,224,15,52,46,78,7,235,227,163,78,246,5,236,143,202,138,237,52,205,58,21,252,161,198,254,132,220,
+    233,60,143,50,254,228,145,81,89,205,217,8,224,15,52,150,174,178,250,202,42,55,205,31,186,156,53,0,254,248,66,206,248,236,191,174,247,253,209,4,216,244,72,49,212,251,254,24,178,77,50,
+    126,72,16,87,122,95,227,190,133,26,192,9,209,141,208,103,77,243,238,106,1,156,48,68,95,37,226,14,134,123,6,254,109,0,78,0,206,199,23,86,87,131,94,99,254,49,128,109,200,85,164,112,175,
+    134,123,179,222,134,52,242,74,1,192,73,105,228,253,46,199,153,95,184,38,227,2,156,66,60,28,46,70,101,179,239,2,25,255,174,74,215,205,252,9,7,17,244,197,164,249,23,189,76,238,69,203,
+    64,118,13,71,120,82,218,113,139,207,49,183,112,103,127,254,226,203,139,83,231,58,150,69,192,65,225,58,30,110,191,235,31,6,247,223,16,182,3,56,40,220,66,161,216,241,111,116,204,142,
+    251,143,191,157,35,108,3,240,20,241,254,233,249,165,212,61,82,238,100,29,23,1,182,162,130,157,194,115,167,223,93,20,110,4,184,239,32,108,1,112,46,28,149,227,215,222,1,54,30,216,173,
+    109,233,30,107,160,130,45,0,246,31,91,209,134,57,216,130,10,150,253,99,173,111,41,219,2,150,194,138,38,150,81,192,174,40,244,147,159,29,245,126,182,148,249,46,169,29,64,3,252,81,192,
+    206,18,240,244,117,44,253,78,209,201,184,87,89,27,54,155,205,65,175,62,237,170,0,252,113,115,240,241,18,238,75,209,105,7,27,228,172,210,152,159,6,55,7,195,134,249,117,108,16,176,211,
+    61,14,71,229,110,167,88,152,253,217,51,62,76,114,197,32,114,79,231,106,118,77,199,224,9,217,164,125,112,161,59,179,245,223,132,38,231,184,50,243,213,115,67,125,162,193,116,99,163,26,
+    29,78,177,211,241,70,229,251,121,225,174,99,103,36,69,47,225,178,251,160,87,19,134,190,231,197,172,119,116,44,254,99,61,184,51,224,228,91,239,222,132,92,167,130,215,46,60,141,92,111,
+    37,245,180,79,37,13,234,0,219,16,253,115,13,205,58,192,22,228,81,255,232,217,192,188,121,216,30,96,233,37,155,47,127,99,112,166,27,165,107,84,240,231,46,192,50,42,176,198,222,32,185,
+    140,123,0,127,150,175,204,121,201,232,101,104,254,39,169,247,98,47,231,152,86,48,192,159,52,60,139,167,201,161,151,139,172,110,223,77,219,26,141,189,97,236,61,14,6,174,178,172,0,110,
+    139,183,139,195,195,76,133,23,173,171,186,98,60,52,175,49,109,3,176,35,156,185,239,225,225,86,230,7,195,162,30,76,200,3,246,193,159,51,255,62,5,190,135,23,89,151,216,108,101,190,55,
+    184,106,94,245,4,192,159,226,219,218,61,12,129,87,188,219,33,83,30,85,49,250,114,135,5,21,188,115,24,201,238,104,181,127,36,239,109,178,36,207,7,111,132,239,225,138,47,21,110,180,198,
+    227,86,205,198,155,123,134,191,8,77,136,156,226,59,89,109,132,222,63,41,151,171,229,147,115,11,191,47,128,209,192,82,212,99,190,79,43,249,222,159,84,203,94,170,215,22,10,59,70,251,
+    182,183,20,223,173,149,110,87,74,49,158,250,250,194,247,214,9,59,38,251,202,152,239,40,238,251,155,220,39,115,224,114,245,164,109,219,60,236,24,236,235,76,84,223,134,90,126,211,91,
+    31,191,83,144,245,0,216,19,110,80,193,155,178,190,138,249,126,95,214,108,251,59,27,247,15,42,216,19,126,168,3,188,25,190,79,170,239,206,146,239,121,110,114,49,201,141,222,237,105,72,
+    209,10,129,203,229,135,26,192,155,224,171,174,175,118,199,203,255,0,102,253,203,45,25,171,225,132,239,17,222,120,80,132,1,222,4,96,117,125,213,90,26,137,71,19,221,241,195,254,78,235,
+    60,246,201,70,39,81,225,29,155,22,90,142,161,190,247,23,106,255,202,137,175,192,194,13,242,147,58,118,127,247,13,79,246,213,79,215,139,9,183,1,254,236,21,86,4,248,98,201,87,169,240,
+    92,4,216,173,127,175,86,167,171,101,101,75,37,197,249,117,100,161,85,30,219,35,108,42,176,140,156,16,238,36,108,134,218,137,192,222,122,106,129,56,86,198,97,79,248,159,136,112,181,
+    101,77,195,195,252,57,120,119,121,254,245,175,240,28,38,13,209,174,120,8,154,86,106,75,163,45,206,203,209,26,182,70,216,80,96,41,122,243,67,224,221,253,132,37,81,116,10,158,40,146,
+    225,92,27,235,59,183,197,48,42,124,109,203,155,183,76,221,7,75,177,63,21,222,234,37,150,90,99,146,120,128,24,86,112,217,155,103,101,236,43,161,10,239,219,33,108,112,39,171,157,203,
+    229,158,106,73,190,82,188,133,35,244,91,228,87,132,231,10,229,234,67,28,80,138,29,69,184,103,133,176,185,189,232,148,91,24,209,17,250,226,94,93,75,133,93,231,218,242,103,28,71,246,
+    74,85,59,26,30,70,191,78,88,127,143,42,92,67,43,125,14,175,236,23,219,161,106,57,105,12,30,71,75,184,109,195,66,203,198,135,207,92,113,191,155,184,11,22,202,201,81,226,66,57,90,195,
+    231,0,111,234,2,76,25,161,93,197,254,65,63,9,251,169,69,218,210,0,111,108,162,35,116,204,190,21,78,194,137,255,235,40,216,41,159,88,113,112,104,33,176,55,209,94,232,70,104,111,119,
+    85,14,90,29,163,132,18,118,131,11,90,150,156,57,88,8,172,140,208,111,241,97,182,113,93,77,29,130,165,39,92,174,86,171,215,59,236,131,55,182,130,195,17,122,34,151,62,24,78,194,227,196,
+    57,214,99,109,141,31,198,61,75,190,26,54,206,193,250,53,244,180,213,241,222,70,55,219,103,201,1,206,126,132,142,180,177,206,151,129,195,86,199,181,238,121,113,41,215,253,42,31,128,
+    255,102,132,142,28,52,36,60,169,164,180,58,236,123,146,225,11,12,209,237,73,250,147,74,239,180,58,0,222,244,17,250,60,249,160,33,156,132,131,85,214,247,47,240,158,120,11,129,159,82,
+    159,6,87,90,29,53,1,176,129,21,188,27,182,177,100,194,20,29,92,191,242,207,124,37,192,230,45,178,38,41,35,180,120,255,188,1,224,77,7,94,188,178,99,75,243,241,7,128,13,207,219,238,244,
+    178,101,77,51,134,7,147,48,192,166,102,180,147,203,61,105,63,186,55,159,132,227,55,43,1,54,103,161,149,254,209,214,244,68,201,191,253,204,54,201,84,98,153,242,13,113,92,177,115,237,
+    17,255,211,18,95,32,95,244,125,209,163,86,171,117,47,0,182,53,9,143,144,2,108,151,112,102,111,15,7,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,
+    0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,2,48,1,
+    152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,98,82,254,7,93,42,34,124,0,87,178,193,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,
+    82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,158,158,158,220,220,220,146,146,146,213,213,213,139,139,139,41,41,41,231,231,231,105,105,105,17,17,17,60,60,60,10,
+    10,10,110,110,110,142,142,142,236,236,236,0,0,0,37,37,37,73,73,73,146,146,146,219,219,219,109,109,109,254,254,254,10,10,10,254,254,254,126,126,126,113,113,113,226,226,226,56,56,56,
+    24,24,24,36,36,36,72,72,72,107,107,107,216,216,216,68,68,68,69,69,69,71,71,71,103,103,103,87,87,87,217,217,217,38,38,38,34,34,34,107,107,107,145,145,145,145,145,145,35,35,35,215,215,
+    215,34,34,34,109,109,109,9,9,9,72,72,72,68,68,68,101,101,101,105,105,105,251,251,251,104,104,104,8,8,8,26,26,26,37,37,37,70,70,70,214,214,214,90,90,90,121,121,121,9,9,9,10,10,10,36,
+    36,36,129,161,156,184,0,0,0,64,116,82,78,83,31,97,92,34,157,79,154,87,168,48,210,153,222,204,0,253,253,253,253,253,1,253,253,3,254,254,15,16,203,206,144,174,48,113,175,80,14,207,15,
+    111,175,175,208,144,145,78,209,109,16,77,48,112,208,17,45,45,47,141,108,44,40,79,140,177,36,226,214,106,0,0,10,91,73,68,65,84,120,218,237,221,105,83,226,74,24,134,225,176,163,206,201,
+    136,244,216,44,138,34,12,2,42,34,136,27,46,255,255,95,157,4,129,116,66,7,45,138,17,186,185,159,47,83,117,152,242,84,121,205,251,246,154,224,184,196,234,56,252,10,0,38,0,19,128,9,192,
+    4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,
+    19,128,9,192,4,96,128,9,192,4,96,2,48,1,152,0,76,0,6,152,0,76,0,38,0,19,128,9,192,4,96,128,9,192,4,96,243,34,4,192,150,235,238,4,241,110,2,251,178,45,249,249,39,192,54,250,58,137,179,
+    191,103,47,206,14,8,59,187,233,123,118,84,246,114,182,3,194,182,2,75,47,177,192,149,235,242,145,159,114,182,74,5,155,60,67,22,49,5,156,58,154,37,105,125,9,91,9,236,161,157,231,146,
+    78,236,167,137,57,112,2,96,35,125,155,7,191,10,133,66,90,63,196,10,247,101,230,91,126,1,216,200,57,84,167,48,73,186,162,91,234,122,192,101,42,216,228,249,149,155,44,76,163,29,98,133,
+    123,13,176,209,169,166,103,192,93,199,149,0,91,151,254,175,66,80,194,203,129,29,128,13,76,101,94,193,133,174,212,9,158,77,129,203,71,186,10,159,44,179,252,0,188,173,147,172,92,161,
+    16,63,10,11,119,52,7,254,155,138,153,103,47,89,70,3,188,249,73,214,121,208,163,187,163,168,147,55,201,254,59,7,118,244,179,48,39,145,120,73,218,209,190,237,92,7,167,151,148,112,8,184,
+    169,65,156,108,85,123,237,219,142,157,106,27,129,165,59,232,206,129,59,81,67,233,58,243,125,142,51,77,139,150,179,127,0,113,13,28,224,45,136,82,194,185,136,146,80,129,117,243,171,209,
+    108,146,109,197,62,151,165,123,209,175,65,9,167,251,209,15,231,103,13,229,235,69,65,101,167,90,231,15,240,246,141,194,185,240,82,72,21,188,94,88,37,41,35,180,215,163,71,230,151,176,
+    157,192,222,56,26,0,167,171,177,37,186,176,145,37,68,42,216,5,177,226,66,128,165,99,176,112,15,2,225,70,168,78,213,195,164,69,96,229,40,241,232,136,49,120,139,75,120,47,88,11,167,43,
+    34,108,24,187,21,45,149,6,237,207,177,5,192,70,148,112,104,71,90,198,159,53,120,51,232,179,114,80,192,41,214,193,27,103,148,82,196,149,240,248,151,186,22,86,233,3,224,200,46,136,210,
+    189,173,57,105,114,204,46,83,119,201,245,245,216,237,172,179,152,195,36,111,1,245,247,40,104,208,35,1,240,166,211,124,125,109,186,250,3,33,233,54,2,224,78,104,45,172,2,75,181,65,59,
+    225,6,45,93,128,55,155,100,183,80,232,38,101,140,68,85,41,97,69,82,184,89,253,89,67,184,65,219,114,91,203,100,224,41,96,231,85,91,196,50,124,106,216,12,28,147,218,141,172,72,131,118,
+    56,15,222,244,66,40,25,240,245,181,35,113,165,19,115,179,227,186,92,94,40,96,33,250,74,131,182,226,156,193,108,224,208,110,100,218,209,20,177,80,254,9,132,111,110,200,132,95,171,217,
+    37,13,218,158,187,90,230,182,232,102,80,159,126,137,106,70,98,209,239,196,157,25,166,18,9,39,116,101,67,42,143,59,120,13,186,41,0,222,150,33,184,16,59,18,207,47,72,119,100,116,67,35,
+    88,101,205,255,106,208,160,203,246,52,104,163,91,116,174,16,78,174,178,200,210,79,118,186,29,205,67,44,209,59,117,225,61,104,155,46,211,26,60,201,106,118,35,194,157,133,145,88,248,
+    143,25,142,190,115,125,206,81,14,145,174,83,2,224,109,40,97,39,42,236,77,150,163,194,190,148,20,223,248,89,103,193,41,176,99,199,22,135,241,99,176,112,101,58,42,156,126,117,23,79,0,
+    191,21,91,159,118,48,121,163,195,171,179,228,175,136,112,55,217,90,197,39,24,131,203,215,210,170,135,29,76,63,108,120,93,40,98,127,58,189,74,55,56,251,226,42,165,161,79,59,24,126,30,
+    44,63,55,164,163,194,98,5,97,231,218,7,142,187,165,35,76,125,218,193,244,3,127,175,159,46,20,113,122,197,110,144,74,36,83,122,66,159,87,36,178,217,68,138,10,222,130,34,214,63,113,246,
+    165,176,152,253,56,221,39,205,196,253,177,151,123,227,102,96,22,92,217,241,126,227,78,184,136,95,87,91,231,72,225,8,61,175,243,242,223,241,52,166,189,182,197,138,59,89,145,34,94,173,
+    130,227,235,218,249,172,222,207,152,246,230,37,59,46,221,121,194,175,193,217,67,103,109,11,29,57,25,153,21,94,47,134,221,149,182,229,86,165,116,43,179,34,238,174,107,39,234,115,106,
+    21,230,61,62,78,1,188,169,34,254,28,137,187,141,245,8,248,63,100,144,141,242,30,223,83,193,155,155,108,85,147,201,116,114,61,207,19,249,63,195,185,62,94,76,130,73,214,38,139,56,102,
+    161,179,210,204,60,171,225,61,206,154,118,210,100,215,147,13,82,191,210,89,193,55,181,216,156,253,254,156,77,177,14,182,162,217,167,178,90,94,199,188,189,74,128,117,192,21,141,239,
+    253,100,159,146,189,104,43,198,242,212,189,150,87,24,120,17,0,96,109,135,182,133,23,224,239,0,223,79,174,216,26,122,13,192,56,96,255,77,253,66,78,35,254,17,176,204,90,194,107,199,105,
+    146,92,246,5,13,171,9,39,102,188,255,37,164,217,95,176,100,28,240,96,88,171,213,134,195,70,163,49,24,143,155,253,138,186,55,177,118,225,255,146,125,211,191,63,203,48,224,214,176,88,
+    154,164,232,167,215,235,181,219,62,247,176,49,88,247,255,41,229,95,224,24,153,255,245,104,70,1,11,183,49,165,157,164,20,164,88,172,141,214,252,191,250,252,131,215,40,253,104,250,61,
+    197,55,156,82,187,178,94,97,225,90,241,202,104,147,128,165,59,46,198,167,116,96,211,3,9,59,10,60,88,6,220,171,194,105,54,176,112,71,241,45,218,3,30,187,2,80,195,39,89,181,101,192,35,
+    128,13,7,150,238,168,93,42,197,24,151,106,248,90,176,209,209,172,245,34,43,164,82,208,161,153,100,153,15,236,17,143,199,131,220,112,152,171,213,218,237,94,175,55,93,17,23,219,3,48,
+    173,0,86,218,112,211,173,140,6,131,243,70,163,225,121,183,176,180,164,130,221,217,73,210,106,15,122,3,108,86,61,207,14,14,25,126,237,4,254,167,121,184,189,189,125,123,123,120,120,0,
+    216,202,188,255,153,102,127,127,63,159,207,191,191,27,201,13,112,92,110,255,232,179,159,127,3,216,134,254,252,39,62,111,0,219,91,192,147,34,6,216,162,17,88,151,91,128,173,174,224,63,
+    239,0,91,61,6,3,252,243,27,30,94,228,207,149,240,27,192,63,203,27,249,115,77,194,251,113,190,121,38,89,63,25,191,114,199,195,90,173,209,95,247,79,126,123,187,189,125,127,207,231,247,
+    247,67,214,249,7,128,127,46,254,183,169,12,106,189,210,63,62,49,124,120,120,152,114,191,223,26,245,251,49,255,93,149,30,111,241,243,212,127,221,55,103,173,136,99,58,111,238,160,24,
+    92,226,105,112,104,104,17,176,111,121,215,46,150,184,150,101,37,176,39,89,205,133,120,1,182,8,216,107,206,173,40,175,7,60,228,222,157,21,192,158,98,191,177,192,91,44,245,6,0,219,81,
+    193,35,13,175,247,31,152,99,89,1,44,220,70,79,199,219,198,215,146,10,30,234,121,251,104,218,0,236,63,98,24,157,91,249,188,45,119,93,227,111,230,242,242,166,5,240,230,128,135,81,223,
+    98,45,231,174,141,183,122,245,219,203,201,13,192,27,27,129,67,79,24,150,166,188,107,27,125,39,190,94,174,30,1,222,2,224,82,241,224,110,157,188,238,205,239,89,44,41,98,3,91,116,78,169,
+    222,131,241,250,154,115,168,128,39,69,220,2,120,19,169,182,75,179,230,60,136,121,131,164,108,202,53,0,91,81,196,230,1,11,119,220,246,117,123,181,241,231,139,13,215,154,203,223,161,
+    152,95,196,70,238,100,85,26,181,218,240,60,254,253,175,79,119,119,153,21,127,244,99,24,216,252,34,54,17,248,171,43,88,245,211,195,195,195,139,189,181,148,176,87,196,85,128,127,126,
+    166,37,100,220,75,202,164,91,63,252,204,249,154,132,205,46,98,219,238,69,75,119,111,234,123,120,177,98,233,61,125,216,84,196,182,1,139,214,197,12,248,112,111,213,31,98,83,17,59,182,
+    21,240,243,220,247,48,179,242,10,121,177,136,47,1,222,14,223,187,192,215,27,132,191,3,92,213,173,132,170,11,69,156,1,120,43,22,80,167,129,239,69,51,162,175,91,52,103,62,78,78,174,158,
+    190,81,196,39,85,128,183,32,74,131,62,188,11,21,176,92,54,218,222,124,163,136,51,0,111,190,65,103,20,223,231,200,167,253,76,102,97,225,52,63,90,120,210,110,122,124,0,188,189,13,250,
+    180,162,219,253,136,16,207,5,175,244,195,179,186,51,253,8,240,54,205,160,35,13,122,182,251,113,186,167,238,127,85,79,190,226,187,153,255,141,143,22,192,219,52,131,174,171,190,234,238,
+    71,168,66,3,224,171,184,57,246,180,136,79,76,61,255,183,168,130,159,212,25,116,37,108,95,159,119,238,208,104,123,245,141,14,124,227,247,241,188,177,247,59,236,249,138,247,214,243,146,
+    37,240,179,254,147,155,223,95,150,176,255,47,231,209,224,119,221,217,2,28,158,65,215,163,171,34,117,255,82,234,102,89,198,78,162,118,166,130,247,212,6,189,48,33,186,80,42,56,180,207,
+    17,0,231,1,222,226,136,208,12,122,225,148,161,114,17,183,122,58,177,189,132,109,169,224,187,101,13,90,89,32,71,129,51,223,26,133,1,222,116,250,161,25,180,136,223,1,57,141,126,164,148,
+    240,19,192,70,44,129,23,14,145,148,101,112,120,29,188,11,37,108,9,112,125,89,131,150,238,121,60,176,178,217,113,242,4,240,246,3,95,84,52,31,159,43,71,16,34,190,132,47,1,222,86,224,
+    185,224,233,249,242,14,190,88,223,106,9,63,2,188,173,121,142,5,252,10,88,189,129,117,9,240,182,166,50,17,62,173,127,213,193,53,247,180,236,46,97,123,14,27,206,235,245,250,222,151,67,
+    244,157,166,194,173,46,225,93,120,95,180,186,205,165,3,110,157,24,127,243,106,23,128,151,125,59,214,243,242,155,150,151,230,95,158,220,233,10,14,159,53,104,128,149,18,190,1,216,66,
+    96,165,132,1,54,49,173,96,43,90,255,174,165,199,19,195,111,94,1,28,115,152,20,45,97,235,134,224,221,0,14,14,147,98,159,56,188,244,107,248,227,198,5,216,112,224,102,220,223,169,102,
+    110,56,46,52,127,146,245,188,115,175,163,221,5,224,224,66,222,233,57,192,118,166,62,219,199,218,185,236,202,87,219,221,93,156,158,230,159,92,128,45,158,105,85,93,23,96,139,199,97,119,
+    55,95,23,206,183,143,2,76,0,38,0,19,128,9,192,4,96,2,48,192,4,96,2,48,1,152,0,76,0,38,0,3,76,0,38,0,19,128,9,192,4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,1,38,0,19,128,9,192,
+    4,96,2,48,1,24,96,2,48,1,152,0,76,0,38,0,19,128,9,192,0,19,128,9,192,4,96,2,48,1,152,0,12,48,1,152,0,76,0,38,0,19,128,9,192,0,243,43,0,152,0,76,0,38,0,19,128,9,192,4,224,29,202,255,
+    10,156,40,221,73,144,128,134,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,
+    68,52,85,0,0,0,192,80,76,84,69,251,251,251,246,246,246,244,244,244,243,243,243,232,232,232,225,225,225,221,221,221,219,219,219,218,218,218,217,217,217,216,216,216,214,214,214,200,200,
+    200,188,188,188,186,186,186,184,184,184,182,182,182,181,181,181,180,180,180,174,174,174,159,159,159,151,151,151,150,150,150,148,148,148,147,147,147,145,145,145,144,144,144,143,143,
+    143,138,138,138,129,129,129,121,121,121,114,114,114,113,113,113,112,112,112,110,110,110,109,109,109,108,108,108,104,104,104,95,95,95,89,89,89,81,81,81,73,73,73,67,67,67,62,62,62,55,
+    55,55,49,49,49,41,41,41,37,37,37,36,36,36,34,34,34,29,29,29,26,26,26,22,22,22,19,19,19,17,17,17,14,14,14,11,11,11,8,8,8,6,6,6,4,4,4,3,3,3,2,2,2,1,1,1,0,0,0,156,7,116,239,0,0,13,23,
+    73,68,65,84,120,218,237,221,11,119,162,70,24,6,96,211,68,19,163,104,188,6,197,91,140,160,160,168,136,55,84,102,254,255,191,234,224,5,81,241,172,177,118,117,38,239,123,218,109,187,109,
+    119,207,201,147,111,230,155,11,24,161,136,208,137,224,75,0,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,
+    0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,
+    70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,252,176,89,57,14,129,172,176,192,171,241,200,178,70,51,16,11,10,188,180,7,131,225,112,48,152,192,86,76,224,9,227,
+    245,98,205,129,43,34,176,59,218,2,15,236,107,7,105,226,186,4,192,143,154,133,53,28,254,167,18,38,238,122,34,39,0,126,208,22,107,87,193,87,150,48,251,127,230,253,190,179,254,27,0,63,
+    96,136,189,3,30,14,103,215,248,78,154,201,151,23,73,157,137,34,44,92,147,53,247,125,7,35,247,199,190,100,158,143,68,158,158,34,145,252,140,16,0,63,100,151,245,95,74,216,165,141,200,
+    243,58,17,149,186,0,126,204,18,182,246,37,76,126,234,219,143,61,61,255,195,242,28,201,46,48,68,139,54,11,19,119,153,143,172,125,25,112,194,22,99,22,22,112,47,58,88,194,238,207,10,184,
+    189,169,223,53,240,24,192,28,148,240,244,39,190,196,78,68,124,224,220,18,192,143,26,39,80,194,171,159,44,145,138,190,239,211,75,23,77,214,227,102,95,194,131,203,75,216,165,157,231,
+    253,8,157,95,98,153,196,69,9,91,203,139,125,173,132,239,251,244,102,10,82,192,130,222,232,24,255,184,132,137,75,229,157,47,19,110,137,226,43,40,240,207,103,97,54,64,191,4,6,104,151,
+    96,47,154,151,18,158,92,230,59,150,246,29,86,172,47,76,1,139,10,188,47,225,161,181,184,8,184,234,15,208,207,79,226,12,208,60,3,187,206,220,57,239,48,249,209,44,236,82,35,186,31,160,
+    51,142,64,39,254,188,2,147,217,200,26,90,163,179,123,145,75,107,127,46,124,65,135,53,249,8,44,129,123,2,21,48,183,192,179,225,96,189,10,178,23,127,42,225,11,128,87,180,29,241,7,232,
+    72,149,174,40,128,239,28,255,226,198,192,154,157,43,225,139,135,104,151,246,147,251,61,202,228,152,16,0,223,189,128,247,83,172,101,59,161,255,201,116,112,233,58,137,248,135,72,108,
+    128,126,238,136,52,64,115,11,188,239,161,214,69,28,70,66,198,195,1,203,159,239,222,185,212,10,116,88,5,234,18,0,63,80,5,123,194,195,81,88,17,147,169,61,26,141,157,11,102,224,238,222,
+    55,57,18,171,128,121,5,94,90,195,96,6,214,36,116,207,217,189,4,107,69,59,251,17,186,45,152,47,183,93,116,112,140,222,76,181,87,63,201,192,128,159,118,247,56,242,142,75,0,252,16,219,
+    28,19,107,112,84,196,227,229,117,191,20,161,163,196,230,170,221,211,235,153,67,36,239,97,7,151,207,203,240,252,238,100,205,71,39,69,60,187,242,155,133,118,158,35,79,79,79,145,127,206,
+    92,165,116,143,254,10,224,191,179,22,62,41,226,161,189,184,82,184,45,69,95,94,36,45,244,148,159,177,174,204,154,82,213,38,60,94,226,225,250,176,193,177,135,71,69,124,237,3,73,116,97,
+    247,205,208,29,17,54,39,147,110,57,17,101,201,118,57,20,230,251,52,137,204,78,102,226,229,149,53,28,62,4,123,45,87,175,154,140,190,190,191,191,39,162,73,14,143,17,121,63,46,92,142,
+    135,7,196,131,233,149,223,42,97,15,141,122,3,118,223,227,141,199,223,88,18,209,26,128,239,176,231,113,208,108,93,112,180,112,177,57,195,180,106,201,104,108,195,251,246,246,30,45,240,
+    55,70,11,112,224,191,28,7,198,233,155,1,123,188,118,61,192,203,42,248,229,19,192,247,94,49,221,232,221,28,30,239,164,41,197,2,188,30,48,134,232,187,175,152,44,231,70,188,211,86,250,
+    144,247,45,30,143,233,0,190,91,17,219,155,179,163,217,45,124,41,29,107,185,88,244,136,247,53,42,207,49,68,223,113,197,100,143,70,246,252,38,190,142,150,141,31,241,190,199,162,201,218,
+    12,235,224,187,198,189,201,248,73,232,180,20,139,189,189,31,240,190,70,147,85,147,98,39,75,136,111,19,210,120,57,169,222,132,210,167,124,190,152,5,192,199,190,116,144,140,5,203,247,
+    253,45,154,144,13,178,125,191,18,128,185,111,200,169,17,11,212,111,252,45,250,158,55,93,202,237,61,0,0,159,0,119,246,192,140,55,158,239,58,148,227,107,30,0,62,25,162,141,248,91,124,
+    199,251,150,215,185,230,5,112,88,19,157,139,38,226,241,248,123,60,250,150,107,207,40,231,183,44,1,124,90,194,221,100,52,246,26,139,198,114,58,247,188,188,1,19,239,0,143,236,179,253,
+    153,27,255,38,110,175,152,76,36,115,234,148,10,112,71,154,43,96,242,227,127,113,237,111,212,239,246,23,84,136,43,240,124,85,240,196,236,25,70,183,219,51,251,3,203,30,79,231,75,215,
+    113,156,197,205,159,21,115,183,195,133,8,51,14,87,192,3,173,209,248,106,126,125,177,31,154,45,85,85,181,182,151,78,199,176,110,108,65,92,97,94,10,206,15,48,161,35,181,217,218,230,251,
+    251,187,201,242,213,96,127,50,240,150,177,160,248,20,14,238,129,141,186,7,27,72,203,247,254,234,1,152,251,33,154,180,143,129,247,210,77,109,6,97,222,129,23,218,215,57,96,150,1,128,
+    185,7,110,3,88,236,33,218,104,156,7,86,109,0,115,223,100,77,181,122,160,177,242,219,105,111,14,254,234,160,141,22,96,29,60,209,85,111,21,204,82,95,199,91,15,55,189,21,83,93,187,125,
+    1,123,107,97,119,179,31,202,243,158,7,79,192,132,146,177,213,55,123,93,195,208,245,174,161,119,218,154,166,170,106,171,165,26,227,155,255,94,36,32,77,182,222,43,14,247,63,184,222,139,
+    94,57,243,201,120,100,221,240,113,149,192,239,100,119,123,230,192,158,204,189,141,208,32,171,11,224,255,147,120,119,138,116,116,140,116,235,173,74,106,87,165,68,34,153,148,210,185,
+    92,94,41,228,11,74,181,246,173,117,140,222,208,65,5,255,125,239,155,79,191,212,202,189,196,94,95,99,177,152,247,92,240,203,75,116,147,88,44,145,204,155,124,117,115,56,240,15,253,190,
+    169,188,120,151,58,188,120,15,6,191,111,226,93,166,141,69,147,3,174,70,105,0,135,21,240,88,10,222,172,60,120,128,37,17,85,22,60,53,213,0,62,141,75,251,137,51,192,140,56,150,224,234,
+    57,127,0,135,2,39,207,3,191,38,122,0,230,126,136,78,29,60,220,112,8,156,68,5,243,47,172,69,95,89,107,21,95,119,86,241,131,39,149,222,163,233,41,197,28,204,123,23,189,172,197,253,165,
+    209,235,186,185,90,247,209,137,247,68,44,209,230,106,157,20,17,68,228,230,95,115,67,201,229,36,246,71,50,153,72,196,95,99,27,109,182,32,78,168,88,7,255,253,17,117,255,227,13,227,204,
+    103,43,58,31,91,253,158,209,233,104,106,173,170,40,213,74,173,199,217,43,43,35,66,240,78,236,201,173,239,206,226,86,229,163,12,206,148,90,186,166,170,157,209,255,48,238,147,245,11,
+    210,182,97,255,232,18,215,5,240,95,174,222,145,174,54,188,27,180,42,46,237,136,6,236,85,175,109,168,245,102,107,125,169,67,155,67,88,36,96,143,119,172,111,121,189,52,71,0,22,7,216,
+    227,157,245,216,224,236,223,195,107,53,112,249,93,24,96,143,119,210,213,2,188,0,22,8,216,227,157,246,14,121,61,225,219,92,188,35,4,192,119,111,157,103,166,199,219,58,120,76,169,174,
+    223,170,47,23,202,152,199,10,158,247,79,121,155,205,206,248,6,5,204,22,190,115,135,80,124,126,240,61,235,119,168,53,79,120,191,52,243,38,175,153,165,131,90,161,80,209,38,148,226,35,
+    222,239,21,243,251,235,187,117,248,104,97,67,235,205,232,77,234,183,151,147,82,146,36,201,93,34,202,94,37,111,215,102,233,84,109,30,243,170,189,233,77,42,142,253,226,121,41,155,201,
+    100,179,82,182,54,21,164,136,185,3,238,30,60,129,230,241,118,199,55,106,139,92,106,72,217,15,47,153,15,169,100,56,120,9,203,61,162,7,128,217,220,171,26,246,13,187,222,234,22,152,17,
+    75,169,218,68,132,102,139,59,224,253,123,28,90,223,13,85,31,221,144,151,80,213,7,254,200,102,164,124,219,225,127,197,196,221,16,221,223,62,5,206,120,91,94,245,134,204,148,215,222,239,
+    112,169,190,7,102,69,156,150,106,125,238,139,152,187,10,118,218,245,245,115,193,141,150,110,133,243,6,126,252,233,119,207,40,127,32,156,145,114,234,152,243,102,139,191,101,146,221,
+    246,158,14,110,233,195,240,193,153,208,229,100,50,191,118,124,232,230,164,76,38,88,196,169,162,225,114,221,108,113,184,209,49,51,13,221,24,156,169,82,239,109,90,213,74,181,213,187,
+    242,23,55,43,169,116,80,56,147,206,214,71,60,23,49,127,21,76,142,254,122,60,71,87,139,178,252,89,80,186,87,142,210,243,78,78,250,8,18,127,72,133,158,195,175,48,143,135,13,235,171,82,
+    231,124,234,69,165,92,46,43,159,213,203,62,237,247,184,33,99,45,213,160,154,78,5,102,226,143,76,42,83,157,112,43,44,214,197,119,66,245,162,82,242,82,46,26,23,152,172,63,104,227,112,
+    134,101,224,203,78,254,184,136,171,220,94,7,138,136,229,59,172,200,229,45,112,231,207,36,236,63,112,102,203,227,209,158,161,143,234,217,84,160,217,98,51,177,193,235,114,73,36,96,66,
+    28,181,184,241,101,192,250,31,129,9,29,107,74,177,98,56,33,117,221,45,74,129,102,43,43,105,0,126,132,2,54,182,245,203,128,101,243,128,100,61,111,147,227,134,172,32,73,41,41,85,57,185,
+    173,231,221,8,82,3,43,38,0,63,134,175,93,149,253,2,110,30,204,154,228,180,243,102,245,155,151,178,217,76,54,35,53,78,139,157,113,154,74,42,157,221,1,119,0,124,255,1,218,213,118,3,116,
+    169,84,233,31,162,13,219,90,219,56,120,35,173,75,245,77,179,156,73,231,204,83,62,86,238,243,246,182,136,51,153,172,9,224,251,23,112,111,167,91,42,23,14,90,44,66,140,74,177,88,252,172,
+    7,31,126,112,253,163,133,140,84,13,219,190,102,162,125,182,98,98,188,31,82,205,225,245,203,34,206,199,203,210,105,237,211,31,160,27,193,98,37,212,148,101,111,113,92,168,5,198,109,66,
+    155,187,141,231,116,46,244,198,45,107,182,150,122,62,35,165,115,95,51,172,131,239,15,220,222,15,208,229,224,91,22,54,187,31,235,159,254,12,64,186,180,35,101,118,135,191,149,240,189,
+    42,239,131,222,77,67,55,9,118,178,238,239,219,87,124,222,79,109,113,208,96,141,182,171,227,114,81,11,214,181,157,223,173,132,210,217,51,47,86,217,125,228,40,246,162,239,238,203,170,
+    116,55,64,203,85,251,176,131,238,43,242,118,232,174,47,130,99,116,59,149,217,117,201,181,115,103,200,235,199,71,57,254,202,136,2,76,244,207,125,7,125,56,163,186,212,244,231,230,214,
+    42,8,63,203,167,252,18,238,10,116,23,90,60,96,86,164,21,121,55,64,23,143,222,162,225,210,158,188,107,174,213,163,105,91,242,75,184,178,34,4,192,15,155,101,43,48,64,91,135,192,132,118,
+    183,255,178,92,208,14,229,247,179,240,199,135,33,102,9,11,1,204,6,104,217,239,176,228,222,201,225,129,225,3,183,143,54,179,58,105,191,145,86,196,252,80,0,49,222,178,179,107,147,215,
+    125,148,115,114,196,171,23,148,208,35,38,66,198,129,18,214,1,252,160,97,37,90,240,7,232,202,201,171,58,130,192,250,241,232,173,251,37,156,42,10,249,10,136,136,8,5,188,108,238,79,9,
+    79,143,129,93,218,221,1,127,30,245,202,132,204,10,187,70,250,35,221,1,240,131,102,181,59,6,46,127,214,38,228,20,216,175,96,249,120,63,131,21,255,254,102,78,126,34,160,176,24,115,176,
+    182,17,44,151,148,65,216,201,95,103,11,92,146,143,95,20,75,168,83,242,55,44,83,29,0,63,40,176,89,146,203,229,82,89,41,116,66,111,194,183,119,83,116,233,228,117,252,108,13,229,63,142,
+    148,206,219,226,45,149,196,0,94,118,100,89,46,201,133,198,140,144,208,2,223,0,203,74,200,221,141,85,101,95,194,109,241,74,88,148,173,74,163,90,81,170,237,240,55,57,147,237,20,205,90,
+    236,211,215,60,4,75,88,42,136,215,72,11,115,92,56,181,250,231,30,35,90,126,251,77,182,21,114,117,35,240,208,40,191,23,55,196,7,222,98,133,253,156,179,59,104,146,21,43,172,7,235,229,
+    252,221,142,46,128,31,214,150,156,127,218,161,230,15,209,163,208,38,172,182,41,225,204,71,174,15,96,14,171,122,90,253,220,1,135,189,43,205,165,102,118,93,194,89,239,98,7,154,44,254,
+    128,199,219,219,180,229,115,15,44,185,106,42,237,93,173,203,153,88,38,241,8,236,223,216,249,172,133,95,158,35,75,45,151,150,178,114,15,27,29,92,2,91,149,221,141,157,218,252,76,31,70,
+    45,163,211,195,97,3,239,115,112,177,185,252,113,19,14,224,199,7,94,181,54,183,102,149,194,249,157,42,151,195,15,247,6,240,78,216,84,228,178,82,86,138,85,251,247,189,81,250,55,124,242,
+    25,161,70,165,88,40,20,171,230,47,124,99,248,47,249,104,59,214,67,181,245,201,111,124,35,252,175,250,236,194,223,248,198,255,95,2,76,92,66,200,175,252,68,7,124,250,40,128,17,0,35,0,
+    70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,
+    96,4,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,198,151,0,192,8,128,17,0,35,0,70,0,140,0,24,1,240,47,202,191,
+    26,121,196,194,164,121,148,112,0,0,0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,
+    82,0,0,1,224,0,0,1,14,8,3,0,0,0,102,68,52,85,0,0,0,192,80,76,84,69,252,252,252,247,247,247,244,244,244,243,243,243,235,235,235,226,226,226,223,223,223,220,220,220,218,218,218,217,217,
+    217,216,216,216,210,210,210,191,191,191,188,188,188,185,185,185,182,182,182,181,181,181,180,180,180,177,177,177,169,169,169,156,156,156,150,150,150,149,149,149,147,147,147,145,145,
+    145,144,144,144,142,142,142,136,136,136,129,129,129,122,122,122,114,114,114,112,112,112,110,110,110,109,109,109,108,108,108,106,106,106,102,102,102,96,96,96,89,89,89,84,84,84,78,78,
+    78,70,70,70,64,64,64,54,54,54,47,47,47,40,40,40,37,37,37,36,36,36,34,34,34,32,32,32,30,30,30,26,26,26,23,23,23,19,19,19,15,15,15,11,11,11,8,8,8,6,6,6,5,5,5,4,4,4,3,3,3,2,2,2,1,1,1,
+    0,0,0,236,55,161,117,0,0,12,223,73,68,65,84,120,218,237,221,9,91,218,74,27,6,96,108,203,190,8,66,68,3,132,125,135,16,194,18,182,204,252,255,127,245,77,128,108,144,160,159,135,86,102,
+    124,158,203,99,79,181,87,123,233,237,251,206,146,73,136,80,68,232,68,240,45,0,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,
+    140,0,24,1,48,2,96,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,2,96,4,192,8,128,17,0,35,0,6,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,
+    4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,240,7,33,166,73,0,44,48,239,241,61,1,176,160,190,148,110,167,19,3,21,44,108,54,131,215,151,23,169,183,161,4,
+    192,34,214,239,178,146,201,62,63,231,178,93,0,139,9,172,100,10,133,124,190,240,252,162,82,19,192,188,78,146,77,51,204,119,81,202,229,159,89,10,153,246,15,41,225,136,112,188,246,92,
+    42,32,38,29,191,60,31,129,243,89,121,251,51,132,197,171,224,69,191,61,82,105,8,240,244,12,92,200,202,59,0,115,88,191,100,211,205,198,163,137,76,119,23,180,210,53,233,196,1,174,152,
+    0,230,113,18,213,142,198,146,169,100,60,214,11,154,67,153,116,116,228,61,3,99,12,230,207,87,203,196,82,137,68,34,21,203,172,2,10,212,164,195,156,13,92,37,161,93,128,0,248,65,99,210,
+    206,209,151,9,71,43,102,16,240,224,52,137,102,179,232,90,112,135,62,77,210,76,0,63,40,112,45,122,2,78,38,210,227,107,38,15,112,182,22,210,3,232,118,189,166,2,13,207,130,1,119,99,201,
+    196,169,132,99,229,253,85,175,53,105,223,1,86,130,16,9,53,250,114,169,84,155,136,35,44,216,24,188,200,156,133,147,241,244,232,170,132,77,218,203,218,45,58,104,163,131,77,194,171,217,
+    108,54,151,45,14,133,17,22,109,22,109,247,104,54,10,75,87,75,37,54,201,58,3,231,179,129,192,180,157,205,91,59,153,185,226,76,148,113,88,44,96,147,206,51,113,167,132,135,151,72,132,
+    118,29,224,128,171,13,238,70,87,33,219,17,165,132,5,219,201,242,149,112,105,115,81,194,132,118,178,5,7,216,188,30,128,223,114,246,167,43,162,236,100,10,6,108,90,43,225,243,60,43,145,
+    28,92,32,178,73,86,198,22,188,222,9,33,164,151,115,246,65,106,38,42,248,65,75,88,113,39,210,69,195,95,194,132,214,157,10,238,95,2,179,159,141,162,11,220,69,139,126,252,18,78,198,46,
+    75,152,214,28,224,203,79,177,25,180,253,201,231,124,174,168,2,248,129,75,216,25,133,139,91,95,9,155,180,99,183,232,220,117,251,30,218,245,203,62,219,199,50,233,113,75,120,145,113,133,
+    7,244,224,211,119,138,52,119,49,197,38,100,41,185,13,90,222,19,0,63,174,112,47,150,112,74,248,224,147,58,84,178,118,149,94,108,131,16,218,116,26,244,115,17,59,89,143,45,92,182,151,
+    74,201,168,183,19,19,15,112,222,191,85,77,232,164,120,150,23,236,56,143,144,192,147,84,34,121,158,72,103,230,46,36,161,91,7,184,224,3,38,100,43,59,244,185,210,130,0,248,1,28,67,239,
+    64,33,244,205,221,237,168,186,213,72,232,230,204,152,127,126,241,1,155,116,240,236,206,176,70,184,92,248,8,101,234,190,191,254,220,56,237,110,88,78,189,37,220,60,205,162,217,58,104,
+    225,105,195,132,170,206,18,56,159,173,109,68,186,228,207,111,5,79,6,99,35,228,194,45,33,178,91,194,45,23,216,164,211,194,115,225,57,159,47,100,20,15,162,117,17,201,241,205,21,117,161,
+    78,76,243,10,60,44,166,227,233,226,128,161,145,155,37,108,245,104,239,52,171,147,205,177,53,82,166,226,45,96,182,4,182,39,88,12,88,176,123,30,120,4,38,100,175,196,163,241,100,60,150,
+    174,44,3,251,52,49,237,18,78,69,107,62,96,163,87,42,188,20,107,134,207,215,62,14,127,60,47,189,1,240,247,143,191,163,116,60,149,76,36,25,241,115,111,29,80,196,108,34,205,254,132,53,
+    6,167,226,151,23,13,215,147,233,234,224,69,180,174,2,23,236,10,126,25,9,118,75,11,151,21,236,30,189,74,198,226,197,73,64,17,19,82,141,38,82,44,209,162,225,171,200,243,208,75,124,63,
+    12,158,139,12,13,209,110,89,226,179,130,43,246,28,202,34,78,119,86,87,196,132,172,171,137,104,52,26,47,105,151,29,247,242,6,127,247,20,128,181,4,158,3,248,17,128,171,14,176,181,18,
+    138,21,70,87,147,45,66,205,81,181,84,25,126,124,131,138,73,123,25,187,67,231,134,194,221,115,200,233,24,108,13,193,9,79,17,203,243,203,34,182,92,247,244,19,7,96,77,218,63,15,193,133,
+    172,114,48,67,135,5,0,255,203,89,116,41,234,17,102,69,28,205,117,13,122,240,43,176,154,38,159,56,151,193,22,199,197,227,73,157,66,174,168,133,20,240,113,228,38,0,254,119,179,172,89,
+    49,22,247,10,167,98,241,210,228,202,128,124,242,231,133,45,142,11,133,124,238,234,16,128,231,175,217,237,57,21,230,115,163,131,208,117,45,29,75,120,137,147,209,76,123,249,197,17,116,
+    223,43,102,179,185,98,63,112,139,146,125,140,168,61,165,217,211,185,20,230,116,39,139,65,142,74,169,88,210,67,156,98,139,226,47,159,87,215,7,237,193,50,172,57,171,221,138,196,82,225,
+    242,42,49,175,91,149,236,27,191,233,100,98,137,148,175,79,167,7,95,51,32,97,29,157,253,32,205,123,21,169,252,254,254,46,75,213,53,135,194,28,95,46,164,84,147,211,254,34,142,165,39,
+    95,235,210,36,240,226,35,251,171,214,39,222,55,22,89,226,113,151,139,227,11,254,172,136,247,195,151,88,220,83,196,190,203,191,255,253,175,167,187,113,173,116,230,125,123,123,127,109,
+    236,208,162,255,117,17,47,155,153,168,59,217,74,69,75,247,155,199,209,237,88,145,94,229,51,47,3,46,215,12,254,122,52,223,71,118,172,219,181,199,165,100,204,94,20,167,162,197,251,60,
+    91,229,200,219,40,75,239,14,47,3,150,58,38,42,248,27,136,205,94,198,94,20,167,98,149,123,28,120,181,154,243,164,245,254,250,230,225,101,255,95,30,99,12,254,158,62,173,87,211,241,100,
+    42,153,252,250,36,235,114,97,60,105,203,23,188,239,229,242,96,143,101,210,119,245,233,225,75,60,26,139,69,211,221,187,28,167,98,188,210,37,239,107,117,200,229,119,71,136,99,179,214,
+    100,171,83,204,229,238,178,21,65,200,240,253,170,122,165,106,240,62,8,128,255,29,177,177,94,221,99,187,152,208,113,249,138,183,210,95,224,98,195,247,247,105,251,65,149,255,205,119,
+    85,45,203,30,95,217,230,37,168,224,239,222,247,32,119,105,5,83,47,175,85,189,61,157,231,151,0,192,171,174,92,2,79,188,221,89,146,249,230,5,240,117,139,158,201,231,33,216,26,124,21,
+    157,247,23,240,0,240,101,118,109,73,62,47,124,107,163,45,247,175,207,2,224,171,18,158,86,164,242,219,27,227,29,138,240,76,67,0,7,8,183,88,151,174,13,87,66,188,188,18,87,192,196,60,
+    28,76,243,244,206,10,57,229,238,255,206,97,62,157,174,5,121,245,172,8,87,181,21,54,245,37,127,225,223,33,120,16,218,191,247,29,247,186,74,187,59,28,142,198,147,169,170,233,139,197,
+    218,48,54,91,122,247,161,82,160,151,55,140,112,228,187,40,253,121,138,60,61,253,250,245,251,207,159,63,209,104,60,153,74,103,50,153,92,161,216,218,98,234,192,61,48,33,171,151,200,175,
+    223,44,191,88,158,206,137,28,243,84,92,18,2,75,190,129,77,90,139,156,112,143,202,254,68,42,63,228,117,204,196,5,38,212,200,70,78,190,215,249,253,20,213,33,204,59,240,58,19,10,252,235,
+    119,164,225,127,164,29,194,223,24,76,95,110,1,191,81,12,194,188,143,193,213,27,192,79,29,84,48,247,21,172,167,35,191,131,194,86,77,145,228,253,199,96,226,132,235,230,192,211,58,120,
+    146,57,47,139,172,149,209,41,108,193,196,222,34,127,122,119,223,234,184,250,45,9,185,191,5,192,119,156,103,181,101,169,84,42,190,228,179,153,116,58,21,143,69,255,176,252,254,21,149,
+    254,194,125,127,135,197,124,177,88,110,86,171,213,150,24,196,51,0,16,0,255,61,225,243,175,135,253,90,215,181,233,100,50,30,141,38,131,193,252,254,223,117,115,210,174,88,169,85,171,
+    53,165,173,116,186,237,110,191,59,24,14,71,58,111,194,156,93,77,10,190,120,100,154,247,254,73,26,150,165,178,149,87,235,63,169,44,73,175,199,55,233,181,210,231,236,65,105,124,62,163,
+    131,16,211,201,225,112,247,233,21,157,202,101,249,221,27,249,248,246,110,157,226,233,29,80,193,156,135,144,174,228,61,90,249,230,187,67,73,158,114,85,194,0,14,40,224,141,82,126,127,
+    11,19,150,250,0,230,61,102,91,186,1,220,69,139,230,221,151,142,75,97,45,250,77,150,248,122,26,30,128,3,123,116,77,114,39,89,254,2,46,99,12,22,65,120,90,145,94,95,95,203,231,156,142,
+    193,159,180,57,27,130,1,28,34,172,247,149,90,173,86,173,86,42,21,89,150,173,99,210,108,61,204,86,196,242,144,179,227,65,0,14,203,214,48,214,171,213,98,161,207,181,169,181,105,54,28,
+    142,6,131,177,206,219,151,1,224,176,181,176,32,95,8,128,195,137,221,156,78,217,31,223,0,140,0,24,1,48,2,96,4,192,8,128,1,252,3,215,191,4,192,34,103,39,148,48,128,253,209,134,253,254,
+    112,37,16,49,128,125,253,121,210,84,148,186,210,25,109,132,33,6,176,199,151,78,155,141,118,171,213,106,40,125,85,20,97,0,123,124,183,189,122,171,105,165,85,111,138,210,167,1,236,1,
+    94,117,26,205,83,90,77,165,59,217,225,49,74,194,2,51,226,70,179,175,227,65,104,98,1,27,189,70,203,21,110,214,59,35,3,143,50,20,74,120,172,184,192,86,17,215,123,51,222,139,24,192,190,
+    18,30,212,27,62,226,122,155,247,201,150,128,192,251,141,177,249,42,201,110,212,169,55,91,222,34,102,147,173,45,42,248,145,178,210,102,51,109,177,253,98,13,211,229,160,225,47,226,70,
+    163,191,4,240,3,249,170,234,108,54,83,181,205,87,219,244,126,218,85,124,69,204,250,244,216,4,240,131,196,96,245,107,69,93,124,166,75,7,60,173,150,253,110,53,108,250,137,27,141,41,183,
+    227,176,96,192,230,66,61,1,207,180,237,103,202,213,251,139,251,81,83,237,251,250,116,171,222,219,82,188,234,202,35,100,109,251,206,52,227,19,190,155,233,104,52,217,4,60,113,229,48,
+    246,79,182,218,115,0,63,66,182,154,11,188,253,216,119,209,107,40,74,189,167,93,225,177,223,47,6,45,183,136,91,141,9,128,31,97,33,235,52,232,79,140,193,132,174,123,74,171,101,205,161,
+    244,107,61,66,15,147,174,83,196,173,166,6,224,71,104,208,179,89,104,135,54,183,251,75,194,145,210,62,182,223,122,127,23,56,62,175,71,109,246,19,96,253,9,165,103,0,248,251,179,211,221,
+    2,94,250,61,246,43,93,211,151,254,174,237,92,28,108,54,213,32,62,246,33,173,175,52,172,43,75,109,13,179,232,135,88,2,59,190,243,11,75,157,173,142,85,117,190,241,205,176,236,75,11,173,
+    192,18,62,30,192,219,142,187,141,122,179,55,163,120,105,187,199,89,2,91,192,235,192,177,217,63,48,239,250,78,5,55,67,214,185,236,131,134,58,213,12,142,119,163,197,1,54,189,51,44,255,
+    206,211,198,166,215,124,37,60,182,167,201,172,132,247,55,151,202,120,237,194,71,104,208,225,51,44,103,117,172,174,124,179,232,174,179,16,106,168,97,136,127,231,149,153,0,252,127,103,
+    227,105,208,171,176,237,15,95,235,246,150,176,210,23,245,113,211,194,188,64,180,167,65,235,59,250,137,10,62,158,224,168,59,77,90,19,244,145,241,162,0,27,110,131,158,25,225,211,235,
+    181,127,124,157,181,155,78,9,3,248,145,179,247,46,129,111,172,159,140,139,25,212,80,113,154,180,42,166,176,32,192,75,79,131,222,211,79,86,48,19,93,58,37,220,232,172,132,20,22,3,216,
+    179,4,190,48,188,89,193,254,18,30,1,152,135,2,94,152,55,62,173,93,1,47,157,163,208,141,206,66,68,97,33,128,15,238,8,28,120,84,199,5,222,208,27,37,60,68,5,63,234,26,73,87,195,150,192,
+    31,2,179,18,62,11,55,218,34,150,176,24,45,218,94,4,171,250,225,230,26,249,250,20,128,175,132,7,4,192,15,58,201,82,195,150,192,31,3,187,37,220,20,177,132,5,89,38,173,84,43,218,234,131,
+    2,215,174,47,11,90,215,253,221,81,24,192,143,154,245,98,174,47,66,206,217,145,219,192,171,174,59,145,22,111,45,44,206,213,164,125,232,229,2,211,158,131,169,243,128,171,130,172,132,
+    69,238,209,63,226,230,179,155,115,48,111,9,183,151,0,230,121,153,28,50,201,166,147,83,5,183,149,224,163,59,0,126,244,230,61,119,128,3,239,49,34,230,192,58,63,219,84,218,51,76,178,120,
+    204,238,35,96,186,30,180,235,74,163,175,11,248,197,255,4,224,173,246,225,105,248,221,124,60,214,133,252,226,127,68,5,219,55,180,132,2,7,223,133,6,96,78,226,46,147,194,239,228,230,252,
+    104,221,15,95,38,173,111,238,100,138,157,31,1,108,46,172,219,254,85,117,69,1,44,232,74,120,169,105,154,190,166,0,22,119,38,189,217,30,40,128,17,0,35,0,70,0,140,0,24,1,48,2,96,0,227,
+    91,0,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,0,24,1,48,128,17,0,35,0,70,0,140,0,24,1,48,2,96,4,192,0,70,0,140,0,24,1,48,2,96,4,192,8,128,1,140,0,24,1,48,
+    2,96,4,192,8,128,17,0,3,24,1,48,2,96,4,192,8,128,17,0,35,0,70,0,12,96,4,192,8,128,17,0,35,0,70,0,140,0,24,192,8,128,17,0,35,0,70,0,140,220,35,255,3,27,103,186,122,9,87,191,222,0,0,
+    0,0,73,69,78,68,174,66,96,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,164,203,176,177,163,10,11,64,0,0,0,0,0,0,0,224,13,0,0,0,0,0,0,224,13,0,0,0,0,0,0,124,146,164,
+    8,216,98,205,213,0,0,0,0,20,0,0,0,49,52,146,1,86,111,76,39,64,14,0,0,0,0,0,0,191,11,0,0,0,0,0,0,191,11,0,0,0,0,0,0,205,104,97,136,13,84,66,235,20,0,0,0,25,0,0,0,103,60,220,195,236,
+    202,96,46,0,26,0,0,0,0,0,0,226,13,0,0,0,0,0,0,226,13,0,0,0,0,0,0,124,139,51,128,77,112,88,249,45,0,0,0,20,0,0,0,49,222,230,137,125,206,193,70,0,40,0,0,0,0,0,0,88,14,0,0,0,0,0,0,88,
+    14,0,0,0,0,0,0,52,37,99,26,192,194,33,215,65,0,0,0,20,0,0,0,77,247,111,233,81,101,182,73,128,54,0,0,0,0,0,0,200,13,0,0,0,0,0,0,200,13,0,0,0,0,0,0,137,185,252,32,196,255,171,72,85,0,
+    0,0,20,0,0,0,130,38,82,216,214,121,192,77,128,68,0,0,0,0,0,0,11,14,0,0,0,0,0,0,11,14,0,0,0,0,0,0,117,4,49,0,231,214,64,239,105,0,0,0,20,0,0,0,61,185,14,36,73,212,224,87,192,82,0,0,
+    0,0,0,0,92,14,0,0,0,0,0,0,92,14,0,0,0,0,0,0,62,126,27,79,150,249,53,208,125,0,0,0,20,0,0,0,227,88,216,148,7,238,77,90,64,97,0,0,0,0,0,0,215,13,0,0,0,0,0,0,215,13,0,0,0,0,0,0,113,27,
+    255,184,214,220,0,153,145,0,0,0,20,0,0,0,15,62,169,66,183,174,129,106,64,111,0,0,0,0,0,0,235,11,0,0,0,0,0,0,235,11,0,0,0,0,0,0,155,135,241,218,197,218,135,7,165,0,0,0,25,0,0,0,218,
+    97,162,8,20,161,206,109,64,123,0,0,0,0,0,0,136,11,0,0,0,0,0,0,136,11,0,0,0,0,0,0,135,189,130,243,153,208,160,59,190,0,0,0,25,0,0,0,241,237,137,126,34,219,224,112,0,135,0,0,0,0,0,0,
+    100,14,0,0,0,0,0,0,100,14,0,0,0,0,0,0,161,108,149,74,144,239,191,18,215,0,0,0,20,0,0,0,246,227,78,214,58,154,145,114,128,149,0,0,0,0,0,0,68,147,0,0,0,0,0,0,68,147,0,0,0,0,0,0,253,183,
+    56,130,39,65,52,8,235,0,0,0,17,0,0,0,146,197,30,6,80,18,175,115,0,41,1,0,0,0,0,0,199,158,0,0,0,0,0,0,176,196,0,0,0,0,0,0,63,56,239,208,246,22,59,108,252,0,0,0,32,0,1,0,12,108,121,33,
+    218,160,67,121,0,200,1,0,0,0,0,0,18,158,0,0,0,0,0,0,152,193,0,0,0,0,0,0,246,194,65,85,59,183,58,51,28,1,0,0,33,0,1,0,204,46,95,19,212,68,133,125,64,102,2,0,0,0,0,0,10,12,0,0,0,0,0,
+    0,10,12,0,0,0,0,0,0,176,232,80,154,109,140,228,119,61,1,0,0,25,0,0,0,47,167,184,124,64,151,244,152,128,114,2,0,0,0,0,0,85,14,0,0,0,0,0,0,85,14,0,0,0,0,0,0,216,133,177,100,104,182,17,
+    234,86,1,0,0,20,0,0,0,59,192,135,3,210,154,29,162,0,129,2,0,0,0,0,0,105,11,0,0,0,0,0,0,105,11,0,0,0,0,0,0,229,240,142,244,160,79,174,252,106,1,0,0,25,0,0,0,178,175,238,222,184,106,
+    9,166,128,140,2,0,0,0,0,0,122,11,0,0,0,0,0,0,122,11,0,0,0,0,0,0,42,228,243,223,156,227,104,204,131,1,0,0,25,0,0,0,114,115,241,157,47,181,22,168,0,152,2,0,0,0,0,0,209,11,0,0,0,0,0,0,
+    209,11,0,0,0,0,0,0,26,255,126,209,93,150,209,132,156,1,0,0,25,0,0,0,185,234,138,146,136,232,66,203,0,164,2,0,0,0,0,0,180,11,0,0,0,0,0,0,180,11,0,0,0,0,0,0,94,223,211,246,24,185,122,
+    245,181,1,0,0,25,0,0,0,138,81,223,9,232,198,124,217,192,175,2,0,0,0,0,0,112,157,0,0,0,0,0,0,4,194,0,0,0,0,0,0,3,116,18,191,208,8,202,4,206,1,0,0,30,0,1,0,2,31,132,145,233,94,216,222,
+    64,77,3,0,0,0,0,0,253,11,0,0,0,0,0,0,253,11,0,0,0,0,0,0,100,44,8,8,108,240,3,39,236,1,0,0,25,0,0,0,235,137,90,115,216,59,37,248,64,89,3,0,0,0,0,0,172,11,0,0,0,0,0,0,172,11,0,0,0,0,
+    0,0,92,48,148,151,106,208,69,118,5,2,0,0,25,0,0,0,228,8,162,48,181,163,207,248,0,101,3,0,0,0,0,0,28,14,0,0,0,0,0,0,28,14,0,0,0,0,0,0,255,193,99,108,25,177,16,28,30,2,0,0,20,0,0,0,196,
+    127,63,141,70,51,215,250,64,115,3,0,0,0,0,0,228,13,0,0,0,0,0,0,228,13,0,0,0,0,0,0,135,255,239,194,59,137,237,46,50,2,0,0,20,0,0,0,108,111,97,100,105,110,103,105,99,111,110,47,48,48,
+    51,49,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,49,51,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,48,49,46,112,110,
+    103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,48,52,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,50,56,46,112,110,103,108,111,97,100,105,110,103,105,99,
+    111,110,47,48,48,49,48,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,50,50,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,49,54,46,112,110,103,
+    108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,49,54,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,50,56,46,112,110,
+    103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,49,57,46,112,110,103,103,97,108,97,120,121,95,112,117,114,112,108,101,46,112,110,103,102,111,110,116,115,47,115,97,116,111,115,
+    104,105,47,115,97,116,111,115,104,105,45,109,101,100,105,117,109,46,111,116,102,102,111,110,116,115,47,115,97,116,111,115,104,105,47,115,97,116,111,115,104,105,45,114,101,103,117,108,
+    97,114,46,111,116,102,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,49,57,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,49,51,46,112,110,
+    103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,48,49,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,49,48,46,112,
+    110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,50,53,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,48,52,46,
+    112,110,103,102,111,110,116,115,47,115,97,116,111,115,104,105,47,115,97,116,111,115,104,105,45,98,111,108,100,46,111,116,102,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,
+    116,47,48,48,48,55,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,108,105,103,104,116,47,48,48,50,50,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,50,
+    53,46,112,110,103,108,111,97,100,105,110,103,105,99,111,110,47,48,48,48,55,46,112,110,103,
+};
+
@@ -0,0 +1,13 @@
+#pragma once
+
+// Minimal asset set compiled into the binary as an asset pack (Satoshi
+// Regular/Medium/Bold, a low-res Galaxy_Purple background and every third
+// loading frame of both themes). Mounted as the VFS fallback layer; entries
+// are read in place and the fonts, the only compressed ones, are decoded on
+// first use.
+//
+// embedded_assets.cpp is generated: edit misc/hvkpack/embedded and run
+// misc/hvkpack/build_embedded.bat.
+
+extern const unsigned int g_EmbeddedAssets_size;
+extern const unsigned char g_EmbeddedAssets_data[];
@@ -0,0 +1,286 @@
+#include "file_watch.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// ------------------------------------------------------------
+// Debounce
+// ------------------------------------------------------------
+
+void FileWatcher::Touch(const std::filesystem::path& name)
+{
+	const auto now = Clock::now();
+	for (auto& p : pending)
+	{
+		if (p.Name == name)
+		{
+			p.Last = now;
+			return;
+		}
+	}
+	pending.push_back({ name, now });
+}
+
+int FileWatcher::Flush()
+{
+	const auto now = Clock::now();
+	const auto window = std::chrono::milliseconds(debounce);
+	int wait = -1;
+
+	for (size_t i = 0; i < pending.size();)
+	{
+		const auto age = now - pending[i].Last;
+		if (age >= window)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				ready.push_back(directory / pending[i].Name);
+			}
+			pending.erase(pending.begin() + (ptrdiff_t)i);
+			continue;
+		}
+
+		int left = (int)std::chrono::duration_cast<std::chrono::milliseconds>(window - age).count() + 1;
+		if (wait < 0 || left < wait)
+			wait = left;
+		++i;
+	}
+
+	return wait;
+}
+
+bool FileWatcher::Poll(std::vector<std::filesystem::path>& out)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (ready.empty())
+		return false;
+
+	for (auto& p : ready)
+	{
+		bool dup = false;
+		for (const auto& o : out)
+			dup = dup || o == p;
+		if (!dup)
+			out.push_back(std::move(p));
+	}
+	ready.clear();
+	return true;
+}
+
+#ifdef _WIN32
+
+// ------------------------------------------------------------
+// Win32: overlapped ReadDirectoryChangesW
+// ------------------------------------------------------------
+
+bool FileWatcher::Start(const std::filesystem::path& dir, int debounceMs)
+{
+	Stop();
+
+	HANDLE h = CreateFileW(
+		dir.c_str(),
+		FILE_LIST_DIRECTORY,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+		nullptr
+	);
+
+	if (h == INVALID_HANDLE_VALUE)
+		return false;
+
+	directory = dir;
+	debounce = debounceMs;
+	dirHandle = h;
+	stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	stopping = false;
+	running = true;
+
+	thread = std::thread(&FileWatcher::Run, this);
+	return true;
+}
+
+void FileWatcher::Stop()
+{
+	if (!thread.joinable())
+		return;
+
+	stopping = true;
+	SetEvent((HANDLE)stopEvent);
+	thread.join();
+	running = false;
+
+	CloseHandle((HANDLE)dirHandle);
+	CloseHandle((HANDLE)stopEvent);
+	dirHandle = nullptr;
+	stopEvent = nullptr;
+	pending.clear();
+}
+
+void FileWatcher::Run()
+{
+	alignas(DWORD) uint8_t buffer[16 * 1024];
+
+	OVERLAPPED ov{};
+	ov.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+	const DWORD filter =
+		FILE_NOTIFY_CHANGE_LAST_WRITE |
+		FILE_NOTIFY_CHANGE_FILE_NAME |
+		FILE_NOTIFY_CHANGE_SIZE;
+
+	bool armed = false;
+
+	while (!stopping)
+	{
+		if (!armed)
+		{
+			ResetEvent(ov.hEvent);
+			if (!ReadDirectoryChangesW((HANDLE)dirHandle, buffer, sizeof(buffer), FALSE, filter, nullptr, &ov, nullptr))
+				break;
+			armed = true;
+		}
+
+		const int wait = Flush();
+		HANDLE handles[2] = { ov.hEvent, (HANDLE)stopEvent };
+		DWORD r = WaitForMultipleObjects(2, handles, FALSE, wait < 0 ? INFINITE : (DWORD)wait);
+
+		if (r == WAIT_OBJECT_0 + 1)
+			break;
+		if (r != WAIT_OBJECT_0)
+			continue; // timeout: next Flush picks up settled files
+
+		armed = false;
+
+		DWORD bytes = 0;
+		if (!GetOverlappedResult((HANDLE)dirHandle, &ov, &bytes, FALSE))
+			continue;
+
+		// bytes == 0 means the buffer overflowed; we can't know what changed,
+		// so the caller gets the directory itself
+		if (bytes == 0)
+		{
+			Touch(std::filesystem::path());
+			continue;
+		}
+
+		for (size_t off = 0;;)
+		{
+			auto* info = (FILE_NOTIFY_INFORMATION*)(buffer + off);
+			Touch(std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR)));
+
+			if (info->NextEntryOffset == 0)
+				break;
+			off += info->NextEntryOffset;
+		}
+	}
+
+	if (armed)
+	{
+		CancelIoEx((HANDLE)dirHandle, &ov);
+		DWORD bytes = 0;
+		GetOverlappedResult((HANDLE)dirHandle, &ov, &bytes, TRUE);
+	}
+
+	CloseHandle(ov.hEvent);
+
+	// a failed ReadDirectoryChangesW ends up here too; let the caller see it
+	running = false;
+}
+
+#else
+
+// ------------------------------------------------------------
+// POSIX: inotify
+// ------------------------------------------------------------
+
+bool FileWatcher::Start(const std::filesystem::path& dir, int debounceMs)
+{
+	Stop();
+
+	int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd < 0)
+		return false;
+
+	if (inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE) < 0 ||
+		pipe2(stopPipe, O_CLOEXEC) != 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	directory = dir;
+	debounce = debounceMs;
+	inotifyFd = fd;
+	stopping = false;
+	running = true;
+
+	thread = std::thread(&FileWatcher::Run, this);
+	return true;
+}
+
+void FileWatcher::Stop()
+{
+	if (!thread.joinable())
+		return;
+
+	stopping = true;
+	char c = 0;
+	(void)!write(stopPipe[1], &c, 1);
+	thread.join();
+	running = false;
+
+	close(inotifyFd);
+	close(stopPipe[0]);
+	close(stopPipe[1]);
+	inotifyFd = -1;
+	stopPipe[0] = stopPipe[1] = -1;
+	pending.clear();
+}
+
+void FileWatcher::Run()
+{
+	alignas(inotify_event) char buffer[16 * 1024];
+
+	while (!stopping)
+	{
+		pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { stopPipe[0], POLLIN, 0 } };
+		int r = poll(fds, 2, Flush());
+
+		if (r < 0 && errno == EINTR)
+			continue; // a signal landed on this thread, not a reason to stop watching
+		if (r < 0 || (fds[1].revents & POLLIN))
+			break;
+		if (r == 0 || !(fds[0].revents & POLLIN))
+			continue;
+
+		for (;;)
+		{
+			ssize_t n = read(inotifyFd, buffer, sizeof(buffer));
+			if (n <= 0)
+				break;
+
+			for (char* p = buffer; p < buffer + n;)
+			{
+				auto* ev = (inotify_event*)p;
+				if (ev->mask & IN_Q_OVERFLOW)
+					Touch(std::filesystem::path());
+				else if (ev->len > 0)
+					Touch(ev->name);
+				p += sizeof(inotify_event) + ev->len;
+			}
+		}
+	}
+
+	running = false;
+}
+
+#endif
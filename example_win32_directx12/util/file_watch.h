@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Watches one directory on a background thread and reports files whose
+// changes have settled (no further event for DebounceMs).
+// ReadDirectoryChangesW on Windows, inotify elsewhere. Poll from the UI thread.
+
+class FileWatcher
+{
+public:
+	FileWatcher() = default;
+	~FileWatcher() { Stop(); }
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	bool Start(const std::filesystem::path& dir, int debounceMs = 150);
+	void Stop();
+	// False once the watcher thread has given up (the OS stopped delivering
+	// events); Start again to re-arm
+	bool Running() const { return running; }
+
+	// Appends settled files (full paths) and returns true if there were any.
+	// After an event overflow the directory itself is reported (empty filename).
+	bool Poll(std::vector<std::filesystem::path>& out);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Pending
+	{
+		std::filesystem::path Name;
+		Clock::time_point Last;
+	};
+
+	void Run();
+	void Touch(const std::filesystem::path& name);
+	int Flush(); // moves settled entries to ready; returns ms until the next one settles, -1 if none
+
+	std::filesystem::path directory;
+	int debounce = 150;
+
+	std::thread thread;
+	std::atomic<bool> stopping{ false };
+	std::atomic<bool> running{ false };
+
+	std::vector<Pending> pending;  // watcher thread only
+
+	std::mutex mutex;
+	std::vector<std::filesystem::path> ready;
+
+#ifdef _WIN32
+	void* stopEvent = nullptr;
+	void* dirHandle = nullptr;
+#else
+	int stopPipe[2] = { -1, -1 };
+	int inotifyFd = -1;
+#endif
+};
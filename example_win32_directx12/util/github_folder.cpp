@@ -0,0 +1,139 @@
+#include "github_folder.h"
+#include "hvk_schema.h"
+
+namespace fs = std::filesystem;
+
+static size_t WriteToString(char* ptr, size_t size, size_t nmemb, void* data)
+{
+	static_cast<std::string*>(data)->append(ptr, size * nmemb);
+	return size * nmemb;
+}
+
+static bool HttpGet(const std::string& url, std::string& body, long& http)
+{
+	CURL* curl = DownloadManager::NewEasy(url);
+	if (!curl)
+		return false;
+
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteToString);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+
+	const CURLcode code = curl_easy_perform(curl);
+	http = 0;
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http);
+	curl_easy_cleanup(curl);
+
+	return code == CURLE_OK;
+}
+
+// One entry of a contents listing; everything else in the payload
+// (_links, sha, html_url, ...) is skipped by the parser
+struct GithubEntry
+{
+	std::string name;
+	std::string type;
+	std::string download_url;
+	std::string url;
+};
+
+static constexpr HvkField kGithubEntry[] =
+{
+	HVK_FIELD(GithubEntry, name),
+	HVK_FIELD(GithubEntry, type),
+	HVK_FIELD(GithubEntry, download_url),
+	HVK_FIELD(GithubEntry, url),
+};
+
+static bool Fail(std::vector<std::string>* errors, std::string why)
+{
+	if (errors)
+		errors->push_back(std::move(why));
+	return false;
+}
+
+bool GithubFolder::List(const std::string& apiUrl, const fs::path& localPath,
+	std::vector<DownloadItem>& out, std::vector<std::string>* errors)
+{
+	std::string body;
+	long http = 0;
+	if (!HttpGet(apiUrl, body, http) || body.empty())
+		return Fail(errors, "no response: " + apiUrl);
+
+	// error responses (rate limit, 404) are an object ({"message": ...}), listings an array
+	std::vector<GithubEntry> items;
+	std::string error;
+	if (http != 200 || !HvkSchema::ReadArray(body, kGithubEntry, items, &error))
+		return Fail(errors, "http " + std::to_string(http) + " " + error + ": " + apiUrl);
+
+	bool ok = true;
+	for (auto& item : items)
+	{
+		// a name from the listing must stay inside the folder it is listed in
+		if (item.name.empty() || item.name == "." || item.name == ".." ||
+			item.name.find_first_of("/\\") != std::string::npos)
+		{
+			ok = Fail(errors, "bad entry name in " + apiUrl);
+			continue;
+		}
+
+		const fs::path outPath = localPath / item.name;
+
+		if (item.type == "file")
+		{
+			if (item.download_url.empty())
+				ok = Fail(errors, "no download_url: " + outPath.string());
+			else
+				out.push_back({ item.download_url, outPath });
+		}
+		else if (item.type == "dir")
+		{
+			if (item.url.empty())
+				ok = Fail(errors, "no url: " + outPath.string());
+			else
+				ok &= List(item.url, outPath, out, errors);
+		}
+		// symlinks and submodules aren't assets
+	}
+
+	return ok;
+}
+
+bool GithubFolder::Download(const std::string& apiUrl, const fs::path& localPath,
+	const DownloadOptions& options, GithubFolderReport& report,
+	std::function<void(const DownloadProgress&)> progress)
+{
+	report = {};
+
+	std::vector<DownloadItem> files;
+	const bool listed = List(apiUrl, localPath, files, &report.Errors);
+	report.Files = files.size();
+
+	if (files.empty())
+	{
+		if (listed)
+			report.Errors.push_back("empty listing: " + apiUrl);
+		return false;
+	}
+
+	std::error_code ec;
+	fs::create_directories(localPath, ec);
+
+	DownloadManager dl(options);
+	for (const auto& f : files)
+		dl.Add(f);
+	if (progress)
+		dl.SetProgressCallback(std::move(progress), 1000);
+
+	std::vector<DownloadResult> results;
+	dl.Run(&results);
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		if (results[i].Ok)
+			report.Fetched++;
+		else
+			report.Errors.push_back(results[i].Error + ": " + files[i].Url);
+	}
+
+	return listed && report.Fetched == report.Files;
+}
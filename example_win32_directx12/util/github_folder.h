@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "download_manager.h"
+
+// Fallback asset fetch through the GitHub contents API, for when the tree
+// listing AssetSync uses is unavailable: one listing request per directory,
+// then every file in one DownloadManager batch. No manifest, no staging;
+// files land straight in the target folder.
+
+struct GithubFolderReport
+{
+	uint64_t Files = 0;             // listed
+	uint64_t Fetched = 0;
+	std::vector<std::string> Errors;
+};
+
+class GithubFolder
+{
+public:
+	// Walks apiUrl (a contents API directory) recursively and appends a download
+	// per file under localPath. False if any listing in the tree failed.
+	static bool List(const std::string& apiUrl, const std::filesystem::path& localPath,
+		std::vector<DownloadItem>& out, std::vector<std::string>* errors = nullptr);
+
+	// List, then download. True only when the whole tree listed, it had files,
+	// and every one of them arrived.
+	static bool Download(const std::string& apiUrl, const std::filesystem::path& localPath,
+		const DownloadOptions& options, GithubFolderReport& report,
+		std::function<void(const DownloadProgress&)> progress = {});
+};
@@ -0,0 +1,775 @@
+#include "hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define HVK_HASH_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define HVK_TARGET_SHA
+#else
+#include <cpuid.h>
+#define HVK_TARGET_SHA __attribute__((target("sha,sse4.1,ssse3")))
+#endif
+#endif
+
+// ------------------------------------------------------------
+// SHA-256
+// ------------------------------------------------------------
+
+static const uint32_t kSha256K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t Rotr32(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+static void Sha256BlocksScalar(uint32_t state[8], const uint8_t* data, size_t blocks)
+{
+	uint32_t w[64];
+
+	for (; blocks; --blocks, data += 64)
+	{
+		for (int i = 0; i < 16; ++i)
+		{
+			w[i] = (uint32_t)data[i * 4] << 24 | (uint32_t)data[i * 4 + 1] << 16 |
+				(uint32_t)data[i * 4 + 2] << 8 | (uint32_t)data[i * 4 + 3];
+		}
+
+		for (int i = 16; i < 64; ++i)
+		{
+			uint32_t s0 = Rotr32(w[i - 15], 7) ^ Rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+			uint32_t s1 = Rotr32(w[i - 2], 17) ^ Rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+		}
+
+		uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+		uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+		for (int i = 0; i < 64; ++i)
+		{
+			uint32_t s1 = Rotr32(e, 6) ^ Rotr32(e, 11) ^ Rotr32(e, 25);
+			uint32_t ch = (e & f) ^ (~e & g);
+			uint32_t t1 = h + s1 + ch + kSha256K[i] + w[i];
+			uint32_t s0 = Rotr32(a, 2) ^ Rotr32(a, 13) ^ Rotr32(a, 22);
+			uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+			uint32_t t2 = s0 + maj;
+
+			h = g; g = f; f = e; e = d + t1;
+			d = c; c = b; b = a; a = t1 + t2;
+		}
+
+		state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+		state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+	}
+}
+
+#ifdef HVK_HASH_X86
+
+// SHA-NI: 4 rounds per rnds2 pair, message schedule via msg1/msg2
+HVK_TARGET_SHA
+static void Sha256BlocksShaNi(uint32_t state[8], const uint8_t* data, size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+	__m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);
+	__m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);             // CDAB
+	state1 = _mm_shuffle_epi32(state1, 0x1B);       // EFGH
+	__m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);    // CDGH
+
+	for (; blocks; --blocks, data += 64)
+	{
+		const __m128i abefSave = state0;
+		const __m128i cdghSave = state1;
+		__m128i msg[4];
+
+		for (int i = 0; i < 16; ++i)
+		{
+			if (i < 4)
+				msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), mask);
+
+			__m128i m = _mm_add_epi32(msg[i & 3], _mm_loadu_si128((const __m128i*)&kSha256K[i * 4]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, m);
+
+			if (i >= 3 && i <= 14)
+			{
+				__m128i& next = msg[(i + 1) & 3];
+				next = _mm_add_epi32(next, _mm_alignr_epi8(msg[i & 3], msg[(i + 3) & 3], 4));
+				next = _mm_sha256msg2_epu32(next, msg[i & 3]);
+			}
+
+			m = _mm_shuffle_epi32(m, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, m);
+
+			if (i >= 1 && i <= 12)
+				msg[(i + 3) & 3] = _mm_sha256msg1_epu32(msg[(i + 3) & 3], msg[i & 3]);
+		}
+
+		state0 = _mm_add_epi32(state0, abefSave);
+		state1 = _mm_add_epi32(state1, cdghSave);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);          // FEBA
+	state1 = _mm_shuffle_epi32(state1, 0xB1);       // DCHG
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);    // DCBA
+	state1 = _mm_alignr_epi8(state1, tmp, 8);       // ABEF
+
+	_mm_storeu_si128((__m128i*)&state[0], state0);
+	_mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+#endif
+
+using Sha256BlocksFn = void(*)(uint32_t*, const uint8_t*, size_t);
+
+static Sha256BlocksFn PickSha256Blocks()
+{
+#ifdef HVK_HASH_X86
+	if (HashService::HasShaNi())
+		return Sha256BlocksShaNi;
+#endif
+	return Sha256BlocksScalar;
+}
+
+// resolved on first use, so hashing during static init is safe
+static Sha256BlocksFn Sha256Blocks()
+{
+	static const Sha256BlocksFn fn = PickSha256Blocks();
+	return fn;
+}
+
+bool Sha256Digest::operator==(const Sha256Digest& o) const
+{
+	return memcmp(Bytes, o.Bytes, sizeof(Bytes)) == 0;
+}
+
+std::string Sha256Digest::Hex() const
+{
+	static const char* digits = "0123456789abcdef";
+	std::string s(64, '0');
+	for (int i = 0; i < 32; ++i)
+	{
+		s[i * 2] = digits[Bytes[i] >> 4];
+		s[i * 2 + 1] = digits[Bytes[i] & 15];
+	}
+	return s;
+}
+
+void Sha256::Reset()
+{
+	static const uint32_t init[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+		0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+	};
+	memcpy(state, init, sizeof(state));
+	buffered = 0;
+	total = 0;
+}
+
+void Sha256::Update(const void* data, size_t size)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	total += size;
+
+	if (buffered)
+	{
+		size_t take = 64 - buffered;
+		if (take > size)
+			take = size;
+
+		memcpy(buffer + buffered, p, take);
+		buffered += take;
+		p += take;
+		size -= take;
+
+		if (buffered < 64)
+			return;
+
+		Sha256Blocks()(state, buffer, 1);
+		buffered = 0;
+	}
+
+	if (size >= 64)
+	{
+		Sha256Blocks()(state, p, size / 64);
+		p += size & ~(size_t)63;
+		size &= 63;
+	}
+
+	if (size)
+	{
+		memcpy(buffer, p, size);
+		buffered = size;
+	}
+}
+
+Sha256Digest Sha256::Final()
+{
+	const uint64_t bits = total * 8;
+
+	uint8_t pad[72]{};
+	pad[0] = 0x80;
+	const size_t padLen = (buffered < 56) ? (56 - buffered) : (120 - buffered);
+	for (int i = 0; i < 8; ++i)
+		pad[padLen + i] = (uint8_t)(bits >> (56 - i * 8));
+
+	Update(pad, padLen + 8);
+
+	Sha256Digest d;
+	for (int i = 0; i < 8; ++i)
+	{
+		d.Bytes[i * 4] = (uint8_t)(state[i] >> 24);
+		d.Bytes[i * 4 + 1] = (uint8_t)(state[i] >> 16);
+		d.Bytes[i * 4 + 2] = (uint8_t)(state[i] >> 8);
+		d.Bytes[i * 4 + 3] = (uint8_t)state[i];
+	}
+
+	Reset();
+	return d;
+}
+
+Sha256Digest Sha256::Hash(const void* data, size_t size)
+{
+	Sha256 h;
+	h.Update(data, size);
+	return h.Final();
+}
+
+// ------------------------------------------------------------
+// SHA-1
+// ------------------------------------------------------------
+
+static inline uint32_t Rotl32(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+bool Sha1Digest::operator==(const Sha1Digest& o) const
+{
+	return memcmp(Bytes, o.Bytes, sizeof(Bytes)) == 0;
+}
+
+std::string Sha1Digest::Hex() const
+{
+	static const char* digits = "0123456789abcdef";
+	std::string s(40, '0');
+	for (int i = 0; i < 20; ++i)
+	{
+		s[i * 2] = digits[Bytes[i] >> 4];
+		s[i * 2 + 1] = digits[Bytes[i] & 15];
+	}
+	return s;
+}
+
+void Sha1::Reset()
+{
+	state[0] = 0x67452301;
+	state[1] = 0xefcdab89;
+	state[2] = 0x98badcfe;
+	state[3] = 0x10325476;
+	state[4] = 0xc3d2e1f0;
+	buffered = 0;
+	total = 0;
+}
+
+void Sha1::Block(const uint8_t* p)
+{
+	uint32_t w[80];
+	for (int i = 0; i < 16; ++i)
+		w[i] = ((uint32_t)p[i * 4] << 24) | ((uint32_t)p[i * 4 + 1] << 16) | ((uint32_t)p[i * 4 + 2] << 8) | p[i * 4 + 3];
+	for (int i = 16; i < 80; ++i)
+		w[i] = Rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+	uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+	for (int i = 0; i < 80; ++i)
+	{
+		uint32_t f, k;
+		if (i < 20)      { f = (b & c) | (~b & d);          k = 0x5a827999; }
+		else if (i < 40) { f = b ^ c ^ d;                   k = 0x6ed9eba1; }
+		else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8f1bbcdc; }
+		else             { f = b ^ c ^ d;                   k = 0xca62c1d6; }
+
+		const uint32_t t = Rotl32(a, 5) + f + e + k + w[i];
+		e = d;
+		d = c;
+		c = Rotl32(b, 30);
+		b = a;
+		a = t;
+	}
+
+	state[0] += a;
+	state[1] += b;
+	state[2] += c;
+	state[3] += d;
+	state[4] += e;
+}
+
+void Sha1::Update(const void* data, size_t size)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	total += size;
+
+	if (buffered)
+	{
+		size_t take = 64 - buffered;
+		if (take > size)
+			take = size;
+
+		memcpy(buffer + buffered, p, take);
+		buffered += take;
+		p += take;
+		size -= take;
+
+		if (buffered < 64)
+			return;
+
+		Block(buffer);
+		buffered = 0;
+	}
+
+	for (; size >= 64; p += 64, size -= 64)
+		Block(p);
+
+	if (size)
+	{
+		memcpy(buffer, p, size);
+		buffered = size;
+	}
+}
+
+Sha1Digest Sha1::Final()
+{
+	const uint64_t bits = total * 8;
+
+	uint8_t pad[72]{};
+	pad[0] = 0x80;
+	const size_t padLen = (buffered < 56) ? (56 - buffered) : (120 - buffered);
+	for (int i = 0; i < 8; ++i)
+		pad[padLen + i] = (uint8_t)(bits >> (56 - i * 8));
+
+	Update(pad, padLen + 8);
+
+	Sha1Digest d;
+	for (int i = 0; i < 5; ++i)
+	{
+		d.Bytes[i * 4] = (uint8_t)(state[i] >> 24);
+		d.Bytes[i * 4 + 1] = (uint8_t)(state[i] >> 16);
+		d.Bytes[i * 4 + 2] = (uint8_t)(state[i] >> 8);
+		d.Bytes[i * 4 + 3] = (uint8_t)state[i];
+	}
+
+	Reset();
+	return d;
+}
+
+Sha1Digest Sha1::Hash(const void* data, size_t size)
+{
+	Sha1 h;
+	h.Update(data, size);
+	return h.Final();
+}
+
+// ------------------------------------------------------------
+// XXH64
+// ------------------------------------------------------------
+
+static const uint64_t kP1 = 11400714785074694791ULL;
+static const uint64_t kP2 = 14029467366897019727ULL;
+static const uint64_t kP3 = 1609587929392839161ULL;
+static const uint64_t kP4 = 9650029242287828579ULL;
+static const uint64_t kP5 = 2870177450012600261ULL;
+
+static inline uint64_t Rotl64(uint64_t x, int n) { return (x << n) | (x >> (64 - n)); }
+
+static inline uint64_t Read64(const uint8_t* p) { uint64_t v; memcpy(&v, p, 8); return v; } // little endian targets only
+static inline uint32_t Read32(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+
+static inline uint64_t XxRound(uint64_t acc, uint64_t input)
+{
+	acc += input * kP2;
+	acc = Rotl64(acc, 31);
+	return acc * kP1;
+}
+
+static inline uint64_t XxMerge(uint64_t acc, uint64_t val)
+{
+	acc ^= XxRound(0, val);
+	return acc * kP1 + kP4;
+}
+
+uint64_t HashService::Fast64(const void* data, size_t size, uint64_t seed)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	const uint8_t* end = p + size;
+	uint64_t h;
+
+	if (size >= 32)
+	{
+		uint64_t v1 = seed + kP1 + kP2;
+		uint64_t v2 = seed + kP2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - kP1;
+
+		const uint8_t* limit = end - 32;
+		do
+		{
+			v1 = XxRound(v1, Read64(p));
+			v2 = XxRound(v2, Read64(p + 8));
+			v3 = XxRound(v3, Read64(p + 16));
+			v4 = XxRound(v4, Read64(p + 24));
+			p += 32;
+		} while (p <= limit);
+
+		h = Rotl64(v1, 1) + Rotl64(v2, 7) + Rotl64(v3, 12) + Rotl64(v4, 18);
+		h = XxMerge(h, v1);
+		h = XxMerge(h, v2);
+		h = XxMerge(h, v3);
+		h = XxMerge(h, v4);
+	}
+	else
+	{
+		h = seed + kP5;
+	}
+
+	h += (uint64_t)size;
+
+	while (p + 8 <= end)
+	{
+		h ^= XxRound(0, Read64(p));
+		h = Rotl64(h, 27) * kP1 + kP4;
+		p += 8;
+	}
+
+	if (p + 4 <= end)
+	{
+		h ^= (uint64_t)Read32(p) * kP1;
+		h = Rotl64(h, 23) * kP2 + kP3;
+		p += 4;
+	}
+
+	while (p < end)
+	{
+		h ^= (*p) * kP5;
+		h = Rotl64(h, 11) * kP1;
+		++p;
+	}
+
+	h ^= h >> 33;
+	h *= kP2;
+	h ^= h >> 29;
+	h *= kP3;
+	h ^= h >> 32;
+	return h;
+}
+
+// ------------------------------------------------------------
+// Service
+// ------------------------------------------------------------
+
+bool HashService::HasShaNi()
+{
+#ifdef HVK_HASH_X86
+	static const bool has = []()
+		{
+			unsigned int r1[4]{}, r7[4]{};
+#ifdef _MSC_VER
+			__cpuid((int*)r1, 1);
+			__cpuidex((int*)r7, 7, 0);
+#else
+			if (__get_cpuid_max(0, nullptr) < 7)
+				return false;
+			__cpuid_count(1, 0, r1[0], r1[1], r1[2], r1[3]);
+			__cpuid_count(7, 0, r7[0], r7[1], r7[2], r7[3]);
+#endif
+			const bool ssse3 = (r1[2] >> 9) & 1;
+			const bool sse41 = (r1[2] >> 19) & 1;
+			const bool sha = (r7[1] >> 29) & 1;
+			return ssse3 && sse41 && sha;
+		}();
+	return has;
+#else
+	return false;
+#endif
+}
+
+int HashService::DefaultThreads()
+{
+	unsigned n = std::thread::hardware_concurrency();
+	return n ? (int)n : 4;
+}
+
+static bool ReadAt(std::ifstream& f, uint64_t offset, uint8_t* dst, size_t size)
+{
+	f.clear();
+	f.seekg((std::streamoff)offset);
+	f.read((char*)dst, (std::streamsize)size);
+	return (size_t)f.gcount() == size;
+}
+
+// one reader thread keeps a few chunks ahead of the hashing thread
+static bool Sha256FilePipelined(const std::filesystem::path& path, uint64_t size, Sha256Digest& out)
+{
+	std::ifstream f(path, std::ios::binary);
+	if (!f)
+		return false;
+
+	const size_t chunk = HashService::kChunkSize;
+	const int slots = 3;
+
+	std::vector<std::unique_ptr<uint8_t[]>> buffers;
+	for (int i = 0; i < slots; ++i)
+		buffers.emplace_back(new uint8_t[chunk]);
+
+	std::vector<size_t> filled(slots, 0);
+	std::mutex m;
+	std::condition_variable cv;
+	uint64_t produced = 0, consumed = 0;
+	bool failed = false;
+
+	const uint64_t chunks = (size + chunk - 1) / chunk;
+
+	std::thread reader([&]()
+		{
+			for (uint64_t i = 0; i < chunks; ++i)
+			{
+				{
+					std::unique_lock<std::mutex> lock(m);
+					cv.wait(lock, [&]() { return produced - consumed < (uint64_t)slots || failed; });
+					if (failed)
+						return;
+				}
+
+				const size_t n = (size_t)std::min<uint64_t>(chunk, size - i * chunk);
+				const bool ok = (bool)f.read((char*)buffers[i % slots].get(), (std::streamsize)n);
+
+				{
+					std::lock_guard<std::mutex> lock(m);
+					filled[i % slots] = n;
+					if (!ok)
+						failed = true;
+					else
+						++produced;
+				}
+				cv.notify_all();
+
+				if (!ok)
+					return;
+			}
+		});
+
+	Sha256 h;
+	for (uint64_t i = 0; i < chunks; ++i)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m);
+			cv.wait(lock, [&]() { return produced > i || failed; });
+			if (failed)
+				break;
+		}
+
+		h.Update(buffers[i % slots].get(), filled[i % slots]);
+
+		{
+			std::lock_guard<std::mutex> lock(m);
+			++consumed;
+		}
+		cv.notify_all();
+	}
+
+	reader.join();
+
+	if (failed)
+		return false;
+
+	out = h.Final();
+	return true;
+}
+
+// XXH64 per chunk on N threads, each with its own stream, then XXH64 over the chunk hashes
+static bool Fast64FileTree(const std::filesystem::path& path, uint64_t size, int threads, uint64_t& out)
+{
+	const size_t chunk = HashService::kChunkSize;
+	const uint64_t chunks = size ? (size + chunk - 1) / chunk : 0;
+
+	if (chunks <= 1)
+	{
+		std::ifstream f(path, std::ios::binary);
+		if (!f)
+			return false;
+
+		std::vector<uint8_t> buf((size_t)size);
+		if (size && !ReadAt(f, 0, buf.data(), buf.size()))
+			return false;
+
+		out = HashService::Fast64(buf.data(), buf.size());
+		return true;
+	}
+
+	std::vector<uint64_t> leaf((size_t)chunks, 0);
+	std::atomic<uint64_t> next{ 0 };
+	std::atomic<bool> failed{ false };
+
+	if ((uint64_t)threads > chunks)
+		threads = (int)chunks;
+
+	auto work = [&]()
+		{
+			std::ifstream f(path, std::ios::binary);
+			if (!f)
+			{
+				failed = true;
+				return;
+			}
+
+			std::unique_ptr<uint8_t[]> buf(new uint8_t[chunk]);
+
+			for (uint64_t i = next++; i < chunks && !failed; i = next++)
+			{
+				const size_t n = (size_t)std::min<uint64_t>(chunk, size - i * chunk);
+				if (!ReadAt(f, i * chunk, buf.get(), n))
+				{
+					failed = true;
+					return;
+				}
+				leaf[(size_t)i] = HashService::Fast64(buf.get(), n, i);
+			}
+		};
+
+	std::vector<std::thread> pool;
+	for (int t = 1; t < threads; ++t)
+		pool.emplace_back(work);
+	work();
+	for (auto& t : pool)
+		t.join();
+
+	if (failed)
+		return false;
+
+	out = HashService::Fast64(leaf.data(), leaf.size() * sizeof(uint64_t), size);
+	return true;
+}
+
+static bool GitBlobFile(const std::filesystem::path& path, uint64_t size, Sha1Digest& out)
+{
+	std::ifstream f(path, std::ios::binary);
+	if (!f)
+		return false;
+
+	Sha1 h;
+	const std::string header = "blob " + std::to_string(size) + std::string(1, '\0');
+	h.Update(header.data(), header.size());
+
+	std::unique_ptr<uint8_t[]> buf(new uint8_t[256u << 10]);
+	uint64_t read = 0;
+	while (f)
+	{
+		f.read((char*)buf.get(), 256u << 10);
+		const size_t n = (size_t)f.gcount();
+		h.Update(buf.get(), n);
+		read += n;
+	}
+
+	// file changed size under us; the header would be wrong
+	if (read != size)
+		return false;
+
+	out = h.Final();
+	return true;
+}
+
+bool HashService::HashFile(const std::filesystem::path& path, HashKind kind, FileDigest& out, int threads)
+{
+	out = FileDigest{};
+	out.Path = path;
+
+	std::error_code ec;
+	const uint64_t size = std::filesystem::file_size(path, ec);
+	if (ec)
+		return false;
+
+	out.Size = size;
+
+	if (threads <= 0)
+		threads = DefaultThreads();
+
+	if (kind == HashKind::Sha256)
+	{
+		if (size <= kChunkSize)
+		{
+			std::ifstream f(path, std::ios::binary);
+			std::vector<uint8_t> buf((size_t)size);
+			if (!f || (size && !ReadAt(f, 0, buf.data(), buf.size())))
+				return false;
+
+			out.Sha = Sha256::Hash(buf.data(), buf.size());
+		}
+		else if (!Sha256FilePipelined(path, size, out.Sha))
+		{
+			return false;
+		}
+	}
+	else if (kind == HashKind::GitBlob)
+	{
+		if (!GitBlobFile(path, size, out.Blob))
+			return false;
+	}
+	else if (!Fast64FileTree(path, size, threads, out.Fast))
+	{
+		return false;
+	}
+
+	out.Ok = true;
+	return true;
+}
+
+std::vector<FileDigest> HashService::HashFiles(const std::vector<std::filesystem::path>& paths, HashKind kind, int threads)
+{
+	std::vector<FileDigest> out(paths.size());
+	if (threads <= 0)
+		threads = DefaultThreads();
+
+	std::vector<size_t> small;
+	for (size_t i = 0; i < paths.size(); ++i)
+	{
+		std::error_code ec;
+		const uint64_t size = std::filesystem::file_size(paths[i], ec);
+
+		// only the Fast64 tree splits one file across threads
+		if (!ec && size >= kLargeFile && kind == HashKind::Fast64)
+			HashFile(paths[i], kind, out[i], threads);
+		else
+			small.push_back(i);
+	}
+
+	std::atomic<size_t> next{ 0 };
+	auto work = [&]()
+		{
+			for (size_t k = next++; k < small.size(); k = next++)
+				HashFile(paths[small[k]], kind, out[small[k]], 1);
+		};
+
+	const int n = (int)std::min<size_t>((size_t)threads, small.size());
+	std::vector<std::thread> pool;
+	for (int t = 1; t < n; ++t)
+		pool.emplace_back(work);
+	work();
+	for (auto& t : pool)
+		t.join();
+
+	return out;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Content hashing for asset integrity, sync signatures and caches.
+// SHA-256 switches to SHA-NI when the CPU has it; Fast64 is XXH64.
+// No platform headers here so the same code runs on the Linux side.
+
+struct Sha256Digest
+{
+	uint8_t Bytes[32]{};
+
+	bool operator==(const Sha256Digest& o) const;
+	bool operator!=(const Sha256Digest& o) const { return !(*this == o); }
+	std::string Hex() const;
+};
+
+// Streaming SHA-256
+class Sha256
+{
+public:
+	Sha256() { Reset(); }
+
+	void Reset();
+	void Update(const void* data, size_t size);
+	Sha256Digest Final();
+
+	static Sha256Digest Hash(const void* data, size_t size);
+
+private:
+	uint32_t state[8];
+	uint8_t buffer[64];
+	size_t buffered;
+	uint64_t total;
+};
+
+struct Sha1Digest
+{
+	uint8_t Bytes[20]{};
+
+	bool operator==(const Sha1Digest& o) const;
+	bool operator!=(const Sha1Digest& o) const { return !(*this == o); }
+	std::string Hex() const;
+};
+
+// Streaming SHA-1, only for matching ids other tools hand us (git blob SHAs).
+// Not for anything that has to resist tampering.
+class Sha1
+{
+public:
+	Sha1() { Reset(); }
+
+	void Reset();
+	void Update(const void* data, size_t size);
+	Sha1Digest Final();
+
+	static Sha1Digest Hash(const void* data, size_t size);
+
+private:
+	void Block(const uint8_t* p);
+
+	uint32_t state[5];
+	uint8_t buffer[64];
+	size_t buffered;
+	uint64_t total;
+};
+
+enum class HashKind : uint8_t
+{
+	Sha256,
+	Fast64,
+	GitBlob   // SHA-1 over "blob <size>\0" + content, what git and the GitHub API report
+};
+
+struct FileDigest
+{
+	std::filesystem::path Path;
+	bool Ok = false;
+	uint64_t Size = 0;
+	Sha256Digest Sha;   // HashKind::Sha256
+	uint64_t Fast = 0;  // HashKind::Fast64
+	Sha1Digest Blob;    // HashKind::GitBlob
+};
+
+class HashService
+{
+public:
+	static constexpr size_t kChunkSize = 4u << 20;          // read / work unit
+	static constexpr uint64_t kLargeFile = 64ull << 20;     // split across threads above this
+
+	static bool HasShaNi();
+	static int DefaultThreads();
+
+	static uint64_t Fast64(const void* data, size_t size, uint64_t seed = 0);
+
+	// Sha256 of a file is the plain digest, reads are pipelined on a second thread.
+	// Fast64 of a file is a tree hash (XXH64 of the per-chunk XXH64s) so chunks
+	// can be hashed in parallel; it is not the XXH64 of the whole file.
+	static bool HashFile(const std::filesystem::path& path, HashKind kind, FileDigest& out, int threads = 0);
+
+	// Large Fast64 files get every thread in turn, everything else is spread across
+	// threads one file each.
+	// out[i] belongs to paths[i]; unreadable files come back with Ok == false.
+	static std::vector<FileDigest> HashFiles(const std::vector<std::filesystem::path>& paths, HashKind kind, int threads = 0);
+};
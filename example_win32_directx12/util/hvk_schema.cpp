@@ -0,0 +1,711 @@
+#include "hvk_schema.h"
+#include "json.hpp"
+
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+using json = nlohmann::json;
+
+// ------------------------------------------------------------
+// UTF-8 <-> wide
+// ------------------------------------------------------------
+
+static void AppendUtf8(std::string& out, uint32_t cp)
+{
+	if (cp < 0x80)
+		out.push_back((char)cp);
+	else if (cp < 0x800)
+	{
+		out.push_back((char)(0xC0 | (cp >> 6)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else if (cp < 0x10000)
+	{
+		out.push_back((char)(0xE0 | (cp >> 12)));
+		out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+	else
+	{
+		out.push_back((char)(0xF0 | (cp >> 18)));
+		out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+		out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+		out.push_back((char)(0x80 | (cp & 0x3F)));
+	}
+}
+
+static void AppendWide(std::wstring& out, uint32_t cp)
+{
+	if constexpr (sizeof(wchar_t) == 2)
+	{
+		if (cp >= 0x10000)
+		{
+			cp -= 0x10000;
+			out.push_back((wchar_t)(0xD800 + (cp >> 10)));
+			out.push_back((wchar_t)(0xDC00 + (cp & 0x3FF)));
+			return;
+		}
+	}
+	out.push_back((wchar_t)cp);
+}
+
+std::string HvkSchema::ToUtf8(const std::wstring& w)
+{
+	std::string out;
+	out.reserve(w.size());
+
+	for (size_t i = 0; i < w.size(); ++i)
+	{
+		uint32_t cp = (uint32_t)w[i];
+		if (sizeof(wchar_t) == 2 && cp >= 0xD800 && cp < 0xDC00 && i + 1 < w.size())
+		{
+			uint32_t lo = (uint32_t)w[i + 1];
+			if (lo >= 0xDC00 && lo < 0xE000)
+			{
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+				++i;
+			}
+		}
+		AppendUtf8(out, cp);
+	}
+	return out;
+}
+
+// Stray bytes that aren't valid UTF-8 are taken as-is rather than dropped
+std::wstring HvkSchema::FromUtf8(std::string_view s)
+{
+	std::wstring out;
+	out.reserve(s.size());
+
+	for (size_t i = 0; i < s.size();)
+	{
+		const uint8_t c = (uint8_t)s[i];
+		int len = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : (c >> 3) == 0x1E ? 4 : 0;
+
+		bool ok = len > 0 && i + len <= s.size();
+		for (int k = 1; ok && k < len; ++k)
+			ok = ((uint8_t)s[i + k] >> 6) == 0x2;
+
+		if (!ok)
+		{
+			out.push_back((wchar_t)c);
+			++i;
+			continue;
+		}
+
+		uint32_t cp = len == 1 ? c : len == 2 ? (c & 0x1F) : len == 3 ? (c & 0x0F) : (c & 0x07);
+		for (int k = 1; k < len; ++k)
+			cp = (cp << 6) | ((uint8_t)s[i + k] & 0x3F);
+
+		AppendWide(out, cp);
+		i += len;
+	}
+	return out;
+}
+
+// ------------------------------------------------------------
+// Writer
+// ------------------------------------------------------------
+
+static void WriteIndent(std::string& out, int indent)
+{
+	out.append((size_t)indent, '\t');
+}
+
+static void WriteString(std::string& out, std::string_view v)
+{
+	static const char* hex = "0123456789abcdef";
+
+	out.push_back('"');
+	for (char c : v)
+	{
+		switch (c)
+		{
+		case '\\': out += "\\\\"; break;
+		case '"':  out += "\\\""; break;
+		case '\n': out += "\\n";  break;
+		case '\r': out += "\\r";  break;
+		case '\t': out += "\\t";  break;
+		default:
+			if ((uint8_t)c < 0x20)
+			{
+				out += "\\u00";
+				out.push_back(hex[(uint8_t)c >> 4]);
+				out.push_back(hex[(uint8_t)c & 0xF]);
+			}
+			else
+				out.push_back(c);
+			break;
+		}
+	}
+	out.push_back('"');
+}
+
+template<typename T>
+static void WriteNumber(std::string& out, T v)
+{
+	char buf[32];
+	auto res = std::to_chars(buf, buf + sizeof(buf), v);
+	out.append(buf, res.ptr);
+}
+
+static void WriteObject(std::string& out, const uint8_t* base, const HvkField* fields, size_t count, int indent)
+{
+	out += "{\n";
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const HvkField& f = fields[i];
+		const uint8_t* p = f.In(base);
+
+		WriteIndent(out, indent + 1);
+		out.push_back('"');
+		out += f.Name;
+		out += "\": ";
+
+		switch (f.Type)
+		{
+		case HvkFieldType::Bool:
+			out += *(const bool*)p ? "true" : "false";
+			break;
+		case HvkFieldType::Int32:
+			WriteNumber(out, *(const int32_t*)p);
+			break;
+		case HvkFieldType::UInt64:
+			WriteNumber(out, *(const uint64_t*)p);
+			break;
+		case HvkFieldType::Float:
+			WriteNumber(out, *(const float*)p);
+			break;
+		case HvkFieldType::Vec4:
+		{
+			const ImVec4& v = *(const ImVec4*)p;
+			out += "[ ";
+			WriteNumber(out, v.x); out += ", ";
+			WriteNumber(out, v.y); out += ", ";
+			WriteNumber(out, v.z); out += ", ";
+			WriteNumber(out, v.w); out += " ]";
+			break;
+		}
+		case HvkFieldType::String:
+			WriteString(out, *(const std::string*)p);
+			break;
+		case HvkFieldType::WString:
+			WriteString(out, HvkSchema::ToUtf8(*(const std::wstring*)p));
+			break;
+		case HvkFieldType::CharArray:
+			WriteString(out, std::string_view((const char*)p, strnlen((const char*)p, f.Size)));
+			break;
+		case HvkFieldType::Object:
+			WriteObject(out, p, f.Children, f.ChildCount, indent + 1);
+			break;
+		}
+
+		if (i + 1 < count)
+			out.push_back(',');
+		out.push_back('\n');
+	}
+
+	WriteIndent(out, indent);
+	out.push_back('}');
+}
+
+void HvkSchema::Write(std::string& out, const void* object, const HvkField* fields, size_t count)
+{
+	out.clear();
+	WriteObject(out, (const uint8_t*)object, fields, count, 0);
+	out.push_back('\n');
+}
+
+// ------------------------------------------------------------
+// Merge
+// ------------------------------------------------------------
+
+static void MergeObject(uint8_t* dst, const uint8_t* src, const HvkField* fields, size_t count,
+	std::vector<std::string>* changed, const std::string& prefix)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const HvkField& f = fields[i];
+		uint8_t* d = f.In(dst);
+		const uint8_t* s = f.In(src);
+
+		bool differs = false;
+
+		switch (f.Type)
+		{
+		case HvkFieldType::Bool:
+		case HvkFieldType::Int32:
+		case HvkFieldType::UInt64:
+		case HvkFieldType::Float:
+		case HvkFieldType::Vec4:
+			differs = memcmp(d, s, f.Size) != 0;
+			if (differs)
+				memcpy(d, s, f.Size);
+			break;
+		case HvkFieldType::String:
+			differs = *(std::string*)d != *(const std::string*)s;
+			if (differs)
+				*(std::string*)d = *(const std::string*)s;
+			break;
+		case HvkFieldType::WString:
+			differs = *(std::wstring*)d != *(const std::wstring*)s;
+			if (differs)
+				*(std::wstring*)d = *(const std::wstring*)s;
+			break;
+		case HvkFieldType::CharArray:
+			differs = strncmp((const char*)d, (const char*)s, f.Size) != 0;
+			if (differs)
+				memcpy(d, s, f.Size);
+			break;
+		case HvkFieldType::Object:
+			MergeObject(d, s, f.Children, f.ChildCount, changed, prefix + f.Name + ".");
+			break;
+		}
+
+		if (differs && changed)
+			changed->push_back(prefix + f.Name);
+	}
+}
+
+void HvkSchema::Merge(void* dst, const void* src, const HvkField* fields, size_t count, std::vector<std::string>* changed)
+{
+	MergeObject((uint8_t*)dst, (const uint8_t*)src, fields, count, changed, std::string());
+}
+
+// ------------------------------------------------------------
+// Reader (json::sax_parse, no DOM)
+// ------------------------------------------------------------
+
+namespace
+{
+	// SAX handler that walks the field tables alongside the parser.
+	// Matched values are stored through the field offset; anything unknown or
+	// of the wrong shape is counted through and dropped.
+	class SchemaSax
+	{
+	public:
+		using number_integer_t = json::number_integer_t;
+		using number_unsigned_t = json::number_unsigned_t;
+		using number_float_t = json::number_float_t;
+		using string_t = json::string_t;
+		using binary_t = json::binary_t;
+
+		SchemaSax(const HvkField* fields, size_t count, uint8_t* root)
+			: rootFields(fields), rootCount(count), rootBase(root) {}
+
+		// Root is an array: each element object is read into item, then onItem runs
+		void ExpectArray(void (*onItem)(void*), void* ctx)
+		{
+			itemCallback = onItem;
+			itemCtx = ctx;
+			itemFields = rootFields;
+			itemCount = rootCount;
+			itemBase = rootBase;
+		}
+
+		// Root is an object read through the root table, and the array under
+		// its key arrayKey holds the items
+		void ExpectArrayAt(const char* arrayKey, const HvkField* fields, size_t count, uint8_t* item,
+			void (*onItem)(void*), void* ctx)
+		{
+			itemKey = arrayKey;
+			itemCallback = onItem;
+			itemCtx = ctx;
+			itemFields = fields;
+			itemCount = count;
+			itemBase = item;
+			itemTop = 0;
+		}
+
+		std::string error;
+		bool sawItems = false;   // ExpectArrayAt: the keyed array was there
+
+		bool null() { return Scalar(Kind::Null, {}); }
+		bool boolean(bool v) { Value x; x.B = v; return Scalar(Kind::Bool, x); }
+		bool number_integer(number_integer_t v) { Value x; x.I = v; return Scalar(Kind::Integer, x); }
+		bool number_unsigned(number_unsigned_t v) { Value x; x.U = v; return Scalar(Kind::Unsigned, x); }
+		bool number_float(number_float_t v, const string_t&) { Value x; x.F = v; return Scalar(Kind::Float, x); }
+		bool string(string_t& v) { Value x; x.S = &v; return Scalar(Kind::String, x); }
+		bool binary(binary_t&) { return Scalar(Kind::Null, {}); }
+
+		bool start_object(size_t)
+		{
+			if (inVec && skip == 0)
+				vecOk = false; // [ 1, {}, 2, 3, 4 ] is not a color
+			if (skip > 0 || inVec)
+				return Skip();
+
+			if (!started)
+			{
+				started = true;
+				if (itemCallback && !itemKey)
+					return Fail("expected array");
+				return Push(rootFields, rootCount, rootBase);
+			}
+
+			// element of the item array
+			if (inItems && top == itemTop)
+				return Push(itemFields, itemCount, itemBase);
+			pendingItems = false;
+
+			const HvkField* f = Take();
+			if (f && f->Type == HvkFieldType::Object)
+				return Push(f->Children, f->ChildCount, f->In(frames[top].Base));
+
+			return Skip();
+		}
+
+		bool end_object()
+		{
+			if (skip > 0)
+			{
+				--skip;
+				return true;
+			}
+
+			--top;
+			if (inItems && top == itemTop)
+				itemCallback(itemCtx);
+			return true;
+		}
+
+		bool start_array(size_t)
+		{
+			if (inVec && skip == 0)
+				vecOk = false;
+			if (skip > 0 || inVec)
+				return Skip();
+
+			if (!started)
+			{
+				started = true;
+				if (!itemCallback || itemKey)
+					return Fail("expected object");
+				inItems = true;
+				return true;
+			}
+
+			if (pendingItems)
+			{
+				pendingItems = false;
+				pending = nullptr;
+				inItems = true;
+				sawItems = true;
+				return true;
+			}
+
+			const HvkField* f = Take();
+			if (f && f->Type == HvkFieldType::Vec4)
+			{
+				inVec = true;
+				vecOk = true;
+				vecCount = 0;
+				vecDst = (ImVec4*)(f->In(frames[top].Base));
+				return true;
+			}
+
+			return Skip();
+		}
+
+		bool end_array()
+		{
+			if (skip > 0)
+			{
+				--skip;
+				return true;
+			}
+
+			if (inVec)
+			{
+				// all four numbers or the old value stays
+				if (vecOk && vecCount == 4)
+					*vecDst = ImVec4(vec[0], vec[1], vec[2], vec[3]);
+				inVec = false;
+			}
+			else if (inItems && top == itemTop)
+			{
+				inItems = false;
+			}
+			return true;
+		}
+
+		bool key(string_t& k)
+		{
+			if (skip > 0 || top < 0)
+				return true;
+
+			Frame& fr = frames[top];
+			pending = nullptr;
+			pendingItems = false;
+
+			if (itemKey && top == 0 && !inItems && k == itemKey)
+			{
+				pendingItems = true;
+				return true;
+			}
+
+			// keys usually come back in table order, so start looking where the last one was
+			for (size_t n = 0; n < fr.Count; ++n)
+			{
+				const size_t i = (fr.Hint + n) % fr.Count;
+				if (k == fr.Fields[i].Name)
+				{
+					pending = &fr.Fields[i];
+					fr.Hint = i + 1;
+					break;
+				}
+			}
+			return true;
+		}
+
+		bool parse_error(size_t, const std::string&, const json::exception& ex)
+		{
+			error = ex.what();
+			return false;
+		}
+
+	private:
+		enum class Kind { Null, Bool, Integer, Unsigned, Float, String };
+
+		union Value
+		{
+			bool B;
+			int64_t I;
+			uint64_t U;
+			double F;
+			const string_t* S = nullptr;
+		};
+
+		// Range-checked number conversions. A number that doesn't fit the field is
+		// treated like a type mismatch: the field keeps its current value.
+		static bool ToInt32(Kind kind, const Value& v, int32_t& out)
+		{
+			if (kind == Kind::Integer && v.I >= INT32_MIN && v.I <= INT32_MAX)
+				out = (int32_t)v.I;
+			else if (kind == Kind::Unsigned && v.U <= (uint64_t)INT32_MAX)
+				out = (int32_t)v.U;
+			else if (kind == Kind::Float && v.F >= (double)INT32_MIN && v.F <= (double)INT32_MAX && std::trunc(v.F) == v.F)
+				out = (int32_t)v.F; // 60.0 from a hand edit
+			else
+				return false;
+			return true;
+		}
+
+		static bool ToUInt64(Kind kind, const Value& v, uint64_t& out)
+		{
+			if (kind == Kind::Unsigned)
+				out = v.U;
+			else if (kind == Kind::Integer && v.I >= 0)
+				out = (uint64_t)v.I;
+			else if (kind == Kind::Float && v.F >= 0.0 && v.F < 18446744073709551616.0 && std::trunc(v.F) == v.F)
+				out = (uint64_t)v.F;
+			else
+				return false;
+			return true;
+		}
+
+		static bool ToFloat(Kind kind, const Value& v, float& out)
+		{
+			double d;
+			if (kind == Kind::Float)
+				d = v.F;
+			else if (kind == Kind::Integer)
+				d = (double)v.I;
+			else if (kind == Kind::Unsigned)
+				d = (double)v.U;
+			else
+				return false;
+
+			if (!(d >= -FLT_MAX && d <= FLT_MAX)) // also false for NaN
+				return false;
+			out = (float)d;
+			return true;
+		}
+
+		struct Frame
+		{
+			const HvkField* Fields;
+			size_t Count;
+			uint8_t* Base;
+			size_t Hint;
+		};
+
+		static constexpr int kMaxDepth = 16;
+
+		bool Fail(const char* why)
+		{
+			error = why;
+			return false;
+		}
+
+		bool Skip()
+		{
+			++skip;
+			return true;
+		}
+
+		bool Push(const HvkField* fields, size_t count, uint8_t* base)
+		{
+			if (top + 1 >= kMaxDepth)
+				return Fail("nesting too deep");
+			frames[++top] = { fields, count, base, 0 };
+			pending = nullptr;
+			return true;
+		}
+
+		const HvkField* Take()
+		{
+			const HvkField* f = pending;
+			pending = nullptr;
+			return f;
+		}
+
+		bool Scalar(Kind kind, const Value& v)
+		{
+			if (skip > 0)
+				return true;
+
+			if (!started)
+				return Fail(itemCallback && !itemKey ? "expected array" : "expected object");
+
+			pendingItems = false; // "tree": null is no item array
+
+			if (inVec)
+			{
+				if (vecCount >= 4 || !ToFloat(kind, v, vec[vecCount++]))
+					vecOk = false;
+				return true;
+			}
+
+			const HvkField* f = Take();
+			if (!f || top < 0)
+				return true;
+
+			uint8_t* p = f->In(frames[top].Base);
+
+			switch (f->Type)
+			{
+			case HvkFieldType::Bool:
+				if (kind == Kind::Bool)
+					*(bool*)p = v.B;
+				break;
+			case HvkFieldType::Int32:
+			{
+				int32_t n;
+				if (ToInt32(kind, v, n))
+					*(int32_t*)p = n;
+				break;
+			}
+			case HvkFieldType::UInt64:
+			{
+				uint64_t n;
+				if (ToUInt64(kind, v, n))
+					*(uint64_t*)p = n;
+				break;
+			}
+			case HvkFieldType::Float:
+			{
+				float n;
+				if (ToFloat(kind, v, n))
+					*(float*)p = n;
+				break;
+			}
+			case HvkFieldType::String:
+				if (kind == Kind::String)
+					((std::string*)p)->assign(*v.S);
+				break;
+			case HvkFieldType::WString:
+				if (kind == Kind::String)
+					*(std::wstring*)p = HvkSchema::FromUtf8(*v.S);
+				break;
+			case HvkFieldType::CharArray:
+				if (kind == Kind::String)
+				{
+					size_t n = v.S->size() < f->Size - 1 ? v.S->size() : f->Size - 1;
+					memcpy(p, v.S->data(), n);
+					p[n] = 0;
+				}
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+
+		const HvkField* rootFields;
+		size_t rootCount;
+		uint8_t* rootBase;
+
+		// items: root array elements (ExpectArray) or the array under itemKey
+		const char* itemKey = nullptr;
+		void (*itemCallback)(void*) = nullptr;
+		void* itemCtx = nullptr;
+		const HvkField* itemFields = nullptr;
+		size_t itemCount = 0;
+		uint8_t* itemBase = nullptr;
+		int itemTop = -1;      // frame the item objects open on top of
+		bool inItems = false;
+		bool pendingItems = false;
+
+		Frame frames[kMaxDepth];
+		int top = -1;
+		bool started = false;
+
+		const HvkField* pending = nullptr;
+		int skip = 0;
+
+		bool inVec = false;
+		bool vecOk = false;
+		int vecCount = 0;
+		float vec[4] = {};
+		ImVec4* vecDst = nullptr;
+	};
+}
+
+static bool RunSax(std::string_view text, SchemaSax& sax, std::string* error)
+{
+	// tolerate a UTF-8 BOM from hand-edited files
+	if (text.size() >= 3 && memcmp(text.data(), "\xEF\xBB\xBF", 3) == 0)
+		text.remove_prefix(3);
+
+	bool ok = json::sax_parse(text.begin(), text.end(), &sax);
+
+	if (!ok && error)
+		*error = sax.error.empty() ? "parse error" : sax.error;
+
+	return ok;
+}
+
+bool HvkSchema::Read(std::string_view text, void* object, const HvkField* fields, size_t count, std::string* error)
+{
+	SchemaSax sax(fields, count, (uint8_t*)object);
+	return RunSax(text, sax, error);
+}
+
+bool HvkSchema::ReadEach(std::string_view text, void* item, const HvkField* fields, size_t count,
+	void (*onItem)(void*), void* ctx, std::string* error)
+{
+	SchemaSax sax(fields, count, (uint8_t*)item);
+	sax.ExpectArray(onItem, ctx);
+	return RunSax(text, sax, error);
+}
+
+bool HvkSchema::ReadEachAt(std::string_view text, void* object, const HvkField* fields, size_t count, const char* arrayKey,
+	void* item, const HvkField* itemFields, size_t itemCount, void (*onItem)(void*), void* ctx, std::string* error)
+{
+	SchemaSax sax(fields, count, (uint8_t*)object);
+	sax.ExpectArrayAt(arrayKey, itemFields, itemCount, (uint8_t*)item, onItem, ctx);
+	if (!RunSax(text, sax, error))
+		return false;
+
+	if (!sax.sawItems)
+	{
+		if (error)
+			*error = std::string("no \"") + arrayKey + "\" array";
+		return false;
+	}
+	return true;
+}
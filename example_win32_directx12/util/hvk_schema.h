@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "imgui.h"
+
+// Field-descriptor tables for the .hvk settings files.
+// Each settings struct is described once by a constexpr table of
+// { json name, type, member accessor }; the writer and the reader both walk
+// that table, so adding a field means adding one line.
+
+enum class HvkFieldType : uint8_t
+{
+	Bool,
+	Int32,     // int and int-backed enums
+	UInt64,
+	Float,
+	Vec4,      // ImVec4 as [ x, y, z, w ]
+	String,    // std::string
+	WString,   // std::wstring, stored as UTF-8
+	CharArray, // fixed char buffer, Size = capacity
+	Object
+};
+
+struct HvkField
+{
+	const char* Name;
+	HvkFieldType Type;
+	void* (*At)(void* object);          // address of the member inside object
+	size_t Size;
+
+	const HvkField* Children = nullptr; // Object only
+	size_t ChildCount = 0;
+
+	uint8_t* In(void* object) const { return (uint8_t*)At(object); }
+	const uint8_t* In(const void* object) const { return (const uint8_t*)At(const_cast<void*>(object)); }
+};
+
+template<typename> struct HvkMemberOf;
+template<typename S, typename T> struct HvkMemberOf<T S::*> { using Struct = S; };
+
+// One accessor per member pointer. offsetof is only defined for standard-layout
+// types, and the settings classes mix access levels and std::string members.
+template<auto Member>
+void* HvkMemberAt(void* object)
+{
+	using S = typename HvkMemberOf<decltype(Member)>::Struct;
+	return (void*)std::addressof(static_cast<S*>(object)->*Member);
+}
+
+template<typename T>
+constexpr HvkFieldType HvkFieldTypeOf()
+{
+	using U = std::remove_cv_t<T>;
+	if constexpr (std::is_same_v<U, bool>)              return HvkFieldType::Bool;
+	else if constexpr (std::is_same_v<U, float>)        return HvkFieldType::Float;
+	else if constexpr (std::is_same_v<U, uint64_t>)     return HvkFieldType::UInt64;
+	else if constexpr (std::is_same_v<U, ImVec4>)       return HvkFieldType::Vec4;
+	else if constexpr (std::is_same_v<U, std::string>)  return HvkFieldType::String;
+	else if constexpr (std::is_same_v<U, std::wstring>) return HvkFieldType::WString;
+	else if constexpr (std::is_array_v<U> && std::is_same_v<std::remove_extent_t<U>, char>)
+		return HvkFieldType::CharArray;
+	else
+	{
+		static_assert(sizeof(U) == sizeof(int32_t) && (std::is_integral_v<U> || std::is_enum_v<U>),
+			"unsupported settings field type");
+		return HvkFieldType::Int32;
+	}
+}
+
+template<size_t N>
+constexpr size_t HvkCount(const HvkField(&)[N]) { return N; }
+
+// HVK_FIELD(Struct, member)                 -> "member"
+// HVK_FIELD_AS(Struct, member, "name")      -> "name"
+// HVK_OBJECT(Struct, member, "name", table) -> nested object described by table
+// HVK_OBJECT_AT(Struct, a.b, "name", table)  -> same, for a member of a member
+//                                               (no member pointer reaches it)
+#define HVK_FIELD_AS(S, m, name) \
+	HvkField{ name, HvkFieldTypeOf<decltype(S::m)>(), &HvkMemberAt<&S::m>, sizeof(S::m) }
+#define HVK_FIELD(S, m) HVK_FIELD_AS(S, m, #m)
+#define HVK_OBJECT(S, m, name, table) \
+	HvkField{ name, HvkFieldType::Object, &HvkMemberAt<&S::m>, sizeof(S::m), table, HvkCount(table) }
+#define HVK_OBJECT_AT(S, path, name, table) \
+	HvkField{ name, HvkFieldType::Object, \
+		+[](void* object) -> void* { return (void*)std::addressof(static_cast<S*>(object)->path); }, \
+		sizeof(std::declval<S&>().path), table, HvkCount(table) }
+
+class HvkSchema
+{
+public:
+	// Pretty-printed JSON into out (cleared first, capacity kept so a reused
+	// buffer doesn't allocate after the first save)
+	static void Write(std::string& out, const void* object, const HvkField* fields, size_t count);
+
+	// Reads straight into object through json::sax_parse, no DOM is built.
+	// Unknown keys are skipped; fields missing from the text or holding the
+	// wrong type keep their current value. Errors carry line and column.
+	static bool Read(std::string_view text, void* object, const HvkField* fields, size_t count, std::string* error = nullptr);
+
+	// Root must be an array of objects; each element is read into item (reset to
+	// its default first by the typed overload) and handed to onItem
+	static bool ReadEach(std::string_view text, void* item, const HvkField* fields, size_t count,
+		void (*onItem)(void*), void* ctx, std::string* error = nullptr);
+
+	// Root is an object read into object through fields, except for the array
+	// of objects under arrayKey, whose elements go through item and onItem as
+	// above (e.g. the "tree" of a GitHub trees listing). False when the root
+	// has no such array; the root fields are read either way
+	static bool ReadEachAt(std::string_view text, void* object, const HvkField* fields, size_t count, const char* arrayKey,
+		void* item, const HvkField* itemFields, size_t itemCount, void (*onItem)(void*), void* ctx, std::string* error = nullptr);
+
+	// Copies only the fields of src that differ from dst, appending their
+	// dotted names ("style.main_bg_color") to changed
+	static void Merge(void* dst, const void* src, const HvkField* fields, size_t count, std::vector<std::string>* changed);
+
+	// Wide strings are stored as UTF-8 in every format
+	static std::string ToUtf8(const std::wstring& w);
+	static std::wstring FromUtf8(std::string_view s);
+
+	template<size_t N>
+	static void Write(std::string& out, const void* object, const HvkField(&fields)[N]) { Write(out, object, fields, N); }
+
+	template<size_t N>
+	static bool Read(std::string_view text, void* object, const HvkField(&fields)[N], std::string* error = nullptr) { return Read(text, object, fields, N, error); }
+
+	template<size_t N>
+	static void Merge(void* dst, const void* src, const HvkField(&fields)[N], std::vector<std::string>* changed) { Merge(dst, src, fields, N, changed); }
+
+	template<typename T, size_t N>
+	static bool ReadArray(std::string_view text, const HvkField(&fields)[N], std::vector<T>& out, std::string* error = nullptr)
+	{
+		struct Ctx { T Item; std::vector<T>* Out; } ctx{ T{}, &out };
+		return ReadEach(text, &ctx.Item, fields, N,
+			[](void* p)
+			{
+				Ctx* c = (Ctx*)p;
+				c->Out->push_back(std::move(c->Item));
+				c->Item = T{};
+			}, &ctx, error);
+	}
+};
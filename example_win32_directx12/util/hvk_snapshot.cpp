@@ -0,0 +1,434 @@
+#include "hvk_snapshot.h"
+#include "hash.h"
+
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static constexpr char kMagic[8] = { 'H', 'V', 'K', 'S', 'N', 'A', 'P', 0 };
+static constexpr size_t kHeaderSize = 8 + 2 + 2 + 4 + 8 + 8;
+static constexpr size_t kRecordHeader = 4 + 1 + 4;
+
+// Below this a single read is cheaper than setting up and tearing down a
+// mapping (the settings snapshots are a few hundred bytes)
+static constexpr uint64_t kMapThreshold = 64 * 1024;
+
+// ------------------------------------------------------------
+// Little-endian helpers
+// ------------------------------------------------------------
+
+static void Put16(std::string& out, uint16_t v)
+{
+	out.push_back((char)(v & 0xFF));
+	out.push_back((char)(v >> 8));
+}
+
+static void Put32(std::string& out, uint32_t v)
+{
+	for (int i = 0; i < 4; ++i)
+		out.push_back((char)((v >> (i * 8)) & 0xFF));
+}
+
+static void Put64(std::string& out, uint64_t v)
+{
+	for (int i = 0; i < 8; ++i)
+		out.push_back((char)((v >> (i * 8)) & 0xFF));
+}
+
+static void Patch32(std::string& out, size_t at, uint32_t v)
+{
+	for (int i = 0; i < 4; ++i)
+		out[at + i] = (char)((v >> (i * 8)) & 0xFF);
+}
+
+static void Patch64(std::string& out, size_t at, uint64_t v)
+{
+	for (int i = 0; i < 8; ++i)
+		out[at + i] = (char)((v >> (i * 8)) & 0xFF);
+}
+
+static uint16_t Get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static uint32_t Get32(const uint8_t* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t Get64(const uint8_t* p)
+{
+	return (uint64_t)Get32(p) | ((uint64_t)Get32(p + 4) << 32);
+}
+
+static void PutFloat(std::string& out, float f)
+{
+	uint32_t bits;
+	memcpy(&bits, &f, 4);
+	Put32(out, bits);
+}
+
+static float GetFloat(const uint8_t* p)
+{
+	uint32_t bits = Get32(p);
+	float f;
+	memcpy(&f, &bits, 4);
+	return f;
+}
+
+// FNV-1a of the JSON name; stable across builds and field reordering
+static uint32_t NameTag(const char* name)
+{
+	uint32_t h = 2166136261u;
+	for (; *name; ++name)
+		h = (h ^ (uint8_t)*name) * 16777619u;
+	return h;
+}
+
+static uint32_t SchemaTag(const HvkField* fields, size_t count, uint32_t h = 2166136261u)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		h = (h ^ NameTag(fields[i].Name)) * 16777619u;
+		h = (h ^ (uint32_t)fields[i].Type) * 16777619u;
+		if (fields[i].Type == HvkFieldType::Object)
+			h = SchemaTag(fields[i].Children, fields[i].ChildCount, h);
+	}
+	return h;
+}
+
+// ------------------------------------------------------------
+// Encode
+// ------------------------------------------------------------
+
+static void EncodeObject(std::string& out, const uint8_t* base, const HvkField* fields, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const HvkField& f = fields[i];
+		const uint8_t* p = f.In(base);
+
+		Put32(out, NameTag(f.Name));
+		out.push_back((char)f.Type);
+		const size_t lenAt = out.size();
+		Put32(out, 0);
+		const size_t start = out.size();
+
+		switch (f.Type)
+		{
+		case HvkFieldType::Bool:
+			out.push_back(*(const bool*)p ? 1 : 0);
+			break;
+		case HvkFieldType::Int32:
+			Put32(out, (uint32_t)*(const int32_t*)p);
+			break;
+		case HvkFieldType::UInt64:
+			Put64(out, *(const uint64_t*)p);
+			break;
+		case HvkFieldType::Float:
+			PutFloat(out, *(const float*)p);
+			break;
+		case HvkFieldType::Vec4:
+		{
+			const ImVec4& v = *(const ImVec4*)p;
+			PutFloat(out, v.x);
+			PutFloat(out, v.y);
+			PutFloat(out, v.z);
+			PutFloat(out, v.w);
+			break;
+		}
+		case HvkFieldType::String:
+			out += *(const std::string*)p;
+			break;
+		case HvkFieldType::WString:
+			out += HvkSchema::ToUtf8(*(const std::wstring*)p);
+			break;
+		case HvkFieldType::CharArray:
+			out.append((const char*)p, strnlen((const char*)p, f.Size));
+			break;
+		case HvkFieldType::Object:
+			EncodeObject(out, p, f.Children, f.ChildCount);
+			break;
+		}
+
+		Patch32(out, lenAt, (uint32_t)(out.size() - start));
+	}
+}
+
+void HvkSnapshot::Encode(std::string& out, const void* object, const HvkField* fields, size_t count)
+{
+	out.clear();
+	out.append(kMagic, sizeof(kMagic));
+	Put16(out, kFormat);
+	Put16(out, (uint16_t)kHeaderSize);
+	Put32(out, SchemaTag(fields, count));
+	Put64(out, 0); // payload size
+	Put64(out, 0); // checksum
+
+	EncodeObject(out, (const uint8_t*)object, fields, count);
+
+	const size_t payload = out.size() - kHeaderSize;
+	Patch64(out, 16, payload);
+	Patch64(out, 24, HashService::Fast64(out.data() + kHeaderSize, payload));
+}
+
+// ------------------------------------------------------------
+// Decode
+// ------------------------------------------------------------
+
+// With base null the records are only walked, so a malformed one is found
+// before anything is written
+static bool DecodeObject(const uint8_t* p, const uint8_t* end, uint8_t* base, const HvkField* fields, size_t count, int depth)
+{
+	if (depth > 16)
+		return false;
+
+	size_t hint = 0;
+
+	while (p < end)
+	{
+		if ((size_t)(end - p) < kRecordHeader)
+			return false;
+
+		const uint32_t tag = Get32(p);
+		const HvkFieldType type = (HvkFieldType)p[4];
+		const uint32_t len = Get32(p + 5);
+		p += kRecordHeader;
+
+		if ((size_t)(end - p) < len)
+			return false;
+
+		const uint8_t* value = p;
+		p += len;
+
+		// records come in table order when the schema hasn't changed
+		const HvkField* f = nullptr;
+		for (size_t n = 0; n < count; ++n)
+		{
+			const size_t i = (hint + n) % count;
+			if (NameTag(fields[i].Name) == tag)
+			{
+				f = &fields[i];
+				hint = i + 1;
+				break;
+			}
+		}
+
+		// new field from a newer build, or a field whose type changed
+		if (!f || f->Type != type)
+			continue;
+
+		if (!base)
+		{
+			if (type == HvkFieldType::Object && !DecodeObject(value, value + len, nullptr, f->Children, f->ChildCount, depth + 1))
+				return false;
+			continue;
+		}
+
+		uint8_t* dst = f->In(base);
+
+		switch (type)
+		{
+		case HvkFieldType::Bool:
+			if (len == 1) *(bool*)dst = value[0] != 0;
+			break;
+		case HvkFieldType::Int32:
+			if (len == 4) *(int32_t*)dst = (int32_t)Get32(value);
+			break;
+		case HvkFieldType::UInt64:
+			if (len == 8) *(uint64_t*)dst = Get64(value);
+			break;
+		case HvkFieldType::Float:
+			if (len == 4) *(float*)dst = GetFloat(value);
+			break;
+		case HvkFieldType::Vec4:
+			if (len == 16)
+				*(ImVec4*)dst = ImVec4(GetFloat(value), GetFloat(value + 4), GetFloat(value + 8), GetFloat(value + 12));
+			break;
+		case HvkFieldType::String:
+			((std::string*)dst)->assign((const char*)value, len);
+			break;
+		case HvkFieldType::WString:
+			*(std::wstring*)dst = HvkSchema::FromUtf8(std::string_view((const char*)value, len));
+			break;
+		case HvkFieldType::CharArray:
+		{
+			size_t n = len < f->Size - 1 ? len : f->Size - 1;
+			memcpy(dst, value, n);
+			dst[n] = 0;
+			break;
+		}
+		case HvkFieldType::Object:
+			if (!DecodeObject(value, value + len, dst, f->Children, f->ChildCount, depth + 1))
+				return false;
+			break;
+		}
+	}
+
+	return true;
+}
+
+static bool Fail(std::string* error, const char* why)
+{
+	if (error)
+		*error = why;
+	return false;
+}
+
+bool HvkSnapshot::Decode(const uint8_t* data, size_t size, void* object, const HvkField* fields, size_t count, std::string* error)
+{
+	if (size < kHeaderSize || memcmp(data, kMagic, sizeof(kMagic)) != 0)
+		return Fail(error, "not a snapshot");
+
+	// the record format itself changed; the JSON is the way forward
+	if (Get16(data + 8) != kFormat)
+		return Fail(error, "unsupported snapshot format");
+
+	const size_t headerSize = Get16(data + 10);
+	const uint64_t payload = Get64(data + 16);
+	const uint64_t checksum = Get64(data + 24);
+
+	if (headerSize < kHeaderSize || headerSize > size || payload != size - headerSize)
+		return Fail(error, "truncated snapshot");
+
+	if (HashService::Fast64(data + headerSize, (size_t)payload) != checksum)
+		return Fail(error, "snapshot checksum mismatch");
+
+	// walk first, apply second: a bad record leaves object as it was
+	if (!DecodeObject(data + headerSize, data + size, nullptr, fields, count, 0))
+		return Fail(error, "malformed snapshot record");
+
+	DecodeObject(data + headerSize, data + size, (uint8_t*)object, fields, count, 0);
+	return true;
+}
+
+// ------------------------------------------------------------
+// Files
+// ------------------------------------------------------------
+
+bool HvkSnapshot::Save(const std::filesystem::path& path, const void* object, const HvkField* fields, size_t count)
+{
+	static thread_local std::string buf;
+	Encode(buf, object, fields, count);
+
+	auto tmp = path;
+	tmp += ".tmp";
+
+	{
+		std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+		if (!out)
+			return false;
+
+		out.write(buf.data(), (std::streamsize)buf.size());
+		if (!out)
+			return false;
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tmp, path, ec);
+	return !ec;
+}
+
+bool HvkSnapshot::Load(const std::filesystem::path& path, void* object, const HvkField* fields, size_t count, std::string* error)
+{
+#ifdef _WIN32
+	HANDLE hFile = CreateFileW(
+		path.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr
+	);
+
+	if (hFile == INVALID_HANDLE_VALUE)
+		return Fail(error, "no snapshot");
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(hFile);
+		return Fail(error, "empty snapshot");
+	}
+
+	if ((uint64_t)size.QuadPart < kMapThreshold)
+	{
+		std::string buf((size_t)size.QuadPart, '\0');
+		DWORD read = 0;
+		const BOOL got = ReadFile(hFile, buf.data(), (DWORD)buf.size(), &read, nullptr);
+		CloseHandle(hFile);
+		if (!got || read != buf.size())
+			return Fail(error, "read failed");
+		return Decode((const uint8_t*)buf.data(), buf.size(), object, fields, count, error);
+	}
+
+	HANDLE hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(hFile);
+	if (!hMap)
+		return Fail(error, "map failed");
+
+	const void* view = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(hMap);
+	if (!view)
+		return Fail(error, "map failed");
+
+	bool ok = Decode((const uint8_t*)view, (size_t)size.QuadPart, object, fields, count, error);
+	UnmapViewOfFile(view);
+	return ok;
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return Fail(error, "no snapshot");
+
+	struct stat st {};
+	if (fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		close(fd);
+		return Fail(error, "empty snapshot");
+	}
+
+	if ((uint64_t)st.st_size < kMapThreshold)
+	{
+		std::string buf((size_t)st.st_size, '\0');
+		const ssize_t got = read(fd, buf.data(), buf.size());
+		close(fd);
+		if (got != (ssize_t)buf.size())
+			return Fail(error, "read failed");
+		return Decode((const uint8_t*)buf.data(), buf.size(), object, fields, count, error);
+	}
+
+	void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+		return Fail(error, "map failed");
+
+	bool ok = Decode((const uint8_t*)view, (size_t)st.st_size, object, fields, count, error);
+	munmap(view, (size_t)st.st_size);
+	return ok;
+#endif
+}
+
+std::filesystem::path HvkSnapshot::PathFor(const std::filesystem::path& jsonPath)
+{
+	auto p = jsonPath;
+	p.replace_extension(kExtension);
+	return p;
+}
+
+bool HvkSnapshot::IsCurrent(const std::filesystem::path& jsonPath)
+{
+	std::error_code ec;
+	const auto snap = std::filesystem::last_write_time(PathFor(jsonPath), ec);
+	if (ec)
+		return false;
+
+	const auto json = std::filesystem::last_write_time(jsonPath, ec);
+	return ec || snap >= json;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "hvk_schema.h"
+
+// Binary twin of the JSON .hvk files, written alongside them (settings.hvkb)
+// and read first on startup. Driven by the same HvkField tables.
+//
+// Layout, all little-endian:
+//   header  "HVKSNAP\0", u16 format, u16 header size, u32 schema tag (diagnostic),
+//           u64 payload size, u64 XXH64 of payload
+//   payload records: u32 name tag, u8 type, u32 length, bytes
+//           (Object records hold nested records)
+//
+// Fields are matched by a hash of their JSON name, so added fields are
+// skipped by older builds and removed or retyped ones keep their defaults.
+// Pointers (ImFont* etc.) aren't in the tables and are never stored.
+
+class HvkSnapshot
+{
+public:
+	static constexpr uint16_t kFormat = 1;
+	static constexpr const char* kExtension = ".hvkb";
+
+	static void Encode(std::string& out, const void* object, const HvkField* fields, size_t count);
+	// Object is only written once the whole payload checked out; on false it is untouched
+	static bool Decode(const uint8_t* data, size_t size, void* object, const HvkField* fields, size_t count, std::string* error = nullptr);
+
+	// Temp file + rename so a crash never leaves a half-written snapshot
+	static bool Save(const std::filesystem::path& path, const void* object, const HvkField* fields, size_t count);
+
+	// Decodes from one read of the file, or from a mapped view past 64 KiB
+	static bool Load(const std::filesystem::path& path, void* object, const HvkField* fields, size_t count, std::string* error = nullptr);
+
+	// Snapshot path for a JSON file, e.g. settings.hvk -> settings.hvkb
+	static std::filesystem::path PathFor(const std::filesystem::path& jsonPath);
+
+	// Snapshot exists and is at least as new as the JSON (hand edits to the JSON win)
+	static bool IsCurrent(const std::filesystem::path& jsonPath);
+
+	template<size_t N>
+	static bool Save(const std::filesystem::path& path, const void* object, const HvkField(&fields)[N]) { return Save(path, object, fields, N); }
+
+	template<size_t N>
+	static bool Load(const std::filesystem::path& path, void* object, const HvkField(&fields)[N], std::string* error = nullptr) { return Load(path, object, fields, N, error); }
+};
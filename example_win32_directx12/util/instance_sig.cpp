@@ -0,0 +1,160 @@
+#include "instance_sig.h"
+#include "hash.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+// ------------------------------------------------------------
+// File stamp
+// ------------------------------------------------------------
+
+bool FileStamp::Read(const std::filesystem::path& path, FileStamp& out)
+{
+#ifdef _WIN32
+	HANDLE h = CreateFileW(
+		path.c_str(),
+		0, // attributes only
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL,
+		nullptr
+	);
+
+	if (h == INVALID_HANDLE_VALUE)
+		return false;
+
+	BY_HANDLE_FILE_INFORMATION info{};
+	BOOL ok = GetFileInformationByHandle(h, &info);
+	CloseHandle(h);
+	if (!ok)
+		return false;
+
+	out.Volume = info.dwVolumeSerialNumber;
+	out.Index = ((uint64_t)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+	out.Size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+	out.WriteTime = (int64_t)(((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime);
+	return true;
+#else
+	struct stat st {};
+	if (stat(path.c_str(), &st) != 0)
+		return false;
+
+	out.Volume = (uint64_t)st.st_dev;
+	out.Index = (uint64_t)st.st_ino;
+	out.Size = (uint64_t)st.st_size;
+	out.WriteTime = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+	return true;
+#endif
+}
+
+// ------------------------------------------------------------
+// Signature
+// ------------------------------------------------------------
+
+std::string InstanceSignature::Build(std::string_view json)
+{
+	HVKSignature sig{};
+	memcpy(sig.magic, "HVKSIG", 6);
+	sig.version = 1;
+
+	Sha256Digest digest = Sha256::Hash(json.data(), json.size());
+	memcpy(sig.hash, digest.Bytes, sizeof(sig.hash));
+
+	std::string out;
+	out.reserve(json.size() + 1 + sizeof(sig));
+	out.append(json);
+	out.push_back('\0');
+	out.append((const char*)&sig, sizeof(sig));
+	return out;
+}
+
+bool InstanceSignature::Verify(const uint8_t* data, size_t size)
+{
+	if (size <= sizeof(HVKSignature) + 1)
+		return false;
+
+	// signature is at the end
+	const size_t sigOffset = size - sizeof(HVKSignature);
+	HVKSignature sig;
+	memcpy(&sig, data + sigOffset, sizeof(sig));
+
+	if (memcmp(sig.magic, "HVKSIG", 6) != 0)
+		return false;
+
+	if (sig.version != 1)
+		return false;
+
+	// JSON must end before the zero separator
+	if (data[sigOffset - 1] != 0)
+		return false;
+
+	Sha256Digest hash = Sha256::Hash(data, sigOffset - 1);
+	return memcmp(hash.Bytes, sig.hash, 32) == 0;
+}
+
+bool InstanceSignature::VerifyFile(const std::filesystem::path& path)
+{
+	std::ifstream in(path, std::ios::binary | std::ios::ate);
+	if (!in)
+		return false;
+
+	const std::streamoff size = in.tellg();
+	if (size <= 0)
+		return false;
+
+	std::vector<uint8_t> data((size_t)size);
+	in.seekg(0);
+	if (!in.read((char*)data.data(), size))
+		return false;
+
+	return Verify(data.data(), data.size());
+}
+
+// ------------------------------------------------------------
+// Cache
+// ------------------------------------------------------------
+
+bool InstanceValidationCache::Get()
+{
+	if (checked.load(std::memory_order_acquire) == requested.load(std::memory_order_acquire))
+		return valid.load(std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// taken before the check: an Invalidate() that lands during it stays pending
+	const uint64_t target = requested.load(std::memory_order_acquire);
+	if (checked.load(std::memory_order_relaxed) == target)
+		return valid.load(std::memory_order_relaxed);   // another caller just did it
+
+	bool ok;
+	FileStamp now;
+	if (!FileStamp::Read(path, now))
+	{
+		haveStamp = false;
+		ok = false;
+	}
+	else if (haveStamp && now == stamp)
+	{
+		ok = valid.load(std::memory_order_relaxed);
+	}
+	else
+	{
+		ok = InstanceSignature::VerifyFile(path);
+		hashes.fetch_add(1, std::memory_order_relaxed);
+		stamp = now;
+		haveStamp = true;
+	}
+
+	// cleared only now, so nobody takes the fast path to the old result
+	valid.store(ok, std::memory_order_relaxed);
+	checked.store(target, std::memory_order_release);
+	return ok;
+}
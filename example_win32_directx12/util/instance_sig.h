@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// instance.hvk = JSON text, one zero byte, HVKSignature (SHA-256 of the JSON).
+// Portable so the format can be produced and checked off Windows too.
+
+#pragma pack(push, 1)
+struct HVKSignature
+{
+	char     magic[6];   // "HVKSIG"
+	uint16_t version;    // for future changes
+	uint8_t  hash[32];   // SHA-256
+	// uint8_t uuidhash[32]; // SHA-256 (HVKUUID)
+};
+#pragma pack(pop)
+
+// What makes a file "the same file, unchanged" without reading it
+struct FileStamp
+{
+	uint64_t Volume = 0;    // volume serial / st_dev
+	uint64_t Index = 0;     // file index / st_ino
+	uint64_t Size = 0;
+	int64_t  WriteTime = 0;
+
+	bool operator==(const FileStamp& o) const
+	{
+		return Volume == o.Volume && Index == o.Index && Size == o.Size && WriteTime == o.WriteTime;
+	}
+	bool operator!=(const FileStamp& o) const { return !(*this == o); }
+
+	static bool Read(const std::filesystem::path& path, FileStamp& out);
+};
+
+class InstanceSignature
+{
+public:
+	// json + '\0' + signature
+	static std::string Build(std::string_view json);
+	static bool Verify(const uint8_t* data, size_t size);
+	static bool VerifyFile(const std::filesystem::path& path);
+};
+
+// Result of VerifyFile kept until the file changes.
+// Get() is an atomic load unless Invalidate() was called (change notification),
+// in which case the file is stat'ed and only re-hashed if its stamp moved.
+// Other callers keep taking the slow path until that re-check has finished.
+class InstanceValidationCache
+{
+public:
+	explicit InstanceValidationCache(std::filesystem::path file) : path(std::move(file)) {}
+
+	bool Get();
+	void Invalidate() { requested.fetch_add(1, std::memory_order_acq_rel); }
+
+	uint64_t HashCount() const { return hashes.load(std::memory_order_relaxed); }
+
+private:
+	std::filesystem::path path;
+
+	std::atomic<uint64_t> requested{ 1 };   // Invalidate() calls, plus the initial check
+	std::atomic<uint64_t> checked{ 0 };     // value of requested the last re-check covered
+	std::atomic<bool> valid{ false };
+	std::atomic<uint64_t> hashes{ 0 };
+
+	std::mutex mutex;   // guards stamp + revalidation
+	FileStamp stamp;
+	bool haveStamp = false;
+};
@@ -0,0 +1,787 @@
+#include "process.h"
+
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// backend helpers, defined at the bottom
+static void RemoveFileUtf8(const std::string& path);
+#ifdef _WIN32
+static std::string ConsoleToUtf8(const std::string& s);
+#endif
+
+// ------------------------------------------------------------
+// Runner state
+// ------------------------------------------------------------
+
+static std::mutex g_RunnerMutex;
+static std::condition_variable g_RunnerCv;
+static int g_MaxConcurrent = 4;
+static int g_Running = 0;
+static std::atomic<uint32_t> g_NextId{ 1 };
+static std::vector<std::weak_ptr<ProcessJob>> g_Jobs;
+
+static uint64_t NowMs()
+{
+	using namespace std::chrono;
+	return (uint64_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ------------------------------------------------------------
+// ProcessJob
+// ------------------------------------------------------------
+
+bool ProcessJob::Done() const
+{
+	ProcessState s = State();
+	return s != ProcessState::Queued && s != ProcessState::Running;
+}
+
+bool ProcessJob::WaitFor(uint32_t ms)
+{
+	std::unique_lock<std::mutex> lock(doneMutex);
+	return doneCv.wait_for(lock, std::chrono::milliseconds(ms), [this]() { return Done(); });
+}
+
+bool ProcessJob::PopLine(ProcessLine& out)
+{
+	if (!lines.Pop(out))
+		return false;
+
+	if (writerWaiting.load(std::memory_order_acquire))
+	{
+		std::lock_guard<std::mutex> lock(spaceMutex);
+		spaceCv.notify_one();
+	}
+	return true;
+}
+
+void ProcessJob::Finish(ProcessState result, int code)
+{
+	{
+		std::lock_guard<std::mutex> lock(doneMutex);
+		exitCode.store(code, std::memory_order_release);
+		state.store(result, std::memory_order_release);
+	}
+	doneCv.notify_all();
+}
+
+// ------------------------------------------------------------
+// ProcessRunner
+// ------------------------------------------------------------
+
+std::shared_ptr<ProcessJob> ProcessRunner::Start(const ProcessRequest& request)
+{
+	auto job = std::make_shared<ProcessJob>();
+	job->id = g_NextId.fetch_add(1);
+	job->request = request;
+
+	{
+		std::lock_guard<std::mutex> lock(g_RunnerMutex);
+
+		// drop finished entries while we're here
+		for (size_t i = 0; i < g_Jobs.size();)
+		{
+			if (g_Jobs[i].expired())
+			{
+				g_Jobs[i] = g_Jobs.back();
+				g_Jobs.pop_back();
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		g_Jobs.push_back(job);
+	}
+
+	std::thread(Worker, job).detach();
+	return job;
+}
+
+bool ProcessRunner::Collect(const std::shared_ptr<ProcessJob>& job, std::string* outLog)
+{
+	if (!job)
+		return false;
+
+	ProcessLine line;
+	for (;;)
+	{
+		const bool done = job->Done();
+
+		while (job->PopLine(line))
+		{
+			if (outLog)
+			{
+				*outLog += line.Text;
+				*outLog += "\r\n";
+			}
+		}
+
+		// Done() is published after the last push, so one more drain catches everything
+		if (done)
+			break;
+
+		job->WaitFor(20);
+	}
+
+	return job->Succeeded();
+}
+
+void ProcessRunner::SetMaxConcurrent(int n)
+{
+	{
+		std::lock_guard<std::mutex> lock(g_RunnerMutex);
+		g_MaxConcurrent = n < 1 ? 1 : n;
+	}
+	g_RunnerCv.notify_all();
+}
+
+int ProcessRunner::RunningCount()
+{
+	std::lock_guard<std::mutex> lock(g_RunnerMutex);
+	return g_Running;
+}
+
+void ProcessRunner::CancelAll(uint32_t waitMs)
+{
+	std::vector<std::shared_ptr<ProcessJob>> live;
+	{
+		std::lock_guard<std::mutex> lock(g_RunnerMutex);
+		for (auto& w : g_Jobs)
+		{
+			if (auto j = w.lock())
+				live.push_back(j);
+		}
+	}
+
+	for (auto& j : live)
+		j->Cancel();
+	g_RunnerCv.notify_all();
+
+	const uint64_t deadline = NowMs() + waitMs;
+	for (auto& j : live)
+	{
+		const uint64_t now = NowMs();
+		if (now >= deadline)
+			break;
+		j->WaitFor((uint32_t)(deadline - now));
+	}
+}
+
+bool ProcessRunner::AcquireSlot(ProcessJob& job)
+{
+	std::unique_lock<std::mutex> lock(g_RunnerMutex);
+
+	// wake up periodically so a queued job still notices Cancel()
+	while (g_Running >= g_MaxConcurrent)
+	{
+		if (job.CancelRequested())
+			return false;
+		g_RunnerCv.wait_for(lock, std::chrono::milliseconds(50));
+	}
+
+	if (job.CancelRequested())
+		return false;
+
+	++g_Running;
+	return true;
+}
+
+void ProcessRunner::ReleaseSlot()
+{
+	{
+		std::lock_guard<std::mutex> lock(g_RunnerMutex);
+		--g_Running;
+	}
+	g_RunnerCv.notify_one();
+}
+
+void ProcessRunner::Worker(std::shared_ptr<ProcessJob> job)
+{
+	if (!AcquireSlot(*job))
+	{
+		PushLine(*job, ProcessStream::Runner, "cancelled before start");
+		if (!job->request.TempFile.empty())
+			RemoveFileUtf8(job->request.TempFile);
+		job->Finish(ProcessState::Cancelled, -1);
+		return;
+	}
+
+	job->state.store(ProcessState::Running, std::memory_order_release);
+
+	int code = -1;
+	ProcessState result = RunChild(*job, code);
+
+	if (!job->request.TempFile.empty())
+		RemoveFileUtf8(job->request.TempFile);
+
+	ReleaseSlot();
+	job->Finish(result, code);
+}
+
+void ProcessRunner::PushLine(ProcessJob& job, ProcessStream stream, std::string text)
+{
+	ProcessLine line;
+	line.Stream = stream;
+#ifdef _WIN32
+	line.Text = stream == ProcessStream::Runner ? std::move(text) : ConsoleToUtf8(text);
+#else
+	line.Text = std::move(text);
+#endif
+
+	if (job.lines.Push(std::move(line)))
+	{
+		job.stalled = false;
+		return;
+	}
+
+	// the consumer gave up (job dropped, UI gone): keep draining the pipes so the
+	// child doesn't block, but don't wait on every line
+	if (job.stalled)
+	{
+		job.dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// consumer is behind: block instead of dropping output.
+	// this also stalls the pipe, which throttles the child.
+	const uint64_t deadline = NowMs() + kConsumerStallMs;
+	std::unique_lock<std::mutex> lock(job.spaceMutex);
+	job.writerWaiting.store(true, std::memory_order_release);
+
+	while (!job.lines.Push(std::move(line)))
+	{
+		const uint64_t now = NowMs();
+		if (job.CancelRequested() || now >= deadline)
+		{
+			job.stalled = !job.CancelRequested();
+			job.dropped.fetch_add(1, std::memory_order_relaxed);
+			break;
+		}
+
+		// timed, so Cancel() is noticed without a notify
+		job.spaceCv.wait_for(lock, std::chrono::milliseconds(deadline - now < 50 ? deadline - now : 50));
+	}
+
+	job.writerWaiting.store(false, std::memory_order_release);
+}
+
+void ProcessRunner::PushChunk(ProcessJob& job, ProcessStream stream, std::string& pending, const char* data, size_t size)
+{
+	for (size_t i = 0; i < size; ++i)
+	{
+		const char c = data[i];
+
+		if (c == '\n')
+		{
+			if (!pending.empty() && pending.back() == '\r')
+				pending.pop_back();
+			PushLine(job, stream, std::move(pending));
+			pending.clear();
+		}
+		else if (c != '\0')
+		{
+			pending += c;
+		}
+	}
+}
+
+void ProcessRunner::FlushPending(ProcessJob& job, ProcessStream stream, std::string& pending)
+{
+	if (!pending.empty() && pending.back() == '\r')
+		pending.pop_back();
+
+	if (!pending.empty())
+		PushLine(job, stream, std::move(pending));
+	pending.clear();
+}
+
+// ------------------------------------------------------------
+// Win32 backend
+// ------------------------------------------------------------
+#ifdef _WIN32
+
+static std::wstring Utf8ToW(const std::string& s)
+{
+	if (s.empty()) return {};
+	int len = MultiByteToWideChar(CP_UTF8, 0, s.c_str(), (int)s.size(), nullptr, 0);
+	std::wstring out(len, L'\0');
+	MultiByteToWideChar(CP_UTF8, 0, s.c_str(), (int)s.size(), out.data(), len);
+	return out;
+}
+
+static void RemoveFileUtf8(const std::string& path)
+{
+	DeleteFileW(Utf8ToW(path).c_str());
+}
+
+// console tools (diskpart included) print in the OEM code page
+static std::string ConsoleToUtf8(const std::string& s)
+{
+	if (s.empty())
+		return s;
+
+	if (MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, s.c_str(), (int)s.size(), nullptr, 0) > 0)
+		return s;
+
+	int wlen = MultiByteToWideChar(CP_OEMCP, 0, s.c_str(), (int)s.size(), nullptr, 0);
+	std::wstring w(wlen, L'\0');
+	MultiByteToWideChar(CP_OEMCP, 0, s.c_str(), (int)s.size(), w.data(), wlen);
+
+	int len = WideCharToMultiByte(CP_UTF8, 0, w.c_str(), wlen, nullptr, 0, nullptr, nullptr);
+	std::string out(len, '\0');
+	WideCharToMultiByte(CP_UTF8, 0, w.c_str(), wlen, out.data(), len, nullptr, nullptr);
+	return out;
+}
+
+static void AppendQuoted(std::wstring& cmd, const std::wstring& arg)
+{
+	if (!arg.empty() && arg.find_first_of(L" \t\"") == std::wstring::npos)
+	{
+		cmd += arg;
+		return;
+	}
+
+	// CommandLineToArgvW rules: backslashes only escape when followed by a quote
+	cmd += L'"';
+	size_t slashes = 0;
+	for (wchar_t c : arg)
+	{
+		if (c == L'\\')
+		{
+			++slashes;
+			continue;
+		}
+
+		if (c == L'"')
+			cmd.append(slashes * 2 + 1, L'\\');
+		else
+			cmd.append(slashes, L'\\');
+
+		slashes = 0;
+		cmd += c;
+	}
+	cmd.append(slashes * 2, L'\\');
+	cmd += L'"';
+}
+
+// reads whatever is buffered without blocking. false once the pipe is closed
+// (ERROR_BROKEN_PIPE: every write end is gone and the buffer is empty).
+static bool DrainPipe(HANDLE pipe, std::string& out)
+{
+	DWORD avail = 0;
+	if (!PeekNamedPipe(pipe, nullptr, 0, nullptr, &avail, nullptr))
+		return false;
+
+	char buf[4096];
+	while (avail > 0)
+	{
+		DWORD read = 0;
+		if (!ReadFile(pipe, buf, avail < sizeof(buf) ? avail : (DWORD)sizeof(buf), &read, nullptr) || read == 0)
+			return false;
+
+		out.append(buf, read);
+		avail -= read;
+	}
+
+	return true;
+}
+
+ProcessState ProcessRunner::RunChild(ProcessJob& job, int& exitCode)
+{
+	const ProcessRequest& req = job.request;
+
+	SECURITY_ATTRIBUTES sa{ sizeof(sa), nullptr, TRUE };
+	HANDLE outRead = nullptr, outWrite = nullptr;
+	HANDLE errRead = nullptr, errWrite = nullptr;
+
+	if (!CreatePipe(&outRead, &outWrite, &sa, 0))
+	{
+		PushLine(job, ProcessStream::Runner, "CreatePipe failed");
+		return ProcessState::FailedToStart;
+	}
+
+	if (!CreatePipe(&errRead, &errWrite, &sa, 0))
+	{
+		CloseHandle(outRead);
+		CloseHandle(outWrite);
+		PushLine(job, ProcessStream::Runner, "CreatePipe failed");
+		return ProcessState::FailedToStart;
+	}
+
+	SetHandleInformation(outRead, HANDLE_FLAG_INHERIT, 0);
+	SetHandleInformation(errRead, HANDLE_FLAG_INHERIT, 0);
+
+	// a GUI process has no usable stdin of its own; give the child NUL
+	HANDLE nulIn = CreateFileW(L"NUL", GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, &sa, OPEN_EXISTING, 0, nullptr);
+
+	// jobs start in parallel and every write end is inheritable, so name exactly
+	// this child's handles. Otherwise a sibling inherits our write end and our
+	// pipe only reports EOF once that sibling exits too.
+	HANDLE inherit[3] = { outWrite, errWrite, nulIn };
+	const DWORD inheritCount = nulIn != INVALID_HANDLE_VALUE ? 3 : 2;
+
+	SIZE_T attrSize = 0;
+	InitializeProcThreadAttributeList(nullptr, 1, 0, &attrSize);
+	std::vector<char> attrBuf(attrSize);
+	auto* attrs = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attrBuf.data());
+
+	bool attrsOk = InitializeProcThreadAttributeList(attrs, 1, 0, &attrSize) != FALSE;
+	if (attrsOk && !UpdateProcThreadAttribute(attrs, 0, PROC_THREAD_ATTRIBUTE_HANDLE_LIST,
+		inherit, inheritCount * sizeof(HANDLE), nullptr, nullptr))
+	{
+		DeleteProcThreadAttributeList(attrs);
+		attrsOk = false;
+	}
+
+	if (!attrsOk)
+	{
+		CloseHandle(outRead);
+		CloseHandle(outWrite);
+		CloseHandle(errRead);
+		CloseHandle(errWrite);
+		if (nulIn != INVALID_HANDLE_VALUE)
+			CloseHandle(nulIn);
+		PushLine(job, ProcessStream::Runner, "could not restrict inherited handles (" + std::to_string(GetLastError()) + ")");
+		return ProcessState::FailedToStart;
+	}
+
+	std::wstring cmd;
+	AppendQuoted(cmd, Utf8ToW(req.Program));
+	for (const auto& a : req.Args)
+	{
+		cmd += L' ';
+		AppendQuoted(cmd, Utf8ToW(a));
+	}
+
+	STARTUPINFOEXW si{};
+	si.StartupInfo.cb = sizeof(si);
+	si.StartupInfo.dwFlags = STARTF_USESTDHANDLES;
+	si.StartupInfo.hStdOutput = outWrite;
+	si.StartupInfo.hStdError = errWrite;
+	si.StartupInfo.hStdInput = nulIn != INVALID_HANDLE_VALUE ? nulIn : nullptr;
+	si.lpAttributeList = attrs;
+
+	PROCESS_INFORMATION pi{};
+
+	// CreateProcessW needs a mutable buffer
+	BOOL ok = CreateProcessW(
+		nullptr,
+		cmd.data(),
+		nullptr, nullptr,
+		TRUE,
+		CREATE_NO_WINDOW | EXTENDED_STARTUPINFO_PRESENT,
+		nullptr, nullptr,
+		&si.StartupInfo,
+		&pi);
+
+	DWORD startError = ok ? 0 : GetLastError();
+	DeleteProcThreadAttributeList(attrs);
+	if (nulIn != INVALID_HANDLE_VALUE)
+		CloseHandle(nulIn);
+
+	CloseHandle(outWrite);
+	CloseHandle(errWrite);
+
+	if (!ok)
+	{
+		CloseHandle(outRead);
+		CloseHandle(errRead);
+		PushLine(job, ProcessStream::Runner, "CreateProcess failed (" + std::to_string(startError) + ")");
+		return ProcessState::FailedToStart;
+	}
+
+	CloseHandle(pi.hThread);
+
+	const uint64_t deadline = req.TimeoutMs ? NowMs() + req.TimeoutMs : 0;
+	ProcessState result = ProcessState::Exited;
+
+	std::string chunk, outPending, errPending;
+	bool outOpen = true, errOpen = true;
+	uint64_t exitedAt = 0;
+
+	// runs until both pipes report EOF, so output written right before the
+	// child exits is never lost. A grandchild that inherited the write ends can
+	// hold them open after the child is gone, so once the child has exited the
+	// pipes only get kExitDrainMs more before they are closed.
+	while (outOpen || errOpen)
+	{
+		bool gotData = false;
+
+		if (outOpen)
+		{
+			chunk.clear();
+			outOpen = DrainPipe(outRead, chunk);
+			if (!chunk.empty())
+			{
+				PushChunk(job, ProcessStream::Stdout, outPending, chunk.data(), chunk.size());
+				gotData = true;
+			}
+		}
+
+		if (errOpen)
+		{
+			chunk.clear();
+			errOpen = DrainPipe(errRead, chunk);
+			if (!chunk.empty())
+			{
+				PushChunk(job, ProcessStream::Stderr, errPending, chunk.data(), chunk.size());
+				gotData = true;
+			}
+		}
+
+		if (!exitedAt && WaitForSingleObject(pi.hProcess, 0) == WAIT_OBJECT_0)
+			exitedAt = NowMs();
+
+		if (exitedAt && NowMs() - exitedAt >= kExitDrainMs)
+			break;
+
+		if (job.CancelRequested())
+		{
+			TerminateProcess(pi.hProcess, 1);
+			result = ProcessState::Cancelled;
+			break;
+		}
+
+		if (deadline && NowMs() >= deadline)
+		{
+			TerminateProcess(pi.hProcess, 1);
+			result = ProcessState::TimedOut;
+			break;
+		}
+
+		if (!gotData)
+		{
+			if (exitedAt)
+				Sleep(1);
+			else
+				WaitForSingleObject(pi.hProcess, 10);
+		}
+	}
+
+	WaitForSingleObject(pi.hProcess, INFINITE);
+
+	DWORD code = 1;
+	GetExitCodeProcess(pi.hProcess, &code);
+	exitCode = (int)code;
+
+	CloseHandle(pi.hProcess);
+	CloseHandle(outRead);
+	CloseHandle(errRead);
+
+	FlushPending(job, ProcessStream::Stdout, outPending);
+	FlushPending(job, ProcessStream::Stderr, errPending);
+
+	if (result == ProcessState::Cancelled)
+		PushLine(job, ProcessStream::Runner, "cancelled");
+	else if (result == ProcessState::TimedOut)
+		PushLine(job, ProcessStream::Runner, "timed out after " + std::to_string(req.TimeoutMs) + " ms");
+
+	return result;
+}
+
+#else
+// ------------------------------------------------------------
+// POSIX backend
+// ------------------------------------------------------------
+
+static void RemoveFileUtf8(const std::string& path)
+{
+	unlink(path.c_str());
+}
+
+static void CloseFd(int& fd)
+{
+	if (fd >= 0)
+		close(fd);
+	fd = -1;
+}
+
+// both ends close-on-exec from the start, so a job spawned concurrently on
+// another worker can't inherit them and hold this job's pipes open.
+// dup2 clears the flag on the child's stdout/stderr copies
+static int OpenPipe(int fds[2])
+{
+#ifdef __linux__
+	return pipe2(fds, O_CLOEXEC);
+#else
+	if (pipe(fds) != 0)
+		return -1;
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+	return 0;
+#endif
+}
+
+// false once the write end is closed
+static bool DrainFd(int fd, std::string& out)
+{
+	char buf[4096];
+	for (;;)
+	{
+		ssize_t n = read(fd, buf, sizeof(buf));
+		if (n > 0)
+		{
+			out.append(buf, (size_t)n);
+			continue;
+		}
+
+		if (n == 0)
+			return false;
+
+		return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+	}
+}
+
+ProcessState ProcessRunner::RunChild(ProcessJob& job, int& exitCode)
+{
+	const ProcessRequest& req = job.request;
+
+	int outPipe[2] = { -1, -1 };
+	int errPipe[2] = { -1, -1 };
+
+	if (OpenPipe(outPipe) != 0 || OpenPipe(errPipe) != 0)
+	{
+		CloseFd(outPipe[0]); CloseFd(outPipe[1]);
+		PushLine(job, ProcessStream::Runner, "pipe failed");
+		return ProcessState::FailedToStart;
+	}
+
+	for (int fd : { outPipe[0], errPipe[0] })
+		fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	// build argv before fork, the child may only call async-signal-safe functions
+	std::vector<char*> argv;
+	argv.push_back(const_cast<char*>(req.Program.c_str()));
+	for (const auto& a : req.Args)
+		argv.push_back(const_cast<char*>(a.c_str()));
+	argv.push_back(nullptr);
+
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		CloseFd(outPipe[0]); CloseFd(outPipe[1]);
+		CloseFd(errPipe[0]); CloseFd(errPipe[1]);
+		PushLine(job, ProcessStream::Runner, "fork failed");
+		return ProcessState::FailedToStart;
+	}
+
+	if (pid == 0)
+	{
+		// own process group so cancel also takes down anything a script spawns
+		setpgid(0, 0);
+		dup2(outPipe[1], STDOUT_FILENO);
+		dup2(errPipe[1], STDERR_FILENO);
+		close(outPipe[0]); close(outPipe[1]);
+		close(errPipe[0]); close(errPipe[1]);
+
+		execvp(argv[0], argv.data());
+		_exit(127);
+	}
+
+	// again from this side: the cancel/timeout kill(-pid) below must find the
+	// group even if the child hasn't run yet. EACCES after its exec is harmless
+	setpgid(pid, pid);
+
+	CloseFd(outPipe[1]);
+	CloseFd(errPipe[1]);
+
+	const uint64_t deadline = req.TimeoutMs ? NowMs() + req.TimeoutMs : 0;
+	ProcessState result = ProcessState::Exited;
+
+	std::string chunk, outPending, errPending;
+	int status = 0;
+	bool reaped = false;
+
+	// runs until the child is reaped: the pipes can hit EOF well before that
+	// (a child that closes stdout), and the timeout still has to apply
+	for (;;)
+	{
+		pollfd fds[2];
+		nfds_t count = 0;
+		if (outPipe[0] >= 0) fds[count++] = { outPipe[0], POLLIN, 0 };
+		if (errPipe[0] >= 0) fds[count++] = { errPipe[0], POLLIN, 0 };
+
+		// with both pipes closed this only paces the waitpid polling
+		poll(count ? fds : nullptr, count, count ? 20 : 5);
+
+		chunk.clear();
+		if (outPipe[0] >= 0 && !DrainFd(outPipe[0], chunk))
+			CloseFd(outPipe[0]);
+		PushChunk(job, ProcessStream::Stdout, outPending, chunk.data(), chunk.size());
+
+		chunk.clear();
+		if (errPipe[0] >= 0 && !DrainFd(errPipe[0], chunk))
+			CloseFd(errPipe[0]);
+		PushChunk(job, ProcessStream::Stderr, errPending, chunk.data(), chunk.size());
+
+		if (job.CancelRequested())
+		{
+			kill(-pid, SIGKILL);
+			result = ProcessState::Cancelled;
+			break;
+		}
+
+		if (deadline && NowMs() >= deadline)
+		{
+			kill(-pid, SIGKILL);
+			result = ProcessState::TimedOut;
+			break;
+		}
+
+		// a grandchild can keep the pipes open after the child exits
+		if (!reaped && waitpid(pid, &status, WNOHANG) == pid)
+			reaped = true;
+		if (reaped)
+		{
+			chunk.clear();
+			if (outPipe[0] >= 0) DrainFd(outPipe[0], chunk);
+			PushChunk(job, ProcessStream::Stdout, outPending, chunk.data(), chunk.size());
+			chunk.clear();
+			if (errPipe[0] >= 0) DrainFd(errPipe[0], chunk);
+			PushChunk(job, ProcessStream::Stderr, errPending, chunk.data(), chunk.size());
+			break;
+		}
+	}
+
+	CloseFd(outPipe[0]);
+	CloseFd(errPipe[0]);
+
+	// only after SIGKILL, so this returns promptly
+	if (!reaped)
+	{
+		while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+	}
+
+	if (WIFEXITED(status))
+		exitCode = WEXITSTATUS(status);
+	else if (WIFSIGNALED(status))
+		exitCode = 128 + WTERMSIG(status);
+
+	FlushPending(job, ProcessStream::Stdout, outPending);
+	FlushPending(job, ProcessStream::Stderr, errPending);
+
+	if (result == ProcessState::Exited && exitCode == 127)
+		PushLine(job, ProcessStream::Runner, "exit 127 (program not found?)");
+	else if (result == ProcessState::Cancelled)
+		PushLine(job, ProcessStream::Runner, "cancelled");
+	else if (result == ProcessState::TimedOut)
+		PushLine(job, ProcessStream::Runner, "timed out after " + std::to_string(req.TimeoutMs) + " ms");
+
+	return result;
+}
+
+#endif
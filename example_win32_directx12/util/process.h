@@ -0,0 +1,170 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Off-thread child process runner.
+// Each job gets a worker thread that owns the pipes, splits stdout/stderr into
+// lines and pushes them through a lock-free queue the UI drains every frame.
+// Win32 backend uses CreateProcess, everything else fork/exec.
+
+enum class ProcessStream : uint8_t
+{
+	Stdout,
+	Stderr,
+	Runner      // messages from the runner itself (spawn errors, timeout, cancel)
+};
+
+enum class ProcessState : uint8_t
+{
+	Queued,     // waiting for a concurrency slot
+	Running,
+	Exited,
+	FailedToStart,
+	Cancelled,
+	TimedOut
+};
+
+struct ProcessLine
+{
+	ProcessStream Stream = ProcessStream::Stdout;
+	std::string Text;   // UTF-8, no line terminator
+};
+
+struct ProcessRequest
+{
+	std::string Program;            // UTF-8 path, or a name resolved through PATH
+	std::vector<std::string> Args;
+	uint32_t TimeoutMs = 0;         // 0 = no timeout
+	std::string TempFile;           // deleted once the process is gone (diskpart scripts etc.)
+};
+
+// Single producer / single consumer ring buffer. Capacity must be a power of two.
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+	static_assert(Capacity && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+public:
+	bool Push(T&& v)
+	{
+		const size_t h = head.load(std::memory_order_relaxed);
+		if (h - tail.load(std::memory_order_acquire) == Capacity)
+			return false;
+
+		slots[h & (Capacity - 1)] = std::move(v);
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool Pop(T& out)
+	{
+		const size_t t = tail.load(std::memory_order_relaxed);
+		if (t == head.load(std::memory_order_acquire))
+			return false;
+
+		out = std::move(slots[t & (Capacity - 1)]);
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool Empty() const
+	{
+		return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+	}
+
+private:
+	T slots[Capacity];
+	alignas(64) std::atomic<size_t> head{ 0 };
+	alignas(64) std::atomic<size_t> tail{ 0 };
+};
+
+class ProcessJob
+{
+public:
+	uint32_t Id() const { return id; }
+	ProcessState State() const { return state.load(std::memory_order_acquire); }
+	int ExitCode() const { return exitCode.load(std::memory_order_acquire); }
+
+	bool Done() const;
+	bool Succeeded() const { return State() == ProcessState::Exited && ExitCode() == 0; }
+
+	// Kills the child (or drops the job if it is still queued)
+	void Cancel() { cancel.store(true, std::memory_order_release); }
+	bool CancelRequested() const { return cancel.load(std::memory_order_acquire); }
+
+	// Consumer side, call from one thread only
+	bool PopLine(ProcessLine& out);
+
+	// Lines thrown away because the consumer stopped draining for kConsumerStallMs
+	uint64_t DroppedLines() const { return dropped.load(std::memory_order_acquire); }
+
+	// Returns true once the job finished, false on timeout
+	bool WaitFor(uint32_t ms);
+
+private:
+	friend class ProcessRunner;
+
+	void Finish(ProcessState result, int code);
+
+	uint32_t id = 0;
+	ProcessRequest request;
+
+	std::atomic<ProcessState> state{ ProcessState::Queued };
+	std::atomic<int> exitCode{ -1 };
+	std::atomic<bool> cancel{ false };
+
+	SpscQueue<ProcessLine, 1024> lines;
+
+	// producer blocks here while the queue is full, PopLine wakes it
+	std::mutex spaceMutex;
+	std::condition_variable spaceCv;
+	std::atomic<bool> writerWaiting{ false };
+	std::atomic<uint64_t> dropped{ 0 };
+	bool stalled = false;       // worker thread only: drop without waiting until the queue drains
+
+	std::mutex doneMutex;
+	std::condition_variable doneCv;
+};
+
+class ProcessRunner
+{
+public:
+	// How long the worker blocks on a full line queue before it starts dropping output
+	static constexpr uint32_t kConsumerStallMs = 5000;
+
+	// Win32: how long the pipes are still read after the child exited. Bounds the
+	// wait when a grandchild keeps the write ends open.
+	static constexpr uint32_t kExitDrainMs = 500;
+
+	// Queues the request and returns immediately. Never returns null.
+	static std::shared_ptr<ProcessJob> Start(const ProcessRequest& request);
+
+	// Blocking convenience: drains the job's output into `outLog` (CRLF joined)
+	// until it finishes. Returns Succeeded().
+	static bool Collect(const std::shared_ptr<ProcessJob>& job, std::string* outLog);
+
+	// Upper bound of children running at once, extra jobs wait in Queued
+	static void SetMaxConcurrent(int n);
+	static int RunningCount();
+
+	// Cancels every live job and waits up to `waitMs` for them to wind down
+	static void CancelAll(uint32_t waitMs = 2000);
+
+private:
+	static void Worker(std::shared_ptr<ProcessJob> job);
+	static bool AcquireSlot(ProcessJob& job);
+	static void ReleaseSlot();
+
+	// backend: spawns, pumps output, enforces cancel/timeout. Returns the final state.
+	static ProcessState RunChild(ProcessJob& job, int& exitCode);
+	static void PushLine(ProcessJob& job, ProcessStream stream, std::string text);
+	static void PushChunk(ProcessJob& job, ProcessStream stream, std::string& pending, const char* data, size_t size);
+	static void FlushPending(ProcessJob& job, ProcessStream stream, std::string& pending);
+};
@@ -402,22 +402,23 @@ bool USBHelper::ExtractVidPid(const std::string& src, std::string& vid, std::str
 
 std::string USBHelper::BuildCompositeKey(const UsbSignature& sig)
 {
-	return sig.vid + "|" +
-		sig.pid + "|" +
-		sig.serial + "|" +
-		sig.manufacturer + "|" +
-		sig.product;
+	return UsbRegistry::CompositeKey(sig);
 }
 
 
-bool USBHelper::GetInfoByDriveLetter(char driveLetter, UsbSignature& out)
-{
-	// 1) Open volume (E:, F:, etc)
-	char volumePath[] = "\\\\.\\X:";
-	volumePath[4] = driveLetter;
+// ------------------------------------------------------------
+// Enumeration
+// ------------------------------------------------------------
 
-	HANDLE hVolume = CreateFileA(
-		volumePath,
+// GUID_DEVINTERFACE_DISK, spelled out so we don't depend on which header
+// happened to instantiate it
+static const GUID kDiskInterface =
+	{ 0x53f56307, 0xb6bf, 0x11d0, { 0x94, 0xf2, 0x00, 0xa0, 0xc9, 0x1e, 0xfb, 0x8b } };
+
+static bool QueryDeviceNumber(const char* path, DWORD& number)
+{
+	HANDLE h = CreateFileA(
+		path,
 		0,
 		FILE_SHARE_READ | FILE_SHARE_WRITE,
 		nullptr,
@@ -426,167 +427,362 @@ bool USBHelper::GetInfoByDriveLetter(char driveLetter, UsbSignature& out)
 		nullptr
 	);
 
-	if (hVolume == INVALID_HANDLE_VALUE)
+	if (h == INVALID_HANDLE_VALUE)
 		return false;
 
-	STORAGE_DEVICE_NUMBER volDevNum{};
+	STORAGE_DEVICE_NUMBER dn{};
 	DWORD bytes = 0;
-
-	if (!DeviceIoControl(
-		hVolume,
+	BOOL ok = DeviceIoControl(
+		h,
 		IOCTL_STORAGE_GET_DEVICE_NUMBER,
 		nullptr,
 		0,
-		&volDevNum,
-		sizeof(volDevNum),
+		&dn,
+		sizeof(dn),
 		&bytes,
-		nullptr))
-	{
-		CloseHandle(hVolume);
+		nullptr);
+
+	CloseHandle(h);
+
+	if (!ok || dn.DeviceType != FILE_DEVICE_DISK)
 		return false;
+
+	number = dn.DeviceNumber;
+	return true;
+}
+
+static bool QueryLetterDeviceNumber(char letter, DWORD& number)
+{
+	char volumePath[] = "\\\\.\\X:";
+	volumePath[4] = letter;
+	return QueryDeviceNumber(volumePath, number);
+}
+
+// Walk up from the disk devnode to the USB VID/PID node and fill the signature
+static bool ReadUsbParent(HDEVINFO hInfo, DEVINST diskInst, UsbSignature& out)
+{
+	char buffer[512];
+	DEVINST devInst = diskInst;
+	DEVINST parentInst = 0;
+
+	while (CM_Get_Parent(&parentInst, devInst, 0) == CR_SUCCESS)
+	{
+		char parentId[MAX_DEVICE_ID_LEN]{};
+
+		if (CM_Get_Device_IDA(
+			parentInst,
+			parentId,
+			MAX_DEVICE_ID_LEN,
+			0) != CR_SUCCESS)
+			break;
+
+		std::string pidStr = parentId;
+
+		if (pidStr.find("USB\\VID_") != std::string::npos)
+		{
+			USBHelper::ExtractVidPid(pidStr, out.vid, out.pid);
+
+			auto slash = pidStr.rfind('\\');
+			if (slash != std::string::npos)
+			{
+				std::string serial = pidStr.substr(slash + 1);
+				if (serial.find('&') == std::string::npos)
+					out.serial = serial;
+			}
+
+			SP_DEVINFO_DATA usbDev{};
+			usbDev.cbSize = sizeof(usbDev);
+			usbDev.DevInst = parentInst;
+
+			buffer[0] = 0;
+			SetupDiGetDeviceRegistryPropertyA(
+				hInfo,
+				&usbDev,
+				SPDRP_MFG,
+				nullptr,
+				(PBYTE)buffer,
+				sizeof(buffer),
+				nullptr);
+
+			out.manufacturer = buffer;
+
+			buffer[0] = 0;
+			SetupDiGetDeviceRegistryPropertyA(
+				hInfo,
+				&usbDev,
+				SPDRP_FRIENDLYNAME,
+				nullptr,
+				(PBYTE)buffer,
+				sizeof(buffer),
+				nullptr);
+
+			out.product = buffer;
+
+			USBHelper::FillExtendedUsbInfo(hInfo, usbDev, out);
+			return true;
+		}
+
+		devInst = parentInst;
 	}
 
-	CloseHandle(hVolume);
+	return false;
+}
 
-	// 2) Enumerate disk drives
-	HDEVINFO hDiskInfo = SetupDiGetClassDevsA(
-		&GUID_DEVCLASS_DISKDRIVE,
+bool USBHelper::EnumerateUsbDisks(std::vector<UsbDeviceRecord>& out)
+{
+	out.clear();
+
+	HDEVINFO hInfo = SetupDiGetClassDevsA(
+		&kDiskInterface,
 		nullptr,
 		nullptr,
-		DIGCF_PRESENT
+		DIGCF_PRESENT | DIGCF_DEVICEINTERFACE
 	);
 
-	if (hDiskInfo == INVALID_HANDLE_VALUE)
+	if (hInfo == INVALID_HANDLE_VALUE)
 		return false;
 
-	SP_DEVINFO_DATA diskDev{};
-	diskDev.cbSize = sizeof(diskDev);
+	SP_DEVICE_INTERFACE_DATA iface{};
+	iface.cbSize = sizeof(iface);
 
-	char buffer[512];
+	std::vector<uint8_t> detailBuf;
 
-	for (DWORD i = 0; SetupDiEnumDeviceInfo(hDiskInfo, i, &diskDev); ++i)
+	for (DWORD i = 0; SetupDiEnumDeviceInterfaces(hInfo, nullptr, &kDiskInterface, i, &iface); ++i)
 	{
-		// Get disk instance ID
-		if (!SetupDiGetDeviceInstanceIdA(
-			hDiskInfo,
-			&diskDev,
-			buffer,
-			sizeof(buffer),
-			nullptr))
+		DWORD needed = 0;
+		SetupDiGetDeviceInterfaceDetailA(hInfo, &iface, nullptr, 0, &needed, nullptr);
+		if (needed == 0)
 			continue;
 
-		// Open physical drive N
-		char physPath[64];
-		sprintf_s(physPath, "\\\\.\\PhysicalDrive%lu", i);
-
-		HANDLE hDisk = CreateFileA(
-			physPath,
-			0,
-			FILE_SHARE_READ | FILE_SHARE_WRITE,
-			nullptr,
-			OPEN_EXISTING,
-			0,
-			nullptr
-		);
-
-		if (hDisk == INVALID_HANDLE_VALUE)
+		detailBuf.assign(needed, 0);
+		auto* detail = (SP_DEVICE_INTERFACE_DETAIL_DATA_A*)detailBuf.data();
+		detail->cbSize = sizeof(SP_DEVICE_INTERFACE_DETAIL_DATA_A);
+
+		SP_DEVINFO_DATA diskDev{};
+		diskDev.cbSize = sizeof(diskDev);
+
+		if (!SetupDiGetDeviceInterfaceDetailA(hInfo, &iface, detail, needed, nullptr, &diskDev))
 			continue;
 
-		STORAGE_DEVICE_NUMBER diskNum{};
-		if (!DeviceIoControl(
-			hDisk,
-			IOCTL_STORAGE_GET_DEVICE_NUMBER,
-			nullptr,
-			0,
-			&diskNum,
-			sizeof(diskNum),
-			&bytes,
-			nullptr))
-		{
-			CloseHandle(hDisk);
+		// Device number comes from the disk itself, not the enumeration index
+		DWORD number = 0;
+		if (!QueryDeviceNumber(detail->DevicePath, number))
 			continue;
-		}
 
-		CloseHandle(hDisk);
+		UsbDeviceRecord rec;
+		rec.DeviceNumber = number;
 
-		// Match volume → disk
-		if (diskNum.DeviceNumber != volDevNum.DeviceNumber)
+		if (!ReadUsbParent(hInfo, diskDev.DevInst, rec.Sig))
 			continue;
 
-		// 3) Walk up to parent USB device
-		DEVINST devInst = diskDev.DevInst;
-		DEVINST parentInst = 0;
+		char instanceId[MAX_DEVICE_ID_LEN]{};
+		if (SetupDiGetDeviceInstanceIdA(hInfo, &diskDev, instanceId, sizeof(instanceId), nullptr))
+			rec.InstanceId = instanceId;
 
-		while (CM_Get_Parent(&parentInst, devInst, 0) == CR_SUCCESS)
-		{
-			char parentId[MAX_DEVICE_ID_LEN]{};
+		out.push_back(std::move(rec));
+	}
 
-			if (CM_Get_Device_IDA(
-				parentInst,
-				parentId,
-				MAX_DEVICE_ID_LEN,
-				0) != CR_SUCCESS)
-				break;
+	SetupDiDestroyDeviceInfoList(hInfo);
+
+	// Volume letters: one open per mounted letter
+	DWORD drives = GetLogicalDrives();
+	for (int l = 0; l < 26; ++l)
+	{
+		if (!(drives & (1u << l)))
+			continue;
 
-			std::string pidStr = parentId;
+		DWORD number = 0;
+		if (!QueryLetterDeviceNumber((char)('A' + l), number))
+			continue;
 
-			// Look for USB VID/PID node
-			if (pidStr.find("USB\\VID_") != std::string::npos)
+		for (auto& rec : out)
+		{
+			if (rec.DeviceNumber == number)
 			{
-				// Extract VID / PID / serial
-				ExtractVidPid(pidStr, out.vid, out.pid);
-
-				auto slash = pidStr.rfind('\\');
-				if (slash != std::string::npos)
-				{
-					std::string serial = pidStr.substr(slash + 1);
-					if (serial.find('&') == std::string::npos)
-						out.serial = serial;
-				}
-
-				// Now pull properties from THIS devnode
-				SP_DEVINFO_DATA usbDev{};
-				usbDev.cbSize = sizeof(usbDev);
-
-				usbDev.DevInst = parentInst;
-
-				// Manufacturer
-				SetupDiGetDeviceRegistryPropertyA(
-					hDiskInfo,
-					&usbDev,
-					SPDRP_MFG,
-					nullptr,
-					(PBYTE)buffer,
-					sizeof(buffer),
-					nullptr);
-
-				out.manufacturer = buffer;
-
-				// Friendly name
-				SetupDiGetDeviceRegistryPropertyA(
-					hDiskInfo,
-					&usbDev,
-					SPDRP_FRIENDLYNAME,
-					nullptr,
-					(PBYTE)buffer,
-					sizeof(buffer),
-					nullptr);
-
-				out.product = buffer;
-
-				// Extended properties
-				FillExtendedUsbInfo(hDiskInfo, usbDev, out);
-
-				SetupDiDestroyDeviceInfoList(hDiskInfo);
-				return true;
+				rec.Letters.push_back((char)('A' + l));
+				break;
 			}
+		}
+	}
+
+	return true;
+}
+
+
+// ------------------------------------------------------------
+// Registry
+// ------------------------------------------------------------
+
+static bool g_UsbRegistryReady = false;   // guarded by USBHelper::Mutex()
+
+std::recursive_mutex& USBHelper::Mutex()
+{
+	static std::recursive_mutex m;
+	return m;
+}
+
+UsbRegistry& USBHelper::Registry()
+{
+	static UsbRegistry registry;
+	return registry;
+}
+
+uint64_t USBHelper::RegistryGeneration()
+{
+	std::lock_guard<std::recursive_mutex> lock(Mutex());
+	return Registry().Generation();
+}
+
+// EnumerateUsbDisks is the slow part and never runs under Mutex(): the callers
+// below drop their lock before they get here
+void USBHelper::RefreshRegistry()
+{
+	std::vector<UsbDeviceRecord> list;
+	if (!EnumerateUsbDisks(list))
+		return;
+
+	std::lock_guard<std::recursive_mutex> lock(Mutex());
+	Registry().Reset(std::move(list));
+	g_UsbRegistryReady = true;
+}
+
+void USBHelper::OnVolumeArrival(DWORD unitMask)
+{
+	std::unique_lock<std::recursive_mutex> lock(Mutex());
+
+	if (!g_UsbRegistryReady)
+	{
+		lock.unlock();
+		RefreshRegistry();
+		return;
+	}
+
+	UsbRegistry& reg = Registry();
+
+	for (int l = 0; l < 26; ++l)
+	{
+		if (!(unitMask & (1u << l)))
+			continue;
+
+		const char letter = (char)('A' + l);
 
-			devInst = parentInst;
+		DWORD number = 0;
+		if (!QueryLetterDeviceNumber(letter, number))
+		{
+			reg.ClearLetter(letter);
+			continue;
+		}
+
+		// Known disk, new volume on it
+		if (reg.FindByDeviceNumber(number))
+		{
+			reg.AssignLetter(letter, number);
+			continue;
 		}
+
+		// New disk: one enumeration pass picks up it and every letter it has
+		lock.unlock();
+		RefreshRegistry();
+		return;
 	}
+}
 
-	SetupDiDestroyDeviceInfoList(hDiskInfo);
-	return false;
+void USBHelper::OnVolumeRemoval(DWORD unitMask)
+{
+	std::lock_guard<std::recursive_mutex> lock(Mutex());
+
+	if (!g_UsbRegistryReady)
+		return;
+
+	UsbRegistry& reg = Registry();
+
+	for (int l = 0; l < 26; ++l)
+	{
+		if (!(unitMask & (1u << l)))
+			continue;
+
+		const char letter = (char)('A' + l);
+		const UsbDeviceRecord* rec = reg.FindByLetter(letter);
+		if (!rec)
+			continue;
+
+		const uint32_t number = rec->DeviceNumber;
+		reg.ClearLetter(letter);
+
+		// Last volume gone and the disk no longer answers: drop it
+		const UsbDeviceRecord* after = reg.FindByDeviceNumber(number);
+		if (after && after->Letters.empty())
+		{
+			char physPath[64];
+			sprintf_s(physPath, "\\\\.\\PhysicalDrive%u", number);
+
+			DWORD still = 0;
+			if (!QueryDeviceNumber(physPath, still))
+				reg.Remove(number);
+		}
+	}
+}
+
+UsbTrustList& USBHelper::TrustList()
+{
+	static UsbTrustList list;
+	return list;
+}
+
+UsbTrust USBHelper::CheckDrive(char driveLetter, bool* isUsb)
+{
+	UsbSignature sig{};
+	const bool usb = GetInfoByDriveLetter(driveLetter, sig);
+	if (isUsb)
+		*isUsb = usb;
+	if (!usb)
+		return UsbTrust::Unknown;
+
+	std::lock_guard<std::recursive_mutex> lock(Mutex());
+	return TrustList().Check(sig);
+}
+
+
+bool USBHelper::GetInfoByDriveLetter(char driveLetter, UsbSignature& out)
+{
+	std::unique_lock<std::recursive_mutex> lock(Mutex());
+
+	if (!g_UsbRegistryReady)
+	{
+		lock.unlock();
+		RefreshRegistry();
+		lock.lock();
+	}
+
+	const UsbDeviceRecord* rec = Registry().FindByLetter(driveLetter);
+
+	// Missed a notification (no window yet, or a letter remap): patch just this letter.
+	// A letter that isn't USB at all would re-enumerate on every call, so its miss is kept.
+	if (!rec)
+	{
+		if (driveLetter >= 'a' && driveLetter <= 'z')
+			driveLetter = (char)(driveLetter - 'a' + 'A');
+		if (driveLetter < 'A' || driveLetter > 'Z')
+			return false;
+
+		const uint64_t now = GetTickCount64();
+		if (Registry().RecentMiss(driveLetter, now))
+			return false;
+
+		lock.unlock();
+		OnVolumeArrival(1u << (driveLetter - 'A'));
+		lock.lock();
+		rec = Registry().FindByLetter(driveLetter);
+
+		if (!rec)
+			Registry().RememberMiss(driveLetter, now);
+	}
+
+	if (!rec)
+		return false;
+
+	out = rec->Sig;
+	return true;
 }
 
 bool USBHelper::UsbMatches(const UsbSignature& a, const UsbSignature& b)
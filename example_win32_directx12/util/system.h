@@ -1,5 +1,6 @@
 #pragma once
 #include <windows.h>
+#include <mutex>
 #include <thread>
 #include "imgui.h"
 #include <string>
@@ -10,6 +11,8 @@
 #include <cfgmgr32.h>
 #include <devpkey.h>
 #include <devguid.h>
+#include "usb_registry.h"
+#include "usb_trust.h"
 
 struct Resolution
 {
@@ -118,25 +121,29 @@ private:
 };
 
 
-struct UsbSignature
-{
-	std::string vid;
-	std::string pid;
-	std::string serial;
-	std::string manufacturer;
-	std::string product;
-
-	std::wstring classGuid;
-	std::wstring driverKey;
-
-	GUID containerId{};
-	DWORD reportedIdHash = 0;
-};
-
-
 class USBHelper 
 {
 public:
+	// One SetupDi pass over all disks; letters resolved from mounted volumes
+	static bool EnumerateUsbDisks(std::vector<UsbDeviceRecord>& out);
+
+	// Process-wide index, filled lazily and patched from WM_DEVICECHANGE.
+	// The startup probe fills it on a worker, so every USBHelper entry point
+	// takes Mutex(); direct Registry() / TrustList() use must hold it too.
+	// Device enumeration runs outside it, so don't hold it across calls that
+	// may enumerate (RefreshRegistry, OnVolumeArrival, GetInfoByDriveLetter).
+	static std::recursive_mutex& Mutex();
+	static UsbRegistry& Registry();
+	static uint64_t RegistryGeneration();
+	static void RefreshRegistry();
+	static void OnVolumeArrival(DWORD unitMask);
+	static void OnVolumeRemoval(DWORD unitMask);
+
+	// Allow/deny list, see usb_trust.h
+	static UsbTrustList& TrustList();
+	// isUsb tells "not a USB drive" apart from "USB, not on the list" (both Unknown)
+	static UsbTrust CheckDrive(char driveLetter, bool* isUsb = nullptr);
+
 	static void FillExtendedUsbInfo(
 		HDEVINFO hInfo,
 		SP_DEVINFO_DATA& devInfo,
@@ -0,0 +1,405 @@
+#include "task_graph.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+
+TaskGraph::~TaskGraph()
+{
+	Cancel();
+	Wait();
+}
+
+double TaskGraph::Now() const
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int TaskGraph::Add(std::string name, TaskFn fn, std::vector<int> deps, TaskAffinity affinity)
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	if (started)
+		return -1;
+
+	const int id = (int)tasks.size();
+	for (int d : deps)
+	{
+		if (d < 0 || d >= id)
+			return -1;
+	}
+
+	std::sort(deps.begin(), deps.end());
+	deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+
+	Task t;
+	t.Name = std::move(name);
+	t.Fn = std::move(fn);
+	t.Deps = std::move(deps);
+	t.Affinity = affinity;
+	t.Waiting = (int)t.Deps.size();
+	t.Timing.Name = t.Name;
+	t.Timing.Affinity = affinity;
+	tasks.push_back(std::move(t));
+
+	for (int d : tasks[id].Deps)
+		tasks[d].Dependents.push_back(id);
+
+	return id;
+}
+
+void TaskGraph::Start(int threads)
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	if (started)
+		return;
+
+	started = true;
+	t0 = std::chrono::steady_clock::now();
+	remaining.store(tasks.size());
+
+	int workerTasks = 0;
+	for (int id = 0; id < (int)tasks.size(); ++id)
+	{
+		if (tasks[id].Affinity == TaskAffinity::Worker)
+			++workerTasks;
+		if (tasks[id].Waiting == 0)
+			Enqueue(id);
+	}
+
+	if (workerTasks == 0)
+		return;
+
+	threads = std::max(1, std::min(threads, workerTasks));
+	for (int i = 0; i < threads; ++i)
+		workers.emplace_back(&TaskGraph::Worker, this, i + 1);
+}
+
+bool TaskGraph::Run(int threads)
+{
+	Start(threads);
+	return Wait();
+}
+
+void TaskGraph::Mark(std::string name)
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	marks.push_back({ std::move(name), started ? Now() : 0.0 });
+}
+
+void TaskGraph::Cancel()
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	cancelled = true;
+}
+
+// Called with mtx held
+void TaskGraph::Enqueue(int id)
+{
+	if (tasks[id].Affinity == TaskAffinity::Main)
+	{
+		mainQueue.push_back(id);
+		doneCv.notify_all();
+	}
+	else
+	{
+		queue.push_back(id);
+	}
+}
+
+// Called with mtx held
+void TaskGraph::Finish(int id, TaskState state, std::string error)
+{
+	Task& t = tasks[id];
+	t.Timing.State = state;
+	t.Timing.EndMs = Now();
+	t.Timing.Error = std::move(error);
+	if (state == TaskState::Skipped)
+		t.Timing.StartMs = t.Timing.EndMs;
+
+	remaining.fetch_sub(1);
+
+	for (int d : t.Dependents)
+	{
+		Task& next = tasks[d];
+		if (next.Timing.State != TaskState::Pending)
+			continue;
+
+		if (state != TaskState::Done)
+		{
+			Finish(d, TaskState::Skipped, "dependency '" + t.Name + "' did not complete");
+			continue;
+		}
+
+		if (--next.Waiting == 0)
+		{
+			next.Timing.ReadyMs = Now();
+			Enqueue(d);
+		}
+	}
+
+	if (remaining.load() == 0)
+		doneCv.notify_all();
+}
+
+void TaskGraph::Execute(int id, int worker)
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		if (cancelled)
+		{
+			Finish(id, TaskState::Skipped, "cancelled");
+			cv.notify_all();
+			return;
+		}
+
+		tasks[id].Timing.State = TaskState::Running;
+		tasks[id].Timing.StartMs = Now();
+		tasks[id].Timing.Worker = worker;
+	}
+
+	bool ok = false;
+	std::string error;
+	try
+	{
+		ok = tasks[id].Fn ? tasks[id].Fn() : true;
+		if (!ok)
+			error = "failed";
+	}
+	catch (const std::exception& e)
+	{
+		error = e.what();
+	}
+	catch (...)
+	{
+		error = "unknown exception";
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		Finish(id, ok ? TaskState::Done : TaskState::Failed, std::move(error));
+	}
+	cv.notify_all();
+}
+
+void TaskGraph::Worker(int index)
+{
+	for (;;)
+	{
+		int id = -1;
+		{
+			std::unique_lock<std::mutex> lock(mtx);
+			cv.wait(lock, [&] { return !queue.empty() || remaining.load() == 0; });
+			if (queue.empty())
+				return;
+
+			id = queue.front();
+			queue.pop_front();
+		}
+
+		Execute(id, index);
+	}
+}
+
+bool TaskGraph::Wait()
+{
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		while (started && remaining.load() != 0)
+		{
+			doneCv.wait(lock, [&] { return remaining.load() == 0 || !mainQueue.empty(); });
+			if (mainQueue.empty())
+				continue;
+
+			const int id = mainQueue.front();
+			mainQueue.pop_front();
+
+			lock.unlock();
+			Execute(id, 0);
+			lock.lock();
+		}
+	}
+
+	for (auto& w : workers)
+	{
+		if (w.joinable())
+			w.join();
+	}
+	workers.clear();
+
+	std::lock_guard<std::mutex> lock(mtx);
+	for (const Task& t : tasks)
+	{
+		if (t.Timing.State != TaskState::Done)
+			return false;
+	}
+	return true;
+}
+
+bool TaskGraph::Finished() const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	return started && remaining.load() == 0;
+}
+
+TaskState TaskGraph::State(int id) const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	return id >= 0 && id < (int)tasks.size() ? tasks[id].Timing.State : TaskState::Skipped;
+}
+
+std::vector<TaskTiming> TaskGraph::Timings() const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	std::vector<TaskTiming> out;
+	out.reserve(tasks.size());
+	for (const Task& t : tasks)
+		out.push_back(t.Timing);
+	return out;
+}
+
+static const char* StateName(TaskState s)
+{
+	switch (s)
+	{
+	case TaskState::Pending: return "pending";
+	case TaskState::Running: return "running";
+	case TaskState::Done: return "done";
+	case TaskState::Failed: return "FAILED";
+	case TaskState::Skipped: return "skipped";
+	}
+	return "?";
+}
+
+std::string TaskGraph::Summary() const
+{
+	std::string out;
+	char line[256];
+	for (const TaskTiming& t : Timings())
+	{
+		snprintf(line, sizeof(line), "%-16s %8.1f -> %8.1f ms  (%8.1f ms)  %s%s%s\n",
+			t.Name.c_str(), t.StartMs, t.EndMs, t.EndMs - t.StartMs, StateName(t.State),
+			t.Error.empty() ? "" : ": ", t.Error.c_str());
+		out += line;
+	}
+	return out;
+}
+
+std::vector<TaskMark> TaskGraph::Marks() const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	return marks;
+}
+
+static void AppendJsonString(std::string& out, const std::string& s)
+{
+	out += '"';
+	for (unsigned char c : s)
+	{
+		switch (c)
+		{
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (c < 0x20)
+			{
+				char esc[8];
+				snprintf(esc, sizeof(esc), "\\u%04x", c);
+				out += esc;
+			}
+			else
+			{
+				out += (char)c;
+			}
+		}
+	}
+	out += '"';
+}
+
+std::string TaskGraph::ChromeTrace() const
+{
+	const std::vector<TaskTiming> timings = Timings();
+	const std::vector<TaskMark> markList = Marks();
+
+	int threads = 0;
+	for (const TaskTiming& t : timings)
+		threads = std::max(threads, t.Worker + 1);
+
+	std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	char buf[256];
+	bool first = true;
+	auto next = [&]()
+		{
+			if (!first)
+				out += ",\n";
+			first = false;
+		};
+
+	for (int tid = 0; tid < std::max(threads, 1); ++tid)
+	{
+		next();
+		snprintf(buf, sizeof(buf),
+			"{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"%s %d\"}}",
+			tid, tid == 0 ? "main" : "worker", tid);
+		out += buf;
+	}
+
+	// microseconds, which is what the format wants
+	for (const TaskTiming& t : timings)
+	{
+		if (t.State == TaskState::Pending || t.State == TaskState::Running)
+			continue;
+
+		next();
+		out += "{\"name\":";
+		AppendJsonString(out, t.Name);
+		if (t.State == TaskState::Skipped)
+		{
+			snprintf(buf, sizeof(buf), ",\"cat\":\"task\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f", t.EndMs * 1000.0);
+			out += buf;
+		}
+		else
+		{
+			snprintf(buf, sizeof(buf), ",\"cat\":\"task\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+				t.Worker, t.StartMs * 1000.0, (t.EndMs - t.StartMs) * 1000.0);
+			out += buf;
+		}
+
+		snprintf(buf, sizeof(buf), ",\"args\":{\"state\":\"%s\",\"ready_ms\":%.3f,\"wait_ms\":%.3f",
+			StateName(t.State), t.ReadyMs, t.StartMs - t.ReadyMs);
+		out += buf;
+		if (!t.Error.empty())
+		{
+			out += ",\"error\":";
+			AppendJsonString(out, t.Error);
+		}
+		out += "}}";
+	}
+
+	for (const TaskMark& m : markList)
+	{
+		next();
+		out += "{\"name\":";
+		AppendJsonString(out, m.Name);
+		snprintf(buf, sizeof(buf), ",\"cat\":\"mark\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}", m.Ms * 1000.0);
+		out += buf;
+	}
+
+	out += "\n]}\n";
+	return out;
+}
+
+bool TaskGraph::WriteChromeTrace(const std::filesystem::path& path) const
+{
+	const std::string json = ChromeTrace();
+
+	std::ofstream f(path, std::ios::binary | std::ios::trunc);
+	if (!f)
+		return false;
+
+	f.write(json.data(), (std::streamsize)json.size());
+	return (bool)f;
+}
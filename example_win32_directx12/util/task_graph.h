@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Small dependency graph runner for startup work. Each task names the tasks
+// it waits for (ids handed out by Add, so the graph can't have cycles), runs
+// on a worker as soon as they have all succeeded, and is skipped if any of
+// them failed. Tasks that must stay on one thread (window, device, ImGui)
+// are marked Main and run on whichever thread calls Wait(). Start/end times
+// per task are kept for logging and can be written out as a Chrome trace
+// (chrome://tracing, ui.perfetto.dev).
+// No platform headers here so the same code runs on the Linux side.
+
+enum class TaskState : uint8_t
+{
+	Pending,
+	Running,
+	Done,
+	Failed,
+	Skipped     // a dependency failed, or the graph was cancelled first
+};
+
+enum class TaskAffinity : uint8_t
+{
+	Worker,
+	Main        // the thread in Wait()
+};
+
+struct TaskTiming
+{
+	std::string Name;
+	TaskState State = TaskState::Pending;
+	double ReadyMs = 0.0;       // all dependencies done, from Start()
+	double StartMs = 0.0;
+	double EndMs = 0.0;
+	int Worker = -1;            // 0 is the Wait() thread, workers count from 1
+	TaskAffinity Affinity = TaskAffinity::Worker;
+	std::string Error;
+};
+
+struct TaskMark
+{
+	std::string Name;
+	double Ms = 0.0;
+};
+
+class TaskGraph
+{
+public:
+	using TaskFn = std::function<bool()>;   // false (or a throw) fails the task
+
+	TaskGraph() = default;
+	~TaskGraph();
+
+	TaskGraph(const TaskGraph&) = delete;
+	TaskGraph& operator=(const TaskGraph&) = delete;
+
+	// Only before Start(); returns the task's id, or -1 if a dependency id is not valid
+	int Add(std::string name, TaskFn fn, std::vector<int> deps = {}, TaskAffinity affinity = TaskAffinity::Worker);
+
+	// Runs the worker tasks on the graph's own threads and returns straight away;
+	// Main tasks wait for Wait()
+	void Start(int threads);
+
+	// Tasks not yet started are skipped; running ones finish
+	void Cancel();
+
+	// Runs Main tasks as they become ready and blocks until every task is done,
+	// failed or skipped; true if none failed or were skipped
+	bool Wait();
+
+	// Start + Wait
+	bool Run(int threads);
+
+	// Point in time on the graph's clock (e.g. first frame), also after it finished
+	void Mark(std::string name);
+
+	bool Finished() const;
+	size_t Count() const { return tasks.size(); }
+	size_t Completed() const { return tasks.size() - remaining.load(); }
+
+	TaskState State(int id) const;
+	std::vector<TaskTiming> Timings() const;
+	std::vector<TaskMark> Marks() const;
+
+	// One line per task in id order, e.g. "sync        12.0 ->  840.3 ms  (828.3 ms)  done"
+	std::string Summary() const;
+
+	// Trace Event Format JSON: one complete event per task that ran, one thread per worker,
+	// instant events for skipped tasks and marks. Timestamps are from Start().
+	std::string ChromeTrace() const;
+	bool WriteChromeTrace(const std::filesystem::path& path) const;
+
+private:
+	struct Task
+	{
+		std::string Name;
+		TaskFn Fn;
+		std::vector<int> Deps;
+		std::vector<int> Dependents;
+		TaskAffinity Affinity = TaskAffinity::Worker;
+		int Waiting = 0;
+		TaskTiming Timing;
+	};
+
+	void Worker(int index);
+	void Execute(int id, int worker);
+	void Enqueue(int id);
+	void Finish(int id, TaskState state, std::string error);
+	double Now() const;
+
+	std::vector<Task> tasks;
+	std::deque<int> queue;
+	std::deque<int> mainQueue;
+	std::vector<std::thread> workers;
+	std::vector<TaskMark> marks;
+
+	mutable std::mutex mtx;
+	std::condition_variable cv;
+	std::condition_variable doneCv;     // also wakes Wait() for Main tasks
+	std::atomic<size_t> remaining{ 0 };
+	bool started = false;
+	bool cancelled = false;
+
+	std::chrono::steady_clock::time_point t0;
+};
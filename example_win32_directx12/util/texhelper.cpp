@@ -1,6 +1,7 @@
 #include "texhelper.h"
 #include <directx/d3dx12.h>
 #include "descriptor_alloc.h"
+#include "asset_vfs.h"
 #include <string>
 
 #pragma comment(lib, "ole32.lib")
@@ -52,6 +53,29 @@ static std::wstring BuildEmissivePath(const std::wstring &basePath)
     return basePath.substr(0, dot) + L"_emissive" + basePath.substr(dot);
 }
 
+// Decodes from the asset's bytes (a span into the mapped pack when it has
+// them) rather than opening the file. bytes must outlive the decoder.
+static HRESULT CreateDecoderForAsset(
+    IWICImagingFactory *factory,
+    const wchar_t *path,
+    AssetData &bytes,
+    IWICBitmapDecoder **outDecoder)
+{
+    if (!AssetVfs::Read(path, bytes) || bytes.Size > MAXDWORD)
+        return HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND);
+
+    IWICStream *stream = nullptr;
+    HRESULT hr = factory->CreateStream(&stream);
+    if (SUCCEEDED(hr))
+        hr = stream->InitializeFromMemory((BYTE *)bytes.Data, (DWORD)bytes.Size);
+    if (SUCCEEDED(hr))
+        hr = factory->CreateDecoderFromStream(stream, nullptr, WICDecodeMetadataCacheOnLoad, outDecoder);
+
+    if (stream)
+        stream->Release();
+    return hr;
+}
+
 static bool CreateSrvFromFile(
     ID3D11Device *device,
     const wchar_t *filename,
@@ -62,6 +86,7 @@ static bool CreateSrvFromFile(
     if (outSrv)
         *outSrv = nullptr;
 
+    AssetData bytes;
     IWICImagingFactory *factory = nullptr;
     IWICBitmapDecoder *decoder = nullptr;
     IWICBitmapFrameDecode *frame = nullptr;
@@ -82,12 +107,7 @@ static bool CreateSrvFromFile(
     if (FAILED(hr))
         goto cleanup;
 
-    hr = factory->CreateDecoderFromFilename(
-        filename,
-        nullptr,
-        GENERIC_READ,
-        WICDecodeMetadataCacheOnLoad,
-        &decoder);
+    hr = CreateDecoderForAsset(factory, filename, bytes, &decoder);
 
     if (FAILED(hr))
         goto cleanup;
@@ -177,7 +197,8 @@ bool TextureLoader::LoadTextureDX11FromFile(
     outTex.id = (ImTextureID)outTex.baseSrv;
 
     const std::wstring emissivePath = BuildEmissivePath(filename);
-    CreateSrvFromFile(device, emissivePath.c_str(), &outTex.emissiveSrv, nullptr, nullptr);
+    if (AssetVfs::Exists(emissivePath))
+        CreateSrvFromFile(device, emissivePath.c_str(), &outTex.emissiveSrv, nullptr, nullptr);
 
     if (outTex.emissiveSrv)
         outTex.emissiveId = (ImTextureID)outTex.emissiveSrv;
@@ -216,16 +237,12 @@ bool TextureLoader::LoadTexture(
                           int &texWidth,
                           int &texHeight) -> bool
     {
+        AssetData bytes;
         IWICBitmapDecoder *decoder = nullptr;
         IWICBitmapFrameDecode *frame = nullptr;
         IWICFormatConverter *converter = nullptr;
 
-        HRESULT localHr = factory->CreateDecoderFromFilename(
-            path,
-            nullptr,
-            GENERIC_READ,
-            WICDecodeMetadataCacheOnLoad,
-            &decoder);
+        HRESULT localHr = CreateDecoderForAsset(factory, path, bytes, &decoder);
 
         UINT width = 0, height = 0;
         UINT stride = width * 4;
@@ -370,7 +387,8 @@ bool TextureLoader::LoadTexture(
 
     const std::wstring emissivePath = BuildEmissivePath(filePath);
     int emissiveWidth = 0, emissiveHeight = 0;
-    loadSingle(emissivePath.c_str(), outTex.emissiveCpu, outTex.emissiveGpu, outTex.emissiveResource, outTex.emissiveUpload, emissiveWidth, emissiveHeight);
+    if (AssetVfs::Exists(emissivePath))
+        loadSingle(emissivePath.c_str(), outTex.emissiveCpu, outTex.emissiveGpu, outTex.emissiveResource, outTex.emissiveUpload, emissiveWidth, emissiveHeight);
 
     if (outTex.emissiveGpu.ptr)
     {
@@ -0,0 +1,233 @@
+#include "usb_registry.h"
+#include <cstddef>
+#include <cstring>
+
+// ------------------------------------------------------------
+// Keys
+// ------------------------------------------------------------
+
+std::string UsbRegistry::CompositeKey(const UsbSignature& sig)
+{
+	return sig.vid + "|" +
+		sig.pid + "|" +
+		sig.serial + "|" +
+		sig.manufacturer + "|" +
+		sig.product;
+}
+
+std::string UsbRegistry::GuidKey(const GUID& g)
+{
+	return std::string((const char*)&g, sizeof(GUID));
+}
+
+int UsbRegistry::LetterSlot(char letter)
+{
+	if (letter >= 'a' && letter <= 'z')
+		letter = (char)(letter - 'a' + 'A');
+	return (letter >= 'A' && letter <= 'Z') ? letter - 'A' : -1;
+}
+
+static void EraseValue(std::unordered_multimap<std::string, uint32_t>& map, const std::string& key, uint32_t value)
+{
+	auto range = map.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second == value)
+		{
+			map.erase(it);
+			return;
+		}
+	}
+}
+
+static bool IsNullGuid(const GUID& g)
+{
+	static const GUID zero{};
+	return memcmp(&g, &zero, sizeof(GUID)) == 0;
+}
+
+// ------------------------------------------------------------
+// Index maintenance
+// ------------------------------------------------------------
+
+void UsbRegistry::IndexDevice(const UsbDeviceRecord& d)
+{
+	for (char l : d.Letters)
+	{
+		int slot = LetterSlot(l);
+		if (slot < 0)
+			continue;
+
+		// a letter belongs to one disk; a stale owner loses it
+		if (byLetter[slot] != kNone && byLetter[slot] != d.DeviceNumber)
+			ClearLetter(l);
+
+		byLetter[slot] = d.DeviceNumber;
+	}
+
+	// every disk without the property reports GUID_NULL, that's not a container
+	if (!IsNullGuid(d.Sig.containerId))
+		byContainer.emplace(GuidKey(d.Sig.containerId), d.DeviceNumber);
+
+	byKey.emplace(CompositeKey(d.Sig), d.DeviceNumber);
+}
+
+void UsbRegistry::UnindexDevice(const UsbDeviceRecord& d)
+{
+	for (auto& n : byLetter)
+	{
+		if (n == d.DeviceNumber)
+			n = kNone;
+	}
+
+	if (!IsNullGuid(d.Sig.containerId))
+		EraseValue(byContainer, GuidKey(d.Sig.containerId), d.DeviceNumber);
+
+	EraseValue(byKey, CompositeKey(d.Sig), d.DeviceNumber);
+}
+
+void UsbRegistry::Reset(std::vector<UsbDeviceRecord> list)
+{
+	devices.clear();
+	byLetter = MakeEmptyLetters();
+	byContainer.clear();
+	byKey.clear();
+
+	for (auto& d : list)
+		Upsert(std::move(d));
+
+	++generation;
+}
+
+void UsbRegistry::Upsert(UsbDeviceRecord device)
+{
+	auto it = devices.find(device.DeviceNumber);
+	if (it != devices.end())
+	{
+		UnindexDevice(it->second);
+		it->second = std::move(device);
+		IndexDevice(it->second);
+	}
+	else
+	{
+		const uint32_t n = device.DeviceNumber;
+		IndexDevice(devices.emplace(n, std::move(device)).first->second);
+	}
+
+	++generation;
+}
+
+bool UsbRegistry::Remove(uint32_t deviceNumber)
+{
+	auto it = devices.find(deviceNumber);
+	if (it == devices.end())
+		return false;
+
+	UnindexDevice(it->second);
+	devices.erase(it);
+	++generation;
+	return true;
+}
+
+void UsbRegistry::AssignLetter(char letter, uint32_t deviceNumber)
+{
+	const int slot = LetterSlot(letter);
+	if (slot < 0)
+		return;
+
+	ClearLetter(letter);
+
+	auto it = devices.find(deviceNumber);
+	if (it == devices.end())
+		return;
+
+	it->second.Letters.push_back((char)('A' + slot));
+	byLetter[slot] = deviceNumber;
+	++generation;
+}
+
+void UsbRegistry::ClearLetter(char letter)
+{
+	const int slot = LetterSlot(letter);
+	if (slot < 0 || byLetter[slot] == kNone)
+		return;
+
+	auto it = devices.find(byLetter[slot]);
+	if (it != devices.end())
+	{
+		auto& l = it->second.Letters;
+		for (size_t i = 0; i < l.size(); ++i)
+		{
+			if (LetterSlot(l[i]) == slot)
+			{
+				l.erase(l.begin() + (ptrdiff_t)i);
+				break;
+			}
+		}
+	}
+
+	byLetter[slot] = kNone;
+	++generation;
+}
+
+void UsbRegistry::RememberMiss(char letter, uint64_t nowMs)
+{
+	const int slot = LetterSlot(letter);
+	if (slot >= 0)
+		misses[slot] = { generation, nowMs, true };
+}
+
+bool UsbRegistry::RecentMiss(char letter, uint64_t nowMs) const
+{
+	const int slot = LetterSlot(letter);
+	if (slot < 0)
+		return false;
+
+	const Miss& m = misses[slot];
+	return m.Set && m.Generation == generation && nowMs - m.AtMs < kMissTtlMs;
+}
+
+// ------------------------------------------------------------
+// Lookups
+// ------------------------------------------------------------
+
+const UsbDeviceRecord* UsbRegistry::FindByDeviceNumber(uint32_t deviceNumber) const
+{
+	auto it = devices.find(deviceNumber);
+	return it != devices.end() ? &it->second : nullptr;
+}
+
+const UsbDeviceRecord* UsbRegistry::FindByLetter(char letter) const
+{
+	const int slot = LetterSlot(letter);
+	if (slot < 0 || byLetter[slot] == kNone)
+		return nullptr;
+	return FindByDeviceNumber(byLetter[slot]);
+}
+
+std::vector<const UsbDeviceRecord*> UsbRegistry::FindByContainer(const GUID& containerId) const
+{
+	std::vector<const UsbDeviceRecord*> out;
+	auto range = byContainer.equal_range(GuidKey(containerId));
+	for (auto it = range.first; it != range.second; ++it)
+		out.push_back(FindByDeviceNumber(it->second));
+	return out;
+}
+
+std::vector<const UsbDeviceRecord*> UsbRegistry::FindByCompositeKey(const std::string& key) const
+{
+	std::vector<const UsbDeviceRecord*> out;
+	auto range = byKey.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it)
+		out.push_back(FindByDeviceNumber(it->second));
+	return out;
+}
+
+std::vector<const UsbDeviceRecord*> UsbRegistry::All() const
+{
+	std::vector<const UsbDeviceRecord*> out;
+	out.reserve(devices.size());
+	for (const auto& [n, d] : devices)
+		out.push_back(&d);
+	return out;
+}
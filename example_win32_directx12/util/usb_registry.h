@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <guiddef.h>
+#else
+struct GUID
+{
+	uint32_t Data1;
+	uint16_t Data2;
+	uint16_t Data3;
+	uint8_t  Data4[8];
+};
+#endif
+
+struct UsbSignature
+{
+	std::string vid;
+	std::string pid;
+	std::string serial;
+	std::string manufacturer;
+	std::string product;
+
+	std::wstring classGuid;
+	std::wstring driverKey;
+
+	GUID containerId{};
+	uint32_t reportedIdHash = 0;
+};
+
+// One USB-backed disk as seen by the last enumeration
+struct UsbDeviceRecord
+{
+	uint32_t DeviceNumber = 0;        // STORAGE_DEVICE_NUMBER, i.e. PhysicalDriveN
+	std::string InstanceId;           // disk devnode instance id
+	std::vector<char> Letters;        // mounted volumes, upper case
+	UsbSignature Sig;
+};
+
+// Platform-neutral index over enumerated USB disks.
+// The Win32 side (USBHelper) fills it once and patches it on hot-plug;
+// lookups by device number, drive letter, container id or composite key are O(1).
+class UsbRegistry
+{
+public:
+	static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+	void Reset(std::vector<UsbDeviceRecord> devices);
+	void Upsert(UsbDeviceRecord device);
+	bool Remove(uint32_t deviceNumber);
+
+	// Letter moved / unmounted without the disk going away
+	void AssignLetter(char letter, uint32_t deviceNumber);
+	void ClearLetter(char letter);
+
+	const UsbDeviceRecord* FindByDeviceNumber(uint32_t deviceNumber) const;
+	const UsbDeviceRecord* FindByLetter(char letter) const;
+	std::vector<const UsbDeviceRecord*> FindByContainer(const GUID& containerId) const;
+	std::vector<const UsbDeviceRecord*> FindByCompositeKey(const std::string& key) const;
+
+	std::vector<const UsbDeviceRecord*> All() const;
+	size_t Size() const { return devices.size(); }
+	bool Empty() const { return devices.empty(); }
+
+	// bumped on every change so callers can cache derived state
+	uint64_t Generation() const { return generation; }
+
+	// Letters that missed right after a refresh (system drive, network shares) are
+	// remembered for kMissTtlMs so looking them up again doesn't re-enumerate. Any
+	// change to the registry forgets them; the TTL covers missed notifications.
+	static constexpr uint64_t kMissTtlMs = 5000;
+	void RememberMiss(char letter, uint64_t nowMs);
+	bool RecentMiss(char letter, uint64_t nowMs) const;
+
+	static std::string CompositeKey(const UsbSignature& sig);
+
+private:
+	static std::string GuidKey(const GUID& g);
+	static int LetterSlot(char letter);
+
+	void IndexDevice(const UsbDeviceRecord& d);
+	void UnindexDevice(const UsbDeviceRecord& d);
+
+	std::unordered_map<uint32_t, UsbDeviceRecord> devices;
+	std::array<uint32_t, 26> byLetter = MakeEmptyLetters();
+	std::unordered_multimap<std::string, uint32_t> byContainer;
+	std::unordered_multimap<std::string, uint32_t> byKey;
+	uint64_t generation = 0;
+
+	struct Miss
+	{
+		uint64_t Generation = 0;
+		uint64_t AtMs = 0;
+		bool Set = false;
+	};
+	std::array<Miss, 26> misses{};
+
+	static std::array<uint32_t, 26> MakeEmptyLetters()
+	{
+		std::array<uint32_t, 26> a{};
+		a.fill(kNone);
+		return a;
+	}
+};
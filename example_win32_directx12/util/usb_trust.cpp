@@ -0,0 +1,410 @@
+#include "usb_trust.h"
+#include "hash.h"
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// ------------------------------------------------------------
+// Fingerprint
+// ------------------------------------------------------------
+
+static constexpr uint64_t kSeedLo = 0x50534856'4B555342ull; // "PSHVKUSB"
+static constexpr uint64_t kSeedHi = 0x5452'5553'5446'5031ull;
+
+static std::string_view Trim(std::string_view s)
+{
+	while (!s.empty() && std::isspace((unsigned char)s.front())) s.remove_prefix(1);
+	while (!s.empty() && std::isspace((unsigned char)s.back())) s.remove_suffix(1);
+	return s;
+}
+
+// Trim, collapse inner whitespace, fold case. Drivers are inconsistent about
+// padding in iManufacturer / iProduct and about the case of serials.
+static void AppendNormalized(std::string& out, std::string_view s, bool upper)
+{
+	s = Trim(s);
+
+	bool space = false;
+	for (char c : s)
+	{
+		if (std::isspace((unsigned char)c))
+		{
+			space = true;
+			continue;
+		}
+		if (space)
+		{
+			out.push_back(' ');
+			space = false;
+		}
+		out.push_back(upper ? (char)std::toupper((unsigned char)c) : (char)std::tolower((unsigned char)c));
+	}
+
+	// field separator that can't appear in a normalized string
+	out.push_back('\x1f');
+}
+
+UsbFingerprint UsbTrustList::Fingerprint(const UsbSignature& sig)
+{
+	std::string buf;
+	buf.reserve(128);
+
+	AppendNormalized(buf, sig.vid, true);
+	AppendNormalized(buf, sig.pid, true);
+	AppendNormalized(buf, sig.serial, true);
+	AppendNormalized(buf, sig.manufacturer, false);
+	AppendNormalized(buf, sig.product, false);
+
+	// GUID fields are native-endian on every platform we build for
+	buf.append((const char*)&sig.containerId, sizeof(GUID));
+
+	uint8_t rid[4] = {
+		(uint8_t)(sig.reportedIdHash),
+		(uint8_t)(sig.reportedIdHash >> 8),
+		(uint8_t)(sig.reportedIdHash >> 16),
+		(uint8_t)(sig.reportedIdHash >> 24) };
+	buf.append((const char*)rid, sizeof(rid));
+
+	UsbFingerprint fp;
+	fp.Lo = HashService::Fast64(buf.data(), buf.size(), kSeedLo);
+	fp.Hi = HashService::Fast64(buf.data(), buf.size(), kSeedHi);
+	return fp;
+}
+
+std::string UsbFingerprint::Hex() const
+{
+	static const char* digits = "0123456789abcdef";
+
+	std::string s(32, '0');
+	for (int i = 0; i < 16; ++i)
+	{
+		s[i] = digits[(Hi >> (60 - i * 4)) & 0xF];
+		s[16 + i] = digits[(Lo >> (60 - i * 4)) & 0xF];
+	}
+	return s;
+}
+
+static int HexDigit(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+bool UsbFingerprint::FromHex(std::string_view hex, UsbFingerprint& out)
+{
+	if (hex.size() != 32)
+		return false;
+
+	uint64_t parts[2] = {};
+	for (int i = 0; i < 32; ++i)
+	{
+		int d = HexDigit(hex[i]);
+		if (d < 0)
+			return false;
+		parts[i / 16] = (parts[i / 16] << 4) | (uint64_t)d;
+	}
+
+	out.Hi = parts[0];
+	out.Lo = parts[1];
+	return true;
+}
+
+bool UsbTrustList::ParseHex16(std::string_view s, uint16_t& out)
+{
+	s = Trim(s);
+	if (s.empty() || s.size() > 4)
+		return false;
+
+	uint32_t v = 0;
+	for (char c : s)
+	{
+		int d = HexDigit(c);
+		if (d < 0)
+			return false;
+		v = (v << 4) | (uint32_t)d;
+	}
+
+	out = (uint16_t)v;
+	return true;
+}
+
+// ------------------------------------------------------------
+// Entries
+// ------------------------------------------------------------
+
+void UsbTrustList::Merge(UsbTrust& slot, UsbTrust trust)
+{
+	// deny is sticky: a later allow for the same key doesn't undo it
+	if (slot != UsbTrust::Denied)
+		slot = trust;
+}
+
+void UsbTrustList::AddDevice(const UsbSignature& sig, UsbTrust trust)
+{
+	AddFingerprint(Fingerprint(sig), trust);
+}
+
+void UsbTrustList::AddFingerprint(const UsbFingerprint& fp, UsbTrust trust)
+{
+	if (trust == UsbTrust::Unknown)
+		return;
+
+	auto [it, inserted] = exact.try_emplace(fp, trust);
+	if (!inserted)
+		Merge(it->second, trust);
+}
+
+void UsbTrustList::AddRule(uint16_t vid, int pid, UsbTrust trust)
+{
+	if (trust == UsbTrust::Unknown)
+		return;
+
+	if (pid < 0)
+	{
+		auto [it, inserted] = byVid.try_emplace(vid, trust);
+		if (!inserted)
+			Merge(it->second, trust);
+	}
+	else
+	{
+		auto [it, inserted] = byVidPid.try_emplace(VidPidKey(vid, (uint16_t)pid), trust);
+		if (!inserted)
+			Merge(it->second, trust);
+	}
+}
+
+bool UsbTrustList::RemoveFingerprint(const UsbFingerprint& fp)
+{
+	return exact.erase(fp) != 0;
+}
+
+void UsbTrustList::Clear()
+{
+	exact.clear();
+	byVidPid.clear();
+	byVid.clear();
+}
+
+UsbTrust UsbTrustList::Check(const UsbSignature& sig) const
+{
+	if (!exact.empty())
+	{
+		auto it = exact.find(Fingerprint(sig));
+		if (it != exact.end())
+			return it->second;
+	}
+
+	uint16_t vid = 0, pid = 0;
+	if (!ParseHex16(sig.vid, vid))
+		return UsbTrust::Unknown;
+
+	if (!byVidPid.empty() && ParseHex16(sig.pid, pid))
+	{
+		auto it = byVidPid.find(VidPidKey(vid, pid));
+		if (it != byVidPid.end())
+			return it->second;
+	}
+
+	auto it = byVid.find(vid);
+	return it != byVid.end() ? it->second : UsbTrust::Unknown;
+}
+
+// ------------------------------------------------------------
+// Text format
+// ------------------------------------------------------------
+
+static bool NextToken(std::string_view& line, std::string_view& tok)
+{
+	line = Trim(line);
+	if (line.empty())
+		return false;
+
+	size_t end = 0;
+	while (end < line.size() && !std::isspace((unsigned char)line[end]))
+		++end;
+
+	tok = line.substr(0, end);
+	line.remove_prefix(end);
+	return true;
+}
+
+static bool TokenIs(std::string_view tok, const char* word)
+{
+	size_t n = strlen(word);
+	if (tok.size() != n)
+		return false;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (std::tolower((unsigned char)tok[i]) != word[i])
+			return false;
+	}
+	return true;
+}
+
+size_t UsbTrustList::Import(std::string_view text, std::vector<std::string>* errors)
+{
+	size_t added = 0;
+	size_t lineNo = 0;
+
+	auto fail = [&](const char* why)
+		{
+			if (errors)
+				errors->push_back("line " + std::to_string(lineNo) + ": " + why);
+		};
+
+	// rough guess so thousands of entries don't rehash on the way in
+	exact.reserve(exact.size() + text.size() / 40);
+
+	while (!text.empty())
+	{
+		++lineNo;
+
+		size_t nl = text.find('\n');
+		std::string_view line = text.substr(0, nl);
+		text.remove_prefix(nl == std::string_view::npos ? text.size() : nl + 1);
+
+		size_t hash = line.find('#');
+		if (hash != std::string_view::npos)
+			line = line.substr(0, hash);
+
+		std::string_view tok;
+		if (!NextToken(line, tok))
+			continue;
+
+		UsbTrust trust;
+		if (TokenIs(tok, "allow"))
+			trust = UsbTrust::Allowed;
+		else if (TokenIs(tok, "deny"))
+			trust = UsbTrust::Denied;
+		else
+		{
+			fail("expected allow or deny");
+			continue;
+		}
+
+		if (!NextToken(line, tok))
+		{
+			fail("missing entry");
+			continue;
+		}
+
+		if (TokenIs(tok, "vid"))
+		{
+			uint16_t vid = 0, pid = 0;
+			if (!NextToken(line, tok) || !ParseHex16(tok, vid))
+			{
+				fail("bad vid");
+				continue;
+			}
+
+			int pidRule = -1;
+			if (NextToken(line, tok))
+			{
+				std::string_view pidTok;
+				if (!TokenIs(tok, "pid") || !NextToken(line, pidTok) || !ParseHex16(pidTok, pid))
+				{
+					fail("bad pid");
+					continue;
+				}
+				pidRule = pid;
+			}
+
+			AddRule(vid, pidRule, trust);
+			++added;
+			continue;
+		}
+
+		UsbFingerprint fp;
+		if (!UsbFingerprint::FromHex(tok, fp))
+		{
+			fail("bad fingerprint");
+			continue;
+		}
+
+		AddFingerprint(fp, trust);
+		++added;
+	}
+
+	return added;
+}
+
+static void AppendHex16(std::string& out, uint16_t v)
+{
+	static const char* digits = "0123456789abcdef";
+	for (int s = 12; s >= 0; s -= 4)
+		out.push_back(digits[(v >> s) & 0xF]);
+}
+
+std::string UsbTrustList::Export() const
+{
+	std::string out;
+	out.reserve(64 + exact.size() * 40 + (byVid.size() + byVidPid.size()) * 32);
+
+	out += "# PSHVK USB trust list\n";
+
+	for (const auto& [vid, trust] : byVid)
+	{
+		out += trust == UsbTrust::Denied ? "deny vid " : "allow vid ";
+		AppendHex16(out, vid);
+		out.push_back('\n');
+	}
+
+	for (const auto& [key, trust] : byVidPid)
+	{
+		out += trust == UsbTrust::Denied ? "deny vid " : "allow vid ";
+		AppendHex16(out, (uint16_t)(key >> 16));
+		out += " pid ";
+		AppendHex16(out, (uint16_t)(key & 0xFFFF));
+		out.push_back('\n');
+	}
+
+	for (const auto& [fp, trust] : exact)
+	{
+		out += trust == UsbTrust::Denied ? "deny " : "allow ";
+		out += fp.Hex();
+		out.push_back('\n');
+	}
+
+	return out;
+}
+
+bool UsbTrustList::Load(const std::filesystem::path& path, std::vector<std::string>* errors)
+{
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+		return false;
+
+	std::ostringstream ss;
+	ss << in.rdbuf();
+
+	Clear();
+	Import(ss.str(), errors);
+	return true;
+}
+
+bool UsbTrustList::Save(const std::filesystem::path& path) const
+{
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	auto tmp = path;
+	tmp += ".tmp";
+
+	{
+		std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+		if (!out)
+			return false;
+
+		const std::string text = Export();
+		out.write(text.data(), (std::streamsize)text.size());
+		if (!out)
+			return false;
+	}
+
+	std::filesystem::rename(tmp, path, ec);
+	return !ec;
+}
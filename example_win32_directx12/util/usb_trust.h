@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "usb_registry.h"
+
+// 128-bit identity of one physical stick, taken over the normalized signature
+// (ids upper-cased, strings trimmed and case-folded, containerId + reportedIdHash)
+struct UsbFingerprint
+{
+	uint64_t Lo = 0;
+	uint64_t Hi = 0;
+
+	bool operator==(const UsbFingerprint& o) const { return Lo == o.Lo && Hi == o.Hi; }
+	bool operator!=(const UsbFingerprint& o) const { return !(*this == o); }
+
+	std::string Hex() const;
+	static bool FromHex(std::string_view hex, UsbFingerprint& out);
+};
+
+struct UsbFingerprintHash
+{
+	size_t operator()(const UsbFingerprint& f) const { return (size_t)(f.Lo ^ (f.Hi * 0x9E3779B97F4A7C15ull)); }
+};
+
+enum class UsbTrust : uint8_t
+{
+	Unknown,
+	Allowed,
+	Denied
+};
+
+// Allow/deny list for USB devices.
+// Exact entries are fingerprints; wildcard rules match a whole VID or VID+PID.
+// Precedence: exact > VID+PID > VID, and deny beats allow at the same level.
+//
+// File format, one entry per line, '#' starts a comment:
+//   allow <32 hex fingerprint>
+//   deny  vid 0781
+//   allow vid 0781 pid 5581
+class UsbTrustList
+{
+public:
+	static UsbFingerprint Fingerprint(const UsbSignature& sig);
+
+	UsbTrust Check(const UsbSignature& sig) const;
+
+	void AddDevice(const UsbSignature& sig, UsbTrust trust);
+	void AddFingerprint(const UsbFingerprint& fp, UsbTrust trust);
+	void AddRule(uint16_t vid, int pid, UsbTrust trust);   // pid < 0 = any product
+	bool RemoveFingerprint(const UsbFingerprint& fp);
+	void Clear();
+
+	// Bulk import of the text format; existing entries are kept.
+	// Returns the number of entries added, bad lines are reported and skipped.
+	size_t Import(std::string_view text, std::vector<std::string>* errors = nullptr);
+	std::string Export() const;
+
+	bool Load(const std::filesystem::path& path, std::vector<std::string>* errors = nullptr);
+	bool Save(const std::filesystem::path& path) const;
+
+	size_t DeviceCount() const { return exact.size(); }
+	size_t RuleCount() const { return byVidPid.size() + byVid.size(); }
+
+	static bool ParseHex16(std::string_view s, uint16_t& out);
+
+private:
+	static uint32_t VidPidKey(uint16_t vid, uint16_t pid) { return ((uint32_t)vid << 16) | pid; }
+	static void Merge(UsbTrust& slot, UsbTrust trust);
+
+	std::unordered_map<UsbFingerprint, UsbTrust, UsbFingerprintHash> exact;
+	std::unordered_map<uint32_t, UsbTrust> byVidPid;
+	std::unordered_map<uint16_t, UsbTrust> byVid;
+};
@@ -1,6 +1,11 @@
 #include "web_helper.h"
 #include <ShlObj.h>
 #include "curl.h"
+#include "download_manager.h"
+#include "github_folder.h"
+#include "asset_sync.h"
+#include "asset_vfs.h"
+#include "hash.h"
 
 #include <cstdio>
 #include <mutex>
@@ -19,115 +24,37 @@ static void DLLog(const char* fmt, ...)
 	printf("\n");
 }
 
-struct CurlDlCtx
+static void LogBatchProgress(const DownloadProgress& p)
 {
-	std::string url;
-	std::string outPath;
-	curl_off_t lastReported = -1;
-};
-
-static int CurlProgressCb(void* clientp,
-	curl_off_t dltotal, curl_off_t dlnow,
-	curl_off_t /*ultotal*/, curl_off_t /*ulnow*/)
-{
-	auto* ctx = static_cast<CurlDlCtx*>(clientp);
-
-	// throttle logs so you don't spam and slow downloads
-	if (dlnow == ctx->lastReported) return 0;
-	if (dlnow < 0) return 0;
-
-	// log every ~256KB (adjust if you want)
-	const curl_off_t step = 256 * 1024;
-	if (ctx->lastReported >= 0 && (dlnow - ctx->lastReported) < step)
-		return 0;
-
-	ctx->lastReported = dlnow;
+	DLLog("[DL] %llu/%llu files  %.1f / %.1f MB  active=%d retries=%llu  %.1fs",
+		(unsigned long long)(p.FilesDone + p.FilesFailed), (unsigned long long)p.FilesTotal,
+		p.BytesDone / 1048576.0, p.BytesTotal / 1048576.0,
+		p.Active, (unsigned long long)p.Retries, p.Seconds);
+}
 
-	if (dltotal > 0)
-	{
-		double pct = (double)dlnow * 100.0 / (double)dltotal;
-		DLLog("[DL] %.1f%% (%lld / %lld) %s -> %s",
-			pct,
-			(long long)dlnow, (long long)dltotal,
-			ctx->url.c_str(),
-			ctx->outPath.c_str());
-	}
+static void LogResult(const DownloadResult& r, const std::string& url)
+{
+	if (r.Ok)
+		DLLog("[DL] OK     http=%ld segs=%d resumed=%llu  %s",
+			r.Http, r.Segments, (unsigned long long)r.BytesResumed, r.Path.string().c_str());
 	else
-	{
-		DLLog("[DL] %lld bytes %s -> %s",
-			(long long)dlnow,
-			ctx->url.c_str(),
-			ctx->outPath.c_str());
-	}
-
-	return 0; // return non-zero to abort
+		DLLog("[DL] FAIL   curl=%d http=%ld attempts=%d (%s)  %s",
+			r.Curl, r.Http, r.Attempts, r.Error.c_str(), url.c_str());
 }
 
 bool HVKIO::DownloadFile(const std::string& url, const std::string& outPath)
 {
 	DLLog("[DL] START  %s -> %s", url.c_str(), outPath.c_str());
 
-	CURL* curl = curl_easy_init();
-	if (!curl)
-	{
-		DLLog("[DL] FAIL   curl_easy_init returned null");
-		return false;
-	}
-
-	std::ofstream file(outPath, std::ios::binary);
-	if (!file)
-	{
-		DLLog("[DL] FAIL   cannot open output file: %s", outPath.c_str());
-		curl_easy_cleanup(curl);
-		return false;
-	}
-
-	CurlDlCtx ctx;
-	ctx.url = url;
-	ctx.outPath = outPath;
-
-	curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-	curl_easy_setopt(curl, CURLOPT_USERAGENT, "PSHVK-Updater");
-	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-
-	// write file
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &file);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION,
-		+[](void* ptr, size_t size, size_t nmemb, void* stream) -> size_t {
-			// DO NOT log ptr as a string (not null-terminated + binary)
-			std::ofstream* out = static_cast<std::ofstream*>(stream);
-			out->write(static_cast<const char*>(ptr), size * nmemb);
-			return size * nmemb;
-		});
-
-	// progress
-	curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, CurlProgressCb);
-	curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &ctx);
-	curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+	DownloadManager dl;
+	dl.Add({ url, fs::path(outPath) });
 
-	CURLcode res = curl_easy_perform(curl);
+	std::vector<DownloadResult> results;
+	const bool ok = dl.Run(&results);
 
-	long httpCode = 0;
-	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
-
-	curl_easy_cleanup(curl);
-	file.close();
-
-	if (res != CURLE_OK)
-	{
-		DLLog("[DL] FAIL   curl=%d (%s) http=%ld  %s",
-			(int)res, curl_easy_strerror(res), httpCode, url.c_str());
-		return false;
-	}
-
-	if (httpCode >= 400)
-	{
-		DLLog("[DL] FAIL   http=%ld  %s", httpCode, url.c_str());
-		return false;
-	}
-
-	DLLog("[DL] OK     http=%ld  %s", httpCode, outPath.c_str());
-	return true;
+	if (!results.empty())
+		LogResult(results[0], url);
+	return ok;
 }
 
 
@@ -164,148 +91,151 @@ std::string HVKIO::GetLocalAppData()
 	return std::string(path);
 }
 
-size_t HVKIO::WriteToString(void* ptr, size_t size, size_t nmemb, void* data)
+static std::mutex g_assetProgressMutex;
+static DownloadProgress g_assetProgress;
+static bool g_assetProgressActive = false;
+
+bool HVKIO::AssetProgress(DownloadProgress& out)
 {
-	((std::string*)data)->append((char*)ptr, size * nmemb);
-	return size * nmemb;
+	std::lock_guard<std::mutex> lock(g_assetProgressMutex);
+	out = g_assetProgress;
+	return g_assetProgressActive;
 }
 
-std::string HVKIO::HttpGet(const std::string& url)
+bool HVKIO::DownloadPSHVKAssets(const std::atomic<bool>* cancel)
 {
-	CURL* curl = curl_easy_init();
-	std::string response;
+	std::string base =
+		GetLocalAppData() + "\\PSHVK\\assets";
 
-	curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-	curl_easy_setopt(curl, CURLOPT_USERAGENT, "PSHVK-Updater");
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteToString);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+	AssetSyncConfig cfg;
+	cfg.TreeUrl =
+		"https://api.github.com/repos/"
+		"hav0kdotsys/PSHVK/git/trees/HEAD?recursive=1";
+	cfg.RawBase = "https://raw.githubusercontent.com/hav0kdotsys/PSHVK/HEAD/";
+	cfg.Prefix = "assets/";
+	cfg.Root = base;
+	cfg.Download.Cancel = cancel;
+	cfg.Progress = [](const DownloadProgress& p)
+		{
+			std::lock_guard<std::mutex> lock(g_assetProgressMutex);
+			g_assetProgress = p;
+			g_assetProgressActive = true;
+		};
 
-	curl_easy_perform(curl);
-	curl_easy_cleanup(curl);
+	AssetSyncReport report;
+	const bool ok = AssetSync::Sync(cfg, report);
 
-	return response;
-}
+	{
+		std::lock_guard<std::mutex> lock(g_assetProgressMutex);
+		g_assetProgressActive = false;
+	}
 
-void HVKIO::DownloadGithubFolder(const std::string& apiUrl, const fs::path& localPath)
-{
-	DLLog("[GH] Folder START  api=%s  local=%s", apiUrl.c_str(), localPath.string().c_str());
+	for (const auto& e : report.Errors)
+		DLLog("[SYNC] %s", e.c_str());
 
-	fs::create_directories(localPath);
+	DLLog("[SYNC] %s  files=%llu kept=%llu fetched=%llu removed=%llu  %.1f KB  %.2fs%s",
+		ok ? "OK" : "FAIL",
+		(unsigned long long)report.Files, (unsigned long long)report.Kept,
+		(unsigned long long)report.Fetched, (unsigned long long)report.Removed,
+		report.BytesFetched / 1024.0, report.Seconds,
+		report.NotModified ? "  (not modified)" : "");
 
-	std::string body = HttpGet(apiUrl);
-	if (body.empty())
+	// no assets at all and the tree API is unusable (rate limit, truncated listing):
+	// fall back to walking the contents API
+	if (!ok && !fs::exists(base) && !(cancel && cancel->load()))
 	{
-		DLLog("[GH] Folder FAIL   empty response: %s", apiUrl.c_str());
-		return;
-	}
+		std::string api =
+			"https://api.github.com/repos/"
+			"hav0kdotsys/PSHVK/contents/assets";
 
-	json data;
-	try
-	{
-		data = json::parse(body);
-	}
-	catch (const std::exception& e)
-	{
-		DLLog("[GH] Folder FAIL   json parse error: %s  api=%s", e.what(), apiUrl.c_str());
-		return;
+		DownloadOptions options;
+		options.Cancel = cancel;
+
+		GithubFolderReport folder;
+		const bool fetched = GithubFolder::Download(api, base, options, folder, LogBatchProgress);
+
+		for (const auto& e : folder.Errors)
+			DLLog("[GH] %s", e.c_str());
+		DLLog("[GH] %s  files=%llu fetched=%llu  http2=%d", fetched ? "OK" : "FAIL",
+			(unsigned long long)folder.Files, (unsigned long long)folder.Fetched, (int)DownloadManager::Http2Available());
+
+		return fetched;
 	}
 
-	if (!data.is_array())
+	return report.Swapped;
+}
+
+bool HVKIO::MountPSHVKAssets()
+{
+	const fs::path dir = GetLocalAppData() + "\\PSHVK";
+	const fs::path root = dir / "assets";
+
+	// The pack is tagged with the manifest it was built from, so any sync that
+	// changed the tree rebuilds it. Without a manifest (contents API fallback)
+	// there is nothing to tag it with and the loose files are used as they are.
+	std::ifstream in(root / AssetSync::kManifestFile, std::ios::binary);
+	if (!in)
 	{
-		DLLog("[GH] Folder FAIL   github response not array  api=%s", apiUrl.c_str());
-		return;
+		DLLog("[PACK] no manifest, using loose assets");
+		return false;
 	}
+	const std::string manifest((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	const uint64_t tag = HashService::Fast64(manifest.data(), manifest.size());
 
-	DLLog("[GH] Items=%zu  api=%s", (size_t)data.size(), apiUrl.c_str());
+	auto current = AssetVfs::Pack();
+	if (current && current->SourceTag() == tag)
+		return false;
 
-	for (auto& item : data)
-	{
-		std::string type = item.value("type", "");
-		std::string name = item.value("name", "");
+	// One file per tag: the mounted pack stays mapped while its replacement is
+	// built (fonts hold spans into it), and Windows won't replace a mapped file
+	char name[64];
+	snprintf(name, sizeof(name), "assets.%016llx%s", (unsigned long long)tag, AssetPack::kExtension);
+	const fs::path packPath = dir / name;
 
-		if (type.empty() || name.empty())
-		{
-			DLLog("[GH] Skip invalid item in api=%s", apiUrl.c_str());
-			continue;
-		}
+	std::string error;
+	auto pack = AssetPack::Open(packPath, &error);
+	if (!pack || pack->SourceTag() != tag)
+	{
+		pack.reset();
 
-		fs::path outPath = localPath / name;
+		AssetPackBuildReport report;
+		const bool built = AssetPack::Build(root, packPath, tag, &report);
 
-		if (type == "file")
-		{
-			std::string downloadUrl = item.value("download_url", "");
-			if (downloadUrl.empty())
-			{
-				DLLog("[GH] File SKIP missing download_url: %s", outPath.string().c_str());
-				continue;
-			}
-
-			DLLog("[GH] File  %s", outPath.string().c_str());
-
-			bool ok = DownloadFile(downloadUrl, outPath.string());
-			if (!ok)
-				DLLog("[GH] File FAIL %s", outPath.string().c_str());
-		}
-		else if (type == "dir")
-		{
-			std::string nextApi = item.value("url", "");
-			if (nextApi.empty())
-			{
-				DLLog("[GH] Dir SKIP missing url: %s", outPath.string().c_str());
-				continue;
-			}
-
-			DLLog("[GH] Dir   %s", outPath.string().c_str());
-			DownloadGithubFolder(nextApi, outPath);
-		}
-		else
-		{
-			DLLog("[GH] Skip type=%s name=%s", type.c_str(), name.c_str());
-		}
-	}
+		for (const auto& e : report.Errors)
+			DLLog("[PACK] %s", e.c_str());
 
-	DLLog("[GH] Folder END    local=%s", localPath.string().c_str());
-}
+		DLLog("[PACK] %s  files=%llu lz4=%llu  %.1f KB -> %.1f KB  %.2fs",
+			built ? "BUILT" : "FAIL",
+			(unsigned long long)report.Files, (unsigned long long)report.Compressed,
+			report.BytesIn / 1024.0, report.BytesOut / 1024.0, report.Seconds);
 
+		if (built)
+			pack = AssetPack::Open(packPath, &error);
+	}
 
-//void HVKIO::DownloadGithubFolder(
-//	const std::string& apiUrl,
-//	const fs::path& localPath)
-//{
-//	fs::create_directories(localPath);
-//
-//	auto data = json::parse(HttpGet(apiUrl));
-//
-//	for (auto& item : data)
-//	{
-//		std::string type = item["type"];
-//		std::string name = item["name"];
-//
-//		fs::path outPath = localPath / name;
-//
-//		if (type == "file")
-//		{
-//			std::string downloadUrl = item["download_url"];
-//			DownloadFile(downloadUrl, outPath.string());
-//		}
-//		else if (type == "dir")
-//		{
-//			std::string nextApi = item["url"];
-//			DownloadGithubFolder(nextApi, outPath);
-//		}
-//	}
-//}
+	if (!pack)
+	{
+		DLLog("[PACK] %s, using loose assets", error.c_str());
+		return false;
+	}
 
-void HVKIO::DownloadPSHVKAssets()
-{
-	std::string base =
-		GetLocalAppData() + "\\PSHVK\\assets";
+	DLLog("[PACK] mounted %s (%zu entries)", name, pack->Count());
+	AssetVfs::Mount(std::move(pack), root);
+	current.reset();
 
-	std::string api =
-		"https://api.github.com/repos/"
-		"hav0kdotsys/PSHVK/contents/assets";
+	// Older packs: whatever is no longer mapped goes now, the rest next launch
+	std::error_code ec;
+	for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec))
+	{
+		const std::string file = it->path().filename().string();
+		if (file != name && file.rfind("assets.", 0) == 0 && it->path().extension() == AssetPack::kExtension)
+		{
+			std::error_code rmEc;
+			fs::remove(it->path(), rmEc);
+		}
+	}
 
-	DownloadGithubFolder(api, base);
+	return true;
 }
 
 std::wstring HVKIO::GetLocalAppDataW()
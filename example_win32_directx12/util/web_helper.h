@@ -5,29 +5,30 @@
 #include <fstream>
 #include <random>
 #include <algorithm>
+#include <atomic>
 
 using json = nlohmann::json;
 namespace fs = std::filesystem;
 
+struct DownloadProgress;
+
 class HVKIO
 {
 public:
-	static void DownloadPSHVKAssets();
+	static bool DownloadPSHVKAssets(const std::atomic<bool>* cancel = nullptr);   // true when the asset folder changed (the contents API fallback: when all of it arrived)
+	static bool MountPSHVKAssets();   // builds / mounts the pack for the synced tree; true when a new one was mounted
+	static bool AssetProgress(DownloadProgress& out);   // false when no download is running
 	static std::string GetLocalAppData();
 	static std::wstring GetLocalAppDataW();
 	static bool CreateInstanceFile();
 	static bool ValidateInstanceFile();
+	static void InstanceFileChanged(); // drop the cached validation result
 
 	static void EnsureDirectory(const std::wstring& path);
 
 private:
 	static const char* GenerateHvkUUID();
-	static size_t WriteToString(void* ptr, size_t size, size_t nmemb, void* data);
-	static std::string HttpGet(const std::string& url);
 	static bool DownloadFile(const std::string& url, const std::string& outPath);
-	static void DownloadGithubFolder(
-		const std::string& apiUrl,
-		const fs::path& localPath);
 
 
 };
@@ -0,0 +1,431 @@
+#include "write_behind.h"
+#include "hash.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+	struct PendingWrite
+	{
+		std::vector<WriteBehind::Target> Targets;   // coalesced by Targets[0].Path
+		Clock::time_point First;   // latency is measured from the oldest folded request
+		Clock::time_point Last;
+	};
+
+	struct State
+	{
+		std::mutex Mutex;
+		std::condition_variable Wake;
+		std::condition_variable Idle;
+
+		std::vector<PendingWrite> Queue;   // FIFO by first request; coalesced in place
+		std::vector<std::filesystem::path> InFlight;   // targets of the job being written
+		bool Stopping = false;
+		std::thread Worker;
+
+		int DelayMs = 250;
+		int Immediate = 0;   // Flush callers waiting; the worker skips the delay for them
+
+		WriteBehindStats Stats;
+		uint64_t Completed = 0;   // jobs behind AvgLatencyMs
+		std::unordered_map<std::wstring, uint64_t> LastHash;   // path -> Fast64 of what we wrote
+
+		std::function<bool(WriteFault, const std::filesystem::path&)> FaultHook;
+	};
+
+	State& S()
+	{
+		static State s;
+		return s;
+	}
+}
+
+static bool Inject(WriteFault f, const std::filesystem::path& path)
+{
+	auto& s = S();
+	std::function<bool(WriteFault, const std::filesystem::path&)> hook;
+	{
+		std::lock_guard<std::mutex> lock(s.Mutex);
+		hook = s.FaultHook;
+	}
+	return hook && hook(f, path);
+}
+
+// ------------------------------------------------------------
+// Atomic write
+// ------------------------------------------------------------
+
+std::filesystem::path WriteBehind::BackupPath(const std::filesystem::path& path)
+{
+	auto p = path;
+	p += ".bak";
+	return p;
+}
+
+static bool Fail(std::string* error, const char* step)
+{
+	if (error)
+		*error = step;
+	return false;
+}
+
+static bool WriteDurable(const std::filesystem::path& path, std::string_view data, std::string* error)
+{
+#ifdef _WIN32
+	if (Inject(WriteFault::Open, path))
+		return Fail(error, "open");
+
+	HANDLE h = CreateFileW(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (h == INVALID_HANDLE_VALUE)
+		return Fail(error, "open");
+
+	DWORD written = 0;
+	bool ok = !Inject(WriteFault::Write, path) &&
+		WriteFile(h, data.data(), (DWORD)data.size(), &written, nullptr) &&
+		written == data.size();
+	if (!ok)
+	{
+		CloseHandle(h);
+		return Fail(error, "write");
+	}
+
+	ok = !Inject(WriteFault::Flush, path) && FlushFileBuffers(h);
+	CloseHandle(h);
+	return ok || Fail(error, "flush");
+#else
+	if (Inject(WriteFault::Open, path))
+		return Fail(error, "open");
+
+	int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return Fail(error, "open");
+
+	bool ok = !Inject(WriteFault::Write, path);
+	for (size_t off = 0; ok && off < data.size();)
+	{
+		ssize_t n = write(fd, data.data() + off, data.size() - off);
+		ok = n > 0;
+		off += ok ? (size_t)n : 0;
+	}
+	if (!ok)
+	{
+		close(fd);
+		return Fail(error, "write");
+	}
+
+	ok = !Inject(WriteFault::Flush, path) && fsync(fd) == 0;
+	close(fd);
+	return ok || Fail(error, "flush");
+#endif
+}
+
+// Puts tmp in place of path and waits until the rename itself is on disk:
+// without that a crash can bring back the old name or leave neither
+bool WriteBehind::ReplaceDurable(const std::filesystem::path& tmp, const std::filesystem::path& path, std::string* error)
+{
+#ifdef _WIN32
+	if (!MoveFileExW(tmp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+		return Fail(error, "rename");
+	return true;
+#else
+	if (rename(tmp.c_str(), path.c_str()) != 0)
+		return Fail(error, "rename");
+
+	// the directory entry lives in the parent; some filesystems can't fsync a
+	// directory (EINVAL) and have nothing more to flush
+	auto dir = path.parent_path();
+	if (dir.empty())
+		dir = ".";
+	int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+		return Fail(error, "sync dir");
+	const bool ok = fsync(fd) == 0 || errno == EINVAL;
+	close(fd);
+	return ok || Fail(error, "sync dir");
+#endif
+}
+
+bool WriteBehind::WriteAtomic(const std::filesystem::path& path, std::string_view data, std::string* error)
+{
+	std::error_code ec;
+
+	auto tmp = path;
+	tmp += ".tmp";
+
+	if (!WriteDurable(tmp, data, error))
+	{
+		std::filesystem::remove(tmp, ec);
+		return false;
+	}
+
+	// previous generation stays around for recovery
+	if (std::filesystem::exists(path, ec))
+	{
+		if (Inject(WriteFault::Backup, path) ||
+			!std::filesystem::copy_file(path, BackupPath(path), std::filesystem::copy_options::overwrite_existing, ec))
+		{
+			std::filesystem::remove(tmp, ec);
+			return Fail(error, "backup");
+		}
+	}
+
+	if (Inject(WriteFault::Rename, path))
+	{
+		std::filesystem::remove(tmp, ec);
+		return Fail(error, "rename");
+	}
+
+	if (!ReplaceDurable(tmp, path, error))
+	{
+		std::filesystem::remove(tmp, ec);
+		return false;
+	}
+
+	return true;
+}
+
+// ------------------------------------------------------------
+// Worker
+// ------------------------------------------------------------
+
+static double Ms(Clock::duration d)
+{
+	return std::chrono::duration<double, std::milli>(d).count();
+}
+
+static void WorkerMain()
+{
+	auto& s = S();
+	std::string buffer;
+
+	std::unique_lock<std::mutex> lock(s.Mutex);
+
+	for (;;)
+	{
+		if (s.Queue.empty())
+		{
+			s.Idle.notify_all();
+			if (s.Stopping)
+				return;
+			s.Wake.wait(lock);
+			continue;
+		}
+
+		// let a burst settle before writing, unless we're shutting down / flushing
+		const auto due = s.Queue.front().Last + std::chrono::milliseconds(s.DelayMs);
+		if (!s.Stopping && s.Immediate == 0 && Clock::now() < due)
+		{
+			s.Wake.wait_until(lock, due);
+			continue;
+		}
+
+		PendingWrite job = std::move(s.Queue.front());
+		s.Queue.erase(s.Queue.begin());
+		for (const auto& t : job.Targets)
+			s.InFlight.push_back(t.Path);
+		lock.unlock();
+
+		const auto start = Clock::now();
+		uint64_t written = 0;
+		bool ok = true;
+
+		for (auto& t : job.Targets)
+		{
+			t.Serialize(buffer);
+			const std::wstring key = t.Path.wstring();
+
+			// recorded before the rename: the watcher may read the file the
+			// moment it lands and must see it as our own
+			uint64_t previous = 0;
+			bool hadPrevious = false;
+			lock.lock();
+			auto it = s.LastHash.find(key);
+			if (it != s.LastHash.end())
+			{
+				previous = it->second;
+				hadPrevious = true;
+			}
+			s.LastHash[key] = HashService::Fast64(buffer.data(), buffer.size());
+			lock.unlock();
+
+			std::string error;
+			if (!WriteBehind::WriteAtomic(t.Path, buffer, &error))
+			{
+				// the old file is still there, or the new one may not survive a
+				// crash yet: the next save of this content writes it again
+				lock.lock();
+				if (hadPrevious)
+					s.LastHash[key] = previous;
+				else
+					s.LastHash.erase(key);
+				lock.unlock();
+				ok = false;
+				break;
+			}
+			++written;
+		}
+		const auto done = Clock::now();
+
+		lock.lock();
+		s.InFlight.clear();
+
+		auto& st = s.Stats;
+		st.Writes += written;
+		if (ok)
+		{
+			st.LastWriteMs = Ms(done - start);
+			st.LastLatencyMs = Ms(done - job.First);
+			if (st.LastLatencyMs > st.MaxLatencyMs)
+				st.MaxLatencyMs = st.LastLatencyMs;
+			st.AvgLatencyMs += (st.LastLatencyMs - st.AvgLatencyMs) / (double)++s.Completed;
+		}
+		else
+		{
+			st.Failures++;
+		}
+	}
+}
+
+static void EnsureWorker()
+{
+	auto& s = S();
+	if (!s.Worker.joinable())
+	{
+		s.Stopping = false;
+		s.Worker = std::thread(WorkerMain);
+	}
+}
+
+// ------------------------------------------------------------
+// API
+// ------------------------------------------------------------
+
+void WriteBehind::SetDelay(int ms)
+{
+	std::lock_guard<std::mutex> lock(S().Mutex);
+	S().DelayMs = ms < 0 ? 0 : ms;
+}
+
+void WriteBehind::Request(const std::filesystem::path& path, Serializer serialize)
+{
+	std::vector<Target> targets;
+	targets.push_back({ path, std::move(serialize) });
+	Request(std::move(targets));
+}
+
+void WriteBehind::Request(std::vector<Target> targets)
+{
+	if (targets.empty())
+		return;
+
+	auto& s = S();
+	const auto now = Clock::now();
+
+	{
+		std::lock_guard<std::mutex> lock(s.Mutex);
+		EnsureWorker();
+
+		s.Stats.Requests++;
+
+		for (auto& p : s.Queue)
+		{
+			if (p.Targets.front().Path == targets.front().Path)
+			{
+				p.Targets = std::move(targets);
+				p.Last = now;
+				s.Stats.Coalesced++;
+				s.Wake.notify_one();
+				return;
+			}
+		}
+
+		s.Queue.push_back({ std::move(targets), now, now });
+	}
+
+	s.Wake.notify_one();
+}
+
+void WriteBehind::Flush()
+{
+	auto& s = S();
+	std::unique_lock<std::mutex> lock(s.Mutex);
+	if (!s.Worker.joinable())
+		return;
+
+	// write now instead of waiting out the delay
+	s.Immediate++;
+	s.Wake.notify_one();
+	s.Idle.wait(lock, [&] { return s.Queue.empty() && s.InFlight.empty(); });
+	s.Immediate--;
+}
+
+void WriteBehind::Shutdown()
+{
+	auto& s = S();
+	{
+		std::lock_guard<std::mutex> lock(s.Mutex);
+		if (!s.Worker.joinable())
+			return;
+		s.Stopping = true;
+	}
+	s.Wake.notify_one();
+	s.Worker.join();
+}
+
+bool WriteBehind::IsPending(const std::filesystem::path& path)
+{
+	auto& s = S();
+	std::lock_guard<std::mutex> lock(s.Mutex);
+	for (const auto& p : s.Queue)
+	{
+		for (const auto& t : p.Targets)
+		{
+			if (t.Path == path)
+				return true;
+		}
+	}
+	for (const auto& p : s.InFlight)
+	{
+		if (p == path)
+			return true;
+	}
+	return false;
+}
+
+bool WriteBehind::IsOwnWrite(const std::filesystem::path& path, std::string_view content)
+{
+	auto& s = S();
+	const uint64_t h = HashService::Fast64(content.data(), content.size());
+
+	std::lock_guard<std::mutex> lock(s.Mutex);
+	auto it = s.LastHash.find(path.wstring());
+	return it != s.LastHash.end() && it->second == h;
+}
+
+WriteBehindStats WriteBehind::Stats()
+{
+	std::lock_guard<std::mutex> lock(S().Mutex);
+	return S().Stats;
+}
+
+void WriteBehind::SetFaultHook(std::function<bool(WriteFault, const std::filesystem::path&)> hook)
+{
+	std::lock_guard<std::mutex> lock(S().Mutex);
+	S().FaultHook = std::move(hook);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Write-behind file persistence for settings.
+// Save requests are queued per path and coalesced: a path that is asked for
+// again before it's written is only written once, with the latest content.
+// Serialization and IO run on one background thread. Each write goes to a
+// temp file, is flushed to disk, the previous file is kept as <name>.bak, and
+// the temp is renamed over the target (the rename flushed too), so a crash
+// leaves either the old or the new file, never a torn one.
+
+enum class WriteFault : uint8_t
+{
+	Open,
+	Write,
+	Flush,
+	Backup,
+	Rename
+};
+
+struct WriteBehindStats
+{
+	uint64_t Requests = 0;
+	uint64_t Coalesced = 0;    // requests folded into an already pending write
+	uint64_t Writes = 0;
+	uint64_t Failures = 0;
+
+	double LastLatencyMs = 0.0;  // first request -> durable on disk
+	double MaxLatencyMs = 0.0;
+	double AvgLatencyMs = 0.0;
+	double LastWriteMs = 0.0;    // serialize + write + flush + rename
+};
+
+class WriteBehind
+{
+public:
+	// Fills out with the bytes to store; runs on the writer thread, so it must
+	// only touch data it owns (capture a copy of the settings)
+	using Serializer = std::function<void(std::string& out)>;
+
+	// Requests within this window of each other are written together
+	static void SetDelay(int ms);
+
+	static void Request(const std::filesystem::path& path, Serializer serialize);
+
+	struct Target
+	{
+		std::filesystem::path Path;
+		Serializer Serialize;
+	};
+
+	// Several files as one write (a settings file and its snapshot): written in
+	// order, coalesced by the first path, pending until the last is on disk.
+	// A failed target stops the rest, so later files are never newer than it.
+	static void Request(std::vector<Target> targets);
+
+	// Blocks until everything queued so far is on disk (shutdown, explicit export)
+	static void Flush();
+	static void Shutdown();
+
+	// Queued or being written right now
+	static bool IsPending(const std::filesystem::path& path);
+
+	// True if content is exactly what we last wrote to path; lets a file
+	// watcher ignore our own saves
+	static bool IsOwnWrite(const std::filesystem::path& path, std::string_view content);
+
+	static WriteBehindStats Stats();
+
+	// Test hook: return true to make that step fail
+	static void SetFaultHook(std::function<bool(WriteFault, const std::filesystem::path&)> hook);
+
+	// The write itself, exposed so other code can store a file the same way
+	static bool WriteAtomic(const std::filesystem::path& path, std::string_view data, std::string* error = nullptr);
+
+	// WriteAtomic's last step: renames an already synced tmp over path and
+	// syncs the directory entry
+	static bool ReplaceDurable(const std::filesystem::path& tmp, const std::filesystem::path& path, std::string* error = nullptr);
+
+	static std::filesystem::path BackupPath(const std::filesystem::path& path);
+};
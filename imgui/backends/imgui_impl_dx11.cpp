@@ -45,6 +45,7 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx11.h"
 #include "../hvk_emissive.h"
+#include "../hvk_sdf.h"
 
 // DirectX
 #include <stdio.h>
@@ -98,7 +99,14 @@ struct PIXEL_CONSTANT_BUFFER_DX11
 {
     float emissiveStrength;
     float additiveBlend;
-    float padding[2];
+    float sdfMode;              // texture0 alpha is a distance field (HvkSdfBinding)
+    float sdfEdge;
+    float sdfDistScale;
+    float outlineWidth;
+    float glowWidth;
+    float glowStrength;
+    float outlineColor[4];
+    float glowColor[4];
 };
 
 // Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
@@ -146,9 +154,7 @@ static void ImGui_ImplDX11_SetupRenderState(const ImDrawData* draw_data, ID3D11D
     if (device_ctx->Map(bd->pPixelConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource) == S_OK)
     {
         PIXEL_CONSTANT_BUFFER_DX11* pixel_constants = (PIXEL_CONSTANT_BUFFER_DX11*)mapped_resource.pData;
-        pixel_constants->emissiveStrength = 0.0f;
-        pixel_constants->additiveBlend = 0.0f;
-        pixel_constants->padding[0] = pixel_constants->padding[1] = 0.0f;
+        memset(pixel_constants, 0, sizeof(*pixel_constants));
         device_ctx->Unmap(bd->pPixelConstantBuffer, 0);
     }
 
@@ -343,6 +349,19 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                     pixel_constants.emissiveStrength = binding->EmissiveStrength;
                     pixel_constants.additiveBlend = binding->Additive ? 1.0f : 0.0f;
                 }
+                else if (ImTextureIdHasSdf(pcmd->GetTexID()))
+                {
+                    const HvkSdfBinding* binding = (const HvkSdfBinding*)pcmd->GetTexID();
+                    base_srv = emissive_srv = (ID3D11ShaderResourceView*)binding->BaseTexture;
+                    pixel_constants.sdfMode = 1.0f;
+                    pixel_constants.sdfEdge = binding->Edge;
+                    pixel_constants.sdfDistScale = binding->DistScale;
+                    pixel_constants.outlineWidth = binding->OutlineWidth;
+                    pixel_constants.glowWidth = binding->GlowWidth;
+                    pixel_constants.glowStrength = binding->GlowStrength;
+                    memcpy(pixel_constants.outlineColor, &binding->OutlineColor, sizeof(pixel_constants.outlineColor));
+                    memcpy(pixel_constants.glowColor, &binding->GlowColor, sizeof(pixel_constants.glowColor));
+                }
 
                 if (device->Map(bd->pPixelConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource) == S_OK)
                 {
@@ -559,7 +578,14 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
             {\
             float emissiveStrength;\
             float additiveBlend;\
-            float2 padding;\
+            float sdfMode;\
+            float sdfEdge;\
+            float sdfDistScale;\
+            float outlineWidth;\
+            float glowWidth;\
+            float glowStrength;\
+            float4 outlineColor;\
+            float4 glowColor;\
             };\
             struct PS_INPUT\
             {\
@@ -571,8 +597,24 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
             Texture2D texture0 : register(t0);\
             Texture2D texture1 : register(t1);\
             \
+            float4 over(float4 src, float4 dst)\
+            {\
+            float a = src.a + dst.a * (1.0f - src.a);\
+            return float4((src.rgb * src.a + dst.rgb * dst.a * (1.0f - src.a)) / max(a, 0.0001f), a);\
+            }\
+            \
             float4 main(PS_INPUT input) : SV_Target\
             {\
+            if (sdfMode > 0.5f)\
+            {\
+            float d = (texture0.Sample(sampler0, input.uv).a - sdfEdge) * sdfDistScale;\
+            float fill = saturate(d + 0.5f);\
+            float outline = outlineWidth > 0.0f ? saturate(d + outlineWidth + 0.5f) : 0.0f;\
+            float glow = glowWidth > 0.0f ? glowStrength * pow(saturate(1.0f + d / glowWidth), 2.0f) : 0.0f;\
+            float4 c = float4(glowColor.rgb, glowColor.a * glow);\
+            c = over(float4(outlineColor.rgb, outlineColor.a * outline), c);\
+            return over(float4(input.col.rgb, input.col.a * fill), c);\
+            }\
             float4 base = input.col * texture0.Sample(sampler0, input.uv); \
             float3 emissive = texture1.Sample(sampler0, input.uv).rgb * emissiveStrength;\
             float3 combined = base.rgb + (additiveBlend > 0.5f ? emissive : emissive * base.a);\
@@ -59,6 +59,7 @@
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx12.h"
 #include "../hvk_emissive.h"
+#include "../hvk_sdf.h"
 
 // DirectX
 #include <d3d12.h>
@@ -145,7 +146,14 @@ struct PIXEL_CONSTANT_BUFFER_DX12
 {
     float emissiveStrength;
     float additiveBlend;
-    float padding[2];
+    float sdfMode;              // texture0 alpha is a distance field (HvkSdfBinding)
+    float sdfEdge;
+    float sdfDistScale;
+    float outlineWidth;
+    float glowWidth;
+    float glowStrength;
+    float outlineColor[4];
+    float glowColor[4];
 };
 
 // Functions
@@ -198,7 +206,7 @@ static void ImGui_ImplDX12_SetupRenderState(ImDrawData* draw_data, ID3D12Graphic
     command_list->SetGraphicsRootSignature(bd->pRootSignature);
     command_list->SetGraphicsRoot32BitConstants(0, 16, &vertex_constant_buffer, 0);
     PIXEL_CONSTANT_BUFFER_DX12 pixel_constants = {};
-    command_list->SetGraphicsRoot32BitConstants(1, 4, &pixel_constants, 0);
+    command_list->SetGraphicsRoot32BitConstants(1, sizeof(pixel_constants) / 4, &pixel_constants, 0);
 
     // Setup blend factor
     const float blend_factor[4] = { 0.f, 0.f, 0.f, 0.f };
@@ -357,13 +365,27 @@ void ImGui_ImplDX12_RenderDrawData(ImDrawData* draw_data, ID3D12GraphicsCommandL
                     pixel_constants.emissiveStrength = binding->EmissiveStrength;
                     pixel_constants.additiveBlend = binding->Additive ? 1.0f : 0.0f;
                 }
+                else if (ImTextureIdHasSdf(tex_id))
+                {
+                    const HvkSdfBinding* binding = (const HvkSdfBinding*)tex_id;
+                    base_handle.ptr = (UINT64)binding->BaseTexture;
+                    emissive_handle = base_handle;
+                    pixel_constants.sdfMode = 1.0f;
+                    pixel_constants.sdfEdge = binding->Edge;
+                    pixel_constants.sdfDistScale = binding->DistScale;
+                    pixel_constants.outlineWidth = binding->OutlineWidth;
+                    pixel_constants.glowWidth = binding->GlowWidth;
+                    pixel_constants.glowStrength = binding->GlowStrength;
+                    memcpy(pixel_constants.outlineColor, &binding->OutlineColor, sizeof(pixel_constants.outlineColor));
+                    memcpy(pixel_constants.glowColor, &binding->GlowColor, sizeof(pixel_constants.glowColor));
+                }
                 else
                 {
                     base_handle.ptr = (UINT64)tex_id;
                     emissive_handle = base_handle;
                 }
 
-                command_list->SetGraphicsRoot32BitConstants(1, 4, &pixel_constants, 0);
+                command_list->SetGraphicsRoot32BitConstants(1, sizeof(pixel_constants) / 4, &pixel_constants, 0);
                 command_list->SetGraphicsRootDescriptorTable(2, base_handle);
                 command_list->SetGraphicsRootDescriptorTable(3, emissive_handle);
                 command_list->DrawIndexedInstanced(pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
@@ -617,10 +639,11 @@ bool    ImGui_ImplDX12_CreateDeviceObjects()
         param[0].Constants.Num32BitValues = 16;
         param[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
 
+        // pixelBuffer, b1 in the pixel shader
         param[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
-        param[1].Constants.ShaderRegister = 0;
-        param[1].Constants.RegisterSpace = 1;
-        param[1].Constants.Num32BitValues = 4;
+        param[1].Constants.ShaderRegister = 1;
+        param[1].Constants.RegisterSpace = 0;
+        param[1].Constants.Num32BitValues = sizeof(PIXEL_CONSTANT_BUFFER_DX12) / 4;
         param[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
         param[2].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
@@ -765,7 +788,14 @@ bool    ImGui_ImplDX12_CreateDeviceObjects()
             {\
               float emissiveStrength;\
               float additiveBlend;\
-              float2 padding;\
+              float sdfMode;\
+              float sdfEdge;\
+              float sdfDistScale;\
+              float outlineWidth;\
+              float glowWidth;\
+              float glowStrength;\
+              float4 outlineColor;\
+              float4 glowColor;\
             };\
             struct PS_INPUT\
             {\
@@ -777,8 +807,24 @@ bool    ImGui_ImplDX12_CreateDeviceObjects()
             Texture2D texture0 : register(t0);\
             Texture2D texture1 : register(t1);\
             \
+            float4 over(float4 src, float4 dst)\
+            {\
+              float a = src.a + dst.a * (1.0f - src.a);\
+              return float4((src.rgb * src.a + dst.rgb * dst.a * (1.0f - src.a)) / max(a, 0.0001f), a);\
+            }\
+            \
             float4 main(PS_INPUT input) : SV_Target\
             {\
+              if (sdfMode > 0.5f)\
+              {\
+                float d = (texture0.Sample(sampler0, input.uv).a - sdfEdge) * sdfDistScale;\
+                float fill = saturate(d + 0.5f);\
+                float outline = outlineWidth > 0.0f ? saturate(d + outlineWidth + 0.5f) : 0.0f;\
+                float glow = glowWidth > 0.0f ? glowStrength * pow(saturate(1.0f + d / glowWidth), 2.0f) : 0.0f;\
+                float4 c = float4(glowColor.rgb, glowColor.a * glow);\
+                c = over(float4(outlineColor.rgb, outlineColor.a * outline), c);\
+                return over(float4(input.col.rgb, input.col.a * fill), c);\
+              }\
               float4 base = input.col * texture0.Sample(sampler0, input.uv);\
               float3 emissive = texture1.Sample(sampler0, input.uv).rgb * emissiveStrength;\
               float3 combined = base.rgb + (additiveBlend > 0.5f ? emissive : emissive * base.a);\
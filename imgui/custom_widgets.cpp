@@ -2,8 +2,10 @@
 
 #include "custom_widgets.h"
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 static std::string WStringToUtf8(const std::wstring& w)
 {
@@ -35,6 +37,17 @@ static std::string WStringToUtf8(const std::wstring& w)
 	return result;
 }
 
+static std::wstring Utf8ToWString(const std::string& s)
+{
+	if (s.empty())
+		return {};
+
+	int size = MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), nullptr, 0);
+	std::wstring result(size, 0);
+	MultiByteToWideChar(CP_UTF8, 0, s.data(), (int)s.size(), result.data(), size);
+	return result;
+}
+
 namespace ImGui {
 
 	bool SnapSlider(const std::vector<int>& snapValues, int* v, const char* label)
@@ -344,7 +357,31 @@ namespace ImGui {
 		const std::vector<VolumeInfo>& vols,
 		int* selectedIndex)
 	{
-		if (ImGui::BeginTable("Volumes", 5,
+		// USB trust per volume. A lookup can enumerate devices, so it is only
+		// redone when the volume letters or the USB registry change.
+		static std::string trustLetters;
+		static uint64_t trustGeneration = 0;
+		static std::vector<const char*> trustText;
+
+		std::string letters;
+		for (const auto& v : vols)
+			letters += (char)Disk::ExtractDriveLetter(v.RootPath);
+
+		if (letters != trustLetters || USBHelper::RegistryGeneration() != trustGeneration)
+		{
+			trustText.clear();
+			for (char l : letters)
+			{
+				bool usb = false;
+				const UsbTrust t = l ? USBHelper::CheckDrive(l, &usb) : UsbTrust::Unknown;
+				trustText.push_back(!usb ? "-" : t == UsbTrust::Allowed ? "Trusted" : t == UsbTrust::Denied ? "Blocked" : "Unknown");
+			}
+
+			trustLetters = letters;
+			trustGeneration = USBHelper::RegistryGeneration(); // after the lookups, they may patch it
+		}
+
+		if (ImGui::BeginTable("Volumes", 6,
 			ImGuiTableFlags_RowBg |
 			ImGuiTableFlags_Borders |
 			ImGuiTableFlags_Resizable))
@@ -354,6 +391,7 @@ namespace ImGui {
 			ImGui::TableSetupColumn("FS");
 			ImGui::TableSetupColumn("Free");
 			ImGui::TableSetupColumn("Total");
+			ImGui::TableSetupColumn("USB");
 
 			ImGui::TableHeadersRow();
 
@@ -376,6 +414,9 @@ namespace ImGui {
 				ImGui::TableSetColumnIndex(4);
 				ImGui::Text("%s", BytesToStr(vols[i].TotalBytes));
 
+				ImGui::TableSetColumnIndex(5);
+				ImGui::TextUnformatted(trustText[i]);
+
 				if (selectedIndex)
 				{
 					ImGui::TableSetColumnIndex(0);
@@ -882,7 +923,8 @@ namespace ImGui {
 					ui.SelectedPartition = -1;
 
 					appstate.Selection.PhysicalIndex = i;
-					appstate.Partitions = Disk::ListPartitions(i);
+					appstate.Partitions = Disk::ListPartitions(i);
+					appstate.LayoutGeneration++;
 				}
 				ImGui::SameLine();
 				ImGui::Text("PhysicalDrive%d", i);
@@ -971,12 +1013,129 @@ namespace ImGui {
 			if (used < total)
 				unallocated = total - used;
 		}
+		// -------------------------
+		// Batch queue
+		// -------------------------
+		static const char* kQueueFs[] = { "NTFS", "exFAT", "FAT32" }; // matches the File System combo
+
+		// (re)targets the plan at the selected disk, snapshotting its layout.
+		// A refresh re-snapshots it and keeps the queue, which is then
+		// simulated against what is actually on the disk now.
+		auto planForSelected = [&]()
+			{
+				if (appstate.PendingOps.DiskIndex() != ui.SelectedDisk)
+					appstate.PendingOps.Reset(ui.SelectedDisk);
+				else if (appstate.PendingBaseGeneration == appstate.LayoutGeneration)
+					return;
+
+				appstate.PendingBase = Disk::BuildPlannedLayout(
+					ui.SelectedDisk,
+					appstate.PhysicalDisks[ui.SelectedDisk],
+					appstate.Partitions);
+				appstate.PendingBaseGeneration = appstate.LayoutGeneration;
+			};
+
+		bool queueActive = ui.QueueOps && validDisk;
+		PlannedLayout simulated{};
+		std::string simError;
+		bool simOk = true;
+
+		if (queueActive)
+		{
+			planForSelected();
+			simOk = appstate.PendingOps.Simulate(appstate.PendingBase, simulated, &simError);
+
+			// size the slider against what the disk will look like after the batch
+			if (simOk)
+				unallocated = simulated.UnallocatedBytes();
+		}
+
 		bool hasUnallocated = unallocated >= (1ull << 20); // >= 1MB
 
+		// -------------------------
+		// DiskPart job
+		// -------------------------
+		if (appstate.DiskJob)
+		{
+			// read Done() first, the final lines are pushed before it flips
+			const bool done = appstate.DiskJob->Done();
+
+			ProcessLine line;
+			while (appstate.DiskJob->PopLine(line))
+			{
+				if (appstate.DiskLog.size() >= 512)
+					appstate.DiskLog.erase(appstate.DiskLog.begin());
+				appstate.DiskLog.push_back(std::move(line));
+			}
+
+			if (done)
+			{
+				line.Stream = ProcessStream::Runner;
+				line.Text = "diskpart finished (exit code " + std::to_string(appstate.DiskJob->ExitCode()) + ")";
+				appstate.DiskLog.push_back(line);
+
+				if (appstate.DiskJobTarget >= 0)
+					appstate.RescanDisk = appstate.DiskJobTarget;
+				else
+					appstate.NeedsRefresh = true;
+
+				// any plan for that disk was simulated against the old layout
+				if (appstate.DiskJobTarget < 0 || appstate.PendingOps.DiskIndex() == appstate.DiskJobTarget)
+					appstate.PendingOps.Reset(-1);
+
+				appstate.DiskJob.reset();
+				ui.SelectedPartition = -1;
+			}
+		}
+
+		bool busy = appstate.DiskJob != nullptr;
+
+		// diskpart and a folder sync never run against the disks at the same time
+		const bool syncing = appstate.SyncJob && !appstate.SyncJob->Done();
+
+		auto runPlan = [&](const DiskPlan& plan, const PlannedLayout& base)
+			{
+				if (appstate.DiskJob || syncing)
+					return; // one diskpart session at a time, never during a sync
+
+				std::string error;
+				appstate.DiskLog.clear();
+				appstate.DiskJobTarget = plan.DiskIndex();
+				appstate.DiskJob = Disk::StartPlan(plan, base, &error);
+
+				if (!appstate.DiskJob)
+					appstate.DiskLog.push_back({ ProcessStream::Runner, error });
+			};
+
+		// immediate actions run as a one-op plan against a fresh snapshot
+		auto runNow = [&](auto addOp)
+			{
+				DiskPlan plan;
+				PlannedLayout base{};
+
+				plan.Reset(validDisk ? ui.SelectedDisk : -1);
+				addOp(plan);
+
+				if (validDisk)
+				{
+					base = Disk::BuildPlannedLayout(
+						ui.SelectedDisk,
+						appstate.PhysicalDisks[ui.SelectedDisk],
+						appstate.Partitions);
+				}
+
+				runPlan(plan, base);
+			};
+
 
 		ImGui::Text("Disk Actions");
 		ImGui::Separator();
 
+		ImGui::Checkbox("Queue Operations", &ui.QueueOps);
+		ImGui::Spacing(4.f);
+
+		ImGui::BeginDisabled(busy || syncing);
+
 		// -------------------------
 		// Rename volume
 		// -------------------------
@@ -1007,15 +1166,14 @@ namespace ImGui {
 					letter = Disk::FindAnyDriveLetterForDisk(ui.SelectedDisk);
 				}
 
-				if (letter)
+				if (letter && queueActive)
 				{
-					Disk::RenameVolume(
-						letter,
-						CharToWString(ui.RenameLabel),
-						nullptr
-					);
-
-					appstate.NeedsRefresh = true;
+					appstate.PendingOps.RenameVolume((char)letter, ui.RenameLabel);
+				}
+				else if (letter)
+				{
+					std::string label = ui.RenameLabel;
+					runNow([&](DiskPlan& plan) { plan.RenameVolume((char)letter, label); });
 				}
 				else
 				{
@@ -1081,8 +1239,13 @@ namespace ImGui {
 		if (!validDisk || !hasUnallocated)
 			ImGui::BeginDisabled();
 
-		if (ImGui::Button("Create Partition", ImVec2(-1, 0)))
-			ui.ConfirmCreatePartition = true;
+		if (ImGui::Button(queueActive ? "Queue Create Partition" : "Create Partition", ImVec2(-1, 0)))
+		{
+			if (queueActive)
+				appstate.PendingOps.CreatePartition(allocMB, kQueueFs[ui.FileSystem], ui.VolumeLabel, ui.QuickFormat);
+			else
+				ui.ConfirmCreatePartition = true;
+		}
 
 		if (!validDisk || !hasUnallocated)
 			ImGui::EndDisabled();
@@ -1095,12 +1258,205 @@ namespace ImGui {
 		if (!validPart)
 			ImGui::BeginDisabled();
 
-		if (ImGui::Button("Delete Partition", ImVec2(-1, 0)))
-			ui.ConfirmDeletePartition = true;
+		if (ImGui::Button(queueActive ? "Queue Delete Partition" : "Delete Partition", ImVec2(-1, 0)))
+		{
+			if (queueActive)
+				appstate.PendingOps.DeletePartition(appstate.Partitions[ui.SelectedPartition].Offset);
+			else
+				ui.ConfirmDeletePartition = true;
+		}
 
 		if (!validPart)
 			ImGui::EndDisabled();
 
+		ImGui::EndDisabled(); // busy
+
+		// -------------------------
+		// Pending operations
+		// -------------------------
+		if (queueActive)
+		{
+			ImGui::Spacing(10.f);
+			ImGui::Text("Pending Operations (%d)", (int)appstate.PendingOps.Ops().size());
+			ImGui::Separator();
+
+			int removeAt = -1;
+			const auto& ops = appstate.PendingOps.Ops();
+
+			for (int i = 0; i < (int)ops.size(); i++)
+			{
+				ImGui::PushID(2000 + i);
+				if (ImGui::SmallButton("x"))
+					removeAt = i;
+				ImGui::SameLine();
+				ImGui::Text("%d. %s", i + 1, DiskPlan::Describe(ops[i]).c_str());
+				ImGui::PopID();
+			}
+
+			if (removeAt >= 0)
+				appstate.PendingOps.RemoveAt((size_t)removeAt);
+
+			if (!simOk)
+			{
+				ImGui::TextColored(ImVec4(1.f, 0.35f, 0.35f, 1.f), "%s", simError.c_str());
+			}
+			else if (!appstate.PendingOps.Empty() &&
+				ImGui::BeginTable("PlanPreview", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+			{
+				ImGui::TableSetupColumn("Offset");
+				ImGui::TableSetupColumn("Size");
+				ImGui::TableSetupColumn("FS");
+				ImGui::TableSetupColumn("Label");
+				ImGui::TableHeadersRow();
+
+				for (const auto& p : simulated.Partitions)
+				{
+					ImGui::TableNextRow();
+
+					ImGui::TableSetColumnIndex(0);
+					ImGui::Text("%s%llu MB", p.Created ? "+ " : "", (unsigned long long)(p.Offset >> 20));
+
+					ImGui::TableSetColumnIndex(1);
+					ImGui::Text("%s", BytesToStr(p.Size));
+
+					ImGui::TableSetColumnIndex(2);
+					ImGui::Text("%s", p.FileSystem.c_str());
+
+					ImGui::TableSetColumnIndex(3);
+					if (p.Letter)
+						ImGui::Text("%c: %s", p.Letter, p.Label.c_str());
+					else
+						ImGui::Text("%s", p.Label.c_str());
+				}
+
+				ImGui::EndTable();
+			}
+
+			bool canApply = simOk && !busy && !syncing && !appstate.PendingOps.Empty();
+
+			if (!canApply)
+				ImGui::BeginDisabled();
+
+			if (ImGui::Button("Apply All", ImVec2(ImGui::GetContentRegionAvail().x * 0.5f, 0)))
+				ui.ConfirmApplyPlan = true;
+
+			if (!canApply)
+				ImGui::EndDisabled();
+
+			ImGui::SameLine();
+
+			if (ImGui::Button("Clear", ImVec2(-1, 0)))
+				appstate.PendingOps.Clear();
+		}
+
+		// -------------------------
+		// Sync folder onto the volume
+		// -------------------------
+		{
+			ImGui::Spacing(10.f);
+			ImGui::Text("Sync Folder");
+			ImGui::Separator();
+
+			// a partition's volume GUID root works as a path even without a letter
+			std::wstring target;
+			if (validPart)
+				target = Disk::GetPartitionRootPath(ui.SelectedDisk, appstate.Partitions[ui.SelectedPartition]);
+			else if (appstate.Selection.VolumeIndex >= 0)
+				target = appstate.Volumes[appstate.Selection.VolumeIndex].RootPath;
+
+			ImGui::BeginDisabled(syncing);
+			ImGui::InputText("Source Folder", ui.SyncSource, sizeof(ui.SyncSource));
+			ImGui::Checkbox("Delete files not in source", &ui.SyncDeleteExtra);
+			ImGui::EndDisabled();
+
+			const bool canSync = !busy && !syncing && !target.empty() && ui.SyncSource[0];
+
+			if (!canSync)
+				ImGui::BeginDisabled();
+
+			if (ImGui::Button("Sync To Volume", ImVec2(-1, 0)))
+			{
+				SyncOptions options;
+				options.DeleteExtraneous = ui.SyncDeleteExtra;
+				appstate.SyncJob = DeltaSyncJob::Start(Utf8ToWString(ui.SyncSource), target, options);
+			}
+
+			if (!canSync)
+				ImGui::EndDisabled();
+
+			if (appstate.SyncJob && !appstate.SyncJob->Done())
+			{
+				const SyncProgress& p = appstate.SyncJob->Progress();
+				const uint64_t total = p.FilesTotal.load();
+				const uint64_t done = p.FilesDone.load();
+
+				char overlay[64];
+				snprintf(overlay, sizeof(overlay), "%llu / %llu files", (unsigned long long)done, (unsigned long long)total);
+				ImGui::ProgressBar(total ? (float)done / (float)total : 0.f, ImVec2(-1, 0), overlay);
+				ImGui::Text("Written: %s", BytesToStr(p.BytesWritten.load()));
+
+				if (ImGui::Button(appstate.SyncJob->Cancelled() ? "Aborting..." : "Abort Sync", ImVec2(-1, 0)))
+					appstate.SyncJob->Cancel();
+			}
+			else if (appstate.SyncJob)
+			{
+				const SyncReport& r = appstate.SyncJob->Report();
+
+				if (appstate.SyncJob->Succeeded())
+					ImGui::TextColored(ImVec4(0.4f, 1.f, 0.5f, 1.f), "Sync finished in %.1f s", r.Seconds);
+				else
+					ImGui::TextColored(ImVec4(1.f, 0.35f, 0.35f, 1.f), "Sync stopped after %.1f s", r.Seconds);
+
+				ImGui::Text("%llu files: %llu copied, %llu patched, %llu unchanged, %llu deleted, %llu failed",
+					(unsigned long long)r.FilesScanned, (unsigned long long)r.FilesCopied,
+					(unsigned long long)r.FilesPatched, (unsigned long long)r.FilesUnchanged,
+					(unsigned long long)r.FilesDeleted, (unsigned long long)r.FilesFailed);
+
+				// BytesToStr shares one buffer, so one value per call
+				ImGui::Text("Written: %s", BytesToStr(r.BytesWritten));
+				ImGui::SameLine();
+				ImGui::Text("of %s", BytesToStr(r.BytesSource));
+				if (r.SecondsSaved > 0.0)
+					ImGui::Text("About %.1f s of writes saved", r.SecondsSaved);
+
+				for (size_t i = 0; i < r.Errors.size() && i < 8; ++i)
+					ImGui::TextColored(ImVec4(1.f, 0.55f, 0.35f, 1.f), "%s", r.Errors[i].c_str());
+				if (r.Errors.size() > 8)
+					ImGui::TextDisabled("(%d more)", (int)(r.Errors.size() - 8));
+
+				if (ImGui::Button("Dismiss", ImVec2(-1, 0)))
+					appstate.SyncJob.reset();
+			}
+		}
+
+		// -------------------------
+		// DiskPart output
+		// -------------------------
+		if (busy || !appstate.DiskLog.empty())
+		{
+			ImGui::Spacing(10.f);
+			ImGui::TextUnformatted(busy ? "DiskPart Output (running)" : "DiskPart Output");
+			ImGui::Separator();
+
+			ImGui::BeginChild("DiskPartLog", ImVec2(0, 140), true);
+
+			for (const auto& l : appstate.DiskLog)
+			{
+				if (l.Stream == ProcessStream::Stdout)
+					ImGui::TextUnformatted(l.Text.c_str());
+				else
+					ImGui::TextColored(ImVec4(1.f, 0.55f, 0.35f, 1.f), "%s", l.Text.c_str());
+			}
+
+			if (busy)
+				ImGui::SetScrollHereY(1.0f);
+
+			ImGui::EndChild();
+
+			if (busy && ImGui::Button("Abort", ImVec2(-1, 0)))
+				appstate.DiskJob->Cancel();
+		}
+
 		ImGui::EndChild();
 		ImGui::EndChild();
 
@@ -1127,23 +1483,19 @@ namespace ImGui {
 
 			ImGui::SameLine();
 
+			// a job may have started since the popup opened
+			ImGui::BeginDisabled(busy || syncing);
 			if (ImGui::Button("Create", ImVec2(120, 0)))
 			{
+				runNow([&](DiskPlan& plan)
+					{
+						plan.CreatePartition(allocMB, kQueueFs[ui.FileSystem], ui.VolumeLabel, ui.QuickFormat);
+					});
 
-				Disk::CreatePartition(
-					ui.SelectedDisk,
-					allocMB,
-					FsToString((FileSystem)ui.FileSystem),
-					CharToWString(ui.VolumeLabel),
-					ui.QuickFormat,
-					0,
-					nullptr
-				);
-
-				appstate.NeedsRefresh = true;
 				ui.ConfirmCreatePartition = false;
 				ImGui::CloseCurrentPopup();
 			}
+			ImGui::EndDisabled();
 
 			ImGui::EndPopup();
 		}
@@ -1171,18 +1523,16 @@ namespace ImGui {
 
 			ImGui::SameLine();
 
+			ImGui::BeginDisabled(busy || syncing);
 			if (ImGui::Button("Delete", ImVec2(120, 0)))
 			{
-				Disk::DeletePartition(
-					ui.SelectedDisk,
-					ui.SelectedPartition,
-					nullptr
-				);
+				const uint64_t offset = appstate.Partitions[ui.SelectedPartition].Offset;
+				runNow([&](DiskPlan& plan) { plan.DeletePartition(offset); });
 
-				appstate.NeedsRefresh = true;
 				ui.ConfirmDeletePartition = false;
 				ImGui::CloseCurrentPopup();
 			}
+			ImGui::EndDisabled();
 
 			ImGui::EndPopup();
 		}
@@ -1216,22 +1566,69 @@ namespace ImGui {
 
 			ImGui::SameLine();
 
-			if (ImGui::Button("Proceed", ImVec2(120, 0)))
+			if (queueActive && ImGui::Button("Queue", ImVec2(120, 0)))
 			{
-				Disk::RecreateDiskAndFormat(
-					ui.SelectedDisk,
-					scheme == 1,
-					FsToString((FileSystem)ui.FileSystem),
-					CharToWString(ui.VolumeLabel),
-					ui.QuickFormat,
-					0,
-					nullptr
-				);
+				appstate.PendingOps.ConvertScheme(scheme == 1);
+				appstate.PendingOps.CreatePartition(0, kQueueFs[ui.FileSystem], ui.VolumeLabel, ui.QuickFormat);
 
-				appstate.NeedsRefresh = true;
 				ui.ConfirmRecreate = false;
 				ImGui::CloseCurrentPopup();
 			}
+			else if (!queueActive)
+			{
+				ImGui::BeginDisabled(busy || syncing);
+				if (ImGui::Button("Proceed", ImVec2(120, 0)))
+				{
+					runNow([&](DiskPlan& plan)
+						{
+							plan.ConvertScheme(scheme == 1);
+							plan.CreatePartition(0, kQueueFs[ui.FileSystem], ui.VolumeLabel, ui.QuickFormat);
+						});
+
+					ui.ConfirmRecreate = false;
+					ImGui::CloseCurrentPopup();
+				}
+				ImGui::EndDisabled();
+			}
+
+			ImGui::EndPopup();
+		}
+
+		// =========================================================
+		// CONFIRM: APPLY QUEUED OPERATIONS
+		// =========================================================
+		if (ui.ConfirmApplyPlan)
+			ImGui::OpenPopup("Apply Operations");
+
+		if (ImGui::BeginPopupModal("Apply Operations", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+		{
+			ImGui::TextWrapped(
+				"%d queued operation(s) will run on PhysicalDrive%d in a single DiskPart session.\n"
+				"Deleted partitions cannot be recovered.",
+				(int)appstate.PendingOps.Ops().size(),
+				appstate.PendingOps.DiskIndex()
+			);
+
+			ImGui::Separator();
+
+			if (ImGui::Button("Cancel", ImVec2(120, 0)))
+			{
+				ui.ConfirmApplyPlan = false;
+				ImGui::CloseCurrentPopup();
+			}
+
+			ImGui::SameLine();
+
+			ImGui::BeginDisabled(busy || syncing);
+			if (ImGui::Button("Apply", ImVec2(120, 0)))
+			{
+				runPlan(appstate.PendingOps, appstate.PendingBase);
+				appstate.PendingOps.Clear();
+
+				ui.ConfirmApplyPlan = false;
+				ImGui::CloseCurrentPopup();
+			}
+			ImGui::EndDisabled();
 
 			ImGui::EndPopup();
 		}
@@ -1254,153 +1651,6 @@ namespace ImGui {
 
 
 
-        bool UpdateStyle(c_usersettings& user, ImGuiStyle& style) {
-
-		style.Colors[ImGuiCol_WindowBg].x = (float)user.style.main_bg_color.x;
-		style.Colors[ImGuiCol_WindowBg].y = (float)user.style.main_bg_color.y;
-		style.Colors[ImGuiCol_WindowBg].z = (float)user.style.main_bg_color.z;
-		style.Colors[ImGuiCol_WindowBg].w = user.style.main_opacity;
-
-		style.Colors[ImGuiCol_Text].x = (float)user.style.main_text_color.x;
-		style.Colors[ImGuiCol_Text].y = (float)user.style.main_text_color.y;
-		style.Colors[ImGuiCol_Text].z = (float)user.style.main_text_color.z;
-		style.Colors[ImGuiCol_Text].w = (float)user.style.main_text_color.w;
-
-		// Apply modern widget styling defaults
-		style.FrameRounding = 6.0f;
-		style.GrabRounding = 8.0f;
-		style.ScrollbarRounding = 9.0f;
-		style.TabRounding = 6.0f;
-		style.WindowRounding = 8.0f;
-		style.ChildRounding = 6.0f;
-		style.PopupRounding = 8.0f;
-		
-		// Better spacing and padding
-		style.FramePadding = ImVec2(10.0f, 6.0f);
-		style.ItemSpacing = ImVec2(8.0f, 6.0f);
-		style.ItemInnerSpacing = ImVec2(6.0f, 4.0f);
-		style.WindowPadding = ImVec2(12.0f, 12.0f);
-		style.CellPadding = ImVec2(6.0f, 4.0f);
-		
-		// Enhanced button colors from user settings
-		style.Colors[ImGuiCol_Button] = user.style.button_color;
-		style.Colors[ImGuiCol_ButtonHovered] = user.style.button_hover_color;
-		style.Colors[ImGuiCol_ButtonActive] = user.style.button_active_color;
-		
-		// Enhanced frame colors
-		style.Colors[ImGuiCol_FrameBg] = ImVec4(0.15f, 0.15f, 0.15f, 0.75f);
-		style.Colors[ImGuiCol_FrameBgHovered] = ImVec4(0.2f, 0.2f, 0.2f, 0.85f);
-		style.Colors[ImGuiCol_FrameBgActive] = ImVec4(0.25f, 0.25f, 0.25f, 0.9f);
-		
-		// Enhanced slider colors
-		style.Colors[ImGuiCol_SliderGrab] = ImVec4(0.4f, 0.4f, 0.4f, 1.0f);
-		style.Colors[ImGuiCol_SliderGrabActive] = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);
-
-                static float last_applied = 1.0f;
-                bool fonts_rebuilt = false;
-		float desired = user.style.dpi_scale * user.style.ui_scale;
-
-		ImGuiIO& io = ImGui::GetIO();
-
-                const std::string base = HVKIO::GetLocalAppData() + "\\PSHVK\\assets\\fonts\\";
-                std::string satoshiRegularPath = base + "satoshi\\Satoshi-Regular.otf";
-                std::string satoshiMediumPath = base + "satoshi\\Satoshi-Medium.otf";
-                std::string satoshiBoldPath = base + "satoshi\\Satoshi-Bold.otf";
-                std::string proggyPath = base + "proggy_clean\\ProggyClean.ttf";
-
-                if (fabsf(desired - last_applied) > 0.001f)
-                {
-                        style.ScaleAllSizes(desired / last_applied);
-                        last_applied = desired;
-
-                        fonts_rebuilt = true;
-
-			// Use 13px as base to match ImGui's default font size for consistent spacing
-			float baseFontSize = 13.0f;
-			// Handle ui_scale being 0.0 (default) by using 1.0 as fallback
-			float fontSize = baseFontSize * (user.style.ui_scale > 0.0f ? user.style.ui_scale : 1.0f);
-
-                        io.Fonts->Clear();
-
-                        // Load Satoshi Regular font with error handling
-                        ImFontConfig satoshiRegularConfig;
-                        satoshiRegularConfig.Flags |= ImFontFlags_NoLoadError;
-                        user.style.satoshi_regular = io.Fonts->AddFontFromFileTTF(satoshiRegularPath.c_str(), fontSize, &satoshiRegularConfig);
-                        if (!user.style.satoshi_regular)
-                        {
-                                printf("[FONT] UpdateStyle: Failed to load Satoshi Regular font from: %s\n", satoshiRegularPath.c_str());
-                                // Fallback to default font if Satoshi Regular fails to load
-                                ImFontConfig defaultConfig;
-                                defaultConfig.SizePixels = fontSize;
-                                user.style.satoshi_regular = io.Fonts->AddFontDefault(&defaultConfig);
-                                printf("[FONT] UpdateStyle: Using default font as fallback for Satoshi Regular\n");
-                        }
-                        else
-                        {
-                                printf("[FONT] UpdateStyle: Successfully loaded Satoshi Regular font from: %s\n", satoshiRegularPath.c_str());
-                        }
-
-                        // Load Satoshi Medium font with error handling
-                        ImFontConfig satoshiMediumConfig;
-                        satoshiMediumConfig.Flags |= ImFontFlags_NoLoadError;
-                        user.style.satoshi_medium = io.Fonts->AddFontFromFileTTF(satoshiMediumPath.c_str(), fontSize, &satoshiMediumConfig);
-                        if (!user.style.satoshi_medium)
-                        {
-                                printf("[FONT] UpdateStyle: Failed to load Satoshi Medium font from: %s\n", satoshiMediumPath.c_str());
-                                // Fallback to default font if Satoshi fails to load
-                                user.style.satoshi_medium = user.style.satoshi_regular;
-                                printf("[FONT] UpdateStyle: Using Satoshi Regular as fallback for Satoshi Medium\n");
-                        }
-                        else
-                        {
-                                printf("[FONT] UpdateStyle: Successfully loaded Satoshi Medium font from: %s\n", satoshiMediumPath.c_str());
-                        }
-
-                        // Load Satoshi Bold font with error handling
-                        ImFontConfig satoshiBoldConfig;
-                        satoshiBoldConfig.Flags |= ImFontFlags_NoLoadError;
-                        user.style.satoshi_bold = io.Fonts->AddFontFromFileTTF(satoshiBoldPath.c_str(), fontSize, &satoshiBoldConfig);
-                        if (!user.style.satoshi_bold)
-                        {
-                                printf("[FONT] UpdateStyle: Failed to load Satoshi Bold font from: %s\n", satoshiBoldPath.c_str());
-                                // Fallback to Satoshi Medium if Bold fails to load
-                                user.style.satoshi_bold = user.style.satoshi_medium;
-                                printf("[FONT] UpdateStyle: Using Satoshi Medium as fallback for Satoshi Bold\n");
-                        }
-                        else
-                        {
-                                printf("[FONT] UpdateStyle: Successfully loaded Satoshi Bold font from: %s\n", satoshiBoldPath.c_str());
-                        }
-
-                        // Load Proggy font with error handling
-                        ImFontConfig proggyConfig;
-                        proggyConfig.Flags |= ImFontFlags_NoLoadError;
-                        user.style.proggy_clean = io.Fonts->AddFontFromFileTTF(proggyPath.c_str(), fontSize, &proggyConfig);
-                        if (!user.style.proggy_clean)
-                        {
-                                printf("[FONT] UpdateStyle: Failed to load Proggy font from: %s\n", proggyPath.c_str());
-                                // Fallback to default font if Proggy fails to load
-                                ImFontConfig defaultConfig;
-                                defaultConfig.SizePixels = fontSize;
-                                user.style.proggy_clean = io.Fonts->AddFontDefault(&defaultConfig);
-                                printf("[FONT] UpdateStyle: Using default font as fallback for Proggy\n");
-                        }
-                        else
-                        {
-                                printf("[FONT] UpdateStyle: Successfully loaded Proggy font from: %s\n", proggyPath.c_str());
-                        }
-
-                        io.Fonts->Build();
-
-                        // Set satoshi regular as the default font for the menu
-                        io.FontDefault = user.style.satoshi_regular;
-                }
-
-
-
-                return fonts_rebuilt;
-        }
-
 	void Spacing(float height)
 	{
 		ImGui::Dummy(ImVec2(0.0f, height));
@@ -4,7 +4,8 @@
 #include <vector>
 #include "../example_win32_directx12/util/disk.h"
 #include "../example_win32_directx12/settings.h"
-#include "../example_win32_directx12/util/system.h"
+#include "../example_win32_directx12/util/system.h"
+#include "hvk_style.h"
 
 static const char* kFileSystems[] = {
 	"NTFS",
@@ -73,7 +74,6 @@ namespace ImGui {
 	void DrawResolutionWidget(ResolutionUI& g_ResUI);
 
 
-	bool UpdateStyle(c_usersettings& user, ImGuiStyle& style);
 	void Spacing(float height);
 	void HSpacing(float width);
 
@@ -0,0 +1,619 @@
+#include "hvk_font_cache.h"
+#include "imgui_internal.h"
+#include "hvk_stb_truetype.h"
+#include "../example_win32_directx12/util/hash.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	constexpr char kMagic[8] = { 'H', 'V', 'K', 'F', 'N', 'T', 'C', '\0' };
+	constexpr uint32_t kFormat = 1;
+
+	struct CacheHeader
+	{
+		char Magic[8];
+		uint32_t Format;
+		uint32_t ImGuiVersion;      // rasterizers and glyph placement change between versions
+		uint64_t Count;
+		uint64_t PixelBytes;
+	};
+
+	struct GlyphRecord
+	{
+		uint64_t Key;
+		float AdvanceX;
+		float X0, Y0, X1, Y1;
+		uint32_t PixelOffset;       // into the pixel block, Width * Height Alpha8 bytes
+		uint16_t Width;
+		uint16_t Height;
+		uint8_t Visible;
+		uint8_t Reserved[7];
+	};
+
+	static_assert(sizeof(CacheHeader) == 32, "CacheHeader is read in place");
+	static_assert(sizeof(GlyphRecord) == 48, "GlyphRecord is read in place");
+
+	// Everything that decides the pixels and metrics the loader produces
+	struct GlyphKeyData
+	{
+		uint64_t Font;
+		uint64_t RefFont;           // merged sources are placed on the first one's ascent
+		uint64_t Loader;
+		uint32_t LoaderFlags;
+		uint32_t Codepoint;
+		float Size;
+		float Density;
+		float RefSize;
+		float OffsetX;
+		float OffsetY;
+		uint8_t OversampleH;
+		uint8_t OversampleV;
+		uint8_t SnapH;
+		uint8_t SnapV;
+	};
+
+	const ImFontLoader* g_Base = nullptr;
+	ImFontLoader g_Loader;
+	uint64_t g_LoaderHash = 0;
+	std::unordered_map<const void*, uint64_t> g_FontHashes;     // by ImFontConfig::FontData, which doesn't move
+
+	fs::path g_Path;
+	std::vector<uint8_t> g_File;
+	const GlyphRecord* g_Stored = nullptr;
+	size_t g_StoredCount = 0;
+	const uint8_t* g_StoredPixels = nullptr;
+	std::vector<uint8_t> g_Used;
+
+	std::vector<GlyphRecord> g_Added;
+	std::vector<uint8_t> g_AddedPixels;
+	std::unordered_map<uint64_t, size_t> g_AddedIndex;
+
+	FontCacheStats g_Stats;
+
+	uint64_t GlyphKey(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, ImWchar codepoint)
+	{
+		GlyphKeyData k;
+		memset(&k, 0, sizeof(k));   // padding is hashed too
+
+		auto it = g_FontHashes.find(src->FontData);
+		k.Font = it != g_FontHashes.end() ? it->second : 0;
+		it = g_FontHashes.find(baked->OwnerFont->Sources[0]->FontData);
+		k.RefFont = it != g_FontHashes.end() ? it->second : 0;
+		k.Loader = g_LoaderHash;
+		k.LoaderFlags = src->FontLoaderFlags | atlas->FontLoaderFlags;
+		k.Codepoint = (uint32_t)codepoint;
+		k.Size = baked->Size;
+		k.Density = src->RasterizerDensity * baked->RasterizerDensity;
+		k.RefSize = baked->OwnerFont->Sources[0]->SizePixels;
+		k.OffsetX = src->GlyphOffset.x;
+		k.OffsetY = src->GlyphOffset.y;
+
+		int oh = 1, ov = 1;
+		ImFontAtlasBuildGetOversampleFactors(src, baked, &oh, &ov);
+		k.OversampleH = (uint8_t)oh;
+		k.OversampleV = (uint8_t)ov;
+		k.SnapH = src->PixelSnapH ? 1 : 0;
+		k.SnapV = src->PixelSnapV ? 1 : 0;
+
+		return HashService::Fast64(&k, sizeof(k));
+	}
+
+	const GlyphRecord* FindStored(uint64_t key)
+	{
+		const GlyphRecord* end = g_Stored + g_StoredCount;
+		const GlyphRecord* rec = std::lower_bound(g_Stored, end, key,
+			[](const GlyphRecord& r, uint64_t k) { return r.Key < k; });
+		return rec != end && rec->Key == key ? rec : nullptr;
+	}
+
+	// No side effects, so the prewarm workers can call it while the ImGui thread waits
+	bool Contains(uint64_t key)
+	{
+		return FindStored(key) || g_AddedIndex.count(key);
+	}
+
+	const GlyphRecord* Find(uint64_t key, const uint8_t** pixels)
+	{
+		if (const GlyphRecord* rec = FindStored(key))
+		{
+			++g_Stats.Hits;
+			g_Used[rec - g_Stored] = 1;
+			*pixels = g_StoredPixels + rec->PixelOffset;
+			return rec;
+		}
+
+		auto it = g_AddedIndex.find(key);
+		if (it == g_AddedIndex.end())
+			return nullptr;
+
+		const GlyphRecord& added = g_Added[it->second];
+		*pixels = g_AddedPixels.data() + added.PixelOffset;
+		return &added;
+	}
+
+	// Reads the glyph back out of the atlas right after the base loader wrote it
+	void Record(uint64_t key, ImFontAtlas* atlas, const ImFontGlyph& glyph)
+	{
+		GlyphRecord rec{};
+		rec.Key = key;
+		rec.AdvanceX = glyph.AdvanceX;
+		rec.PixelOffset = (uint32_t)g_AddedPixels.size();
+
+		if (glyph.Visible)
+		{
+			const ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+			ImTextureData* tex = atlas->TexData;
+			if (!r || !tex || (tex->Format != ImTextureFormat_Alpha8 && tex->Format != ImTextureFormat_RGBA32))
+				return;
+
+			rec.X0 = glyph.X0;
+			rec.Y0 = glyph.Y0;
+			rec.X1 = glyph.X1;
+			rec.Y1 = glyph.Y1;
+			rec.Width = r->w;
+			rec.Height = r->h;
+			rec.Visible = 1;
+
+			g_AddedPixels.resize(g_AddedPixels.size() + (size_t)r->w * r->h);
+			uint8_t* dst = g_AddedPixels.data() + rec.PixelOffset;
+			for (int y = 0; y < r->h; ++y, dst += r->w)
+			{
+				const uint8_t* row = (const uint8_t*)tex->GetPixelsAt(r->x, r->y + y);
+				if (tex->Format == ImTextureFormat_Alpha8)
+					memcpy(dst, row, r->w);
+				else
+					for (int x = 0; x < r->w; ++x)
+						dst[x] = row[x * 4 + 3];    // white, coverage in alpha
+			}
+		}
+
+		g_AddedIndex.emplace(key, g_Added.size());
+		g_Added.push_back(rec);
+	}
+
+	bool FontSrcInit(ImFontAtlas* atlas, ImFontConfig* src)
+	{
+		if (g_Base->FontSrcInit && !g_Base->FontSrcInit(atlas, src))
+			return false;
+
+		g_FontHashes[src->FontData] = HashService::Fast64(src->FontData, (size_t)src->FontDataSize);
+		return true;
+	}
+
+	void FontSrcDestroy(ImFontAtlas* atlas, ImFontConfig* src)
+	{
+		g_FontHashes.erase(src->FontData);
+		if (g_Base->FontSrcDestroy)
+			g_Base->FontSrcDestroy(atlas, src);
+	}
+
+	bool FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void* loaderData, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+	{
+		// the multiply is applied to the atlas pixels after loading, so they can't be read back raw
+		const bool cacheable = src->RasterizerMultiply == 1.0f;
+		const uint64_t key = cacheable ? GlyphKey(atlas, src, baked, codepoint) : 0;
+
+		const uint8_t* pixels = nullptr;
+		if (const GlyphRecord* rec = cacheable ? Find(key, &pixels) : nullptr)
+		{
+			if (out_advance_x)
+			{
+				*out_advance_x = rec->AdvanceX;
+				return true;
+			}
+
+			out_glyph->Codepoint = codepoint;
+			out_glyph->AdvanceX = rec->AdvanceX;
+			if (!rec->Visible)
+				return true;
+
+			ImFontAtlasRectId packId = ImFontAtlasPackAddRect(atlas, rec->Width, rec->Height);
+			if (packId == ImFontAtlasRectId_Invalid)
+				return false;
+			ImTextureRect* r = ImFontAtlasPackGetRect(atlas, packId);
+
+			out_glyph->X0 = rec->X0;
+			out_glyph->Y0 = rec->Y0;
+			out_glyph->X1 = rec->X1;
+			out_glyph->Y1 = rec->Y1;
+			out_glyph->Visible = true;
+			out_glyph->PackId = packId;
+			ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, pixels, ImTextureFormat_Alpha8, rec->Width);
+			return true;
+		}
+
+		if (!g_Base->FontBakedLoadGlyph(atlas, src, baked, loaderData, codepoint, out_glyph, out_advance_x))
+			return false;
+
+		// metrics-only loads are followed by a full one, which is the one worth keeping
+		if (!cacheable || out_advance_x || out_glyph->Colored)
+			return true;
+
+		++g_Stats.Misses;
+		Record(key, atlas, *out_glyph);
+		return true;
+	}
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+	struct PrewarmJob
+	{
+		ImWchar Codepoint = 0;
+		bool Ready = false;         // Rec and Pixels filled in
+		GlyphRecord Rec{};
+		std::vector<uint8_t> Pixels;
+	};
+
+	// One per worker thread: its own parse of every source of the font
+	struct PrewarmFonts
+	{
+		std::vector<stbtt_fontinfo> Info;
+		std::vector<float> Scale;
+		std::vector<bool> Valid;
+	};
+
+	void InitPrewarmFonts(ImFont* font, PrewarmFonts& out)
+	{
+		const int n = font->Sources.Size;
+		out.Info.resize(n);
+		out.Scale.assign(n, 0.0f);
+		out.Valid.assign(n, false);
+
+		const float ref_size = font->Sources[0]->SizePixels;
+		for (int i = 0; i < n; ++i)
+		{
+			const ImFontConfig* src = font->Sources[i];
+			const int offset = stbtt_GetFontOffsetForIndex((const unsigned char*)src->FontData, src->FontNo);
+			if (offset < 0 || !stbtt_InitFont(&out.Info[i], (const unsigned char*)src->FontData, offset))
+				continue;
+
+			// as ImGui_ImplStbTrueType_FontSrcInit
+			out.Scale[i] = stbtt_ScaleForPixelHeight(&out.Info[i], 1.0f);
+			if (src->MergeMode && src->SizePixels != 0.0f && ref_size != 0.0f)
+				out.Scale[i] *= src->SizePixels / ref_size;
+			out.Valid[i] = true;
+		}
+	}
+
+	bool Excluded(const ImFontConfig* src, ImWchar codepoint)
+	{
+		if (!src->GlyphExcludeRanges)
+			return false;
+		for (const ImWchar* r = src->GlyphExcludeRanges; r[0] && r[1]; r += 2)
+			if (codepoint >= r[0] && codepoint <= r[1])
+				return true;
+		return false;
+	}
+
+	// Same source choice and the same math as ImGui_ImplStbTrueType_FontBakedLoadGlyph,
+	// minus the packing: the record is what the cache would have stored for it
+	void Rasterize(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, PrewarmFonts& fonts, PrewarmJob& job)
+	{
+		for (int i = 0; i < font->Sources.Size; ++i)
+		{
+			ImFontConfig* src = font->Sources[i];
+			if (Excluded(src, job.Codepoint))
+				continue;
+
+			const int glyph_index = fonts.Valid[i] ? stbtt_FindGlyphIndex(&fonts.Info[i], (int)job.Codepoint) : 0;
+			if (glyph_index == 0)
+				continue;
+
+			// left to the serial load, which knows what to do with it
+			if (src->RasterizerMultiply != 1.0f)
+				return;
+
+			const uint64_t key = GlyphKey(atlas, src, baked, job.Codepoint);
+			if (Contains(key))
+				return;
+
+			int oversample_h, oversample_v;
+			ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+			const float scale_for_layout = fonts.Scale[i] * baked->Size;
+			const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+			const float scale_for_raster_x = fonts.Scale[i] * baked->Size * rasterizer_density * oversample_h;
+			const float scale_for_raster_y = fonts.Scale[i] * baked->Size * rasterizer_density * oversample_v;
+
+			int x0, y0, x1, y1;
+			int advance, lsb;
+			stbtt_GetGlyphBitmapBoxSubpixel(&fonts.Info[i], glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
+			stbtt_GetGlyphHMetrics(&fonts.Info[i], glyph_index, &advance, &lsb);
+
+			GlyphRecord& rec = job.Rec;
+			rec.Key = key;
+			rec.AdvanceX = advance * scale_for_layout;
+			job.Ready = true;
+
+			if (x0 == x1 || y0 == y1)
+				return;
+
+			const int w = x1 - x0 + oversample_h - 1;
+			const int h = y1 - y0 + oversample_v - 1;
+			stbtt_GetGlyphBitmapBox(&fonts.Info[i], glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
+			job.Pixels.assign((size_t)w * h, 0);
+
+			float sub_x, sub_y;
+			stbtt_MakeGlyphBitmapSubpixelPrefilter(&fonts.Info[i], job.Pixels.data(), w, h, w,
+				scale_for_raster_x, scale_for_raster_y, 0, 0, oversample_h, oversample_v, &sub_x, &sub_y, glyph_index);
+
+			const float ref_size = font->Sources[0]->SizePixels;
+			const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+			float font_off_x = (src->GlyphOffset.x * offsets_scale);
+			float font_off_y = (src->GlyphOffset.y * offsets_scale);
+			if (src->PixelSnapH)
+				font_off_x = IM_ROUND(font_off_x);
+			if (src->PixelSnapV)
+				font_off_y = IM_ROUND(font_off_y);
+			font_off_x += sub_x;
+			font_off_y += sub_y + IM_ROUND(baked->Ascent);
+			const float recip_h = 1.0f / (oversample_h * rasterizer_density);
+			const float recip_v = 1.0f / (oversample_v * rasterizer_density);
+
+			rec.X0 = x0 * recip_h + font_off_x;
+			rec.Y0 = y0 * recip_v + font_off_y;
+			rec.X1 = (x0 + w) * recip_h + font_off_x;
+			rec.Y1 = (y0 + h) * recip_v + font_off_y;
+			rec.Width = (uint16_t)w;
+			rec.Height = (uint16_t)h;
+			rec.Visible = 1;
+			return;
+		}
+	}
+#endif
+}
+
+void HvkFontCache::Install(ImFontAtlas* atlas)
+{
+	if (g_Base)
+		return;
+
+	g_Base = atlas->FontLoader;
+	if (!g_Base)
+	{
+#ifdef IMGUI_ENABLE_FREETYPE
+		g_Base = ImGuiFreeType::GetFontLoader();
+#else
+		g_Base = ImFontAtlasGetFontLoaderForStbTruetype();
+#endif
+	}
+
+	g_Loader = *g_Base;
+	g_Loader.Name = "hvk_font_cache";
+	g_Loader.FontSrcInit = FontSrcInit;
+	g_Loader.FontSrcDestroy = FontSrcDestroy;
+	g_Loader.FontBakedLoadGlyph = FontBakedLoadGlyph;
+	g_LoaderHash = HashService::Fast64(g_Base->Name, strlen(g_Base->Name));
+
+	atlas->SetFontLoader(&g_Loader);
+}
+
+int HvkFontCache::Prewarm(ImFont* font, float size, const ImWchar* ranges, int threads)
+{
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+	if (!font || !g_Base || g_Base != ImFontAtlasGetFontLoaderForStbTruetype())
+		return 0;
+
+	ImFontAtlas* atlas = font->OwnerAtlas;
+	if (atlas->Locked || (font->Flags & ImFontFlags_NoLoadGlyphs) || font->RemapPairs.Data.Size > 0)
+		return 0;
+	for (const ImFontConfig* src : font->Sources)
+		if (src->FontLoader)
+			return 0;
+
+	ImFontBaked* baked = font->GetFontBaked(size);
+	if (!baked)
+		return 0;
+
+	const auto t0 = std::chrono::steady_clock::now();
+
+	if (!ranges)
+		ranges = atlas->GetGlyphRangesDefault();
+
+	std::vector<PrewarmJob> jobs;
+	for (const ImWchar* r = ranges; r[0] && r[1]; r += 2)
+		for (unsigned c = r[0]; c <= r[1] && c <= IM_UNICODE_CODEPOINT_MAX; ++c)
+			if (c != font->EllipsisChar && !baked->IsGlyphLoaded((ImWchar)c))
+				jobs.emplace_back().Codepoint = (ImWchar)c;
+	if (jobs.empty())
+		return 0;
+
+	// Rasterize: every job only writes its own slot
+	if (threads <= 0)
+		threads = (int)std::max(1u, std::thread::hardware_concurrency());
+	threads = std::max(1, std::min(threads, (int)jobs.size() / 16));
+
+	std::atomic<size_t> next{ 0 };
+	auto work = [&]()
+		{
+			PrewarmFonts fonts;
+			InitPrewarmFonts(font, fonts);
+			for (size_t i = next++; i < jobs.size(); i = next++)
+				Rasterize(atlas, font, baked, fonts, jobs[i]);
+		};
+
+	std::vector<std::thread> pool;
+	for (int t = 1; t < threads; ++t)
+		pool.emplace_back(work);
+	work();
+	for (auto& t : pool)
+		t.join();
+
+	// Pack and blit in codepoint order, through the loader's cache hit path
+	int rasterized = 0;
+	for (PrewarmJob& job : jobs)
+	{
+		if (!job.Ready)
+			continue;
+
+		job.Rec.PixelOffset = (uint32_t)g_AddedPixels.size();
+		g_AddedPixels.insert(g_AddedPixels.end(), job.Pixels.begin(), job.Pixels.end());
+		g_AddedIndex.emplace(job.Rec.Key, g_Added.size());
+		g_Added.push_back(job.Rec);
+		++rasterized;
+	}
+
+	for (const PrewarmJob& job : jobs)
+		baked->FindGlyph(job.Codepoint);
+
+	g_Stats.Misses += rasterized;
+	g_Stats.Prewarmed += rasterized;
+	g_Stats.PrewarmMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+	return rasterized;
+#else
+	(void)font; (void)size; (void)ranges; (void)threads;
+	return 0;
+#endif
+}
+
+bool HvkFontCache::Load(const fs::path& path)
+{
+	const auto t0 = std::chrono::steady_clock::now();
+	g_Path = path;
+
+	std::ifstream in(path, std::ios::binary | std::ios::ate);
+	if (!in)
+		return false;
+
+	const std::streamoff size = in.tellg();
+	if (size < (std::streamoff)sizeof(CacheHeader))
+		return false;
+
+	g_File.resize((size_t)size);
+	in.seekg(0);
+	if (!in.read((char*)g_File.data(), size))
+	{
+		g_File.clear();
+		return false;
+	}
+
+	CacheHeader h;
+	memcpy(&h, g_File.data(), sizeof(h));
+	const uint64_t recordBytes = h.Count * sizeof(GlyphRecord);
+	if (memcmp(h.Magic, kMagic, sizeof(kMagic)) != 0 || h.Format != kFormat || h.ImGuiVersion != IMGUI_VERSION_NUM ||
+		h.Count > (uint64_t)size / sizeof(GlyphRecord) ||
+		sizeof(CacheHeader) + recordBytes + h.PixelBytes != (uint64_t)size)
+	{
+		g_File.clear();
+		return false;
+	}
+
+	g_Stored = (const GlyphRecord*)(g_File.data() + sizeof(CacheHeader));
+	g_StoredCount = (size_t)h.Count;
+	g_StoredPixels = g_File.data() + sizeof(CacheHeader) + recordBytes;
+	g_Used.assign(g_StoredCount, 0);
+
+	// a record pointing outside the pixels means the file is no good
+	for (size_t i = 0; i < g_StoredCount; ++i)
+	{
+		const GlyphRecord& r = g_Stored[i];
+		if ((uint64_t)r.PixelOffset + (uint64_t)r.Width * r.Height > h.PixelBytes || (i && g_Stored[i - 1].Key >= r.Key))
+		{
+			g_Stored = nullptr;
+			g_StoredCount = 0;
+			g_StoredPixels = nullptr;
+			g_Used.clear();
+			g_File.clear();
+			return false;
+		}
+	}
+
+	g_Stats.Stored = g_StoredCount;
+	g_Stats.LoadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+	return true;
+}
+
+bool HvkFontCache::Save()
+{
+	if (g_Path.empty() || g_Added.empty())
+		return true;
+
+	struct Item
+	{
+		const GlyphRecord* Rec;
+		const uint8_t* Pixels;
+	};
+
+	std::vector<Item> items;
+	items.reserve(g_Added.size() + g_StoredCount);
+	uint64_t pixelBytes = 0;
+
+	auto take = [&](const GlyphRecord& r, const uint8_t* pixels)
+		{
+			items.push_back({ &r, pixels + r.PixelOffset });
+			pixelBytes += (uint64_t)r.Width * r.Height;
+		};
+
+	for (const GlyphRecord& r : g_Added)
+		take(r, g_AddedPixels.data());
+	for (size_t i = 0; i < g_StoredCount; ++i)
+		if (g_Used[i])
+			take(g_Stored[i], g_StoredPixels);
+	for (size_t i = 0; i < g_StoredCount; ++i)
+		if (!g_Used[i] && pixelBytes + (uint64_t)g_Stored[i].Width * g_Stored[i].Height <= kMaxPixelBytes)
+			take(g_Stored[i], g_StoredPixels);
+
+	std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.Rec->Key < b.Rec->Key; });
+
+	CacheHeader h{};
+	memcpy(h.Magic, kMagic, sizeof(kMagic));
+	h.Format = kFormat;
+	h.ImGuiVersion = IMGUI_VERSION_NUM;
+	h.Count = items.size();
+	h.PixelBytes = pixelBytes;
+
+	std::vector<GlyphRecord> records;
+	records.reserve(items.size());
+	std::vector<uint8_t> pixels;
+	pixels.reserve((size_t)pixelBytes);
+	for (const Item& it : items)
+	{
+		GlyphRecord r = *it.Rec;
+		r.PixelOffset = (uint32_t)pixels.size();
+		pixels.insert(pixels.end(), it.Pixels, it.Pixels + (size_t)r.Width * r.Height);
+		records.push_back(r);
+	}
+
+	fs::path tmp = g_Path;
+	tmp += ".tmp";
+
+	{
+		std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+		if (!out)
+			return false;
+
+		out.write((const char*)&h, sizeof(h));
+		out.write((const char*)records.data(), (std::streamsize)(records.size() * sizeof(GlyphRecord)));
+		out.write((const char*)pixels.data(), (std::streamsize)pixels.size());
+		if (!out)
+		{
+			out.close();
+			std::error_code ec;
+			fs::remove(tmp, ec);
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	fs::rename(tmp, g_Path, ec);
+	if (ec)
+	{
+		fs::remove(tmp, ec);
+		return false;
+	}
+
+	return true;
+}
+
+FontCacheStats HvkFontCache::Stats()
+{
+	return g_Stats;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "imgui.h"
+#include <cstdint>
+#include <filesystem>
+
+// Rasterized glyphs kept on disk between runs.
+//
+// The atlas is dynamic, so glyphs are rasterized the first time a font is
+// drawn at a size. Install() puts a font loader in front of the atlas's own
+// (stb_truetype, or FreeType when enabled) that looks each glyph up by
+// (font file XXH64, size, rasterizer density, oversampling, glyph offset,
+// pixel snapping, codepoint, loader) and on a hit packs the stored coverage
+// and metrics straight into the atlas; only misses are rasterized, and
+// those are recorded for Save().
+//
+// File: header, records sorted by key, then Alpha8 pixels. Read in one go,
+// dropped when the ImGui version or format changes. Everything except Load
+// runs on the ImGui thread; Load may run on another one before the first
+// font is added.
+
+struct FontCacheStats
+{
+	uint64_t Stored = 0;        // glyphs in the file that was loaded
+	uint64_t Hits = 0;
+	uint64_t Misses = 0;        // rasterized this run
+	uint64_t Prewarmed = 0;     // of those, by Prewarm
+	double LoadMs = 0.0;
+	double PrewarmMs = 0.0;
+};
+
+class HvkFontCache
+{
+public:
+	static constexpr uint64_t kMaxPixelBytes = 8ull << 20;   // glyphs not used this run go first past this
+
+	// Once, before fonts are added (the loader can't be swapped under existing fonts without rebaking them)
+	static void Install(ImFontAtlas* atlas);
+
+	// Rasterizes the glyphs of ranges (default: Basic Latin + Latin-1) that font doesn't
+	// have yet at size, spread over threads (0: one per core), then packs them in
+	// codepoint order through the cache, so the atlas ends up exactly as if they
+	// had been loaded one by one. stb_truetype only; returns how many were rasterized.
+	static int Prewarm(ImFont* font, float size, const ImWchar* ranges = nullptr, int threads = 0);
+
+	static bool Load(const std::filesystem::path& path);
+
+	// Only writes when something was rasterized; temp file + rename
+	static bool Save();
+
+	static FontCacheStats Stats();
+};
@@ -0,0 +1,355 @@
+#define IMGUI_DEFINE_MATH_OPERATORS
+
+#include "hvk_glow_cache.h"
+#include "imgui_internal.h"
+#include "../example_win32_directx12/util/hash.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	constexpr size_t kPageBytes = (size_t)HvkGlowCache::kPageSize * HvkGlowCache::kPageSize * 4;
+	constexpr float kGain = 2.0f;       // blurred thin strokes would otherwise fade to nothing
+
+	struct SpriteKeyData
+	{
+		ImGuiID FontId;
+		float Size;
+		float GlowSize;
+
+		bool operator==(const SpriteKeyData& o) const { return FontId == o.FontId && Size == o.Size && GlowSize == o.GlowSize; }
+	};
+
+	struct GlowSprite
+	{
+		SpriteKeyData Key{};            // what the map's hash was made from, checked on a hit
+		std::string Text;
+		int Page = -1;
+		int X = 0, Y = 0;               // in the page, inside the 1 px clear border
+		int Width = 0, Height = 0;
+		int Pad = 0;                    // sprite origin is the text origin minus Pad
+	};
+
+	struct Shelf
+	{
+		int Y = 0;
+		int Height = 0;
+		int X = 0;                      // next free column
+	};
+
+	struct GlowPage
+	{
+		ImTextureData* Tex = nullptr;
+		std::vector<Shelf> Shelves;
+		int Bottom = 0;                 // first row below the last shelf
+		int LastFrame = -1;             // last frame a sprite on it was drawn
+	};
+
+	std::vector<GlowPage> g_Pages;
+	std::unordered_map<uint64_t, GlowSprite> g_Sprites;
+	GlowCacheStats g_Stats;
+	int g_Frame = -1;
+
+	// What ImFontAtlasUpdateNewFrame does for the atlas's own textures
+	void NewFrame(int frame)
+	{
+		if (frame == g_Frame)
+			return;
+		g_Frame = frame;
+		for (GlowPage& page : g_Pages)
+		{
+			if (page.Tex->Status != ImTextureStatus_OK)
+				continue;
+			page.Tex->Updates.resize(0);
+			page.Tex->UpdateRect.x = page.Tex->UpdateRect.y = (unsigned short)~0;
+			page.Tex->UpdateRect.w = page.Tex->UpdateRect.h = 0;
+		}
+	}
+
+	void QueueUpload(ImTextureData* tex, int x, int y, int w, int h)
+	{
+		const ImTextureRect req = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+		const int x1 = ImMax(tex->UpdateRect.w == 0 ? 0 : tex->UpdateRect.x + tex->UpdateRect.w, x + w);
+		const int y1 = ImMax(tex->UpdateRect.h == 0 ? 0 : tex->UpdateRect.y + tex->UpdateRect.h, y + h);
+		tex->UpdateRect.x = ImMin(tex->UpdateRect.x, req.x);
+		tex->UpdateRect.y = ImMin(tex->UpdateRect.y, req.y);
+		tex->UpdateRect.w = (unsigned short)(x1 - tex->UpdateRect.x);
+		tex->UpdateRect.h = (unsigned short)(y1 - tex->UpdateRect.y);
+
+		// A texture the backend hasn't created yet goes up whole
+		if (tex->Status == ImTextureStatus_OK || tex->Status == ImTextureStatus_WantUpdates)
+		{
+			tex->Status = ImTextureStatus_WantUpdates;
+			tex->Updates.push_back(req);
+		}
+	}
+
+	// Shelves are 8 px height classes, so sprites of similar height share them
+	bool PackInPage(GlowPage& page, int w, int h, int& x, int& y)
+	{
+		const int height = (h + 7) & ~7;
+		for (Shelf& shelf : page.Shelves)
+		{
+			if (shelf.Height == height && shelf.X + w <= HvkGlowCache::kPageSize)
+			{
+				x = shelf.X;
+				y = shelf.Y;
+				shelf.X += w;
+				return true;
+			}
+		}
+		if (page.Bottom + height > HvkGlowCache::kPageSize)
+			return false;
+
+		page.Shelves.push_back({ page.Bottom, height, w });
+		x = 0;
+		y = page.Bottom;
+		page.Bottom += height;
+		return true;
+	}
+
+	void EvictPage(int index)
+	{
+		for (auto it = g_Sprites.begin(); it != g_Sprites.end(); )
+		{
+			if (it->second.Page == index)
+			{
+				it = g_Sprites.erase(it);
+				++g_Stats.Evicted;
+			}
+			else
+				++it;
+		}
+		g_Pages[index].Shelves.clear();
+		g_Pages[index].Bottom = 0;
+	}
+
+	// A new page while under budget, else the least recently used one not drawn this frame
+	bool Allocate(int w, int h, int& page, int& x, int& y)
+	{
+		for (page = 0; page < (int)g_Pages.size(); ++page)
+			if (PackInPage(g_Pages[page], w, h, x, y))
+				return true;
+
+		if ((g_Pages.size() + 1) * kPageBytes <= HvkGlowCache::kBudgetBytes || g_Pages.empty())
+		{
+			GlowPage& added = g_Pages.emplace_back();
+			added.Tex = IM_NEW(ImTextureData)();
+			added.Tex->Create(ImTextureFormat_RGBA32, HvkGlowCache::kPageSize, HvkGlowCache::kPageSize);
+			ImGui::RegisterUserTexture(added.Tex);
+			page = (int)g_Pages.size() - 1;
+			return PackInPage(added, w, h, x, y);
+		}
+
+		page = -1;
+		for (int i = 0; i < (int)g_Pages.size(); ++i)
+			if (g_Pages[i].LastFrame < g_Frame && (page < 0 || g_Pages[i].LastFrame < g_Pages[page].LastFrame))
+				page = i;
+		if (page < 0)
+			return false;
+
+		EvictPage(page);
+		return PackInPage(g_Pages[page], w, h, x, y);
+	}
+
+	float SampleAlpha(const ImTextureData* tex, float u, float v)
+	{
+		const float fx = u * tex->Width - 0.5f;
+		const float fy = v * tex->Height - 0.5f;
+		const int x0 = (int)ImFloor(fx);
+		const int y0 = (int)ImFloor(fy);
+		auto at = [tex](int x, int y)
+		{
+			x = ImClamp(x, 0, tex->Width - 1);
+			y = ImClamp(y, 0, tex->Height - 1);
+			return tex->Pixels[(x + y * tex->Width) * tex->BytesPerPixel + tex->BytesPerPixel - 1] / 255.0f;
+		};
+		const float tx = fx - x0;
+		const float ty = fy - y0;
+		return ImLerp(ImLerp(at(x0, y0), at(x0 + 1, y0), tx), ImLerp(at(x0, y0 + 1), at(x0 + 1, y0 + 1), tx), ty);
+	}
+
+	// Separable gaussian, zero outside
+	void Blur(std::vector<float>& pixels, int w, int h, float sigma)
+	{
+		const int radius = (int)ImCeil(sigma * 2.0f);
+		std::vector<float> kernel(radius * 2 + 1);
+		float sum = 0.0f;
+		for (int i = -radius; i <= radius; ++i)
+			sum += kernel[i + radius] = expf(-(float)(i * i) / (2.0f * sigma * sigma));
+		for (float& k : kernel)
+			k /= sum;
+
+		std::vector<float> tmp(pixels.size());
+		for (int y = 0; y < h; ++y)
+			for (int x = 0; x < w; ++x)
+			{
+				float acc = 0.0f;
+				for (int i = ImMax(-radius, -x); i <= ImMin(radius, w - 1 - x); ++i)
+					acc += kernel[i + radius] * pixels[y * w + x + i];
+				tmp[y * w + x] = acc;
+			}
+		for (int y = 0; y < h; ++y)
+			for (int x = 0; x < w; ++x)
+			{
+				float acc = 0.0f;
+				for (int i = ImMax(-radius, -y); i <= ImMin(radius, h - 1 - y); ++i)
+					acc += kernel[i + radius] * tmp[(y + i) * w + x];
+				pixels[y * w + x] = acc;
+			}
+	}
+
+	// The string's coverage laid out as ImFont::RenderText does, from the atlas pixels, then blurred
+	bool RenderSprite(ImFont* font, float size, const char* text, const char* textEnd, float glowSize,
+		std::vector<float>& alpha, int& w, int& h, int& pad)
+	{
+		const ImVec2 textSize = font->CalcTextSizeA(size, FLT_MAX, 0.0f, text, textEnd);
+		pad = (int)ImCeil(glowSize);
+		w = (int)ImCeil(textSize.x) + pad * 2;
+		h = (int)ImCeil(textSize.y) + pad * 2;
+		if (w + 2 > HvkGlowCache::kPageSize || h + 2 > HvkGlowCache::kPageSize)
+			return false;
+
+		alpha.assign((size_t)w * h, 0.0f);
+		ImFontBaked* baked = font->GetFontBaked(size);
+		const float scale = size / baked->Size;
+		float x = (float)pad;
+		float y = (float)pad;
+		for (const char* s = text; s < textEnd; )
+		{
+			unsigned int c;
+			s += ImTextCharFromUtf8(&c, s, textEnd);
+			if (c == '\n')
+			{
+				x = (float)pad;
+				y += size;
+				continue;
+			}
+			if (c == '\r')
+				continue;
+
+			const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+			if (glyph->Visible && !glyph->Colored)
+			{
+				// Looked up after FindGlyph: a new glyph can grow the atlas into a new texture
+				const ImTextureData* src = font->OwnerAtlas->TexData;
+				const float x0 = x + glyph->X0 * scale, x1 = x + glyph->X1 * scale;
+				const float y0 = y + glyph->Y0 * scale, y1 = y + glyph->Y1 * scale;
+				for (int py = ImMax((int)ImFloor(y0), 0); py < ImMin((int)ImCeil(y1), h); ++py)
+					for (int px = ImMax((int)ImFloor(x0), 0); px < ImMin((int)ImCeil(x1), w); ++px)
+					{
+						const float u = ImLerp(glyph->U0, glyph->U1, ImSaturate((px + 0.5f - x0) / (x1 - x0)));
+						const float v = ImLerp(glyph->V0, glyph->V1, ImSaturate((py + 0.5f - y0) / (y1 - y0)));
+						float& dst = alpha[(size_t)py * w + px];
+						dst = ImMax(dst, SampleAlpha(src, u, v));
+					}
+			}
+			x += glyph->AdvanceX * scale;
+		}
+
+		Blur(alpha, w, h, ImMax(glowSize * 0.5f, 0.5f));
+		for (float& a : alpha)
+			a = ImSaturate(a * kGain);
+		return true;
+	}
+
+	// White, with the glow in alpha and a clear 1 px border so filtering doesn't reach the neighbours
+	void WriteSprite(const GlowSprite& sprite, const std::vector<float>& alpha)
+	{
+		ImTextureData* tex = g_Pages[sprite.Page].Tex;
+		for (int y = -1; y <= sprite.Height; ++y)
+		{
+			unsigned char* row = (unsigned char*)tex->GetPixelsAt(sprite.X - 1, sprite.Y + y);
+			for (int x = -1; x <= sprite.Width; ++x, row += 4)
+			{
+				const bool inside = x >= 0 && y >= 0 && x < sprite.Width && y < sprite.Height;
+				row[0] = row[1] = row[2] = 255;
+				row[3] = inside ? (unsigned char)(alpha[(size_t)y * sprite.Width + x] * 255.0f + 0.5f) : 0;
+			}
+		}
+		QueueUpload(tex, sprite.X - 1, sprite.Y - 1, sprite.Width + 2, sprite.Height + 2);
+	}
+}
+
+bool HvkGlowCache::AddGlow(ImDrawList* drawList, ImFont* font, float size, const ImVec2& pos, const char* text,
+	const char* textEnd, ImU32 glowColor, float glowSize, float glowIntensity)
+{
+	ImGuiContext* ctx = ImGui::GetCurrentContext();
+	if (!ctx || !(ctx->IO.BackendFlags & ImGuiBackendFlags_RendererHasTextures))
+		return false;
+	if (!drawList || !font || !text || size <= 0.0f)
+		return false;
+
+	if (!textEnd)
+		textEnd = text + strlen(text);
+	if (glowSize <= 0.0f || glowIntensity <= 0.0f || text == textEnd)
+		return true;    // nothing to draw
+
+	NewFrame(ctx->FrameCount);
+
+	const SpriteKeyData keyData = { font->FontId, size, glowSize };
+	const uint64_t key = HashService::Fast64(text, (size_t)(textEnd - text), HashService::Fast64(&keyData, sizeof(keyData)));
+
+	// A hash match for other text or parameters is a miss; the new sprite takes the entry
+	// and the old one's space goes with its page
+	auto it = g_Sprites.find(key);
+	const bool hit = it != g_Sprites.end() && it->second.Key == keyData &&
+		it->second.Text.size() == (size_t)(textEnd - text) && memcmp(it->second.Text.data(), text, it->second.Text.size()) == 0;
+	if (!hit)
+	{
+		std::vector<float> alpha;
+		GlowSprite sprite;
+		if (!RenderSprite(font, size, text, textEnd, glowSize, alpha, sprite.Width, sprite.Height, sprite.Pad))
+			return false;
+
+		int x, y;
+		if (!Allocate(sprite.Width + 2, sprite.Height + 2, sprite.Page, x, y))
+			return false;
+		sprite.X = x + 1;
+		sprite.Y = y + 1;
+		sprite.Key = keyData;
+		sprite.Text.assign(text, textEnd);
+		WriteSprite(sprite, alpha);
+		it = g_Sprites.insert_or_assign(key, std::move(sprite)).first;   // Allocate may have evicted, so looked up again
+		++g_Stats.Misses;
+	}
+	else
+		++g_Stats.Hits;
+
+	const GlowSprite& sprite = it->second;
+	GlowPage& page = g_Pages[sprite.Page];
+	page.LastFrame = g_Frame;
+
+	// RenderText snaps the text to whole pixels, the sprite follows it texel for texel
+	const ImVec2 p0(IM_TRUNC(pos.x) - sprite.Pad, IM_TRUNC(pos.y) - sprite.Pad);
+	const ImVec2 uv0((float)sprite.X / kPageSize, (float)sprite.Y / kPageSize);
+	const ImVec2 uv1((float)(sprite.X + sprite.Width) / kPageSize, (float)(sprite.Y + sprite.Height) / kPageSize);
+	const ImU32 tint = (glowColor & ~IM_COL32_A_MASK) | ((ImU32)(ImSaturate(glowIntensity) * 255.0f + 0.5f) << IM_COL32_A_SHIFT);
+	drawList->AddImage(page.Tex->GetTexRef(), p0, p0 + ImVec2((float)sprite.Width, (float)sprite.Height), uv0, uv1, tint);
+	return true;
+}
+
+void HvkGlowCache::Shutdown()
+{
+	for (GlowPage& page : g_Pages)
+	{
+		ImGui::UnregisterUserTexture(page.Tex);
+		IM_DELETE(page.Tex);
+	}
+	g_Pages.clear();
+	g_Sprites.clear();
+	g_Frame = -1;
+}
+
+GlowCacheStats HvkGlowCache::Stats()
+{
+	GlowCacheStats stats = g_Stats;
+	stats.Sprites = g_Sprites.size();
+	stats.Bytes = g_Pages.size() * kPageBytes;
+	return stats;
+}
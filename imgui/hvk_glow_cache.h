@@ -0,0 +1,44 @@
+#pragma once
+
+#include "imgui.h"
+#include <cstddef>
+#include <cstdint>
+
+// Glow sprites for GlowText.
+//
+// The glow of a label is rendered once on the CPU (the string's coverage,
+// taken from the font atlas, blurred) into a white sprite on a shared page
+// texture, and drawn as one quad tinted with the glow color. Sprites are
+// keyed by (text, font, size, glow size); color and intensity only tint
+// the quad, so changing them reuses the sprite.
+//
+// Pages are user textures the backend creates and updates like the font
+// atlas's. Up to kBudgetBytes of them; past that the least recently used
+// page not drawn this frame is cleared and refilled. ImGui thread only.
+
+struct GlowCacheStats
+{
+	uint64_t Sprites = 0;       // in the cache now
+	uint64_t Hits = 0;
+	uint64_t Misses = 0;        // rendered
+	uint64_t Evicted = 0;       // dropped with their page
+	size_t Bytes = 0;           // page textures
+};
+
+class HvkGlowCache
+{
+public:
+	static constexpr int kPageSize = 512;                   // RGBA32, 1 MB a page
+	static constexpr size_t kBudgetBytes = 8u << 20;
+
+	// Draws the glow of text placed at pos (top left, as ImDrawList::AddText). False when it
+	// can't (renderer without texture support, sprite larger than a page, every page in use
+	// this frame), so the caller can draw it another way.
+	static bool AddGlow(ImDrawList* drawList, ImFont* font, float size, const ImVec2& pos, const char* text,
+		const char* textEnd, ImU32 glowColor, float glowSize, float glowIntensity);
+
+	// After the renderer backend shut down (it destroys the page textures), before ImGui::DestroyContext
+	static void Shutdown();
+
+	static GlowCacheStats Stats();
+};
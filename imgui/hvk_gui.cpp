@@ -4,6 +4,8 @@
 #include "imgui_internal.h"
 #include "../example_win32_directx12/settings.h"
 #include "hvk_emissive.h"
+#include "hvk_sdf.h"
+#include "hvk_glow_cache.h"
 
 // Forward declarations from main.cpp
 extern AppState g_App;
@@ -43,46 +45,10 @@ namespace HvkGui
         // TEXT RENDERING - GLOW EFFECTS
         // ====================================================================
 
-	void GlowText(
-		ImFont* font,
-		float fontSize,
-		ImU32 color,
-		const char* text,
-		ImU32 glowColor,
-		float glowSize,
-		float glowIntensity
-	)
+	// Layered fan-out of offset copies, for when neither the glow cache nor distance fields can draw it
+	static void AddGlowLayers(ImDrawList* drawList, ImFont* font, float fontSize, const ImVec2& pos, const char* text,
+		ImU32 glowColor, float glowSize, float glowIntensity)
 	{
-		if (!text)
-			return;
-
-		ImGuiWindow* window = ImGui::GetCurrentWindow();
-		if (window->SkipItems)
-			return;
-
-		ImGuiContext& g = *GImGui;
-		
-		// Get current cursor position (like ImGui::Text does, accounting for CurrLineTextBaseOffset)
-		ImVec2 pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
-		
-		// Calculate text size
-		ImVec2 textSize;
-		if (font)
-			textSize = font->CalcTextSizeA(fontSize, FLT_MAX, 0.0f, text, NULL, NULL);
-		else
-			textSize = ImGui::CalcTextSize(text);
-		
-		// ItemSize to reserve space (like ImGui::Text does)
-		ImGui::ItemSize(textSize, 0.0f);
-		
-		// Get draw list
-		ImDrawList* drawList = window->DrawList;
-		if (!drawList)
-			return;
-
-		// Clamp glow intensity
-		glowIntensity = ImClamp(glowIntensity, 0.0f, 1.0f);
-
 		// Number of glow layers (more layers = smoother glow, but more expensive)
 		const int glowLayers = 12;
 		const float layerStep = glowSize / (float)glowLayers;
@@ -130,6 +96,65 @@ namespace HvkGui
 					drawList->AddText(offsetPos, layerColor, text);
 			}
 		}
+	}
+
+	void GlowText(
+		ImFont* font,
+		float fontSize,
+		ImU32 color,
+		const char* text,
+		ImU32 glowColor,
+		float glowSize,
+		float glowIntensity
+	)
+	{
+		if (!text)
+			return;
+
+		ImGuiWindow* window = ImGui::GetCurrentWindow();
+		if (window->SkipItems)
+			return;
+
+		ImGuiContext& g = *GImGui;
+		
+		// Get current cursor position (like ImGui::Text does, accounting for CurrLineTextBaseOffset)
+		ImVec2 pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+		
+		// Calculate text size
+		ImVec2 textSize;
+		if (font)
+			textSize = font->CalcTextSizeA(fontSize, FLT_MAX, 0.0f, text, NULL, NULL);
+		else
+			textSize = ImGui::CalcTextSize(text);
+		
+		// ItemSize to reserve space (like ImGui::Text does)
+		ImGui::ItemSize(textSize, 0.0f);
+		
+		// Get draw list
+		ImDrawList* drawList = window->DrawList;
+		if (!drawList)
+			return;
+
+		// Clamp glow intensity
+		glowIntensity = ImClamp(glowIntensity, 0.0f, 1.0f);
+
+		// Cached glow sprite under the ordinary text. Only when the cache turns the label down:
+		// distance fields draw both in one go, and failing that the layered fan-out
+		ImFont* drawFont = font ? font : ImGui::GetFont();
+		const float drawSize = font ? fontSize : ImGui::GetFontSize();
+		if (!HvkGlowCache::AddGlow(drawList, drawFont, drawSize, pos, text, nullptr, glowColor, glowSize, glowIntensity))
+		{
+			if (HvkSdfText::RendererSupport())
+			{
+				HvkSdfStyle style;
+				style.GlowColor = glowColor | IM_COL32_A_MASK;
+				style.GlowWidth = glowSize;
+				style.GlowStrength = glowIntensity;
+				if (HvkSdfText::AddText(drawList, drawFont, drawSize, pos, color, text, nullptr, style))
+					return;
+			}
+			AddGlowLayers(drawList, font, fontSize, pos, text, glowColor, glowSize, glowIntensity);
+		}
 
 		// Render the main text on top (without glow)
 		if (font)
@@ -0,0 +1,366 @@
+#define IMGUI_DEFINE_MATH_OPERATORS
+
+#include "hvk_sdf.h"
+#include "imgui_internal.h"
+#include "hvk_stb_truetype.h"
+
+#include <cfloat>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+
+namespace
+{
+	struct SdfGlyphEntry
+	{
+		ImFontAtlasRectId Rect = ImFontAtlasRectId_Invalid;
+		float AdvanceX = 0.0f;
+		float X0 = 0.0f, Y0 = 0.0f, X1 = 0.0f, Y1 = 0.0f;
+		bool Missing = false;       // not in the font
+		bool NoRoom = false;        // no room in the atlas; not generated again until Clear()
+	};
+
+	struct SdfFontEntry
+	{
+		const void* FontData = nullptr;     // the ImFont* key can be reused by a later font
+		stbtt_fontinfo Info;
+		float UnitScale = 0.0f;             // as the atlas's stb_truetype loader: ScaleForPixelHeight(1)
+		int UnscaledAscent = 0;
+		std::unordered_map<unsigned int, SdfGlyphEntry> Glyphs;
+	};
+
+	bool g_RendererSupport = false;
+	SdfStats g_Stats;
+	ImFontAtlas* g_Atlas = nullptr;
+	std::unordered_map<const ImFont*, SdfFontEntry> g_Fonts;
+
+	// Draw commands point at these until the frame is rendered; a deque keeps them in place as it grows
+	std::deque<HvkSdfBinding> g_Bindings;
+	int g_BindingFrame = -1;
+
+	bool InitFont(const void* fontData, int fontNo, stbtt_fontinfo& info)
+	{
+		const int offset = stbtt_GetFontOffsetForIndex((const unsigned char*)fontData, fontNo);
+		return offset >= 0 && stbtt_InitFont(&info, (const unsigned char*)fontData, offset);
+	}
+
+	struct Segment
+	{
+		ImVec2 A, B;
+	};
+
+	// Outline flattened to line segments in pixels at kBaseSize, y down. stbtt_GetGlyphSDF
+	// only knows quadratic curves and drops the cubic ones CFF (.otf) fonts are made of,
+	// so the field is computed here from stb's flattened outline instead.
+	void FlattenOutline(const stbtt_fontinfo& info, int glyph, float scale, std::vector<Segment>& out)
+	{
+		stbtt_vertex* vertices = nullptr;
+		const int count = stbtt_GetGlyphShape(&info, glyph, &vertices);
+		int* lengths = nullptr;
+		int contours = 0;
+		HvkStbPoint* points = HvkStbFlattenCurves(vertices, count, 0.25f / scale, &lengths, &contours, info.userdata);
+		stbtt_FreeShape(&info, vertices);
+		if (!points)
+			return;
+
+		int start = 0;
+		for (int c = 0; c < contours; ++c)
+		{
+			const int n = lengths[c];
+			for (int i = 0, j = n - 1; i < n; j = i++)
+			{
+				const HvkStbPoint& a = points[start + j];
+				const HvkStbPoint& b = points[start + i];
+				out.push_back({ ImVec2(a.x * scale, -a.y * scale), ImVec2(b.x * scale, -b.y * scale) });
+			}
+			start += n;
+		}
+		HvkStbFree(lengths, info.userdata);
+		HvkStbFree(points, info.userdata);
+	}
+
+	bool Generate(const stbtt_fontinfo& info, unsigned int codepoint, HvkSdfGlyph& out)
+	{
+		const int glyph = stbtt_FindGlyphIndex(&info, (int)codepoint);
+		if (glyph == 0)
+			return false;
+
+		const float scale = stbtt_ScaleForPixelHeight(&info, HvkSdfText::kBaseSize);
+		int advance, lsb;
+		stbtt_GetGlyphHMetrics(&info, glyph, &advance, &lsb);
+
+		out = HvkSdfGlyph();
+		out.AdvanceX = advance * scale;
+
+		int x0, y0, x1, y1;
+		stbtt_GetGlyphBitmapBox(&info, glyph, scale, scale, &x0, &y0, &x1, &y1);
+		std::vector<Segment> segments;
+		if (x0 < x1 && y0 < y1)
+			FlattenOutline(info, glyph, scale, segments);
+		if (segments.empty())
+			return true;    // nothing to draw (space)
+
+		const int spread = HvkSdfText::kSpread;
+		out.Width = x1 - x0 + spread * 2;
+		out.Height = y1 - y0 + spread * 2;
+		out.X0 = (float)(x0 - spread);
+		out.Y0 = (float)(y0 - spread);
+		out.X1 = out.X0 + out.Width;
+		out.Y1 = out.Y0 + out.Height;
+		out.Pixels.resize((size_t)out.Width * out.Height);
+
+		// Field value = kEdge + signed distance * (kEdge / kSpread), inside by the nonzero rule,
+		// so it reaches 0 kSpread pixels out
+		const float perPixel = (float)HvkSdfText::kEdge / spread;
+		for (int y = 0; y < out.Height; ++y)
+		{
+			const float py = out.Y0 + y + 0.5f;
+			for (int x = 0; x < out.Width; ++x)
+			{
+				const float px = out.X0 + x + 0.5f;
+				float best = FLT_MAX;
+				int winding = 0;
+				for (const Segment& s : segments)
+				{
+					const ImVec2 ab = s.B - s.A;
+					const ImVec2 ap = ImVec2(px, py) - s.A;
+					const float len2 = ImLengthSqr(ab);
+					const float t = len2 > 0.0f ? ImSaturate(ImDot(ap, ab) / len2) : 0.0f;
+					best = ImMin(best, ImLengthSqr(ap - ab * t));
+
+					if ((s.A.y <= py) != (s.B.y <= py))
+					{
+						const float cx = s.A.x + (py - s.A.y) / ab.y * ab.x;
+						if (cx > px)
+							winding += s.B.y > s.A.y ? 1 : -1;
+					}
+				}
+				const float dist = winding != 0 ? ImSqrt(best) : -ImSqrt(best);
+				out.Pixels[(size_t)y * out.Width + x] = (uint8_t)ImClamp(HvkSdfText::kEdge + dist * perPixel + 0.5f, 0.0f, 255.0f);
+			}
+		}
+		return true;
+	}
+
+	SdfFontEntry* FontEntry(ImFont* font)
+	{
+		if (font->Sources.Size == 0)
+			return nullptr;
+
+		const ImFontConfig* src = font->Sources[0];
+		SdfFontEntry& entry = g_Fonts[font];
+		if (entry.FontData == src->FontData)
+			return &entry;
+
+		for (auto& [codepoint, glyph] : entry.Glyphs)
+			if (glyph.Rect != ImFontAtlasRectId_Invalid)
+				g_Atlas->RemoveCustomRect(glyph.Rect);
+		entry.Glyphs.clear();
+		entry.FontData = nullptr;
+
+		if (!InitFont(src->FontData, src->FontNo, entry.Info))
+		{
+			g_Fonts.erase(font);
+			return nullptr;
+		}
+
+		int descent, lineGap;
+		stbtt_GetFontVMetrics(&entry.Info, &entry.UnscaledAscent, &descent, &lineGap);
+		entry.UnitScale = stbtt_ScaleForPixelHeight(&entry.Info, 1.0f);
+		entry.FontData = src->FontData;
+		return &entry;
+	}
+
+	// Generates the glyph into the atlas the first time, and again if its rect went away.
+	// Sets noRoom when the atlas can't take it.
+	const SdfGlyphEntry* GlyphEntry(SdfFontEntry& font, unsigned int codepoint, bool& noRoom)
+	{
+		SdfGlyphEntry& glyph = font.Glyphs[codepoint];
+		if (glyph.NoRoom)
+			noRoom = true;
+		if (glyph.Missing || glyph.NoRoom)
+			return nullptr;
+		if (glyph.Rect != ImFontAtlasRectId_Invalid && g_Atlas->GetCustomRect(glyph.Rect, nullptr))
+			return &glyph;
+
+		HvkSdfGlyph sdf;
+		if (!Generate(font.Info, codepoint, sdf))
+		{
+			glyph.Missing = true;
+			return nullptr;
+		}
+		++g_Stats.Generated;
+
+		glyph.AdvanceX = sdf.AdvanceX;
+		glyph.X0 = sdf.X0;
+		glyph.Y0 = sdf.Y0;
+		glyph.X1 = sdf.X1;
+		glyph.Y1 = sdf.Y1;
+		glyph.Rect = ImFontAtlasRectId_Invalid;
+		if (sdf.Pixels.empty())
+			return &glyph;
+
+		glyph.Rect = g_Atlas->AddCustomRect(sdf.Width, sdf.Height);
+		if (glyph.Rect == ImFontAtlasRectId_Invalid)
+		{
+			// the field took a while to compute; don't do it again every frame for the same answer
+			glyph.NoRoom = true;
+			noRoom = true;
+			++g_Stats.NoRoom;
+			return nullptr;
+		}
+
+		ImTextureData* tex = g_Atlas->TexData;
+		ImTextureRect* r = ImFontAtlasPackGetRect(g_Atlas, glyph.Rect);
+		ImFontAtlasTextureBlockConvert(sdf.Pixels.data(), ImTextureFormat_Alpha8, sdf.Width,
+			(unsigned char*)tex->GetPixelsAt(r->x, r->y), tex->Format, tex->GetPitch(), r->w, r->h);
+		ImFontAtlasTextureBlockQueueUpload(g_Atlas, tex, r->x, r->y, r->w, r->h);
+		return &glyph;
+	}
+
+	HvkSdfBinding* AllocateBinding()
+	{
+		ImGuiContext* ctx = ImGui::GetCurrentContext();
+		const int frame = ctx ? ctx->FrameCount : 0;
+		if (frame != g_BindingFrame)
+		{
+			g_Bindings.clear();
+			g_BindingFrame = frame;
+		}
+		return &g_Bindings.emplace_back();
+	}
+}
+
+void HvkSdfText::SetRendererSupport(bool enabled)
+{
+	g_RendererSupport = enabled;
+}
+
+bool HvkSdfText::RendererSupport()
+{
+	return g_RendererSupport;
+}
+
+bool HvkSdfText::GenerateGlyph(const void* fontData, int fontNo, unsigned int codepoint, HvkSdfGlyph& out)
+{
+	stbtt_fontinfo info;
+	return InitFont(fontData, fontNo, info) && Generate(info, codepoint, out);
+}
+
+bool HvkSdfText::AddText(ImDrawList* drawList, ImFont* font, float size, const ImVec2& pos, ImU32 color,
+	const char* text, const char* textEnd, const HvkSdfStyle& style)
+{
+	if (!g_RendererSupport || !drawList || !font || !text || size <= 0.0f)
+		return false;
+
+	ImFontAtlas* atlas = font->OwnerAtlas;
+	if (atlas != g_Atlas)
+	{
+		g_Fonts.clear();    // the old atlas and its rects are gone with it
+		g_Atlas = atlas;
+	}
+
+	SdfFontEntry* entry = FontEntry(font);
+	if (!entry)
+		return false;
+
+	if (!textEnd)
+		textEnd = text + strlen(text);
+
+	// Generate first: a new rect can grow the atlas into a texture the renderer hasn't created yet
+	int quads = 0;
+	bool noRoom = false;
+	for (const char* s = text; s < textEnd; )
+	{
+		unsigned int c;
+		s += ImTextCharFromUtf8(&c, s, textEnd);
+		if (c == '\n' || c == '\r')
+			continue;
+		const SdfGlyphEntry* glyph = GlyphEntry(*entry, c, noRoom);
+		if (!glyph)
+			glyph = GlyphEntry(*entry, '?', noRoom);
+		if (glyph && glyph->Rect != ImFontAtlasRectId_Invalid)
+			++quads;
+	}
+	if (noRoom)
+		return false;   // drawn the ordinary way rather than with holes in it
+
+	const ImTextureID texId = atlas->TexData ? atlas->TexData->TexID : ImTextureID_Invalid;
+	if (texId == ImTextureID_Invalid)
+		return false;
+
+	// The field runs out kSpread base pixels from the outline
+	const float scale = size / kBaseSize;
+	const float reach = kSpread * scale;
+
+	HvkSdfBinding* binding = AllocateBinding();
+	binding->BaseTexture = texId;
+	binding->Edge = kEdge / 255.0f;
+	binding->DistScale = 255.0f / ((float)kEdge / kSpread) * scale;
+	binding->OutlineWidth = ImClamp(style.OutlineWidth, 0.0f, reach);
+	binding->GlowWidth = ImClamp(style.GlowWidth, 0.0f, reach);
+	binding->GlowStrength = ImSaturate(style.GlowStrength);
+	binding->OutlineColor = ImGui::ColorConvertU32ToFloat4(style.OutlineColor);
+	binding->GlowColor = ImGui::ColorConvertU32ToFloat4(style.GlowColor);
+
+	drawList->PushTexture(ImTextureRef((ImTextureID)binding));
+	drawList->PrimReserve(quads * 6, quads * 4);
+
+	// Same baseline as the atlas's own glyphs at this size
+	const float ascent = ImCeil(entry->UnscaledAscent * entry->UnitScale * size);
+	ImVec2 pen(pos.x, pos.y + ascent);
+	int drawn = 0;
+	for (const char* s = text; s < textEnd; )
+	{
+		unsigned int c;
+		s += ImTextCharFromUtf8(&c, s, textEnd);
+		if (c == '\n')
+		{
+			pen = ImVec2(pos.x, pen.y + size);
+			continue;
+		}
+		if (c == '\r')
+			continue;
+
+		auto it = entry->Glyphs.find(c);
+		const SdfGlyphEntry* glyph = it != entry->Glyphs.end() && !it->second.Missing ? &it->second : nullptr;
+		if (!glyph)
+		{
+			it = entry->Glyphs.find('?');
+			glyph = it != entry->Glyphs.end() && !it->second.Missing ? &it->second : nullptr;
+		}
+		if (!glyph)
+			continue;
+
+		ImFontAtlasRect r;
+		if (glyph->Rect != ImFontAtlasRectId_Invalid && atlas->GetCustomRect(glyph->Rect, &r))
+		{
+			drawList->PrimRectUV(
+				ImVec2(pen.x + glyph->X0 * scale, pen.y + glyph->Y0 * scale),
+				ImVec2(pen.x + glyph->X1 * scale, pen.y + glyph->Y1 * scale),
+				r.uv0, r.uv1, color);
+			++drawn;
+		}
+		pen.x += glyph->AdvanceX * scale;
+	}
+
+	if (drawn < quads)
+		drawList->PrimUnreserve((quads - drawn) * 6, (quads - drawn) * 4);
+	drawList->PopTexture();
+	return true;
+}
+
+SdfStats HvkSdfText::Stats()
+{
+	return g_Stats;
+}
+
+void HvkSdfText::Clear()
+{
+	if (g_Atlas)
+		for (auto& [font, entry] : g_Fonts)
+			for (auto& [codepoint, glyph] : entry.Glyphs)
+				if (glyph.Rect != ImFontAtlasRectId_Invalid)
+					g_Atlas->RemoveCustomRect(glyph.Rect);
+	g_Fonts.clear();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "imgui.h"
+#include <cstdint>
+#include <vector>
+
+// Distance field text.
+//
+// Glyphs are generated once as signed distance fields (from the outline
+// stb_truetype flattens) at kBaseSize with kSpread pixels of field around them, and
+// stored as custom rects in the regular font atlas. Drawn at any size they
+// stay sharp, and the renderer backends turn the distance into fill,
+// outline and glow in one pass: the draw command carries an HvkSdfBinding
+// in place of the texture id, the same way HvkEmissiveBinding does.
+// Generation is plain C++ so it can be checked on the Linux side.
+//
+// GlowText uses it only for labels the glow sprite cache (hvk_glow_cache.h)
+// turns down, ahead of the layered fan-out; it is not the primary glow path.
+
+struct HvkSdfBinding
+{
+	static constexpr unsigned int kMagic = 0x48564B53; // "HVKS"
+
+	unsigned int Magic = kMagic;
+	ImTextureID   BaseTexture = (ImTextureID)nullptr;  // the font atlas
+	float         Edge = 0.5f;           // field value on the outline
+	float         DistScale = 1.0f;      // field units to screen pixels
+	float         OutlineWidth = 0.0f;   // screen pixels
+	float         GlowWidth = 0.0f;      // screen pixels
+	float         GlowStrength = 0.0f;
+	ImVec4        OutlineColor;
+	ImVec4        GlowColor;
+};
+
+inline bool ImTextureIdHasSdf(const ImTextureID id)
+{
+	const HvkSdfBinding* binding = reinterpret_cast<const HvkSdfBinding*>(id);
+	return binding != nullptr && binding->Magic == HvkSdfBinding::kMagic;
+}
+
+struct HvkSdfStyle
+{
+	ImU32 OutlineColor = 0;
+	float OutlineWidth = 0.0f;      // screen pixels
+	ImU32 GlowColor = 0;
+	float GlowWidth = 0.0f;         // screen pixels, capped by kSpread at the drawn size
+	float GlowStrength = 1.0f;      // 0..1
+};
+
+struct SdfStats
+{
+	uint64_t Generated = 0;     // fields computed
+	uint64_t NoRoom = 0;        // of those, dropped because the atlas couldn't take them
+};
+
+struct HvkSdfGlyph
+{
+	float AdvanceX = 0.0f;          // at kBaseSize
+	float X0 = 0.0f, Y0 = 0.0f;     // field bitmap corners from the pen position (baseline), at kBaseSize
+	float X1 = 0.0f, Y1 = 0.0f;
+	int Width = 0;
+	int Height = 0;
+	std::vector<uint8_t> Pixels;    // Width * Height field values, kEdge on the outline
+};
+
+class HvkSdfText
+{
+public:
+	static constexpr float kBaseSize = 24.0f;
+	static constexpr int kSpread = 16;          // pixels at kBaseSize
+	static constexpr uint8_t kEdge = 128;
+
+	// Set once the renderer backend has the distance field path (both DX backends do)
+	static void SetRendererSupport(bool enabled);
+	static bool RendererSupport();
+
+	// Field and metrics for one codepoint of a TTF/OTF; false if the font has no such glyph
+	static bool GenerateGlyph(const void* fontData, int fontNo, unsigned int codepoint, HvkSdfGlyph& out);
+
+	// Draws text with its top left at pos, as ImDrawList::AddText would for the same font and size.
+	// False when it can't (no renderer support, atlas texture not created yet, unreadable font,
+	// a glyph the atlas had no room for), so the caller can draw it the ordinary way.
+	static bool AddText(ImDrawList* drawList, ImFont* font, float size, const ImVec2& pos, ImU32 color,
+		const char* text, const char* textEnd = nullptr, const HvkSdfStyle& style = HvkSdfStyle());
+
+	// Drops every generated glyph (their rects go back to the atlas), and with them the ones that didn't fit
+	static void Clear();
+
+	static SdfStats Stats();
+};
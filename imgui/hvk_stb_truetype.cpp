@@ -0,0 +1,35 @@
+#include "hvk_stb_truetype.h"
+#include "imgui.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// Set up like imgui_draw.cpp's copy, minus the context allocator, with the
+// float functions its Im* math macros stand for. No imgui_internal.h: its
+// stbrp_node forward declaration clashes with the packer stb_truetype falls
+// back to without stb_rect_pack, and the atlas does its own packing anyway.
+#define STBTT_malloc(x,u)   ((void)(u), malloc(x))
+#define STBTT_free(x,u)     ((void)(u), free(x))
+#define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
+#define STBTT_fmod(x,y)     fmodf(x,y)
+#define STBTT_sqrt(x)       sqrtf(x)
+#define STBTT_pow(x,y)      powf(x,y)
+#define STBTT_fabs(x)       fabsf(x)
+#define STBTT_ifloor(x)     ((int)floorf(x))
+#define STBTT_iceil(x)      ((int)ceilf(x))
+#define STBTT_strlen(x)     strlen(x)
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "imstb_truetype.h"
+
+static_assert(sizeof(HvkStbPoint) == sizeof(stbtt__point), "HvkStbPoint must match stbtt__point");
+
+HvkStbPoint* HvkStbFlattenCurves(stbtt_vertex* vertices, int count, float flatness, int** lengths, int* contours, void* userdata)
+{
+	return (HvkStbPoint*)stbtt_FlattenCurves(vertices, count, flatness, lengths, contours, userdata);
+}
+
+void HvkStbFree(void* p, void* userdata)
+{
+	STBTT_free(p, userdata);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+// The one stb_truetype our own code links against: the font cache's prewarm
+// workers and the SDF generator. imgui_draw.cpp keeps its STBTT_STATIC copy
+// for the atlas; hvk_stb_truetype.cpp builds this one with the same settings,
+// so both rasterize the same pixels. Allocations go through plain malloc
+// because the prewarm workers call in off the ImGui thread.
+
+#include "imstb_truetype.h"
+
+// stbtt_FlattenCurves, which stb keeps static: the outline of `vertices` as
+// closed polylines, `contours` of them with lengths[i] points each. Free the
+// points and the lengths with HvkStbFree.
+struct HvkStbPoint
+{
+	float x, y;
+};
+
+HvkStbPoint* HvkStbFlattenCurves(stbtt_vertex* vertices, int count, float flatness, int** lengths, int* contours, void* userdata);
+void HvkStbFree(void* p, void* userdata);
@@ -0,0 +1,195 @@
+#include "hvk_style.h"
+#include "hvk_font_cache.h"
+#include "hvk_sdf.h"
+#include "../example_win32_directx12/util/asset_vfs.h"
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace ImGui {
+
+	// Font bytes come from the asset VFS (pack, loose file or the embedded set);
+	// the atlas rasterizes glyphs on demand so it borrows them
+	// (FontDataOwnedByAtlas=false) and each slot keeps its bytes alive.
+	//
+	// Fonts are added once at kBaseFontSize. The atlas is dynamic (1.92,
+	// RendererHasTextures on both backends), so every size actually drawn,
+	// including UI scale changes through style.FontScaleMain, is baked on
+	// demand and uploaded as a texture update: no Clear(), no device objects.
+	static constexpr float kBaseFontSize = 13.0f;   // ImGui's default size, keeps spacing consistent
+
+	struct FontSlot
+	{
+		const char* Path;
+		AssetData Data;
+		ImFont* Font = nullptr;
+	};
+
+	static FontSlot g_FontSlots[] =
+	{
+		{ "fonts/satoshi/Satoshi-Regular.otf", {}, nullptr },
+		{ "fonts/satoshi/Satoshi-Medium.otf", {}, nullptr },
+		{ "fonts/satoshi/Satoshi-Bold.otf", {}, nullptr },
+		{ "fonts/proggy_clean/ProggyClean.ttf", {}, nullptr },
+	};
+	enum { SlotRegular, SlotMedium, SlotBold, SlotProggy };
+
+	static ImFont* g_DefaultFont = nullptr;   // ImGui's built-in, only while a slot needs it
+
+	static bool SameBytes(const AssetData& a, const AssetData& b)
+	{
+		return a.Size == b.Size && (a.Data == b.Data || memcmp(a.Data, b.Data, a.Size) == 0);
+	}
+
+	// Swaps the slot's font only if its file changed
+	static void UpdateFontSlot(ImFontAtlas* atlas, FontSlot& slot)
+	{
+		AssetData data;
+		if (!AssetVfs::Read(slot.Path, data) || data.Size <= 100 || data.Size > INT_MAX)
+			data = {};
+
+		if (slot.Font && data && SameBytes(slot.Data, data))
+			return;
+
+		if (slot.Font)
+		{
+			HvkSdfText::Clear();    // its fields were generated from the data that goes away here
+			atlas->RemoveFont(slot.Font);
+			slot.Font = nullptr;
+			slot.Data = {};
+		}
+
+		if (!data)
+		{
+			printf("[FONT] Failed to load %s\n", slot.Path);
+			return;
+		}
+
+		ImFontConfig config;
+		config.Flags |= ImFontFlags_NoLoadError;
+		config.FontDataOwnedByAtlas = false;
+
+		slot.Font = atlas->AddFontFromMemoryTTF((void*)data.Data, (int)data.Size, kBaseFontSize, &config);
+		if (!slot.Font)
+		{
+			printf("[FONT] Failed to load %s\n", slot.Path);
+			return;
+		}
+
+		printf("[FONT] Loaded %s\n", slot.Path);
+		slot.Data = std::move(data);
+	}
+
+	void LoadFonts(UserStyle& user)
+	{
+		ImGuiIO& io = ImGui::GetIO();
+
+		for (FontSlot& slot : g_FontSlots)
+			UpdateFontSlot(io.Fonts, slot);
+
+		const bool needDefault = !g_FontSlots[SlotRegular].Font || !g_FontSlots[SlotProggy].Font;
+		if (needDefault && !g_DefaultFont)
+		{
+			ImFontConfig defaultConfig;
+			defaultConfig.SizePixels = kBaseFontSize;
+			g_DefaultFont = io.Fonts->AddFontDefault(&defaultConfig);
+		}
+		else if (!needDefault && g_DefaultFont)
+		{
+			HvkSdfText::Clear();
+			io.Fonts->RemoveFont(g_DefaultFont);
+			g_DefaultFont = nullptr;
+		}
+
+		// Fallbacks: Regular -> ImGui default, Medium -> Regular, Bold -> Medium, Proggy -> ImGui default
+		user.satoshi_regular = g_FontSlots[SlotRegular].Font ? g_FontSlots[SlotRegular].Font : g_DefaultFont;
+		user.satoshi_medium = g_FontSlots[SlotMedium].Font ? g_FontSlots[SlotMedium].Font : user.satoshi_regular;
+		user.satoshi_bold = g_FontSlots[SlotBold].Font ? g_FontSlots[SlotBold].Font : user.satoshi_medium;
+		user.proggy_clean = g_FontSlots[SlotProggy].Font ? g_FontSlots[SlotProggy].Font : g_DefaultFont;
+
+		// Set satoshi regular as the default font for the menu
+		io.FontDefault = user.satoshi_regular;
+	}
+
+	// The fields UpdateStyle owns, all written in one pass
+	static void ApplyModernStyle(const UserStyle& user, ImGuiStyle& style)
+	{
+		style.Colors[ImGuiCol_WindowBg].x = (float)user.main_bg_color.x;
+		style.Colors[ImGuiCol_WindowBg].y = (float)user.main_bg_color.y;
+		style.Colors[ImGuiCol_WindowBg].z = (float)user.main_bg_color.z;
+		style.Colors[ImGuiCol_WindowBg].w = user.main_opacity;
+
+		style.Colors[ImGuiCol_Text].x = (float)user.main_text_color.x;
+		style.Colors[ImGuiCol_Text].y = (float)user.main_text_color.y;
+		style.Colors[ImGuiCol_Text].z = (float)user.main_text_color.z;
+		style.Colors[ImGuiCol_Text].w = (float)user.main_text_color.w;
+
+		// Apply modern widget styling defaults
+		style.FrameRounding = 6.0f;
+		style.GrabRounding = 8.0f;
+		style.ScrollbarRounding = 9.0f;
+		style.TabRounding = 6.0f;
+		style.WindowRounding = 8.0f;
+		style.ChildRounding = 6.0f;
+		style.PopupRounding = 8.0f;
+
+		// Better spacing and padding
+		style.FramePadding = ImVec2(10.0f, 6.0f);
+		style.ItemSpacing = ImVec2(8.0f, 6.0f);
+		style.ItemInnerSpacing = ImVec2(6.0f, 4.0f);
+		style.WindowPadding = ImVec2(12.0f, 12.0f);
+		style.CellPadding = ImVec2(6.0f, 4.0f);
+
+		// Enhanced button colors from user settings
+		style.Colors[ImGuiCol_Button] = user.button_color;
+		style.Colors[ImGuiCol_ButtonHovered] = user.button_hover_color;
+		style.Colors[ImGuiCol_ButtonActive] = user.button_active_color;
+
+		// Enhanced frame colors
+		style.Colors[ImGuiCol_FrameBg] = ImVec4(0.15f, 0.15f, 0.15f, 0.75f);
+		style.Colors[ImGuiCol_FrameBgHovered] = ImVec4(0.2f, 0.2f, 0.2f, 0.85f);
+		style.Colors[ImGuiCol_FrameBgActive] = ImVec4(0.25f, 0.25f, 0.25f, 0.9f);
+
+		// Enhanced slider colors
+		style.Colors[ImGuiCol_SliderGrab] = ImVec4(0.4f, 0.4f, 0.4f, 1.0f);
+		style.Colors[ImGuiCol_SliderGrabActive] = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);
+	}
+
+	void UpdateStyle(UserStyle& user, ImGuiStyle& style)
+	{
+		// Nothing changed since the last call: this is the whole per-frame cost
+		static uint32_t applied_generation = 0;
+		if (user.generation == applied_generation)
+			return;
+		applied_generation = user.generation;
+
+		static float last_applied = 1.0f;
+		float desired = user.dpi_scale * user.ui_scale;
+
+		if (fabsf(desired - last_applied) > 0.001f)
+		{
+			style.ScaleAllSizes(desired / last_applied);
+			last_applied = desired;
+		}
+
+		// Text follows through the dynamic atlas; ui_scale 0.0 (default) means 1.0
+		style.FontScaleMain = user.ui_scale > 0.0f ? user.ui_scale : 1.0f;
+
+		// A new size would otherwise rasterize glyph by glyph on this thread as the
+		// next frame draws them; Latin is done up front across cores instead
+		static float prewarmed_size = 0.0f;
+		const float size = kBaseFontSize * style.FontScaleMain * style.FontScaleDpi;
+		if (size != prewarmed_size)
+		{
+			prewarmed_size = size;
+			for (const FontSlot& slot : g_FontSlots)
+				HvkFontCache::Prewarm(slot.Font, size);
+		}
+
+		// After the scaling: these stay at their fixed sizes, as they did when
+		// they were rewritten every frame
+		ApplyModernStyle(user, style);
+	}
+
+}
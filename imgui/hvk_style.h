@@ -0,0 +1,17 @@
+#pragma once
+#include "imgui.h"
+#include "../example_win32_directx12/user_style.h"
+
+// The user style and fonts applied to ImGui. No platform headers, so the
+// Linux benchmarks drive the same code.
+
+namespace ImGui {
+
+	// Per frame; only does anything when user.generation moved since the last call
+	void UpdateStyle(UserStyle& user, ImGuiStyle& style);
+
+	// Satoshi Regular/Medium/Bold and Proggy, paths relative to the asset root. Again after
+	// the assets changed only replaces fonts whose file changed (their old ImFont* go): call between frames.
+	void LoadFonts(UserStyle& user);
+
+}
@@ -16,10 +16,13 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-nocompress] [-nostatic] [-base85] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-nocompress] [-nostatic|-extern] [-align <n>] [-base85] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -nocompress -extern -align 64 assets.hvkpack g_EmbeddedAssets > embedded_assets.cpp
+// -extern gives the symbols external linkage so another file can declare and use them (const implies
+// internal linkage in C++, so -nostatic alone isn't enough). -align is for data that is read in place.
 // Note:
 //   Base85 encoding will be obsoleted by future version of Dear ImGui!
 
@@ -41,13 +44,13 @@ enum SourceEncoding
     SourceEncoding_Base85,
 };
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static);
+static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static, bool use_extern, int align);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic|-extern] [-align <n>] <inputfile> <symbolname>\n", argv[0]);
         printf("Source encoding types:\n");
         printf(" -u8     = ~12 bytes of source per 4 bytes of data. 4 bytes in binary.\n");
         printf(" -u32    = ~11 bytes of source per 4 bytes of data. 4 bytes in binary. Need endianness swapping on big-endian.\n");
@@ -58,6 +61,8 @@ int main(int argc, char** argv)
     int argn = 1;
     bool use_compression = true;
     bool use_static = true;
+    bool use_extern = false;
+    int align = 0;
     SourceEncoding source_encoding = SourceEncoding_U8; // New default
     while (argn < (argc - 2) && argv[argn][0] == '-')
     {
@@ -66,6 +71,8 @@ int main(int argc, char** argv)
         else if (strcmp(argv[argn], "-base85") == 0) { source_encoding = SourceEncoding_Base85; argn++; }
         else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
+        else if (strcmp(argv[argn], "-extern") == 0) { use_static = false; use_extern = true; argn++; }
+        else if (strcmp(argv[argn], "-align") == 0 && argn + 1 < argc - 2) { align = atoi(argv[argn + 1]); argn += 2; }
         else
         {
             fprintf(stderr, "Unknown argument: '%s'\n", argv[argn]);
@@ -73,7 +80,7 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static);
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static, use_extern, align);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
@@ -85,7 +92,7 @@ char Encode85Byte(unsigned int x)
     return (char)((x >= '\\') ? x + 1 : x);
 }
 
-bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static, bool use_extern, int align)
 {
     // Read file
     FILE* f = fopen(filename, "rb");
@@ -107,12 +114,15 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     // Output as Base85 encoded
     FILE* out = stdout;
     fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
-    const char* static_str = use_static ? "static " : "";
+    const char* static_str = use_static ? "static " : use_extern ? "extern " : "";
+    char align_str[32] = "";
+    if (align > 0)
+        snprintf(align_str, sizeof(align_str), "alignas(%d) ", align);
     const char* compressed_str = use_compression ? "compressed_" : "";
     if (source_encoding == SourceEncoding_Base85)
     {
         fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 \"%s\" %s\n", filename, symbol);
-        fprintf(out, "%sconst char %s_%sdata_base85[%d+1] =\n    \"", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
+        fprintf(out, "%s%sconst char %s_%sdata_base85[%d+1] =\n    \"", align_str, static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
         char prev_c = 0;
         for (int src_i = 0; src_i < compressed_sz; src_i += 4)
         {
@@ -134,7 +144,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
         // As individual bytes, not subject to endianness issues.
         fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 \"%s\" %s\n", filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
-        fprintf(out, "%sconst unsigned char %s_%sdata[%d] =\n{", static_str, symbol, compressed_str, (int)compressed_sz);
+        fprintf(out, "%s%sconst unsigned char %s_%sdata[%d] =\n{", align_str, static_str, symbol, compressed_str, (int)compressed_sz);
         int column = 0;
         for (int i = 0; i < compressed_sz; i++)
         {
@@ -152,7 +162,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
         // As integers
         fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 \"%s\" %s\n", filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
-        fprintf(out, "%sconst unsigned int %s_%sdata[%d/4] =\n{", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
+        fprintf(out, "%s%sconst unsigned int %s_%sdata[%d/4] =\n{", align_str, static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
         int column = 0;
         for (int i = 0; i < compressed_sz; i += 4)
         {
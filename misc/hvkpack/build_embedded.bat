@@ -0,0 +1,11 @@
+@REM Regenerates example_win32_directx12\util\embedded_assets.cpp from the files in embedded\
+@REM (same layout as the synced assets folder). Run from a Visual Studio developer prompt.
+@setlocal
+@cd /d "%~dp0"
+@set UTIL=..\..\example_win32_directx12\util
+@mkdir build 2>nul
+cl /nologo /std:c++20 /EHsc /O2 hvkpack.cpp %UTIL%\asset_pack.cpp %UTIL%\hash.cpp /Fobuild\ /Febuild\hvkpack.exe || exit /b 1
+cl /nologo /O2 ..\fonts\binary_to_compressed_c.cpp /Fobuild\ /Febuild\binary_to_compressed_c.exe || exit /b 1
+build\hvkpack.exe embedded embedded.hvkpack || exit /b 1
+build\binary_to_compressed_c.exe -nocompress -extern -align 64 embedded.hvkpack g_EmbeddedAssets > %UTIL%\embedded_assets.cpp || exit /b 1
+@del embedded.hvkpack
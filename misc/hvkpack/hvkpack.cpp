@@ -0,0 +1,121 @@
+// hvkpack
+// Packs a folder into the single-file asset pack the app maps at startup (see util/asset_pack.h),
+// and lists or verifies existing packs. The app builds its own pack after each asset sync; this
+// is for shipping a pack alongside a build and for poking at one by hand.
+
+// Build with, e.g:
+//   # cl.exe /std:c++20 /EHsc /O2 hvkpack.cpp ..\..\example_win32_directx12\util\asset_pack.cpp ..\..\example_win32_directx12\util\hash.cpp
+//   # g++ -std=c++20 -O2 hvkpack.cpp ../../example_win32_directx12/util/asset_pack.cpp ../../example_win32_directx12/util/hash.cpp -pthread
+
+// Usage:
+//   hvkpack.exe [-nocompress] [-tag <n>] <folder> <outfile>
+//   hvkpack.exe -list <packfile>
+//   hvkpack.exe -verify <packfile>
+// Usage example:
+//   # hvkpack.exe assets assets.hvkpack
+
+#define _CRT_SECURE_NO_WARNINGS
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "../../example_win32_directx12/util/asset_pack.h"
+
+static int Usage()
+{
+    printf("Syntax: hvkpack.exe [-nocompress] [-tag <n>] <folder> <outfile>\n");
+    printf("        hvkpack.exe -list <packfile>\n");
+    printf("        hvkpack.exe -verify <packfile>\n");
+    return 1;
+}
+
+static std::shared_ptr<AssetPack> OpenOrComplain(const char* path)
+{
+    std::string error;
+    std::shared_ptr<AssetPack> pack = AssetPack::Open(path, &error);
+    if (!pack)
+        fprintf(stderr, "Error opening '%s': %s\n", path, error.c_str());
+    return pack;
+}
+
+static int List(const char* path)
+{
+    std::shared_ptr<AssetPack> pack = OpenOrComplain(path);
+    if (!pack)
+        return 1;
+
+    uint64_t stored = 0, size = 0;
+    for (const PackEntry& e : *pack)
+    {
+        std::string name(pack->NameOf(e));
+        printf("%016llx  %10llu %10llu  %-5s %s\n",
+            (unsigned long long)e.Checksum, (unsigned long long)e.Size, (unsigned long long)e.Stored,
+            e.Codec == AssetPack::Lz4 ? "lz4" : "store", name.c_str());
+        stored += e.Stored;
+        size += e.Size;
+    }
+    printf("%zu entries, %llu bytes, %llu stored, tag %016llx\n",
+        pack->Count(), (unsigned long long)size, (unsigned long long)stored, (unsigned long long)pack->SourceTag());
+    return 0;
+}
+
+static int Verify(const char* path)
+{
+    std::shared_ptr<AssetPack> pack = OpenOrComplain(path);
+    if (!pack)
+        return 1;
+
+    int bad = 0;
+    for (const PackEntry& e : *pack)
+    {
+        AssetData data;
+        std::string error;
+        if (!pack->Read(e, data, &error))
+        {
+            fprintf(stderr, "%s\n", error.c_str());
+            bad++;
+        }
+    }
+    printf("%zu entries, %d bad\n", pack->Count(), bad);
+    return bad ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+        return Usage();
+
+    if (strcmp(argv[1], "-list") == 0)
+        return List(argv[2]);
+    if (strcmp(argv[1], "-verify") == 0)
+        return Verify(argv[2]);
+
+    bool compress = true;
+    uint64_t tag = 0;
+    int argn = 1;
+    for (; argn < argc - 2 && argv[argn][0] == '-'; argn++)
+    {
+        if (strcmp(argv[argn], "-nocompress") == 0)
+            compress = false;
+        else if (strcmp(argv[argn], "-tag") == 0 && argn + 1 < argc - 2)
+            tag = strtoull(argv[++argn], NULL, 0);
+        else
+        {
+            fprintf(stderr, "Unknown argument: '%s'\n", argv[argn]);
+            return Usage();
+        }
+    }
+    if (argn != argc - 2)
+        return Usage();
+
+    AssetPackBuildReport report;
+    bool ok = AssetPack::Build(argv[argn], argv[argn + 1], tag, &report, compress);
+    for (const std::string& e : report.Errors)
+        fprintf(stderr, "%s\n", e.c_str());
+
+    printf("%llu files (%llu compressed), %.1f KB -> %.1f KB, %.2fs\n",
+        (unsigned long long)report.Files, (unsigned long long)report.Compressed,
+        report.BytesIn / 1024.0, report.BytesOut / 1024.0, report.Seconds);
+    return ok ? 0 : 1;
+}
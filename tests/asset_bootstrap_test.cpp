@@ -0,0 +1,323 @@
+// AssetBootstrap with the real sync (AssetSync over tests/http_stub.h
+// standing in for api.github.com and raw.githubusercontent.com) and a pack
+// step like HVKIO::MountPSHVKAssets: the first run hands new assets to the
+// main loop once, an unchanged upstream doesn't, a changed file does again,
+// a pack that fails verification is unmounted in favour of the loose files,
+// and Stop() during the download leaves the rest undone.
+
+#include "asset_bootstrap.h"
+#include "asset_sync.h"
+#include "asset_vfs.h"
+#include "hash.h"
+#include "http_stub.h"
+#include "check.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const char* kTree = "/repos/hav0kdotsys/PSHVK/git/trees/HEAD";
+
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::stringstream ss;
+		ss << in.rdbuf();
+		return ss.str();
+	}
+
+	std::string Bytes(size_t size, uint32_t seed)
+	{
+		std::string s(size, '\0');
+		uint32_t x = seed * 2654435761u + 1;
+		for (auto& c : s)
+		{
+			x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+			c = (char)x;
+		}
+		return s;
+	}
+
+	// The repo upstream: a listing of assets/ and the raw files behind it
+	struct Upstream
+	{
+		std::map<std::string, std::string> Files;
+
+		void Publish(HttpStub& server, int revision) const
+		{
+			std::string tree = "{ \"sha\": \"" + std::string(40, (char)('a' + revision)) + "\", \"truncated\": false, \"tree\": [";
+			bool first = true;
+			for (const auto& [path, body] : Files)
+			{
+				tree += first ? "" : ", ";
+				first = false;
+				tree += "{ \"path\": \"assets/" + path + "\", \"mode\": \"100644\", \"type\": \"blob\", \"sha\": \"" +
+					AssetSync::GitBlobSha(body.data(), body.size()) + "\", \"size\": " + std::to_string(body.size()) + " }";
+
+				StubFile raw;
+				raw.Body = body;
+				raw.ETag = "\"" + path + std::to_string(revision) + "\"";
+				server.Put("/raw/assets/" + path, raw);
+			}
+			tree += "] }";
+
+			StubFile listing;
+			listing.Body = tree;
+			listing.ETag = "\"tree" + std::to_string(revision) + "\"";
+			listing.ContentType = "application/json";
+			server.Put(kTree, listing);
+		}
+	};
+
+	AssetSyncConfig Config(HttpStub& server, const fs::path& root)
+	{
+		AssetSyncConfig cfg;
+		cfg.TreeUrl = server.Url(std::string(kTree) + "?recursive=1");
+		cfg.RawBase = server.Url("/raw/");
+		cfg.Prefix = "assets/";
+		cfg.Root = root;
+		cfg.Download.BackoffMs = 10;
+		cfg.Download.MaxRetries = 1;
+		return cfg;
+	}
+
+	// MountPSHVKAssets without the Windows paths: a pack per manifest, built when missing
+	bool MountPack(const fs::path& dir, const fs::path& root, bool corrupt)
+	{
+		const std::string manifest = ReadAll(root / AssetSync::kManifestFile);
+		if (manifest.empty())
+			return false;
+		const uint64_t tag = HashService::Fast64(manifest.data(), manifest.size());
+
+		auto current = AssetVfs::Pack();
+		if (current && current->SourceTag() == tag)
+			return false;
+
+		const fs::path packPath = dir / ("assets." + std::to_string(tag) + AssetPack::kExtension);
+		if (!AssetPack::Build(root, packPath, tag))
+			return false;
+
+		if (corrupt)
+		{
+			std::string bytes = ReadAll(packPath);
+			auto pack = AssetPack::Open(packPath);
+			const PackEntry& e = *pack->Find("backgrounds/galaxy_purple.png");
+			bytes[(size_t)e.Offset + (size_t)e.Stored / 2] ^= 0x40;
+			pack.reset();
+			std::ofstream(packPath, std::ios::binary | std::ios::trunc).write(bytes.data(), (std::streamsize)bytes.size());
+		}
+
+		auto pack = AssetPack::Open(packPath);
+		if (!pack)
+			return false;
+		AssetVfs::Mount(std::move(pack), root);
+		return true;
+	}
+
+	struct RunResult
+	{
+		bool Swapped = false;
+		bool SwappedTwice = false;
+		std::string VerifyError;
+		std::vector<TaskTiming> Timings;
+	};
+
+	// Start, then poll between "frames" like PollBootstrap does
+	RunResult Run(HttpStub& server, const fs::path& dir, bool corrupt = false)
+	{
+		AssetBootstrap boot;
+		AssetBootstrapSteps steps;
+		steps.Sync = [&](const std::atomic<bool>* cancel)
+			{
+				AssetSyncConfig cfg = Config(server, dir / "assets");
+				cfg.Download.Cancel = cancel;
+				AssetSyncReport report;
+				AssetSync::Sync(cfg, report);
+				return report.Swapped;
+			};
+		steps.Mount = [&] { return MountPack(dir, dir / "assets", corrupt); };
+		boot.Start(std::move(steps));
+
+		RunResult r;
+		const auto t = std::chrono::steady_clock::now();
+		while (!boot.Graph().Finished() && ElapsedMs(t) < 10000.0)
+		{
+			r.Swapped |= boot.TakeSwap();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		CHECK(boot.Graph().Finished());
+
+		r.Swapped |= boot.TakeSwap();
+		r.SwappedTwice = boot.TakeSwap();
+		r.VerifyError = boot.VerifyError();
+		r.Timings = boot.Graph().Timings();
+		return r;
+	}
+
+	bool AllDone(const RunResult& r)
+	{
+		for (const auto& t : r.Timings)
+		{
+			if (t.State != TaskState::Done)
+				return false;
+		}
+		return r.Timings.size() == 4;
+	}
+
+	std::string VfsRead(const std::string& rel)
+	{
+		AssetData d;
+		return AssetVfs::Read(rel, d) ? std::string((const char*)d.Data, d.Size) : std::string();
+	}
+
+	void Lifecycle(HttpStub& server, const fs::path& dir)
+	{
+		Upstream up;
+		up.Files["backgrounds/Galaxy_Purple.png"] = Bytes(300000, 1);
+		up.Files["fonts/satoshi/Satoshi-Regular.otf"] = Bytes(60000, 2);
+		for (int i = 1; i <= 12; ++i)
+			up.Files["LoadingIcon/" + std::to_string(1000 + i) + ".png"] = Bytes(5000 + i, 10 + i);
+		up.Publish(server, 1);
+
+		// first run: nothing on disk, everything arrives, one swap
+		RunResult r = Run(server, dir);
+		CHECK(AllDone(r));
+		CHECK(r.Swapped);
+		CHECK(!r.SwappedTwice);
+		CHECK(r.VerifyError.empty());
+		CHECK(AssetVfs::Pack() != nullptr);
+
+		const uint64_t packReads = AssetVfs::Stats().Pack;
+		CHECK(VfsRead("backgrounds/Galaxy_Purple.png") == up.Files["backgrounds/Galaxy_Purple.png"]);
+		CHECK_EQ(AssetVfs::Stats().Pack, packReads + 1);
+
+		// next start, nothing changed upstream: no swap, the same pack stays
+		const auto mounted = AssetVfs::Pack();
+		r = Run(server, dir);
+		CHECK(AllDone(r));
+		CHECK(!r.Swapped);
+		CHECK(AssetVfs::Pack() == mounted);
+
+		// one file changed: swapped again, served from the new pack
+		up.Files["fonts/satoshi/Satoshi-Regular.otf"] = Bytes(60000, 3);
+		up.Publish(server, 2);
+		r = Run(server, dir);
+		CHECK(AllDone(r));
+		CHECK(r.Swapped);
+		CHECK(AssetVfs::Pack() != mounted);
+		CHECK(VfsRead("fonts/satoshi/Satoshi-Regular.otf") == up.Files["fonts/satoshi/Satoshi-Regular.otf"]);
+
+		// the new pack is damaged: unmounted, the loose files serve the swap
+		up.Files["backgrounds/Galaxy_Purple.png"] = Bytes(300000, 4);
+		up.Publish(server, 3);
+		r = Run(server, dir, true);
+		CHECK(AllDone(r));
+		CHECK(r.Swapped);
+		CHECK(!r.VerifyError.empty());
+		CHECK(AssetVfs::Pack() == nullptr);
+		const uint64_t diskReads = AssetVfs::Stats().Disk;
+		CHECK(VfsRead("backgrounds/Galaxy_Purple.png") == up.Files["backgrounds/Galaxy_Purple.png"]);
+		CHECK_EQ(AssetVfs::Stats().Disk, diskReads + 1);
+	}
+
+	// Closed while the sync is still waiting on the network
+	void StopDuringSync()
+	{
+		std::atomic<bool> entered{ false };
+		std::atomic<bool> sawCancel{ false };
+		std::atomic<bool> mounted{ false };
+
+		AssetBootstrap boot;
+		AssetBootstrapSteps steps;
+		steps.Sync = [&](const std::atomic<bool>* cancel)
+			{
+				entered.store(true);
+				while (!cancel->load())
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				sawCancel.store(true);
+				return true;
+			};
+		steps.Mount = [&] { mounted.store(true); return true; };
+		boot.Start(std::move(steps));
+
+		while (!entered.load())
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		CHECK(!boot.Graph().Finished());
+
+		const auto t = std::chrono::steady_clock::now();
+		boot.Stop();
+		const double ms = ElapsedMs(t);
+
+		CHECK(sawCancel.load());
+		CHECK(!mounted.load());
+		CHECK(!boot.TakeSwap());
+		CHECK(boot.Graph().Finished());
+		const auto timings = boot.Graph().Timings();
+		CHECK(timings[0].State == TaskState::Failed);
+		for (size_t i = 1; i < timings.size(); ++i)
+			CHECK(timings[i].State == TaskState::Skipped);
+		std::printf("stop during sync: %.1f ms\n", ms);
+	}
+
+	// No network: the sync fails, the app carries on with what it has
+	void Offline(const fs::path& dir)
+	{
+		int port;
+		{
+			HttpStub closed;
+			port = std::stoi(closed.Url("").substr(std::string("http://127.0.0.1:").size()));
+		}
+
+		// the pack the last good sync left, as a restart would mount it
+		MountPack(dir, dir / "assets", false);
+		const auto before = AssetVfs::Pack();
+		CHECK(before != nullptr);
+
+		AssetBootstrap boot;
+		AssetBootstrapSteps steps;
+		steps.Sync = [&](const std::atomic<bool>* cancel)
+			{
+				AssetSyncConfig cfg;
+				cfg.TreeUrl = "http://127.0.0.1:" + std::to_string(port) + kTree;
+				cfg.RawBase = "http://127.0.0.1:" + std::to_string(port) + "/raw/";
+				cfg.Prefix = "assets/";
+				cfg.Root = dir / "assets";
+				cfg.ListTimeoutSec = 2;
+				cfg.Download.Cancel = cancel;
+				AssetSyncReport report;
+				CHECK(!AssetSync::Sync(cfg, report));
+				return report.Swapped;
+			};
+		steps.Mount = [&] { return MountPack(dir, dir / "assets", false); };
+		boot.Start(std::move(steps));
+
+		const auto t = std::chrono::steady_clock::now();
+		while (!boot.Graph().Finished() && ElapsedMs(t) < 10000.0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		CHECK(boot.Graph().Finished());
+		CHECK(!boot.TakeSwap());
+		CHECK(AssetVfs::Pack() == before);
+	}
+}
+
+int main()
+{
+	const fs::path dir = fs::temp_directory_path() / "hvk_asset_bootstrap_test";
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+
+	{
+		HttpStub server;
+		Lifecycle(server, dir);
+	}
+	StopDuringSync();
+	Offline(dir);
+
+	AssetVfs::Unmount();
+	fs::remove_all(dir);
+	return CheckResult();
+}
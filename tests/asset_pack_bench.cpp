@@ -0,0 +1,248 @@
+// AssetPack against loose files: cold and warm access to an asset tree
+// shaped like the real one, and the cost of VerifyAll.
+//
+//   asset_pack_bench            8 backgrounds of 2 MiB, 5 rounds
+//   asset_pack_bench --quick    4 of 256 KiB, 2 rounds (what ctest runs)
+//
+// The tree is 122 loading frames, the Satoshi fonts and the backgrounds,
+// built under the temp directory from misc/hvkpack/embedded. "Cold" drops
+// the files from the page cache first (POSIX_FADV_DONTNEED), so it includes
+// the disk reads on hardware where the cache is the only thing in between.
+// The loose pass does what the loaders did before the pack: exists check,
+// open, read, close per file.
+
+#include "asset_pack.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const fs::path kEmbedded = fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded";
+
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	}
+
+	void Put(const fs::path& path, const std::string& bytes)
+	{
+		fs::create_directories(path.parent_path());
+		std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), (std::streamsize)bytes.size());
+	}
+
+	// PNG-like: doesn't compress
+	std::string Noise(size_t size, uint32_t seed)
+	{
+		std::string s(size, '\0');
+		uint32_t x = seed * 2654435761u + 1;
+		for (auto& c : s)
+		{
+			x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+			c = (char)x;
+		}
+		return s;
+	}
+
+	std::vector<std::string> BuildTree(const fs::path& root, size_t backgroundSize, int backgrounds)
+	{
+		std::vector<std::string> paths;
+		auto add = [&](const std::string& rel, const std::string& bytes)
+			{
+				Put(root / rel, bytes);
+				paths.push_back(rel);
+			};
+
+		for (const char* font : { "Satoshi-Regular.otf", "Satoshi-Medium.otf", "Satoshi-Bold.otf" })
+			add(std::string("fonts/satoshi/") + font, ReadAll(kEmbedded / "fonts" / "satoshi" / font));
+
+		// 61 frames a theme, cycling through the embedded ones
+		for (const char* theme : { "LoadingIcon", "LoadingIconLight" })
+		{
+			std::vector<std::string> frames;
+			for (const auto& e : fs::directory_iterator(kEmbedded / theme))
+				frames.push_back(ReadAll(e.path()));
+
+			for (int i = 1; i <= 61; ++i)
+			{
+				char name[64];
+				snprintf(name, sizeof(name), "%s/%04d.png", theme, i);
+				add(name, frames[i % frames.size()]);
+			}
+		}
+
+		for (int i = 0; i < backgrounds; ++i)
+			add("backgrounds/bg_" + std::to_string(i) + ".png", Noise(backgroundSize, i));
+
+		return paths;
+	}
+
+	void DropCache(const fs::path& path)
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+		fdatasync(fd);
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		close(fd);
+	}
+
+	// One byte a page, so a span is paid for like the read it replaces
+	uint64_t Touch(const uint8_t* p, size_t n)
+	{
+		uint64_t sum = 0;
+		for (size_t i = 0; i < n; i += 4096)
+			sum += p[i];
+		return sum + (n ? p[n - 1] : 0);
+	}
+
+	double LoosePass(const fs::path& root, const std::vector<std::string>& paths, uint64_t& sum)
+	{
+		const auto t = std::chrono::steady_clock::now();
+		std::vector<uint8_t> buf;
+		for (const auto& rel : paths)
+		{
+			const fs::path p = root / rel;
+			if (!fs::exists(p))
+				continue;
+
+			FILE* f = fopen(p.c_str(), "rb");
+			if (!f)
+				continue;
+			fseek(f, 0, SEEK_END);
+			buf.resize((size_t)ftell(f));
+			fseek(f, 0, SEEK_SET);
+			buf.resize(fread(buf.data(), 1, buf.size(), f));
+			fclose(f);
+			sum += Touch(buf.data(), buf.size());
+		}
+		return ElapsedMs(t);
+	}
+
+	double PackPass(const fs::path& packPath, const std::vector<std::string>& paths, uint64_t& sum)
+	{
+		const auto t = std::chrono::steady_clock::now();
+		auto pack = AssetPack::Open(packPath);
+		if (!pack)
+			return -1.0;
+		for (const auto& rel : paths)
+		{
+			AssetData d;
+			if (pack->Read(rel, d))
+				sum += Touch(d.Data, d.Size);
+		}
+		return ElapsedMs(t);
+	}
+
+	double Median(std::vector<double> v)
+	{
+		std::sort(v.begin(), v.end());
+		return v[v.size() / 2];
+	}
+
+	void SameBytes(const fs::path& root, const fs::path& packPath, const std::vector<std::string>& paths)
+	{
+		auto pack = AssetPack::Open(packPath);
+		CHECK(pack != nullptr);
+		if (!pack)
+			return;
+		CHECK_EQ(pack->Count(), paths.size());
+
+		for (const auto& rel : paths)
+		{
+			AssetData d;
+			CHECK(pack->Read(rel, d));
+			CHECK(std::string((const char*)d.Data, d.Size) == ReadAll(root / rel));
+		}
+	}
+
+	// A flipped byte in one entry fails that entry and VerifyAll, nothing else
+	void CorruptEntry(const fs::path& packPath, const fs::path& dir)
+	{
+		std::string bytes = ReadAll(packPath);
+		const fs::path bad = dir / "bad.hvkpack";
+
+		std::string target;
+		{
+			auto pack = AssetPack::Open(packPath);
+			const PackEntry& e = *pack->Find("backgrounds/bg_0.png");
+			target = std::string(pack->NameOf(e));
+			bytes[(size_t)e.Offset + (size_t)e.Stored / 2] ^= 0x40;
+		}
+		Put(bad, bytes);
+
+		auto pack = AssetPack::Open(bad);
+		CHECK(pack != nullptr);   // only the index is checked on open
+		if (!pack)
+			return;
+
+		std::string error;
+		CHECK(!pack->VerifyAll(&error));
+		CHECK(!error.empty());
+
+		AssetData d;
+		CHECK(!pack->Read(target, d));
+		CHECK(pack->Read("fonts/satoshi/satoshi-bold.otf", d));
+		fs::remove(bad);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int rounds = quick ? 2 : 5;
+
+	const fs::path dir = fs::temp_directory_path() / "hvk_asset_pack_bench";
+	const fs::path root = dir / "assets";
+	const fs::path packPath = dir / "assets.hvkpack";
+	fs::remove_all(dir);
+
+	const auto paths = BuildTree(root, quick ? 256u << 10 : 2u << 20, quick ? 4 : 8);
+
+	AssetPackBuildReport report;
+	auto t = std::chrono::steady_clock::now();
+	CHECK(AssetPack::Build(root, packPath, 1, &report));
+	const double buildMs = ElapsedMs(t);
+	std::printf("pack: %llu files, %llu lz4, %.1f MB -> %.1f MB, built in %.1f ms\n",
+		(unsigned long long)report.Files, (unsigned long long)report.Compressed,
+		report.BytesIn / 1e6, report.BytesOut / 1e6, buildMs);
+
+	SameBytes(root, packPath, paths);
+	CorruptEntry(packPath, dir);
+
+	uint64_t sum = 0;
+	std::vector<double> looseCold, packCold, looseWarm, packWarm, verify;
+	for (int r = 0; r < rounds; ++r)
+	{
+		for (const auto& rel : paths)
+			DropCache(root / rel);
+		looseCold.push_back(LoosePass(root, paths, sum));
+		looseWarm.push_back(LoosePass(root, paths, sum));
+
+		DropCache(packPath);
+		packCold.push_back(PackPass(packPath, paths, sum));
+		packWarm.push_back(PackPass(packPath, paths, sum));
+
+		// what the packer's verify and a first full read pay: every checksum, every decode
+		auto pack = AssetPack::Open(packPath);
+		t = std::chrono::steady_clock::now();
+		CHECK(pack && pack->VerifyAll());
+		verify.push_back(ElapsedMs(t));
+	}
+
+	std::printf("%zu assets: loose cold %.2f ms warm %.2f ms | pack cold %.2f ms warm %.2f ms (median of %d, sum %llu)\n",
+		paths.size(), Median(looseCold), Median(looseWarm), Median(packCold), Median(packWarm), rounds,
+		(unsigned long long)(sum & 0xff));
+	std::printf("VerifyAll: %.2f ms, %.2f GB/s over %.1f MB\n",
+		Median(verify), report.BytesIn / Median(verify) / 1e6, report.BytesIn / 1e6);
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
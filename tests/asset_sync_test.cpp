@@ -0,0 +1,121 @@
+// AssetSync::ParseGithubTree on trees listings as GitHub sends them and as
+// it shouldn't: wrong value types, error objects and junk must come back as
+// a false with a reason, never as an exception.
+
+#include "asset_sync.h"
+#include "check.h"
+
+#include <string>
+
+namespace
+{
+	const char* kSha1 = "0123456789abcdef0123456789abcdef01234567";
+	const char* kSha2 = "89abcdef0123456789abcdef0123456789abcdef";
+
+	std::string Node(const std::string& path, const std::string& type, const std::string& sha, const std::string& size,
+		const std::string& mode = "\"100644\"")
+	{
+		return "{ \"path\": " + path + ", \"mode\": " + mode + ", \"type\": " + type +
+			", \"sha\": " + sha + ", \"size\": " + size + ", \"url\": \"https://api.github.com/x\" }";
+	}
+
+	std::string Listing(const std::string& nodes, const std::string& truncated = "false")
+	{
+		return std::string("{ \"sha\": \"feedface\", \"url\": \"https://api.github.com/t\", \"tree\": [ ") + nodes +
+			" ], \"truncated\": " + truncated + " }";
+	}
+
+	void ParsesAndFilters()
+	{
+		const std::string q1 = std::string("\"") + kSha1 + "\"";
+		const std::string q2 = std::string("\"") + kSha2 + "\"";
+		const std::string text = Listing(
+			Node("\"assets/fonts/satoshi.otf\"", "\"blob\"", q2, "2048") + ", " +
+			Node("\"assets/logo.png\"", "\"blob\"", q1, "10") + ", " +
+			Node("\"assets/fonts\"", "\"tree\"", q1, "0") + ", " +
+			Node("\"assets/link\"", "\"blob\"", q1, "4", "\"120000\"") + ", " +
+			Node("\"README.md\"", "\"blob\"", q1, "7") + ", " +
+			Node("\"assets/../escape\"", "\"blob\"", q1, "7"));
+
+		AssetManifest m;
+		std::string error;
+		CHECK(AssetSync::ParseGithubTree(text, "assets/", m, &error));
+		CHECK(error.empty());
+		CHECK_EQ(m.Tree, std::string("feedface"));
+		CHECK_EQ(m.Files.size(), (size_t)2);
+		if (m.Files.size() == 2)
+		{
+			CHECK_EQ(m.Files[0].Path, std::string("fonts/satoshi.otf"));
+			CHECK_EQ(m.Files[0].Size, 2048ull);
+			CHECK_EQ(m.Files[1].Path, std::string("logo.png"));
+			CHECK_EQ(m.Files[1].Sha, std::string(kSha1));
+		}
+	}
+
+	// each of these used to throw json::type_error out of node.value()
+	void WrongTypesSkipTheNode()
+	{
+		const std::string q1 = std::string("\"") + kSha1 + "\"";
+		const std::string text = Listing(
+			Node("5", "\"blob\"", q1, "1") + ", " +
+			Node("\"assets/a\"", "[ \"blob\" ]", q1, "1") + ", " +
+			Node("\"assets/b\"", "\"blob\"", "null", "1") + ", " +
+			Node("\"assets/c\"", "\"blob\"", "{ \"x\": 1 }", "1") + ", " +
+			Node("\"assets/d\"", "\"blob\"", q1, "1", "100644") + ", " +
+			"\"not an object\", 7, null, [ 1, 2 ]");
+
+		AssetManifest m;
+		std::string error;
+		CHECK(AssetSync::ParseGithubTree(text, "assets/", m, &error));
+		// the bad size and the unquoted mode keep their defaults, the node stays
+		CHECK_EQ(m.Files.size(), (size_t)1);
+		if (m.Files.size() == 1)
+			CHECK_EQ(m.Files[0].Path, std::string("d"));
+
+		const std::string q = std::string("\"") + kSha1 + "\"";
+		CHECK(AssetSync::ParseGithubTree(Listing(Node("\"assets/e\"", "\"blob\"", q, "\"12\"")), "assets/", m));
+		CHECK(m.Files.size() == 1 && m.Files[0].Size == 0);
+	}
+
+	void RejectsWhatIsNotATree()
+	{
+		const char* cases[][2] =
+		{
+			{ R"({ "message": "API rate limit exceeded", "documentation_url": "https://docs.github.com" })", "API rate limit exceeded" },
+			{ R"({ "sha": "feedface", "tree": null })", nullptr },
+			{ R"({ "sha": 12, "tree": [] })", "listing has no tree sha" },
+			{ R"({ "tree": [] })", "listing has no tree sha" },
+			{ R"({ "message": 404 })", "listing has no tree: no \"tree\" array" },
+			{ R"({ "sha": "feedface", "tree": { "path": "assets/a" } })", "listing has no tree: no \"tree\" array" },
+			{ R"([ { "path": "assets/a" } ])", nullptr },
+			{ R"("tree")", nullptr },
+			{ R"({ "sha": "feedface", "tree": [ )", nullptr },
+		};
+		for (const auto& c : cases)
+		{
+			AssetManifest m;
+			std::string error;
+			CHECK(!AssetSync::ParseGithubTree(c[0], "assets/", m, &error));
+			CHECK(!error.empty());
+			if (c[1])
+				CHECK_EQ(error, std::string(c[1]));
+		}
+
+		AssetManifest m;
+		std::string error;
+		CHECK(!AssetSync::ParseGithubTree(Listing("", "true"), "assets/", m, &error));
+		CHECK_EQ(error, std::string("listing truncated"));
+
+		// "truncated" of the wrong type reads as not truncated, an empty tree is fine
+		CHECK(AssetSync::ParseGithubTree(Listing("", "\"yes\""), "assets/", m, &error));
+		CHECK(m.Files.empty());
+	}
+}
+
+int main()
+{
+	ParsesAndFilters();
+	WrongTypesSkipTheNode();
+	RejectsWhatIsNotATree();
+	return CheckResult();
+}
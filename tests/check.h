@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+// Minimal checks for the Linux test executables: failures are printed and
+// counted, and main() returns CheckResult() so ctest sees them.
+
+inline int g_CheckFailures = 0;
+
+#define CHECK(cond) \
+	do { if (!(cond)) { std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); ++g_CheckFailures; } } while (0)
+
+#define CHECK_EQ(a, b) \
+	do { if (!((a) == (b))) { std::printf("%s:%d: CHECK_EQ(%s, %s) failed\n", __FILE__, __LINE__, #a, #b); ++g_CheckFailures; } } while (0)
+
+inline int CheckResult()
+{
+	if (g_CheckFailures)
+		std::printf("%d check(s) failed\n", g_CheckFailures);
+	else
+		std::printf("all checks passed\n");
+	return g_CheckFailures ? 1 : 0;
+}
+
+inline double ElapsedMs(std::chrono::steady_clock::time_point since)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
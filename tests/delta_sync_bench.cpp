@@ -0,0 +1,147 @@
+// DeltaSync on a generated directory pair: first copy, a sync after a few
+// blocks changed, and a sync with nothing to do, against a plain full copy.
+//
+//   delta_sync_bench            64 files x 16 MiB
+//   delta_sync_bench --quick    24 files x 1 MiB (what ctest runs)
+//
+// Both trees live under the temp directory, so the times are page cache
+// times; BytesWritten is the number that carries over to a USB stick.
+
+#include "delta_sync.h"
+#include "check.h"
+
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	std::vector<uint8_t> ReadAll(const fs::path& p)
+	{
+		std::ifstream f(p, std::ios::binary);
+		return std::vector<uint8_t>((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+	}
+
+	void WriteAll(const fs::path& p, const std::vector<uint8_t>& data)
+	{
+		fs::create_directories(p.parent_path());
+		std::ofstream f(p, std::ios::binary | std::ios::trunc);
+		f.write((const char*)data.data(), (std::streamsize)data.size());
+	}
+
+	bool SameTree(const fs::path& a, const fs::path& b)
+	{
+		size_t files = 0;
+		for (auto& e : fs::recursive_directory_iterator(a))
+		{
+			if (!e.is_regular_file())
+				continue;
+			++files;
+			if (ReadAll(e.path()) != ReadAll(b / fs::relative(e.path(), a)))
+				return false;
+		}
+
+		size_t other = 0;
+		for (auto& e : fs::recursive_directory_iterator(b))
+			other += e.is_regular_file() && e.path().filename() != DeltaSync::kSignatureFile;
+		return files == other;
+	}
+
+	void Print(const char* what, const SyncReport& r)
+	{
+		std::printf("%-10s %6.1f ms  written %8.2f MiB of %8.2f MiB  copied %llu patched %llu unchanged %llu deleted %llu  reused blocks %llu\n",
+			what, r.Seconds * 1000.0, r.BytesWritten / 1048576.0, r.BytesSource / 1048576.0,
+			(unsigned long long)r.FilesCopied, (unsigned long long)r.FilesPatched,
+			(unsigned long long)r.FilesUnchanged, (unsigned long long)r.FilesDeleted,
+			(unsigned long long)r.BlocksReused);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int fileCount = quick ? 24 : 64;
+	const size_t fileSize = quick ? (1u << 20) : (16u << 20);
+
+	const fs::path root = fs::temp_directory_path() / "hvk_delta_sync_bench";
+	const fs::path src = root / "src", dst = root / "dst", plain = root / "plain";
+	fs::remove_all(root);
+
+	std::mt19937_64 rng(42);
+	for (int i = 0; i < fileCount; ++i)
+	{
+		std::vector<uint8_t> data(fileSize + (size_t)i * 1000);  // uneven tails
+		for (auto& b : data)
+			b = (uint8_t)rng();
+		WriteAll(src / ("dir" + std::to_string(i % 4)) / ("file" + std::to_string(i) + ".bin"), data);
+	}
+
+	// baseline: what CopyFileSafe-style copying writes every time
+	auto t = std::chrono::steady_clock::now();
+	fs::copy(src, plain, fs::copy_options::recursive);
+	std::printf("%-10s %6.1f ms  (full copy)\n", "plain", ElapsedMs(t));
+
+	SyncOptions opt;
+	opt.DeleteExtraneous = true;
+	SyncReport r;
+
+	CHECK(DeltaSync::SyncFolders(src, dst, opt, r));
+	Print("initial", r);
+	CHECK_EQ(r.FilesCopied, (uint64_t)fileCount);
+	CHECK_EQ(r.BytesWritten, r.BytesSource);
+	CHECK(SameTree(src, dst));
+
+	// one byte in two blocks of every fourth file, plus one added and one removed
+	int touched = 0;
+	for (int i = 0; i < fileCount; i += 4, ++touched)
+	{
+		const fs::path p = src / ("dir" + std::to_string(i % 4)) / ("file" + std::to_string(i) + ".bin");
+		auto data = ReadAll(p);
+		data[10] ^= 0xff;
+		data[data.size() / 2] ^= 0xff;
+		WriteAll(p, data);
+	}
+	WriteAll(src / "new" / "added.bin", std::vector<uint8_t>(opt.BlockSize * 3 + 17, 7));
+	fs::remove(src / "dir1" / "file1.bin");
+
+	CHECK(DeltaSync::SyncFolders(src, dst, opt, r));
+	Print("changed", r);
+	CHECK_EQ(r.FilesPatched, (uint64_t)touched);
+	CHECK_EQ(r.FilesCopied, 1u);
+	CHECK_EQ(r.FilesDeleted, 1u);
+	CHECK_EQ(r.BytesWritten, (uint64_t)touched * 2 * opt.BlockSize + opt.BlockSize * 3 + 17);
+	CHECK(SameTree(src, dst));
+
+	CHECK(DeltaSync::SyncFolders(src, dst, opt, r));
+	Print("unchanged", r);
+	CHECK_EQ(r.BytesWritten, 0u);
+	CHECK_EQ(r.FilesUnchanged, r.FilesScanned);
+
+	// checksum mode reads everything and still writes nothing
+	SyncOptions full = opt;
+	full.Checksum = true;
+	CHECK(DeltaSync::SyncFolders(src, dst, full, r));
+	Print("checksum", r);
+	CHECK_EQ(r.BytesWritten, 0u);
+
+	// a cancelled job winds down and reports it
+	fs::remove_all(dst);
+	auto job = DeltaSyncJob::Start(src, dst, opt);
+	job->Cancel();
+	CHECK(job->WaitFor(10000));
+	CHECK(!job->Succeeded());
+	CHECK(job->Progress().FilesDone.load() <= job->Progress().FilesTotal.load());
+
+	// and the next run completes the tree
+	job = DeltaSyncJob::Start(src, dst, opt);
+	CHECK(job->WaitFor(60000));
+	CHECK(job->Succeeded());
+	CHECK(SameTree(src, dst));
+
+	fs::remove_all(root);
+	return CheckResult();
+}
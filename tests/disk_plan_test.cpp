@@ -0,0 +1,252 @@
+// DiskPlan: simulation and the diskpart script it turns a batch into.
+
+#include "disk_plan.h"
+#include "check.h"
+
+#include <string>
+
+namespace
+{
+	constexpr uint64_t MB = 1ull << 20;
+	constexpr uint64_t GB = 1ull << 30;
+
+	PlannedLayout EmptyDisk(uint64_t size, bool gpt)
+	{
+		PlannedLayout layout{};
+		layout.DiskSize = size;
+		layout.Gpt = gpt;
+		return layout;
+	}
+
+	PlannedPartition Existing(uint64_t offset, uint64_t size, char letter = 0, const char* fs = "NTFS")
+	{
+		PlannedPartition p{};
+		p.Offset = offset;
+		p.Size = size;
+		p.Letter = letter;
+		p.FileSystem = fs;
+		return p;
+	}
+
+	bool Contains(const std::string& s, const char* what)
+	{
+		return s.find(what) != std::string::npos;
+	}
+
+	void FirstFitAndAlignment()
+	{
+		DiskPlan plan;
+		plan.Reset(1);
+		plan.CreatePartition(100, "NTFS", "Data", true);
+		plan.CreatePartition(0, "exFAT", "Rest", true);
+
+		PlannedLayout out;
+		CHECK(plan.Simulate(EmptyDisk(GB, false), out));
+		CHECK_EQ(out.Partitions.size(), 2u);
+		CHECK_EQ(out.Partitions[0].Offset, MB);
+		CHECK_EQ(out.Partitions[0].Size, 100 * MB);
+		CHECK_EQ(out.Partitions[1].Offset, 101 * MB);
+		CHECK_EQ(out.Partitions[1].Size, GB - 101 * MB);
+		CHECK(out.Partitions[1].Created);
+		CHECK_EQ(out.UnallocatedBytes(), 0u);
+	}
+
+	void MbrPrimaryLimit()
+	{
+		DiskPlan plan;
+		plan.Reset(1);
+		for (int i = 0; i < 5; ++i)
+			plan.CreatePartition(10, "NTFS", "", true);
+
+		PlannedLayout out;
+		std::string error;
+		CHECK(!plan.Simulate(EmptyDisk(GB, false), out, &error));
+		CHECK(Contains(error, "#5 "));
+		CHECK(Contains(error, "at most 4 primary"));
+	}
+
+	// An empty GPT disk has no partition to tell its style from; the layout
+	// carries it, so the MBR limit and reserve must not apply
+	void EmptyGptDisk()
+	{
+		DiskPlan plan;
+		plan.Reset(2);
+		for (int i = 0; i < 6; ++i)
+			plan.CreatePartition(10, "NTFS", "", true);
+		plan.CreatePartition(0, "NTFS", "", true);
+
+		PlannedLayout out;
+		std::string error;
+		CHECK(plan.Simulate(EmptyDisk(GB, true), out, &error));
+		CHECK_EQ(out.Partitions.size(), 7u);
+
+		// the last one stops short of the backup GPT at the end of the disk
+		const PlannedPartition& last = out.Partitions.back();
+		CHECK_EQ(last.Offset + last.Size, GB - 33 * 512);
+		CHECK_EQ(EmptyDisk(GB, true).UnallocatedBytes(), GB - MB - 33 * 512);
+		CHECK_EQ(EmptyDisk(GB, false).UnallocatedBytes(), GB - MB);
+	}
+
+	void DeleteRefillsGapAndNumbersPartitions()
+	{
+		PlannedLayout disk = EmptyDisk(4 * GB, false);
+		disk.Partitions.push_back(Existing(MB, 512 * MB, 'E'));
+		disk.Partitions.push_back(Existing(513 * MB, 512 * MB, 'F'));
+		disk.Partitions.push_back(Existing(1025 * MB, 512 * MB, 'G'));
+
+		DiskPlan plan;
+		plan.Reset(3);
+		plan.DeletePartition(513 * MB);
+		plan.CreatePartition(256, "FAT32", "SMALL", true, 'k');
+
+		PlannedLayout out;
+		CHECK(plan.Simulate(disk, out));
+		CHECK_EQ(out.Partitions.size(), 3u);
+		CHECK_EQ(out.Partitions[1].Offset, 513 * MB);
+		CHECK_EQ(out.Partitions[1].Letter, 'K');
+
+		std::string script;
+		CHECK(plan.BuildScript(disk, script));
+		CHECK(Contains(script, "select disk 3\r\nselect partition 2\r\ndelete partition override\r\n"));
+		CHECK(Contains(script, "create partition primary size=256\r\nformat fs=FAT32 quick label=\"SMALL\"\r\nassign letter=K\r\n"));
+		CHECK(script.size() >= 6 && script.compare(script.size() - 6, 6, "exit\r\n") == 0);
+	}
+
+	void ConvertWipesAndSwitchesScheme()
+	{
+		PlannedLayout disk = EmptyDisk(8 * GB, false);
+		disk.Partitions.push_back(Existing(MB, GB, 'E'));
+
+		DiskPlan plan;
+		plan.Reset(4);
+		plan.ConvertScheme(true);
+		for (int i = 0; i < 5; ++i)
+			plan.CreatePartition(100, "NTFS", "", true);
+
+		PlannedLayout out;
+		CHECK(plan.Simulate(disk, out));
+		CHECK(out.Gpt);
+		CHECK_EQ(out.Partitions.size(), 5u);
+		CHECK_EQ(out.Partitions[0].Offset, MB);
+
+		std::string script;
+		CHECK(plan.BuildScript(disk, script));
+		CHECK(Contains(script, "clean\r\nconvert gpt\r\n"));
+	}
+
+	void RejectsInvalidOps()
+	{
+		PlannedLayout disk = EmptyDisk(64 * GB, false);
+		disk.Partitions.push_back(Existing(MB, GB, 'E'));
+		PlannedLayout out;
+		std::string error;
+
+		DiskPlan fat32;
+		fat32.Reset(1);
+		fat32.CreatePartition(0, "FAT32", "", true);
+		CHECK(!fat32.Simulate(disk, out, &error));
+		CHECK(Contains(error, "32 GB"));
+
+		DiskPlan label;
+		label.Reset(1);
+		label.CreatePartition(10, "exFAT", "sixteen chars!!!", true);
+		CHECK(!label.Simulate(disk, out, &error));
+		CHECK(Contains(error, "label too long"));
+
+		DiskPlan letter;
+		letter.Reset(1);
+		letter.CreatePartition(10, "NTFS", "", true, 'e');
+		CHECK(!letter.Simulate(disk, out, &error));
+		CHECK(Contains(error, "already in use"));
+
+		DiskPlan tooBig;
+		tooBig.Reset(1);
+		tooBig.CreatePartition(64 * 1024, "NTFS", "", true);
+		CHECK(!tooBig.Simulate(disk, out, &error));
+		CHECK(Contains(error, "not enough contiguous"));
+
+		DiskPlan missing;
+		missing.Reset(1);
+		missing.DeletePartition(7 * MB);
+		CHECK(!missing.Simulate(disk, out, &error));
+		std::string script = "stale";
+		CHECK(!missing.BuildScript(disk, script, &error));
+		CHECK(script.empty());
+
+		DiskPlan noDisk;
+		noDisk.Reset(-1);
+		noDisk.CreatePartition(10, "NTFS", "", true);
+		CHECK(!noDisk.BuildScript(disk, script, &error));
+		CHECK(Contains(error, "no disk selected"));
+	}
+
+	void RenameTracksOwnVolumesOnly()
+	{
+		PlannedLayout disk = EmptyDisk(4 * GB, false);
+		disk.Partitions.push_back(Existing(MB, GB, 'E', "FAT32"));
+
+		DiskPlan plan;
+		plan.Reset(-1);    // rename goes through select volume, no disk needed
+		plan.RenameVolume('e', "USB");
+		plan.RenameVolume('Z', "ELSEWHERE");
+
+		PlannedLayout out;
+		CHECK(plan.Simulate(disk, out));
+		CHECK_EQ(out.Partitions[0].Label, std::string("USB"));
+
+		std::string script;
+		CHECK(plan.BuildScript(disk, script));
+		CHECK(Contains(script, "select volume E\r\nlabel USB\r\n"));
+
+		DiskPlan tooLong;
+		tooLong.Reset(-1);
+		tooLong.RenameVolume('E', "TWELVE CHARS");
+		CHECK(!tooLong.Simulate(disk, out));
+
+		// volume picked from the volume list: no disk, no snapshot
+		DiskPlan fromList;
+		fromList.Reset(-1);
+		fromList.RenameVolume('F', "DATA");
+		CHECK(fromList.BuildScript(PlannedLayout{}, script));
+		CHECK(Contains(script, "select volume F\r\nlabel DATA\r\n"));
+		CHECK(!Contains(script, "select disk"));
+	}
+
+	void RejectsUnsafeLabels()
+	{
+		PlannedLayout disk = EmptyDisk(4 * GB, false);
+		PlannedLayout out;
+		std::string script;
+		std::string error;
+
+		const char* labels[] = { "A\"B", "A\r\nclean", "A\nB" };
+		for (const char* label : labels)
+		{
+			DiskPlan rename;
+			rename.Reset(-1);
+			rename.RenameVolume('E', label);
+			CHECK(!rename.BuildScript(disk, script, &error));
+			CHECK(Contains(error, "quotes or line breaks"));
+			CHECK(script.empty());
+
+			DiskPlan create;
+			create.Reset(1);
+			create.CreatePartition(10, "NTFS", label, true);
+			CHECK(!create.Simulate(disk, out, &error));
+			CHECK(Contains(error, "quotes or line breaks"));
+		}
+	}
+}
+
+int main()
+{
+	FirstFitAndAlignment();
+	MbrPrimaryLimit();
+	EmptyGptDisk();
+	DeleteRefillsGapAndNumbersPartitions();
+	ConvertWipesAndSwitchesScheme();
+	RejectsInvalidOps();
+	RenameTracksOwnVolumesOnly();
+	RejectsUnsafeLabels();
+	return CheckResult();
+}
@@ -0,0 +1,241 @@
+// DownloadManager against a local stand-in server: a batch of small assets
+// over shared connections, a large file in parallel ranges, dropped
+// connections resumed within a run and across runs, and the cases where a
+// resume must not happen (no validator, file changed on the server).
+// Prints the throughput of the batch and of the split file.
+
+#include "download_manager.h"
+#include "http_stub.h"
+#include "check.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	std::string Bytes(size_t size, uint32_t seed)
+	{
+		std::string s(size, '\0');
+		uint32_t x = seed * 2654435761u + 1;
+		for (auto& c : s)
+		{
+			x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+			c = (char)x;
+		}
+		return s;
+	}
+
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::stringstream ss;
+		ss << in.rdbuf();
+		return ss.str();
+	}
+
+	DownloadOptions Fast()
+	{
+		DownloadOptions o;
+		o.BackoffMs = 10;
+		o.MaxBackoffMs = 50;
+		o.ConnectTimeoutSec = 5;
+		o.StallTimeoutSec = 5;
+		return o;
+	}
+
+	double MBps(uint64_t bytes, double ms) { return ms > 0 ? bytes / ms / 1e3 : 0.0; }
+
+	// user-038: many small files reuse a few connections
+	void AssetBatch(HttpStub& server, const fs::path& dir, int count)
+	{
+		DownloadManager dm(Fast());
+		uint64_t total = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			const std::string name = "/assets/loading/frame_" + std::to_string(i) + ".png";
+			StubFile f;
+			f.Body = Bytes(20000 + i * 37, i);
+			f.ETag = "\"f" + std::to_string(i) + "\"";
+			total += f.Body.size();
+			server.Put(name, f);
+			dm.Add({ server.Url(name), dir / ("frame_" + std::to_string(i) + ".png") });
+		}
+
+		const int before = server.Connections();
+		std::vector<DownloadResult> results;
+		const auto t0 = std::chrono::steady_clock::now();
+		CHECK(dm.Run(&results));
+		const double ms = ElapsedMs(t0);
+
+		CHECK_EQ(results.size(), (size_t)count);
+		for (int i = 0; i < count; ++i)
+			CHECK(ReadAll(dir / ("frame_" + std::to_string(i) + ".png")) == Bytes(20000 + i * 37, i));
+
+		const int used = server.Connections() - before;
+		CHECK(used <= 8);   // MaxConcurrent, not one per file
+		std::printf("%d assets, %.1f MB in %.1f ms (%.0f MB/s) over %d connections\n",
+			count, total / 1e6, ms, MBps(total, ms), used);
+	}
+
+	// user-040: large file in ranges, with a dropped connection on the way
+	void SplitWithDrops(HttpStub& server, const fs::path& dir, size_t size)
+	{
+		StubFile f;
+		f.Body = Bytes(size, 99);
+		f.ETag = "\"big-1\"";
+		server.Put("/big.bin", f);
+		server.DropAfter("/big.bin", size / 16, 2);
+		server.ClearHits();
+
+		DownloadOptions o = Fast();
+		o.SplitThreshold = 1u << 20;
+		DownloadManager dm(o);
+		dm.Add({ server.Url("/big.bin"), dir / "big.bin" });
+
+		std::vector<DownloadResult> results;
+		const auto t0 = std::chrono::steady_clock::now();
+		CHECK(dm.Run(&results));
+		const double ms = ElapsedMs(t0);
+
+		CHECK(ReadAll(dir / "big.bin") == f.Body);
+		CHECK(results[0].Segments > 1);
+		CHECK(!fs::exists(dir / "big.bin.part"));
+		CHECK(!fs::exists(DownloadManager::StatePath(dir / "big.bin")));
+
+		uint64_t sent = 0;
+		bool ranged = false;
+		for (const auto& h : server.Hits())
+		{
+			sent += h.Bytes;
+			ranged |= !h.Range.empty();
+			CHECK(h.Range.empty() || h.IfRange == f.ETag);
+		}
+		CHECK(ranged);
+		CHECK(sent < size + size / 4);   // drops were continued, not refetched
+		std::printf("%zu MiB in %d ranges with 2 drops: %.1f ms (%.0f MB/s), %.2fx bytes sent\n",
+			size >> 20, results[0].Segments, ms, MBps(size, ms), (double)sent / size);
+	}
+
+	// The partial file and its state survive a failed run; the next run continues it
+	void ResumeAcrossRuns(HttpStub& server, const fs::path& dir)
+	{
+		StubFile f;
+		f.Body = Bytes(3u << 20, 7);
+		f.LastModified = "Tue, 06 Oct 2026 10:00:00 GMT";
+		server.Put("/resume.bin", f);
+		server.DropAfter("/resume.bin", 1u << 20, 1);
+
+		DownloadOptions o = Fast();
+		o.MaxRetries = 0;
+		o.MaxSegments = 1;
+		{
+			DownloadManager dm(o);
+			dm.Add({ server.Url("/resume.bin"), dir / "resume.bin" });
+			CHECK(!dm.Run());
+		}
+		CHECK(fs::exists(DownloadManager::StatePath(dir / "resume.bin")));
+
+		server.ClearHits();
+		DownloadManager dm(o);
+		dm.Add({ server.Url("/resume.bin"), dir / "resume.bin" });
+		std::vector<DownloadResult> results;
+		CHECK(dm.Run(&results));
+		CHECK(ReadAll(dir / "resume.bin") == f.Body);
+		CHECK_EQ(results[0].BytesResumed, (uint64_t)(1u << 20));
+
+		const auto hits = server.Hits();
+		CHECK_EQ(hits.size(), (size_t)1);
+		CHECK(hits[0].Range.rfind("bytes=1048576-", 0) == 0);
+		CHECK(hits[0].IfRange == f.LastModified);
+	}
+
+	// Changed between runs: If-Range fails, the server sends it whole, and the
+	// old bytes are not mixed in
+	void ChangedFileStartsOver(HttpStub& server, const fs::path& dir)
+	{
+		StubFile f;
+		f.Body = Bytes(2u << 20, 11);
+		f.ETag = "\"v1\"";
+		server.Put("/changed.bin", f);
+		server.DropAfter("/changed.bin", 512u << 10, 1);
+
+		DownloadOptions o = Fast();
+		o.MaxRetries = 0;
+		o.MaxSegments = 1;
+		{
+			DownloadManager dm(o);
+			dm.Add({ server.Url("/changed.bin"), dir / "changed.bin" });
+			CHECK(!dm.Run());
+		}
+
+		f.Body = Bytes(2u << 20, 12);
+		f.ETag = "\"v2\"";
+		server.Put("/changed.bin", f);
+
+		DownloadManager dm(o);
+		dm.Add({ server.Url("/changed.bin"), dir / "changed.bin" });
+		CHECK(dm.Run());
+		CHECK(ReadAll(dir / "changed.bin") == f.Body);
+	}
+
+	// No ETag, no Last-Modified: nothing would catch a change, so never ask for a range
+	void NoValidatorNeverResumes(HttpStub& server, const fs::path& dir)
+	{
+		StubFile f;
+		f.Body = Bytes(6u << 20, 21);
+		server.Put("/plain.bin", f);
+		server.DropAfter("/plain.bin", 1u << 20, 1);
+		server.ClearHits();
+
+		DownloadOptions o = Fast();
+		o.SplitThreshold = 1u << 20;
+		{
+			DownloadManager dm(o);
+			dm.Add({ server.Url("/plain.bin"), dir / "plain.bin" });
+			std::vector<DownloadResult> results;
+			CHECK(dm.Run(&results));
+			CHECK_EQ(results[0].Segments, 1);
+		}
+		CHECK(ReadAll(dir / "plain.bin") == f.Body);
+
+		// and a failed run leaves nothing to resume from
+		server.DropAfter("/plain.bin", 1u << 20, 1);
+		o.MaxRetries = 0;
+		fs::remove(dir / "plain.bin");
+		{
+			DownloadManager dm(o);
+			dm.Add({ server.Url("/plain.bin"), dir / "plain.bin" });
+			CHECK(!dm.Run());
+		}
+		CHECK(!fs::exists(DownloadManager::StatePath(dir / "plain.bin")));
+
+		DownloadManager dm(o);
+		dm.Add({ server.Url("/plain.bin"), dir / "plain.bin" });
+		CHECK(dm.Run());
+		CHECK(ReadAll(dir / "plain.bin") == f.Body);
+
+		for (const auto& h : server.Hits())
+			CHECK(h.Range.empty());
+	}
+}
+
+int main()
+{
+	const fs::path dir = fs::temp_directory_path() / "hvk_download_manager_test";
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+
+	{
+		HttpStub server;
+		AssetBatch(server, dir, 61);   // the loading animation's frames
+		SplitWithDrops(server, dir, 16u << 20);
+		ResumeAcrossRuns(server, dir);
+		ChangedFileStartsOver(server, dir);
+		NoValidatorNeverResumes(server, dir);
+	}
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
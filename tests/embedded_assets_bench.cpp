@@ -0,0 +1,198 @@
+// Time to first frame on the embedded fallback set: what main() does before
+// its first Present when nothing has been downloaded yet (no network, fresh
+// install), next to the same frame from the loose files on disk.
+//
+//   embedded_assets_bench            20 rounds
+//   embedded_assets_bench --quick    3 rounds (what ctest runs)
+//
+// A round starts from nothing: open the embedded pack, mount it as the VFS
+// fallback under a root that doesn't exist, add the three Satoshi fonts
+// (LZ4-decoded on that first read), decode the background and the loading
+// frames the DX11 loader finds, then build and "render" one ImGui frame with
+// text in each font, so the atlas rasterizes what the frame shows. The
+// renderer backend is a stand-in; GPU upload is not part of the number.
+// Also checks the generated blob against misc/hvkpack/embedded.
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#include "asset_vfs.h"
+#include "embedded_assets.h"
+#include "imgui_headless.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const fs::path kEmbedded = fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded";
+	const char* kFonts[] = { "fonts/satoshi/Satoshi-Regular.otf", "fonts/satoshi/Satoshi-Medium.otf", "fonts/satoshi/Satoshi-Bold.otf" };
+
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	}
+
+	std::string Rel(const fs::path& path)
+	{
+		const auto s = path.lexically_relative(kEmbedded).generic_u8string();
+		return std::string(s.begin(), s.end());
+	}
+
+	bool Decode(const AssetData& data)
+	{
+		int w = 0, h = 0, n = 0;
+		stbi_uc* pixels = stbi_load_from_memory(data.Data, (int)data.Size, &w, &h, &n, 4);
+		stbi_image_free(pixels);
+		return pixels && w > 0 && h > 0;
+	}
+
+	struct FirstFrame
+	{
+		double Ms = 0.0;
+		int Fonts = 0;
+		int Frames = 0;
+		bool Background = false;
+	};
+
+	FirstFrame Run(bool embedded, const fs::path& root)
+	{
+		FirstFrame r;
+		const auto t = std::chrono::steady_clock::now();
+
+		AssetVfs::SetRoot(root);
+		AssetVfs::MountFallback(embedded ? AssetPack::OpenMemory(g_EmbeddedAssets_data, g_EmbeddedAssets_size) : nullptr);
+
+		CreateHeadlessContext();
+		ImGuiIO& io = ImGui::GetIO();
+
+		// UpdateFontSlot: the atlas reads the pack's bytes in place
+		AssetData fontData[3];
+		ImFont* fonts[3] = {};
+		for (int i = 0; i < 3; ++i)
+		{
+			if (!AssetVfs::Read(kFonts[i], fontData[i]))
+				continue;
+			ImFontConfig config;
+			config.FontDataOwnedByAtlas = false;
+			fonts[i] = io.Fonts->AddFontFromMemoryTTF((void*)fontData[i].Data, (int)fontData[i].Size, 18.0f, &config);
+			r.Fonts += fonts[i] ? 1 : 0;
+		}
+
+		AssetData bg;
+		r.Background = AssetVfs::Read("Galaxy_Purple.png", bg) && Decode(bg);
+
+		// SwapLoadingIconTheme on DX11: probe every frame, decode the ones there
+		for (int i = 1; i <= 31; ++i)
+		{
+			char name[64];
+			snprintf(name, sizeof(name), "LoadingIcon/%04d.png", i);
+			AssetData frame;
+			if (AssetVfs::Exists(name) && AssetVfs::Read(name, frame) && Decode(frame))
+				++r.Frames;
+		}
+
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0, 0));
+		ImGui::SetNextWindowSize(io.DisplaySize);
+		ImGui::Begin("PSHVK");
+		for (ImFont* font : fonts)
+		{
+			if (!font)
+				continue;
+			ImGui::PushFont(font, 0.0f);
+			ImGui::Text("PlayStation HVK Home Library Downloads Settings 0123456789");
+			ImGui::PopFont();
+		}
+		ImGui::End();
+		ImGui::Render();
+		StandInRenderer();
+
+		r.Ms = ElapsedMs(t);
+		ImGui::DestroyContext();
+		AssetVfs::MountFallback(nullptr);
+		return r;
+	}
+
+	double Median(std::vector<double> v)
+	{
+		std::sort(v.begin(), v.end());
+		return v[v.size() / 2];
+	}
+
+	// A stale embedded_assets.cpp (edited embedded/ without running build_embedded.bat)
+	void MatchesSources()
+	{
+		auto pack = AssetPack::OpenMemory(g_EmbeddedAssets_data, g_EmbeddedAssets_size);
+		CHECK(pack != nullptr);
+		if (!pack)
+			return;
+
+		size_t files = 0;
+		for (const auto& e : fs::recursive_directory_iterator(kEmbedded))
+		{
+			if (!e.is_regular_file())
+				continue;
+			++files;
+			AssetData d;
+			CHECK(pack->Read(Rel(e.path()), d));
+			CHECK(std::string((const char*)d.Data, d.Size) == ReadAll(e.path()));
+		}
+		CHECK_EQ(pack->Count(), files);
+
+		// on a fresh one: the reads above already verified their entries
+		pack = AssetPack::OpenMemory(g_EmbeddedAssets_data, g_EmbeddedAssets_size);
+		const auto t = std::chrono::steady_clock::now();
+		CHECK(pack && pack->VerifyAll());
+		std::printf("embedded pack: %zu files, %u bytes in the binary, VerifyAll %.2f ms\n",
+			pack->Count(), g_EmbeddedAssets_size, ElapsedMs(t));
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int rounds = quick ? 3 : 20;
+
+	MatchesSources();
+
+	const fs::path missing = fs::temp_directory_path() / "hvk_embedded_assets_bench" / "assets";
+	fs::remove_all(missing.parent_path());
+
+	std::vector<double> embeddedMs, diskMs;
+	for (int i = 0; i < rounds; ++i)
+	{
+		const AssetVfsStats before = AssetVfs::Stats();
+		const FirstFrame e = Run(true, missing);
+		const AssetVfsStats after = AssetVfs::Stats();
+		embeddedMs.push_back(e.Ms);
+
+		// everything the first frame needs, none of it from disk
+		CHECK_EQ(e.Fonts, 3);
+		CHECK(e.Background);
+		CHECK_EQ(e.Frames, 11);
+		CHECK_EQ(after.Disk, before.Disk);
+		CHECK_EQ(after.Missing, before.Missing);
+		CHECK_EQ(after.Fallback - before.Fallback, (uint64_t)(3 + 1 + 11));
+
+		const FirstFrame d = Run(false, kEmbedded);
+		diskMs.push_back(d.Ms);
+		CHECK_EQ(d.Fonts, 3);
+		CHECK_EQ(d.Frames, 11);
+	}
+
+	// without the fallback the same start has nothing to draw with
+	const FirstFrame none = Run(false, missing);
+	CHECK_EQ(none.Fonts, 0);
+	CHECK(!none.Background);
+
+	std::printf("first frame: embedded %.2f ms, loose files %.2f ms (median of %d; fonts, background, 11 loading frames)\n",
+		Median(embeddedMs), Median(diskMs), rounds);
+
+	return CheckResult();
+}
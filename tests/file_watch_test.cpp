@@ -0,0 +1,110 @@
+// FileWatcher, inotify backend: how long a settled write takes to be
+// reported, and that signals interrupting poll() don't end the watch.
+
+#include "file_watch.h"
+#include "check.h"
+
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <pthread.h>
+#include <thread>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	constexpr int kDebounceMs = 50;
+
+	void WriteFile(const fs::path& path, const char* text)
+	{
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+	}
+
+	// Ms from the write until Poll reports path, -1 if it doesn't within timeoutMs
+	double WaitReported(FileWatcher& watcher, const fs::path& path, std::chrono::steady_clock::time_point since, int timeoutMs)
+	{
+		std::vector<fs::path> out;
+		while (ElapsedMs(since) < timeoutMs)
+		{
+			out.clear();
+			if (watcher.Poll(out))
+			{
+				for (const auto& p : out)
+					if (p == path)
+						return ElapsedMs(since);
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return -1.0;
+	}
+
+	void ReportsSettledWrite(const fs::path& dir)
+	{
+		FileWatcher watcher;
+		CHECK(watcher.Start(dir, kDebounceMs));
+
+		const fs::path file = dir / "settings.hvk";
+		double worst = 0.0;
+		for (int i = 0; i < 5; ++i)
+		{
+			const auto t0 = std::chrono::steady_clock::now();
+			WriteFile(file, "{ \"vsync\": true }");
+			const double ms = WaitReported(watcher, file, t0, 2000);
+			CHECK(ms >= kDebounceMs);   // not before the edits settle
+			CHECK(ms >= 0.0 && ms < kDebounceMs + 250);
+			worst = ms > worst ? ms : worst;
+		}
+		std::printf("settled write reported in %.1f ms at worst (debounce %d ms)\n", worst, kDebounceMs);
+	}
+
+	void OnSignal(int) {}
+
+	// SIGUSR1 without SA_RESTART, blocked everywhere but the watcher thread, so
+	// every kill() lands in its poll() as EINTR
+	void SurvivesInterruptedPoll(const fs::path& dir)
+	{
+		struct sigaction sa = {};
+		sa.sa_handler = OnSignal;
+		sigemptyset(&sa.sa_mask);
+		sigaction(SIGUSR1, &sa, nullptr);
+
+		FileWatcher watcher;
+		CHECK(watcher.Start(dir, kDebounceMs));
+
+		sigset_t set;
+		sigemptyset(&set);
+		sigaddset(&set, SIGUSR1);
+		pthread_sigmask(SIG_BLOCK, &set, nullptr);
+
+		for (int i = 0; i < 20; ++i)
+		{
+			kill(getpid(), SIGUSR1);
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+
+		const fs::path file = dir / "user.hvk";
+		const auto t0 = std::chrono::steady_clock::now();
+		WriteFile(file, "{}");
+		CHECK(WaitReported(watcher, file, t0, 2000) >= 0.0);
+		CHECK(watcher.Running());
+
+		watcher.Stop();
+		CHECK(!watcher.Running());
+		pthread_sigmask(SIG_UNBLOCK, &set, nullptr);
+	}
+}
+
+int main()
+{
+	const fs::path dir = fs::temp_directory_path() / "hvk_file_watch_test";
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+
+	ReportsSettledWrite(dir);
+	SurvivesInterruptedPoll(dir);
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
@@ -0,0 +1,186 @@
+// HvkFontCache across process starts (user-047): a cold start with no cache
+// file rasterizes the glyphs the first frame needs and saves them; a warm
+// start loads that file and packs the stored glyphs instead. Each start runs
+// in its own forked process, since the cache and the atlas loader are
+// process-wide, and does what main() does up to the first frame: Load,
+// Install, LoadFonts, UpdateStyle (the Latin prewarm), one frame, Save.
+//
+// Checks that a warm start rasterizes nothing and ends with the same glyph
+// metrics and atlas pixels as the cold one, and that a damaged file is
+// ignored and rewritten.
+//
+//   font_cache_bench            5 cold and 5 warm starts
+//   font_cache_bench --quick    1 of each (what ctest runs)
+
+#include "hvk_style.h"
+#include "hvk_font_cache.h"
+#include "asset_vfs.h"
+#include "hash.h"
+#include "imgui_headless.h"
+#include "imgui_internal.h"
+#include "forked.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	struct StartResult
+	{
+		double FirstFrameMs = 0.0;    // Load through the end of the first frame
+		double LoadMs = 0.0;
+		uint64_t Stored = 0;
+		uint64_t Hits = 0;
+		uint64_t Misses = 0;
+		uint64_t Prewarmed = 0;
+		uint64_t Glyphs = 0;
+		uint64_t MetricsDigest = 0;
+		uint64_t PixelsDigest = 0;
+		bool Saved = false;
+	};
+
+	void DrawUi(const UserStyle& user)
+	{
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0, 0));
+		ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+		ImGui::Begin("PSHVK", nullptr, ImGuiWindowFlags_NoDecoration);
+		for (ImFont* font : { user.satoshi_regular, user.satoshi_medium, user.satoshi_bold })
+		{
+			ImGui::PushFont(font, 0.0f);
+			ImGui::Text("PSHVK  Home  Library  Downloads  Settings  About");
+			ImGui::Button("Format drive");
+			ImGui::PopFont();
+		}
+		ImGui::End();
+		ImGui::Render();
+		StandInRenderer();
+	}
+
+	// Every glyph baked so far, and the atlas texture they were packed into
+	void Digest(StartResult& r)
+	{
+		uint64_t h = 0;
+		ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+		for (ImFont* font : atlas->Fonts)
+		{
+			ImFontBaked* baked = font->GetFontBaked(13.0f);
+			for (const ImFontGlyph& g : baked->Glyphs)
+			{
+				const float m[] = { (float)g.Codepoint, (float)g.Visible, g.AdvanceX, g.X0, g.Y0, g.X1, g.Y1, g.U0, g.V0, g.U1, g.V1 };
+				h = HashService::Fast64(m, sizeof(m), h);
+				++r.Glyphs;
+			}
+		}
+		r.MetricsDigest = h;
+
+		ImTextureData* tex = atlas->TexData;
+		r.PixelsDigest = HashService::Fast64(tex->GetPixels(), (size_t)tex->GetSizeInBytes());
+	}
+
+	StartResult Start(const fs::path& cachePath)
+	{
+		StartResult r;
+		const auto t = std::chrono::steady_clock::now();
+
+		HvkFontCache::Load(cachePath);
+		CreateHeadlessContext();
+		HvkFontCache::Install(ImGui::GetIO().Fonts);
+
+		UserStyle user;
+		user.dpi_scale = 1.0f;
+		user.ui_scale = 1.0f;
+		ImGui::LoadFonts(user);
+		++user.generation;
+		ImGui::UpdateStyle(user, ImGui::GetStyle());
+		DrawUi(user);
+
+		r.FirstFrameMs = ElapsedMs(t);
+		Digest(r);   // first: it can bake a size some font hasn't drawn at yet
+
+		const FontCacheStats s = HvkFontCache::Stats();
+		r.LoadMs = s.LoadMs;
+		r.Stored = s.Stored;
+		r.Hits = s.Hits;
+		r.Misses = s.Misses;
+		r.Prewarmed = s.Prewarmed;
+		r.Saved = HvkFontCache::Save();
+
+		ImGui::DestroyContext();
+		return r;
+	}
+
+	// A fresh process per start: nothing cached in memory carries over
+	StartResult StartInChild(const fs::path& cachePath)
+	{
+		StartResult r;
+		CHECK(RunForked([&] { return Start(cachePath); }, r));
+		return r;
+	}
+
+	double Median(std::vector<double> v)
+	{
+		std::sort(v.begin(), v.end());
+		return v[v.size() / 2];
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int runs = quick ? 1 : 5;
+
+	AssetVfs::SetRoot(fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded");
+	const fs::path dir = fs::temp_directory_path() / "hvk_font_cache_bench";
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+	const fs::path cachePath = dir / "fontcache.bin";
+
+	std::vector<double> coldMs, warmMs;
+	StartResult cold, warm;
+	for (int i = 0; i < runs; ++i)
+	{
+		fs::remove(cachePath);
+		cold = StartInChild(cachePath);
+		coldMs.push_back(cold.FirstFrameMs);
+
+		CHECK(cold.Saved && fs::exists(cachePath));
+		CHECK(cold.Stored == 0 && cold.Hits == 0 && cold.Misses > 0 && cold.Prewarmed > 0);
+	}
+
+	const uint64_t fileSize = fs::file_size(cachePath);
+	for (int i = 0; i < runs; ++i)
+	{
+		warm = StartInChild(cachePath);
+		warmMs.push_back(warm.FirstFrameMs);
+
+		CHECK_EQ(warm.Misses, (uint64_t)0);
+		CHECK_EQ(warm.Prewarmed, (uint64_t)0);
+		CHECK_EQ(warm.Stored, cold.Misses);
+		CHECK_EQ(warm.Hits, cold.Misses);
+		CHECK_EQ(warm.Glyphs, cold.Glyphs);
+		CHECK_EQ(warm.MetricsDigest, cold.MetricsDigest);
+		CHECK_EQ(warm.PixelsDigest, cold.PixelsDigest);
+	}
+	// nothing new was rasterized, so a warm start leaves the file alone
+	CHECK_EQ(fs::file_size(cachePath), fileSize);
+
+	// a damaged file is dropped: a cold start again, with the same result
+	fs::resize_file(cachePath, fileSize - 100);
+	const StartResult damaged = StartInChild(cachePath);
+	CHECK(damaged.Stored == 0 && damaged.Hits == 0);
+	CHECK_EQ(damaged.Misses, cold.Misses);
+	CHECK_EQ(damaged.PixelsDigest, cold.PixelsDigest);
+	CHECK_EQ(fs::file_size(cachePath), fileSize);
+
+	std::printf("cold start: %.2f ms to the first frame, %llu glyphs rasterized (%llu of them by the prewarm), cache file %llu bytes\n",
+		Median(coldMs), (unsigned long long)cold.Misses, (unsigned long long)cold.Prewarmed, (unsigned long long)fileSize);
+	std::printf("warm start: %.2f ms to the first frame (%.2f ms of it Load), %llu glyphs from the cache\n",
+		Median(warmMs), warm.LoadMs, (unsigned long long)warm.Hits);
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
@@ -0,0 +1,229 @@
+// A UI scale change on the dynamic atlas (user-046) next to the rebuild it
+// replaced, headless: time from the change to the end of the next frame,
+// and the texture traffic it causes.
+//
+//   new:  ++generation, UpdateStyle (ScaleAllSizes, FontScaleMain, Latin
+//         prewarm per font), then the frame bakes whatever else it draws
+//   old:  io.Fonts->Clear(), the font files read and added again at the new
+//         size, every glyph of the default ranges baked (what Build() did),
+//         then the frame; the atlas texture is recreated and sent whole
+//
+// The old path also recreated the backend's device objects after a GPU
+// wait, which has no headless equivalent and is not in its number.
+//
+// The dynamic atlas keeps every size it baked, so the first visit to a
+// scale can grow the texture past what a rebuild sends; going back to a
+// scale it has seen (the settings slider dragged back and forth) sends
+// nothing, unless a repack on growth dropped that size as unused (the 1.00
+// row of the first round). Both are reported; the checks hold the second.
+//
+//   font_scale_bench            5 rounds over 4 scales
+//   font_scale_bench --quick    2 rounds (what ctest runs)
+
+#include "hvk_style.h"
+#include "hvk_font_cache.h"
+#include "asset_vfs.h"
+#include "imgui_headless.h"
+#include "imgui_internal.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const float kScales[] = { 1.25f, 1.5f, 2.0f, 1.0f };
+	const char* kFonts[] = { "fonts/satoshi/Satoshi-Regular.otf", "fonts/satoshi/Satoshi-Medium.otf", "fonts/satoshi/Satoshi-Bold.otf" };
+
+	struct Change
+	{
+		double Ms = 0.0;
+		int Created = 0;
+		int64_t Pixels = 0;
+	};
+
+	void DrawUi(const std::vector<ImFont*>& fonts)
+	{
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0, 0));
+		ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+		ImGui::Begin("PSHVK", nullptr, ImGuiWindowFlags_NoDecoration);
+		for (ImFont* font : fonts)
+		{
+			ImGui::PushFont(font, 0.0f);
+			ImGui::Text("Home  Library  Downloads  Settings  About");
+			ImGui::Button("Format drive");
+			ImGui::PopFont();
+		}
+		ImGui::End();
+		ImGui::Render();
+		StandInRenderer();
+	}
+
+	template <class Fn>
+	Change Measure(Fn&& fn)
+	{
+		const HeadlessUploads before = g_HeadlessUploads;
+		const auto t = std::chrono::steady_clock::now();
+		fn();
+		Change c;
+		c.Ms = ElapsedMs(t);
+		c.Created = g_HeadlessUploads.Created - before.Created;
+		c.Pixels = g_HeadlessUploads.UpdatedPixels - before.UpdatedPixels;
+		return c;
+	}
+
+	// A new texture is sent whole, not as update rects
+	int64_t TexturePixels()
+	{
+		ImTextureData* tex = ImGui::GetIO().Fonts->TexData;
+		return tex ? (int64_t)tex->Width * tex->Height : 0;
+	}
+
+	struct Dynamic
+	{
+		std::vector<Change> First;     // per scale, first visit
+		std::vector<Change> Again;     // every later visit
+	};
+
+	Dynamic DynamicPath(int rounds)
+	{
+		CreateHeadlessContext();
+		HvkFontCache::Install(ImGui::GetIO().Fonts);
+
+		UserStyle user;
+		user.dpi_scale = 1.0f;
+		user.ui_scale = 1.0f;
+		ImGui::LoadFonts(user);
+		++user.generation;   // as the settings load does, so the starting size is prewarmed too
+		ImGui::UpdateStyle(user, ImGui::GetStyle());
+
+		const std::vector<ImFont*> fonts = { user.satoshi_regular, user.satoshi_medium, user.satoshi_bold };
+		DrawUi(fonts);
+
+		Dynamic out;
+		for (int r = 0; r < rounds; ++r)
+		{
+			for (float scale : kScales)
+			{
+				Change c = Measure([&]
+					{
+						user.ui_scale = scale;
+						++user.generation;
+						ImGui::UpdateStyle(user, ImGui::GetStyle());
+						DrawUi(fonts);
+					});
+				if (c.Created)
+					c.Pixels += TexturePixels();
+				(r == 0 ? out.First : out.Again).push_back(c);
+			}
+		}
+
+		// the fonts were never replaced, so nothing holding an ImFont* went stale
+		CHECK(user.satoshi_regular == fonts[0] && user.satoshi_medium == fonts[1] && user.satoshi_bold == fonts[2]);
+		CHECK(ImGui::GetIO().Fonts->Fonts.Size == 4);   // three Satoshi + ImGui's default for the missing Proggy
+		CHECK_EQ(ImGui::GetStyle().FontScaleMain, 1.0f);
+
+		ImGui::DestroyContext();
+		return out;
+	}
+
+	std::vector<Change> RebuildPath()
+	{
+		CreateHeadlessContext();
+		ImGuiIO& io = ImGui::GetIO();
+
+		std::vector<AssetData> data(3);
+		std::vector<ImFont*> fonts;
+		auto rebuild = [&](float scale)
+			{
+				io.Fonts->Clear();
+				fonts.clear();
+
+				const float size = 13.0f * scale;
+				for (int i = 0; i < 3; ++i)
+				{
+					CHECK(AssetVfs::Read(kFonts[i], data[i]));
+					ImFontConfig config;
+					config.FontDataOwnedByAtlas = false;
+					fonts.push_back(io.Fonts->AddFontFromMemoryTTF((void*)data[i].Data, (int)data[i].Size, size, &config));
+				}
+				ImFontConfig config;
+				config.SizePixels = size;
+				io.Fonts->AddFontDefault(&config);
+
+				for (ImFont* font : io.Fonts->Fonts)
+				{
+					ImFontBaked* baked = font->GetFontBaked(font->LegacySize);
+					for (const ImWchar* r = io.Fonts->GetGlyphRangesDefault(); r[0]; r += 2)
+						for (unsigned c = r[0]; c <= r[1]; ++c)
+							baked->FindGlyph((ImWchar)c);
+				}
+				io.FontDefault = fonts[0];
+			};
+
+		rebuild(1.0f);
+		DrawUi(fonts);
+
+		std::vector<Change> out;
+		for (float scale : kScales)
+		{
+			Change c = Measure([&]
+				{
+					rebuild(scale);
+					DrawUi(fonts);
+				});
+			if (c.Created)
+				c.Pixels += TexturePixels();
+			out.push_back(c);
+		}
+
+		ImGui::DestroyContext();
+		return out;
+	}
+
+	double MedianMs(std::vector<Change> v)
+	{
+		std::sort(v.begin(), v.end(), [](const Change& a, const Change& b) { return a.Ms < b.Ms; });
+		return v[v.size() / 2].Ms;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+
+	AssetVfs::SetRoot(fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded");
+
+	const Dynamic dynamic = DynamicPath(quick ? 2 : 5);
+	const std::vector<Change> rebuild = RebuildPath();
+
+	for (size_t i = 0; i < rebuild.size(); ++i)
+	{
+		const Change& d = dynamic.First[i];
+		std::printf("ui_scale %.2f, first round: dynamic %6.2f ms, %7lld px sent, %d new textures | rebuild %6.2f ms, %7lld px sent, %d new textures\n",
+			kScales[i], d.Ms, (long long)d.Pixels, d.Created, rebuild[i].Ms, (long long)rebuild[i].Pixels, rebuild[i].Created);
+
+		// the rebuild starts the texture over every time
+		CHECK(rebuild[i].Created >= 1);
+	}
+
+	int64_t againPixels = 0;
+	int againCreated = 0;
+	for (const Change& c : dynamic.Again)
+	{
+		againPixels += c.Pixels;
+		againCreated += c.Created;
+	}
+	CHECK(!dynamic.Again.empty());
+	CHECK_EQ(againPixels, (int64_t)0);
+	CHECK_EQ(againCreated, 0);
+	CHECK(MedianMs(dynamic.Again) < MedianMs(rebuild));
+
+	std::printf("median scale change: rebuild %.2f ms, dynamic first visit %.2f ms, dynamic revisit %.3f ms (%zu revisits, 0 px sent)\n",
+		MedianMs(rebuild), MedianMs(dynamic.First), MedianMs(dynamic.Again), dynamic.Again.size());
+
+	return CheckResult();
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdio>
+#include <type_traits>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Runs fn in a forked child and hands its result back through a pipe, for
+// the benchmarks that need a fresh process per run (process-wide caches,
+// the atlas font loader). T has to be trivially copyable. The child's
+// stdout goes to /dev/null.
+
+template <class T, class Fn>
+bool RunForked(Fn&& fn, T& out)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "sent as bytes");
+
+	int fds[2];
+	if (pipe(fds) != 0)
+		return false;
+
+	std::fflush(stdout);   // or the child flushes the parent's pending output a second time
+	const pid_t pid = fork();
+	if (pid < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		return false;
+	}
+	if (pid == 0)
+	{
+		close(fds[0]);
+		std::freopen("/dev/null", "w", stdout);
+		const T result = fn();
+		const bool ok = write(fds[1], &result, sizeof(result)) == (ssize_t)sizeof(result);
+		_exit(ok ? 0 : 1);
+	}
+
+	close(fds[1]);
+	const bool got = read(fds[0], &out, sizeof(out)) == (ssize_t)sizeof(out);
+	close(fds[0]);
+	int status = 0;
+	waitpid(pid, &status, 0);
+	return got && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
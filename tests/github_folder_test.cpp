@@ -0,0 +1,173 @@
+// GithubFolder (the contents API fallback of HVKIO::DownloadPSHVKAssets)
+// against tests/http_stub.h standing in for api.github.com and
+// raw.githubusercontent.com: the result must say whether the whole tree
+// arrived, not just that the fallback ran.
+
+#include "github_folder.h"
+#include "http_stub.h"
+#include "check.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const char* kApi = "/repos/hav0kdotsys/PSHVK/contents/assets";
+
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::stringstream ss;
+		ss << in.rdbuf();
+		return ss.str();
+	}
+
+	std::string Entry(HttpStub& server, const std::string& name, const std::string& type, const std::string& path)
+	{
+		const std::string download = type == "file" ? "\"" + server.Url("/raw/" + path) + "\"" : "null";
+		const std::string url = server.Url(std::string(kApi) + path.substr(6) + "?ref=HEAD");
+		return "{ \"name\": \"" + name + "\", \"path\": \"" + path + "\", \"sha\": \"0f1e\", \"size\": 10, "
+			"\"url\": \"" + url + "\", \"download_url\": " + download + ", \"type\": \"" + type + "\", "
+			"\"_links\": { \"self\": \"" + url + "\" } }";
+	}
+
+	void PutListing(HttpStub& server, const std::string& path, const std::vector<std::string>& entries)
+	{
+		std::string body = "[";
+		for (size_t i = 0; i < entries.size(); ++i)
+			body += (i ? ", " : "") + entries[i];
+		body += "]";
+
+		StubFile f;
+		f.Body = body;
+		f.ContentType = "application/json";
+		server.Put(path, f);
+	}
+
+	void PutRaw(HttpStub& server, const std::string& path, const std::string& body)
+	{
+		StubFile f;
+		f.Body = body;
+		f.ETag = "\"" + path + "\"";
+		server.Put("/raw/" + path, f);
+	}
+
+	// assets/logo.png, assets/fonts/satoshi.otf, and a symlink that is skipped
+	void PutTree(HttpStub& server)
+	{
+		PutListing(server, kApi, {
+			Entry(server, "logo.png", "file", "assets/logo.png"),
+			Entry(server, "fonts", "dir", "assets/fonts"),
+			Entry(server, "latest", "symlink", "assets/latest"),
+		});
+		PutListing(server, std::string(kApi) + "/fonts", {
+			Entry(server, "satoshi.otf", "file", "assets/fonts/satoshi.otf"),
+		});
+		PutRaw(server, "assets/logo.png", "png bytes");
+		PutRaw(server, "assets/fonts/satoshi.otf", "otf bytes");
+	}
+
+	DownloadOptions Fast()
+	{
+		DownloadOptions o;
+		o.MaxRetries = 1;
+		o.BackoffMs = 10;
+		return o;
+	}
+
+	void WholeTree(HttpStub& server, const fs::path& dir)
+	{
+		PutTree(server);
+
+		GithubFolderReport report;
+		CHECK(GithubFolder::Download(server.Url(kApi), dir, Fast(), report));
+		CHECK_EQ(report.Files, 2u);
+		CHECK_EQ(report.Fetched, 2u);
+		CHECK(report.Errors.empty());
+		CHECK(ReadAll(dir / "logo.png") == "png bytes");
+		CHECK(ReadAll(dir / "fonts" / "satoshi.otf") == "otf bytes");
+		CHECK(!fs::exists(dir / "latest"));
+	}
+
+	void MissingFileFails(HttpStub& server, const fs::path& dir)
+	{
+		PutTree(server);
+		PutListing(server, kApi, {
+			Entry(server, "logo.png", "file", "assets/logo.png"),
+			Entry(server, "gone.png", "file", "assets/gone.png"),   // 404 on the raw host
+		});
+
+		GithubFolderReport report;
+		CHECK(!GithubFolder::Download(server.Url(kApi), dir, Fast(), report));
+		CHECK_EQ(report.Files, 2u);
+		CHECK_EQ(report.Fetched, 1u);
+		CHECK_EQ(report.Errors.size(), (size_t)1);
+	}
+
+	// a subfolder whose listing fails is a partial tree, even if every listed file arrived
+	void FailedSubListingFails(HttpStub& server, const fs::path& dir)
+	{
+		PutTree(server);
+		PutListing(server, kApi, {
+			Entry(server, "logo.png", "file", "assets/logo.png"),
+			Entry(server, "missing", "dir", "assets/missing"),
+		});
+
+		GithubFolderReport report;
+		CHECK(!GithubFolder::Download(server.Url(kApi), dir, Fast(), report));
+		CHECK_EQ(report.Fetched, 1u);
+	}
+
+	void ErrorResponseFails(HttpStub& server, const fs::path& dir)
+	{
+		GithubFolderReport report;
+		CHECK(!GithubFolder::Download(server.Url("/repos/nobody/none/contents/assets"), dir, Fast(), report));
+		CHECK_EQ(report.Files, 0u);
+		CHECK(!report.Errors.empty());
+
+		PutListing(server, "/repos/empty/contents/assets", {});
+		CHECK(!GithubFolder::Download(server.Url("/repos/empty/contents/assets"), dir, Fast(), report));
+	}
+
+	void NamesStayInTheFolder(HttpStub& server, const fs::path& dir)
+	{
+		PutTree(server);
+		PutListing(server, kApi, {
+			Entry(server, "logo.png", "file", "assets/logo.png"),
+			Entry(server, "..", "dir", "assets/fonts"),
+		});
+
+		std::vector<DownloadItem> items;
+		std::vector<std::string> errors;
+		CHECK(!GithubFolder::List(server.Url(kApi), dir, items, &errors));
+		CHECK_EQ(items.size(), (size_t)1);
+		CHECK_EQ(errors.size(), (size_t)1);
+
+		// the other files still arrive, but the tree is incomplete
+		GithubFolderReport report;
+		CHECK(!GithubFolder::Download(server.Url(kApi), dir, Fast(), report));
+		CHECK_EQ(report.Fetched, 1u);
+		CHECK_EQ(report.Errors.size(), (size_t)1);
+		CHECK(!fs::exists(dir.parent_path() / "fonts"));
+	}
+}
+
+int main()
+{
+	const fs::path dir = fs::temp_directory_path() / "hvk_github_folder_test";
+	fs::remove_all(dir);
+
+	{
+		HttpStub server;
+		WholeTree(server, dir / "whole");
+		MissingFileFails(server, dir / "missing");
+		FailedSubListingFails(server, dir / "sub");
+		ErrorResponseFails(server, dir / "error");
+		NamesStayInTheFolder(server, dir / "names");
+	}
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
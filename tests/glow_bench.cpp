@@ -0,0 +1,213 @@
+// HvkGlowCache (user-050) against the layered fan-out GlowText drew before,
+// in a headless frame: eight glowing tab labels and title, vertices, indices
+// and draw commands per frame, and the CPU time to build them. Then a run of
+// unique labels past kBudgetBytes, which has to evict pages without going
+// over budget or failing a draw, and the cases the sprite key tells apart.
+//
+//   glow_bench            120 frames, 200 frames of churn
+//   glow_bench --quick    30 frames, 100 frames of churn (what ctest runs)
+//
+// hvk_gui.cpp includes the Windows settings, so the fan-out is copied here
+// from its AddGlowLayers.
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+
+#include "hvk_glow_cache.h"
+#include "imgui_headless.h"
+#include "imgui_internal.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	const char* kLabels[] = { "PSHVK", "Home", "Library", "Downloads", "Settings", "About", "Updates", "Profile" };
+	const ImU32 kGlowColor = IM_COL32(80, 160, 255, 255);
+
+	// HvkGui's AddGlowLayers: 12 layers of 12 offset copies
+	void AddGlowLayers(ImDrawList* drawList, ImFont* font, float fontSize, const ImVec2& pos, const char* text,
+		ImU32 glowColor, float glowSize, float glowIntensity)
+	{
+		const int glowLayers = 12;
+		const float layerStep = glowSize / (float)glowLayers;
+		for (int layer = glowLayers; layer >= 1; layer--)
+		{
+			const float currentSize = layerStep * (float)layer;
+			const float alpha = (1.0f - ((float)layer / (float)glowLayers)) * glowIntensity;
+			const ImU32 layerColor = (glowColor & 0x00FFFFFF) | ((ImU32)(alpha * 255.0f) << 24);
+
+			for (int dir = 0; dir < 8; dir++)
+			{
+				const float angle = (float)dir * (IM_PI * 2.0f / 8.0f);
+				drawList->AddText(font, fontSize, ImVec2(pos.x + cosf(angle) * currentSize, pos.y + sinf(angle) * currentSize), layerColor, text);
+			}
+			for (int dir = 0; dir < 4; dir++)
+			{
+				const float angle = (float)dir * (IM_PI * 2.0f / 4.0f) + (IM_PI / 4.0f);
+				drawList->AddText(font, fontSize, ImVec2(pos.x + cosf(angle) * currentSize * 0.7f, pos.y + sinf(angle) * currentSize * 0.7f), layerColor, text);
+			}
+		}
+	}
+
+	struct FrameCost
+	{
+		int Vertices = 0;
+		int Indices = 0;
+		int Commands = 0;
+		double BuildUs = 0.0;       // per frame, the labels only
+	};
+
+	FrameCost RunFrames(ImFont* font, int frames, bool cached)
+	{
+		FrameCost cost;
+		double buildMs = 0.0;
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			ImGui::NewFrame();
+			ImGui::SetNextWindowPos(ImVec2(0, 0));
+			ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+			ImGui::Begin("bench", nullptr, ImGuiWindowFlags_NoDecoration);
+			ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+			const auto t = std::chrono::steady_clock::now();
+			for (int i = 0; i < 8; ++i)
+			{
+				const ImVec2 pos(20.0f + i * 150.0f, 40.0f);
+				const float size = i == 0 ? 32.0f : 18.0f;
+				if (cached)
+					CHECK(HvkGlowCache::AddGlow(drawList, font, size, pos, kLabels[i], nullptr, kGlowColor, 8.0f, 0.8f));
+				else
+					AddGlowLayers(drawList, font, size, pos, kLabels[i], kGlowColor, 8.0f, 0.8f);
+				drawList->AddText(font, size, pos, IM_COL32_WHITE, kLabels[i]);
+			}
+			buildMs += ElapsedMs(t);
+
+			ImGui::End();
+			ImGui::Render();
+			StandInRenderer();
+		}
+
+		// the last frame, with everything baked and cached
+		const ImDrawData* dd = ImGui::GetDrawData();
+		cost.Vertices = dd->TotalVtxCount;
+		cost.Indices = dd->TotalIdxCount;
+		for (const ImDrawList* list : dd->CmdLists)
+			cost.Commands += list->CmdBuffer.Size;
+		cost.BuildUs = buildMs * 1e3 / frames;
+		return cost;
+	}
+
+	void Frame(const std::function<void(ImDrawList*)>& draw)
+	{
+		ImGui::NewFrame();
+		ImGui::Begin("bench");
+		draw(ImGui::GetWindowDrawList());
+		ImGui::End();
+		ImGui::Render();
+		StandInRenderer();
+	}
+
+	// Font, size, glow size and text each get their own sprite; color and intensity don't
+	void KeysApart(ImFont* font, ImFont* other)
+	{
+		const GlowCacheStats before = HvkGlowCache::Stats();
+		Frame([&](ImDrawList* dl)
+			{
+				HvkGlowCache::AddGlow(dl, font, 20.0f, ImVec2(0, 0), "Settings", nullptr, kGlowColor, 6.0f, 1.0f);
+				HvkGlowCache::AddGlow(dl, other, 20.0f, ImVec2(0, 0), "Settings", nullptr, kGlowColor, 6.0f, 1.0f);
+				HvkGlowCache::AddGlow(dl, font, 21.0f, ImVec2(0, 0), "Settings", nullptr, kGlowColor, 6.0f, 1.0f);
+				HvkGlowCache::AddGlow(dl, font, 20.0f, ImVec2(0, 0), "Settings", nullptr, kGlowColor, 7.0f, 1.0f);
+				HvkGlowCache::AddGlow(dl, font, 20.0f, ImVec2(0, 0), "Settings!", "Settings!" + 8, kGlowColor, 6.0f, 1.0f);   // "Settings" again
+				HvkGlowCache::AddGlow(dl, font, 20.0f, ImVec2(0, 0), "Settings", nullptr, IM_COL32(255, 0, 0, 255), 6.0f, 0.3f);
+			});
+		const GlowCacheStats after = HvkGlowCache::Stats();
+		CHECK_EQ(after.Misses - before.Misses, (uint64_t)4);
+		CHECK_EQ(after.Hits - before.Hits, (uint64_t)2);
+	}
+
+	// Unique labels every frame, 20 a frame, well past the budget
+	void Churn(ImFont* font, int frames)
+	{
+		const GlowCacheStats before = HvkGlowCache::Stats();
+		size_t maxBytes = 0;
+		int failed = 0;
+		for (int frame = 0; frame < frames; ++frame)
+		{
+			Frame([&](ImDrawList* dl)
+				{
+					// one label stays on screen the whole time: its page is in use every frame
+					if (!HvkGlowCache::AddGlow(dl, font, 32.0f, ImVec2(0, 0), "PSHVK", nullptr, kGlowColor, 12.0f, 0.3f))
+						++failed;
+					for (int i = 0; i < 20; ++i)
+					{
+						char label[32];
+						std::snprintf(label, sizeof(label), "label %d-%d", frame, i);
+						if (!HvkGlowCache::AddGlow(dl, font, 24.0f, ImVec2(10, 10), label, nullptr, IM_COL32_WHITE, 10.0f, 1.0f))
+							++failed;
+					}
+				});
+			maxBytes = std::max(maxBytes, HvkGlowCache::Stats().Bytes);
+		}
+
+		const GlowCacheStats after = HvkGlowCache::Stats();
+		std::printf("churn: %d unique labels over %d frames, %llu evicted, %llu left, at most %zu of %zu bytes of pages\n",
+			frames * 20, frames, (unsigned long long)(after.Evicted - before.Evicted), (unsigned long long)after.Sprites,
+			maxBytes, HvkGlowCache::kBudgetBytes);
+		CHECK_EQ(failed, 0);
+		CHECK(maxBytes <= HvkGlowCache::kBudgetBytes);
+		CHECK(after.Evicted > before.Evicted);
+		// the long-lived label was rendered at most once: eviction never took its page
+		CHECK(after.Misses - before.Misses <= (uint64_t)frames * 20 + 1);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int frames = quick ? 30 : 120;
+
+	std::ifstream in(fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded" / "fonts" / "satoshi" / "Satoshi-Bold.otf", std::ios::binary);
+	std::vector<unsigned char> data{ std::istreambuf_iterator<char>(in), {} };
+	CHECK(!data.empty());
+	if (data.empty())
+		return CheckResult();
+
+	CreateHeadlessContext();
+	ImFontConfig config;
+	config.FontDataOwnedByAtlas = false;
+	ImFont* font = ImGui::GetIO().Fonts->AddFontFromMemoryTTF(data.data(), (int)data.size(), 18.0f, &config);
+	ImFont* other = ImGui::GetIO().Fonts->AddFontDefault();
+
+	const FrameCost fanout = RunFrames(font, frames, false);
+	const GlowCacheStats before = HvkGlowCache::Stats();
+	const FrameCost cached = RunFrames(font, frames, true);
+	const GlowCacheStats stats = HvkGlowCache::Stats();
+
+	std::printf("fan-out: %6d vertices, %6d indices, %2d draw commands a frame, %7.1f us building 8 labels\n",
+		fanout.Vertices, fanout.Indices, fanout.Commands, fanout.BuildUs);
+	std::printf("cached:  %6d vertices, %6d indices, %2d draw commands a frame, %7.1f us building 8 labels\n",
+		cached.Vertices, cached.Indices, cached.Commands, cached.BuildUs);
+	std::printf("sprites rendered %llu, hits %llu, %zu bytes of pages\n",
+		(unsigned long long)(stats.Misses - before.Misses), (unsigned long long)(stats.Hits - before.Hits), stats.Bytes);
+
+	// each label rendered once, drawn from the cache after that
+	CHECK_EQ(stats.Misses - before.Misses, (uint64_t)8);
+	CHECK_EQ(stats.Hits - before.Hits, (uint64_t)(frames * 8 - 8));
+	CHECK(cached.Vertices * 20 < fanout.Vertices);
+	CHECK(cached.Indices * 20 < fanout.Indices);
+
+	KeysApart(font, other);
+	Churn(font, quick ? 100 : 200);
+
+	HvkGlowCache::Shutdown();
+	ImGui::DestroyContext();
+	return CheckResult();
+}
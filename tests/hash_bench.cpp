@@ -0,0 +1,178 @@
+// HashService: known-answer checks, then throughput in GB/s.
+//
+//   hash_bench            512 MiB in memory, 1 GiB file, 2048 small files
+//   hash_bench --quick    16 MiB / 64 MiB / 256 files (what ctest runs)
+//
+// The file pass reads a file that was just written, so it measures the page
+// cache and the hashing, not the disk.
+
+#include "hash.h"
+#include "check.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::string Hex(const Sha256Digest& d) { return d.Hex(); }
+
+	void KnownAnswers()
+	{
+		CHECK_EQ(Hex(Sha256::Hash("", 0)), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+		CHECK_EQ(Hex(Sha256::Hash("abc", 3)), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+		// a million 'a's, fed in uneven pieces to cross block boundaries
+		std::string a(1000000, 'a');
+		Sha256 h;
+		for (size_t off = 0, step = 1; off < a.size(); off += step, step = step * 3 % 997 + 1)
+			h.Update(a.data() + off, std::min(step, a.size() - off));
+		CHECK_EQ(Hex(h.Final()), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+		CHECK_EQ(HashService::Fast64("", 0), 0xEF46DB3751D8E999ull);
+		CHECK_EQ(HashService::Fast64("abc", 3), 0x44BC2CF5AD770999ull);
+
+		uint8_t data[1000];
+		for (int i = 0; i < 1000; ++i)
+			data[i] = (uint8_t)(i * 7 + 3);
+		CHECK_EQ(HashService::Fast64(data, sizeof(data), 1234), 0x0B8E3B6401A1292Full);
+	}
+
+	double GBps(uint64_t bytes, double ms) { return ms > 0 ? bytes / ms / 1e6 : 0.0; }
+
+	void MemoryThroughput(size_t size)
+	{
+		std::vector<uint8_t> buf(size);
+		for (size_t i = 0; i < size; ++i)
+			buf[i] = (uint8_t)(i * 2654435761u >> 13);
+
+		auto t = std::chrono::steady_clock::now();
+		volatile uint64_t sink = HashService::Fast64(buf.data(), buf.size());
+		const double fastMs = ElapsedMs(t);
+
+		t = std::chrono::steady_clock::now();
+		Sha256Digest d = Sha256::Hash(buf.data(), buf.size());
+		const double shaMs = ElapsedMs(t);
+		sink = sink + d.Bytes[0];
+
+		std::printf("memory %zu MiB: Fast64 %.2f GB/s, SHA-256 %.2f GB/s (%s)\n",
+			size >> 20, GBps(size, fastMs), GBps(size, shaMs), HashService::HasShaNi() ? "SHA-NI" : "scalar");
+	}
+
+	void FileThroughput(uint64_t size)
+	{
+		const auto path = std::filesystem::temp_directory_path() / "hvk_hash_bench.bin";
+
+		std::vector<uint8_t> all((size_t)size);
+		for (size_t i = 0; i < all.size(); ++i)
+			all[i] = (uint8_t)(i * 40503u >> 7);
+		{
+			std::ofstream f(path, std::ios::binary);
+			f.write((const char*)all.data(), (std::streamsize)all.size());
+		}
+
+		// the file digests must match their definitions
+		FileDigest sha, tree1, treeN;
+		auto t = std::chrono::steady_clock::now();
+		CHECK(HashService::HashFile(path, HashKind::Sha256, sha));
+		const double shaMs = ElapsedMs(t);
+		CHECK(sha.Sha == Sha256::Hash(all.data(), all.size()));
+
+		t = std::chrono::steady_clock::now();
+		CHECK(HashService::HashFile(path, HashKind::Fast64, tree1, 1));
+		const double oneMs = ElapsedMs(t);
+
+		t = std::chrono::steady_clock::now();
+		CHECK(HashService::HashFile(path, HashKind::Fast64, treeN));
+		const double allMs = ElapsedMs(t);
+
+		std::vector<uint64_t> leaves;
+		for (uint64_t off = 0, i = 0; off < size; off += HashService::kChunkSize, ++i)
+			leaves.push_back(HashService::Fast64(all.data() + off, (size_t)std::min<uint64_t>(HashService::kChunkSize, size - off), i));
+		const uint64_t tree = HashService::Fast64(leaves.data(), leaves.size() * sizeof(uint64_t), size);
+		CHECK_EQ(tree1.Fast, tree);
+		CHECK_EQ(treeN.Fast, tree);
+
+		std::printf("file %llu MiB (cached): SHA-256 %.2f GB/s, Fast64 tree %.2f GB/s on 1 thread, %.2f GB/s on %d\n",
+			(unsigned long long)(size >> 20), GBps(size, shaMs), GBps(size, oneMs), GBps(size, allMs), HashService::DefaultThreads());
+
+		std::filesystem::remove(path);
+	}
+
+	// HashFiles over many small files: digests match HashFile, throughput vs one thread
+	void ManyFiles(int count)
+	{
+		const auto dir = std::filesystem::temp_directory_path() / "hvk_hash_bench_files";
+		std::filesystem::remove_all(dir);
+		std::filesystem::create_directories(dir);
+
+		std::vector<std::filesystem::path> paths;
+		uint64_t total = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			std::string body((size_t)(1024 + (i * 7919) % (96 << 10)), '\0');
+			for (size_t k = 0; k < body.size(); ++k)
+				body[k] = (char)(k * 31 + i);
+
+			paths.push_back(dir / ("f" + std::to_string(i) + ".bin"));
+			std::ofstream(paths.back(), std::ios::binary).write(body.data(), (std::streamsize)body.size());
+			total += body.size();
+		}
+
+		const std::string hello = "hello\n";
+		paths.push_back(dir / "hello.txt");
+		std::ofstream(paths.back(), std::ios::binary).write(hello.data(), (std::streamsize)hello.size());
+		paths.push_back(dir / "empty.txt");
+		std::ofstream(paths.back(), std::ios::binary);
+		paths.push_back(dir / "missing.bin");
+
+		auto t = std::chrono::steady_clock::now();
+		const std::vector<FileDigest> one = HashService::HashFiles(paths, HashKind::GitBlob, 1);
+		const double oneMs = ElapsedMs(t);
+
+		t = std::chrono::steady_clock::now();
+		const std::vector<FileDigest> all = HashService::HashFiles(paths, HashKind::GitBlob);
+		const double allMs = ElapsedMs(t);
+
+		CHECK_EQ(all.size(), paths.size());
+		for (size_t i = 0; i + 1 < paths.size(); ++i)
+		{
+			FileDigest d;
+			CHECK(HashService::HashFile(paths[i], HashKind::GitBlob, d));
+			CHECK(all[i].Ok && all[i].Path == paths[i]);
+			CHECK(all[i].Blob == d.Blob);
+			CHECK(one[i].Blob == d.Blob);
+		}
+
+		// what `git hash-object` prints
+		CHECK_EQ(all[(size_t)count].Blob.Hex(), "ce013625030ba8dba906f756967f9e9ca394464a");
+		CHECK_EQ(all[(size_t)count + 1].Blob.Hex(), "e69de29bb2d1d6434b8b29ae775ad8c2e48c5391");
+		CHECK(!all.back().Ok);
+
+		const std::vector<FileDigest> fast = HashService::HashFiles(paths, HashKind::Fast64);
+		for (size_t i = 0; i + 1 < paths.size(); ++i)
+		{
+			FileDigest d;
+			CHECK(HashService::HashFile(paths[i], HashKind::Fast64, d, 1));
+			CHECK_EQ(fast[i].Fast, d.Fast);
+		}
+
+		std::printf("%d small files, %llu KiB (cached): git blob %.2f GB/s on 1 thread, %.2f GB/s on %d\n",
+			count, (unsigned long long)(total >> 10), GBps(total, oneMs), GBps(total, allMs), HashService::DefaultThreads());
+
+		std::filesystem::remove_all(dir);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+
+	KnownAnswers();
+	MemoryThroughput(quick ? 16u << 20 : 512u << 20);
+	FileThroughput(quick ? 64ull << 20 : 1ull << 30);
+	ManyFiles(quick ? 256 : 2048);
+	return CheckResult();
+}
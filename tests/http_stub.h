@@ -0,0 +1,317 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Stand-in HTTP/1.1 server on 127.0.0.1 for the download tests: serves files
+// from memory with keep-alive, single byte ranges and If-Range, and can cut
+// a response off partway to play a dropped connection.
+
+struct StubFile
+{
+	std::string Body;
+	std::string ETag;            // empty = not sent
+	std::string LastModified;    // empty = not sent
+	bool Ranges = true;          // Accept-Ranges: bytes, and Range honoured
+	std::string ContentType = "application/octet-stream";
+};
+
+struct StubHit
+{
+	std::string Path;
+	std::string Range;
+	std::string IfRange;
+	int Status = 0;
+	uint64_t Bytes = 0;          // body bytes actually sent
+};
+
+class HttpStub
+{
+public:
+	HttpStub()
+	{
+		listenFd = socket(AF_INET, SOCK_STREAM, 0);
+		int one = 1;
+		setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addr.sin_port = 0;
+		bind(listenFd, (sockaddr*)&addr, sizeof(addr));
+		listen(listenFd, 64);
+
+		socklen_t len = sizeof(addr);
+		getsockname(listenFd, (sockaddr*)&addr, &len);
+		port = ntohs(addr.sin_port);
+
+		acceptor = std::thread([this] { AcceptLoop(); });
+	}
+
+	~HttpStub()
+	{
+		shutdown(listenFd, SHUT_RDWR);
+		close(listenFd);
+		acceptor.join();
+
+		std::vector<std::thread> threads;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+			for (int fd : clients)
+				shutdown(fd, SHUT_RDWR);
+			threads.swap(workers);
+		}
+		for (auto& t : threads)
+			t.join();
+	}
+
+	HttpStub(const HttpStub&) = delete;
+	HttpStub& operator=(const HttpStub&) = delete;
+
+	std::string Url(const std::string& path) const
+	{
+		return "http://127.0.0.1:" + std::to_string(port) + path;
+	}
+
+	void Put(const std::string& path, StubFile file)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		files[path] = std::move(file);
+	}
+
+	// The next `times` responses for path close the connection after `bytes` of body
+	void DropAfter(const std::string& path, uint64_t bytes, int times)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		drops[path] = { bytes, times };
+	}
+
+	std::vector<StubHit> Hits()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return hits;
+	}
+
+	void ClearHits()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		hits.clear();
+	}
+
+	int Connections()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return connections;
+	}
+
+private:
+	struct Drop
+	{
+		uint64_t Bytes = 0;
+		int Times = 0;
+	};
+
+	void AcceptLoop()
+	{
+		for (;;)
+		{
+			int fd = accept(listenFd, nullptr, nullptr);
+			if (fd < 0)
+				return;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (stopping)
+			{
+				close(fd);
+				return;
+			}
+			int one = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+			++connections;
+			clients.push_back(fd);
+			workers.emplace_back([this, fd] { Serve(fd); });
+		}
+	}
+
+	static bool SendAll(int fd, const char* p, size_t n)
+	{
+		while (n)
+		{
+			ssize_t w = send(fd, p, n, MSG_NOSIGNAL);
+			if (w <= 0)
+				return false;
+			p += w;
+			n -= (size_t)w;
+		}
+		return true;
+	}
+
+	static std::string Header(const std::string& head, const char* name)
+	{
+		const std::string key = std::string("\r\n") + name + ":";
+		size_t at = std::string::npos;
+		for (size_t i = 0; i + key.size() <= head.size(); ++i)
+		{
+			if (strncasecmp(head.c_str() + i, key.c_str(), key.size()) == 0)
+			{
+				at = i + key.size();
+				break;
+			}
+		}
+		if (at == std::string::npos)
+			return {};
+		while (at < head.size() && head[at] == ' ')
+			++at;
+		return head.substr(at, head.find("\r\n", at) - at);
+	}
+
+	void Serve(int fd)
+	{
+		std::string in;
+		char buf[4096];
+
+		for (;;)
+		{
+			size_t end;
+			while ((end = in.find("\r\n\r\n")) == std::string::npos)
+			{
+				ssize_t n = recv(fd, buf, sizeof(buf), 0);
+				if (n <= 0)
+				{
+					Close(fd);
+					return;
+				}
+				in.append(buf, (size_t)n);
+			}
+
+			const std::string head = in.substr(0, end + 2);
+			in.erase(0, end + 4);
+
+			const size_t sp1 = head.find(' ');
+			const size_t sp2 = head.find(' ', sp1 + 1);
+			std::string path = head.substr(sp1 + 1, sp2 - sp1 - 1);
+			path = path.substr(0, path.find('?'));
+
+			StubHit hit;
+			hit.Path = path;
+			hit.Range = Header(head, "Range");
+			hit.IfRange = Header(head, "If-Range");
+
+			StubFile file;
+			bool found;
+			Drop drop;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				auto it = files.find(path);
+				found = it != files.end();
+				if (found)
+					file = it->second;
+
+				auto d = drops.find(path);
+				if (d != drops.end() && d->second.Times > 0)
+				{
+					drop = d->second;
+					d->second.Times--;
+				}
+			}
+
+			std::string out;
+			std::string body;
+			if (!found)
+			{
+				hit.Status = 404;
+				body = "not found";
+				out = "HTTP/1.1 404 Not Found\r\n";
+			}
+			else
+			{
+				uint64_t first = 0, last = file.Body.size() ? file.Body.size() - 1 : 0;
+				const bool current = hit.IfRange.empty() || hit.IfRange == file.ETag || hit.IfRange == file.LastModified;
+				bool partial = false;
+
+				if (file.Ranges && current && hit.Range.rfind("bytes=", 0) == 0)
+				{
+					char* rest = nullptr;
+					first = strtoull(hit.Range.c_str() + 6, &rest, 10);
+					if (rest && *rest == '-' && rest[1])
+						last = std::min<uint64_t>(last, strtoull(rest + 1, nullptr, 10));
+					partial = first <= last && first < file.Body.size();
+					if (!partial)
+						first = 0, last = file.Body.size() ? file.Body.size() - 1 : 0;
+				}
+
+				body = file.Body.substr((size_t)first, file.Body.empty() ? 0 : (size_t)(last - first + 1));
+				hit.Status = partial ? 206 : 200;
+				out = partial ? "HTTP/1.1 206 Partial Content\r\n" : "HTTP/1.1 200 OK\r\n";
+				if (partial)
+					out += "Content-Range: bytes " + std::to_string(first) + "-" + std::to_string(last) + "/" + std::to_string(file.Body.size()) + "\r\n";
+				if (file.Ranges)
+					out += "Accept-Ranges: bytes\r\n";
+				if (!file.ETag.empty())
+					out += "ETag: " + file.ETag + "\r\n";
+				if (!file.LastModified.empty())
+					out += "Last-Modified: " + file.LastModified + "\r\n";
+				out += "Content-Type: " + file.ContentType + "\r\n";
+			}
+			out += "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+
+			const bool cut = drop.Times > 0 && drop.Bytes < body.size();
+			const size_t send = cut ? (size_t)drop.Bytes : body.size();
+			hit.Bytes = send;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				hits.push_back(hit);
+			}
+
+			out.append(body, 0, send);
+			if (!SendAll(fd, out.data(), out.size()) || cut)
+			{
+				Close(fd);
+				return;
+			}
+		}
+	}
+
+	void Close(int fd)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (size_t i = 0; i < clients.size(); ++i)
+		{
+			if (clients[i] == fd)
+			{
+				clients.erase(clients.begin() + i);
+				break;
+			}
+		}
+		shutdown(fd, SHUT_RDWR);
+		close(fd);
+	}
+
+	int listenFd = -1;
+	int port = 0;
+	std::thread acceptor;
+
+	std::mutex mutex;
+	bool stopping = false;
+	int connections = 0;
+	std::vector<int> clients;
+	std::vector<std::thread> workers;
+	std::map<std::string, StubFile> files;
+	std::map<std::string, Drop> drops;
+	std::vector<StubHit> hits;
+};
@@ -0,0 +1,155 @@
+// The two .hvk settings files through the field tables (HvkSchema::Write /
+// Read) against the code they replaced (tests/legacy_settings_io.h):
+// HvkJsonWriter on an ostringstream for export, json::parse into a DOM plus
+// per-key lookups for import.
+//
+//   hvk_schema_bench            100000 rounds per file
+//   hvk_schema_bench --quick    2000 (what ctest runs)
+//
+// Both paths work on in-memory text, so this is the serialization cost alone;
+// the file IO around it is the same for both. The old user import skipped the
+// tabbar and button colors, so the table import does more work there.
+
+#include "hvk_schema.h"
+#include "settings_mirror.h"
+#include "legacy_settings_io.h"
+#include "check.h"
+
+#include <cstring>
+#include <string>
+
+using namespace SettingsTables;
+
+namespace
+{
+	// values that survive the old writer's 6 significant digits, so both
+	// paths must read back exactly what was written
+	UserSettingsMirror ChangedUser()
+	{
+		UserSettingsMirror u;
+		u.render.wm_render_interval = 250;
+		u.render.target_fps = 144;
+		u.render.bg_image_path = L"D:\\wallpapers\\\"night\"\tsky.png";
+		u.binds.toggle_main = 0x70;
+		u.style.wm_opacity = 0.5f;
+		u.style.main_bg_color = ImVec4(0.125f, 0.25f, 0.375f, 0.75f);
+		u.style.main_opacity = 0.875f;
+		u.style.loading_theme = LoadingTheme::LIGHTMODE;
+		u.style.bg_theme = BgTheme::GREEN;
+		u.style.main_secondary_color = ImVec4(0.5f, 1.0f, 0.0625f, 1.0f);
+		return u;
+	}
+
+	SettingsMirror ChangedSettings()
+	{
+		SettingsMirror st;
+		st.is_first_run = true;
+		st.g_MainTab = 3;
+		st.vsync = false;
+		st.visibility.disk_info = true;
+		st.fmtui.g_FormatUI.SelectedDisk = 2;
+		st.fmtui.g_FormatUI.FileSystem = 2;
+		snprintf(st.fmtui.g_FormatUI.VolumeLabel, sizeof(st.fmtui.g_FormatUI.VolumeLabel), "USB \"boot\"");
+		snprintf(st.fmtui.g_FormatUI.RenameLabel, sizeof(st.fmtui.g_FormatUI.RenameLabel), "data");
+		st.themecombos.BgThemeIdx = 4;
+		return st;
+	}
+
+	// two objects hold the same settings when the tables write the same text
+	template<typename T, size_t N>
+	std::string Canonical(const T& object, const HvkField(&fields)[N])
+	{
+		std::string out;
+		HvkSchema::Write(out, &object, fields);
+		return out;
+	}
+
+	template<typename T, size_t N>
+	void Run(const char* label, const T& src, const HvkField(&fields)[N], int rounds,
+		std::string (*oldExport)(const T&), bool (*oldImport)(const std::string&, T&))
+	{
+		const std::string expect = Canonical(src, fields);
+
+		// the new reader takes what the old writer wrote: key names are unchanged
+		const std::string oldText = oldExport(src);
+		T fromOld;
+		std::string error;
+		CHECK(HvkSchema::Read(oldText, &fromOld, fields, &error));
+		CHECK(error.empty());
+		CHECK_EQ(Canonical(fromOld, fields), expect);
+
+		std::string newText;
+		HvkSchema::Write(newText, &src, fields);
+		T fromNew;
+		CHECK(HvkSchema::Read(newText, &fromNew, fields));
+		CHECK_EQ(Canonical(fromNew, fields), expect);
+
+		size_t sink = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; ++i)
+			sink += oldExport(src).size();
+		const double oldWrite = ElapsedMs(start);
+
+		// the app keeps one buffer per file and reuses it
+		std::string buf;
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; ++i)
+		{
+			HvkSchema::Write(buf, &src, fields);
+			sink += buf.size();
+		}
+		const double newWrite = ElapsedMs(start);
+
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; ++i)
+		{
+			T dst;
+			sink += oldImport(oldText, dst);
+		}
+		const double oldRead = ElapsedMs(start);
+
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < rounds; ++i)
+		{
+			T dst;
+			sink += HvkSchema::Read(newText, &dst, fields);
+		}
+		const double newRead = ElapsedMs(start);
+
+		CHECK(sink > 0);
+
+		const double us = 1000.0 / rounds;
+		std::printf("%-13s export: writer %6.2f us, table %6.2f us (%.1fx) | import: DOM %6.2f us, table %6.2f us (%.1fx) | %zu / %zu bytes\n",
+			label, oldWrite * us, newWrite * us, oldWrite / newWrite,
+			oldRead * us, newRead * us, oldRead / newRead, oldText.size(), newText.size());
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int rounds = quick ? 2000 : 100000;
+
+	// the old DOM import never read the tabbar and button colors back; the tables do
+	{
+		UserSettingsMirror src = ChangedUser();
+		src.style.tabbar_text_color = ImVec4(0.25f, 0.25f, 0.25f, 1.0f);
+		src.style.button_color = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);
+
+		UserSettingsMirror viaDom;
+		CHECK(OldImportUser(OldExportUser(src), viaDom));
+		CHECK(viaDom.style.button_color.x != 0.5f);
+
+		std::string text;
+		HvkSchema::Write(text, &src, kUserSettings);
+		UserSettingsMirror viaTable;
+		CHECK(HvkSchema::Read(text, &viaTable, kUserSettings));
+		CHECK_EQ(viaTable.style.button_color.x, 0.5f);
+		CHECK_EQ(viaTable.style.tabbar_text_color.x, 0.25f);
+	}
+
+	Run<UserSettingsMirror>("user.hvk", ChangedUser(), kUserSettings, rounds, OldExportUser, OldImportUser);
+	Run<SettingsMirror>("settings.hvk", ChangedSettings(), kSettings, rounds, OldExportSettings, OldImportSettings);
+	return CheckResult();
+}
@@ -0,0 +1,231 @@
+// HvkSchema and HvkSnapshot over field tables of classes that are not
+// standard layout (mixed access, a base class, std::string members).
+
+#include "hvk_schema.h"
+#include "hvk_snapshot.h"
+#include "hash.h"
+#include "check.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+	enum class Theme : int32_t { Dark, Light };
+
+	struct Base
+	{
+		virtual ~Base() = default;
+		int BaseOnly = 0;
+	};
+
+	class Window : public Base
+	{
+	public:
+		bool Visible = true;
+		float Opacity = 1.0f;
+		std::string Title = "main";
+
+		struct
+		{
+			ImVec4 Color = ImVec4(0.1f, 0.2f, 0.3f, 1.0f);
+			Theme Mode = Theme::Dark;
+			std::wstring Font = L"Satoshi";
+		} style;
+
+		char Label[16] = "drive";
+		uint64_t Bytes = 0;
+
+		int Hidden() const { return hidden; }
+
+	private:
+		int hidden = 7;
+
+	public:
+		static const HvkField kFields[];
+	};
+
+	static_assert(!std::is_standard_layout_v<Window>, "the point of the test");
+
+	using WindowStyle = decltype(Window::style);
+
+	constexpr HvkField kStyle[] =
+	{
+		HVK_FIELD(WindowStyle, Color),
+		HVK_FIELD(WindowStyle, Mode),
+		HVK_FIELD(WindowStyle, Font),
+	};
+
+	constexpr HvkField Window::kFields[] =
+	{
+		HVK_FIELD(Window, Visible),
+		HVK_FIELD(Window, Opacity),
+		HVK_FIELD_AS(Window, Title, "title"),
+		HVK_OBJECT(Window, style, "style", kStyle),
+		HVK_FIELD(Window, Label),
+		HVK_FIELD(Window, Bytes),
+		HVK_FIELD(Window, hidden),
+	};
+
+	Window Changed()
+	{
+		Window w;
+		w.Visible = false;
+		w.Opacity = 0.5f;
+		w.Title = "settings \"quoted\"";
+		w.style.Color = ImVec4(1, 0, 0.5f, 0.25f);
+		w.style.Mode = Theme::Light;
+		w.style.Font = L"Grün";
+		snprintf(w.Label, sizeof(w.Label), "usb");
+		w.Bytes = 1ull << 40;
+		return w;
+	}
+
+	bool Same(const Window& a, const Window& b)
+	{
+		return a.Visible == b.Visible && a.Opacity == b.Opacity && a.Title == b.Title &&
+			a.style.Color.x == b.style.Color.x && a.style.Color.w == b.style.Color.w &&
+			a.style.Mode == b.style.Mode && a.style.Font == b.style.Font &&
+			std::string(a.Label) == b.Label && a.Bytes == b.Bytes && a.Hidden() == b.Hidden();
+	}
+
+	void JsonRoundTrip()
+	{
+		const Window src = Changed();
+		std::string json;
+		HvkSchema::Write(json, &src, Window::kFields);
+
+		Window dst;
+		std::string error;
+		CHECK(HvkSchema::Read(json, &dst, Window::kFields, &error));
+		CHECK(error.empty());
+		CHECK(Same(src, dst));
+		CHECK_EQ(dst.BaseOnly, 0);   // not in the table, untouched
+	}
+
+	void SnapshotRoundTrip()
+	{
+		const Window src = Changed();
+		std::string bin;
+		HvkSnapshot::Encode(bin, &src, Window::kFields, HvkCount(Window::kFields));
+
+		Window dst;
+		CHECK(HvkSnapshot::Decode((const uint8_t*)bin.data(), bin.size(), &dst, Window::kFields, HvkCount(Window::kFields)));
+		CHECK(Same(src, dst));
+	}
+
+	// A record that runs past the payload (checksum fixed up, so only the
+	// record walk can catch it) must not leave the fields before it applied
+	void MalformedSnapshotLeavesObjectAlone()
+	{
+		const Window src = Changed();
+		std::string bin;
+		HvkSnapshot::Encode(bin, &src, Window::kFields, HvkCount(Window::kFields));
+
+		const size_t header = 32;
+		bin.append("\x01\x02\x03", 3);
+		const uint64_t payload = bin.size() - header;
+		const uint64_t sum = HashService::Fast64(bin.data() + header, (size_t)payload);
+		memcpy(&bin[16], &payload, 8);
+		memcpy(&bin[24], &sum, 8);
+
+		Window dst;
+		std::string error;
+		CHECK(!HvkSnapshot::Decode((const uint8_t*)bin.data(), bin.size(), &dst, Window::kFields, HvkCount(Window::kFields), &error));
+		CHECK(error == "malformed snapshot record");
+		CHECK(Same(Window(), dst));
+	}
+
+	void MergeReportsChangedFields()
+	{
+		Window dst;
+		Window src;
+		src.Opacity = 0.25f;
+		src.style.Mode = Theme::Light;
+
+		std::vector<std::string> changed;
+		HvkSchema::Merge(&dst, &src, Window::kFields, &changed);
+		CHECK(changed == std::vector<std::string>({ "Opacity", "style.Mode" }));
+		CHECK_EQ(dst.Opacity, 0.25f);
+		CHECK(dst.style.Mode == Theme::Light);
+	}
+
+	// Numbers that don't fit the field leave it alone, like a string in a bool
+	void OutOfRangeNumbersKeepTheField()
+	{
+		const char* cases[] =
+		{
+			R"({ "hidden": 4294967296 })",
+			R"({ "hidden": -2147483649 })",
+			R"({ "hidden": 18446744073709551615 })",
+			R"({ "hidden": 1.5 })",
+			R"({ "hidden": 1e300 })",
+			R"({ "Bytes": -1 })",
+			R"({ "Bytes": 1e30 })",
+			R"({ "Opacity": 1e300 })",
+			R"({ "Opacity": -1e300 })",
+		};
+		for (const char* text : cases)
+		{
+			Window dst;
+			dst.Bytes = 5;
+			CHECK(HvkSchema::Read(text, &dst, Window::kFields, nullptr));
+			CHECK_EQ(dst.Hidden(), 7);
+			CHECK_EQ(dst.Bytes, 5ull);
+			CHECK_EQ(dst.Opacity, 1.0f);
+		}
+
+		Window dst;
+		CHECK(HvkSchema::Read(R"({ "hidden": -2147483648, "Bytes": 18446744073709551615, "Opacity": 60.0 })", &dst, Window::kFields, nullptr));
+		CHECK_EQ(dst.Hidden(), INT32_MIN);
+		CHECK_EQ(dst.Bytes, UINT64_MAX);
+		CHECK_EQ(dst.Opacity, 60.0f);
+
+		CHECK(HvkSchema::Read(R"({ "hidden": 3.0 })", &dst, Window::kFields, nullptr));
+		CHECK_EQ(dst.Hidden(), 3);
+	}
+
+	void MalformedVec4KeepsTheField()
+	{
+		const char* cases[] =
+		{
+			R"({ "style": { "Color": [ 1, { "x": 2 }, 3, 4 ] } })",
+			R"({ "style": { "Color": [ 1, [ 2 ], 3, 4 ] } })",
+			R"({ "style": { "Color": [ 1, 2, 3 ] } })",
+			R"({ "style": { "Color": [ 1, 2, 3, 4, 5 ] } })",
+			R"({ "style": { "Color": [ 1, "2", 3, 4 ] } })",
+			R"({ "style": { "Color": [ 1, 1e300, 3, 4 ] } })",
+		};
+		for (const char* text : cases)
+		{
+			Window dst;
+			CHECK(HvkSchema::Read(text, &dst, Window::kFields, nullptr));
+			CHECK_EQ(dst.style.Color.x, 0.1f);
+			CHECK_EQ(dst.style.Color.w, 1.0f);
+			CHECK(dst.style.Mode == Theme::Dark);
+		}
+
+		// a bad color doesn't cost the fields after it
+		Window dst;
+		CHECK(HvkSchema::Read(R"({ "style": { "Color": [ [ 1 ], 2, 3, 4 ], "Mode": 1 }, "Opacity": 0.5 })", &dst, Window::kFields, nullptr));
+		CHECK_EQ(dst.style.Color.x, 0.1f);
+		CHECK(dst.style.Mode == Theme::Light);
+		CHECK_EQ(dst.Opacity, 0.5f);
+
+		CHECK(HvkSchema::Read(R"({ "style": { "Color": [ 1, 0, 0.5, 0.25 ] } })", &dst, Window::kFields, nullptr));
+		CHECK_EQ(dst.style.Color.x, 1.0f);
+		CHECK_EQ(dst.style.Color.w, 0.25f);
+	}
+}
+
+int main()
+{
+	JsonRoundTrip();
+	SnapshotRoundTrip();
+	MalformedSnapshotLeavesObjectAlone();
+	MergeReportsChangedFields();
+	OutOfRangeNumbersKeepTheField();
+	MalformedVec4KeepsTheField();
+	return CheckResult();
+}
@@ -0,0 +1,175 @@
+// Startup load of the two settings files: HvkSnapshot (IsCurrent + mapped
+// Load of the .hvkb) against the JSON import (read the .hvk, HvkSchema::Read)
+// and, for reference, the DOM import it replaced.
+//
+//   hvk_snapshot_bench            20000 warm / 500 cold loads per file
+//   hvk_snapshot_bench --quick    500 / 20 (what ctest runs)
+//
+// Warm: the files sit in the page cache, as on any start after the first.
+// Cold: before every load the file's pages are dropped with
+// POSIX_FADV_DONTNEED, which works without root for clean pages. On tmpfs the
+// drop does nothing and cold reads like warm; the output says which it got.
+
+#include "hvk_snapshot.h"
+#include "settings_mirror.h"
+#include "legacy_settings_io.h"
+#include "check.h"
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+using namespace SettingsTables;
+
+namespace
+{
+	bool ReadFileToString(const fs::path& path, std::string& out)
+	{
+		const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return false;
+
+		struct stat st{};
+		bool ok = fstat(fd, &st) == 0 && st.st_size > 0;
+		if (ok)
+		{
+			out.resize((size_t)st.st_size);
+			ok = read(fd, out.data(), out.size()) == (ssize_t)out.size();
+		}
+		close(fd);
+		return ok;
+	}
+
+	void DropFromCache(const fs::path& path)
+	{
+		const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return;
+		fdatasync(fd);
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		close(fd);
+	}
+
+	// whether the drop took: none of the file's pages left in the cache
+	bool Evicted(const fs::path& path)
+	{
+		const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return false;
+
+		struct stat st{};
+		fstat(fd, &st);
+		void* view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (view == MAP_FAILED)
+			return false;
+
+		const long page = sysconf(_SC_PAGESIZE);
+		std::string resident((size_t)((st.st_size + page - 1) / page), '\0');
+		bool none = mincore(view, (size_t)st.st_size, (unsigned char*)resident.data()) == 0;
+		for (char c : resident)
+			none = none && !(c & 1);
+		munmap(view, (size_t)st.st_size);
+		return none;
+	}
+
+	// mean microseconds per load; with cold the file is dropped (untimed) first
+	template<typename Fn>
+	double PerLoadUs(int rounds, bool cold, const fs::path& file, Fn&& load)
+	{
+		double ms = 0;
+		for (int i = 0; i < rounds; ++i)
+		{
+			if (cold)
+				DropFromCache(file);
+
+			auto t = std::chrono::steady_clock::now();
+			load();
+			ms += ElapsedMs(t);
+		}
+		return ms * 1000.0 / rounds;
+	}
+
+	template<typename T, size_t N>
+	void Compare(const char* label, const fs::path& json, const T& src, const HvkField(&fields)[N],
+		bool (*oldImport)(const std::string&, T&), int warm, int cold)
+	{
+		const fs::path snap = HvkSnapshot::PathFor(json);
+
+		std::string text;
+		HvkSchema::Write(text, &src, fields);
+		{
+			FILE* f = fopen(json.c_str(), "wb");
+			CHECK(f && fwrite(text.data(), 1, text.size(), f) == text.size());
+			if (f)
+				fclose(f);
+		}
+		CHECK(HvkSnapshot::Save(snap, &src, fields));
+		CHECK(HvkSnapshot::IsCurrent(json));
+
+		// all three must hand back what was saved
+		std::string expect, got;
+		HvkSchema::Write(expect, &src, fields);
+		{
+			T viaSnap, viaJson;
+			CHECK(HvkSnapshot::Load(snap, &viaSnap, fields));
+			HvkSchema::Write(got, &viaSnap, fields);
+			CHECK(got == expect);
+
+			std::string read;
+			CHECK(ReadFileToString(json, read) && HvkSchema::Read(read, &viaJson, fields));
+			HvkSchema::Write(got, &viaJson, fields);
+			CHECK(got == expect);
+		}
+
+		auto snapshotLoad = [&] { T dst; CHECK(HvkSnapshot::IsCurrent(json) && HvkSnapshot::Load(snap, &dst, fields)); };
+		auto jsonLoad = [&] { T dst; std::string s; CHECK(ReadFileToString(json, s) && HvkSchema::Read(s, &dst, fields)); };
+		auto domLoad = [&] { T dst; std::string s; CHECK(ReadFileToString(json, s) && oldImport(s, dst)); };
+
+		DropFromCache(snap);
+		DropFromCache(json);
+		const bool evicts = Evicted(snap) && Evicted(json);
+
+		for (bool isCold : { false, true })
+		{
+			const int rounds = isCold ? cold : warm;
+			const double s = PerLoadUs(rounds, isCold, snap, snapshotLoad);
+			const double j = PerLoadUs(rounds, isCold, json, jsonLoad);
+			const double d = PerLoadUs(rounds, isCold, json, domLoad);
+			std::printf("%-13s %s: snapshot %8.2f us | json %8.2f us (%.1fx) | DOM %8.2f us (%.1fx) | %zu / %zu bytes\n",
+				label, isCold ? (evicts ? "cold" : "cold (drop had no effect)") : "warm",
+				s, j, j / s, d, d / s, (size_t)fs::file_size(snap), text.size());
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int warm = quick ? 500 : 20000;
+	const int cold = quick ? 20 : 500;
+
+	const fs::path dir = fs::temp_directory_path() / "hvk_snapshot_bench";
+	fs::create_directories(dir);
+
+	UserSettingsMirror user;
+	user.render.target_fps = 144;
+	user.style.main_bg_color = ImVec4(0.125f, 0.25f, 0.375f, 0.75f);
+	user.style.bg_theme = BgTheme::RED;
+
+	SettingsMirror settings;
+	settings.g_MainTab = 2;
+	snprintf(settings.fmtui.g_FormatUI.VolumeLabel, sizeof(settings.fmtui.g_FormatUI.VolumeLabel), "BACKUP");
+
+	Compare<UserSettingsMirror>("user.hvk", dir / "user.hvk", user, kUserSettings, OldImportUser, warm, cold);
+	Compare<SettingsMirror>("settings.hvk", dir / "settings.hvk", settings, kSettings, OldImportSettings, warm, cold);
+
+	fs::remove_all(dir);
+	return CheckResult();
+}
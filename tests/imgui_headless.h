@@ -0,0 +1,57 @@
+#pragma once
+
+#include "imgui.h"
+
+#include <cstdint>
+
+// Dear ImGui without a window or GPU for the frame benchmarks: a context with
+// a fixed display, and the texture handling the DX11/DX12 backends do
+// (RendererHasTextures) minus the uploads, which are only counted.
+
+struct HeadlessUploads
+{
+	int Created = 0;
+	int Updates = 0;            // ImTextureData::Updates entries, i.e. rects uploaded
+	int64_t UpdatedPixels = 0;
+};
+
+inline HeadlessUploads g_HeadlessUploads;
+
+inline ImGuiContext* CreateHeadlessContext(float width = 1280.0f, float height = 720.0f)
+{
+	ImGuiContext* ctx = ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.IniFilename = nullptr;
+	io.DisplaySize = ImVec2(width, height);
+	io.DeltaTime = 1.0f / 60.0f;
+	io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+	return ctx;
+}
+
+// After ImGui::Render(), where a backend would walk the draw data's textures
+inline void StandInRenderer()
+{
+	static unsigned texture[4];   // a TexID has to point at something
+
+	for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+	{
+		if (tex->Status == ImTextureStatus_WantCreate)
+		{
+			tex->SetTexID((ImTextureID)(intptr_t)texture);
+			tex->SetStatus(ImTextureStatus_OK);
+			++g_HeadlessUploads.Created;
+		}
+		else if (tex->Status == ImTextureStatus_WantUpdates)
+		{
+			for (const ImTextureRect& r : tex->Updates)
+				g_HeadlessUploads.UpdatedPixels += (int64_t)r.w * r.h;
+			g_HeadlessUploads.Updates += tex->Updates.Size;
+			tex->SetStatus(ImTextureStatus_OK);
+		}
+		else if (tex->Status == ImTextureStatus_WantDestroy)
+		{
+			tex->SetTexID(ImTextureID_Invalid);
+			tex->SetStatus(ImTextureStatus_Destroyed);
+		}
+	}
+}
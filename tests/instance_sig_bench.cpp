@@ -0,0 +1,138 @@
+// InstanceValidationCache: what Get() costs on each of its paths, and that a
+// caller arriving after Invalidate() never gets the result from before it.
+//
+//   instance_sig_bench            20M cached Get() calls, 16 MiB instance file
+//   instance_sig_bench --quick    1M calls, 4 MiB (what ctest runs)
+
+#include "instance_sig.h"
+#include "check.h"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	void Put(const fs::path& path, const std::string& bytes)
+	{
+		std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), (std::streamsize)bytes.size());
+	}
+
+	std::string Json(size_t size)
+	{
+		std::string json = "{ \"app\": \"PSHVK\", \"pad\": \"";
+		json.append(size, 'x');
+		json += "\" }";
+		return json;
+	}
+
+	void Signature()
+	{
+		std::string file = InstanceSignature::Build("{ \"uuid\": \"1234\" }");
+		CHECK(InstanceSignature::Verify((const uint8_t*)file.data(), file.size()));
+		file[3] ^= 1;
+		CHECK(!InstanceSignature::Verify((const uint8_t*)file.data(), file.size()));
+	}
+
+	// A stamp that didn't move costs a stat, not a hash
+	void HashesOnlyOnChange(const fs::path& path)
+	{
+		Put(path, InstanceSignature::Build(Json(100)));
+		InstanceValidationCache cache(path);
+
+		CHECK(cache.Get());
+		CHECK(cache.Get());
+		CHECK_EQ(cache.HashCount(), 1u);
+
+		cache.Invalidate();
+		CHECK(cache.Get());
+		CHECK_EQ(cache.HashCount(), 1u);
+
+		Put(path, "not signed");
+		cache.Invalidate();
+		CHECK(!cache.Get());
+		CHECK_EQ(cache.HashCount(), 2u);
+	}
+
+	// Every Get() started after Invalidate() must see the broken file, also the
+	// ones that come in while another thread is still hashing it
+	void NoStaleResultAfterInvalidate(const fs::path& path, size_t size)
+	{
+		const std::string good = InstanceSignature::Build(Json(size));
+		Put(path, good);
+		InstanceValidationCache cache(path);
+		CHECK(cache.Get());
+
+		std::string bad = good;
+		bad[10] ^= 1;   // same size; write time moves
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		Put(path, bad);
+		cache.Invalidate();
+
+		std::atomic<int> stale{ 0 };
+		std::vector<std::thread> readers;
+		for (int i = 0; i < 8; ++i)
+		{
+			readers.emplace_back([&]
+				{
+					for (int n = 0; n < 200; ++n)
+						stale += cache.Get() ? 1 : 0;
+				});
+		}
+		for (auto& t : readers)
+			t.join();
+
+		CHECK_EQ(stale.load(), 0);
+		CHECK_EQ(cache.HashCount(), 2u);
+	}
+
+	void Timings(const fs::path& path, size_t size, int calls)
+	{
+		Put(path, InstanceSignature::Build(Json(size)));
+		InstanceValidationCache cache(path);
+
+		auto t = std::chrono::steady_clock::now();
+		CHECK(cache.Get());
+		const double hashMs = ElapsedMs(t);
+
+		int yes = 0;
+		t = std::chrono::steady_clock::now();
+		for (int i = 0; i < calls; ++i)
+			yes += cache.Get() ? 1 : 0;
+		const double cachedMs = ElapsedMs(t);
+		CHECK_EQ(yes, calls);
+
+		const int stats = calls / 1000;
+		t = std::chrono::steady_clock::now();
+		for (int i = 0; i < stats; ++i)
+		{
+			cache.Invalidate();
+			yes += cache.Get() ? 1 : 0;
+		}
+		const double statMs = ElapsedMs(t);
+		CHECK_EQ(cache.HashCount(), 1u);
+
+		std::printf("cached Get %.2f ns, after Invalidate (stat) %.2f us, re-hash of %zu MiB %.2f ms\n",
+			cachedMs * 1e6 / calls, statMs * 1e3 / stats, size >> 20, hashMs);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const size_t size = quick ? 4u << 20 : 16u << 20;
+
+	const fs::path path = fs::temp_directory_path() / "hvk_instance_sig_bench.hvk";
+
+	Signature();
+	HashesOnlyOnChange(path);
+	NoStaleResultAfterInvalidate(path, size);
+	Timings(path, size, quick ? 1000000 : 20000000);
+
+	fs::remove(path);
+	return CheckResult();
+}
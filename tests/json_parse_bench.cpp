@@ -0,0 +1,282 @@
+// Parse time and peak heap of the sax readers (HvkSchema::Read / ReadArray)
+// against json::parse into a DOM, on large synthetic inputs:
+//
+//   - a user.hvk that grew an unknown "history" array the reader must skip
+//   - a GitHub contents listing, every field the API sends
+//
+//   json_parse_bench            200k history entries, 50k listing entries
+//   json_parse_bench --quick    5k / 5k (what ctest runs)
+//
+// Peak heap counts every operator new while the parse runs, above what was
+// live when it started; the input text is allocated before that.
+
+#include "hvk_schema.h"
+#include "settings_mirror.h"
+#include "legacy_settings_io.h"
+#include "check.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace SettingsTables;
+
+// ------------------------------------------------------------
+// Heap accounting
+// ------------------------------------------------------------
+
+namespace
+{
+	std::atomic<size_t> g_HeapLive{ 0 };
+	std::atomic<size_t> g_HeapPeak{ 0 };
+
+	// every block carries its size in front, aligned for any type
+	constexpr size_t kHeader = alignof(std::max_align_t);
+
+	void* Allocate(size_t size)
+	{
+		uint8_t* p = (uint8_t*)std::malloc(size + kHeader);
+		if (!p)
+			throw std::bad_alloc();
+		memcpy(p, &size, sizeof(size));
+
+		const size_t live = g_HeapLive += size;
+		size_t peak = g_HeapPeak.load();
+		while (live > peak && !g_HeapPeak.compare_exchange_weak(peak, live)) {}
+		return p + kHeader;
+	}
+
+	void Release(void* block)
+	{
+		if (!block)
+			return;
+		uint8_t* p = (uint8_t*)block - kHeader;
+		size_t size;
+		memcpy(&size, p, sizeof(size));
+		g_HeapLive -= size;
+		std::free(p);
+	}
+}
+
+void* operator new(size_t size) { return Allocate(size); }
+void* operator new[](size_t size) { return Allocate(size); }
+void operator delete(void* p) noexcept { Release(p); }
+void operator delete[](void* p) noexcept { Release(p); }
+void operator delete(void* p, size_t) noexcept { Release(p); }
+void operator delete[](void* p, size_t) noexcept { Release(p); }
+
+namespace
+{
+	struct Measure
+	{
+		double Ms = 0;
+		size_t PeakBytes = 0;
+	};
+
+	// best time of `rounds`; the peak is the same every round. reset() drops
+	// the previous round's result before the baseline is taken
+	template<typename Reset, typename Fn>
+	Measure Run(int rounds, Reset&& reset, Fn&& fn)
+	{
+		Measure m;
+		m.Ms = 1e300;
+		for (int i = 0; i < rounds; ++i)
+		{
+			reset();
+			const size_t base = g_HeapLive.load();
+			g_HeapPeak = base;
+
+			auto t = std::chrono::steady_clock::now();
+			fn();
+			const double ms = ElapsedMs(t);
+
+			if (ms < m.Ms)
+				m.Ms = ms;
+			m.PeakBytes = g_HeapPeak.load() - base;
+		}
+		return m;
+	}
+
+	void Report(const char* label, size_t textBytes, const Measure& dom, const Measure& sax)
+	{
+		const double mb = textBytes / 1048576.0;
+		std::printf("%-9s %6.1f MB | DOM %7.1f ms %6.1f MB/s peak %9.1f KB | sax %7.1f ms %6.1f MB/s peak %9.1f KB | %.1fx faster\n",
+			label, mb,
+			dom.Ms, mb / (dom.Ms / 1000.0), dom.PeakBytes / 1024.0,
+			sax.Ms, mb / (sax.Ms / 1000.0), sax.PeakBytes / 1024.0,
+			dom.Ms / sax.Ms);
+	}
+
+	// ------------------------------------------------------------
+	// Settings: the real user.hvk keys behind a large unknown array
+	// ------------------------------------------------------------
+
+	void Settings(int entries, int rounds)
+	{
+		UserSettingsMirror src;
+		src.render.target_fps = 240;
+		src.style.main_opacity = 0.75f;
+		src.style.bg_theme = BgTheme::BLUE;
+
+		std::string known;
+		HvkSchema::Write(known, &src, kUserSettings);
+
+		std::string text = "{\n\t\"history\": [\n";
+		for (int i = 0; i < entries; ++i)
+		{
+			char line[256];
+			snprintf(line, sizeof(line),
+				"\t\t{ \"path\": \"D:\\\\images\\\\set_%d\\\\frame_%06d.png\", \"opened\": %d, \"pinned\": %s, \"zoom\": %d.25, \"tags\": [ \"bg\", \"%d\" ] }%s\n",
+				i % 97, i, 1700000000 + i, i % 7 ? "false" : "true", i % 4, i % 13, i + 1 < entries ? "," : "");
+			text += line;
+		}
+		text += "\t],\n";
+		text.append(known, 2, std::string::npos); // known starts with "{\n"
+
+		UserSettingsMirror viaDom, viaSax;
+		const Measure dom = Run(rounds, [&] { viaDom = UserSettingsMirror(); }, [&] { CHECK(OldImportUser(text, viaDom)); });
+		const Measure sax = Run(rounds, [&] { viaSax = UserSettingsMirror(); }, [&] { CHECK(HvkSchema::Read(text, &viaSax, kUserSettings)); });
+
+		CHECK_EQ(viaDom.render.target_fps, 240);
+		CHECK_EQ(viaDom.style.main_opacity, 0.75f);
+		std::string back;
+		HvkSchema::Write(back, &viaSax, kUserSettings);
+		CHECK(back == known);
+
+		Report("settings", text.size(), dom, sax);
+	}
+
+	// ------------------------------------------------------------
+	// GitHub contents listing, as the API sends it
+	// ------------------------------------------------------------
+
+	struct GithubEntry
+	{
+		std::string name;
+		std::string type;
+		std::string download_url;
+		std::string url;
+
+		bool operator==(const GithubEntry& o) const
+		{
+			return name == o.name && type == o.type && download_url == o.download_url && url == o.url;
+		}
+	};
+
+	// same table as github_folder.cpp
+	constexpr HvkField kGithubEntry[] =
+	{
+		HVK_FIELD(GithubEntry, name),
+		HVK_FIELD(GithubEntry, type),
+		HVK_FIELD(GithubEntry, download_url),
+		HVK_FIELD(GithubEntry, url),
+	};
+
+	std::string Listing(int entries)
+	{
+		const char* repo = "https://api.github.com/repos/hvk/menu-assets";
+		std::string text = "[\n";
+		for (int i = 0; i < entries; ++i)
+		{
+			// every 16th entry is a directory: no size, download_url null
+			const bool dir = i % 16 == 0;
+			char sha[41];
+			for (int k = 0; k < 40; ++k)
+				sha[k] = "0123456789abcdef"[(i * 31 + k * 7) & 15];
+			sha[40] = 0;
+
+			char name[64];
+			snprintf(name, sizeof(name), dir ? "pack_%05d" : "glyph_%05d.png", i);
+
+			const std::string download = dir ? "null"
+				: "\"https://raw.githubusercontent.com/hvk/menu-assets/main/assets/" + std::string(name) + "\"";
+
+			char buf[1536];
+			snprintf(buf, sizeof(buf),
+				"  {\n"
+				"    \"name\": \"%s\",\n"
+				"    \"path\": \"assets/%s\",\n"
+				"    \"sha\": \"%s\",\n"
+				"    \"size\": %d,\n"
+				"    \"url\": \"%s/contents/assets/%s?ref=main\",\n"
+				"    \"html_url\": \"https://github.com/hvk/menu-assets/%s/main/assets/%s\",\n"
+				"    \"git_url\": \"%s/git/%s/%s\",\n"
+				"    \"download_url\": %s,\n"
+				"    \"type\": \"%s\",\n"
+				"    \"_links\": {\n"
+				"      \"self\": \"%s/contents/assets/%s?ref=main\",\n"
+				"      \"git\": \"%s/git/%s/%s\",\n"
+				"      \"html\": \"https://github.com/hvk/menu-assets/%s/main/assets/%s\"\n"
+				"    }\n"
+				"  }%s\n",
+				name, name, sha, dir ? 0 : 1024 + i % 65536,
+				repo, name,
+				dir ? "tree" : "blob", name,
+				repo, dir ? "trees" : "blobs", sha,
+				download.c_str(),
+				dir ? "dir" : "file",
+				repo, name,
+				repo, dir ? "trees" : "blobs", sha,
+				dir ? "tree" : "blob", name,
+				i + 1 < entries ? "," : "");
+			text += buf;
+		}
+		text += "]\n";
+		return text;
+	}
+
+	// what DownloadGithubFolder did before the sax reader, with the type
+	// checks value() lacks (a null download_url would throw)
+	bool DomListing(const std::string& text, std::vector<GithubEntry>& out)
+	{
+		json data = json::parse(text, nullptr, false);
+		if (!data.is_array())
+			return false;
+
+		for (const auto& item : data)
+		{
+			GithubEntry e;
+			auto str = [&](const char* key, std::string& dst)
+			{
+				auto it = item.find(key);
+				if (it != item.end() && it->is_string())
+					dst = it->get<std::string>();
+			};
+			str("name", e.name);
+			str("type", e.type);
+			str("download_url", e.download_url);
+			str("url", e.url);
+			out.push_back(std::move(e));
+		}
+		return true;
+	}
+
+	void GithubListing(int entries, int rounds)
+	{
+		const std::string text = Listing(entries);
+
+		std::vector<GithubEntry> viaDom, viaSax;
+		const Measure dom = Run(rounds, [&] { viaDom = {}; }, [&] { CHECK(DomListing(text, viaDom)); });
+		const Measure sax = Run(rounds, [&] { viaSax = {}; }, [&] { CHECK(HvkSchema::ReadArray(text, kGithubEntry, viaSax)); });
+
+		CHECK_EQ(viaSax.size(), (size_t)entries);
+		CHECK(viaSax == viaDom);
+		CHECK(viaSax[0].type == "dir" && viaSax[0].download_url.empty());
+		CHECK(viaSax[1].type == "file" && viaSax[1].download_url.find("glyph_00001.png") != std::string::npos);
+
+		Report("listing", text.size(), dom, sax);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int rounds = quick ? 1 : 3;
+
+	Settings(quick ? 5000 : 200000, rounds);
+	GithubListing(quick ? 5000 : 50000, rounds);
+	return CheckResult();
+}
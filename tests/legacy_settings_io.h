@@ -0,0 +1,292 @@
+#pragma once
+
+#include "settings_mirror.h"
+#include "json.hpp"
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using json = nlohmann::json;
+
+// The .hvk export/import settings.cpp had before the field tables:
+// HvkJsonWriter on an ostringstream, json::parse into a DOM plus per-key
+// lookups. File IO and logging dropped; kept as the baseline the
+// benchmarks compare against.
+
+struct HvkJsonWriter
+{
+	std::ostringstream ss;
+	int indent = 0;
+
+	void Indent()
+	{
+		for (int i = 0; i < indent; ++i)
+			ss << '\t';
+	}
+
+	void BeginObject()
+	{
+		ss << "{\n";
+		indent++;
+	}
+
+	void EndObject(bool comma = false)
+	{
+		ss << "\n";
+		indent--;
+		Indent();
+		ss << "}";
+		if (comma) ss << ",";
+		ss << "\n";
+	}
+
+	void Key(const char* key)
+	{
+		Indent();
+		ss << "\"" << key << "\": ";
+	}
+
+	void String(const std::string& v, bool comma = true)
+	{
+		ss << "\"";
+		for (char c : v)
+		{
+			switch (c)
+			{
+			case '\\': ss << "\\\\"; break;
+			case '"':  ss << "\\\""; break;
+			case '\n': ss << "\\n";  break;
+			case '\r': ss << "\\r";  break;
+			case '\t': ss << "\\t";  break;
+			default:
+				ss << c;
+				break;
+			}
+		}
+		ss << "\"";
+		if (comma) ss << ",";
+		ss << "\n";
+	}
+
+	void WString(const std::wstring& v, bool comma = true)
+	{
+		String(std::string(v.begin(), v.end()), comma);
+	}
+
+	void Bool(bool v, bool comma = true)
+	{
+		ss << (v ? "true" : "false");
+		if (comma) ss << ",";
+		ss << "\n";
+	}
+
+	template<typename T>
+	void Number(T v, bool comma = true)
+	{
+		ss << v;
+		if (comma) ss << ",";
+		ss << "\n";
+	}
+};
+
+inline void WriteImVec4(HvkJsonWriter& w, const ImVec4& v, bool comma = true)
+{
+	w.ss << "[ " << v.x << ", " << v.y << ", " << v.z << ", " << v.w << " ]";
+	if (comma) w.ss << ",";
+	w.ss << "\n";
+}
+
+inline std::string OldExportUser(const UserSettingsMirror& u)
+{
+	HvkJsonWriter w;
+	w.BeginObject();
+
+	w.Key("render");
+	w.BeginObject();
+	w.Key("wm_render_interval"); w.Number(u.render.wm_render_interval);
+	w.Key("target_fps"); w.Number(u.render.target_fps);
+	w.Key("bg_image_path"); w.WString(u.render.bg_image_path, false);
+	w.EndObject(true);
+
+	w.Key("binds");
+	w.BeginObject();
+	w.Key("toggle_main"); w.Number(u.binds.toggle_main);
+	w.Key("toggle_dev"); w.Number(u.binds.toggle_dev);
+	w.Key("shutdown"); w.Number(u.binds.shutdown, false);
+	w.EndObject(true);
+
+	const UserStyle& s = u.style;
+	w.Key("style");
+	w.BeginObject();
+	w.Key("wm_bg_color"); WriteImVec4(w, s.wm_bg_color);
+	w.Key("wm_text_color"); WriteImVec4(w, s.wm_text_color);
+	w.Key("wm_opacity"); w.Number(s.wm_opacity);
+	w.Key("main_bg_color"); WriteImVec4(w, s.main_bg_color);
+	w.Key("main_text_color"); WriteImVec4(w, s.main_text_color);
+	w.Key("main_border_color"); WriteImVec4(w, s.main_border_color);
+	w.Key("main_opacity"); w.Number(s.main_opacity);
+	w.Key("tabbar_text_color"); WriteImVec4(w, s.tabbar_text_color);
+	w.Key("tabbar_selected_color"); WriteImVec4(w, s.tabbar_selected_color);
+	w.Key("tabbar_inactive_opacity"); w.Number(s.tabbar_inactive_opacity);
+	w.Key("button_color"); WriteImVec4(w, s.button_color);
+	w.Key("button_text_color"); WriteImVec4(w, s.button_text_color);
+	w.Key("button_hover_color"); WriteImVec4(w, s.button_hover_color);
+	w.Key("button_hover_text_color"); WriteImVec4(w, s.button_hover_text_color);
+	w.Key("button_active_color"); WriteImVec4(w, s.button_active_color);
+	w.Key("loading_theme"); w.Number((int)s.loading_theme);
+	w.Key("bg_theme"); w.Number((int)s.bg_theme);
+	w.Key("main_secondary_color"); WriteImVec4(w, s.main_secondary_color, false);
+	w.EndObject(false);
+
+	w.EndObject();
+	return w.ss.str();
+}
+
+inline std::string OldExportSettings(const SettingsMirror& st)
+{
+	HvkJsonWriter w;
+	w.BeginObject();
+
+	w.Key("is_first_run"); w.Bool(st.is_first_run);
+	w.Key("g_MainTab"); w.Number(st.g_MainTab);
+	w.Key("vsync"); w.Bool(st.vsync);
+	w.Key("isLoading"); w.Bool(false);
+
+	w.Key("visibility");
+	w.BeginObject();
+	w.Key("win_main"); w.Bool(st.visibility.win_main);
+	w.Key("win_dev"); w.Bool(st.visibility.win_dev);
+	w.Key("win_selector"); w.Bool(st.visibility.win_selector);
+	w.Key("disk_info"); w.Bool(st.visibility.disk_info);
+	w.Key("part_info"); w.Bool(st.visibility.part_info);
+	w.Key("disk_and_part_info"); w.Bool(st.visibility.disk_and_part_info, false);
+	w.EndObject(true);
+
+	const FormatUIMirror& ui = st.fmtui.g_FormatUI;
+	w.Key("format_ui");
+	w.BeginObject();
+	w.Key("SelectedDisk"); w.Number(ui.SelectedDisk);
+	w.Key("SelectedPartition"); w.Number(ui.SelectedPartition);
+	w.Key("VolumeLabel"); w.String(ui.VolumeLabel);
+	w.Key("FileSystem"); w.Number(ui.FileSystem);
+	w.Key("QuickFormat"); w.Bool(ui.QuickFormat);
+	w.Key("ConfirmPopup"); w.Bool(ui.ConfirmPopup);
+	w.Key("ConfirmRecreate"); w.Bool(ui.ConfirmRecreate);
+	w.Key("ConfirmCreatePartition"); w.Bool(ui.ConfirmCreatePartition);
+	w.Key("ConfirmDeletePartition"); w.Bool(ui.ConfirmDeletePartition);
+	w.Key("RenameLabel"); w.String(ui.RenameLabel, false);
+	w.EndObject(true);
+
+	w.Key("themecombos");
+	w.BeginObject();
+	w.Key("LoadingThemeIdx"); w.Number(st.themecombos.LoadingThemeIdx);
+	w.Key("BgThemeIdx"); w.Number(st.themecombos.BgThemeIdx, false);
+	w.EndObject(false);
+
+	w.EndObject();
+	return w.ss.str();
+}
+
+inline ImVec4 ReadImVec4(const json& j, const ImVec4& fallback)
+{
+	if (!j.is_array() || j.size() != 4)
+		return fallback;
+	for (int i = 0; i < 4; ++i)
+		if (!j[i].is_number())
+			return fallback;
+	return ImVec4((float)j[0].get<double>(), (float)j[1].get<double>(), (float)j[2].get<double>(), (float)j[3].get<double>());
+}
+
+inline bool OldImportUser(const std::string& text, UserSettingsMirror& u)
+{
+	json j;
+	try { j = json::parse(text); }
+	catch (const std::exception&) { return false; }
+
+	if (j.contains("render"))
+	{
+		auto& r = j["render"];
+		if (r.contains("wm_render_interval")) u.render.wm_render_interval = r["wm_render_interval"];
+		if (r.contains("target_fps"))         u.render.target_fps = r["target_fps"];
+		if (r.contains("bg_image_path"))
+		{
+			std::string s = r["bg_image_path"];
+			u.render.bg_image_path = std::wstring(s.begin(), s.end());
+		}
+	}
+
+	if (j.contains("binds"))
+	{
+		auto& b = j["binds"];
+		if (b.contains("toggle_main")) u.binds.toggle_main = b["toggle_main"];
+		if (b.contains("toggle_dev"))  u.binds.toggle_dev = b["toggle_dev"];
+		if (b.contains("shutdown"))    u.binds.shutdown = b["shutdown"];
+	}
+
+	if (j.contains("style"))
+	{
+		auto& s = j["style"];
+		UserStyle& st = u.style;
+		if (s.contains("wm_bg_color"))       st.wm_bg_color = ReadImVec4(s["wm_bg_color"], st.wm_bg_color);
+		if (s.contains("wm_text_color"))     st.wm_text_color = ReadImVec4(s["wm_text_color"], st.wm_text_color);
+		if (s.contains("wm_opacity"))        st.wm_opacity = s["wm_opacity"].get<float>();
+		if (s.contains("main_bg_color"))     st.main_bg_color = ReadImVec4(s["main_bg_color"], st.main_bg_color);
+		if (s.contains("main_text_color"))   st.main_text_color = ReadImVec4(s["main_text_color"], st.main_text_color);
+		if (s.contains("main_border_color")) st.main_border_color = ReadImVec4(s["main_border_color"], st.main_border_color);
+		if (s.contains("main_opacity"))      st.main_opacity = s["main_opacity"].get<float>();
+		if (s.contains("loading_theme"))     st.loading_theme = (LoadingTheme)s["loading_theme"].get<int>();
+		if (s.contains("bg_theme"))          st.bg_theme = (BgTheme)s["bg_theme"].get<int>();
+		if (s.contains("main_secondary_color"))
+			st.main_secondary_color = ReadImVec4(s["main_secondary_color"], st.main_secondary_color);
+	}
+	return true;
+}
+
+inline bool OldImportSettings(const std::string& text, SettingsMirror& st)
+{
+	json j;
+	try { j = json::parse(text); }
+	catch (...) { return false; }
+
+	if (j.contains("is_first_run")) st.is_first_run = j["is_first_run"];
+	if (j.contains("g_MainTab"))    st.g_MainTab = j["g_MainTab"];
+	if (j.contains("vsync"))        st.vsync = j["vsync"];
+
+	if (j.contains("visibility"))
+	{
+		auto& v = j["visibility"];
+		if (v.contains("win_main")) st.visibility.win_main = v["win_main"];
+		if (v.contains("win_dev")) st.visibility.win_dev = v["win_dev"];
+		if (v.contains("win_selector")) st.visibility.win_selector = v["win_selector"];
+		if (v.contains("disk_info")) st.visibility.disk_info = v["disk_info"];
+		if (v.contains("part_info")) st.visibility.part_info = v["part_info"];
+		if (v.contains("disk_and_part_info")) st.visibility.disk_and_part_info = v["disk_and_part_info"];
+	}
+
+	if (j.contains("format_ui"))
+	{
+		auto& f = j["format_ui"];
+		auto& ui = st.fmtui.g_FormatUI;
+		if (f.contains("SelectedDisk")) ui.SelectedDisk = f["SelectedDisk"];
+		if (f.contains("SelectedPartition")) ui.SelectedPartition = f["SelectedPartition"];
+		if (f.contains("VolumeLabel"))
+			snprintf(ui.VolumeLabel, sizeof(ui.VolumeLabel), "%s", f["VolumeLabel"].get<std::string>().c_str());
+		if (f.contains("FileSystem")) ui.FileSystem = f["FileSystem"];
+		if (f.contains("QuickFormat")) ui.QuickFormat = f["QuickFormat"];
+		if (f.contains("ConfirmPopup")) ui.ConfirmPopup = f["ConfirmPopup"];
+		if (f.contains("ConfirmRecreate")) ui.ConfirmRecreate = f["ConfirmRecreate"];
+		if (f.contains("ConfirmCreatePartition")) ui.ConfirmCreatePartition = f["ConfirmCreatePartition"];
+		if (f.contains("ConfirmDeletePartition")) ui.ConfirmDeletePartition = f["ConfirmDeletePartition"];
+		if (f.contains("RenameLabel"))
+			snprintf(ui.RenameLabel, sizeof(ui.RenameLabel), "%s", f["RenameLabel"].get<std::string>().c_str());
+	}
+
+	if (j.contains("themecombos"))
+	{
+		auto& t = j["themecombos"];
+		if (t.contains("LoadingThemeIdx")) st.themecombos.LoadingThemeIdx = t["LoadingThemeIdx"];
+		if (t.contains("BgThemeIdx")) st.themecombos.BgThemeIdx = t["BgThemeIdx"];
+	}
+	return true;
+}
@@ -0,0 +1,142 @@
+// HvkFontCache::Prewarm (user-048) over glyph counts, sizes and thread
+// counts, next to loading the same glyphs one by one as a frame would
+// (FindGlyph per codepoint, which rasterizes on the calling thread). Every
+// run is its own forked process with an empty cache and a fresh atlas.
+//
+// Checks that whatever the thread count, the prewarmed atlas has the same
+// glyph metrics and the same pixels as the serial one: Prewarm packs in
+// codepoint order so the layout can't depend on which thread finished first.
+//
+//   prewarm_bench            median of 5 runs per cell
+//   prewarm_bench --quick    1 run per cell (what ctest runs)
+
+#include "hvk_font_cache.h"
+#include "asset_vfs.h"
+#include "hash.h"
+#include "imgui_headless.h"
+#include "imgui_internal.h"
+#include "forked.h"
+#include "check.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	struct Range
+	{
+		const char* Name;
+		ImWchar Ranges[3];
+	};
+
+	const Range kRanges[] = {
+		{ "ASCII", { 0x0020, 0x007E, 0 } },
+		{ "Latin-1", { 0x0020, 0x00FF, 0 } },
+		{ "Latin Ext-A/B", { 0x0020, 0x024F, 0 } },
+	};
+	const float kSizes[] = { 13.0f, 40.0f, 96.0f };
+	const int kThreads[] = { 1, 2, 4, 8 };
+
+	struct RunResult
+	{
+		double Ms = 0.0;
+		int Glyphs = 0;
+		uint64_t MetricsDigest = 0;
+		uint64_t PixelsDigest = 0;
+	};
+
+	// threads 0: serial, glyph by glyph
+	RunResult Run(const Range& range, float size, int threads)
+	{
+		CreateHeadlessContext();
+		ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+		HvkFontCache::Install(atlas);
+
+		AssetData data;
+		CHECK(AssetVfs::Read("fonts/satoshi/Satoshi-Regular.otf", data));
+		ImFontConfig config;
+		config.FontDataOwnedByAtlas = false;
+		ImFont* font = atlas->AddFontFromMemoryTTF((void*)data.Data, (int)data.Size, 13.0f, &config);
+		ImFontBaked* baked = font->GetFontBaked(size);   // the fallback glyphs, outside the timing
+
+		RunResult r;
+		const auto t = std::chrono::steady_clock::now();
+		if (threads == 0)
+		{
+			for (unsigned c = range.Ranges[0]; c <= range.Ranges[1]; ++c)
+				baked->FindGlyph((ImWchar)c);
+		}
+		else
+		{
+			HvkFontCache::Prewarm(font, size, range.Ranges, threads);
+		}
+		r.Ms = ElapsedMs(t);
+
+		uint64_t h = 0;
+		for (const ImFontGlyph& g : baked->Glyphs)
+		{
+			const float m[] = { (float)g.Codepoint, (float)g.Visible, g.AdvanceX, g.X0, g.Y0, g.X1, g.Y1, g.U0, g.V0, g.U1, g.V1 };
+			h = HashService::Fast64(m, sizeof(m), h);
+		}
+		r.Glyphs = baked->Glyphs.Size;
+		r.MetricsDigest = h;
+		ImTextureData* tex = atlas->TexData;
+		r.PixelsDigest = HashService::Fast64(tex->GetPixels(), (size_t)tex->GetSizeInBytes());
+
+		ImGui::DestroyContext();
+		return r;
+	}
+
+	RunResult Median(const Range& range, float size, int threads, int runs)
+	{
+		std::vector<RunResult> all(runs);
+		for (RunResult& r : all)
+			CHECK(RunForked([&] { return Run(range, size, threads); }, r));
+
+		for (const RunResult& r : all)
+		{
+			CHECK_EQ(r.MetricsDigest, all[0].MetricsDigest);
+			CHECK_EQ(r.PixelsDigest, all[0].PixelsDigest);
+		}
+		std::sort(all.begin(), all.end(), [](const RunResult& a, const RunResult& b) { return a.Ms < b.Ms; });
+		return all[all.size() / 2];
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+	const int runs = quick ? 1 : 5;
+
+	AssetVfs::SetRoot(fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded");
+
+	std::printf("%-14s %5s %6s %9s", "range", "size", "glyphs", "serial");
+	for (int threads : kThreads)
+		std::printf("  %6d thr", threads);
+	std::printf("   (ms, %u cores)\n", std::max(1u, std::thread::hardware_concurrency()));
+
+	for (const Range& range : kRanges)
+	{
+		for (float size : kSizes)
+		{
+			const RunResult serial = Median(range, size, 0, runs);
+			std::printf("%-14s %5.0f %6d %9.2f", range.Name, size, serial.Glyphs, serial.Ms);
+
+			for (int threads : kThreads)
+			{
+				const RunResult r = Median(range, size, threads, runs);
+				std::printf("  %10.2f", r.Ms);
+
+				CHECK_EQ(r.Glyphs, serial.Glyphs);
+				CHECK_EQ(r.MetricsDigest, serial.MetricsDigest);
+				CHECK_EQ(r.PixelsDigest, serial.PixelsDigest);
+			}
+			std::printf("\n");
+		}
+	}
+
+	return CheckResult();
+}
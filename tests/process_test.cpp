@@ -0,0 +1,131 @@
+// ProcessRunner, POSIX backend: output streaming, the drain at exit,
+// timeout and cancel, and a consumer that stops reading.
+
+#include "process.h"
+#include "check.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	ProcessRequest Shell(const std::string& script, uint32_t timeoutMs = 0)
+	{
+		ProcessRequest req;
+		req.Program = "/bin/sh";
+		req.Args = { "-c", script };
+		req.TimeoutMs = timeoutMs;
+		return req;
+	}
+
+	std::vector<ProcessLine> Drain(const std::shared_ptr<ProcessJob>& job)
+	{
+		std::vector<ProcessLine> lines;
+		ProcessLine line;
+		for (;;)
+		{
+			const bool done = job->Done();
+			while (job->PopLine(line))
+				lines.push_back(line);
+			if (done)
+				return lines;
+			job->WaitFor(5);
+		}
+	}
+
+	// more lines than the queue holds, so the worker has to block on the consumer
+	void StreamsEveryLineInOrder()
+	{
+		auto job = ProcessRunner::Start(Shell("i=0; while [ $i -lt 5000 ]; do echo line$i; i=$((i+1)); done"));
+		auto lines = Drain(job);
+
+		CHECK(job->Succeeded());
+		CHECK_EQ(lines.size(), 5000u);
+		bool ordered = true;
+		for (size_t i = 0; i < lines.size(); ++i)
+			ordered &= lines[i].Stream == ProcessStream::Stdout && lines[i].Text == "line" + std::to_string(i);
+		CHECK(ordered);
+		CHECK_EQ(job->DroppedLines(), 0u);
+	}
+
+	// output written right before exit, without a trailing newline, still arrives
+	void DrainsOutputAtExit()
+	{
+		auto job = ProcessRunner::Start(Shell("echo out; printf 'err-tail' >&2; printf 'out-tail'; exit 3"));
+		auto lines = Drain(job);
+
+		CHECK_EQ(job->State(), ProcessState::Exited);
+		CHECK_EQ(job->ExitCode(), 3);
+
+		std::vector<std::string> out, err;
+		for (auto& l : lines)
+			(l.Stream == ProcessStream::Stdout ? out : err).push_back(l.Text);
+		CHECK(out == std::vector<std::string>({ "out", "out-tail" }));
+		CHECK(err == std::vector<std::string>({ "err-tail" }));
+	}
+
+	// the child closes its pipes and keeps running: the timeout must still fire
+	void TimeoutAfterPipesClose()
+	{
+		auto start = std::chrono::steady_clock::now();
+		auto job = ProcessRunner::Start(Shell("exec >/dev/null 2>&1; sleep 10", 200));
+		CHECK(job->WaitFor(3000));
+
+		CHECK_EQ(job->State(), ProcessState::TimedOut);
+		CHECK(ElapsedMs(start) < 2000);
+	}
+
+	void CancelKillsChild()
+	{
+		auto start = std::chrono::steady_clock::now();
+		auto job = ProcessRunner::Start(Shell("echo started; sleep 10"));
+
+		ProcessLine line;
+		while (!job->PopLine(line) && ElapsedMs(start) < 2000)
+			job->WaitFor(5);
+		job->Cancel();
+
+		CHECK(job->WaitFor(3000));
+		CHECK_EQ(job->State(), ProcessState::Cancelled);
+		CHECK(ElapsedMs(start) < 2000);
+	}
+
+	void MissingProgram()
+	{
+		ProcessRequest req;
+		req.Program = "/nonexistent/hvk-test-binary";
+		auto job = ProcessRunner::Start(req);
+		Drain(job);
+
+		CHECK(!job->Succeeded());
+		CHECK_EQ(job->ExitCode(), 127);
+	}
+
+	// nobody reads: the worker gives up after kConsumerStallMs, drops the rest
+	// and still reaps the child instead of spinning forever
+	void StalledConsumerDoesNotHang()
+	{
+		auto start = std::chrono::steady_clock::now();
+		auto job = ProcessRunner::Start(Shell("i=0; while [ $i -lt 3000 ]; do echo line$i; i=$((i+1)); done"));
+
+		CHECK(job->WaitFor(ProcessRunner::kConsumerStallMs + 5000));
+		CHECK(job->Succeeded());
+		CHECK(job->DroppedLines() > 0);
+		CHECK(ElapsedMs(start) < ProcessRunner::kConsumerStallMs + 5000);
+
+		// what was queued before the stall is intact
+		ProcessLine line;
+		CHECK(job->PopLine(line) && line.Text == "line0");
+	}
+}
+
+int main()
+{
+	StreamsEveryLineInOrder();
+	DrainsOutputAtExit();
+	TimeoutAfterPipesClose();
+	CancelKillsChild();
+	MissingProgram();
+	StalledConsumerDoesNotHang();
+	return CheckResult();
+}
@@ -0,0 +1,239 @@
+// HvkSdfText on Linux: the generated fields against the atlas's own
+// rasterizer as the reference image (the field's outline is where the
+// rasterized glyph's coverage is), a label drawn as one distance field draw
+// command, and a glyph the atlas has no room for being given up on once
+// instead of regenerated every frame.
+
+#include "hvk_sdf.h"
+#include "imgui_headless.h"
+#include "imgui_internal.h"
+#include "check.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	std::vector<unsigned char> ReadFile(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return { std::istreambuf_iterator<char>(in), {} };
+	}
+
+	ImFont* AddFont(std::vector<unsigned char>& data, float size)
+	{
+		ImFontConfig config;
+		config.FontDataOwnedByAtlas = false;
+		config.OversampleH = config.OversampleV = 1;
+		return ImGui::GetIO().Fonts->AddFontFromMemoryTTF(data.data(), (int)data.size(), size, &config);
+	}
+
+	// Printable ASCII at kBaseSize: the field thresholded at kEdge against the rasterized
+	// coverage (intersection over union, over all glyphs: a one pixel rounding difference
+	// halves it for a '.'), and the field read as coverage the way the shader does at 1:1
+	// against the coverage itself, overall and for the worst glyph
+	void MatchesRasterizer(std::vector<unsigned char>& data)
+	{
+		CreateHeadlessContext();
+		ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+		ImFont* font = AddFont(data, HvkSdfText::kBaseSize);
+
+		ImGui::NewFrame();
+		ImFontBaked* baked = font->GetFontBaked(HvkSdfText::kBaseSize);
+		ImGui::EndFrame();
+
+		int glyphs = 0;
+		long inter = 0, uni = 0, pixels = 0;
+		double diff = 0.0, worstDiff = 0.0;
+		for (unsigned c = 33; c < 127; ++c)
+		{
+			HvkSdfGlyph sdf;
+			CHECK(HvkSdfText::GenerateGlyph(data.data(), 0, c, sdf));
+			const ImFontGlyph* ref = baked->FindGlyph((ImWchar)c);
+			if (sdf.Pixels.empty() || !ref || !ref->Visible)
+				continue;
+
+			ImFontAtlasRect r;
+			CHECK(atlas->GetCustomRect((ImFontAtlasRectId)ref->PackId, &r));
+			ImTextureData* tex = atlas->TexData;
+			auto coverage = [&](int x, int y)
+				{
+					if (x < 0 || y < 0 || x >= r.w || y >= r.h)
+						return 0.0f;
+					const unsigned char* p = (const unsigned char*)tex->GetPixelsAt(r.x + x, r.y + y);
+					return p[tex->BytesPerPixel - 1] / 255.0f;
+				};
+			auto field = [&](int x, int y)
+				{
+					if (x < 0 || y < 0 || x >= sdf.Width || y >= sdf.Height)
+						return 0;
+					return (int)sdf.Pixels[(size_t)y * sdf.Width + x];
+				};
+
+			// over a box around the glyph, in pixels from the pen position on the baseline
+			int counted = 0;
+			double glyphDiff = 0.0;
+			for (int y = -40; y < 40; ++y)
+			{
+				for (int x = -20; x < 60; ++x)
+				{
+					const float px = x + 0.5f, py = y + 0.5f;
+					const int fv = field((int)std::floor(px - sdf.X0), (int)std::floor(py - sdf.Y0));
+					const float cov = coverage((int)std::floor(px - ref->X0), (int)std::floor(py + baked->Ascent - ref->Y0));
+
+					const bool a = fv >= HvkSdfText::kEdge, b = cov >= 0.5f;
+					inter += a && b;
+					uni += a || b;
+
+					const float fcov = ImSaturate((fv - HvkSdfText::kEdge) / ((float)HvkSdfText::kEdge / HvkSdfText::kSpread) + 0.5f);
+					if (fcov > 0.0f || cov > 0.0f)
+					{
+						glyphDiff += std::fabs(fcov - cov);
+						++counted;
+					}
+				}
+			}
+
+			++glyphs;
+			worstDiff = ImMax(worstDiff, counted ? glyphDiff / counted : 0.0);
+			diff += glyphDiff;
+			pixels += counted;
+		}
+
+		const double iou = uni ? (double)inter / uni : 0.0;
+		const double meanDiff = pixels ? diff / pixels : 1.0;
+		std::printf("%d glyphs: IoU %.3f, mean coverage difference %.1f%%, worst glyph %.1f%%\n",
+			glyphs, iou, meanDiff * 100.0, worstDiff * 100.0);
+		CHECK(glyphs > 90);
+		CHECK(iou > 0.85);
+		CHECK(meanDiff < 0.05);
+		CHECK(worstDiff < 0.10);
+
+		ImGui::DestroyContext();
+	}
+
+	int CountSdfCommands(ImDrawList* drawList)
+	{
+		int n = 0;
+		for (const ImDrawCmd& cmd : drawList->CmdBuffer)
+			n += ImTextureIdHasSdf(cmd.GetTexID()) ? 1 : 0;
+		return n;
+	}
+
+	// Fill and glow for a two line label: one draw command, a quad per visible glyph
+	void OneDrawCommand(std::vector<unsigned char>& data)
+	{
+		CreateHeadlessContext();
+		ImFont* font = AddFont(data, 13.0f);
+
+		const char* label = "Hello, glow!\nline2";
+		int visible = 0;
+		for (const char* s = label; *s; ++s)
+			visible += *s != ' ' && *s != '\n';
+
+		// the first frame generates the fields, which can grow the atlas before the renderer saw it
+		for (int frame = 0; frame < 3; ++frame)
+		{
+			ImGui::NewFrame();
+			ImGui::SetNextWindowPos(ImVec2(0, 0));
+			ImGui::SetNextWindowSize(ImVec2(400, 300));
+			ImGui::Begin("w");
+			ImDrawList* drawList = ImGui::GetWindowDrawList();
+			const int vtx = drawList->VtxBuffer.Size;
+
+			HvkSdfStyle style;
+			style.GlowColor = IM_COL32(255, 0, 0, 255);
+			style.GlowWidth = 6.0f;
+			const bool drawn = HvkSdfText::AddText(drawList, font, 32.0f, ImVec2(10, 10), IM_COL32_WHITE, label, nullptr, style);
+			const int sdfVtx = drawList->VtxBuffer.Size - vtx;
+
+			// ordinary text after it goes back to the atlas texture
+			drawList->AddText(ImVec2(10, 100), IM_COL32_WHITE, "after");
+
+			if (frame > 0)
+			{
+				CHECK(drawn);
+				CHECK_EQ(sdfVtx, visible * 4);
+				CHECK_EQ(CountSdfCommands(drawList), 1);
+				CHECK(!ImTextureIdHasSdf(drawList->CmdBuffer.back().GetTexID()));
+				CHECK(drawList->VtxBuffer.Size - vtx > sdfVtx);
+			}
+			ImGui::End();
+			ImGui::Render();
+			StandInRenderer();
+		}
+
+		const SdfStats stats = HvkSdfText::Stats();
+		HvkSdfText::Clear();
+		ImGui::DestroyContext();
+
+		// one field per distinct glyph, all of them on the first frame
+		CHECK(stats.Generated >= 12 && stats.Generated <= 16);
+		CHECK_EQ(stats.NoRoom, (uint64_t)0);
+	}
+
+	// An atlas that can't grow past 128x128: the glyphs that don't fit make AddText
+	// fall back, and later frames don't compute their fields again
+	void NoRoomNotRetried(std::vector<unsigned char>& data)
+	{
+		CreateHeadlessContext();
+		ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+		atlas->TexMinWidth = atlas->TexMaxWidth = 128;
+		atlas->TexMinHeight = atlas->TexMaxHeight = 128;
+		ImFont* font = AddFont(data, 13.0f);
+
+		const char* label = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		const SdfStats before = HvkSdfText::Stats();
+		uint64_t afterFirst = 0;
+		for (int frame = 0; frame < 5; ++frame)
+		{
+			ImGui::NewFrame();
+			ImGui::Begin("w");
+			const bool drawn = HvkSdfText::AddText(ImGui::GetWindowDrawList(), font, 24.0f, ImVec2(0, 0), IM_COL32_WHITE, label);
+			CHECK(!drawn);
+			ImGui::End();
+			ImGui::Render();
+			StandInRenderer();
+
+			if (frame == 0)
+				afterFirst = HvkSdfText::Stats().Generated;
+		}
+
+		const SdfStats after = HvkSdfText::Stats();
+		std::printf("128x128 atlas: %llu fields generated, %llu had no room\n",
+			(unsigned long long)(after.Generated - before.Generated), (unsigned long long)(after.NoRoom - before.NoRoom));
+		CHECK(after.NoRoom > before.NoRoom);
+		CHECK_EQ(after.Generated, afterFirst);
+
+		// Clear() forgets them, so a reloaded font gets another try
+		HvkSdfText::Clear();
+		ImGui::NewFrame();
+		ImGui::Begin("w");
+		HvkSdfText::AddText(ImGui::GetWindowDrawList(), font, 24.0f, ImVec2(0, 0), IM_COL32_WHITE, label);
+		ImGui::End();
+		ImGui::Render();
+		StandInRenderer();
+		CHECK(HvkSdfText::Stats().Generated > afterFirst);
+
+		HvkSdfText::Clear();
+		ImGui::DestroyContext();
+	}
+}
+
+int main()
+{
+	std::vector<unsigned char> data = ReadFile(fs::path(HVK_ROOT) / "misc" / "hvkpack" / "embedded" / "fonts" / "satoshi" / "Satoshi-Regular.otf");
+	CHECK(!data.empty());
+	if (data.empty())
+		return CheckResult();
+
+	HvkSdfText::SetRendererSupport(true);
+	MatchesRasterizer(data);
+	OneDrawCommand(data);
+	NoRoomNotRetried(data);
+	return CheckResult();
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "hvk_schema.h"
+#include "../example_win32_directx12/user_style.h"
+
+#include <string>
+
+// c_usersettings and c_settings as the .hvk files see them, with the same
+// field tables as settings.cpp. settings.h pulls in the Windows headers, so
+// the Linux benchmarks carry this copy; keep it in step with settings.cpp.
+
+struct UserSettingsMirror
+{
+	struct {
+		int wm_render_interval = 1000;
+		int target_fps = 60;
+		std::wstring bg_image_path = L"C:\\Users\\user\\AppData\\Local\\PSHVK\\assets\\Galaxy_Purple.png";
+	} render;
+
+	struct {
+		int toggle_main = 0x2D; // VK_INSERT
+		int toggle_dev = 0x71;  // VK_F2
+		int shutdown = 0x23;    // VK_END
+	} binds;
+
+	UserStyle style;
+};
+
+struct FormatUIMirror
+{
+	int SelectedDisk = -1;
+	int SelectedPartition = -1;
+	char VolumeLabel[32] = "";
+	int FileSystem = 0;
+	bool QuickFormat = true;
+	bool ConfirmPopup = false;           // these four are written by the old
+	bool ConfirmRecreate = false;        // HvkJsonWriter export only
+	bool ConfirmCreatePartition = false;
+	bool ConfirmDeletePartition = false;
+	char RenameLabel[32] = "";
+};
+
+struct SettingsMirror
+{
+	bool is_first_run = false;
+	int g_MainTab = 0;
+	bool vsync = true;
+
+	struct {
+		bool win_main = true;
+		bool win_dev = false;
+		bool win_selector = false;
+		bool disk_info = false;
+		bool part_info = false;
+		bool disk_and_part_info = false;
+	} visibility;
+
+	struct {
+		FormatUIMirror g_FormatUI;
+	} fmtui;
+
+	struct {
+		int LoadingThemeIdx = 0;
+		int BgThemeIdx = 1;
+	} themecombos;
+};
+
+namespace SettingsTables
+{
+	using UserRender = decltype(UserSettingsMirror::render);
+	using UserBinds = decltype(UserSettingsMirror::binds);
+
+	inline constexpr HvkField kUserRender[] =
+	{
+		HVK_FIELD(UserRender, wm_render_interval),
+		HVK_FIELD(UserRender, target_fps),
+		HVK_FIELD(UserRender, bg_image_path),
+	};
+
+	inline constexpr HvkField kUserBinds[] =
+	{
+		HVK_FIELD(UserBinds, toggle_main),
+		HVK_FIELD(UserBinds, toggle_dev),
+		HVK_FIELD(UserBinds, shutdown),
+	};
+
+	inline constexpr HvkField kUserStyle[] =
+	{
+		HVK_FIELD(UserStyle, wm_bg_color),
+		HVK_FIELD(UserStyle, wm_text_color),
+		HVK_FIELD(UserStyle, wm_opacity),
+		HVK_FIELD(UserStyle, main_bg_color),
+		HVK_FIELD(UserStyle, main_text_color),
+		HVK_FIELD(UserStyle, main_border_color),
+		HVK_FIELD(UserStyle, main_opacity),
+		HVK_FIELD(UserStyle, tabbar_text_color),
+		HVK_FIELD(UserStyle, tabbar_selected_color),
+		HVK_FIELD(UserStyle, tabbar_inactive_opacity),
+		HVK_FIELD(UserStyle, button_color),
+		HVK_FIELD(UserStyle, button_text_color),
+		HVK_FIELD(UserStyle, button_hover_color),
+		HVK_FIELD(UserStyle, button_hover_text_color),
+		HVK_FIELD(UserStyle, button_active_color),
+		HVK_FIELD(UserStyle, loading_theme),
+		HVK_FIELD(UserStyle, bg_theme),
+		HVK_FIELD(UserStyle, main_secondary_color),
+	};
+
+	inline constexpr HvkField kUserSettings[] =
+	{
+		HVK_OBJECT(UserSettingsMirror, render, "render", kUserRender),
+		HVK_OBJECT(UserSettingsMirror, binds, "binds", kUserBinds),
+		HVK_OBJECT(UserSettingsMirror, style, "style", kUserStyle),
+	};
+
+	using SettingsVisibility = decltype(SettingsMirror::visibility);
+	using SettingsThemeCombos = decltype(SettingsMirror::themecombos);
+
+	inline constexpr HvkField kVisibility[] =
+	{
+		HVK_FIELD(SettingsVisibility, win_main),
+		HVK_FIELD(SettingsVisibility, win_dev),
+		HVK_FIELD(SettingsVisibility, win_selector),
+		HVK_FIELD(SettingsVisibility, disk_info),
+		HVK_FIELD(SettingsVisibility, part_info),
+		HVK_FIELD(SettingsVisibility, disk_and_part_info),
+	};
+
+	inline constexpr HvkField kFormatUI[] =
+	{
+		HVK_FIELD(FormatUIMirror, SelectedDisk),
+		HVK_FIELD(FormatUIMirror, SelectedPartition),
+		HVK_FIELD(FormatUIMirror, VolumeLabel),
+		HVK_FIELD(FormatUIMirror, FileSystem),
+		HVK_FIELD(FormatUIMirror, QuickFormat),
+		HVK_FIELD(FormatUIMirror, RenameLabel),
+	};
+
+	inline constexpr HvkField kThemeCombos[] =
+	{
+		HVK_FIELD(SettingsThemeCombos, LoadingThemeIdx),
+		HVK_FIELD(SettingsThemeCombos, BgThemeIdx),
+	};
+
+	inline constexpr HvkField kSettings[] =
+	{
+		HVK_FIELD(SettingsMirror, is_first_run),
+		HVK_FIELD(SettingsMirror, g_MainTab),
+		HVK_FIELD(SettingsMirror, vsync),
+		HVK_OBJECT(SettingsMirror, visibility, "visibility", kVisibility),
+		HVK_OBJECT_AT(SettingsMirror, fmtui.g_FormatUI, "format_ui", kFormatUI),
+		HVK_OBJECT(SettingsMirror, themecombos, "themecombos", kThemeCombos),
+	};
+}
@@ -0,0 +1,238 @@
+// TaskGraph on synthetic graphs: every task runs after all of its
+// dependencies and exactly once, Main tasks stay on the Wait() thread, a
+// failure or a cancel skips what depends on it and nothing else, and the
+// timeline it records agrees with what ran. Built a second time with
+// -fsanitize=thread (task_graph_tsan) when the compiler supports it.
+
+#include "task_graph.h"
+#include "check.h"
+#include "json.hpp"
+
+#include <random>
+
+namespace
+{
+	struct Synthetic
+	{
+		std::vector<std::vector<int>> Deps;
+		std::vector<TaskAffinity> Affinity;
+	};
+
+	// Each task waits on up to 4 earlier ones; about one in ten is a Main task
+	Synthetic MakeGraph(uint32_t seed, int count)
+	{
+		std::mt19937 rng(seed);
+		Synthetic g;
+		for (int id = 0; id < count; ++id)
+		{
+			std::vector<int> deps;
+			const int n = id ? (int)(rng() % 5) : 0;
+			for (int i = 0; i < n; ++i)
+				deps.push_back((int)(rng() % id));
+			g.Deps.push_back(deps);
+			g.Affinity.push_back(rng() % 10 == 0 ? TaskAffinity::Main : TaskAffinity::Worker);
+		}
+		return g;
+	}
+
+	void RandomGraphs()
+	{
+		for (uint32_t seed = 1; seed <= 20; ++seed)
+		{
+			const Synthetic g = MakeGraph(seed, 200);
+			const std::thread::id mainThread = std::this_thread::get_id();
+
+			std::vector<std::atomic<int>> runs(g.Deps.size());
+			std::atomic<int> early{ 0 };
+			std::atomic<int> offMain{ 0 };
+
+			TaskGraph graph;
+			for (int id = 0; id < (int)g.Deps.size(); ++id)
+			{
+				const int added = graph.Add("t" + std::to_string(id), [&, id]()
+					{
+						for (int d : g.Deps[id])
+							early += runs[d].load() == 1 ? 0 : 1;
+						if (g.Affinity[id] == TaskAffinity::Main && std::this_thread::get_id() != mainThread)
+							++offMain;
+						++runs[id];
+						return true;
+					}, g.Deps[id], g.Affinity[id]);
+				CHECK_EQ(added, id);
+			}
+
+			// progress is read from the UI thread while the graph runs
+			std::atomic<bool> stop{ false };
+			std::thread watcher([&]
+				{
+					while (!stop.load())
+					{
+						CHECK(graph.Completed() <= graph.Count());
+						graph.Finished();
+						graph.Summary();
+					}
+				});
+
+			CHECK(graph.Run(4));
+			stop.store(true);
+			watcher.join();
+
+			CHECK(graph.Finished());
+			CHECK_EQ(graph.Completed(), g.Deps.size());
+			CHECK_EQ(early.load(), 0);
+			CHECK_EQ(offMain.load(), 0);
+			for (auto& r : runs)
+				CHECK_EQ(r.load(), 1);
+
+			const auto timings = graph.Timings();
+			for (int id = 0; id < (int)timings.size(); ++id)
+			{
+				CHECK(timings[id].State == TaskState::Done);
+				CHECK(timings[id].Affinity != TaskAffinity::Main || timings[id].Worker == 0);
+				for (int d : g.Deps[id])
+				{
+					CHECK(timings[id].ReadyMs >= timings[d].EndMs);
+					CHECK(timings[id].StartMs >= timings[d].EndMs);
+				}
+			}
+		}
+	}
+
+	// a -> b -> c and a -> d fail with a; e doesn't care
+	void FailureSkipsDependents()
+	{
+		TaskGraph graph;
+		std::atomic<int> ran{ 0 };
+		const int a = graph.Add("a", [] { return false; });
+		const int b = graph.Add("b", [&] { ++ran; return true; }, { a });
+		const int c = graph.Add("c", [&] { ++ran; return true; }, { b }, TaskAffinity::Main);
+		const int d = graph.Add("d", [&] { ++ran; return true; }, { a, b });
+		const int e = graph.Add("e", [&] { ++ran; return true; });
+		const int f = graph.Add("f", []() -> bool { throw std::runtime_error("boom"); });
+		const int g = graph.Add("g", [&] { ++ran; return true; }, { e, f });
+
+		CHECK(!graph.Run(3));
+		CHECK_EQ(ran.load(), 1);
+		CHECK(graph.State(a) == TaskState::Failed);
+		CHECK(graph.State(b) == TaskState::Skipped);
+		CHECK(graph.State(c) == TaskState::Skipped);
+		CHECK(graph.State(d) == TaskState::Skipped);
+		CHECK(graph.State(e) == TaskState::Done);
+		CHECK(graph.State(f) == TaskState::Failed);
+		CHECK(graph.State(g) == TaskState::Skipped);
+
+		const auto timings = graph.Timings();
+		CHECK(timings[f].Error == "boom");
+		CHECK(timings[b].Error.find("'a'") != std::string::npos);
+	}
+
+	// Cancelled while one task runs: it finishes, nothing after it starts
+	void CancelSkipsPending()
+	{
+		TaskGraph graph;
+		std::mutex m;
+		std::condition_variable cv;
+		bool entered = false, release = false;
+		std::atomic<int> ran{ 0 };
+
+		const int gate = graph.Add("gate", [&]
+			{
+				std::unique_lock<std::mutex> lock(m);
+				entered = true;
+				cv.notify_all();
+				cv.wait(lock, [&] { return release; });
+				return true;
+			});
+		for (int i = 0; i < 20; ++i)
+			graph.Add("after", [&] { ++ran; return true; }, { gate }, i % 4 ? TaskAffinity::Worker : TaskAffinity::Main);
+
+		graph.Start(2);
+		{
+			std::unique_lock<std::mutex> lock(m);
+			cv.wait(lock, [&] { return entered; });
+			graph.Cancel();
+			release = true;
+			cv.notify_all();
+		}
+
+		CHECK(!graph.Wait());
+		CHECK_EQ(ran.load(), 0);
+		CHECK(graph.State(gate) == TaskState::Done);
+		CHECK(graph.Finished());
+		for (int id = 1; id <= 20; ++id)
+			CHECK(graph.State(id) == TaskState::Skipped);
+	}
+
+	// Independent tasks overlap: 8 x 20 ms on 4 threads is about 40 ms, not 160
+	void RunsInParallel()
+	{
+		TaskGraph graph;
+		for (int i = 0; i < 8; ++i)
+			graph.Add("sleep", [] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); return true; });
+
+		const auto t = std::chrono::steady_clock::now();
+		CHECK(graph.Run(4));
+		const double ms = ElapsedMs(t);
+		CHECK(ms < 120.0);
+		std::printf("8 x 20 ms on 4 threads: %.1f ms\n", ms);
+	}
+
+	void RejectsBadGraphs()
+	{
+		TaskGraph graph;
+		const int a = graph.Add("a", [] { return true; });
+		CHECK_EQ(graph.Add("self", [] { return true; }, { 1 }), -1);
+		CHECK_EQ(graph.Add("negative", [] { return true; }, { -1 }), -1);
+		CHECK_EQ(graph.Add("b", [] { return true; }, { a, a }), 1);
+		CHECK(graph.Run(1));
+		CHECK_EQ(graph.Add("late", [] { return true; }), -1);
+		CHECK_EQ(graph.Count(), (size_t)2);
+	}
+
+	// Every task that ran is one "X" event on its thread; skipped ones and marks are instants
+	void TraceMatchesTimings()
+	{
+		TaskGraph graph;
+		const int a = graph.Add("load \"fonts\"", [] { return true; });
+		graph.Add("device", [] { return true; }, { a }, TaskAffinity::Main);
+		const int bad = graph.Add("probe", [] { return false; });
+		graph.Add("after probe", [] { return true; }, { bad });
+		graph.Run(2);
+		graph.Mark("first frame");
+
+		const auto trace = nlohmann::json::parse(graph.ChromeTrace(), nullptr, false);
+		CHECK(!trace.is_discarded());
+		if (trace.is_discarded())
+			return;
+
+		int complete = 0, instant = 0;
+		for (const auto& e : trace["traceEvents"])
+		{
+			const std::string ph = e["ph"];
+			if (ph == "X")
+			{
+				++complete;
+				CHECK(e["dur"].get<double>() >= 0.0);
+				if (e["name"] == "device")
+					CHECK_EQ(e["tid"].get<int>(), 0);
+			}
+			else if (ph == "i")
+			{
+				++instant;
+			}
+		}
+		CHECK_EQ(complete, 3);
+		CHECK_EQ(instant, 2);
+	}
+}
+
+int main()
+{
+	RandomGraphs();
+	FailureSkipsDependents();
+	CancelSkipsPending();
+	RunsInParallel();
+	RejectsBadGraphs();
+	TraceMatchesTimings();
+	return CheckResult();
+}
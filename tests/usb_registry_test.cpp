@@ -0,0 +1,152 @@
+// UsbRegistry against a recorded enumeration table: records in the shape
+// USBHelper::EnumerateUsbDisks produces for common hardware, replayed through
+// the hot-plug sequences WM_DEVICECHANGE delivers.
+
+#include "usb_registry.h"
+#include "check.h"
+
+#include <cstring>
+
+namespace
+{
+	GUID Container(uint32_t d1)
+	{
+		GUID g{};
+		g.Data1 = d1;
+		g.Data2 = 0x11e8;
+		g.Data3 = 0x8c5a;
+		memcpy(g.Data4, "\x80\x6e\x6f\x6e\x69\x63\x00\x01", 8);
+		return g;
+	}
+
+	UsbDeviceRecord Record(uint32_t number, const char* instance, const char* letters, const char* vid, const char* pid,
+		const char* serial, const char* manufacturer, const char* product, uint32_t container)
+	{
+		UsbDeviceRecord r;
+		r.DeviceNumber = number;
+		r.InstanceId = instance;
+		for (const char* l = letters; *l; ++l)
+			r.Letters.push_back(*l);
+		r.Sig.vid = vid;
+		r.Sig.pid = pid;
+		r.Sig.serial = serial;
+		r.Sig.manufacturer = manufacturer;
+		r.Sig.product = product;
+		if (container)
+			r.Sig.containerId = Container(container);
+		return r;
+	}
+
+	// PhysicalDrive1: SanDisk stick with two volumes
+	// PhysicalDrive2 + 3: dual-bay enclosure, one container, same VID/PID, no serial
+	// PhysicalDrive4: card reader slot without a volume and without a container id
+	std::vector<UsbDeviceRecord> RecordedTable()
+	{
+		return {
+			Record(1, "USBSTOR\\DISK&VEN_SANDISK&PROD_ULTRA\\4C53000", "EF", "0781", "5581", "4C530001", "SanDisk", "Ultra", 0x3f2a9c01),
+			Record(2, "USBSTOR\\DISK&VEN_JMICRON&PROD_DUAL\\0&1", "G", "152D", "0562", "", "JMicron", "Dual Bay", 0x5e11aa02),
+			Record(3, "USBSTOR\\DISK&VEN_JMICRON&PROD_DUAL\\0&2", "H", "152D", "0562", "", "JMicron", "Dual Bay", 0x5e11aa02),
+			Record(4, "USBSTOR\\DISK&VEN_GENERIC&PROD_SD\\0000", "", "0BDA", "0158", "000000000", "Generic", "SD Reader", 0),
+		};
+	}
+
+	void LookupsFromTable()
+	{
+		UsbRegistry reg;
+		reg.Reset(RecordedTable());
+
+		CHECK_EQ(reg.Size(), 4u);
+		CHECK(reg.FindByLetter('E') && reg.FindByLetter('E')->DeviceNumber == 1);
+		CHECK(reg.FindByLetter('f') && reg.FindByLetter('f')->DeviceNumber == 1);   // case-insensitive
+		CHECK(reg.FindByLetter('H') && reg.FindByLetter('H')->DeviceNumber == 3);
+		CHECK(!reg.FindByLetter('C'));
+		CHECK(!reg.FindByLetter('1'));
+
+		CHECK_EQ(reg.FindByContainer(Container(0x5e11aa02)).size(), 2u);
+		CHECK_EQ(reg.FindByContainer(GUID{}).size(), 0u);                          // GUID_NULL is not a container
+
+		const UsbDeviceRecord* bay = reg.FindByDeviceNumber(2);
+		CHECK(bay != nullptr);
+		CHECK_EQ(reg.FindByCompositeKey(UsbRegistry::CompositeKey(bay->Sig)).size(), 2u);
+		CHECK_EQ(UsbRegistry::CompositeKey(reg.FindByDeviceNumber(1)->Sig), std::string("0781|5581|4C530001|SanDisk|Ultra"));
+	}
+
+	void HotPlugSequence()
+	{
+		UsbRegistry reg;
+		reg.Reset(RecordedTable());
+		uint64_t gen = reg.Generation();
+
+		// card inserted into the reader: a volume shows up on a known disk
+		reg.AssignLetter('I', 4);
+		CHECK(reg.FindByLetter('I') && reg.FindByLetter('I')->DeviceNumber == 4);
+		CHECK(reg.Generation() > gen);
+
+		// the user remaps F: of the stick to the card
+		reg.AssignLetter('F', 4);
+		CHECK_EQ(reg.FindByLetter('F')->DeviceNumber, 4u);
+		CHECK_EQ(reg.FindByDeviceNumber(1)->Letters.size(), 1u);
+		CHECK_EQ(reg.FindByDeviceNumber(4)->Letters.size(), 2u);
+
+		// stick re-enumerated with its second volume gone: old letters are unindexed
+		UsbDeviceRecord stick = RecordedTable()[0];
+		stick.Letters = { 'E' };
+		reg.Upsert(stick);
+		CHECK_EQ(reg.FindByLetter('E')->DeviceNumber, 1u);
+		CHECK_EQ(reg.FindByLetter('F')->DeviceNumber, 4u);
+
+		// one bay pulled
+		CHECK(reg.Remove(3));
+		CHECK(!reg.Remove(3));
+		CHECK(!reg.FindByLetter('H'));
+		CHECK_EQ(reg.FindByContainer(Container(0x5e11aa02)).size(), 1u);
+		CHECK_EQ(reg.FindByCompositeKey(UsbRegistry::CompositeKey(reg.FindByDeviceNumber(2)->Sig)).size(), 1u);
+
+		// a new disk claims a letter an old record still held
+		UsbDeviceRecord other = RecordedTable()[1];
+		other.DeviceNumber = 7;
+		other.Letters = { 'G' };
+		reg.Upsert(other);
+		CHECK_EQ(reg.FindByLetter('G')->DeviceNumber, 7u);
+		CHECK(reg.FindByDeviceNumber(2)->Letters.empty());
+
+		reg.ClearLetter('G');
+		CHECK(!reg.FindByLetter('G'));
+		CHECK_EQ(reg.Size(), 4u);
+	}
+
+	void MissesAreRemembered()
+	{
+		UsbRegistry reg;
+		reg.Reset(RecordedTable());
+
+		const uint64_t t0 = 1000000;
+		CHECK(!reg.RecentMiss('C', t0));
+
+		reg.RememberMiss('c', t0);
+		CHECK(reg.RecentMiss('C', t0));
+		CHECK(reg.RecentMiss('C', t0 + UsbRegistry::kMissTtlMs - 1));
+		CHECK(!reg.RecentMiss('C', t0 + UsbRegistry::kMissTtlMs));   // missed notifications get another look
+		CHECK(!reg.RecentMiss('D', t0));
+
+		// any change to the registry may have made the letter USB
+		reg.RememberMiss('J', t0);
+		reg.AssignLetter('J', 4);
+		CHECK(!reg.RecentMiss('J', t0));
+
+		reg.RememberMiss('K', t0);
+		reg.Reset(RecordedTable());
+		CHECK(!reg.RecentMiss('K', t0));
+
+		reg.RememberMiss('!', t0);
+		CHECK(!reg.RecentMiss('!', t0));
+	}
+}
+
+int main()
+{
+	LookupsFromTable();
+	HotPlugSequence();
+	MissesAreRemembered();
+	return CheckResult();
+}
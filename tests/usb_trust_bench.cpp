@@ -0,0 +1,142 @@
+// UsbTrustList: rule precedence and the text format, then import time and
+// Check() throughput for a large list.
+//
+//   usb_trust_bench            100k fingerprints, 1M checks
+//   usb_trust_bench --quick    10k / 100k (what ctest runs)
+
+#include "usb_trust.h"
+#include "check.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	UsbSignature Sig(const char* vid, const char* pid, std::string serial,
+		const char* manufacturer = "SanDisk", const char* product = "Ultra")
+	{
+		UsbSignature s;
+		s.vid = vid;
+		s.pid = pid;
+		s.serial = std::move(serial);
+		s.manufacturer = manufacturer;
+		s.product = product;
+		return s;
+	}
+
+	void Precedence()
+	{
+		UsbTrustList list;
+		const UsbSignature stick = Sig("0781", "5581", "4C530001");
+
+		CHECK_EQ(list.Check(stick), UsbTrust::Unknown);
+
+		list.AddRule(0x0781, -1, UsbTrust::Denied);
+		CHECK_EQ(list.Check(stick), UsbTrust::Denied);
+
+		list.AddRule(0x0781, 0x5581, UsbTrust::Allowed);   // VID+PID beats VID
+		CHECK_EQ(list.Check(stick), UsbTrust::Allowed);
+		CHECK_EQ(list.Check(Sig("0781", "5567", "X")), UsbTrust::Denied);
+
+		list.AddDevice(stick, UsbTrust::Denied);           // exact beats both
+		CHECK_EQ(list.Check(stick), UsbTrust::Denied);
+
+		list.AddDevice(stick, UsbTrust::Allowed);          // deny is sticky
+		CHECK_EQ(list.Check(stick), UsbTrust::Denied);
+
+		// normalization: case and padding don't make a different device
+		CHECK(UsbTrustList::Fingerprint(Sig("0781", "5581", "4c530001", " sandisk ", "ULTRA")) == UsbTrustList::Fingerprint(stick));
+		CHECK(UsbTrustList::Fingerprint(Sig("0781", "5581", "4C530002")) != UsbTrustList::Fingerprint(stick));
+
+		// the container id is part of the identity
+		UsbSignature moved = stick;
+		moved.containerId.Data1 = 1;
+		CHECK(UsbTrustList::Fingerprint(moved) != UsbTrustList::Fingerprint(stick));
+	}
+
+	void TextFormat()
+	{
+		UsbTrustList list;
+		std::vector<std::string> errors;
+		const size_t added = list.Import(
+			"# comment\n"
+			"allow vid 0781 pid 5581\n"
+			"deny  VID 1234   # trailing comment\n"
+			"allow 0123456789abcdef0123456789ABCDEF\n"
+			"\n"
+			"allow vid 12345\n"
+			"maybe vid 0781\n"
+			"deny 0123\n"
+			"allow vid 0781 pod 1\n", &errors);
+
+		CHECK_EQ(added, 3u);
+		CHECK_EQ(errors.size(), 4u);
+		CHECK_EQ(list.DeviceCount(), 1u);
+		CHECK_EQ(list.RuleCount(), 2u);
+
+		UsbTrustList again;
+		CHECK_EQ(again.Import(list.Export()), 3u);
+		CHECK_EQ(again.DeviceCount(), 1u);
+		CHECK_EQ(again.RuleCount(), 2u);
+		CHECK_EQ(again.Check(Sig("1234", "0001", "")), UsbTrust::Denied);
+		CHECK_EQ(again.Check(Sig("0781", "5581", "")), UsbTrust::Allowed);
+
+		UsbFingerprint fp;
+		CHECK(UsbFingerprint::FromHex("0123456789abcdef0123456789ABCDEF", fp));
+		CHECK_EQ(fp.Hex(), std::string("0123456789abcdef0123456789abcdef"));
+		CHECK(!UsbFingerprint::FromHex("0123", fp));
+	}
+
+	void Throughput(int entries, int checks)
+	{
+		std::vector<UsbSignature> sigs;
+		sigs.reserve(entries);
+		std::string text;
+		for (int i = 0; i < entries; ++i)
+		{
+			sigs.push_back(Sig("0781", "5581", "SN" + std::to_string(i)));
+			text += (i % 10 ? "allow " : "deny ") + UsbTrustList::Fingerprint(sigs.back()).Hex() + "\n";
+		}
+		text += "deny vid 0bda\nallow vid 0781 pid 5567\n";
+
+		UsbTrustList list;
+		auto t = std::chrono::steady_clock::now();
+		const size_t added = list.Import(text);
+		const double importMs = ElapsedMs(t);
+		CHECK_EQ(added, (size_t)entries + 2);
+
+		// half listed devices, half strangers falling through to the rules
+		int allowed = 0, denied = 0, unknown = 0;
+		t = std::chrono::steady_clock::now();
+		for (int i = 0; i < checks; ++i)
+		{
+			UsbTrust r;
+			if (i & 1)
+				r = list.Check(sigs[(size_t)(i / 2) % sigs.size()]);
+			else
+				r = list.Check(Sig(i % 4 ? "0781" : "0bda", "5567", "X" + std::to_string(i)));
+
+			allowed += r == UsbTrust::Allowed;
+			denied += r == UsbTrust::Denied;
+			unknown += r == UsbTrust::Unknown;
+		}
+		const double checkMs = ElapsedMs(t);
+
+		CHECK_EQ(unknown, 0);
+		CHECK(allowed > 0 && denied > 0);
+
+		std::printf("import %d entries: %.2f ms (%.0f ns/entry)\n", entries, importMs, importMs * 1e6 / entries);
+		std::printf("check %d signatures: %.2f ms (%.0f ns/check, fingerprint included)\n", checks, checkMs, checkMs * 1e6 / checks);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+
+	Precedence();
+	TextFormat();
+	Throughput(quick ? 10000 : 100000, quick ? 100000 : 1000000);
+	return CheckResult();
+}
@@ -0,0 +1,200 @@
+// WriteBehind with faults injected at every step of the atomic write, plus
+// the worker's bookkeeping around a write: in-flight jobs, Flush against a
+// concurrent SetDelay, and own-write detection while the file lands.
+
+#include "write_behind.h"
+#include "check.h"
+
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	std::string ReadAll(const fs::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::stringstream ss;
+		ss << in.rdbuf();
+		return ss.str();
+	}
+
+	void Put(const fs::path& path, const std::string& text)
+	{
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+	}
+
+	WriteBehind::Serializer Text(std::string text)
+	{
+		return [text](std::string& out) { out = text; };
+	}
+
+	bool WaitWritten(const fs::path& path, int timeoutMs)
+	{
+		const auto t0 = std::chrono::steady_clock::now();
+		while (WriteBehind::IsPending(path))
+		{
+			if (ElapsedMs(t0) > timeoutMs)
+				return false;
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		return true;
+	}
+
+	// Every step that fails leaves the old file and no temp behind
+	void FaultsKeepTheOldFile(const fs::path& dir)
+	{
+		const fs::path file = dir / "settings.hvk";
+		const std::pair<WriteFault, const char*> steps[] =
+		{
+			{ WriteFault::Open, "open" },
+			{ WriteFault::Write, "write" },
+			{ WriteFault::Flush, "flush" },
+			{ WriteFault::Backup, "backup" },
+			{ WriteFault::Rename, "rename" },
+		};
+
+		for (const auto& [fault, name] : steps)
+		{
+			Put(file, "old");
+			WriteBehind::SetFaultHook([fault = fault](WriteFault f, const fs::path&) { return f == fault; });
+
+			std::string error;
+			CHECK(!WriteBehind::WriteAtomic(file, "new", &error));
+			CHECK(error == name);
+			CHECK(ReadAll(file) == "old");
+
+			fs::path tmp = file;
+			tmp += ".tmp";
+			CHECK(!fs::exists(tmp));
+		}
+
+		WriteBehind::SetFaultHook(nullptr);
+		std::string error;
+		CHECK(WriteBehind::WriteAtomic(file, "new", &error));
+		CHECK(ReadAll(file) == "new");
+		CHECK(ReadAll(WriteBehind::BackupPath(file)) == "old");
+	}
+
+	// A failed first target stops the job: the snapshot is never newer than the JSON
+	void FailedTargetStopsTheJob(const fs::path& dir)
+	{
+		const fs::path json = dir / "user.hvk";
+		const fs::path snap = dir / "user.hvkb";
+		Put(json, "json 1");
+		Put(snap, "snap 1");
+
+		const uint64_t failures = WriteBehind::Stats().Failures;
+		WriteBehind::SetFaultHook([json](WriteFault f, const fs::path& p) { return f == WriteFault::Rename && p == json; });
+		WriteBehind::Request({ { json, Text("json 2") }, { snap, Text("snap 2") } });
+		WriteBehind::Flush();
+		WriteBehind::SetFaultHook(nullptr);
+
+		CHECK_EQ(WriteBehind::Stats().Failures, failures + 1);
+		CHECK(ReadAll(json) == "json 1");
+		CHECK(ReadAll(snap) == "snap 1");
+		CHECK(!WriteBehind::IsOwnWrite(json, "json 2"));   // not on disk, not ours
+
+		WriteBehind::Request({ { json, Text("json 3") }, { snap, Text("snap 3") } });
+		WriteBehind::Flush();
+		CHECK(ReadAll(json) == "json 3");
+		CHECK(ReadAll(snap) == "snap 3");
+		CHECK(WriteBehind::IsOwnWrite(json, "json 3"));
+		CHECK(WriteBehind::IsOwnWrite(snap, "snap 3"));
+	}
+
+	// A watcher can read the file as soon as the rename lands
+	void OwnWriteKnownBeforeRename(const fs::path& dir)
+	{
+		const fs::path file = dir / "own.hvk";
+		std::atomic<int> seen{ -1 };
+		WriteBehind::SetFaultHook([&](WriteFault f, const fs::path& p)
+			{
+				if (f == WriteFault::Rename && p == file)
+					seen = WriteBehind::IsOwnWrite(file, "mine") ? 1 : 0;
+				return false;
+			});
+
+		WriteBehind::Request(file, Text("mine"));
+		WriteBehind::Flush();
+		WriteBehind::SetFaultHook(nullptr);
+		CHECK_EQ(seen.load(), 1);
+	}
+
+	// The job being written still counts as pending for both of its files
+	void InFlightIsPending(const fs::path& dir)
+	{
+		const fs::path json = dir / "inflight.hvk";
+		const fs::path snap = dir / "inflight.hvkb";
+
+		std::promise<void> release;
+		std::shared_future<void> go = release.get_future().share();
+		std::atomic<bool> started{ false };
+
+		WriteBehind::SetDelay(0);
+		WriteBehind::Request({
+			{ json, [&, go](std::string& out) { started = true; go.wait(); out = "json"; } },
+			{ snap, Text("snap") },
+		});
+
+		while (!started)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		CHECK(WriteBehind::IsPending(json));
+		CHECK(WriteBehind::IsPending(snap));
+
+		release.set_value();
+		WriteBehind::Flush();
+		CHECK(!WriteBehind::IsPending(json));
+		CHECK(!WriteBehind::IsPending(snap));
+		CHECK(ReadAll(snap) == "snap");
+	}
+
+	// Flush must not put back a delay that changed while it waited
+	void FlushKeepsConcurrentDelay(const fs::path& dir)
+	{
+		const fs::path file = dir / "delay.hvk";
+
+		std::promise<void> release;
+		std::shared_future<void> go = release.get_future().share();
+		std::atomic<bool> started{ false };
+
+		WriteBehind::SetDelay(60000);
+		WriteBehind::Request(file, [&, go](std::string& out) { started = true; go.wait(); out = "1"; });
+
+		const auto t0 = std::chrono::steady_clock::now();
+		std::thread flusher([] { WriteBehind::Flush(); });
+		while (!started)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		CHECK(ElapsedMs(t0) < 1000);   // Flush skipped the minute-long delay
+
+		WriteBehind::SetDelay(20);
+		release.set_value();
+		flusher.join();
+
+		WriteBehind::Request(file, Text("2"));
+		CHECK(WaitWritten(file, 2000));
+		CHECK(ReadAll(file) == "2");
+	}
+}
+
+int main()
+{
+	const fs::path dir = fs::temp_directory_path() / "hvk_write_behind_test";
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+
+	FaultsKeepTheOldFile(dir);
+	FailedTargetStopsTheJob(dir);
+	OwnWriteKnownBeforeRename(dir);
+	InFlightIsPending(dir);
+	FlushKeepsConcurrentDelay(dir);
+
+	WriteBehind::Shutdown();
+	fs::remove_all(dir);
+	return CheckResult();
+}